@@ -0,0 +1,89 @@
+/*
+  bench.h - minimal Google-Benchmark-style harness for host microbenchmarks
+
+  Benchmarks register themselves with BENCHMARK(fn) and loop on
+  `while (state.KeepRunning())`; the harness sizes the iteration count so
+  each benchmark runs for at least --min-time seconds (default 0.25) and
+  reports nanoseconds per operation. Self tests register with
+  BENCH_SELFTEST(fn) and run with --check (used by ctest).
+*/
+
+#ifndef __HOST_BENCH_H__
+#define __HOST_BENCH_H__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+
+class State {
+public:
+  explicit State(double min_time_s) : _min_time(min_time_s) {}
+
+  // Iteration control: doubles the batch size until the minimum run time
+  // is reached, so the clock is only read between batches.
+  bool KeepRunning() {
+    if (0 == _iters) {
+      _start = std::chrono::steady_clock::now();
+      _target = 16;
+      _iters = 1;
+      return true;
+    }
+    if (_iters < _target) {
+      _iters++;
+      return true;
+    }
+    _elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+    if (_elapsed >= _min_time) {
+      return false;
+    }
+    _target *= 2;
+    _iters++;
+    return true;
+  }
+
+  double NsPerOp() const { return (_iters > 0) ? (_elapsed * 1e9) / (double)_iters : 0; }
+  uint64_t Iterations() const { return _iters; }
+
+  // Assign results here to defeat dead code elimination
+  volatile int64_t sink = 0;
+
+private:
+  double _min_time;
+  double _elapsed = 0;
+  uint64_t _iters = 0;
+  uint64_t _target = 0;
+  std::chrono::steady_clock::time_point _start;
+};
+
+typedef void (*BenchFn)(State &);
+typedef bool (*CheckFn)(void);
+
+struct Benchmark {
+  const char *name;
+  BenchFn fn;
+};
+
+struct SelfTest {
+  const char *name;
+  CheckFn fn;
+};
+
+std::vector<Benchmark> & Benchmarks(void);
+std::vector<SelfTest> & SelfTests(void);
+
+struct RegisterBenchmark {
+  RegisterBenchmark(const char *name, BenchFn fn) { Benchmarks().push_back({name, fn}); }
+};
+struct RegisterSelfTest {
+  RegisterSelfTest(const char *name, CheckFn fn) { SelfTests().push_back({name, fn}); }
+};
+
+}  // namespace bench
+
+#define BENCHMARK(fn) static ::bench::RegisterBenchmark _bench_reg_##fn(#fn, fn)
+#define BENCH_SELFTEST(fn) static ::bench::RegisterSelfTest _bench_check_reg_##fn(#fn, fn)
+
+#endif  // __HOST_BENCH_H__
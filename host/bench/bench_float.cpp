@@ -0,0 +1,88 @@
+/*
+  bench_float.cpp - benchmarks and self tests for the support_float.ino routines
+
+  The .ino is self contained math, so it is compiled here directly, wrapped
+  in a namespace to keep its sinf/cosf/sqrtf redefinitions away from libm.
+*/
+
+#include "bench.h"
+
+#include <math.h>     // not <cmath>: the .ino needs the isnan() macro
+#include <cstdint>
+
+namespace tasmota_float {
+// forward declarations the Arduino preprocessor would normally generate
+float cos_52(float x);
+float sin_52(float x);
+float tan_56(float x);
+float atan_66(float x);
+float asinf1(float x);
+float acosf1(float x);
+float sqrt1(const float x);
+#include "support_float.ino"
+}
+
+static void BM_Sin52(bench::State &state) {
+  float x = 0.1f;
+  float acc = 0;
+  while (state.KeepRunning()) {
+    acc += tasmota_float::sin_52(x);
+    x += 0.001f;
+    if (x > 1.5f) { x = 0.1f; }
+  }
+  state.sink += (int64_t)acc;
+}
+BENCHMARK(BM_Sin52);
+
+static void BM_LibmSinf(bench::State &state) {
+  float x = 0.1f;
+  float acc = 0;
+  while (state.KeepRunning()) {
+    acc += ::sinf(x);
+    x += 0.001f;
+    if (x > 1.5f) { x = 0.1f; }
+  }
+  state.sink += (int64_t)acc;
+}
+BENCHMARK(BM_LibmSinf);
+
+static void BM_Sqrt1(bench::State &state) {
+  float x = 1.0f;
+  float acc = 0;
+  while (state.KeepRunning()) {
+    acc += tasmota_float::sqrt1(x);
+    x += 0.5f;
+    if (x > 10000.0f) { x = 1.0f; }
+  }
+  state.sink += (int64_t)acc;
+}
+BENCHMARK(BM_Sqrt1);
+
+static void BM_FastPrecisePowf(bench::State &state) {
+  float x = 1.1f;
+  float acc = 0;
+  while (state.KeepRunning()) {
+    acc += tasmota_float::FastPrecisePowf(x, 2.5f);
+    x += 0.01f;
+    if (x > 5.0f) { x = 1.1f; }
+  }
+  state.sink += (int64_t)acc;
+}
+BENCHMARK(BM_FastPrecisePowf);
+
+static bool Check_FloatApprox(void) {
+  // the approximations must stay within their documented accuracy
+  for (float x = -1.5f; x < 1.5f; x += 0.01f) {
+    if (fabsf(tasmota_float::sin_52(x) - ::sinf(x)) > 2e-4f) { return false; }
+    if (fabsf(tasmota_float::cos_52(x) - ::cosf(x)) > 2e-4f) { return false; }
+  }
+  for (float x = 0.01f; x < 1000.0f; x *= 1.3f) {
+    float ref = ::sqrtf(x);
+    if (fabsf(tasmota_float::sqrt1(x) - ref) > ref * 1e-3f) { return false; }
+  }
+  // FastPrecisePow trades accuracy for speed, ~3% off at 2^10
+  float p = tasmota_float::FastPrecisePowf(2.0f, 10.0f);
+  if ((p < 973.0f) || (p > 1075.0f)) { return false; }
+  return true;
+}
+BENCH_SELFTEST(Check_FloatApprox);
@@ -0,0 +1,56 @@
+/*
+  bench_jsmn.cpp - benchmarks and self tests for the jsmn-shadinger JSON parser
+*/
+
+#include "bench.h"
+
+#include <cstring>
+#include "JsonParser.h"
+
+// Typical Tasmota telemetry payload
+static const char kTelemetry[] =
+  "{\"Time\":\"2026-01-01T12:00:00\",\"Uptime\":\"0T01:02:03\",\"Heap\":27,"
+  "\"SleepMode\":\"Dynamic\",\"Sleep\":50,\"LoadAvg\":19,\"MqttCount\":1,"
+  "\"POWER\":\"ON\",\"Dimmer\":50,\"Color\":\"255,128,0\","
+  "\"ENERGY\":{\"Total\":12.345,\"Yesterday\":1.234,\"Today\":0.123,"
+  "\"Power\":67,\"ApparentPower\":70,\"ReactivePower\":20,\"Factor\":0.96,"
+  "\"Voltage\":230,\"Current\":0.291}}";
+
+static void BM_JsonParse(bench::State &state) {
+  char buffer[sizeof(kTelemetry)];
+  while (state.KeepRunning()) {
+    memcpy(buffer, kTelemetry, sizeof(kTelemetry));   // parser modifies the buffer in place
+    JsonParser parser(buffer);
+    JsonParserObject root = parser.getRootObject();
+    state.sink += root[PSTR("Dimmer")].getUInt();
+  }
+}
+BENCHMARK(BM_JsonParse);
+
+static void BM_JsonNestedLookup(bench::State &state) {
+  char buffer[sizeof(kTelemetry)];
+  memcpy(buffer, kTelemetry, sizeof(kTelemetry));
+  JsonParser parser(buffer);
+  JsonParserObject root = parser.getRootObject();
+  while (state.KeepRunning()) {
+    JsonParserObject energy = root[PSTR("ENERGY")].getObject();
+    state.sink += (int64_t)(energy[PSTR("Factor")].getFloat() * 100);
+  }
+}
+BENCHMARK(BM_JsonNestedLookup);
+
+static bool Check_JsonParse(void) {
+  char buffer[sizeof(kTelemetry)];
+  memcpy(buffer, kTelemetry, sizeof(kTelemetry));
+  JsonParser parser(buffer);
+  JsonParserObject root = parser.getRootObject();
+  if (!root.isValid()) { return false; }
+  if (root[PSTR("Dimmer")].getUInt() != 50) { return false; }
+  if (0 != strcmp(root[PSTR("POWER")].getStr(), "ON")) { return false; }
+  JsonParserObject energy = root[PSTR("ENERGY")].getObject();
+  if (energy[PSTR("Power")].getUInt() != 67) { return false; }
+  float total = energy[PSTR("Total")].getFloat();
+  if ((total < 12.34f) || (total > 12.35f)) { return false; }
+  return true;
+}
+BENCH_SELFTEST(Check_JsonParse);
@@ -0,0 +1,80 @@
+/*
+  bench_main.cpp - runner for the host microbenchmark and self test harness
+
+  Usage:
+    tasmota-bench                  run all benchmarks, human readable table
+    tasmota-bench --json           same, as a JSON object for CI comparison
+    tasmota-bench --filter str     run only benchmarks whose name contains str
+    tasmota-bench --min-time s     minimum run time per benchmark (default 0.25)
+    tasmota-bench --check          run correctness self tests, exit 1 on failure
+*/
+
+#include "bench.h"
+
+#include <cstring>
+#include <string>
+
+namespace bench {
+
+std::vector<Benchmark> & Benchmarks(void) {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+std::vector<SelfTest> & SelfTests(void) {
+  static std::vector<SelfTest> self_tests;
+  return self_tests;
+}
+
+}  // namespace bench
+
+int main(int argc, char **argv) {
+  bool check = false;
+  bool json = false;
+  double min_time = 0.25;
+  const char *filter = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (0 == strcmp(argv[i], "--check")) {
+      check = true;
+    } else if (0 == strcmp(argv[i], "--json")) {
+      json = true;
+    } else if ((0 == strcmp(argv[i], "--filter")) && (i + 1 < argc)) {
+      filter = argv[++i];
+    } else if ((0 == strcmp(argv[i], "--min-time")) && (i + 1 < argc)) {
+      min_time = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "unknown option '%s'\n", argv[i]);
+      return 2;
+    }
+  }
+
+  if (check) {
+    int failed = 0;
+    for (auto &test : bench::SelfTests()) {
+      bool ok = test.fn();
+      printf("%-40s %s\n", test.name, ok ? "ok" : "FAILED");
+      if (!ok) { failed++; }
+    }
+    printf("%d self test(s), %d failure(s)\n", (int)bench::SelfTests().size(), failed);
+    return (failed > 0) ? 1 : 0;
+  }
+
+  bool first = true;
+  if (json) { printf("{"); }
+  for (auto &benchmark : bench::Benchmarks()) {
+    if (filter && (nullptr == strstr(benchmark.name, filter))) { continue; }
+    bench::State state(min_time);
+    benchmark.fn(state);
+    if (json) {
+      printf("%s\"%s\":{\"ns_per_op\":%.1f,\"iterations\":%llu}",
+        first ? "" : ",", benchmark.name, state.NsPerOp(), (unsigned long long)state.Iterations());
+    } else {
+      printf("%-40s %12.1f ns/op %12llu iters\n",
+        benchmark.name, state.NsPerOp(), (unsigned long long)state.Iterations());
+    }
+    first = false;
+  }
+  if (json) { printf("}\n"); }
+  return 0;
+}
@@ -0,0 +1,47 @@
+/*
+  bench_unishox.cpp - benchmarks and self tests for the Unishox compressor
+*/
+
+#include "bench.h"
+
+#include <cstring>
+#include "unishox.h"
+
+static const char kRules[] =
+  "ON Switch1#State DO Power1 %value% ENDON "
+  "ON Tele-SI7021#Temperature>25 DO Backlog Power2 1; RuleTimer1 600 ENDON "
+  "ON Rules#Timer=1 DO Power2 0 ENDON";
+
+static void BM_UnishoxCompress(bench::State &state) {
+  Unishox compressor;
+  char buffer[sizeof(kRules) + 16];
+  while (state.KeepRunning()) {
+    state.sink += compressor.unishox_compress(kRules, strlen(kRules), buffer, sizeof(buffer));
+  }
+}
+BENCHMARK(BM_UnishoxCompress);
+
+static void BM_UnishoxDecompress(bench::State &state) {
+  Unishox compressor;
+  char compressed[sizeof(kRules) + 16];
+  char buffer[sizeof(kRules) + 16];
+  int32_t clen = compressor.unishox_compress(kRules, strlen(kRules), compressed, sizeof(compressed));
+  while (state.KeepRunning()) {
+    state.sink += compressor.unishox_decompress(compressed, clen, buffer, sizeof(buffer));
+  }
+}
+BENCHMARK(BM_UnishoxDecompress);
+
+static bool Check_UnishoxRoundtrip(void) {
+  Unishox compressor;
+  char compressed[sizeof(kRules) + 16];
+  char buffer[sizeof(kRules) + 16];
+  size_t len = strlen(kRules);
+  int32_t clen = compressor.unishox_compress(kRules, len, compressed, sizeof(compressed));
+  if (clen <= 0) { return false; }
+  if ((size_t)clen >= len) { return false; }          // rules text must actually compress
+  int32_t dlen = compressor.unishox_decompress(compressed, clen, buffer, sizeof(buffer));
+  if (dlen != (int32_t)len) { return false; }
+  return (0 == memcmp(buffer, kRules, len));
+}
+BENCH_SELFTEST(Check_UnishoxRoundtrip);
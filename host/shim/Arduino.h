@@ -0,0 +1,62 @@
+/*
+  Arduino.h - host shim for the Arduino core
+
+  Just enough of the Arduino environment to compile the portable cores
+  (jsmn-shadinger, Unishox, support_float) on a Linux/macOS host for the
+  benchmark and test harness in host/. Not a general purpose port.
+*/
+
+#ifndef __HOST_SHIM_ARDUINO_H__
+#define __HOST_SHIM_ARDUINO_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+
+#include "pgmspace.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class __FlashStringHelper;
+
+// Minimal Arduino String backed by std::string, only the methods used by
+// the portable cores.
+class String {
+public:
+  String() {}
+  String(const char *s) : _s(s ? s : "") {}
+  String(const String &s) : _s(s._s) {}
+  String(const __FlashStringHelper *s) : _s(reinterpret_cast<const char *>(s)) {}
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return (unsigned int)_s.length(); }
+
+  String & operator=(const String &s) { _s = s._s; return *this; }
+  String & operator=(const char *s) { _s = (s ? s : ""); return *this; }
+  bool operator==(const String &s) const { return _s == s._s; }
+  bool operator==(const char *s) const { return _s == (s ? s : ""); }
+
+  bool startsWith(const String &prefix) const {
+    return _s.compare(0, prefix._s.length(), prefix._s) == 0;
+  }
+  bool equals(const char *s) const { return _s == (s ? s : ""); }
+  bool equalsIgnoreCase(const char *s) const {
+    return s && (0 == strcasecmp(_s.c_str(), s));
+  }
+  void toLowerCase() {
+    for (auto &c : _s) { c = (char)tolower((unsigned char)c); }
+  }
+  void toUpperCase() {
+    for (auto &c : _s) { c = (char)toupper((unsigned char)c); }
+  }
+
+private:
+  std::string _s;
+};
+
+#endif  // __HOST_SHIM_ARDUINO_H__
@@ -0,0 +1,44 @@
+/*
+  pgmspace.h - host shim for AVR/ESP progmem accessors
+
+  On the host there is no flash/RAM split, so PROGMEM is a no-op and the
+  pgm_read accessors are plain memory reads. Keep this file minimal: only
+  what the portable cores (jsmn-shadinger, Unishox, support_float) use.
+*/
+
+#ifndef __HOST_SHIM_PGMSPACE_H__
+#define __HOST_SHIM_PGMSPACE_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P             const char *
+#define PGM_VOID_P        const void *
+#define PSTR(s)           (s)
+#define FPSTR(p)          (reinterpret_cast<const char *>(p))
+
+#define pgm_read_byte(addr)   (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)   (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr)  (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_float(addr)  (*reinterpret_cast<const float *>(addr))
+#define pgm_read_ptr(addr)    (*reinterpret_cast<void *const *>(addr))
+
+#define memcpy_P          memcpy
+#define memcmp_P          memcmp
+#define strcpy_P          strcpy
+#define strncpy_P         strncpy
+#define strcat_P          strcat
+#define strcmp_P          strcmp
+#define strncmp_P         strncmp
+#define strcasecmp_P      strcasecmp
+#define strlen_P          strlen
+#define strstr_P          strstr
+#define strchr_P          strchr
+#define snprintf_P        snprintf
+#define sprintf_P         sprintf
+#define vsnprintf_P       vsnprintf
+
+#endif  // __HOST_SHIM_PGMSPACE_H__
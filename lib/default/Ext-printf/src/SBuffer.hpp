@@ -23,21 +23,76 @@ typedef struct SBuffer_impl {
   uint8_t buf[];                     // the actual data
 } SBuffer_impl;
 
-
-
+#ifndef SBUFFER_INLINE_SIZE
+#define SBUFFER_INLINE_SIZE 32  // buffers up to this size live inside the object, no heap allocation
+#endif
+
+// Small buffers (<= SBUFFER_INLINE_SIZE bytes, i.e. most Zigbee and serial frames) are
+// stored inline in the object. Larger buffers go to the heap as before. Copy duplicates
+// the content; move steals the heap buffer (or memcpy's the inline bytes) and leaves the
+// source valid and empty, so frames travel through the pipeline without allocating.
 typedef class SBuffer {
 
 protected:
   SBuffer(void) {
-    // unused empty constructor except from subclass
+    newBuffer(SBUFFER_INLINE_SIZE);   // subclasses get a valid empty inline buffer
   }
 
-public:
-  SBuffer(const size_t size) {
-    _buf = (SBuffer_impl*) new char[size+4];   // add 4 bytes for size and len
+  // set up the internal buffer for `size` bytes, inline when small enough
+  void newBuffer(const size_t size) {
+    if (size <= SBUFFER_INLINE_SIZE) {
+      _buf = (SBuffer_impl*) _inline;
+    } else {
+      _buf = (SBuffer_impl*) new char[size+4];   // add 4 bytes for size and len
+    }
     _buf->size = size;
     _buf->len = 0;
-    //*((uint32_t*)_buf) = size;   // writing both size and len=0 in a single 32 bits write
+  }
+
+  inline bool isInline(void) const { return _buf == (const SBuffer_impl*) _inline; }
+
+public:
+  SBuffer(const size_t size) {
+    newBuffer(size);
+  }
+
+  SBuffer(const SBuffer &rhs) {
+    newBuffer(rhs.size());
+    _buf->len = rhs.len();
+    memcpy(_buf->buf, rhs.buf(), rhs.len());
+  }
+
+  SBuffer(SBuffer &&rhs) noexcept {
+    if (rhs.isInline()) {
+      _buf = (SBuffer_impl*) _inline;
+      memcpy(_inline, rhs._inline, 4 + rhs.len());   // header and data
+    } else {
+      _buf = rhs._buf;                               // steal the heap buffer
+      rhs.newBuffer(SBUFFER_INLINE_SIZE);            // leave rhs valid and empty
+    }
+  }
+
+  SBuffer & operator=(const SBuffer &rhs) {
+    if (this != &rhs) {
+      reserve(rhs.len());
+      _buf->len = rhs.len();
+      memcpy(_buf->buf, rhs.buf(), rhs.len());
+    }
+    return *this;
+  }
+
+  SBuffer & operator=(SBuffer &&rhs) noexcept {
+    if (this != &rhs) {
+      if (!isInline()) { delete[] (char*)_buf; }
+      if (rhs.isInline()) {
+        _buf = (SBuffer_impl*) _inline;
+        memcpy(_inline, rhs._inline, 4 + rhs.len());
+      } else {
+        _buf = rhs._buf;
+        rhs.newBuffer(SBUFFER_INLINE_SIZE);
+      }
+    }
+    return *this;
   }
 
   inline size_t getSize(void) const { return _buf->size; }
@@ -49,7 +104,9 @@ public:
   inline char    *charptr(size_t i = 0) const { return (char*) &_buf->buf[i]; }
 
   ~SBuffer(void) {
-    delete[] _buf;
+    if (!isInline()) {
+      delete[] (char*)_buf;
+    }
   }
 
   // increase the internal buffer if needed
@@ -61,7 +118,7 @@ public:
       new_buf->size = size;
       new_buf->len = _buf->len;
       memmove(&new_buf->buf, &_buf->buf, _buf->len);               // copy buffer
-      delete[] _buf;
+      if (!isInline()) { delete[] (char*)_buf; }
       _buf = new_buf;
     }
   }
@@ -300,5 +357,97 @@ protected:
 
 protected:
   SBuffer_impl * _buf;
+  alignas(4) uint8_t _inline[SBUFFER_INLINE_SIZE + 4];   // inline storage for small buffers, same 4 byte header
 
 } SBuffer;
+
+// Non-owning view of a byte slice, with the read accessors of SBuffer.
+// Used to parse frames in place without copying: the view does not manage
+// the underlying memory and must not outlive the buffer it was carved from.
+class SBufferView {
+
+public:
+  SBufferView(void) : _data(nullptr), _len(0) {}
+  SBufferView(uint8_t *data, size_t len) : _data(data), _len(len) {}
+  SBufferView(const SBuffer &buf) : _data(buf.buf()), _len(buf.len()) {}    // implicit on purpose
+  SBufferView(const SBuffer &buf, size_t start, size_t len) {
+    if (start >= buf.len()) {
+      len = 0;
+      start = 0;
+    } else if (start + len > buf.len()) {
+      len = buf.len() - start;
+    }
+    _data = buf.buf(start);
+    _len = len;
+  }
+
+  inline size_t len(void) const { return _len; }
+  inline size_t getLen(void) const { return _len; }
+  inline uint8_t *getBuffer(void) const { return _data; }
+  inline uint8_t *buf(size_t i = 0) const { return &_data[i]; }
+  inline char    *charptr(size_t i = 0) const { return (char*) &_data[i]; }
+
+  // sub-view skipping `start` bytes, clamped to the current slice
+  SBufferView sub(size_t start, size_t len = SIZE_MAX) const {
+    if (start >= _len) { return SBufferView(_data, 0); }
+    if (len > _len - start) { len = _len - start; }
+    return SBufferView(_data + start, len);
+  }
+
+  // in-place mutation of the viewed bytes (the underlying frame is transient)
+  void set8(const size_t offset, const uint8_t data) const {
+    if (offset < _len) {
+      _data[offset] = data;
+    }
+  }
+
+  uint8_t get8(const size_t offset) const {
+    if (offset < _len) {
+      return _data[offset];
+    }
+    return 0;
+  }
+  uint8_t read8(const size_t offset) const { return get8(offset); }
+  uint16_t get16(const size_t offset) const {
+    if (offset + 2 <= _len) {
+      return _data[offset] | (_data[offset+1] << 8);
+    }
+    return 0;
+  }
+  uint16_t get16BigEndian(const size_t offset) const {
+    if (offset + 2 <= _len) {
+      return _data[offset+1] | (_data[offset] << 8);
+    }
+    return 0;
+  }
+  uint32_t get32(const size_t offset) const {
+    if (offset + 4 <= _len) {
+      return _data[offset] | (_data[offset+1] << 8) |
+            (_data[offset+2] << 16) | (_data[offset+3] << 24);
+    }
+    return 0;
+  }
+  uint32_t get32BigEndian(const size_t offset) const {
+    if (offset + 4 <= _len) {
+      return _data[offset+3] | (_data[offset+2] << 8) |
+            (_data[offset+1] << 16) | (_data[offset] << 24);
+    }
+    return 0;
+  }
+  int32_t get32IBigEndian(const size_t offset) const {
+    return get32BigEndian(offset);
+  }
+  uint64_t get64(const size_t offset) const {
+    if (offset + 8 <= _len) {
+      return (uint64_t)_data[offset]          | ((uint64_t)_data[offset+1] <<  8) |
+            ((uint64_t)_data[offset+2] << 16) | ((uint64_t)_data[offset+3] << 24) |
+            ((uint64_t)_data[offset+4] << 32) | ((uint64_t)_data[offset+5] << 40) |
+            ((uint64_t)_data[offset+6] << 48) | ((uint64_t)_data[offset+7] << 56);
+    }
+    return 0;
+  }
+
+protected:
+  uint8_t *_data;
+  size_t   _len;
+};
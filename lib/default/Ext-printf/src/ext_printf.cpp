@@ -21,6 +21,9 @@
 #include <Arduino.h>
 #include <IPAddress.h>
 #include <SBuffer.hpp>
+#ifdef ESP32
+#include "soc/soc.h"        // SOC_DROM_LOW/HIGH to detect flash-resident format strings
+#endif
 
 /*********************************************************************************************\
  * va_list extended support
@@ -257,7 +260,275 @@ char * copyStr(const char * str) {
 const char ext_invalid_mem[] PROGMEM = "<--INVALID-->";
 const uint32_t min_valid_ptr = 0x3F000000;    // addresses below this line are invalid
 
+/*********************************************************************************************\
+ * Precompiled format programs
+ *
+ * Telemetry and logging reuse the same static formats forever, so the per-call work that
+ * depends only on the format string - copying it to RAM, scanning it char by char and
+ * rewriting the `%_X` extensions for vsnprintf - is done once. The first call compiles the
+ * format into a patched RAM string plus a micro-op list (one op per conversion spec), keyed
+ * by the PROGMEM pointer. Subsequent calls with the same pointer only walk the op list to
+ * patch the arguments in place. Formats living in RAM are not cached: their address can be
+ * reused with different content.
+\*********************************************************************************************/
+
+#ifndef EXT_PRINTF_CACHE_SIZE
+#define EXT_PRINTF_CACHE_SIZE 16      // number of format programs kept, round-robin eviction
+#endif
+#ifndef EXT_PRINTF_MAX_OPS
+#define EXT_PRINTF_MAX_OPS    24      // formats with more conversion specs are not cached
+#endif
+
+typedef struct ExtFmtOp {
+  char    ext;                        // extension char ('H','B','b','I','f','X','U'), 0 = plain argument
+  int8_t  star;                       // 1 if decimals come from a '*' argument
+  int16_t decimals;                   // compile-time decimals, -2 = default
+} ExtFmtOp;
+
+typedef struct ExtFmtProgram {
+  const char * fmt_P;                 // cache key, nullptr = unused slot
+  char *       fmt_patched;           // RAM format with extensions rewritten for vsnprintf
+  uint8_t      count;
+  ExtFmtOp     ops[EXT_PRINTF_MAX_OPS];
+} ExtFmtProgram;
+
+static ExtFmtProgram ext_fmt_cache[EXT_PRINTF_CACHE_SIZE] = {};
+static uint8_t ext_fmt_cache_rr = 0;
+
+static const uint32_t EXT_ALLOC_SIZE = 12;
+static const char * ext_allocs[EXT_ALLOC_SIZE] = {};   // initialized to zeroes
+static char ext_hex[34];              // buffer used for 64 bits, favor RAM instead of stack to remove pressure
+
+static bool ExtFmtInFlash(const char * ptr) {
+#ifdef ESP8266
+  return ((uint32_t)ptr >= 0x40200000);    // PROGMEM lives in mapped flash
+#elif defined(ESP32)
+  return ((uint32_t)ptr >= SOC_DROM_LOW) && ((uint32_t)ptr < SOC_DROM_HIGH);
+#else
+  return false;
+#endif
+}
+
+static ExtFmtProgram * ExtFmtLookup(const char * fmt_P) {
+  for (uint32_t i = 0; i < EXT_PRINTF_CACHE_SIZE; i++) {
+    if (ext_fmt_cache[i].fmt_P == fmt_P) { return &ext_fmt_cache[i]; }
+  }
+  return nullptr;
+}
+
+// takes ownership of `fmt_patched`
+static void ExtFmtInstall(const char * fmt_P, char * fmt_patched, const ExtFmtOp * ops, uint32_t count) {
+  ExtFmtProgram & slot = ext_fmt_cache[ext_fmt_cache_rr];
+  ext_fmt_cache_rr = (ext_fmt_cache_rr + 1) % EXT_PRINTF_CACHE_SIZE;
+  slot.fmt_P = nullptr;
+  free(slot.fmt_patched);
+  slot.fmt_patched = fmt_patched;
+  slot.count = count;
+  memcpy(slot.ops, ops, count * sizeof(ExtFmtOp));
+  slot.fmt_P = fmt_P;
+}
+
+// Format one extension argument, returns the replacement string.
+// Returns nullptr on allocation failure only; temp strings are pushed to ext_allocs.
+static const char * ExtFormatArg(char ext, int32_t decimals, uint32_t cur_val, uint32_t & alloc_idx) {
+  const char * new_val_str = "";
+  switch (ext) {
+    case 'H':     // Hex, decimals indicates the length, default 2
+      {
+        if (decimals < 0) { decimals = 0; }
+        if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
+        else if (decimals > 0) {
+          char * hex_char = (char*) malloc(decimals*2 + 2);
+          if (hex_char == nullptr) { return nullptr; }
+          ToHex_P((const uint8_t *)cur_val, decimals, hex_char, decimals*2 + 2);
+          new_val_str = hex_char;
+          ext_allocs[alloc_idx++] = new_val_str;
+        }
+      }
+      break;
+
+    case 'B':     // Pointer to SBuffer
+      {
+        if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
+        else {
+          const SBuffer & buf = *(const SBuffer*)cur_val;
+          size_t buf_len = (&buf != nullptr) ? buf.len() : 0;
+          if (buf_len) {
+            char * hex_char = (char*) malloc(buf_len*2 + 2);
+            if (hex_char == nullptr) { return nullptr; }
+            ToHex_P(buf.getBuffer(), buf_len, hex_char, buf_len*2 + 2);
+            new_val_str = hex_char;
+            ext_allocs[alloc_idx++] = new_val_str;
+          }
+        }
+      }
+      break;
+
+    // '%_b' outputs a uint32_t to binary
+    // '%8_b' outputs a uint8_t to binary
+    case 'b':     // Binary, decimals indicates the zero prefill
+      {
+        ToBinary(cur_val, ext_hex, decimals);
+        new_val_str = copyStr(ext_hex);
+        if (new_val_str == nullptr) { return nullptr; }
+        ext_allocs[alloc_idx++] = new_val_str;
+      }
+      break;
+
+    // `%_I` ouputs an IPv4 32 bits address passed as u32 into a decimal dotted format
+    case 'I':     // Input is `uint32_t` 32 bits IP address, output is decimal dotted address
+      {
+        char * ip_str = (char*) malloc(16);
+        if (ip_str == nullptr) { return nullptr; }
+        snprintf_P(ip_str, 16, PSTR("%u.%u.%u.%u"), cur_val & 0xFF, (cur_val >> 8) & 0xFF, (cur_val >> 16) & 0xFF, (cur_val >> 24) & 0xFF);
+        new_val_str = ip_str;
+        ext_allocs[alloc_idx++] = new_val_str;
+      }
+      break;
+
+    // `%_f` or `%*_f` outputs a float with optionan number of decimals passed as first argument if `*` is present
+    // positive number of decimals means an exact number of decimals, can be `0` terminate
+    // negative number of decimals will suppress
+    // Ex:
+    //    char c[128];
+    //    float f = 3.141f;
+    //    ext_vsnprintf_P(c; szeof(c), "%_f %*_f %*_f", &f, 4, 1f, -4, %f);
+    //    --> c will be "3.14 3.1410 3.141"
+    // Note: float MUST be passed by address, because C alsays promoted float to double when in vararg
+    case 'f':     // input is `float`, printed to float with 2 decimals
+      {
+        if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
+        else {
+          bool truncate = false;
+          if (decimals < 0) {
+            decimals = -decimals;
+            truncate = true;
+          }
+          float number = *(float*)cur_val;
+          if (isnan(number) || isinf(number)) {
+            new_val_str = "null";
+          } else {
+            uint32_t len = (decimals) ? decimals +2 : 1;
+            dtostrf(*(float*)cur_val, len, decimals, ext_hex);
+
+            if (truncate) {
+              uint32_t last = strlen(ext_hex) - 1;
+              // remove trailing zeros
+              while (ext_hex[last] == '0') {
+                ext_hex[last--] = 0;              // remove last char
+              }
+              // remove trailing dot
+              if (ext_hex[last] == '.') {
+                ext_hex[last] = 0;
+              }
+            }
+            new_val_str = copyStr(ext_hex);
+            if (new_val_str == nullptr) { return nullptr; }
+            ext_allocs[alloc_idx++] = new_val_str;
+          }
+        }
+      }
+      break;
+
+    // '%_X' outputs a 64 bits unsigned int to uppercase HEX with 16 digits
+    case 'X':     // input is `uint64_t*`, printed as 16 hex digits (no prefix 0x)
+      {
+        if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
+        else {
+          if ((decimals < 0) || (decimals > 16)) { decimals = 16; }
+          U64toHex(*(uint64_t*)cur_val, ext_hex, decimals);
+          new_val_str = copyStr(ext_hex);
+          if (new_val_str == nullptr) { return nullptr; }
+          ext_allocs[alloc_idx++] = new_val_str;
+        }
+      }
+      break;
+
+    // '%_U' outputs a 64 bits unsigned int to decimal
+    case 'U':     // input is `uint64_t*`, printed as decimal
+      {
+        if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
+        else {
+          U64toStr(*(uint64_t*)cur_val, ext_hex);
+          new_val_str = copyStr(ext_hex);
+          if (new_val_str == nullptr) { return nullptr; }
+          ext_allocs[alloc_idx++] = new_val_str;
+        }
+      }
+      break;
+
+  }
+  return new_val_str;
+}
+
+// Execute a compiled format program: patch the arguments in place following the op list,
+// then hand the pre-rewritten format to vsnprintf. No format parsing, no format copy.
+static int32_t ExtFmtExecute(const ExtFmtProgram * prog, char * out_buf, size_t buf_len, va_list va) {
+  va_list va_cpy;
+  va_copy(va_cpy, va);
+
+  int32_t ret = 0;
+  bool aborted = true;
+  uint32_t alloc_idx = 0;
+
+  for (uint32_t i = 0; i < prog->count; i++) {
+    const ExtFmtOp & op = prog->ops[i];
+    int32_t decimals = op.decimals;
+    if (op.star) {
+      decimals = va_arg(va, int32_t);
+      int32_t * decimals_ptr = va_cur_ptr4(va, int32_t);
+      if (op.ext) { *decimals_ptr = 0; }    // the patched format holds `%-*s` for this op
+    }
+    uint32_t cur_val = va_arg(va, uint32_t);
+    if (0 == op.ext) { continue; }          // plain argument, left unchanged
+    const char ** cur_val_ptr = va_cur_ptr4(va, const char*);
+    const char * new_val_str = "";
+    if (alloc_idx < EXT_ALLOC_SIZE) {       // out of temp slots: patch to empty string, format stays consistent
+      new_val_str = ExtFormatArg(op.ext, decimals, cur_val, alloc_idx);
+      if (new_val_str == nullptr) { goto free_allocs; }
+    }
+    *cur_val_ptr = new_val_str;
+  }
+
+  if (out_buf != nullptr) {
+    ret = vsnprintf_P(out_buf, buf_len, prog->fmt_patched, va_cpy);
+    aborted = false;
+  } else {
+    // if there is no output buffer, we allocate one on the heap
+    // first we do a dry-run to know the target size
+    char dummy[2];
+    int32_t target_len = vsnprintf_P(dummy, 1, prog->fmt_patched, va_cpy);
+    if (target_len >= 0) {
+      char * allocated_buf = (char*) malloc(target_len + 1);
+      if (allocated_buf != nullptr) {
+        allocated_buf[0] = 0;
+        vsnprintf_P(allocated_buf, target_len + 1, prog->fmt_patched, va_cpy);
+        ret = (int32_t) allocated_buf;
+        aborted = false;
+      }
+    }
+  }
+
+  va_end(va_cpy);
+
+free_allocs:
+  if (aborted && out_buf != nullptr) {
+    *out_buf = '\0';
+  }
+  for (uint32_t i = 0; i < alloc_idx; i++) {
+    free((void*)ext_allocs[i]);
+    ext_allocs[i] = nullptr;
+  }
+  return ret;
+}
+
 int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_list va) {
+  // fast path: this format was already compiled into a program, execute it directly
+  ExtFmtProgram * prog = ExtFmtLookup(fmt_P);
+  if (prog != nullptr) {
+    return ExtFmtExecute(prog, out_buf, buf_len, va);
+  }
+
   va_list va_cpy;
   va_copy(va_cpy, va);
 
@@ -268,15 +539,18 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
   int32_t ret = 0;    // return 0 if unsuccessful
   bool aborted = true;   // did something went wrong?
 
-  const uint32_t ALLOC_SIZE = 12;
-  static const char * allocs[ALLOC_SIZE] = {};     // initialized to zeroes
   uint32_t alloc_idx = 0;
-  static char hex[34];          // buffer used for 64 bits, favor RAM instead of stack to remove pressure
+
+  ExtFmtOp ops[EXT_PRINTF_MAX_OPS];       // program recorded while parsing
+  uint32_t op_count = 0;
+  bool cacheable = ExtFmtInFlash(fmt_P);  // RAM format addresses can be reused, don't cache them
 
 	for (; *fmt != 0; ++fmt) {
     int32_t decimals = -2;      // default to 2 decimals and remove trailing zeros
     int32_t * decimals_ptr = nullptr;
-    if (alloc_idx >= ALLOC_SIZE) { break; }     // buffer is full, don't continue parsing
+    int16_t decimals_parsed = -2;         // compile-time decimals recorded in the op
+    bool star = false;
+    if (alloc_idx >= EXT_ALLOC_SIZE) { break; }     // buffer is full, don't continue parsing
     if (*fmt == '%') {
       fmt++;
       char * fmt_start = fmt;
@@ -285,17 +559,20 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
 			if (*fmt == '*') {
 				decimals = va_arg(va, int32_t);   // skip width argument as int
         decimals_ptr = va_cur_ptr4(va, int32_t);    // pointer to value on stack
+        star = true;
         fmt++;
         // Serial.printf("> decimals=%d, decimals_ptr=0x%08X\n", decimals, decimals_ptr);
 			}
       if (*fmt < 'A') {
         decimals = strtol(fmt, nullptr, 10);
+        if (!star) { decimals_parsed = decimals; }
       }
       while (*fmt < 'A') {    // brutal way to munch anything that is not a letter or '-' (or anything else)
       // while ((*fmt >= '0' && *fmt <= '9') || (*fmt == '.') || (*fmt == '*') || (*fmt == '-' || (*fmt == ' ' || (*fmt == '+') || (*fmt == '#')))) {
         fmt++;
 			}
 
+      char ext = 0;
       if (*fmt == '_') {      // extension
         if (decimals_ptr) {
           // Serial.printf(">2 decimals=%d, decimals_ptr=0x%08X\n", decimals, decimals_ptr);
@@ -306,163 +583,12 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
         for (; fmt_start <= fmt; fmt_start++) {
           *fmt_start = '0';
         }
-        // *fmt = '0';
         fmt++;
+        ext = *fmt;
         uint32_t cur_val = va_arg(va, uint32_t);              // current value
         const char ** cur_val_ptr = va_cur_ptr4(va, const char*);    // pointer to value on stack
-        const char * new_val_str = "";
-        switch (*fmt) {
-          case 'H':     // Hex, decimals indicates the length, default 2
-            {
-              if (decimals < 0) { decimals = 0; }
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else if (decimals > 0) {
-                char * hex_char = (char*) malloc(decimals*2 + 2);
-                if (hex_char == nullptr) { goto free_allocs; }
-                ToHex_P((const uint8_t *)cur_val, decimals, hex_char, decimals*2 + 2);
-                new_val_str = hex_char;
-                allocs[alloc_idx++] = new_val_str;
-                // Serial.printf("> hex=%s\n", hex_char);
-              }
-            }
-            break;
-
-          case 'B':     // Pointer to SBuffer
-            {
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else {
-                const SBuffer & buf = *(const SBuffer*)cur_val;
-                size_t buf_len = (&buf != nullptr) ? buf.len() : 0;
-                if (buf_len) {
-                  char * hex_char = (char*) malloc(buf_len*2 + 2);
-                  if (hex_char == nullptr) { goto free_allocs; }
-                  ToHex_P(buf.getBuffer(), buf_len, hex_char, buf_len*2 + 2);
-                  new_val_str = hex_char;
-                  allocs[alloc_idx++] = new_val_str;
-                }
-              }
-            }
-            break;
-
-          // '%_b' outputs a uint32_t to binary
-          // '%8_b' outputs a uint8_t to binary
-          case 'b':     // Binary, decimals indicates the zero prefill
-            {
-                ToBinary(cur_val, hex, decimals);
-                new_val_str = copyStr(hex);
-                if (new_val_str == nullptr) { goto free_allocs; }
-                allocs[alloc_idx++] = new_val_str;
-              }
-            break;
-/*
-          case 'V':     // 2-byte values, decimals indicates the length, default 2
-            {
-              if (decimals < 0) { decimals = 0; }
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else if (decimals > 0) {
-                uint32_t val_size = decimals*6 + 2;
-                char * val_char = (char*) malloc(val_size);
-                if (val_char == nullptr) { goto free_allocs; }
-                val_char[0] = '\0';
-                for (uint32_t count = 0; count < decimals; count++) {
-                  uint32_t value = pgm_read_byte((const uint8_t *)cur_val +1) << 8 | pgm_read_byte((const uint8_t *)cur_val);
-                  snprintf_P(val_char, val_size, PSTR("%s%s%d"), val_char, (count)?",":"", value);
-                  cur_val += 2;
-                }
-                new_val_str = val_char;
-                allocs[alloc_idx++] = new_val_str;
-                // Serial.printf("> values=%s\n", hex_char);
-              }
-            }
-            break;
-*/
-          // case 'D':
-          //   decimals = *(int32_t*)cur_val_ptr;
-          //   break;
-
-          // `%_I` ouputs an IPv4 32 bits address passed as u32 into a decimal dotted format
-          case 'I':     // Input is `uint32_t` 32 bits IP address, output is decimal dotted address
-            {
-              char * ip_str = (char*) malloc(16);
-              if (ip_str == nullptr) { goto free_allocs; }
-              snprintf_P(ip_str, 16, PSTR("%u.%u.%u.%u"), cur_val & 0xFF, (cur_val >> 8) & 0xFF, (cur_val >> 16) & 0xFF, (cur_val >> 24) & 0xFF);
-              new_val_str = ip_str;
-              allocs[alloc_idx++] = new_val_str;
-            }
-            break;
-
-          // `%_f` or `%*_f` outputs a float with optionan number of decimals passed as first argument if `*` is present
-          // positive number of decimals means an exact number of decimals, can be `0` terminate
-          // negative number of decimals will suppress
-          // Ex:
-          //    char c[128];
-          //    float f = 3.141f;
-          //    ext_vsnprintf_P(c; szeof(c), "%_f %*_f %*_f", &f, 4, 1f, -4, %f);
-          //    --> c will be "3.14 3.1410 3.141"
-          // Note: float MUST be passed by address, because C alsays promoted float to double when in vararg
-          case 'f':     // input is `float`, printed to float with 2 decimals
-            {
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else {
-                bool truncate = false;
-                if (decimals < 0) {
-                  decimals = -decimals;
-                  truncate = true;
-                }
-                float number = *(float*)cur_val;
-                if (isnan(number) || isinf(number)) {
-                  new_val_str = "null";
-                } else {
-                  uint32_t len = (decimals) ? decimals +2 : 1;
-                  dtostrf(*(float*)cur_val, len, decimals, hex);
-
-                  if (truncate) {
-                    uint32_t last = strlen(hex) - 1;
-                    // remove trailing zeros
-                    while (hex[last] == '0') {
-                      hex[last--] = 0;              // remove last char
-                    }
-                    // remove trailing dot
-                    if (hex[last] == '.') {
-                      hex[last] = 0;
-                    }
-                  }
-                  new_val_str = copyStr(hex);
-                  if (new_val_str == nullptr) { goto free_allocs; }
-                  allocs[alloc_idx++] = new_val_str;
-                }
-              }
-            }
-            break;
-
-          // '%_X' outputs a 64 bits unsigned int to uppercase HEX with 16 digits
-          case 'X':     // input is `uint64_t*`, printed as 16 hex digits (no prefix 0x)
-            {
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else {
-                if ((decimals < 0) || (decimals > 16)) { decimals = 16; }
-                U64toHex(*(uint64_t*)cur_val, hex, decimals);
-                new_val_str = copyStr(hex);
-                if (new_val_str == nullptr) { goto free_allocs; }
-                allocs[alloc_idx++] = new_val_str;
-              }
-            }
-            break;
-
-          // '%_U' outputs a 64 bits unsigned int to decimal
-          case 'U':     // input is `uint64_t*`, printed as decimal
-            {
-              if (cur_val < min_valid_ptr) { new_val_str = ext_invalid_mem; }
-              else {
-                U64toStr(*(uint64_t*)cur_val, hex);
-                new_val_str = copyStr(hex);
-                if (new_val_str == nullptr) { goto free_allocs; }
-                allocs[alloc_idx++] = new_val_str;
-              }
-            }
-            break;
-
-        }
+        const char * new_val_str = ExtFormatArg(ext, decimals, cur_val, alloc_idx);
+        if (new_val_str == nullptr) { goto free_allocs; }
         *cur_val_ptr = new_val_str;
         *fmt = 's';     // replace `%_X` with `%0s` to display a string instead
 
@@ -470,6 +596,14 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
         va_arg(va, int32_t);      // munch one 32 bits argument and leave it unchanged
         // we take the hypothesis here that passing 64 bits arguments is always unsupported in ESP8266
       }
+      if (op_count < EXT_PRINTF_MAX_OPS) {    // record the op for the compiled program
+        ops[op_count].ext = ext;
+        ops[op_count].star = star;
+        ops[op_count].decimals = decimals_parsed;
+        op_count++;
+      } else {
+        cacheable = false;        // too many conversion specs, fall back to parsing every call
+      }
     }
   }
   // Serial.printf("> format_final=%s\n", fmt_cpy); Serial.flush();
@@ -495,6 +629,11 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
 
   va_end(va_cpy);
 
+  if (!aborted && cacheable) {
+    ExtFmtInstall(fmt_P, fmt_cpy, ops, op_count);   // the cache takes ownership of fmt_cpy
+    fmt_cpy = nullptr;
+  }
+
 free_allocs:
   if (aborted && out_buf != nullptr) {    // if something went wrong, set output string to empty string to avoid corrupt data
     *out_buf = '\0';
@@ -502,8 +641,8 @@ free_allocs:
 
   // disallocated all temporary strings
   for (uint32_t i = 0; i < alloc_idx; i++) {
-    free((void*)allocs[i]);      // it is ok to call free() on nullptr so we don't test for nullptr first
-    allocs[i] = nullptr;
+    free((void*)ext_allocs[i]);  // it is ok to call free() on nullptr so we don't test for nullptr first
+    ext_allocs[i] = nullptr;
   }
   free(fmt_cpy);          // free the local copy of the format string
   return ret;
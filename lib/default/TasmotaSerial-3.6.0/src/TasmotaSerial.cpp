@@ -185,6 +185,49 @@ void TasmotaSerial::Esp32Begin(void) {
     // At 76800 the timeout is ~1ms
     uart_set_rx_timeout(m_uart, 6);
   }
+  // User-set thresholds override the speed-based defaults above
+  if (m_rx_full_threshold) {
+    uart_set_rx_full_threshold(m_uart, m_rx_full_threshold);
+  }
+  if (m_rx_timeout_chars) {
+    uart_set_rx_timeout(m_uart, m_rx_timeout_chars);
+  }
+  // Re-register the RX event callback - begin() may be called again for a
+  // baudrate or config change
+  if (m_rx_event_cb) {
+    TSerial->onReceive(m_rx_event_cb, m_rx_event_timeout_only);
+  }
+  // Re-apply hardware flow control for the same reason
+  if ((m_rts_pin >= 0) || (m_cts_pin >= 0)) {
+    applyHwFlowCtrl();
+  }
+}
+
+void TasmotaSerial::applyHwFlowCtrl(void) {
+  if ((m_rts_pin < 0) && (m_cts_pin < 0)) {
+    uart_set_hw_flow_ctrl(m_uart, UART_HW_FLOWCTRL_DISABLE, 0);
+    return;
+  }
+  uart_set_pin(m_uart, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE,
+               (m_rts_pin >= 0) ? m_rts_pin : UART_PIN_NO_CHANGE,
+               (m_cts_pin >= 0) ? m_cts_pin : UART_PIN_NO_CHANGE);
+  uart_hw_flowcontrol_t mode;
+  if (m_rts_pin >= 0) {
+    mode = (m_cts_pin >= 0) ? UART_HW_FLOWCTRL_CTS_RTS : UART_HW_FLOWCTRL_RTS;
+  } else {
+    mode = UART_HW_FLOWCTRL_CTS;
+  }
+  // Assert RTS when the 128 byte hardware FIFO is nearly full
+  uart_set_hw_flow_ctrl(m_uart, mode, 100);
+}
+
+bool TasmotaSerial::setHwFlowCtrl(int rts_pin, int cts_pin) {
+  m_rts_pin = rts_pin;
+  m_cts_pin = cts_pin;
+  if (TSerial) {
+    applyHwFlowCtrl();
+  }
+  return m_hardserial;
 }
 #endif
 
@@ -513,6 +556,34 @@ int32_t TasmotaSerial::setConfig(uint32_t config) {
   m_config = config;
   return 0;   // no error
 }
+
+// Event-driven RX mode.  The IDF uart driver feeds its ring buffer from the
+// interrupt handler; the callback is invoked from the UART event task when the
+// RX full threshold is reached, or on a line-idle timeout (end of a frame), so
+// consumers at high baudrates can drain the ring as it fills instead of
+// depending on the cadence of their driver loop.
+// With only_on_timeout true the callback fires only on line-idle, i.e. once
+// per received frame.
+void TasmotaSerial::onRxEvent(OnReceiveCb callback, bool only_on_timeout) {
+  m_rx_event_cb = callback;
+  m_rx_event_timeout_only = only_on_timeout;
+  if (TSerial) {
+    TSerial->onReceive(callback, only_on_timeout);
+  }
+}
+
+// Override the RX full threshold (bytes) and line-idle timeout (symbol times)
+// chosen by begin() from the baudrate.  A value of 0 keeps the current
+// setting.  Returns false if the uart driver rejects a value.
+bool TasmotaSerial::setRxEventThresholds(uint32_t fifo_full_bytes, uint32_t timeout_chars) {
+  m_rx_full_threshold = fifo_full_bytes;
+  m_rx_timeout_chars = timeout_chars;
+  if (TSerial) {
+    if (fifo_full_bytes && (ESP_OK != uart_set_rx_full_threshold(m_uart, fifo_full_bytes))) { return false; }
+    if (timeout_chars && (ESP_OK != uart_set_rx_timeout(m_uart, timeout_chars))) { return false; }
+  }
+  return true;
+}
 #endif
 
 #ifdef ESP8266
@@ -73,6 +73,20 @@ class TasmotaSerial : public Stream {
     uint32_t getUart(void) const { return m_uart; }
     HardwareSerial *getesp32hws(void) { return TSerial; }
     int32_t setConfig(uint32_t config);
+    // Event-driven RX: the IDF uart event task calls back when the RX full
+    // threshold or a line-idle timeout fires, so high-baud consumers can drain
+    // the ring as it fills instead of waiting for the next driver poll.
+    // Combine with setRxBufferSize() for a large interrupt-fed ring.
+    // The callback runs in the UART event task, NOT the main loop.
+    void onRxEvent(OnReceiveCb callback, bool only_on_timeout = false);
+    // Override the speed-based RX full threshold (bytes) and line-idle
+    // timeout (symbol times) chosen by begin().  0 keeps the default.
+    bool setRxEventThresholds(uint32_t fifo_full_bytes, uint32_t timeout_chars);
+    // Enable RTS/CTS hardware flow control on the given pins (-1 = unused,
+    // both -1 disables).  RTS is asserted by the UART when the hardware FIFO
+    // nears full so a peer stops sending instead of data being dropped.
+    // Survives a begin() re-run for a baudrate or config change.
+    bool setHwFlowCtrl(int rts_pin, int cts_pin);
 #endif
     bool isValid(void) { return m_valid; }
     bool overflow(void);
@@ -86,6 +100,7 @@ class TasmotaSerial : public Stream {
 #ifdef ESP32
     bool freeUart(void);
     void Esp32Begin(void);
+    void applyHwFlowCtrl(void);
 #endif
 
     // Member variables
@@ -117,6 +132,12 @@ class TasmotaSerial : public Stream {
     uint32_t m_config;
     HardwareSerial *TSerial;
     uart_port_t m_uart = uart_port_t(0);
+    OnReceiveCb m_rx_event_cb = nullptr;
+    bool m_rx_event_timeout_only = false;
+    uint16_t m_rx_full_threshold = 0;    // 0 = speed-based default from begin()
+    uint8_t m_rx_timeout_chars = 0;      // 0 = speed-based default from begin()
+    int m_rts_pin = -1;                  // Hardware flow control, -1 = unused
+    int m_cts_pin = -1;                  // Hardware flow control, -1 = unused
 #endif
 
 };
@@ -87,6 +87,8 @@ public:
     , _udp_packets(0)
     , _udp_ready(false)
     , _udp_index(0)
+    , _udp_depth_max(0)
+    , _udp_drops(0)
     {
         _packet_number = packet_number;
         _buffers = new UdpPacket<PACKET_SIZE>[_packet_number];
@@ -105,8 +107,16 @@ public:
     {
         _udp_packets = 0;
         _udp_index = 0;
+        _udp_depth_max = 0;
+        _udp_drops = 0;
     }
 
+    // Monitoring. The ring is fed from the lwIP receive callback, so packets
+    // dropped when all slots are taken are otherwise invisible to the consumer.
+    uint8_t depth(void) const { return _udp_packets; }          // packets currently queued
+    uint8_t depthMax(void) const { return _udp_depth_max; }     // high-water mark since reset()
+    uint32_t drops(void) const { return _udp_drops; }           // packets dropped since reset()
+
     bool listen(const IPAddress& addr, uint16_t port)
     {
         if (!_buffers) { return false; }
@@ -159,6 +169,7 @@ private:
         // Serial.printf(">>> _recv: _udp_packets = %d, _udp_index = %d, tot_len = %d\n", _udp_packets, _udp_index, pb->tot_len);
         if (_udp_packets >= _packet_number) {
             // we don't have slots anymore, drop packet
+            _udp_drops++;
             pbuf_free(pb);
             return;
         }
@@ -181,6 +192,9 @@ private:
             _buffers[next_slot].srcport = srcport;
             _buffers[next_slot].input_netif = ip_current_input_netif();
             _udp_packets++;            // we have one packet ready
+            if (_udp_packets > _udp_depth_max) {
+                _udp_depth_max = _udp_packets;
+            }
         }
         pbuf_free(pb);      // free memory immediately
     }
@@ -203,6 +217,8 @@ private:
     bool    _udp_ready;          // is a packet currenlty consumed after a call to next()
     // ring buffer ranges from 0..(_packet_number-1)
     int8_t  _udp_index;                 // current index in the ring buffer
+    int8_t  _udp_depth_max;             // most packets ever queued at once
+    uint32_t _udp_drops;                // packets dropped because the ring was full
 };
 
 #endif // ESP8266
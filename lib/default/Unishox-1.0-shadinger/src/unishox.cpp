@@ -102,6 +102,22 @@ static char us_hcode[32] PROGMEM =
 //                24, 25, 26, 27, 28, 29, 30, 31
                    0, 0,  0,  0,  0,  0,  0,  5 + (6 << 3)};
 
+// Priming profile assembled from typical Tasmota rules and persisted telemetry JSON.
+// Tokens near the end get the shortest back-reference distances, so the most frequent
+// telemetry keys come last. Any change breaks previously compressed data using it.
+const char UNISHOX_PROFILE_TASMOTA[] PROGMEM =
+  "Backlog Publish stat/tele/cmnd/%topic%/RESULT IF THEN ELSE ENDIF BREAK "
+  "ON System#Boot DO ON Clock#Timer=1 DO ON Time#Minute=1 DO ON Button1#State DO ON Switch1#State=1 DO ENDON "
+  "RuleTimer1 Var1 Mem1 Add1 Sub1 Event Delay Scale "
+  "\"ApparentPower\":\"ReactivePower\":\"Factor\":\"TotalStartTime\":\"Yesterday\":\"Today\":\"Period\":"
+  "\"Voltage\":\"Current\":\"ENERGY\":{\"Total\":\"Power\":"
+  "\"DewPoint\":\"Pressure\":\"Humidity\":\"Temperature\":"
+  "\"Wifi\":{\"AP\":1,\"SSId\":\"RSSI\":\"Signal\":\"LinkCount\":\"Downtime\":"
+  "\"Uptime\":\"UptimeSec\":\"Heap\":\"Sleep\":\"LoadAvg\":\"MqttCount\":"
+  "Dimmer Color CT Scheme Fade Speed Channel HSBColor "
+  "{\"Time\":\"2024-01-01T12:00:00\",\"POWER1\":\"ON\",\"POWER\":\"OFF\",";
+const size_t UNISHOX_PROFILE_TASMOTA_LEN = sizeof(UNISHOX_PROFILE_TASMOTA) - 1;
+
 static const char ESCAPE_MARKER = 0x2A;   // Escape any null char
 
 static const uint16_t TERM_CODE = 0x37C0; // 0b0011011111000000
@@ -204,13 +220,21 @@ void Unishox::encodeCount(int32_t count) {
   return;
 }
 
+// Read from the virtual stream: priming profile (may be PROGMEM) followed by input
+char Unishox::charAt(int32_t i) {
+  if (i < (int32_t)prime_len) {
+    return (char)pgm_read_byte(&prime[i]);
+  }
+  return in[i - prime_len];
+}
+
 bool Unishox::matchOccurance(void) {
   int32_t j, k;
   uint32_t longest_dist = 0;
   uint32_t longest_len = 0;
   for (j = l - NICE_LEN; j >= 0; j--) {
     for (k = l; k < len && j + k - l < l; k++) {
-      if (in[k] != in[j + k - l])
+      if (charAt(k) != charAt(j + k - l))
         break;
     }
     if (k - l > NICE_LEN - 1) {
@@ -247,8 +271,15 @@ bool Unishox::matchOccurance(void) {
 //   - if >= 0: size of the compressed buffer. The output buffer does not contain NULL bytes, and it is not NULL terminated
 //   - if < 0: an error occured, most certainly the output buffer was not large enough
 int32_t Unishox::unishox_compress(const char *p_in, size_t p_len, char *p_out, size_t p_len_out) {
+  return unishox_compress(p_in, p_len, p_out, p_len_out, nullptr, 0);
+}
+
+int32_t Unishox::unishox_compress(const char *p_in, size_t p_len, char *p_out, size_t p_len_out,
+                                  const char *p_profile, size_t p_profile_len) {
+  prime = p_profile;
+  prime_len = (p_profile) ? p_profile_len : 0;
   in = p_in;
-  len = p_len;
+  len = p_len + prime_len;    // virtual stream is profile followed by input
   out = p_out;
   len_out = p_len_out;
 
@@ -261,14 +292,14 @@ int32_t Unishox::unishox_compress(const char *p_in, size_t p_len, char *p_out, s
   ol = 0;
   state = SHX_STATE_1;
   is_all_upper = 0;
-  for (l=0; l<len; l++) {
+  for (l=prime_len; l<len; l++) {
 
-    c_in = in[l];
+    c_in = charAt(l);
 
     if (l && l < len - 4) {
-      if (c_in == in[l - 1] && c_in == in[l + 1] && c_in == in[l + 2] && c_in == in[l + 3]) {   // check for repeat
+      if (c_in == charAt(l - 1) && c_in == charAt(l + 1) && c_in == charAt(l + 2) && c_in == charAt(l + 3)) {   // check for repeat
         int rpt_count = l + 4;
-        while (rpt_count < len && in[rpt_count] == c_in)
+        while (rpt_count < len && charAt(rpt_count) == c_in)
           rpt_count++;
         rpt_count -= l;
         
@@ -312,12 +343,13 @@ int32_t Unishox::unishox_compress(const char *p_in, size_t p_len, char *p_out, s
 
     c_next = 0;
     if (l+1 < len)
-      c_next = in[l+1];
+      c_next = charAt(l+1);
 
     if (c_in >= 32 && c_in <= 126) {
       if (is_upper && !is_all_upper) {
         for (ll=l+5; ll>=l && ll<len; ll--) {
-          if (in[ll] < 'A' || in[ll] > 'Z')
+          char c_ll = charAt(ll);
+          if (c_ll < 'A' || c_ll > 'Z')
             break;
         }
         if (ll == l-1) {
@@ -451,6 +483,13 @@ void Unishox::decodeRepeat(void) {
 }
 
 int32_t Unishox::unishox_decompress(const char *p_in, size_t p_len, char *p_out, size_t p_len_out) {
+  return unishox_decompress(p_in, p_len, p_out, p_len_out, nullptr, 0);
+}
+
+int32_t Unishox::unishox_decompress(const char *p_in, size_t p_len, char *p_out, size_t p_len_out,
+                                    const char *p_profile, size_t p_profile_len) {
+  prime = p_profile;
+  prime_len = (p_profile) ? p_profile_len : 0;
   in = p_in;
   len = p_len;
   out = p_out;
@@ -463,6 +502,18 @@ int32_t Unishox::unishox_decompress(const char *p_in, size_t p_len, char *p_out,
   dstate = SHX_SET1;
   is_all_upper = 0;
 
+  if (prime_len) {
+    // seed the output with the profile so back-references can reach it,
+    // it is moved out again before returning
+    if (prime_len >= len_out) {
+      return -1;
+    }
+    if (out) {
+      memcpy_P(out, prime, prime_len);
+    }
+    ol = prime_len;
+  }
+
   if (out) out[ol] = 0;
   // while ((byte_no << 3) + bit_no - 8 < len) {
   while (!in_eof) {
@@ -567,7 +618,12 @@ int32_t Unishox::unishox_decompress(const char *p_in, size_t p_len, char *p_out,
 
   if (out && ol > len_out) {
     return -1;    // overflow
-  } else {
-    return ol;
   }
+  if (prime_len) {
+    if (out) {
+      memmove(out, out + prime_len, ol - prime_len);   // strip the profile scratch prefix
+    }
+    return ol - prime_len;
+  }
+  return ol;
 }
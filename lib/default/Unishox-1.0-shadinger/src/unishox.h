@@ -19,6 +19,11 @@
 #ifndef unishox
 #define unishox
 
+// Priming profile assembled from typical Tasmota rules and persisted telemetry JSON.
+// The most frequent tokens sit at the end so they get the shortest back-reference distances.
+extern const char UNISHOX_PROFILE_TASMOTA[];
+extern const size_t UNISHOX_PROFILE_TASMOTA_LEN;
+
 class Unishox {
 
 public:
@@ -27,6 +32,17 @@ public:
   int32_t unishox_decompress(const char *in, size_t len, char *out, size_t len_out);
   int32_t unishox_compress(const char *in, size_t len, char *out, size_t len_out);
 
+  // Same as above with a priming profile (preset dictionary). The profile text is
+  // virtually prepended to the input so back-references can hit it from the first
+  // byte; compressor and decompressor must use the same profile. The decompress
+  // output buffer needs room for profile_len extra bytes used as scratch.
+  // The profile may live in PROGMEM. Output format is NOT compatible with the
+  // profile-less calls.
+  int32_t unishox_decompress(const char *in, size_t len, char *out, size_t len_out,
+                             const char *profile, size_t profile_len);
+  int32_t unishox_compress(const char *in, size_t len, char *out, size_t len_out,
+                           const char *profile, size_t profile_len);
+
 private:
 
   void append_bits(unsigned int code, int clen);
@@ -40,6 +56,10 @@ private:
   int32_t getNumFromBits(uint32_t count);
 
   inline void writeOut(char c) { out[ol++] = c; }
+  char charAt(int32_t i);    // read from priming profile or input at virtual index
+
+  const char *  prime;    // priming profile (may be PROGMEM), nullptr if none
+  size_t        prime_len;
 
   int32_t l;
   uint32_t ol;
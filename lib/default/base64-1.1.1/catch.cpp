@@ -462,4 +462,90 @@ TEST_CASE("decode_base64()", "[]") {
     decode_base64((unsigned char*) "AA==4n8fzhNL", actual_binary);
     REQUIRE(memcmp(actual_binary, expected_binary_6, 1) == 0);
   }
-}
\ No newline at end of file
+}
+TEST_CASE("encode_base64 streaming", "[]") {
+  unsigned char actual_base64[100];
+  unsigned char expected_base64[100];
+  unsigned char binary[] = {220, 92, 67, 95, 157, 76, 162, 210, 224, 202, 136, 157, 104, 178, 103, 81, 35, 103, 244, 71, 92, 25, 69, 64, 61, 232, 198, 108, 217, 106, 63, 103, 234, 39, 156, 108, 4, 101, 212, 198, 57, 223, 75, 132, 160, 26, 193, 139, 16, 89, 12, 45, 183, 133, 33};
+  base64_encode_state state;
+
+  SECTION("Empty stream") {
+    encode_base64_init(&state);
+    REQUIRE(encode_base64_final(&state, actual_base64) == 0);
+    REQUIRE(memcmp(actual_base64, "", 1) == 0);
+  }
+
+  SECTION("Matches one-shot encoding for every chunk size and input length") {
+    for(unsigned int length = 0; length <= sizeof(binary); ++length) {
+      encode_base64(binary, length, expected_base64);
+
+      for(unsigned int chunk = 1; chunk <= 7; ++chunk) {
+        encode_base64_init(&state);
+
+        unsigned int actual_length = 0;
+        for(unsigned int pos = 0; pos < length; pos += chunk) {
+          unsigned int take = length - pos < chunk ? length - pos : chunk;
+          actual_length += encode_base64_update(&state, binary + pos, take, actual_base64 + actual_length);
+        }
+        actual_length += encode_base64_final(&state, actual_base64 + actual_length);
+
+        REQUIRE(actual_length == encode_base64_length(length));
+        REQUIRE(memcmp(actual_base64, expected_base64, actual_length + 1) == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("decode_base64 streaming", "[]") {
+  unsigned char actual_binary[100];
+  unsigned char expected_binary[100];
+  unsigned char base64[] = "3FxDX51MotLgyoidaLJnUSNn9EdcGUVAPejGbNlqP2fqJ5xsBGXUxjnfS4SgGsGLEFkMLbeFIQ==";
+  base64_decode_state state;
+
+  SECTION("Empty stream") {
+    decode_base64_init(&state);
+    REQUIRE(decode_base64_update(&state, (unsigned char*) "", 0, actual_binary) == 0);
+    REQUIRE(decode_base64_final(&state, actual_binary) == 0);
+  }
+
+  SECTION("Matches one-shot decoding for every chunk size") {
+    unsigned int expected_length = decode_base64(base64, expected_binary);
+    unsigned int input_length = sizeof(base64) - 1;
+
+    for(unsigned int chunk = 1; chunk <= 9; ++chunk) {
+      decode_base64_init(&state);
+
+      unsigned int actual_length = 0;
+      for(unsigned int pos = 0; pos < input_length; pos += chunk) {
+        unsigned int take = input_length - pos < chunk ? input_length - pos : chunk;
+        actual_length += decode_base64_update(&state, base64 + pos, take, actual_binary + actual_length);
+      }
+      actual_length += decode_base64_final(&state, actual_binary + actual_length);
+
+      REQUIRE(actual_length == expected_length);
+      REQUIRE(memcmp(actual_binary, expected_binary, actual_length) == 0);
+    }
+  }
+
+  SECTION("Can decode in place") {
+    unsigned char buffer[100];
+    memcpy(buffer, base64, sizeof(base64));
+    unsigned int expected_length = decode_base64(base64, expected_binary);
+
+    decode_base64_init(&state);
+    unsigned int actual_length = decode_base64_update(&state, buffer, sizeof(base64) - 1, buffer);
+    actual_length += decode_base64_final(&state, buffer + actual_length);
+
+    REQUIRE(actual_length == expected_length);
+    REQUIRE(memcmp(buffer, expected_binary, actual_length) == 0);
+  }
+
+  SECTION("Padding ends the stream") {
+    unsigned char expected_binary_0[] = {0};
+    decode_base64_init(&state);
+    unsigned int actual_length = decode_base64_update(&state, (unsigned char*) "AA==4n8fzhNL", 12, actual_binary);
+    actual_length += decode_base64_final(&state, actual_binary + actual_length);
+    REQUIRE(actual_length == 1);
+    REQUIRE(memcmp(actual_binary, expected_binary_0, 1) == 0);
+  }
+}
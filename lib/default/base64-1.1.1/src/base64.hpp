@@ -69,6 +69,88 @@ unsigned int encode_base64(unsigned char input[], unsigned int input_length, uns
  */
 unsigned int decode_base64(unsigned char input[], unsigned char output[]);
 
+/* Streaming interface
+ *
+ * Feed the input in chunks of any size and collect the output chunk by chunk,
+ * so en/decoding never needs the whole input and output in memory at once.
+ * The state holds at most two binary bytes (encode) or three base64
+ * characters (decode) between calls.
+ */
+
+typedef struct {
+  unsigned char carry[2];   // Binary bytes not yet forming a full 24-bit group
+  unsigned char carry_length;
+} base64_encode_state;
+
+typedef struct {
+  unsigned char carry[3];   // Base64 characters not yet forming a full quad
+  unsigned char carry_length;
+  unsigned char finished;   // Set when padding or an invalid character was seen
+} base64_decode_state;
+
+/* encode_base64_init / decode_base64_init:
+ *   Description:
+ *     Prepares a state for a new stream
+ *   Parameters:
+ *     state - State to initialize
+ */
+void encode_base64_init(base64_encode_state *state);
+void decode_base64_init(base64_decode_state *state);
+
+/* encode_base64_update:
+ *   Description:
+ *     Encodes the next input_length binary bytes of a stream. Emits only full
+ *     groups of four characters; up to two bytes are carried to the next call.
+ *     No null terminator is written
+ *   Parameters:
+ *     state - Stream state
+ *     input - Pointer to input data
+ *     input_length - Number of bytes to read from input pointer
+ *     output - Pointer to output buffer of at least (input_length + 2) / 3 * 4 bytes
+ *   Returns:
+ *     Number of base64 characters written
+ */
+unsigned int encode_base64_update(base64_encode_state *state, unsigned char input[], unsigned int input_length, unsigned char output[]);
+
+/* encode_base64_final:
+ *   Description:
+ *     Ends a stream, emitting the padded last group if any. Null terminator
+ *     will be added automatically
+ *   Parameters:
+ *     state - Stream state
+ *     output - Pointer to output buffer of at least 5 bytes
+ *   Returns:
+ *     Number of base64 characters written (not including null terminator)
+ */
+unsigned int encode_base64_final(base64_encode_state *state, unsigned char output[]);
+
+/* decode_base64_update:
+ *   Description:
+ *     Decodes the next input_length base64 characters of a stream. Emits only
+ *     full groups of three bytes; up to three characters are carried to the
+ *     next call. Padding or any invalid character ends the stream.
+ *     Can decode in place: the output never overtakes the input being read
+ *   Parameters:
+ *     state - Stream state
+ *     input - Pointer to input characters
+ *     input_length - Number of characters to read from input pointer
+ *     output - Pointer to output buffer of at least (input_length + 3) / 4 * 3 bytes
+ *   Returns:
+ *     Number of bytes written
+ */
+unsigned int decode_base64_update(base64_decode_state *state, unsigned char input[], unsigned int input_length, unsigned char output[]);
+
+/* decode_base64_final:
+ *   Description:
+ *     Ends a stream, decoding the one or two bytes of a carried partial group
+ *   Parameters:
+ *     state - Stream state
+ *     output - Pointer to output buffer of at least 2 bytes
+ *   Returns:
+ *     Number of bytes written
+ */
+unsigned int decode_base64_final(base64_decode_state *state, unsigned char output[]);
+
 unsigned char binary_to_base64(unsigned char v) {
   // Capital letters - 'A' is ascii 65 and base64 0
   if(v < 26) return v + 'A';
@@ -192,4 +274,125 @@ unsigned int decode_base64(unsigned char input[], unsigned char output[]) {
   return output_length;
 }
 
+void encode_base64_init(base64_encode_state *state) {
+  state->carry_length = 0;
+}
+
+void decode_base64_init(base64_decode_state *state) {
+  state->carry_length = 0;
+  state->finished = 0;
+}
+
+unsigned int encode_base64_update(base64_encode_state *state, unsigned char input[], unsigned int input_length, unsigned char output[]) {
+  unsigned int output_length = 0;
+  unsigned char group[3];
+
+  // Finish a group carried over from the previous call first
+  if(state->carry_length > 0) {
+    group[0] = state->carry[0];
+    group[1] = state->carry[1];
+
+    while(state->carry_length < 3 && input_length > 0) {
+      group[state->carry_length++] = *input++;
+      --input_length;
+    }
+
+    if(state->carry_length < 3) {
+      // Still not a full group, carry it to the next call
+      state->carry[0] = group[0];
+      state->carry[1] = group[1];
+      return 0;
+    }
+
+    output[0] = binary_to_base64(                         group[0] >> 2);
+    output[1] = binary_to_base64((group[0] & 0x03) << 4 | group[1] >> 4);
+    output[2] = binary_to_base64((group[1] & 0x0F) << 2 | group[2] >> 6);
+    output[3] = binary_to_base64( group[2] & 0x3F);
+
+    output += 4;
+    output_length = 4;
+    state->carry_length = 0;
+  }
+
+  // Whole groups straight from the input
+  while(input_length >= 3) {
+    output[0] = binary_to_base64(                         input[0] >> 2);
+    output[1] = binary_to_base64((input[0] & 0x03) << 4 | input[1] >> 4);
+    output[2] = binary_to_base64((input[1] & 0x0F) << 2 | input[2] >> 6);
+    output[3] = binary_to_base64( input[2] & 0x3F);
+
+    input += 3;
+    input_length -= 3;
+    output += 4;
+    output_length += 4;
+  }
+
+  // Keep the remainder for the next call
+  while(input_length > 0) {
+    state->carry[state->carry_length++] = *input++;
+    --input_length;
+  }
+
+  return output_length;
+}
+
+unsigned int encode_base64_final(base64_encode_state *state, unsigned char output[]) {
+  unsigned int output_length = encode_base64(state->carry, state->carry_length, output);
+
+  state->carry_length = 0;
+
+  return output_length;
+}
+
+unsigned int decode_base64_update(base64_decode_state *state, unsigned char input[], unsigned int input_length, unsigned char output[]) {
+  unsigned int output_length = 0;
+
+  while(input_length > 0 && !state->finished) {
+    unsigned char c = *input++;
+    --input_length;
+
+    if(base64_to_binary(c) >= 64) {
+      // Padding or an invalid character ends the stream
+      state->finished = 1;
+      break;
+    }
+
+    if(state->carry_length < 3) {
+      state->carry[state->carry_length++] = c;
+      continue;
+    }
+
+    // c completes a quad with the three carried characters
+    output[0] = base64_to_binary(state->carry[0]) << 2 | base64_to_binary(state->carry[1]) >> 4;
+    output[1] = base64_to_binary(state->carry[1]) << 4 | base64_to_binary(state->carry[2]) >> 2;
+    output[2] = base64_to_binary(state->carry[2]) << 6 | base64_to_binary(c);
+
+    output += 3;
+    output_length += 3;
+    state->carry_length = 0;
+  }
+
+  return output_length;
+}
+
+unsigned int decode_base64_final(base64_decode_state *state, unsigned char output[]) {
+  unsigned int output_length = 0;
+
+  switch(state->carry_length) {
+    case 2:
+      output[0] = base64_to_binary(state->carry[0]) << 2 | base64_to_binary(state->carry[1]) >> 4;
+      output_length = 1;
+      break;
+    case 3:
+      output[0] = base64_to_binary(state->carry[0]) << 2 | base64_to_binary(state->carry[1]) >> 4;
+      output[1] = base64_to_binary(state->carry[1]) << 4 | base64_to_binary(state->carry[2]) >> 2;
+      output_length = 2;
+      break;
+  }
+
+  state->carry_length = 0;
+
+  return output_length;
+}
+
 #endif // ifndef
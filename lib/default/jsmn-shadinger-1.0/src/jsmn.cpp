@@ -356,6 +356,149 @@ JSMN_API void jsmn_init(jsmn_parser *parser) {
   parser->toksuper = -1;
 }
 
+/*
+ * Streaming (SAX style) parser, see jsmn.h for the contract.
+ */
+
+enum {
+  JSMN_STREAM_IDLE = 0,     /* between tokens */
+  JSMN_STREAM_IN_STRING,
+  JSMN_STREAM_IN_ESCAPE,
+  JSMN_STREAM_IN_PRIMITIVE,
+};
+
+JSMN_API void jsmn_stream_init(jsmn_stream_parser *parser, jsmn_stream_cb cb, void *ctx) {
+  parser->cb = cb;
+  parser->ctx = ctx;
+  parser->containers = 0;
+  parser->got_key = 0;
+  parser->depth = 0;
+  parser->state = JSMN_STREAM_IDLE;
+  parser->value_len = 0;
+}
+
+static int jsmn_stream_emit(jsmn_stream_parser *parser, jsmn_stream_event_t event) {
+  parser->value[parser->value_len] = '\0';
+  int r = parser->cb(parser->ctx, event, parser->value, parser->value_len, parser->depth);
+  parser->value_len = 0;
+  parser->state = JSMN_STREAM_IDLE;
+  /* a completed value inside an object re-arms key detection */
+  if ((event != JSMN_STREAM_KEY) && parser->depth) {
+    parser->got_key &= ~(1U << (parser->depth - 1));
+  }
+  return r;
+}
+
+static int jsmn_stream_scalar_event(jsmn_stream_parser *parser, jsmn_stream_event_t event) {
+  /* a string directly inside an object with no key pending is the key itself */
+  if ((JSMN_STREAM_STRING == event) && parser->depth) {
+    uint32_t bit = 1U << (parser->depth - 1);
+    if ((parser->containers & bit) && !(parser->got_key & bit)) {
+      parser->got_key |= bit;
+      return JSMN_STREAM_KEY;
+    }
+  }
+  return event;
+}
+
+static int jsmn_stream_append(jsmn_stream_parser *parser, char c) {
+  if (parser->value_len >= JSMN_STREAM_VALUE_MAX - 1) {
+    return JSMN_ERROR_NOMEM;
+  }
+  parser->value[parser->value_len++] = c;
+  return 0;
+}
+
+JSMN_API int jsmn_stream_feed(jsmn_stream_parser *parser, const char *js, size_t len) {
+  int r;
+  for (size_t i = 0; i < len; i++) {
+    char c = js[i];
+
+    if (JSMN_STREAM_IN_ESCAPE == parser->state) {
+      if ((r = jsmn_stream_append(parser, c)) != 0) { return r; }
+      parser->state = JSMN_STREAM_IN_STRING;
+      continue;
+    }
+    if (JSMN_STREAM_IN_STRING == parser->state) {
+      if ('\"' == c) {
+        r = jsmn_stream_emit(parser, (jsmn_stream_event_t)jsmn_stream_scalar_event(parser, JSMN_STREAM_STRING));
+        if (r != 0) { return r; }
+      } else if ('\\' == c) {
+        if ((r = jsmn_stream_append(parser, c)) != 0) { return r; }
+        parser->state = JSMN_STREAM_IN_ESCAPE;
+      } else {
+        if ((r = jsmn_stream_append(parser, c)) != 0) { return r; }
+      }
+      continue;
+    }
+    if (JSMN_STREAM_IN_PRIMITIVE == parser->state) {
+      switch (c) {
+      case '\t': case '\r': case '\n': case ' ':
+      case ',': case ']': case '}':
+        if ((r = jsmn_stream_emit(parser, JSMN_STREAM_PRIMITIVE)) != 0) { return r; }
+        break;              /* delimiter handled below in idle state */
+      default:
+        if (c < 32 || c >= 127) { return JSMN_ERROR_INVAL; }
+        if ((r = jsmn_stream_append(parser, c)) != 0) { return r; }
+        continue;
+      }
+    }
+
+    /* idle - structural characters and token starts */
+    switch (c) {
+    case '{':
+    case '[':
+      if (parser->depth >= JSMN_STREAM_DEPTH_MAX) { return JSMN_ERROR_NOMEM; }
+      parser->depth++;
+      if ('{' == c) {
+        parser->containers |= 1U << (parser->depth - 1);
+      } else {
+        parser->containers &= ~(1U << (parser->depth - 1));
+      }
+      parser->got_key &= ~(1U << (parser->depth - 1));
+      r = parser->cb(parser->ctx, ('{' == c) ? JSMN_STREAM_OBJECT_START : JSMN_STREAM_ARRAY_START, NULL, 0, parser->depth);
+      if (r != 0) { return r; }
+      break;
+    case '}':
+    case ']':
+      if (0 == parser->depth) { return JSMN_ERROR_INVAL; }
+      if ((0 != (parser->containers & (1U << (parser->depth - 1)))) != ('}' == c)) {
+        return JSMN_ERROR_INVAL;       /* bracket does not match open container */
+      }
+      parser->depth--;
+      r = parser->cb(parser->ctx, ('}' == c) ? JSMN_STREAM_OBJECT_END : JSMN_STREAM_ARRAY_END, NULL, 0, parser->depth);
+      if (r != 0) { return r; }
+      if (parser->depth) {             /* the closed container was a value in its parent */
+        parser->got_key &= ~(1U << (parser->depth - 1));
+      }
+      break;
+    case '\"':
+      parser->state = JSMN_STREAM_IN_STRING;
+      break;
+    case '\t': case '\r': case '\n': case ' ':
+    case ':': case ',':
+      break;
+    default:
+      if (c < 32 || c >= 127) { return JSMN_ERROR_INVAL; }
+      parser->state = JSMN_STREAM_IN_PRIMITIVE;
+      if ((r = jsmn_stream_append(parser, c)) != 0) { return r; }
+      break;
+    }
+  }
+  return 0;
+}
+
+JSMN_API int jsmn_stream_end(jsmn_stream_parser *parser) {
+  int r;
+  if (JSMN_STREAM_IN_PRIMITIVE == parser->state) {   /* flush trailing top level primitive */
+    if ((r = jsmn_stream_emit(parser, JSMN_STREAM_PRIMITIVE)) != 0) { return r; }
+  }
+  if ((parser->state != JSMN_STREAM_IDLE) || (parser->depth != 0)) {
+    return JSMN_ERROR_PART;
+  }
+  return 0;
+}
+
 //
 // Json in-place string unescape
 // inpired from https://github.com/mjansson/json/blob/master/json.h
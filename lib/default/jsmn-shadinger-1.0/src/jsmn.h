@@ -109,10 +109,53 @@ JSMN_API int jsmn_parse(jsmn_parser *parser, const char *js, const size_t len,
                         jsmntok_t *tokens, const unsigned int num_tokens);
 
 /**
- * 
+ *
  * In-place json unescape
- * 
+ *
  */
 void json_unescape(char* string);
 
+/**
+ * Streaming (SAX style) parser: feed chunks of any size, receive one callback
+ * per token. Only the current scalar value is buffered, so documents larger
+ * than free contiguous heap can be parsed. String values are delivered raw
+ * (still escaped); run json_unescape() on the writable value if needed.
+ * Structural validation is lighter than jsmn_parse().
+ */
+typedef enum {
+  JSMN_STREAM_OBJECT_START = 0,
+  JSMN_STREAM_OBJECT_END,
+  JSMN_STREAM_ARRAY_START,
+  JSMN_STREAM_ARRAY_END,
+  JSMN_STREAM_KEY,        /* value = object key */
+  JSMN_STREAM_STRING,     /* value = string value */
+  JSMN_STREAM_PRIMITIVE,  /* value = number, boolean or null */
+} jsmn_stream_event_t;
+
+/* Return 0 to continue parsing, any other value aborts jsmn_stream_feed()
+ * and is passed through as its result. value is NUL terminated and writable
+ * for scalar events, NULL for containers. */
+typedef int (*jsmn_stream_cb)(void *ctx, jsmn_stream_event_t event,
+                              char *value, size_t len, uint32_t depth);
+
+#ifndef JSMN_STREAM_VALUE_MAX
+#define JSMN_STREAM_VALUE_MAX 256   /* longest single key or scalar value incl. NUL */
+#endif
+#define JSMN_STREAM_DEPTH_MAX  32   /* one bit per nesting level */
+
+typedef struct jsmn_stream_parser {
+  jsmn_stream_cb cb;
+  void *ctx;
+  uint32_t containers;  /* bitmask per level: 1 = object, 0 = array */
+  uint32_t got_key;     /* bitmask per level: key seen, value pending */
+  uint8_t depth;
+  uint8_t state;
+  uint16_t value_len;
+  char value[JSMN_STREAM_VALUE_MAX];
+} jsmn_stream_parser;
+
+JSMN_API void jsmn_stream_init(jsmn_stream_parser *parser, jsmn_stream_cb cb, void *ctx);
+JSMN_API int jsmn_stream_feed(jsmn_stream_parser *parser, const char *js, size_t len);
+JSMN_API int jsmn_stream_end(jsmn_stream_parser *parser);
+
 #endif /* JSMN_H */
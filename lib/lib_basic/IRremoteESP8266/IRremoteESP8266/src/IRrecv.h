@@ -133,6 +133,8 @@ class IRrecv {
   ~IRrecv(void);                                                  // Destructor
   void setTolerance(const uint8_t percent = kTolerance);
   uint8_t getTolerance(void);
+  void setProtocolMask(const uint8_t *mask);
+  bool protocolEnabled(const decode_type_t protocol);
   bool decode(decode_results *results, irparams_t *save = NULL,
               uint8_t max_skip = 0, uint16_t noise_floor = 0);
   void enableIRIn(const bool pullup = false);
@@ -164,6 +166,7 @@ class IRrecv {
 #endif
   irparams_t *irparams_save;
   uint8_t _tolerance;
+  const uint8_t *_protocol_mask;  // Caller-owned bitmap over decode_type_t
 #if defined(ESP32)
   uint8_t _timer_num;
 #endif  // defined(ESP32)
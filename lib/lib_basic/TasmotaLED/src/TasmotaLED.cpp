@@ -69,7 +69,10 @@ TasmotaLED::TasmotaLED(uint16_t type, uint16_t num_leds) :
   _raw_format(false),
   _pixel_count(num_leds),
   _buf_work(nullptr),
-  _buf_show(nullptr),
+  _buf_show{nullptr, nullptr},
+  _buf_show_act(0),
+  _show_pending(false),
+  _frames_dropped(0),
   _pusher(nullptr)
 {
   _adjustSubType();   // compute values for _pixel_order, _w_before, _pixel_matrix
@@ -91,8 +94,10 @@ TasmotaLED::TasmotaLED(uint16_t type, uint16_t num_leds) :
 
   _buf_work = new uint8_t[_pixel_count * _pixel_size];
   memset(_buf_work, 0, _pixel_count * _pixel_size);
-  _buf_show = new uint8_t[_pixel_count * _pixel_size];
-  memset(_buf_show, 0, _pixel_count * _pixel_size);
+  for (uint32_t i = 0; i < 2; i++) {
+    _buf_show[i] = new uint8_t[_pixel_count * _pixel_size];
+    memset(_buf_show[i], 0, _pixel_count * _pixel_size);
+  }
   // AddLog(LOG_LEVEL_DEBUG, "LED: type=0x%04X pixel_order=0x%02X _timing=%i ", _type, _pixel_order, _timing);
 }
 
@@ -103,8 +108,10 @@ TasmotaLED::~TasmotaLED() {
   }
   delete _buf_work;
   _buf_work = nullptr;
-  delete _buf_show;
-  _buf_show = nullptr;
+  for (uint32_t i = 0; i < 2; i++) {
+    delete _buf_show[i];
+    _buf_show[i] = nullptr;
+  }
 }
 
 // Adjust all internal parameters accouring to sub-type
@@ -120,9 +127,15 @@ void TasmotaLED::SetPixelCount(uint16_t num_leds) {
     delete _buf_work;
     _buf_work = new uint8_t[_pixel_count * _pixel_size];
     memset(_buf_work, 0, _pixel_count * _pixel_size);
-    delete _buf_show;
-    _buf_show = new uint8_t[_pixel_count * _pixel_size];
-    memset(_buf_show, 0, _pixel_count * _pixel_size);
+    if (_pusher) {
+      for (uint32_t i = 0; (i < 1000) && !_pusher->CanShow(); i++) { delay(1); }  // old buffer may still be on the wire
+    }
+    for (uint32_t i = 0; i < 2; i++) {
+      delete _buf_show[i];
+      _buf_show[i] = new uint8_t[_pixel_count * _pixel_size];
+      memset(_buf_show[i], 0, _pixel_count * _pixel_size);
+    }
+    _show_pending = false;
     if (_pusher) {
       _pusher->SetPixelCount(_pixel_count);
     }
@@ -169,12 +182,16 @@ void TasmotaLED::Show(void) {
   if (_pusher) {
     _dirty = false;                                               // we don't use the _dirty attribute and always show
 
-    // copy the input buffer to the work buffer in format to be understood by LED strip
+    if (_show_pending) {
+      _frames_dropped++;             // the pending frame is superseded before it ever reached the wire
+    }
+    // copy the input buffer to the inactive show buffer in format to be understood by LED strip
+    // the other show buffer may still be transmitting via RMT/DMA and is never touched here
     if (_raw_format) {
-      memmove(_buf_show, _buf_work, _pixel_count * _pixel_size);    // copy buffer in next buffer so we start with the current content
+      memmove(_buf_show[_buf_show_act], _buf_work, _pixel_count * _pixel_size);    // copy buffer in next buffer so we start with the current content
     } else {
       uint8_t *buf_from = _buf_work;
-      uint8_t *buf_to = _buf_show;
+      uint8_t *buf_to = _buf_show[_buf_show_act];
       if (_pixel_size == 3) {
         // copying with swapping 512 pixels (1536 bytes) takes 124 microseconds to copy, so it's negligeable
         for (uint32_t i = 0; i < _pixel_count; i++) {
@@ -196,7 +213,21 @@ void TasmotaLED::Show(void) {
         }
       }
     }
-    _pusher->Push(_buf_show);          // push to leds
+    if (_pusher->CanShow()) {
+      _pusher->Push(_buf_show[_buf_show_act]);    // push to leds, returns while transmission runs in background
+      _buf_show_act ^= 1;              // next frame renders into the other buffer
+      _show_pending = false;
+    } else {
+      _show_pending = true;            // previous frame still on the wire - frame is sent by Loop() or replaced by the next Show()
+    }
+  }
+}
+
+void TasmotaLED::Loop(void) {
+  if (_show_pending && _pusher && _pusher->CanShow()) {
+    _pusher->Push(_buf_show[_buf_show_act]);
+    _buf_show_act ^= 1;
+    _show_pending = false;
   }
 }
 
@@ -98,7 +98,8 @@ public:
 
   bool Begin(void);
   void SetPusher(TasmotaLEDPusher *pusher);   // needs to be called before `Begin()`, sets the hardware implementation
-  void Show(void);                            // pushes the pixels to the LED strip
+  void Show(void);                            // pushes the pixels to the LED strip, never blocks on the wire
+  void Loop(void);                            // retries a pending frame once the previous transmission completed
   inline void SetRawFormat(bool raw_format) { _raw_format = raw_format; }
 
   void ClearTo(uint32_t rgbw, int32_t first = 0, int32_t last = -1);
@@ -111,7 +112,8 @@ public:
   inline uint8_t * Pixels(void) const { return _buf_work; }
   inline bool IsDirty(void) const { return _dirty; }
   inline void Dirty(void) { _dirty = true; }
-  
+  inline uint32_t FramesDropped(void) const { return _frames_dropped; }
+
   bool CanShow(void) const;
 
 protected:
@@ -125,7 +127,11 @@ protected:
   uint16_t _pixel_count;              // how many pixels in the strip
   uint8_t _pixel_size;                // how many bytes per pixels, only 3 and 4 are supported
   uint8_t *_buf_work;                 // buffer used to draw into, can be modified directly by the caller
-  uint8_t *_buf_show;                 // copy of the buffer used to push to leds, private to this class
+  uint8_t *_buf_show[2];              // double buffer used to push to leds, private to this class
+                                      // one buffer can be rendered into while the other is on the wire
+  uint8_t _buf_show_act;              // index of the buffer Show() renders into (the other may be transmitting)
+  bool _show_pending;                 // a rendered frame is waiting for the previous transmission to complete
+  uint32_t _frames_dropped;           // frames superseded by a newer one before they reached the wire
   const uint8_t (*_pixel_matrix)[3];  // pointer to the pixer_order_matrix
   TasmotaLEDPusher *_pusher;          // pixels pusher implementation based on hardware (RMT, I2S...)
 };
@@ -26,6 +26,9 @@
 
 #include <pgmspace.h>
 #include "renderer.h"
+#ifdef ESP32
+#include <esp_heap_caps.h>
+#endif
 
 
 
@@ -113,6 +116,108 @@ void Renderer::setTextSize(uint8_t sf) {
   Adafruit_GFX::setTextSize(sf);
 }
 
+/*********************************************************************************************\
+ * Glyph run cache
+ *
+ * DrawCharAt() rasterizes every character from the PROGMEM font tables pixel by pixel,
+ * one writePixel()/writeFillRect() call per pixel. Ticker-style screens redraw the same
+ * digits continuously, so the set pixels of each glyph are remembered as horizontal runs
+ * the first time a character is drawn and replayed with one write call per run
+ * afterwards. Runs are stored unscaled and the text size factor is applied when
+ * blitting, so one entry serves every size. Slots are recycled least-recently-used.
+\*********************************************************************************************/
+
+static uint32_t glyph_cache_hits = 0;
+static uint32_t glyph_cache_misses = 0;
+
+#ifdef USE_GLYPH_CACHE
+
+#ifndef GLYPH_CACHE_SLOTS
+#define GLYPH_CACHE_SLOTS 48
+#endif
+
+struct GlyphRun {
+  uint8_t x;
+  uint8_t y;
+  uint8_t len;
+};
+
+struct GlyphCacheSlot {
+  const unsigned char *table;   // font bitmap table, identifies the font
+  unsigned char code;
+  uint16_t count;               // number of runs, 0 for blank glyphs
+  uint32_t stamp;               // last use, for LRU eviction
+  GlyphRun *runs;
+};
+
+static GlyphCacheSlot glyph_cache[GLYPH_CACHE_SLOTS];
+static uint32_t glyph_cache_stamp = 0;
+
+// scan the PROGMEM glyph and emit the horizontal runs of set pixels,
+// with out == nullptr the runs are only counted
+static uint16_t GlyphRunScan(const sFONT *xfont, unsigned char code, GlyphRun *out) {
+  uint16_t bytes_per_row = xfont->Width / 8 + (xfont->Width % 8 ? 1 : 0);
+  const unsigned char *ptr = &xfont->table[(code - ' ') * xfont->Height * bytes_per_row];
+  uint16_t count = 0;
+  for (uint16_t j = 0; j < xfont->Height; j++) {
+    int16_t start = -1;
+    for (uint16_t i = 0; i < xfont->Width; i++) {
+      if (pgm_read_byte(ptr + j * bytes_per_row + (i >> 3)) & (0x80 >> (i & 7))) {
+        if (start < 0) start = i;
+      } else if (start >= 0) {
+        if (out) { out[count].x = start; out[count].y = j; out[count].len = i - start; }
+        count++;
+        start = -1;
+      }
+    }
+    if (start >= 0) {
+      if (out) { out[count].x = start; out[count].y = j; out[count].len = xfont->Width - start; }
+      count++;
+    }
+  }
+  return count;
+}
+
+static GlyphCacheSlot *GlyphCacheLookup(const sFONT *xfont, unsigned char code) {
+  GlyphCacheSlot *lru = &glyph_cache[0];
+  for (uint32_t i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+    GlyphCacheSlot *slot = &glyph_cache[i];
+    if (slot->table == xfont->table && slot->code == code) {
+      glyph_cache_hits++;
+      slot->stamp = ++glyph_cache_stamp;
+      return slot;
+    }
+    if (slot->stamp < lru->stamp) lru = slot;
+  }
+  glyph_cache_misses++;
+  uint16_t count = GlyphRunScan(xfont, code, nullptr);
+  GlyphRun *runs = nullptr;
+  if (count) {
+#ifdef ESP32
+    // prefer PSRAM, the blit only reads a few bytes per glyph
+    runs = (GlyphRun*)heap_caps_malloc_prefer(count * sizeof(GlyphRun), 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_8BIT);
+#else
+    runs = (GlyphRun*)malloc(count * sizeof(GlyphRun));
+#endif
+    if (!runs) return nullptr;    // no memory, caller rasterizes directly
+    GlyphRunScan(xfont, code, runs);
+  }
+  if (lru->runs) free(lru->runs);
+  lru->table = xfont->table;
+  lru->code = code;
+  lru->count = count;
+  lru->runs = runs;
+  lru->stamp = ++glyph_cache_stamp;
+  return lru;
+}
+
+#endif // USE_GLYPH_CACHE
+
+void Renderer::GlyphCacheStats(uint32_t *hits, uint32_t *misses) {
+  *hits = glyph_cache_hits;
+  *misses = glyph_cache_misses;
+}
+
 /**
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
@@ -124,6 +229,26 @@ void Renderer::DrawCharAt(int16_t x, int16_t y, char ascii_char,int16_t colored)
     const unsigned char* ptr = &xfont->table[char_offset];
     uint8_t sf = tsize;
 
+#ifdef USE_GLYPH_CACHE
+    GlyphCacheSlot *slot = GlyphCacheLookup(xfont, ascii_char);
+    if (slot) {
+        // paint the background once, then blit the cached runs - one write call
+        // per run instead of one per pixel
+        if (!drawmode) {
+            writeFillRect(x, y, xfont->Width * sf, xfont->Height * sf, textbgcolor);
+        }
+        for (uint16_t r = 0; r < slot->count; r++) {
+            GlyphRun *run = &slot->runs[r];
+            if (sf == 1) {
+                writeFastHLine(x + run->x, y + run->y, run->len, colored);
+            } else {
+                writeFillRect(x + run->x * sf, y + run->y * sf, run->len * sf, sf, colored);
+            }
+        }
+        return;
+    }
+#endif // USE_GLYPH_CACHE
+
     for (j = 0; j < xfont->Height; j++) {
         for (i = 0; i < xfont->Width; i++) {
             if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
@@ -15,11 +15,13 @@
 //#define USE_GFX_FONTS
 #define USE_TINY_FONT
 #define USE_7SEG_FONT
+#define USE_GLYPH_CACHE          // remember rasterized glyphs as pixel runs and blit them on re-draw (see renderer.cpp)
 
 #define MAX_INDEXCOLORS 32
 
 #ifdef USE_DISPLAY_LVGL_ONLY
 #undef USE_EPD_FONTS
+#undef USE_GLYPH_CACHE
 #endif
 
 // depends on GFX driver
@@ -98,6 +100,7 @@ public:
   virtual int16_t getPoint_y();
 
   void setDrawMode(uint8_t mode);
+  static void GlyphCacheStats(uint32_t *hits, uint32_t *misses);
   uint8_t drawmode;
   virtual void FastString(uint16_t x,uint16_t y,uint16_t tcolor, const char* str);
   void setTextSize(uint8_t s);
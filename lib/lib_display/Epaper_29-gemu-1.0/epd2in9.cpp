@@ -45,11 +45,13 @@ void Epd::DisplayOnff(int8_t on) {
 void Epd::Updateframe() {
 #ifdef   EPD_29_V2
   if (mode == DISPLAY_INIT_PARTIAL) {
+    if (UpdateframeDiff()) return;    // only the changed window was sent, or nothing at all
     SetFrameMemory_Partial(framebuffer, 0, 0, EPD_WIDTH,EPD_HEIGHT);
     DisplayFrame_Partial();
   } else {
     SetFrameMemory(framebuffer, 0, 0, EPD_WIDTH,EPD_HEIGHT);
     DisplayFrame();
+    if (lastframe) memcpy(lastframe, framebuffer, (EPD_WIDTH / 8) * EPD_HEIGHT);    // keep the retained frame in sync
   }
 #else
   SetFrameMemory(framebuffer, 0, 0, EPD_WIDTH,EPD_HEIGHT);
@@ -58,6 +60,50 @@ void Epd::Updateframe() {
   //Serial.printf("update\n");
 }
 
+/**
+ *  @brief: compare the frame against a retained copy of what was last pushed to the
+ *          panel and send only the bounding window of the changed bytes as a single
+ *          partial cycle. Several small changes since the last update batch into one
+ *          window. Returns true when the update was handled (or skipped because
+ *          nothing changed), false when the caller must push the full frame.
+ */
+bool Epd::UpdateframeDiff(void) {
+#ifdef EPD_29_V2
+    uint16_t stride = this->width / 8;
+    if (lastframe == NULL) {
+        lastframe = (uint8_t*)malloc(stride * this->height);
+        if (lastframe == NULL) return false;    // no memory, keep pushing full frames
+        memcpy(lastframe, framebuffer, stride * this->height);
+        return false;                           // first frame goes out in full
+    }
+    /* bounding box of all changed bytes, one byte covers 8 pixels so x stays byte aligned */
+    int16_t y_first = -1, y_last = -1;
+    int16_t b_first = stride, b_last = -1;
+    for (int16_t y = 0; y < this->height; y++) {
+        const uint8_t* nl = framebuffer + y * stride;
+        const uint8_t* ol = lastframe + y * stride;
+        if (!memcmp(nl, ol, stride)) continue;
+        if (y_first < 0) y_first = y;
+        y_last = y;
+        int16_t b = 0;
+        while (nl[b] == ol[b]) b++;
+        if (b < b_first) b_first = b;
+        b = stride - 1;
+        while (nl[b] == ol[b]) b--;
+        if (b > b_last) b_last = b;
+    }
+    if (y_first < 0) return true;               // nothing changed, skip the refresh cycle entirely
+    SetFrameMemory_Partial(framebuffer, b_first * 8, y_first, (b_last - b_first + 1) * 8, y_last - y_first + 1);
+    DisplayFrame_Partial();
+    for (int16_t y = y_first; y <= y_last; y++) {
+        memcpy(lastframe + y * stride + b_first, framebuffer + y * stride + b_first, b_last - b_first + 1);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 void Epd::DisplayInit(int8_t p,int8_t size,int8_t rot,int8_t font) {
 // ignore update mode
   if (p == DISPLAY_INIT_PARTIAL) {
@@ -473,10 +519,11 @@ void Epd::SetFrameMemory_Partial(const unsigned char* image_buffer, int x, int y
   SetMemoryArea(x, y, x_end, y_end);
   SetMemoryPointer(x, y);
   SendCommand(0x24);
-  /* send the image data */
-  for (int j = 0; j < y_end - y + 1; j++) {
-    for (int i = 0; i < (x_end - x + 1) / 8; i++) {
-        SendData(image_buffer[i + j * (image_width / 8)]^0xff);
+  /* the buffer holds the full frame, send only the window */
+  int stride = this->width / 8;
+  for (int j = y; j <= y_end; j++) {
+    for (int i = (x >> 3); i <= (x_end >> 3); i++) {
+        SendData(image_buffer[i + j * stride]^0xff);
     }
   }
 }
@@ -117,6 +117,8 @@ private:
     void SetLut_by_host(const unsigned char* lut);
     void SetFrameMemory_Partial(const unsigned char* image_buffer,int x,int y,int image_width,int image_height);
     void DisplayFrame_Partial(void);
+    bool UpdateframeDiff(void);
+    uint8_t *lastframe = nullptr;
     //void fastSPIwrite(uint8_t d,uint8_t dc);
 };
 
@@ -45,15 +45,59 @@ void Epd42::DisplayOnff(int8_t on) {
 
 void Epd42::Updateframe() {
   //SetFrameMemory(buffer, 0, 0, EPD_WIDTH,EPD_HEIGHT);
+  if (epd42_mode==DISPLAY_INIT_PARTIAL) {
+    if (UpdateframeDiff()) return;    // only the changed window was sent, or nothing at all
+  }
   SetPartialWindow(framebuffer, 0, 0, width,height,2);
   if (epd42_mode==DISPLAY_INIT_PARTIAL) {
     DisplayFrameQuick();
   } else {
     DisplayFrame();
   }
+  if (lastframe) memcpy(lastframe, framebuffer, (width / 8) * height);    // keep the retained frame in sync
   //Serial.printf("update\n");
 }
 
+/**
+ *  @brief: compare the frame against a retained copy of what was last pushed to the
+ *          panel and send only the bounding window of the changed bytes as a single
+ *          quick cycle. Several small changes since the last update batch into one
+ *          window. Returns true when the update was handled (or skipped because
+ *          nothing changed), false when the caller must push the full frame.
+ */
+bool Epd42::UpdateframeDiff(void) {
+  uint16_t stride = width / 8;
+  if (lastframe == NULL) {
+    lastframe = (uint8_t*)malloc(stride * height);
+    if (lastframe == NULL) return false;    // no memory, keep pushing full frames
+    memcpy(lastframe, framebuffer, stride * height);
+    return false;                           // first frame goes out in full
+  }
+  // bounding box of all changed bytes, one byte covers 8 pixels so x stays byte aligned
+  int16_t y_first = -1, y_last = -1;
+  int16_t b_first = stride, b_last = -1;
+  for (int16_t y = 0; y < height; y++) {
+    const uint8_t* nl = framebuffer + y * stride;
+    const uint8_t* ol = lastframe + y * stride;
+    if (!memcmp(nl, ol, stride)) continue;
+    if (y_first < 0) y_first = y;
+    y_last = y;
+    int16_t b = 0;
+    while (nl[b] == ol[b]) b++;
+    if (b < b_first) b_first = b;
+    b = stride - 1;
+    while (nl[b] == ol[b]) b--;
+    if (b > b_last) b_last = b;
+  }
+  if (y_first < 0) return true;             // nothing changed, skip the refresh cycle entirely
+  SetPartialWindow(framebuffer, b_first * 8, y_first, (b_last - b_first + 1) * 8, y_last - y_first + 1, 2);
+  DisplayFrameQuick();
+  for (int16_t y = y_first; y <= y_last; y++) {
+    memcpy(lastframe + y * stride + b_first, framebuffer + y * stride + b_first, b_last - b_first + 1);
+  }
+  return true;
+}
+
 void Epd42::DisplayInit(int8_t p,int8_t size,int8_t rot,int8_t font) {
 // ignore update mode
   if (p==DISPLAY_INIT_PARTIAL) {
@@ -202,8 +246,13 @@ void Epd42::SetPartialWindow(const unsigned char* buffer_black, int x, int y, in
   //  DelayMs(2);
     SendCommand((dtm == 1) ? EPD_42_DATA_START_TRANSMISSION_1 : EPD_42_DATA_START_TRANSMISSION_2);
     if (buffer_black != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_black[i]^0xff);
+        /* the buffer holds the full frame, send only the window */
+        int stride = width / 8;
+        for (int j = 0; j < l; j++) {
+            const unsigned char *line = buffer_black + (y + j) * stride + (x >> 3);
+            for (int i = 0; i < w / 8; i++) {
+                SendData(line[i]^0xff);
+            }
         }
     } else {
         for(int i = 0; i < w  / 8 * l; i++) {
@@ -118,6 +118,8 @@ public:
 
 private:
   void fastSPIwrite(uint8_t d,uint8_t dc);
+  bool UpdateframeDiff(void);
+  uint8_t *lastframe = nullptr;
   uint8_t cs_pin;
   uint8_t mosi_pin;
   uint8_t sclk_pin;
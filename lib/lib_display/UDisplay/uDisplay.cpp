@@ -1073,6 +1073,12 @@ Renderer *uDisplay::Init(void) {
   }
   frame_buffer = framebuffer;
 
+  // start with the whole frame dirty so the first Updateframe() pushes everything
+  fb_dirty_x1 = 0;
+  fb_dirty_y1 = 0;
+  fb_dirty_x2 = gxs - 1;
+  fb_dirty_y2 = gys - 1;
+
   if (interface == _UDSP_I2C) {
     if (wire_n == 0) {
       wire = &Wire;
@@ -1654,6 +1660,54 @@ void uDisplay::i2c_command(uint8_t val) {
 
 #define WIRE_MAX 32
 
+// mark the dirty window empty, done after each flush
+void uDisplay::fb_dirty_reset(void) {
+  fb_dirty_x1 = gxs;
+  fb_dirty_y1 = gys;
+  fb_dirty_x2 = -1;
+  fb_dirty_y2 = -1;
+}
+
+// union a rectangle given in logical (rotated) coordinates into the dirty window,
+// applying the same rotation mapping as the Renderer framebuffer primitives
+void uDisplay::fb_dirty_add(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t t;
+  switch (getRotation()) {
+    case 0:
+      break;
+    case 1:
+      t = x;
+      x = WIDTH - (y + h);
+      y = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    case 2:
+      x = WIDTH - (x + w);
+      y = HEIGHT - (y + h);
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - (t + w);
+      t = w;
+      w = h;
+      h = t;
+      break;
+  }
+  // clip to the physical frame
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > WIDTH) { w = WIDTH - x; }
+  if (y + h > HEIGHT) { h = HEIGHT - y; }
+  if ((w <= 0) || (h <= 0)) { return; }
+  if (x < fb_dirty_x1) { fb_dirty_x1 = x; }
+  if (y < fb_dirty_y1) { fb_dirty_y1 = y; }
+  if (x + w - 1 > fb_dirty_x2) { fb_dirty_x2 = x + w - 1; }
+  if (y + h - 1 > fb_dirty_y2) { fb_dirty_y2 = y + h - 1; }
+}
+
 void uDisplay::Updateframe(void) {
 
   if (interface == _UDSP_RGB) {
@@ -1693,35 +1747,41 @@ void uDisplay::Updateframe(void) {
     wire->endTransmission();
 #else
 
+    if (fb_dirty_x2 < fb_dirty_x1) { return; }    // nothing changed since last flush
+
     i2c_command(saw_1 | 0x0);  // set low col = 0, 0x00
     i2c_command(i2c_page_start | 0x0);  // set hi col = 0, 0x10
     i2c_command(i2c_page_end | 0x0); // set startline line #0, 0x40
 
-	  uint8_t ys = gys >> 3;
 	  uint8_t xs = gxs >> 3;
-    //uint8_t xs = 132 >> 3;
 	  uint8_t m_row = saw_2;
 	  uint8_t m_col = i2c_col_start;
 
-	  uint16_t p = 0;
+    // flush only the dirty window, a page holds 8 rows
+	  uint8_t page_start = fb_dirty_y1 >> 3;
+	  uint8_t page_end = fb_dirty_y2 >> 3;
 
-	  uint8_t i, j, k = 0;
-
-	  for ( i = 0; i < ys; i++) {
+	  for (uint8_t page = page_start; page <= page_end; page++) {
 		    // send a bunch of data in one xmission
-        i2c_command(0xB0 + i + m_row); //set page address
-        i2c_command(m_col & 0xf); //set lower column address
-        i2c_command(0x10 | (m_col >> 4)); //set higher column address
-
-        for ( j = 0; j < 8; j++) {
+        i2c_command(0xB0 + page + m_row); //set page address
+        uint8_t col = m_col + fb_dirty_x1;
+        i2c_command(col & 0xf); //set lower column address
+        i2c_command(0x10 | (col >> 4)); //set higher column address
+
+        uint16_t p = (uint16_t)page * gxs + fb_dirty_x1;
+        uint16_t count = fb_dirty_x2 - fb_dirty_x1 + 1;
+        while (count) {
+            uint16_t chunk = (count > xs) ? xs : count;   // keep transmissions at the original size
 			      wire->beginTransmission(i2caddr);
             wire->write(0x40);
-            for ( k = 0; k < xs; k++, p++) {
+            for (uint16_t k = 0; k < chunk; k++, p++) {
 		            wire->write(framebuffer[p]);
             }
             wire->endTransmission();
+            count -= chunk;
 	      }
     }
+    fb_dirty_reset();
 #endif
 
  }
@@ -1729,6 +1789,7 @@ void uDisplay::Updateframe(void) {
 
   if (interface == _UDSP_SPI) {
     if (framebuffer == nullptr) { return; }
+    if (fb_dirty_x2 < fb_dirty_x1) { return; }    // nothing changed since last flush
 
     SPI_BEGIN_TRANSACTION
     SPI_CS_LOW
@@ -1738,28 +1799,27 @@ void uDisplay::Updateframe(void) {
     // ulcd_command(i2c_page_start | 0x0);  // set hi col = 0, 0x10
     // ulcd_command(i2c_page_end | 0x0); // set startline line #0, 0x40
 
-	  uint8_t ys = gys >> 3;
-	  uint8_t xs = gxs >> 3;
-    //uint8_t xs = 132 >> 3;
 	  uint8_t m_row = saw_2;
 	  uint8_t m_col = i2c_col_start;
-    // Serial.printf("m_row=%d m_col=%d xs=%d ys=%d\n", m_row, m_col, xs, ys);
+    // Serial.printf("m_row=%d m_col=%d xs=%d ys=%d\n", m_row, m_col, gxs >> 3, gys >> 3);
 
-	  uint16_t p = 0;
+    // flush only the dirty window, a page holds 8 rows
+	  uint8_t page_start = fb_dirty_y1 >> 3;
+	  uint8_t page_end = fb_dirty_y2 >> 3;
 
-	  uint8_t i, j, k = 0;
-	  for ( i = 0; i < ys; i++) {   // i = line from 0 to ys
+	  for (uint8_t page = page_start; page <= page_end; page++) {
 		    // send a bunch of data in one xmission
-        ulcd_command(0xB0 + i + m_row); //set page address
-        ulcd_command(m_col & 0xf); //set lower column address
-        ulcd_command(0x10 | (m_col >> 4)); //set higher column address
-
-        for ( j = 0; j < 8; j++) {
-            for ( k = 0; k < xs; k++, p++) {
-		            ulcd_data8(framebuffer[p]);
-            }
+        ulcd_command(0xB0 + page + m_row); //set page address
+        uint8_t col = m_col + fb_dirty_x1;
+        ulcd_command(col & 0xf); //set lower column address
+        ulcd_command(0x10 | (col >> 4)); //set higher column address
+
+        uint16_t p = (uint16_t)page * gxs + fb_dirty_x1;
+        for (int16_t k = fb_dirty_x1; k <= fb_dirty_x2; k++, p++) {
+		        ulcd_data8(framebuffer[p]);
 	      }
     }
+    fb_dirty_reset();
 
     SPI_CS_HIGH
     SPI_END_TRANSACTION
@@ -1777,6 +1837,7 @@ void uDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
   }
 
   if (framebuffer) {
+    fb_dirty_add(x, y, 1, h);
     Renderer::drawFastVLine(x, y, h, color);
     return;
   }
@@ -1847,6 +1908,7 @@ void uDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
   }
 
   if (framebuffer) {
+    fb_dirty_add(x, y, w, 1);
     Renderer::drawFastHLine(x, y, w, color);
     return;
   }
@@ -1935,6 +1997,7 @@ void uDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t col
   }
 
   if (framebuffer) {
+    fb_dirty_add(x, y, w, h);
     Renderer::fillRect(x, y, w, h, color);
     return;
   }
@@ -2433,6 +2496,7 @@ void uDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
   }
 
   if (framebuffer) {
+    fb_dirty_add(x, y, 1, 1);
     Renderer::drawPixel(x, y, color);
     return;
   }
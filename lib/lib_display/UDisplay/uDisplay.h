@@ -270,6 +270,13 @@ class uDisplay : public Renderer {
    int32_t next_val(char **sp);
    uint32_t next_hex(char **sp);
    void setAddrWindow_int(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+   void fb_dirty_reset(void);
+   void fb_dirty_add(int16_t x, int16_t y, int16_t w, int16_t h);
+   // dirty window of the local framebuffer in physical coordinates, Updateframe() flushes only this region
+   int16_t fb_dirty_x1;
+   int16_t fb_dirty_y1;
+   int16_t fb_dirty_x2;
+   int16_t fb_dirty_y2;
    char dname[16];
    int8_t bpp;
    uint8_t col_type;
@@ -116,8 +116,131 @@ void A4988_Stepper::disable(){
   if (motor_ena_pin < 99) {digitalWrite(motor_ena_pin, HIGH);}
 }
 
+#ifdef ESP32
+
+A4988_Stepper *A4988_Stepper::isr_instance = nullptr;
+
+void IRAM_ATTR A4988_Stepper::stepIsr(void) {
+  A4988_Stepper *s = isr_instance;
+  if (0 == s->tick_wait) { return; }            // Move finished, waiting for service() to stop the timer
+  if (--s->tick_wait) { return; }               // Half period not elapsed yet
+
+  s->step_high = !s->step_high;
+  digitalWrite(s->motor_stp_pin, s->step_high);
+  if (!s->step_high) {                          // Only HIGH moves, step completes when pulled LOW
+    s->position += s->step_dir;
+    if (--s->steps_remaining <= 0) { return; }  // Done, tick_wait stays 0
+
+    long done = s->move_steps - s->steps_remaining;
+    if (done < s->ramp_steps) {                 // Accelerating
+      s->step_number++;
+      s->step_delay -= (2 * s->step_delay) / (4 * s->step_number + 1);
+      if (s->step_delay < s->min_delay) { s->step_delay = s->min_delay; }
+    } else if (s->steps_remaining < s->ramp_steps) {  // Decelerating
+      s->step_delay = (s->step_delay * (4 * s->step_number + 1)) / (4 * s->step_number - 1);
+      s->step_number--;
+      if (s->step_number < 1) { s->step_number = 1; }
+    }
+  }
+  s->tick_wait = (s->step_delay + A4988_STEP_TICK_US - 1) / A4988_STEP_TICK_US;
+  if (0 == s->tick_wait) { s->tick_wait = 1; }
+}
+
+bool A4988_Stepper::startMove(long howManySteps) {
+  if (nullptr == step_timer) {
+    isr_instance = this;
+#if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) )
+    step_timer = timerBegin(1000000);           // 1 MHz
+    if (nullptr == step_timer) { return false; }
+    timerAttachInterrupt(step_timer, &A4988_Stepper::stepIsr);
+#else // ESP_ARDUINO_VERSION_MAJOR >= 3
+    step_timer = timerBegin(3, 80, true);       // 80 divider -> 1 count = 1us
+    if (nullptr == step_timer) { return false; }
+    timerAttachInterrupt(step_timer, &A4988_Stepper::stepIsr, true);
+#endif // ESP_ARDUINO_VERSION_MAJOR >= 3
+  }
+  if (timer_running) {                          // Abort a move still in progress
+    steps_remaining = 0;
+    service();
+  }
+
+  long steps = labs(howManySteps);
+  if (0 == steps) { return true; }
+
+  digitalWrite(motor_dir_pin, howManySteps>0?LOW:HIGH);
+  step_dir = (howManySteps > 0) ? 1 : -1;
+  enable();
+
+  // Trapezoidal profile: ramp up over ramp_steps, cruise at min_delay, ramp down.
+  // Speeds and delays are half periods as the ISR toggles the step pin each time.
+  min_delay = motor_delay;
+  if (0 == min_delay) { min_delay = 1; }
+  float target_sps = 1000000.0f / (2 * min_delay);              // Target speed in steps/s
+  long ramp = (long)((target_sps * target_sps) / (2 * A4988_ACCEL));
+  if (ramp > steps / 2) { ramp = steps / 2; }
+  if (ramp > 0) {
+    step_delay = (unsigned long)(0.676f * sqrtf(2.0f / A4988_ACCEL) * 1000000.0f / 2);  // c0, halved
+    if (step_delay < min_delay) { step_delay = min_delay; }
+  } else {
+    step_delay = min_delay;                     // Too slow or too short to ramp
+  }
+  ramp_steps = ramp;
+  step_number = 1;
+  move_steps = steps;
+  step_high = false;
+  steps_remaining = steps;
+  tick_wait = (step_delay + A4988_STEP_TICK_US - 1) / A4988_STEP_TICK_US;
+
+#if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) )
+  timerAlarm(step_timer, A4988_STEP_TICK_US, true, 0);
+  timerStart(step_timer);
+#else // ESP_ARDUINO_VERSION_MAJOR >= 3
+  timerAlarmWrite(step_timer, A4988_STEP_TICK_US, true);
+  timerAlarmEnable(step_timer);
+#endif // ESP_ARDUINO_VERSION_MAJOR >= 3
+  timer_running = true;
+  return true;
+}
+
+#endif  // ESP32
+
+bool A4988_Stepper::moving(void) {
+#ifdef ESP32
+  return (steps_remaining > 0);
+#else
+  return false;                                 // Moves are blocking
+#endif  // ESP32
+}
+
+long A4988_Stepper::getPosition(void) {
+  return position;
+}
+
+void A4988_Stepper::service(void) {
+#ifdef ESP32
+  if (timer_running && (steps_remaining <= 0)) {
+    steps_remaining = 0;
+    tick_wait = 0;
+#if ( defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) )
+    timerStop(step_timer);
+#else // ESP_ARDUINO_VERSION_MAJOR >= 3
+    timerAlarmDisable(step_timer);
+#endif // ESP_ARDUINO_VERSION_MAJOR >= 3
+    timer_running = false;
+    if (step_high) {                            // Don't leave the step pin floating high
+      step_high = false;
+      digitalWrite(motor_stp_pin, LOW);
+    }
+    disable();
+  }
+#endif  // ESP32
+}
+
 void A4988_Stepper::doMove(long howManySteps)
 {
+#ifdef ESP32
+  if (startMove(howManySteps)) { return; }      // Steps are generated by the hardware timer
+#endif  // ESP32
   long steps_togo = abs(howManySteps);  // how many steps to take
   bool lastStepWasHigh = false;
   digitalWrite(motor_dir_pin, howManySteps>0?LOW:HIGH);
@@ -131,7 +254,10 @@ void A4988_Stepper::doMove(long howManySteps)
       lastStepWasHigh = !lastStepWasHigh;
       // remeber step-time
       last_time = now;
-      if (!lastStepWasHigh) steps_togo--; // same here - only HIGH moves, if pulled LOW step is completed...
+      if (!lastStepWasHigh) {
+        steps_togo--; // same here - only HIGH moves, if pulled LOW step is completed...
+        position += (howManySteps > 0) ? 1 : -1;
+      }
     }
   }
   disable();
@@ -17,6 +17,17 @@
 #ifndef A4988_Stepper_h
 #define A4988_Stepper_h
 
+#include <Arduino.h>
+
+#ifdef ESP32
+#ifndef A4988_STEP_TICK_US
+#define A4988_STEP_TICK_US  20       // Timer tick in us, limits top speed to 1s / (2 * tick)
+#endif
+#ifndef A4988_ACCEL
+#define A4988_ACCEL         4000     // Acceleration in (micro)steps per second^2
+#endif
+#endif  // ESP32
+
 class A4988_Stepper {
   public:
     // constructor:
@@ -47,6 +58,10 @@ class A4988_Stepper {
     void  enable  (void              );
     void  disable (void              );
 
+    bool  moving  (void              );
+    long  getPosition(void           );
+    void  service (void              );  // call periodically, releases the timer after a move
+
     int   version (void              );
     const unsigned short MIS_TABLE[5] = {0b000,0b001,0b010,0b011,0b111};
 
@@ -68,6 +83,30 @@ class A4988_Stepper {
     short motor_ms3_pin;
 
     unsigned long last_time;  // timestamp of last pincycle of last step
+
+    volatile long position = 0;         // signed step position, counted by the timer ISR (or the blocking loop)
+
+#ifdef ESP32
+    // Steps are generated from a free running hardware timer so moves are smooth and
+    // non-blocking regardless of main loop load. The ISR runs every A4988_STEP_TICK_US,
+    // counts down to the next step pin toggle and walks a trapezoidal speed profile
+    // (D. Austin's incremental algorithm, integer only).
+    bool startMove(long howManySteps);  // arm the step engine, false if no timer available
+    static void IRAM_ATTR stepIsr(void);
+
+    static A4988_Stepper *isr_instance;
+    hw_timer_t   *step_timer = nullptr;
+    bool          timer_running = false;
+    volatile long steps_remaining = 0;  // steps left in current move, 0 = idle
+    volatile long move_steps = 0;       // total steps of current move
+    volatile long ramp_steps = 0;       // length of the accel/decel ramp in steps
+    volatile long step_number = 0;      // current position on the ramp
+    volatile unsigned long step_delay = 0;  // current half period in us
+    volatile unsigned long min_delay = 0;   // half period at target speed in us
+    volatile unsigned long tick_wait = 0;   // timer ticks until next step pin toggle
+    volatile bool step_high = false;    // current level of the step pin
+    volatile int  step_dir = 0;         // +1 clockwise, -1 counterclockwise
+#endif  // ESP32
 };
 
 #endif
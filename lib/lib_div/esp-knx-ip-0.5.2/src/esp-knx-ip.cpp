@@ -17,6 +17,8 @@ char const *string_defaults[] =
 ESPKNXIP::ESPKNXIP() : server(nullptr),
                       registered_callback_assignments(0),
                       free_callback_assignment_slots(0),
+                      dispatch_index_len(0),
+                      dispatch_index_dirty(true),
                       registered_callbacks(0),
                       free_callback_slots(0),
                       registered_configs(0),
@@ -180,6 +182,7 @@ void ESPKNXIP::restore_from_eeprom()
     EEPROM.get(address, callback_assignments[i].callback_id);
     address += sizeof(callback_id_t);
   }
+  dispatch_index_dirty = true;
   EEPROM.get(address, physaddr);
   address += sizeof(address_t);
 
@@ -230,6 +233,7 @@ callback_assignment_id_t ESPKNXIP::__callback_register_assignment(address_t addr
     callback_assignments[aid].address = address;
     callback_assignments[aid].callback_id = id;
     registered_callback_assignments++;
+    dispatch_index_dirty = true;
     return aid;
   }
   else
@@ -248,6 +252,7 @@ callback_assignment_id_t ESPKNXIP::__callback_register_assignment(address_t addr
       callback_assignments[aid].callback_id = id;
 
       free_callback_assignment_slots--;
+      dispatch_index_dirty = true;
       return id;
     }
   }
@@ -263,6 +268,7 @@ void ESPKNXIP::__callback_delete_assignment(callback_assignment_id_t id)
   callback_assignments[id].slot_flags = SLOT_FLAGS_EMPTY;
   callback_assignments[id].address.value = 0;
   callback_assignments[id].callback_id = 0;
+  dispatch_index_dirty = true;
 
   if (id == registered_callback_assignments - 1)
   {
@@ -419,6 +425,52 @@ void ESPKNXIP::callback_deregister(callback_id_t id)
   }
 }
 
+void ESPKNXIP::__dispatch_index_rebuild()
+{
+  // Compile the used assignment slots into an index sorted by group address so
+  // that receive time dispatch can binary search instead of scanning all slots
+  dispatch_index_len = 0;
+  for (callback_assignment_id_t i = 0; i < registered_callback_assignments; ++i)
+  {
+    if ((callback_assignments[i].slot_flags & SLOT_FLAGS_USED) == 0)
+      continue;
+    callback_assignment_id_t j = dispatch_index_len;
+    while (j > 0 && callback_assignments[dispatch_index[j - 1]].address.value > callback_assignments[i].address.value)
+    {
+      dispatch_index[j] = dispatch_index[j - 1];
+      j--;
+    }
+    dispatch_index[j] = i;
+    dispatch_index_len++;
+  }
+  dispatch_index_dirty = false;
+}
+
+int16_t ESPKNXIP::__dispatch_index_search(uint16_t addr)
+{
+  // Binary search returning the first index entry matching addr, or -1.
+  // Equal addresses are adjacent in the index so callers can walk forward.
+  int16_t lo = 0;
+  int16_t hi = (int16_t)dispatch_index_len - 1;
+  int16_t found = -1;
+  while (lo <= hi)
+  {
+    int16_t mid = (lo + hi) / 2;
+    uint16_t val = callback_assignments[dispatch_index[mid]].address.value;
+    if (val < addr)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      if (val == addr)
+        found = mid;
+      hi = mid - 1;
+    }
+  }
+  return found;
+}
+
 callback_assignment_id_t ESPKNXIP::callback_assign(callback_id_t id, address_t val)
 {
   if (!__callback_is_id_valid(id))
@@ -596,6 +648,16 @@ void ESPKNXIP::__loop_knx()
   if (cemi_data->control_2.bits.dest_addr_type != 0x01)
     return;
 
+  // Early filter: drop telegrams for group addresses without any assignment
+  // before command type extraction and data copies. On a busy backbone most
+  // routed telegrams are for other devices.
+  if (dispatch_index_dirty)
+    __dispatch_index_rebuild();
+
+  int16_t match = __dispatch_index_search(cemi_data->destination.value);
+  if (match < 0)
+    return;
+
   DEBUG_PRINT(F("HC: 0x"));
   DEBUG_PRINTLN(cemi_data->control_2.bits.hop_count, 16);
 
@@ -627,40 +689,33 @@ void ESPKNXIP::__loop_knx()
 
   DEBUG_PRINTLN(F("=="));
 
-  // Call callbacks
-  for (int i = 0; i < registered_callback_assignments; ++i)
+  // Call callbacks, equal addresses are adjacent in the sorted index
+  for (; (match < dispatch_index_len) &&
+         (cemi_data->destination.value == callback_assignments[dispatch_index[match]].address.value); ++match)
   {
-    DEBUG_PRINT(F("Testing: 0x"));
-    DEBUG_PRINT(callback_assignments[i].address.bytes.high, 16);
-    DEBUG_PRINT(F(" 0x"));
-    DEBUG_PRINTLN(callback_assignments[i].address.bytes.low, 16);
-    if (cemi_data->destination.value == callback_assignments[i].address.value)
+    callback_assignment_id_t i = dispatch_index[match];
+    DEBUG_PRINTLN(F("Found match"));
+    if (callbacks[callback_assignments[i].callback_id].cond && !callbacks[callback_assignments[i].callback_id].cond())
     {
-      DEBUG_PRINTLN(F("Found match"));
-      if (callbacks[callback_assignments[i].callback_id].cond && !callbacks[callback_assignments[i].callback_id].cond())
-      {
-        DEBUG_PRINTLN(F("But it's disabled"));
-#if ALLOW_MULTIPLE_CALLBACKS_PER_ADDRESS
-        continue;
-#else
-        return;
-#endif
-      }
-      uint8_t data[cemi_data->data_len];
-      memcpy(data, cemi_data->data, cemi_data->data_len);
-      data[0] = data[0] & 0x3F;
-      message_t msg = {};
-      msg.ct = ct;
-      msg.received_on = cemi_data->destination;
-      msg.data_len = cemi_data->data_len;
-      msg.data = data;
-      callbacks[callback_assignments[i].callback_id].fkt(msg, callbacks[callback_assignments[i].callback_id].arg);
+      DEBUG_PRINTLN(F("But it's disabled"));
 #if ALLOW_MULTIPLE_CALLBACKS_PER_ADDRESS
       continue;
 #else
       return;
 #endif
     }
+    uint8_t data[cemi_data->data_len];
+    memcpy(data, cemi_data->data, cemi_data->data_len);
+    data[0] = data[0] & 0x3F;
+    message_t msg = {};
+    msg.ct = ct;
+    msg.received_on = cemi_data->destination;
+    msg.data_len = cemi_data->data_len;
+    msg.data = data;
+    callbacks[callback_assignments[i].callback_id].fkt(msg, callbacks[callback_assignments[i].callback_id].arg);
+#if !ALLOW_MULTIPLE_CALLBACKS_PER_ADDRESS
+    return;
+#endif
   }
 
   return;
@@ -568,6 +568,10 @@ class ESPKNXIP {
     callback_assignment_id_t __callback_register_assignment(address_t address, callback_id_t id);
     void __callback_delete_assignment(callback_assignment_id_t id);
 
+    // Sorted group address index for telegram dispatch, see __loop_knx()
+    void __dispatch_index_rebuild();
+    int16_t __dispatch_index_search(uint16_t addr);
+
     //static inline float pow(float a, float b) { return FastPrecisePowf(a, b); }
 
     ESP8266WebServer *server;
@@ -579,6 +583,11 @@ class ESPKNXIP {
     callback_assignment_id_t free_callback_assignment_slots;
     callback_assignment_t callback_assignments[MAX_CALLBACK_ASSIGNMENTS];
 
+    // Assignment ids sorted by group address, rebuilt lazily when assignments change
+    callback_assignment_id_t dispatch_index[MAX_CALLBACK_ASSIGNMENTS];
+    callback_assignment_id_t dispatch_index_len;
+    bool dispatch_index_dirty;
+
     callback_id_t registered_callbacks;
     callback_id_t free_callback_slots;
     callback_t callbacks[MAX_CALLBACKS];
@@ -0,0 +1,79 @@
+/*
+  ESP32HwAES.cpp - BearSSL AES-CTR implementation backed by the ESP32 AES peripheral.
+
+  See ESP32HwAES.h for the rationale and the selection logic.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "ESP32HwAES.h"
+
+#ifdef TLS_HW_AES_CTR
+
+#include <string.h>
+
+static void
+br_aes_esp32_ctr_init(const br_block_ctr_class **ctx, const void *key, size_t len)
+{
+	br_aes_esp32_ctr_keys *kc;
+
+	kc = (br_aes_esp32_ctr_keys *)ctx;
+	kc->vtable = &br_aes_esp32_ctr_vtable;
+	mbedtls_aes_init(&kc->cx);
+	mbedtls_aes_setkey_enc(&kc->cx, (const unsigned char *)key, len << 3);
+}
+
+static uint32_t
+br_aes_esp32_ctr_run(const br_block_ctr_class *const *ctx,
+	const void *iv, uint32_t cc, void *data, size_t len)
+{
+	br_aes_esp32_ctr_keys *kc;
+	unsigned char ctr[16];
+	unsigned char stream[16];
+	size_t nc_off;
+
+	kc = (br_aes_esp32_ctr_keys *)ctx;
+
+	/*
+	 * Assemble the initial counter block the way BearSSL does: 12-byte
+	 * IV followed by the 32-bit big-endian block counter. mbedtls
+	 * increments the whole 128-bit counter while BearSSL only wraps the
+	 * low 32 bits, but a single run covers at most one TLS record so
+	 * the counter never carries into the IV bytes and both schemes
+	 * produce the same key stream.
+	 */
+	memcpy(ctr, iv, 12);
+	ctr[12] = (unsigned char)(cc >> 24);
+	ctr[13] = (unsigned char)(cc >> 16);
+	ctr[14] = (unsigned char)(cc >> 8);
+	ctr[15] = (unsigned char)cc;
+	nc_off = 0;
+	mbedtls_aes_crypt_ctr(&kc->cx, len, &nc_off, ctr, stream,
+		(const unsigned char *)data, (unsigned char *)data);
+	return cc + (uint32_t)((len + 15) >> 4);
+}
+
+const br_block_ctr_class br_aes_esp32_ctr_vtable = {
+	sizeof(br_aes_esp32_ctr_keys),
+	16,
+	4,
+	&br_aes_esp32_ctr_init,
+	&br_aes_esp32_ctr_run
+};
+
+static_assert(sizeof(br_aes_esp32_ctr_keys) <= sizeof(br_aes_gen_ctr_keys),
+	"hardware AES context exceeds BearSSL's generic CTR key union");
+
+#endif  // TLS_HW_AES_CTR
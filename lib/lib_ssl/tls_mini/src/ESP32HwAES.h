@@ -0,0 +1,52 @@
+/*
+  ESP32HwAES.h - BearSSL AES-CTR implementation backed by the ESP32 AES peripheral.
+
+  BearSSL runs its bitsliced software AES on every TLS record while the
+  hardware AES engine sits idle. This vtable routes CTR (the mode used by
+  the AES-GCM record layer) through mbedtls, which uses the AES peripheral
+  on targets built with CONFIG_MBEDTLS_HARDWARE_AES. GHASH and the
+  handshake hashes stay in software: there is no GF(2^128) hardware, and
+  the multihash engine relies on BearSSL's internal hash state layout.
+
+  Define TLS_NO_HW_AES to force the software implementation on all targets.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef esp32hwaes_h
+#define esp32hwaes_h
+
+#ifdef ESP32
+#include "sdkconfig.h"
+#if defined(CONFIG_MBEDTLS_HARDWARE_AES) && !defined(TLS_NO_HW_AES)
+#define TLS_HW_AES_CTR                  // Hardware CTR vtable available on this target
+
+#include <t_bearssl.h>
+#include <mbedtls/aes.h>
+
+// Context for AES subkeys when CTR runs on the AES peripheral.
+// The SSL engine stores it inside br_aes_gen_ctr_keys, so it must not
+// outgrow that union (checked with a static_assert in ESP32HwAES.cpp).
+typedef struct {
+  const br_block_ctr_class *vtable;
+  mbedtls_aes_context cx;
+} br_aes_esp32_ctr_keys;
+
+extern const br_block_ctr_class br_aes_esp32_ctr_vtable;
+
+#endif  // CONFIG_MBEDTLS_HARDWARE_AES && !TLS_NO_HW_AES
+#endif  // ESP32
+
+#endif  // esp32hwaes_h
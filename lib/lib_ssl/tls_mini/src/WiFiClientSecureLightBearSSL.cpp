@@ -37,6 +37,7 @@
 #include "WiFiHelper.h"
 #include "WiFiClient.h"
 #include "StackThunk_light.h"
+#include "ESP32HwAES.h"
 #include "lwip/opt.h"
 #include "lwip/ip.h"
 #include "lwip/tcp.h"
@@ -206,6 +207,7 @@ void WiFiClientSecure_light::_clear() {
   _max_thunkstack_use = 0;
   _alpn_names = nullptr;
   _alpn_num = 0;
+  _session = nullptr;
 }
 
 // Constructor
@@ -921,7 +923,12 @@ extern "C" {
 
     // AES CTR/GCM small version, not contstant time (we don't really care here as there is no TPM anyways)
     br_ssl_engine_set_gcm(&cc->eng, &br_sslrec_in_gcm_vtable, &br_sslrec_out_gcm_vtable);
+#ifdef TLS_HW_AES_CTR
+    // CTR on the ESP32 AES peripheral, GHASH stays in software (no GF(2^128) hardware)
+    br_ssl_engine_set_aes_ctr(&cc->eng, &br_aes_esp32_ctr_vtable);
+#else
     br_ssl_engine_set_aes_ctr(&cc->eng, &br_aes_small_ctr_vtable);
+#endif
     br_ssl_engine_set_ghash(&cc->eng, &br_ghash_ctmul32);
 
     // we support only P256 EC curve for AWS IoT, no EC curve for Letsencrypt unless forced
@@ -1007,9 +1014,19 @@ bool WiFiClientSecure_light::_connectSSL(const char* hostName) {
 
     // ============================================================
     // Start TLS connection, ALL
-    if (!br_ssl_client_reset(_sc.get(), hostName, 0)) break;
+    // When a session cache is attached, load the stored parameters and ask for an
+    // abbreviated handshake - the server falls back to a full handshake if it does
+    // not recognize the session id
+    bool resume = (_session && _session->session_id_len > 0);
+    if (resume) {
+      br_ssl_engine_set_session_parameters(_eng, _session);
+    }
+    if (!br_ssl_client_reset(_sc.get(), hostName, resume)) break;
 
     auto ret = _wait_for_handshake();
+    if (ret && _session) {
+      br_ssl_engine_get_session_parameters(_eng, _session);  // Store for next reconnect
+    }
   #ifdef DEBUG_ESP_SSL
     if (!ret) {
       DEBUG_BSSL("Couldn't connect. Error = %d\n", getLastError());
@@ -105,6 +105,13 @@ class WiFiClientSecure_light : public WiFiClient {
       _alpn_num = num;
     }
 
+    void setSession(br_ssl_session_parameters *session) {
+      // Attach a caller-owned session parameter cache. When set, the handshake offers the
+      // cached session id for abbreviated resumption and stores the negotiated parameters
+      // back after every successful full handshake. Must stay valid for the client lifetime.
+      _session = session;
+    }
+
     // Sets the requested buffer size for transmit and receive
     void setBufferSizes(int recv, int xmit);
 
@@ -186,6 +193,9 @@ class WiFiClientSecure_light : public WiFiClient {
     const char ** _alpn_names;
     size_t        _alpn_num;
 
+    // Cached TLS session parameters for abbreviated resumption, caller-owned
+    br_ssl_session_parameters *_session;
+
 };
 
 #define ERR_OOM             -1000
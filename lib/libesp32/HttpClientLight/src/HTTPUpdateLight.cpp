@@ -33,6 +33,10 @@
 extern void AddLog(uint32_t loglevel, PGM_P formatP, ...);
 enum LoggingLevels {LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG, LOG_LEVEL_DEBUG_MORE};
 
+#ifndef OTA_RANGE_RESUME_ATTEMPTS
+#define OTA_RANGE_RESUME_ATTEMPTS 4     // Reconnects with a Range request before giving up on a broken download
+#endif
+
 // To do extern "C" uint32_t _SPIFFS_start;
 // To do extern "C" uint32_t _SPIFFS_end;
 
@@ -242,8 +246,9 @@ HTTPUpdateResult HTTPUpdateLight::handleUpdate(HTTPClientLight& http, const Stri
         AddLog(LOG_LEVEL_INFO, "OTA: Connection error %d after %d ms", code, millis() - http_connect_time);
       }
     } else {
+      _connectTimeMs = millis() - http_connect_time;
       AddLog(LOG_LEVEL_DEBUG, PSTR("OTA: Connected in %d ms, stack low mark %d"),
-        millis() - http_connect_time, uxTaskGetStackHighWaterMark(nullptr));
+        _connectTimeMs, uxTaskGetStackHighWaterMark(nullptr));
     }
 
     if(code <= 0) {
@@ -357,9 +362,12 @@ HTTPUpdateResult HTTPUpdateLight::handleUpdate(HTTPClientLight& http, const Stri
                     }
 */
                 }
-                if(runUpdate(*tcp, len, http.header("x-MD5"), command)) {
+                if(runUpdate(http, len, http.header("x-MD5"), command)) {
                     ret = HTTP_UPDATE_OK;
                     log_d("Update ok\n");
+                    // Per-phase timing so slow upgrades can be attributed to network or flash
+                    AddLog(LOG_LEVEL_INFO, PSTR("OTA: %d bytes in %u ms (connect %u ms, flash %u ms, stalled on flash %u ms), %d resume(s)"),
+                      len, _downloadTimeMs, _connectTimeMs, TasUpdate.flashOpMs(), TasUpdate.flashWaitMs(), _resumeCount);
                     http.end();
                     // Warn main app we're all done
                     if (_cbEnd) {
@@ -407,12 +415,12 @@ HTTPUpdateResult HTTPUpdateLight::handleUpdate(HTTPClientLight& http, const Stri
 
 /**
  * write Update to flash
- * @param in Stream&
+ * @param http HTTPClientLight& connected client delivering the image
  * @param size uint32_t
  * @param md5 String
  * @return true if Update ok
  */
-bool HTTPUpdateLight::runUpdate(Stream& in, uint32_t size, String md5, int command)
+bool HTTPUpdateLight::runUpdate(HTTPClientLight& http, uint32_t size, String md5, int command)
 {
 
     StreamString error;
@@ -446,13 +454,46 @@ bool HTTPUpdateLight::runUpdate(Stream& in, uint32_t size, String md5, int comma
 
 // To do: the SHA256 could be checked if the server sends it
 
-    if(TasUpdate.writeStream(in) != size) {
+    WiFiClient * tcp = http.getStreamPtr();
+    uint32_t download_start = millis();
+    _resumeCount = 0;
+
+    for(;;) {
+        TasUpdate.writeStream(*tcp);
+        if(TasUpdate.streamOffset() >= size) {
+            break;
+        }
+        if((UPDATE_ERROR_STREAM == TasUpdate.getError()) && (_resumeCount < OTA_RANGE_RESUME_ATTEMPTS)) {
+            // The connection died mid transfer - reconnect and ask the server
+            // for the remainder of the image instead of starting over
+            _resumeCount++;
+            uint32_t offset = TasUpdate.streamOffset();
+            AddLog(LOG_LEVEL_INFO, PSTR("OTA: Connection lost at %u of %u bytes, resume attempt %d"), offset, size, _resumeCount);
+            tcp->stop();            // force a fresh connection, http.end() would release the transport
+            char range[32];
+            snprintf(range, sizeof(range), "bytes=%u-", offset);
+            http.addHeader("Range", range);   // replaces the previous Range header
+            int code = http.GET();
+            if((HTTP_CODE_PARTIAL_CONTENT != code) || (http.getSize() != (int)(size - offset))) {
+                AddLog(LOG_LEVEL_INFO, PSTR("OTA: Resume refused (code %d, len %d)"), code, http.getSize());
+                _lastError = UPDATE_ERROR_STREAM;
+                TasUpdate.abort();
+                return false;
+            }
+            TasUpdate.resumeStream();
+            tcp = http.getStreamPtr();
+            continue;
+        }
         _lastError = TasUpdate.getError();
         TasUpdate.printError(error);
         error.trim(); // remove line ending
         log_e("TasUpdate.writeStream failed! (%s)\n", error.c_str());
+        if(TasUpdate.isRunning()) {
+            TasUpdate.abort();    // a stream error leaves the update resumable
+        }
         return false;
     }
+    _downloadTimeMs = millis() - download_start;
 
     if (_cbProgress) {
         _cbProgress(size, size);
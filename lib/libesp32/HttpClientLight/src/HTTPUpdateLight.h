@@ -116,7 +116,7 @@ public:
 
 protected:
     t_httpUpdate_return handleUpdate(HTTPClientLight& http, const String& currentVersion, bool spiffs = false);
-    bool runUpdate(Stream& in, uint32_t size, String md5, int command = U_FLASH);
+    bool runUpdate(HTTPClientLight& http, uint32_t size, String md5, int command = U_FLASH);
 
     // Set the error and potentially use a CB to notify the application
     void _setLastError(int err) {
@@ -142,6 +142,11 @@ private:
 // Start Tasmota Factory patch
     bool _factory;
 // End Tasmota Factory patch
+
+    // Per-phase timing collected during handleUpdate()/runUpdate()
+    uint32_t _connectTimeMs = 0;
+    uint32_t _downloadTimeMs = 0;
+    int _resumeCount = 0;
 };
 
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_HTTPUPDATE)
@@ -102,6 +102,13 @@ class TasUpdateClass {
     */
     void md5(uint8_t * result){ return _md5.getBytes(result); }
 
+    /*
+      Clears a stream read timeout so writeStream() can be called again
+      with a reconnected stream continuing at streamOffset()
+      Returns false if the update is not in a resumable state
+    */
+    bool resumeStream();
+
     //Helpers
     uint8_t getError(){ return _error; }
     void clearError(){ _error = UPDATE_ERROR_OK; }
@@ -111,6 +118,9 @@ class TasUpdateClass {
     size_t size(){ return _size; }
     size_t progress(){ return _progress; }
     size_t remaining(){ return _size - _progress; }
+    size_t streamOffset(){ return _progress + _bufferLen; }  // bytes consumed from the stream including those not yet flashed
+    uint32_t flashOpMs(){ return _flashOpMs; }               // time spent erasing and writing flash
+    uint32_t flashWaitMs(){ return _flashWaitMs; }           // time the stream reader was stalled waiting for flash
 
     /*
       Template to write from objects that expose
@@ -169,12 +179,29 @@ class TasUpdateClass {
     bool _verifyHeader(uint8_t data);
     bool _verifyEnd();
     bool _enablePartition(const esp_partition_t* partition);
+    bool _startFlashTask();
+    void _stopFlashTask();
+    bool _flashWait();
+    static void _flashTaskLoop(void *arg);
 
 
     uint8_t _error;
     uint8_t *_buffer;
     uint8_t *_skipBuffer;
     size_t _bufferLen;
+    // Double buffered flash pipeline - a worker task erases and writes the
+    // previous sector while the caller keeps filling _buffer from the stream
+    TaskHandle_t _flashTask;
+    SemaphoreHandle_t _flashGo;
+    SemaphoreHandle_t _flashDone;
+    uint8_t *_flashBuffer;
+    size_t _flashLen;
+    uint32_t _flashOffset;
+    uint8_t _flashSkip;
+    volatile uint8_t _flashResult;
+    bool _flashPending;
+    uint32_t _flashOpMs;
+    uint32_t _flashWaitMs;
     size_t _size;
     THandlerFunction_Progress _progress_callback;
     uint32_t _progress;
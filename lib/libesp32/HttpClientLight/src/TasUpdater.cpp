@@ -71,6 +71,17 @@ TasUpdateClass::TasUpdateClass()
 , _paroffset(0)
 , _command(U_FLASH)
 , _partition(NULL)
+, _flashTask(NULL)
+, _flashGo(NULL)
+, _flashDone(NULL)
+, _flashBuffer(0)
+, _flashLen(0)
+, _flashOffset(0)
+, _flashSkip(0)
+, _flashResult(0)
+, _flashPending(false)
+, _flashOpMs(0)
+, _flashWaitMs(0)
 {
 }
 
@@ -79,7 +90,79 @@ TasUpdateClass& TasUpdateClass::onProgress(THandlerFunction_Progress fn) {
     return *this;
 }
 
+void TasUpdateClass::_flashTaskLoop(void *arg) {
+    TasUpdateClass *update = (TasUpdateClass *)arg;
+    for(;;) {
+        xSemaphoreTake(update->_flashGo, portMAX_DELAY);
+        uint32_t start = millis();
+        uint8_t result = UPDATE_ERROR_OK;
+        if(!ESP.partitionEraseRange(update->_partition, update->_flashOffset, SPI_FLASH_SEC_SIZE)){
+            result = UPDATE_ERROR_ERASE;
+        }
+        else if(!ESP.partitionWrite(update->_partition, update->_flashOffset + update->_flashSkip,
+                (uint32_t*)update->_flashBuffer + update->_flashSkip/sizeof(uint32_t), update->_flashLen - update->_flashSkip)) {
+            result = UPDATE_ERROR_WRITE;
+        }
+        update->_flashOpMs += millis() - start;
+        update->_flashResult = result;
+        xSemaphoreGive(update->_flashDone);
+    }
+}
+
+bool TasUpdateClass::_startFlashTask() {
+    _flashBuffer = (uint8_t*)malloc(SPI_FLASH_SEC_SIZE);
+    if(!_flashBuffer){
+        log_e("malloc failed");
+        return false;
+    }
+    if(!_flashGo){
+        _flashGo = xSemaphoreCreateBinary();
+        _flashDone = xSemaphoreCreateBinary();
+    }
+    if(!_flashGo || !_flashDone){
+        return false;
+    }
+    _flashPending = false;
+    _flashResult = UPDATE_ERROR_OK;
+    if(pdPASS != xTaskCreate(_flashTaskLoop, "tasupdate", 4096, this, 3, &_flashTask)){
+        _flashTask = NULL;
+        return false;
+    }
+    return true;
+}
+
+void TasUpdateClass::_stopFlashTask() {
+    if(_flashPending){
+        xSemaphoreTake(_flashDone, portMAX_DELAY);
+        _flashPending = false;
+    }
+    if(_flashTask){
+        vTaskDelete(_flashTask);
+        _flashTask = NULL;
+    }
+    if(_flashBuffer){
+        free(_flashBuffer);
+        _flashBuffer = 0;
+    }
+}
+
+bool TasUpdateClass::_flashWait() {
+    if(!_flashPending){
+        return true;
+    }
+    uint32_t start = millis();
+    xSemaphoreTake(_flashDone, portMAX_DELAY);
+    _flashWaitMs += millis() - start;
+    _flashPending = false;
+    if(_flashResult != UPDATE_ERROR_OK){
+        _abort(_flashResult);
+        return false;
+    }
+    return true;
+}
+
 void TasUpdateClass::_reset() {
+    _stopFlashTask();
     if (_buffer)
         delete[] _buffer;
     _buffer = 0;
@@ -178,6 +261,12 @@ bool TasUpdateClass::begin(size_t size, int command, int ledPin, uint8_t ledOn,
         log_e("malloc failed");
         return false;
     }
+    if(!_startFlashTask()){
+        _reset();
+        return false;
+    }
+    _flashOpMs = 0;
+    _flashWaitMs = 0;
     _size = size;
     _command = command;
     _md5.begin();
@@ -217,19 +306,20 @@ bool TasUpdateClass::_writeBuffer(){
     if (!_progress && _progress_callback) {
         _progress_callback(0, _size);
     }
-    if(!ESP.partitionEraseRange(_partition, _progress, SPI_FLASH_SEC_SIZE)){
-        _abort(UPDATE_ERROR_ERASE);
-        return false;
-    }
-    if (!ESP.partitionWrite(_partition, _progress + skip, (uint32_t*)_buffer + skip/sizeof(uint32_t), _bufferLen - skip)) {
-        _abort(UPDATE_ERROR_WRITE);
+    //wait until the previous sector has hit flash, then swap buffers and hand
+    //this one to the flash task so the stream can be read during erase/write
+    if(!_flashWait()){
         return false;
     }
-    //restore magic or md5 will fail
-    if(!_progress && _command == U_FLASH){
-        _buffer[0] = ESP_IMAGE_HEADER_MAGIC;
-    }
     _md5.add(_buffer, _bufferLen);
+    uint8_t *full = _buffer;
+    _buffer = _flashBuffer;
+    _flashBuffer = full;
+    _flashOffset = _progress;
+    _flashLen = _bufferLen;
+    _flashSkip = skip;
+    _flashPending = true;
+    xSemaphoreGive(_flashGo);
     _progress += _bufferLen;
     _bufferLen = 0;
     if (_progress_callback) {
@@ -271,6 +361,14 @@ bool TasUpdateClass::_verifyEnd() {
     return false;
 }
 
+bool TasUpdateClass::resumeStream(){
+    if(UPDATE_ERROR_STREAM != _error || !isRunning()){
+        return false;
+    }
+    _error = UPDATE_ERROR_OK;
+    return true;
+}
+
 bool TasUpdateClass::setMD5(const char * expected_md5){
     if(strlen(expected_md5) != 32)
     {
@@ -298,6 +396,11 @@ bool TasUpdateClass::end(bool evenIfRemaining){
         _size = progress();
     }
 
+    //drain the flash pipeline before verifying
+    if(!_flashWait()){
+        return false;
+    }
+
     _md5.calculate();
     if(_target_md5.length()) {
         if(_target_md5 != _md5.toString()){
@@ -348,7 +451,9 @@ size_t TasUpdateClass::writeStream(Stream &data) {
     if(hasError() || !isRunning())
         return 0;
 
-    if(!_verifyHeader(data.peek())) {
+    //only check the image magic at the very start - on a resumed stream the
+    //first byte is whatever file offset the transfer continues at
+    if(!streamOffset() && !_verifyHeader(data.peek())) {
         _reset();
         return 0;
     }
@@ -377,7 +482,9 @@ size_t TasUpdateClass::writeStream(Stream &data) {
             if(toRead == 0) {
                 timeout_failures++;
                 if (timeout_failures >= 300) {
-                    _abort(UPDATE_ERROR_STREAM);
+                    //keep the update state intact so the caller can reconnect
+                    //the stream and resume at streamOffset()
+                    _error = UPDATE_ERROR_STREAM;
                     return written;
                 }
                 delay(100);
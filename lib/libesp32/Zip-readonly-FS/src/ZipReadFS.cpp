@@ -96,27 +96,78 @@ public:
 
 class ZipArchive {
 public:
-  ZipArchive(File * _f) :
-    f(_f), entries()
+  ZipArchive(File * _f, LList<ZipEntry> * _entries) :
+    f(_f), entries(_entries)
     {};
-  ~ZipArchive(void) {
-    f->close();      // TODO
-  }
 
   bool parse(void);
 
   File * f;
-  LList<ZipEntry> entries;
+  LList<ZipEntry> * entries;
 };
 
 class ZipEntryFileImpl : public FileImpl {
 public:
-  ZipEntryFileImpl(File * f) : zip(f) { }
+  ZipEntryFileImpl(File * f) : zip(f, &zip_entries) { }
 
 protected:
+  LList<ZipEntry> zip_entries;
   ZipArchive zip;
 };
 
+/********************************************************************
+** Archive index cache
+**
+** open() and exists() used to re-parse all archive headers from flash
+** on every call; with dozens of Berry imports at start-up this reads
+** the same headers again and again. Keep the parsed entry list of the
+** last archives and revalidate cheaply with file size and mtime.
+********************************************************************/
+
+#ifndef ZIP_INDEX_CACHE_SIZE
+#define ZIP_INDEX_CACHE_SIZE  2       // number of parsed archive indexes kept in RAM
+#endif
+
+class ZipIndexCache {
+public:
+  ZipIndexCache() : path(), file_size(0), last_write(0), entries() {};
+
+  String path;                  // path of the archive in the underlying FS, "" = unused
+  uint32_t file_size;           // size when parsed, for revalidation
+  time_t last_write;            // mtime when parsed, for revalidation
+  LList<ZipEntry> entries;
+};
+
+static ZipIndexCache zip_index_cache[ZIP_INDEX_CACHE_SIZE];
+static uint32_t zip_index_cache_rr = 0;   // next slot to reuse
+
+// Return the parsed entry list for the archive already opened as `zipfile`,
+// parsing it only when not cached or when the file changed.
+// Returns nullptr if the archive could not be parsed.
+static LList<ZipEntry> * ZipArchiveIndex(File * zipfile, const char * path) {
+  uint32_t file_size = zipfile->size();
+  time_t last_write = zipfile->getLastWrite();
+  for (uint32_t i = 0; i < ZIP_INDEX_CACHE_SIZE; i++) {
+    ZipIndexCache & slot = zip_index_cache[i];
+    if ((slot.path == path) && (slot.file_size == file_size) && (slot.last_write == last_write)) {
+      return &slot.entries;
+    }
+  }
+  ZipIndexCache & slot = zip_index_cache[zip_index_cache_rr];
+  zip_index_cache_rr = (zip_index_cache_rr + 1) % ZIP_INDEX_CACHE_SIZE;
+  slot.path = "";
+  slot.entries.reset();
+  ZipArchive zip_archive = ZipArchive(zipfile, &slot.entries);
+  if (!zip_archive.parse()) {
+    slot.entries.reset();       // don't keep a partial index of a broken archive
+    return nullptr;
+  }
+  slot.path = path;
+  slot.file_size = file_size;
+  slot.last_write = last_write;
+  return &slot.entries;
+}
+
 /********************************************************************
 ** Neutral file overlay
 **
@@ -214,6 +265,10 @@ protected:
 class ZipItemImpl;
 typedef std::shared_ptr<ZipItemImpl> ZipItemImplPtr;
 
+#ifndef ZIP_READAHEAD_SIZE
+#define ZIP_READAHEAD_SIZE  512       // read-ahead block serving the small sequential reads of Berry imports
+#endif
+
 class ZipItemImpl : public FileImpl {
 public:
 
@@ -223,9 +278,14 @@ public:
     _len = len;
     _seek = 0;
     _last_mod = last_mod;
+    _cache = (uint8_t*) malloc(ZIP_READAHEAD_SIZE);   // if it fails, reads fall back to flash
+    _cache_start = 0;
+    _cache_len = 0;
   }
 
-  virtual ~ZipItemImpl() {}
+  virtual ~ZipItemImpl() {
+    free(_cache);
+  }
 
   size_t write(const uint8_t *buf, size_t size) {
     return 0;   // not accepted
@@ -233,21 +293,41 @@ public:
 
   size_t read(uint8_t* buf, size_t size) {
     // AddLog(LOG_LEVEL_DEBUG, "ZIP: read bytes=%i seek=%i len=%i", size, _seek, _len);
-    if (_seek < _len) {
-      if (size + _seek > _len) {
-        size = _len - _seek;  // always > 0 because of guarding test
-      }
-      bool bret = _f.seek(_first_byte + _seek, SeekSet);
-      // AddLog(LOG_LEVEL_DEBUG, "ZIP: seek_ret ret=%i zip_seek=%i", bret, _first_byte + _seek);
-      if (bret) {
-        size_t ret = _f.read(buf, size);
-        // AddLog(LOG_LEVEL_DEBUG, "ZIP: read done ret=%i zip_seek=%i", ret, size);
+    if (_seek >= _len) { return 0; }
+    if (size + _seek > _len) {
+      size = _len - _seek;  // always > 0 because of guarding test
+    }
+    size_t read_total = 0;
+    while (size > 0) {
+      if ((_cache != nullptr) && (_seek >= _cache_start) && (_seek < _cache_start + _cache_len)) {
+        // serve from the read-ahead cache
+        uint32_t offset = _seek - _cache_start;
+        uint32_t chunk = _cache_len - offset;
+        if (chunk > size) { chunk = size; }
+        memcpy(buf + read_total, _cache + offset, chunk);
+        _seek += chunk;
+        read_total += chunk;
+        size -= chunk;
+      } else if ((_cache == nullptr) || (size >= ZIP_READAHEAD_SIZE)) {
+        // large read, not worth going through the cache
+        if (!_f.seek(_first_byte + _seek, SeekSet)) { break; }
+        size_t ret = _f.read(buf + read_total, size);
+        if (ret == 0) { break; }
         _seek += ret;
-        if (_seek > _len) { _seek = _len; }
-        return ret;
+        read_total += ret;
+        size -= ret;
+      } else {
+        // refill the read-ahead cache from the current position
+        uint32_t fill = _len - _seek;
+        if (fill > ZIP_READAHEAD_SIZE) { fill = ZIP_READAHEAD_SIZE; }
+        if (!_f.seek(_first_byte + _seek, SeekSet)) { break; }
+        size_t ret = _f.read(_cache, fill);
+        if (ret == 0) { break; }
+        _cache_start = _seek;
+        _cache_len = ret;
       }
     }
-    return 0;   // abort
+    return read_total;
   }
 
   void flush() {
@@ -344,6 +424,9 @@ protected:
   uint32_t  _len;
   uint32_t  _seek;
   time_t    _last_mod;
+  uint8_t * _cache;         // read-ahead buffer of ZIP_READAHEAD_SIZE bytes, or nullptr
+  uint32_t  _cache_start;   // offset (relative to _first_byte) of the first cached byte
+  uint32_t  _cache_len;     // number of valid bytes in the cache
 };
 
 /********************************************************************
@@ -419,7 +502,7 @@ bool ZipArchive::parse(void) {
     }
     offset += zip_header_size + header.filename_size + header.extra_field_size;
 
-    ZipEntry & entry = entries.addToLast();
+    ZipEntry & entry = entries->addToLast();
     entry.file_name = fname_suffix;
     entry.file_start = offset;
     entry.file_len = header.size_uncompressed;
@@ -483,10 +566,12 @@ FileImplPtr ZipReadFSImpl::open(const char* path, const char* mode, const bool c
     File zipfile = fs->open(prefix, "r", false);
     if ((bool)zipfile) {
       // we could read the file
-      ZipArchive zip_archive = ZipArchive(&zipfile);
-      zip_archive.parse();
+      LList<ZipEntry> * entries = ZipArchiveIndex(&zipfile, prefix);
+      if (entries == nullptr) {
+        return ZipReadFileImplPtr();  // return an error
+      }
 
-      for (auto & entry : zip_archive.entries) {
+      for (auto & entry : *entries) {
         if (entry.file_name.equals(suffix)) {
           // found
           // AddLog(LOG_LEVEL_DEBUG, "ZIP: file '%s' in archive (start=%i - len=%i - last_mod=%i)", suffix, entry.file_start, entry.file_len, entry.last_mod);
@@ -521,12 +606,12 @@ bool ZipReadFSImpl::exists(const char* path) {
     File zipfile = fs->open(prefix, "r", false);
     if ((bool)zipfile) {
       // we could read the file
-      ZipArchive zip_archive = ZipArchive(&zipfile);
-      zip_archive.parse();
-
-      for (auto & entry : zip_archive.entries) {
-        if (entry.file_name.equals(suffix)) {
-          return true;
+      LList<ZipEntry> * entries = ZipArchiveIndex(&zipfile, prefix);
+      if (entries != nullptr) {
+        for (auto & entry : *entries) {
+          if (entry.file_name.equals(suffix)) {
+            return true;
+          }
         }
       }
     }
@@ -50,9 +50,13 @@ be_extern_native_module(animate);
 be_extern_native_module(partition_core);
 be_extern_native_module(crc);
 be_extern_native_module(crypto);
+be_extern_native_module(profiler);
 be_extern_native_module(ULP);
 be_extern_native_module(TFL);
 be_extern_native_module(mdns);
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+be_extern_native_module(kvstore);
+#endif // USE_KVSTORE
 #ifdef USE_ZIGBEE
 be_extern_native_module(zigbee);
 be_extern_native_module(matter_zigbee);
@@ -178,6 +182,7 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
     &be_native_module(partition_core),
     &be_native_module(crc),
     &be_native_module(crypto),
+    &be_native_module(profiler),
 #if defined(USE_BERRY_ULP) && defined(CONFIG_ULP_COPROC_ENABLED)
     &be_native_module(ULP),
 #endif // USE_BERRY_ULP
@@ -194,6 +199,9 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
 #ifdef USE_DISCOVERY
     &be_native_module(mdns),
 #endif // USE_DISCOVERY
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+    &be_native_module(kvstore),
+#endif // USE_KVSTORE
 #ifdef USE_MATTER_DEVICE
     &be_native_module(matter),
 #endif // USE_MATTER_DEVICE
@@ -35,6 +35,83 @@ re.split = def (regex_str, str) end # native
 
 extern const bclass be_class_re_pattern;
 
+/********************************************************************
+ * Cache of compiled programs for the one-shot module functions.
+ *
+ * `re.match`/`re.search`/`re.split` taking a pattern string recompile
+ * it on every call, which is wasteful when the same few patterns are
+ * matched against a stream of lines. Keep the last BE_RE_CACHE_SIZE
+ * compiled programs keyed by a hash of the pattern string (round-robin
+ * eviction), so steady-state matching never lexes the regex again.
+ * `re.compile` still returns a standalone `re_pattern` instance owning
+ * its own program.
+ *******************************************************************/
+#ifndef BE_RE_CACHE_SIZE
+#define BE_RE_CACHE_SIZE 4
+#endif
+
+typedef struct {
+  char *pattern;        // copy of the pattern string, NULL if slot unused
+  uint32_t hash;        // fnv1a hash of pattern, cheap reject before strcmp
+  ByteProg *code;       // compiled program, owned by the cache
+} be_re_cache_entry;
+
+static be_re_cache_entry be_re_cache[BE_RE_CACHE_SIZE];
+static uint8_t be_re_cache_next;    // round-robin eviction cursor
+
+static uint32_t be_re_hash(const char *s) {
+  uint32_t hash = 0x811C9DC5;       // fnv1a
+  while (*s) {
+    hash ^= (uint8_t)*s++;
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+// Returns the compiled program for `regex_str`, compiling and caching it
+// on a miss. The program is owned by the cache, callers must not free it.
+static ByteProg *be_re_cache_compile(bvm *vm, const char *regex_str) {
+  uint32_t hash = be_re_hash(regex_str);
+  for (uint32_t i = 0; i < BE_RE_CACHE_SIZE; i++) {
+    if (be_re_cache[i].pattern && (be_re_cache[i].hash == hash) && (strcmp(be_re_cache[i].pattern, regex_str) == 0)) {
+      return be_re_cache[i].code;
+    }
+  }
+
+  int sz = re1_5_sizecode(regex_str);
+  if (sz < 0) {
+    be_raise(vm, "internal_error", "error in regex");
+  }
+  ByteProg *code = be_os_malloc(sizeof(ByteProg) + sz);
+  if (code == NULL) {
+    be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
+  }
+  int ret = re1_5_compilecode(code, regex_str);
+  if (ret != 0) {
+    be_os_free(code);
+    be_raise(vm, "internal_error", "error in regex");
+  }
+
+  size_t pattern_len = strlen(regex_str) + 1;
+  char *pattern = be_os_malloc(pattern_len);
+  if (pattern == NULL) {
+    be_os_free(code);
+    be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
+  }
+  memcpy(pattern, regex_str, pattern_len);
+
+  be_re_cache_entry *slot = &be_re_cache[be_re_cache_next];
+  be_re_cache_next = (be_re_cache_next + 1) % BE_RE_CACHE_SIZE;
+  if (slot->pattern) {              // evict the oldest entry
+    be_os_free(slot->pattern);
+    be_os_free(slot->code);
+  }
+  slot->pattern = pattern;
+  slot->hash = hash;
+  slot->code = code;
+  return code;
+}
+
 // Native functions be_const_func()
 // Berry: `re.compile(pattern:string) -> instance(be_pattern)`
 int be_re_compile(bvm *vm) {
@@ -111,22 +188,8 @@ int be_re_match_search(bvm *vm, bbool is_anchored, bbool size_only) {
     if (offset >= hay_len) { be_return_nil(vm); }      // any match of empty string returns nil, this catches implicitly when hay_len == 0
     hay += offset;                  // shift to offset
 
-    int sz = re1_5_sizecode(regex_str);
-    if (sz < 0) {
-      be_raise(vm, "internal_error", "error in regex");
-    }
-
-    ByteProg *code = be_os_malloc(sizeof(ByteProg) + sz);
-    if (code == NULL) {
-      be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-    }
-    int ret = re1_5_compilecode(code, regex_str);
-    if (ret != 0) {
-      be_os_free(code);
-      be_raise(vm, "internal_error", "error in regex");
-    }
+    ByteProg *code = be_re_cache_compile(vm, regex_str);
     be_re_match_search_run(vm, code, hay, is_anchored, size_only);
-    be_os_free(code);
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -141,20 +204,7 @@ int be_re_match_search_all(bvm *vm, bbool is_anchored) {
     if (argc >= 3) {
       limit = be_toint(vm, 3);
     }
-    int sz = re1_5_sizecode(regex_str);
-    if (sz < 0) {
-      be_raise(vm, "internal_error", "error in regex");
-    }
-
-    ByteProg *code = be_os_malloc(sizeof(ByteProg) + sz);
-    if (code == NULL) {
-      be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-    }
-    int ret = re1_5_compilecode(code, regex_str);
-    if (ret != 0) {
-      be_os_free(code);
-      be_raise(vm, "internal_error", "error in regex");
-    }
+    ByteProg *code = be_re_cache_compile(vm, regex_str);
 
     be_newobject(vm, "list");
     for (int i = limit; i != 0 && hay != NULL; i--) {
@@ -165,7 +215,6 @@ int be_re_match_search_all(bvm *vm, bbool is_anchored) {
       be_pop(vm, 1);
     }
     be_pop(vm, 1);
-    be_os_free(code);
     be_return(vm);
   }
   be_raise(vm, "type_error", NULL);
@@ -336,23 +385,8 @@ int be_re_split(bvm *vm) {
     if (argc >= 3) {
       split_limit = be_toint(vm, 3);
     }
-    int sz = re1_5_sizecode(regex_str);
-    if (sz < 0) {
-      be_raise(vm, "internal_error", "error in regex");
-    }
-
-    ByteProg *code = be_os_malloc(sizeof(ByteProg) + sz);
-    if (code == NULL) {
-      be_throw(vm, BE_MALLOC_FAIL);   /* lack of heap space */
-    }
-    int ret = re1_5_compilecode(code, regex_str);
-    if (ret != 0) {
-      be_os_free(code);
-      be_raise(vm, "internal_error", "error in regex");
-    }
-    ret = re_pattern_split_run(vm, code, hay, split_limit);
-    be_os_free(code);
-    return ret;
+    ByteProg *code = be_re_cache_compile(vm, regex_str);
+    return re_pattern_split_run(vm, code, hay, split_limit);
   }
   be_raise(vm, "type_error", NULL);
 }
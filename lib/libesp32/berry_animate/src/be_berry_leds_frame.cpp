@@ -133,6 +133,114 @@ extern "C" {
     be_raise(vm, "type_error", nullptr);
   }
 
+  // Compute the position (0..255) of each palette slot.
+  // Handles both palette formats: explicit values 0..255 (first V is 0)
+  // or per-slot tick counts (first V is non-zero)
+  static void be_leds_palette_positions(const uint8_t * palette, size_t slots, uint8_t * positions) {
+    if (palette[0] != 0) {
+      // palette in tick counts, positions are the cumulated ticks scaled to 0..255
+      uint32_t total_ticks = 0;
+      for (size_t i = 0; i < slots - 1; i++) {
+        total_ticks += palette[i * 4];
+      }
+      uint32_t cur_ticks = 0;
+      for (size_t i = 0; i < slots; i++) {
+        positions[i] = changeUIntScale(cur_ticks, 0, total_ticks, 0, 255);
+        cur_ticks += palette[i * 4];
+      }
+    } else {
+      // palette is in value range from 0..255
+      for (size_t i = 0; i < slots; i++) {
+        positions[i] = palette[i * 4];
+      }
+    }
+  }
+
+  // Interpolate the palette color at position `pos` (0..255), returns `0xRRGGBB`
+  // Applies brightness `bri` 0..255 (255 = no change)
+  static uint32_t be_leds_palette_interpolate(const uint8_t * palette, const uint8_t * positions, size_t slots, uint32_t pos, uint32_t bri) {
+    // find slot, same search as Animate_palette.animate()
+    uint32_t idx = slots - 2;
+    while ((idx > 0) && (pos < positions[idx])) { idx--; }
+    const uint8_t * s0 = palette + idx * 4;         // VRGB
+    const uint8_t * s1 = s0 + 4;
+    uint32_t r = changeUIntScale(pos, positions[idx], positions[idx + 1], s0[1], s1[1]);
+    uint32_t g = changeUIntScale(pos, positions[idx], positions[idx + 1], s0[2], s1[2]);
+    uint32_t b = changeUIntScale(pos, positions[idx], positions[idx + 1], s0[3], s1[3]);
+    if (bri != 255) {
+      r = changeUIntScale(r, 0, 255, 0, bri);
+      g = changeUIntScale(g, 0, 255, 0, bri);
+      b = changeUIntScale(b, 0, 255, 0, bri);
+    }
+    return (r << 16) | (g << 8) | b;
+  }
+
+  #define BE_LEDS_PALETTE_MAX_SLOTS 64
+
+  // Leds_frame.palette_color(palette:bytes(), pos:int 0..255, bri:int 0..255 (opt)) -> int
+  //
+  // Native palette lookup, returns the interpolated color at `pos` as `0xRRGGBB`
+  int32_t be_leds_palette_color(bvm *vm);
+  int32_t be_leds_palette_color(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 2 && be_isbytes(vm, 1) && be_isint(vm, 2)) {
+      size_t pal_len = 0;
+      const uint8_t * palette = (const uint8_t*) be_tobytes(vm, 1, &pal_len);
+      uint32_t pos = be_toint(vm, 2) & 0xFF;
+      uint32_t bri = 255;
+      if (top >= 3 && be_isint(vm, 3)) {
+        bri = be_toint(vm, 3) & 0xFF;
+      }
+      size_t slots = pal_len / 4;
+      if ((slots >= 2) && (slots <= BE_LEDS_PALETTE_MAX_SLOTS)) {
+        uint8_t positions[BE_LEDS_PALETTE_MAX_SLOTS];
+        be_leds_palette_positions(palette, slots, positions);
+        be_pushint(vm, be_leds_palette_interpolate(palette, positions, slots, pos, bri));
+        be_return(vm);
+      }
+      be_raise(vm, "value_error", "invalid palette");
+    }
+    be_raise(vm, "type_error", nullptr);
+  }
+
+  // Leds_frame.gradient_pixels(dest:bytes(), palette:bytes(), offset:int 0..255 (opt), bri:int 0..255 (opt)) -> nil
+  //
+  // Fill the frame with the palette gradient, one full palette cycle spread
+  // over the strip. `offset` rotates the gradient, 256 steps for a full cycle,
+  // so animating `offset` with an oscillator scrolls the palette natively
+  // without any per-pixel work in the Berry VM.
+  int32_t be_leds_gradient_pixels(bvm *vm);
+  int32_t be_leds_gradient_pixels(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 2 && be_isbytes(vm, 2)) {
+      size_t dest_len = 0;
+      uint32_t * dest_buf = (uint32_t*) be_tobytes(vm, 1, &dest_len);
+      size_t pal_len = 0;
+      const uint8_t * palette = (const uint8_t*) be_tobytes(vm, 2, &pal_len);
+      uint32_t offset = 0;
+      if (top >= 3 && be_isint(vm, 3)) {
+        offset = be_toint(vm, 3) & 0xFF;
+      }
+      uint32_t bri = 255;
+      if (top >= 4 && be_isint(vm, 4)) {
+        bri = be_toint(vm, 4) & 0xFF;
+      }
+      size_t slots = pal_len / 4;
+      if ((slots >= 2) && (slots <= BE_LEDS_PALETTE_MAX_SLOTS)) {
+        uint8_t positions[BE_LEDS_PALETTE_MAX_SLOTS];
+        be_leds_palette_positions(palette, slots, positions);
+        size_t pixels_count = dest_len / 4;
+        for (size_t i = 0; i < pixels_count; i++) {
+          uint32_t pos = (changeUIntScale(i, 0, pixels_count - 1, 0, 255) + offset) & 0xFF;
+          dest_buf[i] = be_leds_palette_interpolate(palette, positions, slots, pos, bri);
+        }
+        be_return_nil(vm);
+      }
+      be_raise(vm, "value_error", "invalid palette");
+    }
+    be_raise(vm, "type_error", nullptr);
+  }
+
   // Leds_frame.paste_pixels(neopixel:bytes(), led_buffer:bytes(), bri:int 0..100, gamma:bool)
   //
   // Copy from ARGB buffer to RGB
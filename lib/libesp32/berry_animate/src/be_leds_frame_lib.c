@@ -12,6 +12,8 @@ extern int be_leds_blend(bvm *vm);
 extern int be_leds_blend_pixels(bvm *vm);
 extern int be_leds_fill_pixels(bvm *vm);
 extern int be_leds_paste_pixels(bvm *vm);
+extern int be_leds_palette_color(bvm *vm);
+extern int be_leds_gradient_pixels(bvm *vm);
 
 BE_EXPORT_VARIABLE extern const bclass be_class_bytes;
 
@@ -29,9 +31,11 @@ class be_class_Leds_frame (scope: global, name: Leds_frame, super:be_class_bytes
 
   // the following are on buffers
   blend, static_func(be_leds_blend)
+  palette_color, static_func(be_leds_palette_color)
   fill_pixels, func(be_leds_fill_pixels)
   blend_pixels, func(be_leds_blend_pixels)
   paste_pixels, func(be_leds_paste_pixels)
+  gradient_pixels, func(be_leds_gradient_pixels)
 }
 @const_object_info_end */
 
@@ -131,6 +131,35 @@ int be_find_global_or_module_member(bvm *vm, const char * name) {
 }
 
 
+/*********************************************************************************************\
+ * Cache of successful instance type checks
+ *
+ * Checking an instance argument against an expected class name needs a global lookup
+ * (with string splitting) and a walk of the class hierarchy (`be_isderived`) on every
+ * call. Class hierarchies are immutable once defined, so a (class, expected type) pair
+ * that validated once will validate forever - remember the last few pairs and skip the
+ * expensive check on a hit. Only successful checks are cached and both names are stored
+ * verbatim, so a hash collision can never skip a check that would have failed.
+\*********************************************************************************************/
+#ifndef BE_TYPE_CHECK_CACHE_SIZE
+#define BE_TYPE_CHECK_CACHE_SIZE  16    // direct-mapped entries
+#endif
+#define BE_TYPE_CHECK_NAME_MAX    24    // longer names are simply not cached
+
+typedef struct be_type_check_cache_entry_t {
+  char class_name[BE_TYPE_CHECK_NAME_MAX];    // class of the instance argument, empty = free slot
+  char arg_type[BE_TYPE_CHECK_NAME_MAX];      // expected type it validated against
+} be_type_check_cache_entry_t;
+
+static be_type_check_cache_entry_t be_type_check_cache[BE_TYPE_CHECK_CACHE_SIZE] = {};
+
+static be_type_check_cache_entry_t * be_type_check_slot(const char *class_name, const char *arg_type) {
+  uint32_t hash = 5381;
+  for (const char *p = class_name; *p; p++) { hash = (hash * 33) ^ (uint8_t)*p; }
+  for (const char *p = arg_type; *p; p++)   { hash = (hash * 33) ^ (uint8_t)*p; }
+  return &be_type_check_cache[hash % BE_TYPE_CHECK_CACHE_SIZE];
+}
+
 /*********************************************************************************************\
  * Automatically parse Berry stack and call the C function accordingly
  * 
@@ -269,6 +298,11 @@ intptr_t be_convert_single_elt(bvm *vm, int idx, const char * arg_type, int *buf
 
       if (arg_type_len > 1) {
         // Check type
+        const char * class_name = be_classname(vm, idx);
+        be_type_check_cache_entry_t * entry = be_type_check_slot(class_name, arg_type);
+        if ((strcmp(class_name, entry->class_name) == 0) && (strcmp(arg_type, entry->arg_type) == 0)) {
+          return ret;           // this pair already validated successfully
+        }
         be_classof(vm, idx);
         int class_found = be_find_global_or_module_member(vm, arg_type);
         // Stack: class_of_idx, class_of_target (or nil)
@@ -280,6 +314,11 @@ intptr_t be_convert_single_elt(bvm *vm, int idx, const char * arg_type, int *buf
           be_raisef(vm, "value_error", "Unable to find class '%s' (%d)", arg_type, arg_type_len);
         }
         be_pop(vm, 2);
+        // validated - remember the pair for the next call
+        if ((strlen(class_name) < BE_TYPE_CHECK_NAME_MAX) && (strlen(arg_type) < BE_TYPE_CHECK_NAME_MAX)) {
+          strcpy(entry->class_name, class_name);
+          strcpy(entry->arg_type, arg_type);
+        }
       } else if (arg_type[0] != '.') {
         be_raisef(vm, "value_error", "Unexpected instance type '%s', expected '%s'", be_classname(vm, idx), arg_type);
       }
@@ -22,6 +22,7 @@
  * 
  *******************************************************************/
 
+#include <string.h>
 #include "be_constobj.h"
 #include "be_mapping.h"
 #include "IPAddress.h"
@@ -53,3 +54,62 @@ extern "C" const void* matter_get_ip_bytes(const char* ip_str, size_t* ret_len)
     return nullptr;
   }
 }
+
+/********************************************************************
+ * Native session lookup
+ *
+ * The session list is scanned for every incoming message; doing the
+ * scan in native code avoids the interpreted loop and the per-element
+ * member reads which dominate the hot path of the message handler.
+ *******************************************************************/
+
+// `matter.find_session_by_local_session_id(sessions:list, id:int) -> instance(Matter_Session) or nil`
+extern "C" int matter_find_session_by_local_session_id(bvm *vm) {
+  int32_t argc = be_top(vm);
+  if (argc >= 2 && be_isinstance(vm, 1) && be_isint(vm, 2)) {
+    int32_t id = be_toint(vm, 2);
+    be_getmember(vm, 1, ".p");              // get the underlying native list
+    int32_t sz = be_data_size(vm, -1);
+    for (int32_t i = 0; i < sz; i++) {
+      be_pushint(vm, i);
+      if (be_getindex(vm, -2) && be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, "local_session_id");
+        if (be_isint(vm, -1) && (be_toint(vm, -1) == id)) {
+          be_pop(vm, 1);
+          be_return(vm);                    // session instance on top
+        }
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 2);
+    }
+  }
+  be_return_nil(vm);
+}
+
+// `matter.find_session_by_source_node_id(sessions:list, nodeid:bytes) -> instance(Matter_Session) or nil`
+extern "C" int matter_find_session_by_source_node_id(bvm *vm) {
+  int32_t argc = be_top(vm);
+  if (argc >= 2 && be_isinstance(vm, 1) && be_isbytes(vm, 2)) {
+    size_t id_len;
+    const uint8_t *id_buf = (const uint8_t*) be_tobytes(vm, 2, &id_len);
+    be_getmember(vm, 1, ".p");              // get the underlying native list
+    int32_t sz = be_data_size(vm, -1);
+    for (int32_t i = 0; i < sz; i++) {
+      be_pushint(vm, i);
+      if (be_getindex(vm, -2) && be_isinstance(vm, -1)) {
+        be_getmember(vm, -1, "_source_node_id");
+        if (be_isbytes(vm, -1)) {
+          size_t len;
+          const uint8_t *buf = (const uint8_t*) be_tobytes(vm, -1, &len);
+          if ((len == id_len) && (memcmp(buf, id_buf, len) == 0)) {
+            be_pop(vm, 1);
+            be_return(vm);                  // session instance on top
+          }
+        }
+        be_pop(vm, 1);
+      }
+      be_pop(vm, 2);
+    }
+  }
+  be_return_nil(vm);
+}
@@ -205,6 +205,10 @@ BE_FUNC_CTYPE_DECLARE(matter_get_ip_bytes, "&", "s")
 
 extern int matter_publish_command(bvm *vm);
 
+// Native scan of the session list, see be_matter_misc.cpp
+extern int matter_find_session_by_local_session_id(bvm *vm);
+extern int matter_find_session_by_source_node_id(bvm *vm);
+
 #include "solidify/solidified_Matter_0_Inspect.h"
 
 extern const bclass be_class_Matter_TLV;   // need to declare it upfront because of circular reference
@@ -344,6 +348,8 @@ module matter (scope: global, strings: weak) {
   setmember, closure(module_matter_setmember_closure)
   member, closure(module_matter_member_closure)
   get_ip_bytes, ctype_func(matter_get_ip_bytes)
+  find_session_by_local_session_id, func(matter_find_session_by_local_session_id)
+  find_session_by_source_node_id, func(matter_find_session_by_source_node_id)
   publish_command, func(matter_publish_command)
 
   get_vendor_name, ctype_func(matter_get_vendor_name)
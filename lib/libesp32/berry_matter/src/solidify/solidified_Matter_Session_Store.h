@@ -3,8 +3,8 @@
 * Generated code, don't edit                                         *
 \********************************************************************/
 #include "be_constobj.h"
-// compact class 'Matter_Session_Store' ktab size: 73, total: 155 (saved 656 bytes)
-static const bvalue be_ktab_class_Matter_Session_Store[73] = {
+// compact class 'Matter_Session_Store' ktab size: 74, total: 153 (saved 632 bytes)
+static const bvalue be_ktab_class_Matter_Session_Store[74] = {
   /* K0   */  be_const_int(0),
   /* K1   */  be_nested_str_weak(sessions),
   /* K2   */  be_nested_str_weak(remove),
@@ -53,7 +53,7 @@ static const bvalue be_ktab_class_Matter_Session_Store[73] = {
   /* K45  */  be_nested_str_weak(set_expire_in_seconds),
   /* K46  */  be_nested_str_weak(get_session_by_source_node_id),
   /* K47  */  be_nested_str_weak(_source_node_id),
-  /* K48  */  be_nested_str_weak(local_session_id),
+  /* K48  */  be_nested_str_weak(find_session_by_local_session_id),
   /* K49  */  be_nested_str_weak(device),
   /* K50  */  be_nested_str_weak(every_second),
   /* K51  */  be_nested_str_weak(fabric_id),
@@ -61,23 +61,24 @@ static const bvalue be_ktab_class_Matter_Session_Store[73] = {
   /* K53  */  be_nested_str_weak(value_error),
   /* K54  */  be_nested_str_weak(must_X20be_X20of_X20class_X20matter_X2EFabric),
   /* K55  */  be_nested_str_weak(remove_redundant_fabric),
-  /* K56  */  be_nested_str_weak(fabric_index),
-  /* K57  */  be_nested_str_weak(int),
-  /* K58  */  be_nested_str_weak(path),
-  /* K59  */  be_nested_str_weak(_FABRICS_TEMP),
-  /* K60  */  be_nested_str_weak(w),
-  /* K61  */  be_nested_str_weak(write),
-  /* K62  */  be_nested_str_weak(_X5B),
-  /* K63  */  be_nested_str_weak(_X2C),
-  /* K64  */  be_nested_str_weak(writejson),
-  /* K65  */  be_nested_str_weak(_X5D),
-  /* K66  */  be_nested_str_weak(rename),
-  /* K67  */  be_nested_str_weak(MTR_X3A_X20_X3DSaved_X20_X20_X20_X20_X20_X25s_X20fabric_X28s_X29_X20and_X20_X25s_X20session_X28s_X29),
-  /* K68  */  be_nested_str_weak(event_fabrics_saved),
-  /* K69  */  be_nested_str_weak(MTR_X3A_X20Saving_X20Fabrics_X20failed),
-  /* K70  */  be_nested_str_weak(MTR_X3A_X20Session_Store_X3A_X3Asave_X20Exception_X3A),
-  /* K71  */  be_nested_str_weak(remove_session),
-  /* K72  */  be_nested_str_weak(_fabric),
+  /* K56  */  be_nested_str_weak(find_session_by_source_node_id),
+  /* K57  */  be_nested_str_weak(fabric_index),
+  /* K58  */  be_nested_str_weak(int),
+  /* K59  */  be_nested_str_weak(path),
+  /* K60  */  be_nested_str_weak(_FABRICS_TEMP),
+  /* K61  */  be_nested_str_weak(w),
+  /* K62  */  be_nested_str_weak(write),
+  /* K63  */  be_nested_str_weak(_X5B),
+  /* K64  */  be_nested_str_weak(_X2C),
+  /* K65  */  be_nested_str_weak(writejson),
+  /* K66  */  be_nested_str_weak(_X5D),
+  /* K67  */  be_nested_str_weak(rename),
+  /* K68  */  be_nested_str_weak(MTR_X3A_X20_X3DSaved_X20_X20_X20_X20_X20_X25s_X20fabric_X28s_X29_X20and_X20_X25s_X20session_X28s_X29),
+  /* K69  */  be_nested_str_weak(event_fabrics_saved),
+  /* K70  */  be_nested_str_weak(MTR_X3A_X20Saving_X20Fabrics_X20failed),
+  /* K71  */  be_nested_str_weak(MTR_X3A_X20Session_Store_X3A_X3Asave_X20Exception_X3A),
+  /* K72  */  be_nested_str_weak(remove_session),
+  /* K73  */  be_nested_str_weak(_fabric),
 };
 
 
@@ -750,7 +751,7 @@ be_local_closure(class_Matter_Session_Store_every_second,   /* name */
 ********************************************************************/
 be_local_closure(class_Matter_Session_Store_get_session_by_local_session_id,   /* name */
   be_nested_proto(
-    8,                          /* nstack */
+    6,                          /* nstack */
     2,                          /* argc */
     10,                          /* varg */
     0,                          /* has upvals */
@@ -761,29 +762,23 @@ be_local_closure(class_Matter_Session_Store_get_session_by_local_session_id,   /
     &be_ktab_class_Matter_Session_Store,     /* shared constants */
     be_str_weak(get_session_by_local_session_id),
     &be_const_str_solidified,
-    ( &(const binstruction[22]) {  /* code */
+    ( &(const binstruction[16]) {  /* code */
       0x4C080000,  //  0000  LDNIL	R2
       0x1C080202,  //  0001  EQ	R2	R1	R2
       0x780A0001,  //  0002  JMPF	R2	#0005
       0x4C080000,  //  0003  LDNIL	R2
       0x80040400,  //  0004  RET	1	R2
-      0x6008000C,  //  0005  GETGBL	R2	G12
-      0x880C0101,  //  0006  GETMBR	R3	R0	K1
-      0x7C080200,  //  0007  CALL	R2	1
-      0x580C0000,  //  0008  LDCONST	R3	K0
-      0x88100101,  //  0009  GETMBR	R4	R0	K1
-      0x14140602,  //  000A  LT	R5	R3	R2
-      0x78160008,  //  000B  JMPF	R5	#0015
-      0x94140803,  //  000C  GETIDX	R5	R4	R3
-      0x88180B30,  //  000D  GETMBR	R6	R5	K48
-      0x1C180C01,  //  000E  EQ	R6	R6	R1
-      0x781A0002,  //  000F  JMPF	R6	#0013
-      0x8C180B2C,  //  0010  GETMET	R6	R5	K44
-      0x7C180200,  //  0011  CALL	R6	1
-      0x80040A00,  //  0012  RET	1	R5
-      0x000C0703,  //  0013  ADD	R3	R3	K3
-      0x7001FFF4,  //  0014  JMP		#000A
-      0x80000000,  //  0015  RET	0
+      0xB80A1200,  //  0005  GETNGBL	R2	K9
+      0x8C080530,  //  0006  GETMET	R2	R2	K48
+      0x88100101,  //  0007  GETMBR	R4	R0	K1
+      0x5C140200,  //  0008  MOVE	R5	R1
+      0x7C080600,  //  0009  CALL	R2	3
+      0x4C0C0000,  //  000A  LDNIL	R3
+      0x200C0403,  //  000B  NE	R3	R2	R3
+      0x780E0001,  //  000C  JMPF	R3	#000F
+      0x8C0C052C,  //  000D  GETMET	R3	R2	K44
+      0x7C0C0200,  //  000E  CALL	R3	1
+      0x80040400,  //  000F  RET	1	R2
     })
   )
 );
@@ -952,7 +947,7 @@ be_local_closure(class_Matter_Session_Store_add_fabric,   /* name */
 ********************************************************************/
 be_local_closure(class_Matter_Session_Store_get_session_by_source_node_id,   /* name */
   be_nested_proto(
-    8,                          /* nstack */
+    6,                          /* nstack */
     2,                          /* argc */
     10,                          /* varg */
     0,                          /* has upvals */
@@ -963,29 +958,23 @@ be_local_closure(class_Matter_Session_Store_get_session_by_source_node_id,   /*
     &be_ktab_class_Matter_Session_Store,     /* shared constants */
     be_str_weak(get_session_by_source_node_id),
     &be_const_str_solidified,
-    ( &(const binstruction[22]) {  /* code */
+    ( &(const binstruction[16]) {  /* code */
       0x4C080000,  //  0000  LDNIL	R2
       0x1C080202,  //  0001  EQ	R2	R1	R2
       0x780A0001,  //  0002  JMPF	R2	#0005
       0x4C080000,  //  0003  LDNIL	R2
       0x80040400,  //  0004  RET	1	R2
-      0x6008000C,  //  0005  GETGBL	R2	G12
-      0x880C0101,  //  0006  GETMBR	R3	R0	K1
-      0x7C080200,  //  0007  CALL	R2	1
-      0x580C0000,  //  0008  LDCONST	R3	K0
-      0x88100101,  //  0009  GETMBR	R4	R0	K1
-      0x14140602,  //  000A  LT	R5	R3	R2
-      0x78160008,  //  000B  JMPF	R5	#0015
-      0x94140803,  //  000C  GETIDX	R5	R4	R3
-      0x88180B2F,  //  000D  GETMBR	R6	R5	K47
-      0x1C180C01,  //  000E  EQ	R6	R6	R1
-      0x781A0002,  //  000F  JMPF	R6	#0013
-      0x8C180B2C,  //  0010  GETMET	R6	R5	K44
-      0x7C180200,  //  0011  CALL	R6	1
-      0x80040A00,  //  0012  RET	1	R5
-      0x000C0703,  //  0013  ADD	R3	R3	K3
-      0x7001FFF4,  //  0014  JMP		#000A
-      0x80000000,  //  0015  RET	0
+      0xB80A1200,  //  0005  GETNGBL	R2	K9
+      0x8C080538,  //  0006  GETMET	R2	R2	K56
+      0x88100101,  //  0007  GETMBR	R4	R0	K1
+      0x5C140200,  //  0008  MOVE	R5	R1
+      0x7C080600,  //  0009  CALL	R2	3
+      0x4C0C0000,  //  000A  LDNIL	R3
+      0x200C0403,  //  000B  NE	R3	R2	R3
+      0x780E0001,  //  000C  JMPF	R3	#000F
+      0x8C0C052C,  //  000D  GETMET	R3	R2	K44
+      0x7C0C0200,  //  000E  CALL	R3	1
+      0x80040400,  //  000F  RET	1	R2
     })
   )
 );
@@ -1019,11 +1008,11 @@ be_local_closure(class_Matter_Session_Store_next_fabric_idx,   /* name */
       0xA802000C,  //  0007  EXBLK	0	#0015
       0x5C0C0400,  //  0008  MOVE	R3	R2
       0x7C0C0000,  //  0009  CALL	R3	0
-      0x88100738,  //  000A  GETMBR	R4	R3	K56
+      0x88100739,  //  000A  GETMBR	R4	R3	K57
       0x60140004,  //  000B  GETGBL	R5	G4
       0x5C180800,  //  000C  MOVE	R6	R4
       0x7C140200,  //  000D  CALL	R5	1
-      0x1C140B39,  //  000E  EQ	R5	R5	K57
+      0x1C140B3A,  //  000E  EQ	R5	R5	K58
       0x78160003,  //  000F  JMPF	R5	#0014
       0x28140801,  //  0010  GE	R5	R4	R1
       0x78160001,  //  0011  JMPF	R5	#0014
@@ -1058,18 +1047,18 @@ be_local_closure(class_Matter_Session_Store_save_fabrics,   /* name */
     &be_const_str_solidified,
     ( &(const binstruction[98]) {  /* code */
       0xA4061E00,  //  0000  IMPORT	R1	K15
-      0xA40A7400,  //  0001  IMPORT	R2	K58
+      0xA40A7600,  //  0001  IMPORT	R2	K59
       0xA802004D,  //  0002  EXBLK	0	#0051
       0x8C0C0126,  //  0003  GETMET	R3	R0	K38
       0x7C0C0200,  //  0004  CALL	R3	1
       0x580C0000,  //  0005  LDCONST	R3	K0
       0x58100000,  //  0006  LDCONST	R4	K0
       0x60140011,  //  0007  GETGBL	R5	G17
-      0x8818013B,  //  0008  GETMBR	R6	R0	K59
-      0x581C003C,  //  0009  LDCONST	R7	K60
+      0x8818013C,  //  0008  GETMBR	R6	R0	K60
+      0x581C003D,  //  0009  LDCONST	R7	K61
       0x7C140400,  //  000A  CALL	R5	2
-      0x8C180B3D,  //  000B  GETMET	R6	R5	K61
-      0x5820003E,  //  000C  LDCONST	R8	K62
+      0x8C180B3E,  //  000B  GETMET	R6	R5	K62
+      0x5820003F,  //  000C  LDCONST	R8	K63
       0x7C180400,  //  000D  CALL	R6	2
       0x60180010,  //  000E  GETGBL	R6	G16
       0x881C010B,  //  000F  GETMBR	R7	R0	K11
@@ -1094,10 +1083,10 @@ be_local_closure(class_Matter_Session_Store_save_fabrics,   /* name */
       0xB0080000,  //  0022  RAISE	2	R0	R0
       0x24200900,  //  0023  GT	R8	R4	K0
       0x78220002,  //  0024  JMPF	R8	#0028
-      0x8C200B3D,  //  0025  GETMET	R8	R5	K61
-      0x5828003F,  //  0026  LDCONST	R10	K63
+      0x8C200B3E,  //  0025  GETMET	R8	R5	K62
+      0x58280040,  //  0026  LDCONST	R10	K64
       0x7C200400,  //  0027  CALL	R8	2
-      0x8C200F40,  //  0028  GETMET	R8	R7	K64
+      0x8C200F41,  //  0028  GETMET	R8	R7	K65
       0x5C280A00,  //  0029  MOVE	R10	R5
       0x7C200400,  //  002A  CALL	R8	2
       0x00100903,  //  002B  ADD	R4	R4	K3
@@ -1105,34 +1094,34 @@ be_local_closure(class_Matter_Session_Store_save_fabrics,   /* name */
       0x5818001B,  //  002D  LDCONST	R6	K27
       0xAC180200,  //  002E  CATCH	R6	1	0
       0xB0080000,  //  002F  RAISE	2	R0	R0
-      0x8C180B3D,  //  0030  GETMET	R6	R5	K61
-      0x58200041,  //  0031  LDCONST	R8	K65
+      0x8C180B3E,  //  0030  GETMET	R6	R5	K62
+      0x58200042,  //  0031  LDCONST	R8	K66
       0x7C180400,  //  0032  CALL	R6	2
       0x8C180B0E,  //  0033  GETMET	R6	R5	K14
       0x7C180200,  //  0034  CALL	R6	1
       0x8C180502,  //  0035  GETMET	R6	R2	K2
       0x8820010C,  //  0036  GETMBR	R8	R0	K12
       0x7C180400,  //  0037  CALL	R6	2
-      0x8C180542,  //  0038  GETMET	R6	R2	K66
-      0x8820013B,  //  0039  GETMBR	R8	R0	K59
+      0x8C180543,  //  0038  GETMET	R6	R2	K67
+      0x8820013C,  //  0039  GETMBR	R8	R0	K60
       0x8824010C,  //  003A  GETMBR	R9	R0	K12
       0x7C180600,  //  003B  CALL	R6	3
       0x781A000B,  //  003C  JMPF	R6	#0049
       0xB81A3A00,  //  003D  GETNGBL	R6	K29
       0x601C0018,  //  003E  GETGBL	R7	G24
-      0x58200043,  //  003F  LDCONST	R8	K67
+      0x58200044,  //  003F  LDCONST	R8	K68
       0x5C240800,  //  0040  MOVE	R9	R4
       0x5C280600,  //  0041  MOVE	R10	R3
       0x7C1C0600,  //  0042  CALL	R7	3
       0x58200006,  //  0043  LDCONST	R8	K6
       0x7C180400,  //  0044  CALL	R6	2
       0x88180131,  //  0045  GETMBR	R6	R0	K49
-      0x8C180D44,  //  0046  GETMET	R6	R6	K68
+      0x8C180D45,  //  0046  GETMET	R6	R6	K69
       0x7C180200,  //  0047  CALL	R6	1
       0x70020005,  //  0048  JMP		#004F
       0xB81A3A00,  //  0049  GETNGBL	R6	K29
       0x601C0018,  //  004A  GETGBL	R7	G24
-      0x58200045,  //  004B  LDCONST	R8	K69
+      0x58200046,  //  004B  LDCONST	R8	K70
       0x7C1C0200,  //  004C  CALL	R7	1
       0x58200006,  //  004D  LDCONST	R8	K6
       0x7C180400,  //  004E  CALL	R6	2
@@ -1144,7 +1133,7 @@ be_local_closure(class_Matter_Session_Store_save_fabrics,   /* name */
       0x60180008,  //  0054  GETGBL	R6	G8
       0x5C1C0600,  //  0055  MOVE	R7	R3
       0x7C180200,  //  0056  CALL	R6	1
-      0x001A8C06,  //  0057  ADD	R6	K70	R6
+      0x001A8E06,  //  0057  ADD	R6	K71	R6
       0x00180D21,  //  0058  ADD	R6	R6	K33
       0x601C0008,  //  0059  GETGBL	R7	G8
       0x5C200800,  //  005A  MOVE	R8	R4
@@ -1184,7 +1173,7 @@ be_local_closure(class_Matter_Session_Store_create_session,   /* name */
       0x4C100000,  //  0003  LDNIL	R4
       0x20100604,  //  0004  NE	R4	R3	R4
       0x78120002,  //  0005  JMPF	R4	#0009
-      0x8C100147,  //  0006  GETMET	R4	R0	K71
+      0x8C100148,  //  0006  GETMET	R4	R0	K72
       0x5C180600,  //  0007  MOVE	R6	R3
       0x7C100400,  //  0008  CALL	R4	2
       0xB8121200,  //  0009  GETNGBL	R4	K9
@@ -1234,7 +1223,7 @@ be_local_closure(class_Matter_Session_Store_remove_fabric,   /* name */
       0x780E000B,  //  0009  JMPF	R3	#0016
       0x880C0101,  //  000A  GETMBR	R3	R0	K1
       0x940C0602,  //  000B  GETIDX	R3	R3	R2
-      0x880C0748,  //  000C  GETMBR	R3	R3	K72
+      0x880C0749,  //  000C  GETMBR	R3	R3	K73
       0x1C0C0601,  //  000D  EQ	R3	R3	R1
       0x780E0004,  //  000E  JMPF	R3	#0014
       0x880C0101,  //  000F  GETMBR	R3	R0	K1
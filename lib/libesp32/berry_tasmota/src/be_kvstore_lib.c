@@ -0,0 +1,30 @@
+/********************************************************************
+ * Berry module `kvstore`
+ *
+ * To use: `import kvstore`
+ *
+ * Persistent key-value store, see support_kvstore.ino
+ *******************************************************************/
+
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+
+#include "be_constobj.h"
+
+extern int be_ntv_kvstore_set(bvm *vm);
+extern int be_ntv_kvstore_get(bvm *vm);
+extern int be_ntv_kvstore_remove(bvm *vm);
+extern int be_ntv_kvstore_compact(bvm *vm);
+extern int be_ntv_kvstore_count(bvm *vm);
+
+/* @const_object_info_begin
+module kvstore (scope: global) {
+    set, func(be_ntv_kvstore_set)
+    get, func(be_ntv_kvstore_get)
+    remove, func(be_ntv_kvstore_remove)
+    compact, func(be_ntv_kvstore_compact)
+    count, func(be_ntv_kvstore_count)
+}
+@const_object_info_end */
+#include "be_fixed_kvstore.h"
+
+#endif // USE_UFILESYS && USE_KVSTORE
@@ -25,6 +25,10 @@ extern int m_mdns_remove_service(struct bvm *vm);
 extern int m_dns_add_subtype(struct bvm *vm);
 extern int m_dns_add_hostname(struct bvm *vm);
 extern int m_dns_find_service(struct bvm *vm);
+extern int m_dns_browse_start(struct bvm *vm);
+extern int m_dns_browse_stop(struct bvm *vm);
+extern int m_dns_browse_read(struct bvm *vm);
+extern int m_dns_browse_events(struct bvm *vm);
 
 /* @const_object_info_begin
 module mdns (scope: global) {
@@ -38,6 +42,12 @@ module mdns (scope: global) {
 
     // querying
     find_service, func(m_dns_find_service)
+
+    // background browse cache
+    browse_start, func(m_dns_browse_start)
+    browse_stop, func(m_dns_browse_stop)
+    browse_read, func(m_dns_browse_read)
+    browse_events, func(m_dns_browse_events)
 }
 @const_object_info_end */
 #include "be_fixed_mdns.h"
@@ -0,0 +1,23 @@
+/********************************************************************
+ * Berry module `profiler`
+ *
+ * To use: `import profiler`
+ *
+ * Sampling execution profiler, per-function sample counters
+ *******************************************************************/
+#include "be_constobj.h"
+
+extern int be_profiler_start(bvm *vm);
+extern int be_profiler_stop(bvm *vm);
+extern int be_profiler_counters(bvm *vm);
+extern int be_profiler_dump(bvm *vm);
+
+/* @const_object_info_begin
+module profiler (scope: global) {
+  start, func(be_profiler_start)
+  stop, func(be_profiler_stop)
+  counters, func(be_profiler_counters)
+  dump, func(be_profiler_dump)
+}
+@const_object_info_end */
+#include "be_fixed_profiler.h"
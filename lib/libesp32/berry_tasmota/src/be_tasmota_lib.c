@@ -28,6 +28,7 @@ extern int l_time_dump(bvm *vm);
 extern int l_strftime(bvm *vm);
 extern int l_strptime(bvm *vm);
 extern int l_memory(bvm *vm);
+extern int l_gc_info(bvm *vm);
 extern int l_wifi(bvm *vm);
 extern int l_eth(bvm *vm);
 extern int l_hostname(bvm *vm);
@@ -121,6 +122,7 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     strftime, func(l_strftime)
     strptime, func(l_strptime)
     memory, static_func(l_memory)
+    _gc_info, static_func(l_gc_info)
     wifi, static_func(l_wifi)
     eth, static_func(l_eth)
     hostname, func(l_hostname)
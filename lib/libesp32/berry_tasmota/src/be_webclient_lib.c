@@ -26,6 +26,13 @@ extern int wc_POST(bvm *vm);
 extern int wc_PUT(bvm *vm);
 extern int wc_PATCH(bvm *vm);
 extern int wc_DELETE(bvm *vm);
+extern int wc_GET_async(bvm *vm);
+extern int wc_POST_async(bvm *vm);
+extern int wc_PUT_async(bvm *vm);
+extern int wc_PATCH_async(bvm *vm);
+extern int wc_DELETE_async(bvm *vm);
+extern int wc_pending(bvm *vm);
+extern int wc_result(bvm *vm);
 extern int wc_getstring(bvm *vm);
 extern int wc_writefile(bvm *vm);
 extern int wc_writeflash(bvm *vm);
@@ -44,6 +51,7 @@ void be_load_webclient_lib(bvm *vm) {
 class be_class_webclient (scope: global, name: webclient) {
     .p, var
     .w, var
+    .a, var
     init, func(wc_init)
     deinit, func(wc_deinit)
     url_encode, static_func(wc_urlencode)
@@ -65,6 +73,15 @@ class be_class_webclient (scope: global, name: webclient) {
     PUT, func(wc_PUT)
     PATCH, func(wc_PATCH)
     DELETE, func(wc_DELETE)
+
+    // async variants, poll with pending() and fetch the http code with result()
+    GET_async, func(wc_GET_async)
+    POST_async, func(wc_POST_async)
+    PUT_async, func(wc_PUT_async)
+    PATCH_async, func(wc_PATCH_async)
+    DELETE_async, func(wc_DELETE_async)
+    pending, func(wc_pending)
+    result, func(wc_result)
     get_string, func(wc_getstring)
     write_file, func(wc_writefile)
     write_flash, func(wc_writeflash)
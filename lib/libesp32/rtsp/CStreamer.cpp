@@ -167,26 +167,32 @@ u_short CStreamer::GetRtcpServerPort()
 
 void CStreamer::streamFrame(unsigned const char *data, uint32_t dataLen, uint32_t curMsec)
 {
-    if(m_prevMsec == 0) // first frame init our timestamp
-        m_prevMsec = curMsec;
-
-    // compute deltat (being careful to handle clock rollover with a little lie)
-    uint32_t deltams = (curMsec >= m_prevMsec) ? curMsec - m_prevMsec : 100;
-    m_prevMsec = curMsec;
+    ParsedJPEG parsed;
 
-    // locate quant tables if possible
-    BufPtr qtable0, qtable1;
-
-    if (!decodeJPEGfile(&data, &dataLen, &qtable0, &qtable1)) {
+    if (!parseJPEGfile(data, dataLen, &parsed)) {
 #ifdef STREAM_DEBUG
         printf("can't decode jpeg data\n");
 #endif
         return;
     }
 
+    streamFrame(parsed, curMsec);
+};
+
+// Stream a frame that the caller already parsed with parseJPEGfile() - when
+// several sessions stream the same camera the jpeg only needs to be parsed once
+void CStreamer::streamFrame(const ParsedJPEG &jpeg, uint32_t curMsec)
+{
+    if(m_prevMsec == 0) // first frame init our timestamp
+        m_prevMsec = curMsec;
+
+    // compute deltat (being careful to handle clock rollover with a little lie)
+    uint32_t deltams = (curMsec >= m_prevMsec) ? curMsec - m_prevMsec : 100;
+    m_prevMsec = curMsec;
+
     int offset = 0;
     do {
-        offset = SendRtpPacket(data, dataLen, offset, qtable0, qtable1);
+        offset = SendRtpPacket(jpeg.scan, jpeg.scanLen, offset, jpeg.qtable0, jpeg.qtable1);
     } while(offset != 0);
 
     // Increment ONLY after a full frame
@@ -348,3 +354,14 @@ bool decodeJPEGfile(BufPtr *start, uint32_t *len, BufPtr *qtable0, BufPtr *qtabl
 
     return true;
 }
+
+// Parse a jpeg file once into a ParsedJPEG so the scan data and quant tables
+// can be streamed to any number of sessions without re-scanning the file
+bool parseJPEGfile(BufPtr start, uint32_t len, ParsedJPEG *parsed) {
+    if(!decodeJPEGfile(&start, &len, &parsed->qtable0, &parsed->qtable1))
+        return false;
+
+    parsed->scan = start;
+    parsed->scanLen = len;
+    return true;
+}
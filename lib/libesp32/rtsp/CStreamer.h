@@ -4,6 +4,16 @@
 
 typedef unsigned const char *BufPtr;
 
+// A JPEG frame parsed once, so it can be fanned out to many sessions without
+// each session re-scanning the file for the scan data and quant tables
+typedef struct
+{
+    BufPtr scan;        // start of the entropy coded scan data
+    uint32_t scanLen;   // length of the scan data up to the EOI marker
+    BufPtr qtable0;     // quant tables found in the header, or NULL
+    BufPtr qtable1;
+} ParsedJPEG;
+
 class CStreamer
 {
 public:
@@ -18,6 +28,7 @@ public:
 protected:
 
     void    streamFrame(unsigned const char *data, uint32_t dataLen, uint32_t curMsec);
+    void    streamFrame(const ParsedJPEG &jpeg, uint32_t curMsec);  // frame already parsed by the caller
 
 private:
     int    SendRtpPacket(unsigned const char *jpeg, int jpegLen, int fragmentOffset, BufPtr quant0tbl = NULL, BufPtr quant1tbl = NULL);// returns new fragmentOffset or 0 if finished with frame
@@ -50,6 +61,11 @@ private:
 // returns true if the file seems to be valid jpeg
 // If quant tables can be found they will be stored in qtable0/1
 bool decodeJPEGfile(BufPtr *start, uint32_t *len, BufPtr *qtable0, BufPtr *qtable1);
+
+// Parse a jpeg file once into a ParsedJPEG that can be streamed to any number
+// of sessions - this is the expensive part of streamFrame (it walks the whole
+// scan data to find the end marker), so do it once per frame, not per session
+bool parseJPEGfile(BufPtr start, uint32_t len, ParsedJPEG *parsed);
 bool findJPEGheader(BufPtr *start, uint32_t *len, uint8_t marker);
 
 // Given a jpeg ptr pointing to a pair of length bytes, advance the pointer to
@@ -149,43 +149,84 @@ int lv_x_call_c(bvm *vm) {
   return be_call_c_func(vm, func, return_type, arg_type);
 }
 
+/*********************************************************************************************\
+ * Inline cache for method resolution
+ *
+ * `lv_x_member` runs for every method access and a screen build does thousands of them.
+ * Resolutions are kept in a small direct-mapped table keyed on (class, selector) so
+ * repeated calls skip the binary searches and the superclass walk. Entries reference the
+ * constant `lv_classes` tables by index only and every hit is re-verified with `strcmp`
+ * against those tables, so a colliding or stale entry can never mis-dispatch - it just
+ * falls back to the full lookup.
+\*********************************************************************************************/
+#ifndef LV_MEMBER_CACHE_SIZE
+#define LV_MEMBER_CACHE_SIZE  64      // direct-mapped entries of 12 bytes each
+#endif
+
+typedef struct lv_member_cache_entry_t {
+  uint32_t hash;             // combined hash of class name and method name, `0` = empty slot
+  int16_t  key_class_idx;    // index in lv_classes[] of the class the search started at
+  int16_t  found_class_idx;  // index in lv_classes[] of the class holding the method
+  uint16_t method_idx;       // index in the func_table of the found class
+} lv_member_cache_entry_t;
+
+static lv_member_cache_entry_t lv_member_cache[LV_MEMBER_CACHE_SIZE] = {};
+
+static uint32_t lv_member_hash(const char *class_name, const char *method_name) {
+  uint32_t hash = 5381;
+  for (const char *p = class_name; *p; p++)  { hash = (hash * 33) ^ (uint8_t)*p; }
+  for (const char *p = method_name; *p; p++) { hash = (hash * 33) ^ (uint8_t)*p; }
+  if (0 == hash) { hash = 1; }
+  return hash;
+}
+
 // virtual method, arg1: instance, arg2: name of method
 int lv_x_member(bvm *vm) {
   int32_t argc = be_top(vm); // Get the number of arguments
   if (argc == 2 && be_isinstance(vm, 1) && be_isstring(vm, 2)) {
     const char * method_name = be_tostring(vm, 2);    // the method we are looking for
+    const be_ntv_func_def_t * method = NULL;
+    int32_t key_class_idx = -1;       // first class of the chain present in lv_classes[], used as cache key
+    uint32_t key_hash = 0;
+
     while (be_isinstance(vm, 1)) {
       const char * class_name = be_classname(vm, 1);
       // berry_log_C("lv_x_member looking for method '%s' of class '%s'", method_name, class_name);
 
+      // probe the inline cache first
+      uint32_t hash = lv_member_hash(class_name, method_name);
+      const lv_member_cache_entry_t * entry = &lv_member_cache[hash % LV_MEMBER_CACHE_SIZE];
+      if (entry->hash == hash) {
+        const be_ntv_func_def_t * cached = &lv_classes[entry->found_class_idx].func_table[entry->method_idx];
+        if ((strcmp(class_name, lv_classes[entry->key_class_idx].name) == 0) &&
+            (strcmp(method_name, cached->name) == 0)) {
+          method = cached;
+          break;
+        }
+      }
+
       // look for class descriptor
       int32_t class_idx = be_map_bin_search(class_name, &lv_classes[0].name, sizeof(lv_classes[0]), lv_classes_size);
       if (class_idx >= 0) {
+        if (key_class_idx < 0) {
+          key_class_idx = class_idx;
+          key_hash = hash;
+        }
         const be_ntv_func_def_t * methods_calls = lv_classes[class_idx].func_table;
         size_t methods_size = lv_classes[class_idx].size;
 
         int32_t method_idx = be_map_bin_search(method_name, methods_calls, sizeof(be_ntv_func_def_t), methods_size);
         if (method_idx >= 0) {
-          // method found
-          const be_ntv_func_def_t * method = &methods_calls[method_idx];
-          // berry_log_C("lv_x_member method found func=%p return_type=%s arg_type=%s", method->func, method->return_type, method->arg_type);
-          // push native closure
-          be_pushntvclosure(vm, &lv_x_call_c, 3);   // 3 upvals
-
-          be_pushcomptr(vm, method->args.func);
-          be_setupval(vm, -2, 0);
-          be_pop(vm, 1);
-
-          be_pushstring(vm, method->args.return_type);
-          be_setupval(vm, -2, 1);
-          be_pop(vm, 1);
-
-          be_pushstring(vm, method->args.arg_type);
-          be_setupval(vm, -2, 2);
-          be_pop(vm, 1);
-
-          // all good
-          be_return(vm);
+          // method found - remember the resolution for the next call on this class
+          method = &methods_calls[method_idx];
+          if (key_class_idx >= 0) {
+            lv_member_cache_entry_t * slot = &lv_member_cache[key_hash % LV_MEMBER_CACHE_SIZE];
+            slot->hash = key_hash;
+            slot->key_class_idx = key_class_idx;
+            slot->found_class_idx = class_idx;
+            slot->method_idx = method_idx;
+          }
+          break;
         }
       }
 
@@ -194,6 +235,27 @@ int lv_x_member(bvm *vm) {
       be_moveto(vm, -1, 1);
       be_pop(vm, 1);
     }
+
+    if (method) {
+      // berry_log_C("lv_x_member method found func=%p return_type=%s arg_type=%s", method->func, method->return_type, method->arg_type);
+      // push native closure
+      be_pushntvclosure(vm, &lv_x_call_c, 3);   // 3 upvals
+
+      be_pushcomptr(vm, method->args.func);
+      be_setupval(vm, -2, 0);
+      be_pop(vm, 1);
+
+      be_pushstring(vm, method->args.return_type);
+      be_setupval(vm, -2, 1);
+      be_pop(vm, 1);
+
+      be_pushstring(vm, method->args.arg_type);
+      be_setupval(vm, -2, 2);
+      be_pop(vm, 1);
+
+      // all good
+      be_return(vm);
+    }
     // berry_log_C("lv_x_member method not found");
     /* not found, return module 'undefined' */
     be_getmodule(vm, "undefined");
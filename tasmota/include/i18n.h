@@ -121,6 +121,9 @@
 #define D_JSON_UNKNOWN "Unknown"
 #define D_JSON_LIGHT "Light"
 #define D_JSON_LINK_COUNT "LinkCount"
+#define D_JSON_FAST_RECONNECT "FastReconnect"
+#define D_JSON_ROAM_COUNT "RoamCount"
+#define D_JSON_ROAM_LATENCY "RoamLatency"
 #define D_JSON_LOCAL_TIME "Local"
 #define D_JSON_LOW "Low"
 #define D_JSON_MAC "Mac"
@@ -299,6 +302,7 @@
 #define D_CMND_BLINKCOUNT "BlinkCount"
 #define D_CMND_SETSENSOR "SetSensor"
 #define D_CMND_SENSOR "Sensor"
+#define D_CMND_SENSORINTERVAL "SensorInterval"
 #define D_CMND_DRIVER "Driver"
 #define D_CMND_SAVEDATA "SaveData"
 #define D_CMND_SETOPTION "SetOption"
@@ -562,6 +566,7 @@
   #define D_JSON_IR_RAWDATA "RawData"
   #define D_JSON_IR_REPEAT "Repeat"
   #define D_JSON_IR_CHANNEL "Channel"
+#define D_CMND_IRENABLE "IREnable"
 #define D_CMND_IRHVAC "IRHVAC"
   #define D_JSON_IRHVAC_VENDOR "Vendor"
   #define D_JSON_IRHVAC_PROTOCOL "Protocol"
@@ -651,6 +656,7 @@
 #define D_SO_ZIGBEE_OMITDEVICE "OmitDevice"
 #define D_CMND_ZIGBEE_PERMITJOIN "PermitJoin"
 #define D_CMND_ZIGBEE_STATUS "Status"
+#define D_CMND_ZIGBEE_SERIAL "Serial"
 #define D_CMND_ZIGBEE_RESET "Reset"
   #define D_JSON_ZIGBEE_CC2530 "CCxxxx"
   #define D_JSON_ZIGBEE_EZSP "EZSP"
@@ -719,6 +725,7 @@
 #define D_CMND_ZIGBEE_LIGHT "Light"
   #define D_JSON_ZIGBEE_LIGHT "Light"
 #define D_CMND_ZIGBEE_OCCUPANCY "Occupancy"
+#define D_CMND_ZIGBEE_COALESCE "Coalesce"
   #define D_JSON_ZIGBEE_OCCUPANCY "Occupancy"
 #define D_CMND_ZIGBEE_RESTORE "Restore"
 #define D_CMND_ZIGBEE_CONFIG "Config"
@@ -185,7 +185,10 @@ const uint8_t STATES = 20;                  // Number of states per second using
 const uint8_t IMMINENT_RESET_FACTOR = 10;   // Factor to extent button hold time for imminent Reset to default 40 seconds using KEY_HOLD_TIME of 40
 const uint32_t BOOT_LOOP_TIME = 10;         // Number of seconds to stop detecting boot loops
 const uint32_t POWER_CYCLE_TIME = 8;        // Number of seconds to reset power cycle boot loops
+const uint32_t OTA_COMMIT_TIME = 300;       // Number of seconds for a pending dual app partition image to pass its health check before rollback
 const uint16_t SYSLOG_TIMER = 600;          // Seconds to restore syslog_level
+const uint16_t SYSLOG_RETRY_TIME = 10;      // Seconds of first syslog retry backoff, doubled on every failure up to SYSLOG_TIMER
+const uint16_t SYSLOG_BATCH_SIZE = 1400;    // Max syslog datagram payload, kept under the ethernet MTU
 const uint16_t SERIALLOG_TIMER = 600;       // Seconds to disable SerialLog
 #ifdef ESP8266
 const uint8_t OTA_ATTEMPTS = 10;            // Number of times to try fetching the new firmware
@@ -215,6 +218,7 @@ const uint16_t MAX_LOGSZ = LOG_BUFFER_SIZE -96;  // Max number of characters in
 const uint8_t SENSOR_MAX_MISS = 5;          // Max number of missed sensor reads before deciding it's offline
 
 const uint32_t MIN_BACKLOG_DELAY = 200;     // Minimal backlog delay in mSeconds
+const uint32_t BACKLOG_SLOW_COMMAND = 500;  // Log backlog commands blocking the loop longer than this in mSeconds
 
 const uint32_t SOFT_BAUDRATE = 9600;        // Default software serial baudrate
 const uint32_t APP_BAUDRATE = 115200;       // Default serial baudrate
@@ -442,6 +446,9 @@ enum XsnsFunctions { FUNC_SETTINGS_OVERRIDE, FUNC_SETUP_RING1, FUNC_SETUP_RING2,
                      FUNC_WEB_GET_ARG, FUNC_WEB_ADD_HANDLER, FUNC_SET_SCHEME, FUNC_HOTPLUG_SCAN, FUNC_TIME_SYNCED,
                      FUNC_DEVICE_GROUP_ITEM,
                      FUNC_NETWORK_UP, FUNC_NETWORK_DOWN,
+                     FUNC_EVENT_MASK,           // Queried once after FUNC_INIT - report hot tick events handled in XdrvMailbox.payload (XEVT_xxx)
+                     FUNC_POLL_INTERVAL,        // Queried once after FUNC_INIT - report seconds between periodic polls in XdrvMailbox.payload (0 = poll on every tick)
+                     FUNC_WAKE_WARMUP,          // Issued on deep-sleep wake before wifi starts - kick sensor warm-up so settling overlaps network bring-up
                      FUNC_return_result = 200,  // Insert function WITHOUT return results before here. Following functions return results
                      FUNC_PIN_STATE, FUNC_MODULE_INIT, FUNC_ADD_BUTTON, FUNC_ADD_SWITCH, FUNC_BUTTON_PRESSED, FUNC_BUTTON_MULTI_PRESSED,
                      FUNC_SET_DEVICE_POWER,
@@ -452,6 +459,15 @@ enum XsnsFunctions { FUNC_SETTINGS_OVERRIDE, FUNC_SETUP_RING1, FUNC_SETUP_RING2,
                      FUNC_last_function         // Insert functions WITH return results before here
                      };
 
+// Hot tick event bits reported by drivers and sensors on FUNC_EVENT_MASK
+#define XEVT_LOOP               0x01       // FUNC_LOOP
+#define XEVT_SLEEP_LOOP         0x02       // FUNC_SLEEP_LOOP
+#define XEVT_EVERY_50_MSECOND   0x04       // FUNC_EVERY_50_MSECOND
+#define XEVT_EVERY_100_MSECOND  0x08       // FUNC_EVERY_100_MSECOND
+#define XEVT_EVERY_200_MSECOND  0x10       // FUNC_EVERY_200_MSECOND
+#define XEVT_EVERY_250_MSECOND  0x20       // FUNC_EVERY_250_MSECOND
+#define XEVT_ALL                0xFF       // Default for drivers not reporting FUNC_EVENT_MASK
+
 enum AddressConfigSteps { ADDR_IDLE, ADDR_RECEIVE, ADDR_SEND };
 
 enum SettingsTextIndex { SET_OTAURL,
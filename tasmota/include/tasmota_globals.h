@@ -595,6 +595,44 @@ bool first_device_group_is_local = true;
 #define PROFILE_FUNCTION(DRIVER, INDEX, FUNCTION, START)
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_TELEMETRY_COALESCE
+#ifndef TELE_COALESCE_FULL
+#define TELE_COALESCE_FULL 10                    // Publish a full sensor payload every this many teleperiods
+#endif
+#endif  // USE_TELEMETRY_COALESCE
+
+#ifdef USE_PROFILE_STATS
+#define PROFILE_STATS_START()                    uint32_t profile_stats_start = ESP.getCycleCount()
+#define PROFILE_STATS(SENSOR, SLOT, FUNCTION)    ProfileStatsAdd(SENSOR, SLOT, FUNCTION, profile_stats_start)
+#else
+#define PROFILE_STATS_START()
+#define PROFILE_STATS(SENSOR, SLOT, FUNCTION)
+#endif  // USE_PROFILE_STATS
+
+#ifdef USE_PROFILE_TRACE
+enum ProfileTracePoints { TRACE_DISPATCH, TRACE_MQTT_PUBLISH, TRACE_SETTINGS_SAVE, TRACE_DISPLAY_FLUSH, TRACE_MAX };
+#define TRACE_BEGIN(ID)                          ProfileTraceMark(ID, 1)
+#define TRACE_END(ID)                            ProfileTraceMark(ID, 0)
+#else
+#define TRACE_BEGIN(ID)
+#define TRACE_END(ID)
+#endif  // USE_PROFILE_TRACE
+
+#ifdef USE_KVSTORE
+#define KVS_TYPE_RAW                             0  // Value type tags of the persistent key-value store (support_kvstore.ino)
+#define KVS_TYPE_STRING                          1
+#define KVS_TYPE_INT                             2
+#define KVS_TYPE_REAL                            3
+#endif  // USE_KVSTORE
+
+#ifdef USE_HEAP_STATS
+#define HEAP_POOL_MALLOC(TAG, SIZE)              HeapPoolMalloc(TAG, SIZE)
+#define HEAP_POOL_FREE(PTR)                      HeapPoolFree(PTR)
+#else
+#define HEAP_POOL_MALLOC(TAG, SIZE)              malloc(SIZE)
+#define HEAP_POOL_FREE(PTR)                      free(PTR)
+#endif  // USE_HEAP_STATS
+
 /*********************************************************************************************\
  * Macro for SetOption synonyms
  *
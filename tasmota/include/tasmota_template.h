@@ -230,6 +230,8 @@ enum UserSelectablePins {
   GPIO_TM1640CLK, GPIO_TM1640DIN,       // TM1640 (16 x seven-segment LED controler)
   GPIO_TWAI_TX, GPIO_TWAI_RX, GPIO_TWAI_BO, GPIO_TWAI_CLK,  // ESP32 TWAI serial interface
   GPIO_C8_CO2_5K_TX, GPIO_C8_CO2_5K_RX, // C8-CO2-5K CO2 Sensor
+  GPIO_ADS1115_RDY,                     // ADS1115 ALERT/RDY conversion ready
+  GPIO_SBR_RTS, GPIO_SBR_CTS,           // Serial Bridge hardware flow control
   GPIO_SENSOR_END };
 
 // Error as warning to rethink GPIO usage with max 2045
@@ -506,7 +508,9 @@ const char kSensorNames[] PROGMEM =
   D_SENSOR_I2C_SER_TX "|" D_SENSOR_I2C_SER_RX "|"
   D_SENSOR_TM1640_CLK "|" D_SENSOR_TM1640_DIN "|"
   D_SENSOR_TWAI_TX "|" D_SENSOR_TWAI_RX "|" D_SENSOR_TWAI_BO "|" D_SENSOR_TWAI_CLK "|"
-  D_SENSOR_C8_CO2_5K_TX "|" D_SENSOR_C8_CO2_5K_RX
+  D_SENSOR_C8_CO2_5K_TX "|" D_SENSOR_C8_CO2_5K_RX "|"
+  D_SENSOR_ADS1115_RDY "|"
+  D_SENSOR_SBR_RTS "|" D_SENSOR_SBR_CTS
   ;
 
 const char kSensorNamesFixed[] PROGMEM =
@@ -1016,6 +1020,10 @@ const uint16_t kGpioNiceList[] PROGMEM = {
 #ifdef USE_SERIAL_BRIDGE
   AGPIO(GPIO_SBR_TX),                            // Serial Bridge Serial interface
   AGPIO(GPIO_SBR_RX),                            // Serial Bridge Serial interface
+#ifdef ESP32
+  AGPIO(GPIO_SBR_RTS),                           // Serial Bridge bulk mode hardware flow control
+  AGPIO(GPIO_SBR_CTS),                           // Serial Bridge bulk mode hardware flow control
+#endif  // ESP32
 #endif
 #ifdef USE_MODBUS_BRIDGE
   AGPIO(GPIO_MBR_TX_ENA),                        // Modbus Bridge Serial interface
@@ -1147,6 +1155,9 @@ const uint16_t kGpioNiceList[] PROGMEM = {
   AGPIO(GPIO_C8_CO2_5K_TX),                      // SC8-CO2-5K Serial interface
   AGPIO(GPIO_C8_CO2_5K_RX),                      // SC8-CO2-5K Serial interface
 #endif
+#if defined(USE_I2C) && defined(USE_ADS1115)
+  AGPIO(GPIO_ADS1115_RDY),                       // ADS1115 ALERT/RDY conversion ready
+#endif
 
 
 #ifdef ESP32
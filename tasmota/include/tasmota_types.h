@@ -199,7 +199,7 @@ typedef union {                            // Restricted by MISRA-C Rule 18.4 bu
     uint32_t no_export_energy_today : 1;   // bit 16 (v14.3.0.7) - SetOption162 - (Energy) Do not add export energy to energy today (1)
     uint32_t gui_device_name : 1;          // bit 17 (v14.4.1.1) - SetOption163 - GUI_NOSHOW_DEVICENAME - (GUI) Disable display of GUI device name (1)
     uint32_t wizmote_enabled : 1;          // bit 18 (v14.4.1.4) - SetOption164 - (WizMote) Enable WiZ Smart Remote support (1)
-    uint32_t spare19 : 1;                  // bit 19
+    uint32_t mqtt_tele_cbor : 1;           // bit 19 (v14.5.0.1) - SetOption165 - (MQTT) Publish tele/STATE and tele/SENSOR payloads as CBOR (1), requires USE_MQTT_TELE_CBOR
     uint32_t spare20 : 1;                  // bit 20
     uint32_t spare21 : 1;                  // bit 21
     uint32_t spare22 : 1;                  // bit 22
@@ -780,7 +780,9 @@ typedef struct {
   uint8_t       web_color2[2][3];          // EA0  Needs to be on integer / 3 distance from web_color
   uint16_t      zcdimmerset[5];            // EA6
 
-  uint8_t       free_eb0[20];              // EB0  20 bytes
+  uint8_t       ir_protocol_mask[16];      // EB0  IR receive protocol enable bitmap indexed by decode_type_t
+
+  uint8_t       free_ec0[4];               // EC0  4 bytes
 
   uint16_t      light_pixels_height_1 : 15;// EC4  Pixels height minus 1, default 0 (0 means 1 line)
   uint16_t      light_pixels_alternate : 1;// EC4  Indicates alternate lines in Pixels Matrix
@@ -842,7 +844,10 @@ typedef struct {
   uint8_t       modbus_sconfig;            // F62
   uint8_t       windmeter_measure_intvl;   // F63
 
-  uint8_t       free_f64[8];               // F64 - Decrement if adding new Setting variables just above and below
+  uint8_t       wifi_bssid2[6];            // F64  Last-good AP2 BSSID for fast reconnect (AP1 uses wifi_bssid)
+  uint8_t       wifi_channel2;             // F6A  Last-good AP2 channel for fast reconnect
+
+  uint8_t       free_f6b[1];               // F6B - Decrement if adding new Setting variables just above and below
 
   // Only 32 bit boundary variables below
   float         ms5837_pressure_offset;    // F6C
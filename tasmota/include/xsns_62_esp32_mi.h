@@ -233,7 +233,19 @@ struct {
     uint32_t activeScan:1;
     uint32_t ignoreBogusBattery:1;
     uint32_t handleEveryDevice:1;
+    uint32_t dedup:1;            // drop repeated identical adverts inside the dedup window
   } option;
+  uint32_t dedupDrops = 0;       // adverts dropped by the dedup window
+  struct {
+    // native advertisement prefilter - applied at the top of the scan callback
+    // before the Berry copy or any payload parsing
+    uint8_t MAC[4][6];          // MAC allowlist, most significant byte first
+    uint8_t MACmatchLen[4];     // compare length in bytes - < 6 is a prefix match
+    uint8_t MACcount = 0;
+    int RSSIfloor = -128;       // drop adverts weaker than this, -128 = off
+    uint32_t MACdrops = 0;      // per-filter drop counters
+    uint32_t RSSIdrops = 0;
+  } prefilter;
 #ifdef USE_MI_EXT_GUI
   uint32_t widgetSlot = 0;
 #ifdef USE_ENERGY_SENSOR
@@ -352,9 +364,9 @@ struct mi_sensor_t{
 
 #define D_CMND_MI32 "MI32"
 
-const char kMI32_Commands[] PROGMEM = D_CMND_MI32 "|Key|Name|Cfg|Option";
+const char kMI32_Commands[] PROGMEM = D_CMND_MI32 "|Key|Name|Cfg|Option|PreFilter";
 
-void (*const MI32_Commands[])(void) PROGMEM = {&CmndMi32Key, &CmndMi32Name,&CmndMi32Cfg, &CmndMi32Option };
+void (*const MI32_Commands[])(void) PROGMEM = {&CmndMi32Key, &CmndMi32Name,&CmndMi32Cfg, &CmndMi32Option, &CmndMi32PreFilter };
 
 #define UNKNOWN_MI  0
 #define FLORA       1
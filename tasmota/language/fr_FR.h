@@ -757,6 +757,8 @@
 #define D_SENSOR_HPMA_RX       "HPMA Rx"
 #define D_SENSOR_HPMA_TX       "HPMA Tx"
 #define D_SENSOR_SBR_RX        "SerBr Rx"
+#define D_SENSOR_SBR_RTS       "SerBr RTS"
+#define D_SENSOR_SBR_CTS       "SerBr CTS"
 #define D_SENSOR_SBR_TX        "SerBr Tx"
 #define D_SENSOR_MBR_TX        "ModBr Tx"
 #define D_SENSOR_MBR_RX        "ModBr Rx"
@@ -859,6 +861,7 @@
 #define D_SENSOR_HRE_CLOCK     "HRE Clk"
 #define D_SENSOR_HRE_DATA      "HRE Dat"
 #define D_SENSOR_ADE7880_IRQ   "ADE7880 IRq"
+#define D_SENSOR_ADS1115_RDY   "ADS1115 RDY"
 #define D_SENSOR_ADE7953_IRQ   "ADE7953 IRq"
 #define D_SENSOR_ADE7953_RST   "ADE7953 Rst"
 #define D_SENSOR_ADE7953_CS    "ADE7953 CS"
@@ -757,6 +757,8 @@
 #define D_SENSOR_HPMA_RX                "HPMA  - RX"
 #define D_SENSOR_HPMA_TX                "HPMA - TX"
 #define D_SENSOR_SBR_RX                 "SerBr - RX"
+#define D_SENSOR_SBR_RTS                "SerBr - RTS"
+#define D_SENSOR_SBR_CTS                "SerBr - CTS"
 #define D_SENSOR_SBR_TX                 "SerBr - TX"
 #define D_SENSOR_MBR_TX                 "ModBr - TX"
 #define D_SENSOR_MBR_RX                 "ModBr - RX"
@@ -859,6 +861,7 @@
 #define D_SENSOR_HRE_CLOCK              "HRE - Clock"
 #define D_SENSOR_HRE_DATA               "HRE - Dati"
 #define D_SENSOR_ADE7880_IRQ            "ADE7880 - IRQ"
+#define D_SENSOR_ADS1115_RDY   "ADS1115 RDY"
 #define D_SENSOR_ADE7953_IRQ            "ADE7953 - IRQ"
 #define D_SENSOR_ADE7953_RST            "ADE7953 - RST"
 #define D_SENSOR_ADE7953_CS             "ADE7953 - CS"
@@ -291,6 +291,11 @@
 #define APP_NORMAL_SLEEP       false             // [SetOption60] Enable normal sleep instead of dynamic sleep
 #define TASMOTA_SLEEP          50                // [Sleep] Sleep time to lower energy consumption (0 = Off, value in milliseconds),
 #define PWM_MAX_SLEEP          10                // Sleep will be lowered to this value when light is on, to avoid flickering, and when buzzer is on for better on/off period accuracy
+//#define USE_SLEEP_GOVERNOR                       // Lower loop sleep to SLEEP_GOVERNOR_MIN during interactive use or sustained load and
+                                                 //   ramp it back to Sleep during quiet periods, reported as SleepGov in STATE telemetry (+0k3 code)
+//  #define SLEEP_GOVERNOR_MIN   10                // Effective sleep floor in milliseconds while boosted
+//  #define SLEEP_GOVERNOR_BOOST 5                 // Seconds latency stays at the floor after activity
+//  #define SLEEP_GOVERNOR_LOAD  50                // Windowed loop load percent treated as sustained work
 
 #define KEY_DEBOUNCE_TIME      50                // [ButtonDebounce] Number of mSeconds button press debounce time
 #define KEY_HOLD_TIME          40                // [SetOption32] Number of 0.1 seconds to hold Button or external Pushbutton before sending HOLD message
@@ -455,6 +460,22 @@
 //  #define HOME_ASSISTANT_LWT_TOPIC   "homeassistant/status"  // home Assistant Birth and Last Will Topic (default = homeassistant/status)
 //  #define HOME_ASSISTANT_LWT_SUBSCRIBE    true               // Subscribe to Home Assistant Birth and Last Will Topic (default = true)
 
+// -- MQTT - Telemetry coalescing ------------------
+//#define USE_TELEMETRY_COALESCE                   // Publish only sensors whose JSON changed since the last teleperiod (per-sensor dirty tracking)
+//  #define TELE_COALESCE_FULL      10             // Publish a full sensor payload every this many teleperiods
+//#define USE_SENSOR_DELTA                         // Per-channel deadband filters for teleperiod sensor publishing with command SensorDelta
+//  #define SENSOR_DELTA_MAX        8              // Maximum number of channel filters
+//  #define SENSOR_DELTA_HEARTBEAT  10             // Force a publish after this many suppressed teleperiods
+
+// -- MQTT - Store and forward ---------------------
+//#define USE_MQTT_STORE_FORWARD                   // Queue failed publishes while the broker is unreachable and replay them in order after reconnect (+1k code)
+//  #define MQTT_SF_BUDGET          16384          // Maximum bytes held in the offline queue (PSRAM preferred on ESP32), oldest dropped first
+//  #define MQTT_SF_DRAIN_BURST     2              // Messages replayed per 100ms after reconnect
+
+// -- MQTT - CBOR telemetry ------------------------
+//#define USE_MQTT_TELE_CBOR                       // Support SetOption165 publishing tele/STATE and tele/SENSOR payloads as CBOR binary (+1k code)
+                                                   //   Rules and web GUI keep seeing JSON, only the MQTT wire format changes
+
 // -- MQTT - Tasmota Discovery ---------------------
 #define USE_TASMOTA_DISCOVERY                      // Enable Tasmota Discovery support (+2k code)
 
@@ -490,6 +511,11 @@
   #define WEB_PORT             80                // Web server Port for User and Admin mode
   #define WEB_USERNAME         "admin"           // Web server Admin mode user name
 //  #define DISABLE_REFERER_CHK                     // [SetOption128] Disable HTTP API
+//  #define USE_WEBAUTH_SESSION                    // Issue a session cookie after a successful login and validate it with a constant-time compare,
+                                                   //   lock out an IP after repeated failed logins (+0k8 code)
+//    #define WEBAUTH_SESSION_TTL  3600            // Session lifetime in seconds, renewed on use
+//    #define WEBAUTH_FAIL_MAX     5               // Failed logins from one IP before lockout
+//    #define WEBAUTH_FAIL_BLOCK   60              // Lockout duration in seconds
   #define USE_ENHANCED_GUI_WIFI_SCAN             // Enable Wi-Fi scan output with BSSID (+0k5 code)
 //  #define USE_WEBSEND_RESPONSE                   // Enable command WebSend response message (+1k code)
 //  #define USE_WEBGETCONFIG                       // Enable restoring config from external webserver (+0k6)
@@ -558,6 +584,7 @@
   #define DEVICE_GROUPS_ADDRESS 239,255,250,250  // Device groups multicast address
   #define DEVICE_GROUPS_PORT 4447                // Device groups multicast port
   #define USE_DEVICE_GROUPS_SEND                 // Add support for the DevGroupSend command (+0k6 code)
+//  #define USE_DEVICE_GROUPS_CRYPTO             // Compress and authenticate device group messages with a per-group key derived from the WiFi password (+1k2 code)
 #define USE_PWM_DIMMER                           // Add support for MJ-SD01/acenx/NTONPOWER PWM dimmers (+2k3 code, DGR=0k7)
   #define USE_PWM_DIMMER_REMOTE                  // Add support for remote switches to PWM Dimmer (requires USE_DEVICE_GROUPS) (+0k6 code)
 //#define USE_KEELOQ                               // Add support for Jarolift rollers by Keeloq algorithm (+4k5 code)
@@ -583,6 +610,7 @@
 #define USE_LIGHT_PALETTE                        // Add support for color palette (+0k7 code)
 #define USE_LIGHT_VIRTUAL_CT                     // Add support for Virtual White Color Temperature (+1.1k code)
 #define USE_DGR_LIGHT_SEQUENCE                   // Add support for device group light sequencing (requires USE_DEVICE_GROUPS) (+0k2 code)
+//#define USE_LIGHT_HW_FADE                        // ESP32 only, fade PWM lights in LEDC hardware instead of 50ms software steps (+0k6 code). Hardware ramps are linear in duty, software steps follow the gamma curve. Needs LEDC fade-stop support (ESP32-S2/S3/C2/C3/C6...), falls back to software on the original ESP32
 //#define USE_LSC_MCSL                             // Add support for GPE Multi color smart light as sold by Action in the Netherlands (+1k1 code)
 
 // -- Optional adressable leds ----------------------
@@ -602,6 +630,7 @@
 
 // -- Counter input -------------------------------
 #define USE_COUNTER                              // Enable inputs as counter (+0k8 code)
+//  #define USE_COUNTER_PCNT                       // Count pulses with the ESP32 PCNT peripheral when no millisecond debounce is configured (+0k7 code)
 
 // -- Internal Analog input -----------------------
 //#define USE_ADC_VCC                              // Display Vcc in Power status. Disable for use as Analog input on selected devices
@@ -620,6 +649,7 @@
 
 #ifdef USE_I2C
 //  #define USE_I2C_BUS2                           // Add experimental support for second I2C bus on ESP8266 (+0k6k code)
+//  #define USE_I2C_ASYNC                          // Add queued I2C transactions executed from the main loop on ESP32 (+0k4 code)
 //  #define USE_SHT                                // [I2cDriver8] Enable SHT1X sensor (+1k4 code)
 //  #define USE_HTU                                // [I2cDriver9] Enable HTU21/SI7013/SI7020/SI7021 sensor (I2C address 0x40) (+1k5 code)
 //  #define USE_BMP                                // [I2cDriver10] Enable BMP085/BMP180/BMP280/BME280 sensors (I2C addresses 0x76 and 0x77) (+4k4 code)
@@ -819,6 +849,10 @@
 // #define USE_UNIVERSAL_DISPLAY                   // New universal display driver for both I2C and SPI
     #define MAX_TOUCH_BUTTONS 16                 // Virtual touch buttons
 
+// -- Display image cache (ESP32 with filesystem) --
+//#define USE_DISPLAY_IMG_CACHE                    // Cache jpg images as raw RGB565 blobs on the filesystem after first decode and blit them directly
+//  #define DISPLAY_IMG_CACHE_MAX_PIXELS (160 * 160)  // Largest image converted to a cached blob, bigger images use streaming decode
+
 // -- SPI sensors ---------------------------------
 //#define USE_SPI                                  // Hardware SPI using GPIO12(MISO), GPIO13(MOSI) and GPIO14(CLK) in addition to two user selectable GPIOs(CS and DC)
 
@@ -911,6 +945,7 @@
 
 // -- Power monitoring sensors --------------------
 #define USE_ENERGY_SENSOR                        // Add support for Energy Monitors (+14k code)
+//#define USE_ENERGY_HISTORY                       // ESP32 only, keep on-device power/voltage/current history rings (1s for an hour, 1min for a day, 15min for a month) read out with command EnergyHistory (+1k3 code, 46k4 RAM per phase, PSRAM preferred)
 #define USE_ENERGY_MARGIN_DETECTION              // Add support for Energy Margin detection (+1k6 code)
   #define USE_ENERGY_POWER_LIMIT                 // Add additional support for Energy Power Limit detection (+1k2 code)
 #define USE_ENERGY_DUMMY                         // Add support for dummy Energy monitor allowing user values (+0k7 code)
@@ -925,6 +960,7 @@
   // #define SDM72_IMPEXP                            // Show additonal import/export active energy and power in MQTT and Web (+0k5 code)
 //#define USE_SDM120                               // Add support for Eastron SDM120-Modbus energy monitor (+1k1 code)
   #define SDM120_SPEED         2400              // SDM120-Modbus RS485 serial speed (default: 2400 baud)
+//  #define SDM120_HIGH_UPDATE_RATE                //  SDM120-Modbus block readout with higher update rate (+0k1 RAM)
 //#define USE_SDM230                               // Add support for Eastron SDM230-Modbus energy monitor (+1k6 code)
   #define SDM230_SPEED         9600              // SDM230-Modbus RS485 serial speed (default: 9600 baud)
 //  #define SDM230_MORE_REGS                        // read more registers (see xnrg_21_sdm230.ino, may cause timing issues (at your own risk, +0k4 code))
@@ -953,6 +989,7 @@
 
 // -- Low level interface devices -----------------
 #define USE_DHT                                  // Add support for DHT11, AM2301 (DHT21, DHT22, AM2302, AM2321) and SI7021 Temperature and Humidity sensor (1k6 code)
+//  #define USE_DHT_RMT                            // Capture the DHT pulse train with the ESP32 RMT peripheral instead of interrupts-off bit-banging (+1k code)
 
 //#define USE_MAX31855                             // Add support for MAX31855/MAX6675 K-Type thermocouple sensor using softSPI
 //#define USE_MAX31865                             // Add support for MAX31865 RTD sensors using softSPI
@@ -1010,12 +1047,17 @@
 // #define USE_SDCARD                               // mount SD Card, requires configured SPI pins and setting of `SDCard CS` gpio
   #define SDC_HIDE_INVISIBLES                    // hide hidden directories from the SD Card, which prevents crashes when dealing SD created on MacOS
 
+// -- Key-value store -----------------------------
+//#define USE_KVSTORE                              // Enable log-structured key-value store on the flash filesystem with command KvStore,
+                                                   //   a C API for drivers and Berry module `kvstore` (+2k5 code)
+
 // -- Zigbee interface ----------------------------
 //#define USE_ZIGBEE                                // Enable serial communication with Zigbee CC2530/CC2652 flashed with ZNP or EFR32 flashed with EZSP (+49k code, +3k mem)
   #define USE_ZIGBEE_ZNP                         // Enable ZNP protocol, needed for CC2530/CC2652 based devices
 //  #define USE_ZIGBEE_EZSP                        // Enable EZSP protocol, needed for EFR32 EmberZNet based devices, like Sonoff Zigbee bridge
                                                  // Note: USE_ZIGBEE_ZNP and USE_ZIGBEE_EZSP are mutually incompatible, you must select exactly one
   // #define USE_ZIGBEE_EEPROM                      // Use the EEPROM from the Sonoff ZBBridge to save Zigbee configuration and data
+  // #define USE_ZIGBEE_EVENT_RX                    // (ESP32 only) Assemble serial frames on UART receive events instead of polling from the main loop, see command `ZbSerial`
   #define USE_ZIGBEE_CHANNEL  11                 // Zigbee Channel (11-26)
   #define USE_ZIGBEE_TXRADIO_DBM  20             // Tx Radio power in dBm (only for EZSP, EFR32 can go up to 20 dBm)
 
@@ -1195,6 +1237,7 @@
   #define USE_BERRY_PYTHON_COMPAT                // Enable by default `import python_compat`
   #define USE_BERRY_TIMEOUT             4000     // Timeout in ms, will raise an exception if running time exceeds this timeout
   #define USE_BERRY_PSRAM                        // Allocate Berry memory in PSRAM if PSRAM is connected - this might be slightly slower but leaves main memory intact
+  #define USE_BERRY_PSRAM_THRESHOLD     512      // Minimum allocation size placed in PSRAM; smaller blocks are hot mutable objects and stay in internal RAM for speed
   #define USE_BERRY_IRAM                         // Allocate some data structures in IRAM (which is ususally unused) when possible and if no PSRAM is available
   #define USE_BERRY_FAST_LOOP_SLEEP_MS  5        // Minimum time in milliseconds to before calling again `tasmota.fast_loop()`, a smaller value will consume more CPU (min 1ms)
   // #define USE_BERRY_DEBUG                        // Compile Berry bytecode with line number information, makes exceptions easier to debug. Adds +8% of memory consumption for compiled code
@@ -1238,6 +1281,7 @@
   #define USE_LVGL_FREETYPE                      // Use the FreeType renderer to display fonts using native TTF files in file system (+77KB flash)
     #define USE_LVGL_FREETYPE_MAX_FACES 64       // max number of FreeType faces in cache
   #define USE_LVGL_BG_DEFAULT 0x000000           // Default color for the uninitialized background screen (black)
+  //#define USE_LVGL_FLUSH_TASK                  // Push rendered areas to the display from a dedicated task so rendering and SPI output overlap (+2KB RAM for second buffer and task stack)
   // Disabling select widgets that will be rarely used in Tasmota (-13KB)
   // Main widgets as defined in LVGL8
     #define BE_LV_WIDGET_OBJ
@@ -1312,6 +1356,34 @@
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_STATS                        // Enable per-driver dispatch statistics with duration histograms and command Profile (+3k code)
+//#define USE_BENCHMARK                            // Enable command Benchmark running an on-device microbenchmark suite (+1k5 code)
+//#define USE_PROFILE_TRACE                        // Enable hot-path tracepoints with commands Trace and TracePin, GPIO mirroring and webserver page /trace (+1k code)
+
+/*********************************************************************************************\
+ * Power features
+\*********************************************************************************************/
+
+//#define USE_OFFLOAD_EXECUTOR                     // [ESP32 only] Run driver-submitted jobs on the second core via OffloadCall() (+1k code)
+//#define USE_TICKLESS_SLEEP                       // Replace the 1ms SleepDelay() spin by one tick-aligned wait bounded by driver deadlines (SleepRequestWake()).
+                                                   //   With CONFIG_FREERTOS_USE_TICKLESS_IDLE and automatic light sleep enabled in the SDK this lets battery
+                                                   //   builds enter light sleep between ticks (ESP32 only benefit, harmless on ESP8266)
+
+/*********************************************************************************************\
+ * Memory features
+\*********************************************************************************************/
+
+//#define USE_SCRATCH_ARENA                        // Draw transient command dispatch buffers from a fixed scratch arena instead of the heap,
+                                                   //   avoiding long-uptime fragmentation (+0k3 code, reserves SCRATCH_ARENA_SIZE bytes mem)
+//  #define SCRATCH_ARENA_SIZE        768          // Scratch arena size in bytes
+//#define USE_HEAP_STATS                           // Enable command HeapStats reporting heap fragmentation and tagged allocation churn,
+                                                   //   and recycle the common 64/128/256 byte transient buffers through a small pool (+0k8 code)
+//  #define HEAP_POOL_DEPTH           4            // Max recycled blocks kept per size class
+//#define USE_TELEMETRY_RING                       // Sample loop load, free heap and RSSI at 1 Hz into an RTC ring with exponential retention,
+                                                   //   anomaly rule events and command Telemetry (ESP32 only, +1k1 code, 776 bytes RTC mem)
+//  #define TELEMETRY_HEAP_MIN        16           // Free heap in kB below which the heap anomaly is raised
+//  #define TELEMETRY_LOAD_MAX        80           // Loop load percentage above which the load anomaly is raised
+//  #define TELEMETRY_RSSI_MIN       -85           // RSSI in dBm below which the wifi anomaly is raised
 
 /*********************************************************************************************\
  * Optional firmware configurations
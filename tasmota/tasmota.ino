@@ -127,8 +127,18 @@ struct WIFI {
   uint8_t config_type = 0;
   uint8_t config_counter = 0;
   uint8_t scan_state;
+  uint8_t scan_channel = 0;                // Channel currently swept by the WifiScan command
+  uint8_t scan_ap_number = 0;              // APs published so far by the running WifiScan command
   uint8_t bssid[6];
   int8_t best_network_db;
+  uint16_t fast_reconnect_count = 0;       // Successful reconnects by directed association, without a scan
+  bool fast_reconnect = false;             // Current connect attempt is a directed association
+  uint32_t roam_start = 0;                 // millis() when a roam re-association started
+  uint32_t roam_latency = 0;               // Duration of last roam re-association in ms
+  uint16_t roam_count = 0;                 // Roams to a better AP while connected
+  bool roam_scan = false;                  // Current scan was started while connected (roam evaluation)
+  bool roam_pending = false;               // Re-association due to roam in progress
+  uint32_t lease_ip = 0;                   // DHCP lease restored from RTC memory, reapplied as static config on the next WifiBegin
   uint8_t wifiTest = WIFI_NOT_TESTING;
   uint8_t wifi_test_counter = 0;
   uint16_t save_data_counter = 0;
@@ -174,6 +184,13 @@ typedef struct {
 TRtcSettings RtcSettings;
 #ifdef ESP32
 static RTC_NOINIT_ATTR TRtcSettings RtcDataSettings;
+
+typedef struct {
+  uint16_t      valid;                     // Magic word
+  uint8_t       channel[MAX_SSIDS];        // Last-good wifi channel per SSID slot
+  uint8_t       bssid[MAX_SSIDS][6];       // Last-good BSSID per SSID slot
+} TRtcFastWifi;
+static RTC_NOINIT_ATTR TRtcFastWifi RtcFastWifi;  // Fast reconnect cache - always current without flash wear, Settings cover power loss
 #endif  // ESP32
 
 struct TIME_T {
@@ -261,6 +278,7 @@ struct TasmotaGlobal_t {
   uint32_t backlog_timer;                   // Timer for next command in backlog
   uint32_t loop_load_avg;                   // Indicative loop load average
   uint32_t log_buffer_pointer;              // Index in log buffer
+  uint32_t log_buffer_len;                  // Bytes used in log buffer - cached to avoid a strlen scan on every append
   uint32_t uptime;                          // Counting every second until 4294967295 = 130 year
   uint32_t zc_time;                         // Zero-cross moment (microseconds)
   uint32_t zc_offset;                       // Zero cross moment offset due to monitoring chip processing (microseconds)
@@ -341,6 +359,7 @@ struct TasmotaGlobal_t {
   uint8_t state_250mS;                      // State 250msecond per second flag
   uint8_t latching_relay_pulse;             // Latching relay pulse timer
   uint8_t active_device;                    // Active device in ExecuteCommandPower
+  uint8_t active_driver;                    // Driver or sensor id (bit 7 = sensor) most recently dispatched - flight recorder breadcrumb
   uint8_t sleep;                            // Current copy of Settings->sleep
   uint8_t leds_present;                     // Max number of LED supported
   uint8_t led_inverted;                     // LED inverted flag (1 = (0 = On, 1 = Off))
@@ -391,7 +410,8 @@ struct TasmotaGlobal_t {
 TSettings* Settings = nullptr;
 
 LList<char*> backlog;                       // Command backlog implemented with TasmotaLList
-#define BACKLOG_EMPTY (backlog.isEmpty())
+LList<char*> backlog_priority;              // Immediate lane executed ahead of the command backlog
+#define BACKLOG_EMPTY (backlog.isEmpty() && backlog_priority.isEmpty())
 
 /*********************************************************************************************\
  * Main
@@ -704,7 +724,8 @@ void setup(void) {
 #endif  // USE_ARDUINO_OTA
 #endif  // ESP8266
 
-  XdrvXsnsCall(FUNC_INIT);       // FUNC_INIT
+  XdrvCall(FUNC_INIT);           // FUNC_INIT
+  XsnsInitDefer();               // Stagger sensor FUNC_INIT over the first loop passes
 #ifdef USE_SCRIPT
   if (bitRead(Settings->rule_enabled, 0)) Run_Scripter(">BS",3,0);
 #endif  // USE_SCRIPT
@@ -712,9 +733,31 @@ void setup(void) {
   TasmotaGlobal.rules_flag.system_init = 1;
 }
 
+void BacklogExecute(char* cmd) {
+  // Execute and free one queued command, logging commands blocking the loop unexpectedly long
+  uint32_t start = millis();
+  TasmotaGlobal.no_mqtt_response = TasmotaGlobal.backlog_no_mqtt_response;
+  ExecuteCommand(cmd, SRC_BACKLOG);
+  uint32_t elapsed = millis() - start;
+  if (elapsed > BACKLOG_SLOW_COMMAND) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("BLG: Command '%s' took %d ms"), cmd, elapsed);
+  }
+  HEAP_POOL_FREE(cmd);
+}
+
 void BacklogLoop(void) {
-  if (TimeReached(TasmotaGlobal.backlog_timer)) {
-    if (!BACKLOG_EMPTY && !TasmotaGlobal.backlog_mutex) {
+  if (!backlog_priority.isEmpty() && !TasmotaGlobal.backlog_mutex) {
+    // Immediate lane - one command per loop, preempting the backlog lane and not paced by SetOption34
+    TasmotaGlobal.backlog_mutex = true;
+    char* cmd = *backlog_priority.head();
+    backlog_priority.removeHead();
+    uint32_t timer = TasmotaGlobal.backlog_timer;
+    BacklogExecute(cmd);
+    TasmotaGlobal.backlog_timer = timer;  // Restore backlog lane pacing set before ExecuteCommand (CommandHandler) reset it
+    TasmotaGlobal.backlog_mutex = false;
+  }
+  else if (TimeReached(TasmotaGlobal.backlog_timer)) {
+    if (!backlog.isEmpty() && !TasmotaGlobal.backlog_mutex) {
       TasmotaGlobal.backlog_mutex = true;
       bool nodelay = false;
       do {
@@ -725,18 +768,16 @@ void BacklogLoop(void) {
         char* cmd = *backlog.removeHead();
 */
         if (!strncasecmp_P(cmd, PSTR(D_CMND_NODELAY), strlen(D_CMND_NODELAY))) {
-          free(cmd);
+          HEAP_POOL_FREE(cmd);
           nodelay = true;
         } else {
-          TasmotaGlobal.no_mqtt_response = TasmotaGlobal.backlog_no_mqtt_response;
-          ExecuteCommand(cmd, SRC_BACKLOG);
-          free(cmd);
+          BacklogExecute(cmd);
           if (nodelay || TasmotaGlobal.backlog_nodelay) {
             TasmotaGlobal.backlog_timer = millis();  // Reset backlog_timer which has been set by ExecuteCommand (CommandHandler)
           }
           break;
         }
-      } while (!BACKLOG_EMPTY);
+      } while (!backlog.isEmpty());
       TasmotaGlobal.backlog_mutex = false;
     }
     if (BACKLOG_EMPTY) {
@@ -745,13 +786,101 @@ void BacklogLoop(void) {
   }
 }
 
+#ifdef USE_SLEEP_GOVERNOR
+#ifndef SLEEP_GOVERNOR_MIN
+#define SLEEP_GOVERNOR_MIN    10                   // Effective sleep floor in milliseconds while boosted
+#endif
+#ifndef SLEEP_GOVERNOR_BOOST
+#define SLEEP_GOVERNOR_BOOST  5                    // Seconds latency stays at the floor after activity
+#endif
+#ifndef SLEEP_GOVERNOR_LOAD
+#define SLEEP_GOVERNOR_LOAD   50                   // Windowed loop load percent treated as sustained work
+#endif
+
+struct {
+  uint32_t boost_time = 0;                         // millis() until which sleep stays at the floor, 0 = no boost
+  uint32_t window_load = 0;                        // Rolling loop utilization percent over the last ~16 loops
+  uint8_t effective = 0;                           // Effective sleep of the last loop in mSeconds (SleepGov in STATE telemetry)
+} SleepGovernor;
+
+// Interactive activity happened - drop loop latency to the floor for the next few seconds
+void SleepGovernorBoost(void) {
+  SleepGovernor.boost_time = millis() + (SLEEP_GOVERNOR_BOOST * 1000);
+}
+
+uint32_t SleepGovernorSleep(uint32_t my_activity) {
+  uint32_t sleep = TasmotaGlobal.sleep;            // Configured sleep is the quiet-period bound
+  if ((0 == sleep) || (sleep <= SLEEP_GOVERNOR_MIN)) {
+    SleepGovernor.effective = sleep;
+    return sleep;                                  // Off or already at the floor (e.g. lowered by a driver)
+  }
+  uint32_t ratio = (100 * my_activity) / sleep;
+  SleepGovernor.window_load = SleepGovernor.window_load - (SleepGovernor.window_load / 16) + (ratio / 16);
+  if (SleepGovernor.window_load > SLEEP_GOVERNOR_LOAD) {
+    SleepGovernorBoost();                          // Sustained work - keep latency at the floor
+  }
+  if (SleepGovernor.boost_time) {
+    if (TimeReached(SleepGovernor.boost_time)) {
+      SleepGovernor.boost_time = 0;
+    } else {
+      SleepGovernor.effective = SLEEP_GOVERNOR_MIN;
+      return SLEEP_GOVERNOR_MIN;
+    }
+  }
+  // Quiet - deepen sleep one millisecond per loop back up to the configured value
+  uint32_t effective = SleepGovernor.effective;
+  if (effective < SLEEP_GOVERNOR_MIN) { effective = SLEEP_GOVERNOR_MIN; }
+  if (effective < sleep) { effective++; }
+  if (effective > sleep) { effective = sleep; }    // Sleep lowered at runtime
+  SleepGovernor.effective = effective;
+  return effective;
+}
+#endif  // USE_SLEEP_GOVERNOR
+
+#ifdef USE_TICKLESS_SLEEP
+uint32_t tickless_next_wake = 0;                   // millis() deadline requested by drivers, 0 = no deadline pending
+
+void SleepRequestWake(uint32_t msec_from_now) {
+  // Drivers handling FUNC_SLEEP_LOOP announce their next deadline to bound the tickless wait.
+  // Call from FUNC_SLEEP_LOOP (or an ISR scheduling follow-up work) with the time until the
+  // driver needs service again. The earliest deadline wins.
+  uint32_t wake = millis() + msec_from_now;
+  if (!tickless_next_wake || ((int32_t)(wake - tickless_next_wake) < 0)) {
+    tickless_next_wake = wake;
+  }
+}
+#else
+void SleepRequestWake(uint32_t msec_from_now) {
+  // Tickless sleep disabled - FUNC_SLEEP_LOOP already runs every millisecond
+}
+#endif  // USE_TICKLESS_SLEEP
+
 void SleepDelay(uint32_t mseconds) {
   if (!TasmotaGlobal.backlog_nodelay && mseconds) {
     uint32_t wait = millis() + mseconds;
+#ifdef USE_TICKLESS_SLEEP
+    // Sleep the budget in one tick-aligned wait bounded by the earliest driver deadline instead
+    // of spinning in 1ms slices. With automatic light sleep enabled in the SDK the idle task can
+    // then power down between ticks. Drivers needing sub-budget service (serial RX draining,
+    // interrupt follow-up) must declare their deadline with SleepRequestWake().
+    while (!TimeReached(wait) && !Serial.available()) {
+      XdrvXsnsCall(FUNC_SLEEP_LOOP);
+      int32_t chunk = -TimePassedSince(wait);      // Remaining budget in ms
+      if (chunk < 1) { break; }
+      if (tickless_next_wake) {
+        int32_t until_wake = -TimePassedSince(tickless_next_wake);
+        tickless_next_wake = 0;
+        if (until_wake < 1) { until_wake = 1; }
+        if (until_wake < chunk) { chunk = until_wake; }
+      }
+      delay(chunk);
+    }
+#else
     while (!TimeReached(wait) && !Serial.available()) {  // We need to service serial buffer ASAP as otherwise we get uart buffer overrun
       XdrvXsnsCall(FUNC_SLEEP_LOOP);  // Main purpose is reacting ASAP on serial data availability or interrupt handling (ADE7880)
       delay(1);
     }
+#endif  // USE_TICKLESS_SLEEP
   } else {
     delay(0);
   }
@@ -778,6 +907,9 @@ void Scheduler(void) {
 #ifdef USE_DEVICE_GROUPS
   DeviceGroupsLoop();
 #endif  // USE_DEVICE_GROUPS
+#if defined(ESP32) && defined(USE_I2C) && defined(USE_I2C_ASYNC)
+  I2cTransactionLoop();
+#endif  // ESP32 && USE_I2C && USE_I2C_ASYNC
   BacklogLoop();
 
   static uint32_t state_50msecond = 0;             // State 50msecond timer
@@ -790,25 +922,32 @@ void Scheduler(void) {
     XdrvXsnsCall(FUNC_EVERY_50_MSECOND);
   }
 
-  static uint32_t state_100msecond = 0;            // State 100msecond timer
+  // The periodic timers start phase-staggered so their common multiples do not pile the 100ms,
+  // 250ms and second work on top of the 50ms tick in a single loop pass every second
+  static uint32_t state_100msecond = 25;           // State 100msecond timer - 25ms phase offset
   if (TimeReached(state_100msecond)) {
     SetNextTimeInterval(state_100msecond, 100);
     Every100mSeconds();
     XdrvXsnsCall(FUNC_EVERY_100_MSECOND);
   }
 
-  static uint32_t state_250msecond = 0;            // State 250msecond timer
+  static uint32_t state_250msecond = 35;           // State 250msecond timer - 35ms phase offset
   if (TimeReached(state_250msecond)) {
     SetNextTimeInterval(state_250msecond, 250);
     Every250mSeconds();
     XdrvXsnsCall(FUNC_EVERY_250_MSECOND);
   }
 
-  static uint32_t state_second = 0;                // State second timer
+  static uint32_t state_second = 45;               // State second timer - 45ms phase offset
+  static uint32_t state_second_drivers = 0;        // Driver sweep timer, one tick after the second work
   if (TimeReached(state_second)) {
     SetNextTimeInterval(state_second, 1000);
     PerformEverySecond();
     XdrvCall(FUNC_ACTIVE);
+    state_second_drivers = millis() + 50;          // Dispatch the driver sweep in the next tick to split the load
+  }
+  if (state_second_drivers && TimeReached(state_second_drivers)) {
+    state_second_drivers = 0;
     XdrvXsnsCall(FUNC_EVERY_SECOND);
   }
 
@@ -831,16 +970,23 @@ void Scheduler(void) {
 void loop(void) {
   uint32_t my_sleep = millis();
 
+  if (XsnsCallNextInit()) { return; }              // Deferred sensor init - one sensor per pass without sleep so WiFi keeps pace
+
   Scheduler();
 
   uint32_t my_activity = millis() - my_sleep;
 
+#ifdef USE_SLEEP_GOVERNOR
+  uint32_t my_sleep_ms = SleepGovernorSleep(my_activity);
+#else
+  uint32_t my_sleep_ms = TasmotaGlobal.sleep;
+#endif  // USE_SLEEP_GOVERNOR
   if (Settings->flag3.sleep_normal) {              // SetOption60 - Enable normal sleep instead of dynamic sleep
     //  yield();                                   // yield == delay(0), delay contains yield, auto yield in loop
-    SleepDelay(TasmotaGlobal.sleep);               // https://github.com/esp8266/Arduino/issues/2021
+    SleepDelay(my_sleep_ms);                       // https://github.com/esp8266/Arduino/issues/2021
   } else {
-    if (my_activity < (uint32_t)TasmotaGlobal.sleep) {
-      SleepDelay((uint32_t)TasmotaGlobal.sleep - my_activity);  // Provide time for background tasks like wifi
+    if (my_activity < my_sleep_ms) {
+      SleepDelay(my_sleep_ms - my_activity);       // Provide time for background tasks like wifi
     } else {
       if (TasmotaGlobal.global_state.network_down) {
         SleepDelay(my_activity /2);                // If wifi down and my_activity > setoption36 then force loop delay to 1/2 of my_activity period
@@ -849,9 +995,13 @@ void loop(void) {
   }
 
   if (!my_activity) { my_activity++; }             // We cannot divide by 0
-  uint32_t loop_delay = TasmotaGlobal.sleep;
+  uint32_t loop_delay = my_sleep_ms;
   if (!loop_delay) { loop_delay++; }               // We cannot divide by 0
   uint32_t loops_per_second = 1000 / loop_delay;   // We need to keep track of this many loops per second
   uint32_t this_cycle_ratio = 100 * my_activity / loop_delay;
   TasmotaGlobal.loop_load_avg = TasmotaGlobal.loop_load_avg - (TasmotaGlobal.loop_load_avg / loops_per_second) + (this_cycle_ratio / loops_per_second); // Take away one loop average away and add the new one
+
+#ifndef FIRMWARE_MINIMAL
+  FlightRecorderTick(my_activity);                 // Log this iteration in the pre-crash flight recorder ring
+#endif  // FIRMWARE_MINIMAL
 }
@@ -72,6 +72,7 @@ void RtcSettingsSave(void) {
 
     rtc_settings_crc = GetRtcSettingsCrc();
   }
+  RtcRegistrySave();                   // Piggyback the driver registry, guarded by its own checksum
 }
 
 bool RtcSettingsLoad(uint32_t update) {
@@ -82,6 +83,8 @@ bool RtcSettingsLoad(uint32_t update) {
   RtcSettings = RtcDataSettings;
 #endif  // ESP32
 
+  RtcRegistryLoad();
+
   bool read_valid = (RTC_MEM_VALID == RtcSettings.valid);
   if (update) {
     if (!read_valid) {
@@ -147,6 +150,97 @@ bool RtcRebootValid(void) {
   return (RTC_MEM_VALID == RtcReboot.valid);
 }
 
+/*********************************************************************************************\
+ * RTC memory registry
+ *
+ * Generalized warm-boot persistence for drivers: a driver reserves a small slot under a
+ * fixed id and gets a pointer to its payload in a checksummed pool kept in RTC memory
+ * next to RtcSettings. The pool survives restarts and watchdog resets the same way
+ * RtcSettings does and comes back zeroed after power loss or a failed checksum. The
+ * whole pool is dropped when a slot changes size, e.g. after a firmware update.
+\*********************************************************************************************/
+
+enum RtcRegistryIds { RTC_REG_NONE = 0,      // Free slot marker
+                      RTC_REG_TELEPERIOD,    // TelePeriod phase (support_tasmota.ino)
+                      RTC_REG_COUNTER };     // Counter debounce pin state (xsns_01_counter.ino)
+
+const uint32_t RTC_REGISTRY_OFFSET = 32;     // ESP8266 RTC memory words 32..62 - words below 32 are used by the Arduino core OTA command, the crash flight recorder starts at 64
+const uint32_t RTC_REGISTRY_POOL = 120;      // Payload pool in bytes
+
+typedef struct {
+  uint16_t valid;                            // RTC_MEM_VALID
+  uint16_t crc;                              // Checksum over pool
+  uint8_t  pool[RTC_REGISTRY_POOL];          // Slots: id, size, 2 spare bytes, then payload padded to 32-bit
+} TRtcRegistry;
+TRtcRegistry RtcRegistry;
+#ifdef ESP32
+static RTC_NOINIT_ATTR TRtcRegistry RtcDataRegistry;
+#endif  // ESP32
+
+uint16_t rtc_registry_crc = 0;
+
+uint16_t GetRtcRegistryCrc(void) {
+  uint16_t crc = 0;
+  for (uint32_t i = 0; i < RTC_REGISTRY_POOL; i++) {
+    crc += RtcRegistry.pool[i]*(i+1);
+  }
+  return crc;
+}
+
+void RtcRegistrySave(void) {
+  if (GetRtcRegistryCrc() != rtc_registry_crc) {
+    RtcRegistry.valid = RTC_MEM_VALID;
+    RtcRegistry.crc = GetRtcRegistryCrc();
+#ifdef ESP8266
+    ESP.rtcUserMemoryWrite(RTC_REGISTRY_OFFSET, (uint32_t*)&RtcRegistry, sizeof(RtcRegistry));
+#endif  // ESP8266
+#ifdef ESP32
+    RtcDataRegistry = RtcRegistry;
+#endif  // ESP32
+    rtc_registry_crc = RtcRegistry.crc;
+  }
+}
+
+void RtcRegistryLoad(void) {
+#ifdef ESP8266
+  ESP.rtcUserMemoryRead(RTC_REGISTRY_OFFSET, (uint32_t*)&RtcRegistry, sizeof(RtcRegistry));
+#endif  // ESP8266
+#ifdef ESP32
+  RtcRegistry = RtcDataRegistry;
+#endif  // ESP32
+  if ((RTC_MEM_VALID != RtcRegistry.valid) || (GetRtcRegistryCrc() != RtcRegistry.crc)) {
+    memset(&RtcRegistry, 0, sizeof(RtcRegistry));  // Cold boot or corrupted - start empty
+    RtcRegistry.valid = RTC_MEM_VALID;
+  }
+  rtc_registry_crc = GetRtcRegistryCrc();
+}
+
+// Reserve (or find back) the slot for <id> and return a pointer to its <size> payload
+// bytes. On a warm boot the previous content is preserved, otherwise it is zeroed.
+// Returns nullptr when the pool is exhausted.
+uint8_t * RtcRegistryReserve(uint8_t id, uint8_t size) {
+  uint32_t idx = 0;
+  while ((idx +4) <= RTC_REGISTRY_POOL) {
+    uint8_t slot_id = RtcRegistry.pool[idx];
+    uint8_t slot_size = RtcRegistry.pool[idx +1];
+    if (RTC_REG_NONE == slot_id) { break; }            // Free space from here on
+    if (slot_id == id) {
+      if (slot_size == size) {
+        return &RtcRegistry.pool[idx +4];              // Found back, content preserved
+      }
+      memset(RtcRegistry.pool, 0, RTC_REGISTRY_POOL);  // Slot size changed - layout is void, start empty
+      idx = 0;
+      break;
+    }
+    idx += 4 + ((slot_size +3) & ~3);                  // Next slot, payload padded to 32-bit
+  }
+  if ((idx +4 + size) > RTC_REGISTRY_POOL) { return nullptr; }
+  RtcRegistry.pool[idx] = id;
+  RtcRegistry.pool[idx +1] = size;
+  memset(&RtcRegistry.pool[idx +4], 0, size);
+  return &RtcRegistry.pool[idx +4];
+}
+
 /*********************************************************************************************\
  * ESP8266 Tasmota Flash usage offset from 0x40200000
  *
@@ -219,6 +313,10 @@ uint32_t SETTINGS_LOCATION = EEPROM_LOCATION;
 const uint8_t CFG_ROTATES = 7;      // Number of flash sectors used (handles uploads)
 
 uint32_t settings_location = EEPROM_LOCATION;
+#ifdef ESP8266
+uint32_t settings_erased_location = 0;  // Flash slot pre-erased in idle time, 0 = none
+bool settings_erase_ahead = false;      // Request idle time erase of the next rotation slot
+#endif  // ESP8266
 uint32_t settings_crc32 = 0;
 uint32_t settings_size = 0;
 uint8_t *settings_buffer = nullptr;
@@ -556,6 +654,7 @@ bool SettingsConfigRestore(void) {
     SettingsDefaultSet2();
     memcpy((char*)Settings +16, settings_buffer +16, sizeof(TSettings) -16);
     Settings->version = buffer_version;            // Restore version and auto upgrade after restart
+    settings_text_index_valid = false;
   }
 
 #ifdef USE_UFILESYS
@@ -608,6 +707,18 @@ uint32_t GetSettingsTextLen(void) {
 bool settings_text_mutex = false;
 uint32_t settings_text_busy_count = 0;
 
+uint16_t settings_text_offset[SET_MAX];    // Start of every text in text_pool for O(1) lookup
+bool settings_text_index_valid = false;    // Invalidated whenever the pool is replaced wholesale
+
+void SettingsTextBuildIndex(void) {
+  char* position = Settings->text_pool;
+  for (uint32_t i = 0; i < SET_MAX; i++) {
+    settings_text_offset[i] = position - Settings->text_pool;
+    while (*position++ != '\0') { }
+  }
+  settings_text_index_valid = true;
+}
+
 bool SettingsUpdateFinished(void) {
   uint32_t wait_loop = 10;
   while (settings_text_mutex && wait_loop) {  // Wait for any update to finish
@@ -670,6 +781,13 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
     // Fill for future use
     memset(Settings->text_pool + char_len + diff, 0x00, settings_text_size - char_len - diff);
 
+    if (settings_text_index_valid && diff) {
+      // Texts after the replaced one shifted by diff - keep the lookup index in step
+      for (uint32_t i = index_save +1; i < SET_MAX; i++) {
+        settings_text_offset[i] += diff;
+      }
+    }
+
     settings_text_mutex = false;
   }
 
@@ -695,9 +813,10 @@ char* SettingsText(uint32_t index) {
     position += settings_text_size -1;  // Setting not supported - internal error - return empty string
   } else {
     SettingsUpdateFinished();
-    for (;index > 0; index--) {
-      while (*position++ != '\0') { }
+    if (!settings_text_index_valid) {
+      SettingsTextBuildIndex();
     }
+    position += settings_text_offset[index];
   }
   return position;
 }
@@ -715,6 +834,35 @@ uint32_t GetSettingsAddress(void) {
   return settings_location * SPI_FLASH_SEC_SIZE;
 }
 
+#ifdef ESP8266
+uint32_t SettingsNextLocation(void) {
+  // Predict the slot the next rotating SettingsSave will use
+  uint32_t location = settings_location;
+  if (location == EEPROM_LOCATION) {
+    location = SETTINGS_LOCATION;
+  } else {
+    location--;
+  }
+  if (location <= (SETTINGS_LOCATION - CFG_ROTATES)) {
+    location = EEPROM_LOCATION;
+  }
+  return location;
+}
+
+void SettingsEraseAhead(void) {
+  // Erase the predicted next rotation slot in idle time so the following SettingsSave only
+  // needs the fast page program instead of stalling the loop for a sector erase
+  if (!settings_erase_ahead) { return; }
+  settings_erase_ahead = false;
+  if (TasmotaGlobal.stop_flash_rotate) { return; }   // SetOption12 - Fixed slot holds the only live copy, never pre-erase it
+  uint32_t location = SettingsNextLocation();
+  if (location == settings_location) { return; }
+  if (ESP.flashEraseSector(location)) {
+    settings_erased_location = location;
+  }
+}
+#endif  // ESP8266
+
 void SettingsSave(uint8_t rotate) {
 /* Save configuration in eeprom or one of 7 slots below
  *
@@ -724,6 +872,7 @@ void SettingsSave(uint8_t rotate) {
  * stop_flash_rotate 0 = Allow flash slot rotation (SetOption12 0)
  * stop_flash_rotate 1 = Allow only eeprom flash slot use (SetOption12 1)
  */
+  TRACE_BEGIN(TRACE_SETTINGS_SAVE);
 #ifndef FIRMWARE_MINIMAL
   XsnsXdrvCall(FUNC_SAVE_SETTINGS);
   UpdateBackwardCompatibility();
@@ -761,9 +910,11 @@ void SettingsSave(uint8_t rotate) {
 #ifdef USE_UFILESYS
     TfsSaveFile(TASM_FILE_SETTINGS, (const uint8_t*)Settings, sizeof(TSettings));
 #endif  // USE_UFILESYS
-    if (ESP.flashEraseSector(settings_location)) {
+    if ((settings_erased_location == settings_location) || ESP.flashEraseSector(settings_location)) {
       ESP.flashWrite(settings_location * SPI_FLASH_SEC_SIZE, (uint32*)Settings, sizeof(TSettings));
     }
+    settings_erased_location = 0;
+    settings_erase_ahead = true;                       // Pre-erase the next slot once the loop is idle again
 
     if (!TasmotaGlobal.stop_flash_rotate && rotate) {  // SetOption12 - (Settings) Switch between dynamic (0) or fixed (1) slot flash save location
       for (uint32_t i = 0; i < CFG_ROTATES; i++) {
@@ -785,6 +936,7 @@ void SettingsSave(uint8_t rotate) {
 #ifdef USE_COUNTER
   CounterInterruptDisable(false);
 #endif
+  TRACE_END(TRACE_SETTINGS_SAVE);
 }
 void SettingsLoad(void) {
 #ifdef ESP8266
@@ -857,6 +1009,7 @@ void SettingsLoad(void) {
   }
   settings_crc32 = GetSettingsCrc32();
 #endif  // FIRMWARE_MINIMAL
+  settings_text_index_valid = false;
 
   RtcSettingsLoad(1);
 }
@@ -946,6 +1099,7 @@ void SettingsDefault(void) {
 
 void SettingsDefaultSet1(void) {
   memset(Settings, 0x00, sizeof(TSettings));
+  settings_text_index_valid = false;
 
   Settings->cfg_holder = (uint16_t)CFG_HOLDER;
   Settings->cfg_size = sizeof(TSettings);
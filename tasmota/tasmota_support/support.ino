@@ -368,11 +368,8 @@ float CharToFloat(const char *str)
     uint32_t max_decimals = 0;
     while ((max_decimals < 8) && isdigit(pt[max_decimals])) { max_decimals++; }
     pt[max_decimals] = '\0';                       // Limit decimals to float max of 8
-    right = atoi(pt);                              // Decimal part
-    while (isdigit(*pt)) {
-      pt++;
-      right /= 10.0f;
-    }
+    static const uint32_t kPow10[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    right = (float)atoi(pt) / (float)kPow10[max_decimals];  // One divide instead of one per decimal - ESP8266 soft-float division is expensive
   }
 
   float result = left + right;
@@ -1117,6 +1114,47 @@ char* GetTextIndexed(char* destination, size_t destination_size, uint32_t index,
   return destination;
 }
 
+char* GetGpioNameIndexed(char* destination, size_t destination_size, uint32_t index)
+{
+  // As GetTextIndexed() over kSensorNames but with the entry offsets cached on first use,
+  // turning the repeated O(n) PROGMEM scans of the GPIO dropdown and GPIOS loops into O(1) lookups
+  static uint16_t* gpio_name_offset = nullptr;
+
+  if (nullptr == gpio_name_offset) {
+    gpio_name_offset = (uint16_t*)malloc(GPIO_SENSOR_END * sizeof(uint16_t));
+    if (nullptr == gpio_name_offset) {
+      return GetTextIndexed(destination, destination_size, index, kSensorNames);  // Not enough memory
+    }
+    const char* read = kSensorNames;
+    uint32_t entry = 0;
+    gpio_name_offset[entry++] = 0;
+    char ch = '.';
+    while ((ch != '\0') && (entry < GPIO_SENSOR_END)) {
+      ch = pgm_read_byte(read++);
+      if ('|' == ch) {
+        gpio_name_offset[entry++] = read - kSensorNames;
+      }
+    }
+    while (entry < GPIO_SENSOR_END) {
+      gpio_name_offset[entry++] = 0;   // List shorter than enum - map to first entry (None)
+    }
+  }
+
+  char* write = destination;
+  if (index < GPIO_SENSOR_END) {
+    const char* read = kSensorNames + gpio_name_offset[index];
+    size_t size = destination_size -1;
+    char ch = pgm_read_byte(read++);
+    while ((ch != '\0') && (ch != '|') && size) {
+      *write++ = ch;
+      size--;
+      ch = pgm_read_byte(read++);
+    }
+  }
+  *write = '\0';
+  return destination;
+}
+
 int GetCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack)
 {
   // Returns -1 of not found
@@ -1214,6 +1252,54 @@ uint32_t GetHash(const char *buffer, size_t size)
   return hash;
 }
 
+/*********************************************************************************************\
+ * Entropy pool and fast random numbers
+ *
+ * HwRandom() reads the hardware RNG on ESP32 and harvests timing jitter on ESP8266, but
+ * it is too slow to call for every random word and callers each rolled their own mix of
+ * random() and HwRandom(). FastRandom() runs a xorshift128 PRNG reseeded from the
+ * hardware source, serving bulk needs (ports, delays, jitter) at a few cycles per word.
+ * GetRandomBytes() fills key material straight from the hardware source.
+\*********************************************************************************************/
+
+uint32_t fast_random_state[4];
+uint32_t fast_random_count = 0;
+
+uint32_t FastRandom(void) {
+  if (0 == (fast_random_count++ & 0xFF)) {     // Stir in fresh entropy every 256 draws
+    fast_random_state[0] ^= HwRandom();
+    fast_random_state[1] ^= HwRandom();
+    if (!(fast_random_state[0] | fast_random_state[1] | fast_random_state[2] | fast_random_state[3])) {
+      fast_random_state[3] = 1;                // xorshift must not start all zero
+    }
+  }
+  uint32_t t = fast_random_state[3];
+  uint32_t s = fast_random_state[0];
+  fast_random_state[3] = fast_random_state[2];
+  fast_random_state[2] = fast_random_state[1];
+  fast_random_state[1] = s;
+  t ^= t << 11;
+  t ^= t >> 8;
+  fast_random_state[0] = t ^ s ^ (s >> 19);
+  return fast_random_state[0];
+}
+
+uint32_t FastRandomRange(uint32_t lower, uint32_t upper) {
+  // Random number from lower to upper -1 like Arduino random(min, max)
+  if (upper <= lower) { return lower; }
+  return lower + (FastRandom() % (upper - lower));
+}
+
+void GetRandomBytes(uint8_t *buf, size_t len) {
+  // Key material straight from the hardware source, not the PRNG
+  uint32_t rnd = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (0 == (i & 3)) { rnd = HwRandom(); }
+    buf[i] = rnd;
+    rnd >>= 8;
+  }
+}
+
 void ShowSource(uint32_t source)
 {
   if ((source > 0) && (source < SRC_MAX)) {
@@ -1299,6 +1385,185 @@ void AllowInterrupts(bool state) {
   }
 }
 
+/*********************************************************************************************\
+ * Scratch arena for transient per-dispatch buffers
+ *
+ * Bump allocator over one fixed block allocated once at first use. Hot paths like command
+ * dispatch draw short-lived buffers from it instead of the heap, so repeated malloc/free
+ * cycles no longer fragment long-uptime ESP8266 heaps. Usage pattern:
+ *   uint32_t mark = ScratchMark();
+ *   char *buf = (char*)ScratchAlloc(64);    // heap fallback when arena is full
+ *   ...
+ *   ScratchFree(buf);                       // no-op for arena pointers, frees fallbacks
+ *   ScratchRelease(mark);                   // at end of dispatch, nesting safe
+\*********************************************************************************************/
+
+#ifdef USE_SCRATCH_ARENA
+
+#ifndef SCRATCH_ARENA_SIZE
+#define SCRATCH_ARENA_SIZE 768                 // Scratch arena size in bytes
+#endif
+
+char *scratch_arena = nullptr;
+uint32_t scratch_arena_used = 0;
+uint32_t scratch_arena_high = 0;               // High-water mark for sizing
+
+uint32_t ScratchMark(void) {
+  return scratch_arena_used;
+}
+
+void *ScratchAlloc(size_t size) {
+  if (nullptr == scratch_arena) {
+    scratch_arena = (char*)malloc(SCRATCH_ARENA_SIZE);   // One-time block, never released
+    if (nullptr == scratch_arena) {
+      return malloc(size);
+    }
+  }
+  size = (size + 3) & ~3;                      // Keep allocations 32-bit aligned
+  if (scratch_arena_used + size > SCRATCH_ARENA_SIZE) {
+    return malloc(size);                       // Arena full - fall back to heap
+  }
+  void *ptr = scratch_arena + scratch_arena_used;
+  scratch_arena_used += size;
+  if (scratch_arena_used > scratch_arena_high) { scratch_arena_high = scratch_arena_used; }
+  return ptr;
+}
+
+void ScratchFree(void *ptr) {
+  if (nullptr == ptr) { return; }
+  if (scratch_arena && ((char*)ptr >= scratch_arena) && ((char*)ptr < scratch_arena + SCRATCH_ARENA_SIZE)) {
+    return;                                    // Arena memory is reclaimed by ScratchRelease()
+  }
+  free(ptr);
+}
+
+void ScratchRelease(uint32_t mark) {
+  scratch_arena_used = mark;
+}
+
+#endif  // USE_SCRATCH_ARENA
+
+/*********************************************************************************************\
+ * Heap fragmentation monitor with pooled buffer recycling
+ *
+ * Tagged wrappers HEAP_POOL_MALLOC()/HEAP_POOL_FREE() around the transient buffers of
+ * String-heavy subsystems (Hue status fragments, command backlog entries). Freed blocks of
+ * the common 64/128/256 byte sizes are kept in small per-size caches and handed out again,
+ * so their churn no longer grinds long-uptime ESP8266 heaps into fragments. Command
+ * HeapStats reports heap fragmentation, pool effectiveness and per-tag allocation churn,
+ * pointing at the subsystem responsible when a device slowly runs out of usable heap.
+\*********************************************************************************************/
+
+#ifdef USE_HEAP_STATS
+
+#ifndef HEAP_POOL_DEPTH
+#define HEAP_POOL_DEPTH      4                 // Max recycled blocks kept per size class
+#endif
+#define HEAP_POOL_CLASSES    3                 // Size classes 64, 128 and 256 bytes
+#define HEAP_STATS_TAGS      12                // Max distinct allocation tags tracked
+
+const uint16_t kHeapPoolSizes[HEAP_POOL_CLASSES] = { 64, 128, 256 };
+
+struct HeapPoolHeader {                        // 8 byte header in front of every block
+  const char *tag;                             // Allocation tag for per-tag free accounting
+  uint32_t size_class;                         // Size class index or UINT32_MAX when not pooled
+};
+
+struct {
+  void *cache[HEAP_POOL_CLASSES][HEAP_POOL_DEPTH];  // Recycled blocks ready for reuse
+  uint8_t cached[HEAP_POOL_CLASSES];           // Number of blocks currently cached per class
+  uint32_t hits[HEAP_POOL_CLASSES];            // Allocations served from the cache
+  uint32_t misses[HEAP_POOL_CLASSES];          // Allocations that had to go to the heap
+} HeapPool;
+
+struct {
+  const char *tag;                             // nullptr marks an unused slot
+  uint32_t allocs;
+  uint32_t frees;
+  uint32_t bytes;                              // Cumulative bytes requested (churn, not live)
+} HeapTags[HEAP_STATS_TAGS];
+
+uint32_t HeapStatsTagSlot(const char *tag) {
+  // All .ino files share one translation unit so identical PSTR() tags merge and the
+  // pointer compare hits first. strcmp covers tags passed in from real libraries.
+  uint32_t empty = HEAP_STATS_TAGS;
+  for (uint32_t i = 0; i < HEAP_STATS_TAGS; i++) {
+    if (nullptr == HeapTags[i].tag) {
+      if (empty == HEAP_STATS_TAGS) { empty = i; }
+      continue;
+    }
+    if ((HeapTags[i].tag == tag) || (0 == strcmp(HeapTags[i].tag, tag))) { return i; }
+  }
+  if (empty < HEAP_STATS_TAGS) { HeapTags[empty].tag = tag; }
+  return empty;
+}
+
+void HeapStatsAccount(const char *tag, uint32_t size) {
+  uint32_t slot = HeapStatsTagSlot(tag);
+  if (slot >= HEAP_STATS_TAGS) { return; }     // Tag table full - allocation still succeeds
+  HeapTags[slot].allocs++;
+  HeapTags[slot].bytes += size;
+}
+
+void *HeapPoolMalloc(const char *tag, size_t size) {
+  uint32_t size_class = UINT32_MAX;
+  uint32_t block_size = size;
+  for (uint32_t i = 0; i < HEAP_POOL_CLASSES; i++) {
+    if (size <= kHeapPoolSizes[i]) {
+      size_class = i;
+      block_size = kHeapPoolSizes[i];
+      break;
+    }
+  }
+  HeapPoolHeader *block;
+  if ((size_class != UINT32_MAX) && HeapPool.cached[size_class]) {
+    block = (HeapPoolHeader*)HeapPool.cache[size_class][--HeapPool.cached[size_class]];
+    HeapPool.hits[size_class]++;
+  } else {
+    block = (HeapPoolHeader*)malloc(sizeof(HeapPoolHeader) + block_size);
+    if (size_class != UINT32_MAX) { HeapPool.misses[size_class]++; }
+    if (nullptr == block) { return nullptr; }
+  }
+  block->tag = tag;
+  block->size_class = size_class;
+  HeapStatsAccount(tag, size);
+  return (void*)(block + 1);
+}
+
+void HeapPoolFree(void *ptr) {
+  if (nullptr == ptr) { return; }
+  HeapPoolHeader *block = ((HeapPoolHeader*)ptr) - 1;
+  uint32_t slot = HeapStatsTagSlot(block->tag);
+  if (slot < HEAP_STATS_TAGS) { HeapTags[slot].frees++; }
+  uint32_t size_class = block->size_class;
+  if ((size_class < HEAP_POOL_CLASSES) && (HeapPool.cached[size_class] < HEAP_POOL_DEPTH)) {
+    HeapPool.cache[size_class][HeapPool.cached[size_class]++] = (void*)block;
+    return;
+  }
+  free(block);
+}
+
+void CmndHeapStats(void) {
+  Response_P(PSTR("{\"%s\":{\"Free\":%u,\"Largest\":%u,\"Frag\":%d,\"Pool\":{\"Sizes\":[%d,%d,%d],\"Hits\":[%u,%u,%u],\"Misses\":[%u,%u,%u],\"Cached\":[%d,%d,%d]}"),
+    XdrvMailbox.command, ESP_getFreeHeap(), ESP_getMaxAllocHeap(), ESP_getHeapFragmentation(),
+    kHeapPoolSizes[0], kHeapPoolSizes[1], kHeapPoolSizes[2],
+    HeapPool.hits[0], HeapPool.hits[1], HeapPool.hits[2],
+    HeapPool.misses[0], HeapPool.misses[1], HeapPool.misses[2],
+    HeapPool.cached[0], HeapPool.cached[1], HeapPool.cached[2]);
+  bool first_tag = true;
+  for (uint32_t i = 0; i < HEAP_STATS_TAGS; i++) {
+    if (nullptr == HeapTags[i].tag) { continue; }
+    ResponseAppend_P(PSTR("%s\"%s\":{\"Allocs\":%u,\"Frees\":%u,\"Bytes\":%u}"),
+      (first_tag) ? PSTR(",\"Tags\":{") : PSTR(","),
+      HeapTags[i].tag, HeapTags[i].allocs, HeapTags[i].frees, HeapTags[i].bytes);
+    first_tag = false;
+  }
+  if (!first_tag) { ResponseAppend_P(PSTR("}")); }
+  ResponseJsonEndEnd();
+}
+
+#endif  // USE_HEAP_STATS
+
 /*********************************************************************************************\
  * Response data handling
 \*********************************************************************************************/
@@ -1346,6 +1611,34 @@ void ResponseJsonStart(void) {
   TasmotaGlobal.mqtt_data.setCharAt(0,'{');
 }
 
+#ifdef USE_PROFILE_STATS
+// TasmotaGlobal.mqtt_data is an Arduino String so write cursor and capacity already travel
+// with the buffer and appends never rescan it. What still costs on the hot path are buffer
+// moves (realloc and copy on grow) and fragments silently lost to allocation failure.
+// Reported by command Profile, reset by Profile 1.
+struct {
+  uint32_t appends;                            // Append operations since (re)start
+  uint32_t moves;                              // Appends that forced the buffer to move
+  uint32_t drops;                              // Fragments lost to allocation failure
+  uint32_t max_len;                            // Longest response produced
+} ResponseStats;
+
+void ResponseStatsUpdate(const char *buffer_before, bool dropped) {
+  ResponseStats.appends++;
+  if (dropped) { ResponseStats.drops++; }
+  if (TasmotaGlobal.mqtt_data.c_str() != buffer_before) { ResponseStats.moves++; }
+  if (TasmotaGlobal.mqtt_data.length() > ResponseStats.max_len) {
+    ResponseStats.max_len = TasmotaGlobal.mqtt_data.length();
+  }
+}
+
+#define RESPONSE_STATS_BEFORE()  const char *stats_buffer = TasmotaGlobal.mqtt_data.c_str()
+#define RESPONSE_STATS_AFTER(DROPPED)  ResponseStatsUpdate(stats_buffer, (DROPPED))
+#else
+#define RESPONSE_STATS_BEFORE()
+#define RESPONSE_STATS_AFTER(DROPPED)
+#endif  // USE_PROFILE_STATS
+
 int Response_P(const char* format, ...)        // Content send snprintf_P char data
 {
   // This uses char strings. Be aware of sending %% if % is needed
@@ -1353,12 +1646,14 @@ int Response_P(const char* format, ...)        // Content send snprintf_P char d
   va_start(arg, format);
   char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
   va_end(arg);
+  RESPONSE_STATS_BEFORE();
   if (mqtt_data != nullptr) {
     TasmotaGlobal.mqtt_data = mqtt_data;
     free(mqtt_data);
   } else {
     TasmotaGlobal.mqtt_data = "";
   }
+  RESPONSE_STATS_AFTER(nullptr == mqtt_data);
   return TasmotaGlobal.mqtt_data.length();
 }
 
@@ -1372,10 +1667,12 @@ int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char d
   va_start(arg, format);
   char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
   va_end(arg);
+  RESPONSE_STATS_BEFORE();
   if (mqtt_data != nullptr) {
     TasmotaGlobal.mqtt_data += mqtt_data;
     free(mqtt_data);
   }
+  RESPONSE_STATS_AFTER(nullptr == mqtt_data);
   return TasmotaGlobal.mqtt_data.length();
 }
 
@@ -1386,10 +1683,22 @@ int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char d
   va_start(arg, format);
   char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
   va_end(arg);
+  RESPONSE_STATS_BEFORE();
   if (mqtt_data != nullptr) {
     TasmotaGlobal.mqtt_data += mqtt_data;
     free(mqtt_data);
   }
+  RESPONSE_STATS_AFTER(nullptr == mqtt_data);
+  return TasmotaGlobal.mqtt_data.length();
+}
+
+int ResponseAppendBuffer(const char* buffer, uint32_t size)  // Append counted bytes as-is
+{
+  // Callers that already hold a length-tracked buffer (like Berry strings) append directly,
+  // skipping the printf path and its intermediate malloc/copy
+  RESPONSE_STATS_BEFORE();
+  bool appended = TasmotaGlobal.mqtt_data.concat(buffer, size);
+  RESPONSE_STATS_AFTER(!appended);
   return TasmotaGlobal.mqtt_data.length();
 }
 
@@ -1429,6 +1738,13 @@ int ResponseJsonEndEnd(void)
   return ResponseAppend_P(PSTR("}}"));
 }
 
+void ResponseTruncate(uint32_t length) {
+  // Drop response content appended after <length>, used to roll back unwanted fragments
+  if (length < TasmotaGlobal.mqtt_data.length()) {
+    TasmotaGlobal.mqtt_data.remove(length);
+  }
+}
+
 bool ResponseContains_P(const char* needle) {
 /*
   return (strstr_P(TasmotaGlobal.mqtt_data.c_str(), needle) != nullptr);
@@ -1668,8 +1984,24 @@ void GetInternalTemplate(void* ptr, uint32_t module, uint32_t option) {
 const uint8_t Esp32TemplateToPhy[MAX_USER_PINS] = { ESP32_TEMPLATE_TO_PHY };
 #endif // CONFIG_IDF_TARGET_ESP32
 
+myio template_gpios_cache;                // Resolved template of the active module
+uint8_t template_gpios_module;            // Module the cache was resolved for
+bool template_gpios_valid = false;
+
+void TemplateGpiosInvalidate(void) {
+  // Call after changing Settings->user_template so the resolved cache is rebuilt
+  template_gpios_valid = false;
+}
+
 void TemplateGpios(myio *gp)
 {
+  // The resolved template is cached per module so boot and the configuration pages do not
+  // re-derive the physical pin expansion on every query
+  if (template_gpios_valid && (template_gpios_module == Settings->module)) {
+    memcpy(gp, &template_gpios_cache, sizeof(myio));
+    return;
+  }
+
   uint16_t *dest = (uint16_t *)gp;
   uint16_t src[nitems(Settings->user_template.gp.io)];
 
@@ -1728,6 +2060,10 @@ void TemplateGpios(myio *gp)
   // 11 85 00 85 85 00 00 00 00 00 00 00 15 38 85 00 00 81
 
 //  AddLog(LOG_LEVEL_DEBUG, PSTR("DBG: TemplateGpiosOut %*_H"), sizeof(myio), (uint8_t *)gp);
+
+  memcpy(&template_gpios_cache, gp, sizeof(myio));
+  template_gpios_module = Settings->module;
+  template_gpios_valid = true;
 }
 
 gpio_flag ModuleFlag(void)
@@ -1765,6 +2101,7 @@ void ModuleDefault(uint32_t module)
 #ifdef ESP32
   memcpy_P(&Settings->user_template, &kModules[module], sizeof(mytmplt));
 #endif  // ESP32
+  TemplateGpiosInvalidate();
 }
 
 void SetModuleType(void)
@@ -1923,6 +2260,7 @@ bool JsonTemplate(char* dataBuf)
     if ((0 == base) || !ValidTemplateModule(base -1)) { base = 18; }
     Settings->user_template_base = base -1;  // Default WEMOS
   }
+  TemplateGpiosInvalidate();
 
   val = root[PSTR(D_JSON_CMND)];
   if (val) {
@@ -2423,42 +2761,46 @@ void SetSyslog(uint32_t loglevel)
   TasmotaGlobal.syslog_timer = 0;
 }
 
+void SyslogBackoff(uint16_t* retry_secs) {
+  // Exponential backoff - the first failure waits SYSLOG_RETRY_TIME seconds and every subsequent
+  // failure doubles the wait up to SYSLOG_TIMER seconds. syslog_timer restores syslog_level.
+  *retry_secs = (*retry_secs) ? *retry_secs * 2 : SYSLOG_RETRY_TIME;
+  if (*retry_secs > SYSLOG_TIMER) { *retry_secs = SYSLOG_TIMER; }
+  TasmotaGlobal.syslog_level = 0;
+  TasmotaGlobal.syslog_timer = *retry_secs;
+}
+
 void SyslogAsync(bool refresh) {
-  static IPAddress syslog_host_addr;      // Syslog host IP address
-  static uint32_t syslog_host_hash = 0;   // Syslog host name hash
   static uint32_t index = 1;
+  static uint16_t syslog_retry = 0;       // Current backoff in seconds, doubled on every failure
 
   if (!TasmotaGlobal.syslog_level || TasmotaGlobal.global_state.network_down) { return; }
   if (refresh && !NeedLogRefresh(TasmotaGlobal.syslog_level, index)) { return; }
 
   char* line;
   size_t len;
+  IPAddress syslog_host_addr;             // Syslog host IP address
+  bool resolved = false;
+  bool in_packet = false;
+  uint32_t packet_len = 0;
+  char header[64];
+  header[0] = '\0';
+  uint32_t header_len = 0;
   while (GetLog(TasmotaGlobal.syslog_level, &index, &line, &len)) {
     // <--- mxtime ---> TAG: <---------------------- MSG ---------------------------->
     // 00:00:02.096-029 HTP: Web server active on wemos5 with IP address 192.168.2.172
     //                  HTP: Web server active on wemos5 with IP address 192.168.2.172
     uint32_t mxtime = strchr(line, ' ') - line +1;  // Remove mxtime
     if (mxtime > 0) {
-      uint32_t current_hash = GetHash(SettingsText(SET_SYSLOG_HOST), strlen(SettingsText(SET_SYSLOG_HOST)));
-      if (syslog_host_hash != current_hash) {
-        IPAddress temp_syslog_host_addr;
-        if (!WifiHostByName(SettingsText(SET_SYSLOG_HOST), temp_syslog_host_addr)) {  // If sleep enabled this might result in exception so try to do it once using hash
-          TasmotaGlobal.syslog_level = 0;
-          TasmotaGlobal.syslog_timer = SYSLOG_TIMER;
-          AddLog(LOG_LEVEL_INFO, PSTR("SLG: " D_RETRY_IN " %d " D_UNIT_SECOND), SYSLOG_TIMER);
+      if (!resolved) {
+        if (!NetworkHostByName(SettingsText(SET_SYSLOG_HOST), syslog_host_addr)) {  // Positive/negative cached - no query per message
+          SyslogBackoff(&syslog_retry);
+          AddLog(LOG_LEVEL_INFO, PSTR("SLG: " D_RETRY_IN " %d " D_UNIT_SECOND), TasmotaGlobal.syslog_timer);
           return;
         }
-        syslog_host_hash = current_hash;
-        syslog_host_addr = temp_syslog_host_addr;
-      }
-      if (!PortUdp.beginPacket(syslog_host_addr, Settings->syslog_port)) {
-        TasmotaGlobal.syslog_level = 0;
-        TasmotaGlobal.syslog_timer = SYSLOG_TIMER;
-        AddLog(LOG_LEVEL_INFO, PSTR("SLG: " D_SYSLOG_HOST_NOT_FOUND ". " D_RETRY_IN " %d " D_UNIT_SECOND), SYSLOG_TIMER);
-        return;
+        resolved = true;
       }
 
-      char header[64];
       /* Legacy format (until v13.3.0.1) - HOSTNAME TAG: MSG
          SYSLOG-MSG = wemos5 ESP-HTP: Web server active on wemos5 with IP address 192.168.2.172
          Result = 2023-12-20T13:41:11.825749+01:00 wemos5 ESP-HTP: Web server active on wemos5 with IP address 192.168.2.172
@@ -2474,7 +2816,10 @@ void SyslogAsync(bool refresh) {
          Result = 2023-12-21T11:31:50.378816+01:00 wemos5 ESP-HTP: Web server active on wemos5 with IP address 192.168.2.172
          Notice in both cases the date and time is taken from the syslog server. Uncompression message is gone.
       */
-      snprintf_P(header, sizeof(header), PSTR("<134>%s ESP-"), NetworkHostname());
+      if (!header_len) {
+        snprintf_P(header, sizeof(header), PSTR("<134>%s ESP-"), NetworkHostname());
+        header_len = strlen(header);
+      }
 
 //       SYSLOG-MSG = <134>wemos5 Tasmota HTP: Web server active on wemos5 with IP address 192.168.2.172
 //       Result = 2023-12-21T11:31:50.378816+01:00 wemos5 Tasmota HTP: Web server active on wemos5 with IP address 192.168.2.172
@@ -2517,27 +2862,61 @@ void SyslogAsync(bool refresh) {
 //      snprintf_P(header, sizeof(header), PSTR("<134>1 %s %s Tasmota - - "), systime.c_str(), NetworkHostname());
 
       char* line_start = line +mxtime;
+      int32_t log_len = len -mxtime -1;
+
+      // Batch framed messages (RFC 6587 non-transparent framing - each message ends with a LF)
+      // into a single datagram. Flush when the next message would no longer fit.
+      if (in_packet && (packet_len + header_len + log_len + 1 > SYSLOG_BATCH_SIZE)) {
+        PortUdp.endPacket();
+        in_packet = false;
+        delay(1);                          // Add time for UDP handling (#5512)
+      }
 #ifdef ESP8266
       // Packets over 1460 bytes are not send
       uint32_t line_len;
-      int32_t log_len = len -mxtime -1;
       while (log_len > 0) {
+        if (!in_packet) {
+          if (!PortUdp.beginPacket(syslog_host_addr, Settings->syslog_port)) { goto unreachable; }
+          in_packet = true;
+          packet_len = 0;
+        }
         PortUdp.write(header);
         line_len = (log_len > 1460) ? 1460 : log_len;
         PortUdp.write((uint8_t*)line_start, line_len);
-        PortUdp.endPacket();
+        PortUdp.write((uint8_t)'\n');
+        packet_len += header_len + line_len + 1;
         log_len -= 1460;
         line_start += 1460;
+        if (log_len > 0) {                 // Oversized line - send each chunk in its own datagram
+          PortUdp.endPacket();
+          in_packet = false;
+          delay(1);                        // Add time for UDP handling (#5512)
+        }
       }
 #else
-      PortUdp.write((const uint8_t*)header, strlen(header));
-      PortUdp.write((uint8_t*)line_start, len -mxtime -1);
-      PortUdp.endPacket();
+      if (!in_packet) {
+        if (!PortUdp.beginPacket(syslog_host_addr, Settings->syslog_port)) { goto unreachable; }
+        in_packet = true;
+        packet_len = 0;
+      }
+      PortUdp.write((const uint8_t*)header, header_len);
+      PortUdp.write((uint8_t*)line_start, log_len);
+      PortUdp.write((uint8_t)'\n');
+      packet_len += header_len + log_len + 1;
 #endif
-
-      delay(1);                          // Add time for UDP handling (#5512)
     }
   }
+
+  if (in_packet) {
+    PortUdp.endPacket();
+    delay(1);                              // Add time for UDP handling (#5512)
+  }
+  syslog_retry = 0;                        // The collector is reachable again - reset the backoff
+  return;
+
+unreachable:
+  SyslogBackoff(&syslog_retry);
+  AddLog(LOG_LEVEL_INFO, PSTR("SLG: " D_SYSLOG_HOST_NOT_FOUND ". " D_RETRY_IN " %d " D_UNIT_SECOND), TasmotaGlobal.syslog_timer);
 }
 
 bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
@@ -2550,7 +2929,7 @@ bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
 #endif  // ESP32
 
   // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (TasmotaGlobal.log_buffer_len < LOG_BUFFER_SIZE / 2) { return false; }
 
   char* line;
   size_t len;
@@ -2613,6 +2992,28 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
   // Store log_data in buffer
   // To lower heap usage log_data_payload may contain the payload data from MqttPublishPayload()
   //  and log_data_retained may contain optional retained message from MqttPublishPayload()
+
+  // Evaluate the per-sink level gates before doing any work so suppressed messages cost no more
+  // than these compares - no timestamp formatting and no mutex round trip.
+  bool serial_log = ((loglevel <= TasmotaGlobal.seriallog_level) &&
+                     (TasmotaGlobal.masterlog_level <= TasmotaGlobal.seriallog_level));
+
+  uint32_t highest_loglevel = Settings->weblog_level;
+  if (Settings->mqttlog_level > highest_loglevel) { highest_loglevel = Settings->mqttlog_level; }
+#ifdef USE_UFILESYS
+  uint32_t filelog_level = Settings->filelog_level % 10;
+  if (filelog_level > highest_loglevel) { highest_loglevel = filelog_level; }
+#endif  // USE_UFILESYS
+  if (TasmotaGlobal.syslog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.syslog_level; }
+  if (TasmotaGlobal.templog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.templog_level; }
+  if (TasmotaGlobal.uptime < 3) { highest_loglevel = LOG_LEVEL_DEBUG_MORE; }  // Log all before setup correct log level
+
+  bool buffer_log = (TasmotaGlobal.log_buffer &&
+                     (loglevel <= highest_loglevel) &&  // Log only when needed
+                     (TasmotaGlobal.masterlog_level <= highest_loglevel));
+
+  if (!serial_log && !buffer_log) { return; }
+
 #ifdef ESP32
   // this takes the mutex, and will be release when the class is destroyed -
   // i.e. when the functon leaves  You CAN call mutex.give() to leave early.
@@ -2637,28 +3038,14 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
   if (!log_data_payload) { log_data_payload = empty; }
   if (!log_data_retained) { log_data_retained = empty; }
 
-  if ((loglevel <= TasmotaGlobal.seriallog_level) &&
-      (TasmotaGlobal.masterlog_level <= TasmotaGlobal.seriallog_level)) {
+  if (serial_log) {
     TasConsole.printf("%s%s%s%s\r\n", mxtime, log_data, log_data_payload, log_data_retained);
 #ifdef USE_SERIAL_BRIDGE
     SerialBridgePrintf("%s%s%s%s\r\n", mxtime, log_data, log_data_payload, log_data_retained);
 #endif  // USE_SERIAL_BRIDGE
   }
 
-  if (!TasmotaGlobal.log_buffer) { return; }  // Leave now if there is no buffer available
-
-  uint32_t highest_loglevel = Settings->weblog_level;
-  if (Settings->mqttlog_level > highest_loglevel) { highest_loglevel = Settings->mqttlog_level; }
-#ifdef USE_UFILESYS
-  uint32_t filelog_level = Settings->filelog_level % 10;
-  if (filelog_level > highest_loglevel) { highest_loglevel = filelog_level; }
-#endif  // USE_UFILESYS
-  if (TasmotaGlobal.syslog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.syslog_level; }
-  if (TasmotaGlobal.templog_level > highest_loglevel) { highest_loglevel = TasmotaGlobal.templog_level; }
-  if (TasmotaGlobal.uptime < 3) { highest_loglevel = LOG_LEVEL_DEBUG_MORE; }  // Log all before setup correct log level
-
-  if ((loglevel <= highest_loglevel) &&    // Log only when needed
-      (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
+  if (buffer_log) {
     // Delimited, zero-terminated buffer of log lines.
     // Each entry has this format: [index][loglevel][log data]['\1']
 
@@ -2672,6 +3059,7 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
       log_data = too_long;
       log_data_payload = empty;
       log_data_retained = empty;
+      log_data_len = strlen(log_data);
     }
 
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
@@ -2679,16 +3067,19 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
       TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
     }
     while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
+           TasmotaGlobal.log_buffer_len + log_data_len + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
     {
       char* it = TasmotaGlobal.log_buffer;
       it++;                                // Skip log_buffer_pointer
       it += strchrspn(it, '\1');           // Skip log line
       it++;                                // Skip delimiting "\1"
       memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
+      TasmotaGlobal.log_buffer_len -= (it - TasmotaGlobal.log_buffer);
     }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
+    // Append at the tracked tail instead of reformatting the whole buffer through snprintf which
+    // makes the append cost proportional to the new entry instead of the buffer size
+    TasmotaGlobal.log_buffer_len += snprintf_P(TasmotaGlobal.log_buffer + TasmotaGlobal.log_buffer_len, LOG_BUFFER_SIZE - TasmotaGlobal.log_buffer_len, PSTR("%c%c%s%s%s%s\1"),
+      TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
     if (too_long) { free(too_long); }
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
@@ -437,4 +437,90 @@ bool I2cSetDevice(uint32_t addr, uint8_t bus = 0) {
   }
   return (0 == err);
 }
+
+#if defined(ESP32) && defined(USE_I2C_ASYNC)
+/*********************************************************************************************\
+ * Queued I2C transactions - USE_I2C_ASYNC
+ *
+ * Drivers submit read/write descriptors with an optional completion callback instead of
+ * blocking inside their periodic tick. A few transactions are executed from every main loop
+ * pass, so with many sensors on a bus the work spreads over loop passes instead of
+ * serializing inside a single 250ms tick. Consecutive descriptors for the same bus run back
+ * to back as one batch. The synchronous API above stays available and remains the only
+ * option on ESP8266.
+\*********************************************************************************************/
+
+const uint8_t I2C_QUEUE_SIZE = 16;          // Pending transaction descriptors
+const uint8_t I2C_QUEUE_BATCHES = 2;        // Per-bus batches executed per loop pass
+
+typedef void (*I2cCallback)(bool ok, uint8_t *data, void *arg);
+
+struct I2CTRANSACTION {
+  I2cCallback callback;
+  void *arg;
+  uint8_t *data;
+  uint8_t addr;
+  uint8_t reg;
+  uint8_t len;
+  uint8_t bus;
+  bool write;
+};
+
+struct I2CQUEUE {
+  I2CTRANSACTION pending[I2C_QUEUE_SIZE];
+  uint8_t head;
+  uint8_t tail;
+  uint8_t count;
+} I2cQueue;
+
+bool I2cQueueTransaction(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t len, bool write, uint8_t bus, I2cCallback callback, void *arg) {
+  if (I2cQueue.count >= I2C_QUEUE_SIZE) { return false; }  // Queue full - caller falls back to the synchronous API
+  I2CTRANSACTION& trans = I2cQueue.pending[I2cQueue.head];
+  trans.callback = callback;
+  trans.arg = arg;
+  trans.data = data;
+  trans.addr = addr;
+  trans.reg = reg;
+  trans.len = len;
+  trans.bus = bus;
+  trans.write = write;
+  I2cQueue.head = (I2cQueue.head +1) % I2C_QUEUE_SIZE;
+  I2cQueue.count++;
+  return true;
+}
+
+bool I2cQueueRead(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t len, uint8_t bus = 0, I2cCallback callback = nullptr, void *arg = nullptr);
+bool I2cQueueRead(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t len, uint8_t bus, I2cCallback callback, void *arg) {
+  return I2cQueueTransaction(addr, reg, data, len, false, bus, callback, arg);
+}
+
+bool I2cQueueWrite(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t len, uint8_t bus = 0, I2cCallback callback = nullptr, void *arg = nullptr);
+bool I2cQueueWrite(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t len, uint8_t bus, I2cCallback callback, void *arg) {
+  return I2cQueueTransaction(addr, reg, data, len, true, bus, callback, arg);
+}
+
+void I2cTransactionLoop(void) {
+  uint32_t batches = 0;
+  int32_t last_bus = -1;
+  while (I2cQueue.count) {
+    I2CTRANSACTION trans = I2cQueue.pending[I2cQueue.tail];
+    if (trans.bus != last_bus) {
+      if (I2C_QUEUE_BATCHES == batches) { break; }         // Remaining transactions run next pass
+      batches++;
+      last_bus = trans.bus;
+    }
+    I2cQueue.tail = (I2cQueue.tail +1) % I2C_QUEUE_SIZE;
+    I2cQueue.count--;
+    bool ok;
+    if (trans.write) {
+      ok = !I2cWriteBuffer(trans.addr, trans.reg, trans.data, trans.len, trans.bus);
+    } else {
+      ok = !I2cReadBuffer(trans.addr, trans.reg, trans.data, trans.len, trans.bus);
+    }
+    if (trans.callback) {
+      trans.callback(ok, trans.data, trans.arg);
+    }
+  }
+}
+#endif  // ESP32 && USE_I2C_ASYNC
 #endif  // USE_I2C
\ No newline at end of file
@@ -41,6 +41,8 @@ const char kMultiPress[] PROGMEM = "|SINGLE|DOUBLE|TRIPLE|QUAD|PENTA|CLEAR|";
 
 Ticker TickerButton;
 
+void IRAM_ATTR ButtonEdgeIsr(void *arg);
+
 struct BUTTON {
   uint32_t debounce = 0;                        // Button debounce timer
   uint32_t no_pullup_mask = 0;                  // key no pullup flag (1 = no pullup)
@@ -48,6 +50,8 @@ struct BUTTON {
   uint32_t inverted_mask = 0;                   // Key inverted flag (1 = inverted)
   uint32_t used = 0;                            // Key used bitmask
   uint32_t virtual_pin = 0;                     // Key state bitmask
+  uint32_t isr_attached = 0;                    // Key edge interrupt attached bitmask
+  volatile uint32_t edge_pending = 0;           // Key edge seen by interrupt, not yet consumed by ButtonProbe
   uint16_t hold_timer[MAX_KEYS_SET] = { 0 };    // Timer for button hold
   uint16_t dual_code = 0;                       // Sonoff dual received code
   uint8_t state[MAX_KEYS_SET] = { 0 };
@@ -55,7 +59,9 @@ struct BUTTON {
   uint8_t debounced_state[MAX_KEYS_SET];        // Button debounced states
   uint8_t window_timer[MAX_KEYS_SET] = { 0 };   // Max time between button presses to record press count
   uint8_t press_counter[MAX_KEYS_SET] = { 0 };  // Number of button presses within Button.window_timer
+  uint8_t isr_index[MAX_KEYS_SET];              // Key index passed to the edge interrupt
   uint8_t dual_receive_count = 0;               // Sonoff dual input flag
+  uint8_t full_scan_countdown = 0;              // Probes left until the next failsafe full scan
   uint8_t first_change = 0;
   bool probe_mutex;
 } Button;
@@ -113,6 +119,11 @@ bool ButtonUsed(uint32_t index) {
 
 /*********************************************************************************************/
 
+void IRAM_ATTR ButtonEdgeIsr(void *arg) {
+  // Record the edge so ButtonProbe() polls this pin; quiet pins are skipped entirely
+  bitSet(Button.edge_pending, *static_cast<uint8_t*>(arg));
+}
+
 void ButtonProbe(void) {
   if (Button.probe_mutex || (TasmotaGlobal.uptime < 4)) { return; }  // Block GPIO for 4 seconds after poweron to workaround Wemos D1 / Obi RTS circuit
   Button.probe_mutex = true;
@@ -136,9 +147,25 @@ void ButtonProbe(void) {
     state_filter = Settings->button_debounce / BUTTON_PROBE_INTERVAL;	// 5, 10, 15
   }
 
+  bool full_scan = true;
+  uint32_t edges = Button.edge_pending;
+  if (Button.isr_attached) {
+    Button.edge_pending &= ~edges;                             // Keep edges arriving during this probe for the next one
+    if (Button.full_scan_countdown) {
+      Button.full_scan_countdown--;
+      full_scan = false;
+    } else {
+      Button.full_scan_countdown = 1000 / BUTTON_PROBE_INTERVAL;  // Failsafe poll in case an edge was missed
+    }
+  }
+
   uint32_t not_activated;
   for (uint32_t i = 0; i < MAX_KEYS_SET; i++) {
     if (!bitRead(Button.used, i)) { continue; }
+    if (!full_scan && bitRead(Button.isr_attached, i) && !bitRead(edges, i) &&
+        ((Button.debounced_state[i] ? state_filter : 0) == Button.state[i])) {
+      continue;                                                // No edge since last probe and debounce settled
+    }
 
     if (PinUsed(GPIO_KEY1, i)) {
 #if defined(SOC_TOUCH_VERSION_1) || defined(SOC_TOUCH_VERSION_2)
@@ -237,6 +264,7 @@ void ButtonProbe(void) {
 void ButtonInit(void) {
   bool ac_detect = (Settings->button_debounce % 10 == 9);
   Button.used = 0;
+  Button.isr_attached = 0;
 /*
   uint32_t last_used = 0;
 */
@@ -261,6 +289,18 @@ void ButtonInit(void) {
         Button.state[i] = 0x80 + 2 * BUTTON_AC_PERIOD;
         Button.last_state[i] = 0;				 // Will set later in the debouncing code
       }
+      if (!ac_detect                             // AC detection needs continuous sampling
+#if defined(SOC_TOUCH_VERSION_1) || defined(SOC_TOUCH_VERSION_2)
+          && !bitRead(TouchButton.touch_mask, i) // Touch buttons have no digital edges
+#endif  // ESP32 SOC_TOUCH_VERSION_1 or SOC_TOUCH_VERSION_2
+#ifdef ESP8266
+          && (16 != Pin(GPIO_KEY1, i))           // GPIO16 does not support interrupts
+#endif  // ESP8266
+         ) {
+        Button.isr_index[i] = i;
+        attachInterruptArg(Pin(GPIO_KEY1, i), ButtonEdgeIsr, &Button.isr_index[i], CHANGE);
+        bitSet(Button.isr_attached, i);          // Probe this pin on edges only
+      }
     }
 #ifdef USE_ADC
     else if (PinUsed(GPIO_ADC_BUTTON, i) || PinUsed(GPIO_ADC_BUTTON_INV, i)) {
@@ -48,9 +48,30 @@ const char kTasmotaCommands[] PROGMEM = "|"  // No prefix
 #endif  // USE_DEVICE_GROUPS_SEND
   D_CMND_DEVGROUP_SHARE "|" D_CMND_DEVGROUPSTATUS "|" D_CMND_DEVGROUP_TIE "|"
 #endif  // USE_DEVICE_GROUPS
-  D_CMND_SETSENSOR "|" D_CMND_SENSOR "|" D_CMND_DRIVER "|" D_CMND_JSON
+#ifdef USE_PROFILE_STATS
+  "Profile|"
+#endif  // USE_PROFILE_STATS
+#ifdef USE_BENCHMARK
+  "Benchmark|"
+#endif  // USE_BENCHMARK
+#ifdef USE_PROFILE_TRACE
+  "Trace|TracePin|"
+#endif  // USE_PROFILE_TRACE
+#ifdef USE_HEAP_STATS
+  "HeapStats|"
+#endif  // USE_HEAP_STATS
+#if defined(USE_TELEMETRY_RING) && defined(ESP32)
+  "Telemetry|"
+#endif  // USE_TELEMETRY_RING
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+  "KvStore|"
+#endif  // USE_KVSTORE
+#ifdef USE_SENSOR_DELTA
+  "SensorDelta|"
+#endif  // USE_SENSOR_DELTA
+  D_CMND_SETSENSOR "|" D_CMND_SENSOR "|" D_CMND_SENSORINTERVAL "|" D_CMND_DRIVER "|" D_CMND_JSON
 #ifdef ESP32
-   "|Info|"
+   "|Info|" "MemStats|"
 #if defined(SOC_TOUCH_VERSION_1) || defined(SOC_TOUCH_VERSION_2)
   D_CMND_TOUCH_CAL "|" D_CMND_TOUCH_THRES "|"
 #endif  // ESP32 SOC_TOUCH_VERSION_1 or SOC_TOUCH_VERSION_2
@@ -91,9 +112,30 @@ void (* const TasmotaCommand[])(void) PROGMEM = {
 #endif  // USE_DEVICE_GROUPS_SEND
   &CmndDevGroupShare, &CmndDevGroupStatus, &CmndDevGroupTie,
 #endif  // USE_DEVICE_GROUPS
-  &CmndSetSensor, &CmndSensor, &CmndDriver, &CmndJson
+#ifdef USE_PROFILE_STATS
+  &CmndProfile,
+#endif  // USE_PROFILE_STATS
+#ifdef USE_BENCHMARK
+  &CmndBenchmark,
+#endif  // USE_BENCHMARK
+#ifdef USE_PROFILE_TRACE
+  &CmndTrace, &CmndTracePin,
+#endif  // USE_PROFILE_TRACE
+#ifdef USE_HEAP_STATS
+  &CmndHeapStats,
+#endif  // USE_HEAP_STATS
+#if defined(USE_TELEMETRY_RING) && defined(ESP32)
+  &CmndTelemetry,
+#endif  // USE_TELEMETRY_RING
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+  &CmndKvStore,
+#endif  // USE_KVSTORE
+#ifdef USE_SENSOR_DELTA
+  &CmndSensorDelta,
+#endif  // USE_SENSOR_DELTA
+  &CmndSetSensor, &CmndSensor, &CmndSensorInterval, &CmndDriver, &CmndJson
 #ifdef ESP32
-  , &CmndInfo,
+  , &CmndInfo, &CmndMemStats,
 #if defined(SOC_TOUCH_VERSION_1) || defined(SOC_TOUCH_VERSION_2)
   &CmndTouchCal, &CmndTouchThres,
 #endif  // ESP32 SOC_TOUCH_VERSION_1 or SOC_TOUCH_VERSION_2
@@ -126,39 +168,7 @@ void CmndWifiScan(void)
       ResponseCmndChar(D_JSON_SCANNING);
     } else {  //show scan result
       Response_P(PSTR("{\"" D_CMND_WIFISCAN "\":"));
-
-      if (WiFi.scanComplete() > 0) {
-        // Sort networks by RSSI
-        uint32_t indexes[WiFi.scanComplete()];
-        for (uint32_t i = 0; i < WiFi.scanComplete(); i++) {
-          indexes[i] = i;
-        }
-        for (uint32_t i = 0; i < WiFi.scanComplete(); i++) {
-          for (uint32_t j = i + 1; j < WiFi.scanComplete(); j++) {
-            if (WiFi.RSSI(indexes[j]) > WiFi.RSSI(indexes[i])) {
-              std::swap(indexes[i], indexes[j]);
-            }
-          }
-        }
-        delay(0);
-
-        ResponseAppend_P(PSTR("{"));
-        for (uint32_t i = 0; i < WiFi.scanComplete(); i++) {
-          ResponseAppend_P(PSTR("\"" D_STATUS5_NETWORK "%d\":{\"" D_SSID "\":\"%s\",\"" D_BSSID "\":\"%s\",\"" D_CHANNEL
-                          "\":\"%d\",\"" D_JSON_SIGNAL "\":\"%d\",\"" D_RSSI "\":\"%d\",\"" D_JSON_ENCRYPTION "\":\"%s\"}"),
-                          i+1,
-                          WiFi.SSID(indexes[i]).c_str(),
-                          WiFi.BSSIDstr(indexes[i]).c_str(),
-                          WiFi.channel(indexes[i]),
-                          WiFi.RSSI(indexes[i]),
-                          WifiGetRssiAsQuality(WiFi.RSSI(indexes[i])),
-                          WifiEncryptionType(indexes[i]).c_str());
-          if ( ResponseSize() < ResponseLength() + 300 ) { break; }
-          if ( i < WiFi.scanComplete() -1 ) { ResponseAppend_P(PSTR(",")); }
-          //AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "MAX SIZE: %d, SIZE: %d"),ResponseSize(),ResponseLength());
-        }
-        ResponseJsonEnd();
-      } else {
+      if (!WifiScanResponseList()) {              // Bounded list collected by the channel sweep, sorted by RSSI
         ResponseAppend_P(PSTR("\"" D_NO_NETWORKS_FOUND "\""));
       }
       ResponseJsonEnd();
@@ -325,6 +335,9 @@ void ExecuteCommand(const char *cmnd, uint32_t source)
   // cmnd: "var1=1"    = stopic "var1" and svalue "=1"
   SHOW_FREE_MEM(PSTR("ExecuteCommand"));
   ShowSource(source);
+#ifdef USE_SLEEP_GOVERNOR
+  SleepGovernorBoost();            // Commands signal interactive use
+#endif  // USE_SLEEP_GOVERNOR
 
   const char *pos = cmnd;
   while (*pos && isspace(*pos)) {
@@ -354,6 +367,41 @@ void ExecuteCommand(const char *cmnd, uint32_t source)
   CommandHandler(stopic, svalue, strlen(svalue));
 }
 
+void ExecuteCommandDirect(const char *cmnd, uint32_t source)
+{
+  // Same "<command><index> <payload>" parsing as ExecuteCommand, but for programmatic
+  // invocations (Berry). Dispatches straight to the command tables without building a
+  // fake topic and running it through the group/fallback topic checks in CommandHandler.
+  SHOW_FREE_MEM(PSTR("ExecuteCommandDirect"));
+  ShowSource(source);
+
+  const char *pos = cmnd;
+  while (*pos && isspace(*pos)) {
+    pos++;                         // Skip all spaces
+  }
+
+  const char *start = pos;
+  // Get a command. Commands can only use letters, digits and underscores
+  while (*pos && (isalpha(*pos) || isdigit(*pos) || '_' == *pos || '/' == *pos)) {
+    if ('/' == *pos) {            // Skip possible cmnd/tasmota/ preamble
+      start = pos + 1;
+    }
+    pos++;
+  }
+  if ('\0' == *start || pos <= start) {
+    return;                      // Did not find any command to execute
+  }
+
+  uint32_t size = pos - start;
+  char stopic[size + 1];         // Mutable copy, uppercased and index-split by CommandDispatch
+  memcpy(stopic, start, size);
+  stopic[size] = '\0';
+
+  char svalue[strlen(pos) +1];   // pos point to the start of parameters
+  strlcpy(svalue, pos, sizeof(svalue));
+  CommandDispatch(stopic, svalue, strlen(svalue), false);
+}
+
 bool GetFallbackTopicFlag(char* topicBuf) {
   // Use this function to free CommandHandler stack space from TOPSZ
   char stemp1[TOPSZ];
@@ -385,11 +433,19 @@ void CommandHandler(char* topicBuf, char* dataBuf, uint32_t data_len) {
   TasmotaGlobal.fallback_topic_flag = GetFallbackTopicFlag(topicBuf);
 
   char *type = strrchr(topicBuf, '/');   // Last part of received topic is always the command (type)
+  if (type != nullptr) {
+    type++;
+  }
+  CommandDispatch(type, dataBuf, data_len, grpflg);
+}
 
+// Decode "<command><index>" and run it through the command tables, then publish the result.
+// Shared tail of CommandHandler; ExecuteCommandDirect enters here with the bare command,
+// skipping the MQTT topic machinery above.
+void CommandDispatch(char* type, char* dataBuf, uint32_t data_len, bool grpflg) {
   uint32_t index = 1;
   bool user_index = false;
   if (type != nullptr) {
-    type++;
     uint32_t i;
     int nLen;                            // strlen(type)
     char *s = type;
@@ -429,8 +485,13 @@ void CommandHandler(char* topicBuf, char* dataBuf, uint32_t data_len) {
   Response_P(PSTR("_1"));  // Signal error message for either Command Error or Command Unknown
   char stemp1[16];
 //  char command_line[64];
-//  snprintf_P(command_line, sizeof(command_line), PSTR("%s%s%s%s"), 
+//  snprintf_P(command_line, sizeof(command_line), PSTR("%s%s%s%s"),
+#ifdef USE_SCRATCH_ARENA
+  uint32_t scratch_mark = ScratchMark();   // Reclaimed below, nesting safe for recursive dispatch
+  char *command_line = (char*)ScratchAlloc(64);
+#else
   char *command_line = (char*)malloc(64);  // Use heap in favour of stack
+#endif  // USE_SCRATCH_ARENA
   snprintf_P(command_line, 64, PSTR("%s%s%s%s"), 
     type,
     (index != 1) ? itoa(index, stemp1, 10) : "",
@@ -496,7 +557,12 @@ void CommandHandler(char* topicBuf, char* dataBuf, uint32_t data_len) {
     }
     ResponseAppend_P(PSTR(",\"Input\":\"%s\"}"), command_line);
   }
+#ifdef USE_SCRATCH_ARENA
+  ScratchFree(command_line);
+  ScratchRelease(scratch_mark);
+#else
   free(command_line);
+#endif  // USE_SCRATCH_ARENA
 
   if (ResponseLength()) {
     if (TasmotaGlobal.no_mqtt_response){  // If it is activated, Tasmota will not publish MQTT messages, but it will proccess event trigger rules
@@ -514,10 +580,12 @@ void CmndBacklog(void) {
   // Backlog0 command1;command2;..  Execute commands in sequence with no delay
   // Backlog2 command1;command2;..  Execute commands in sequence with no delay and no response but rule processing only
   // Backlog3 command1;command2;..  Execute commands in sequence with a delay but no response but rule processing only
+  // Backlog4..7 command1;..        As Backlog0..3 but queued in the immediate lane executed ahead of pending backlog commands
 
   if (XdrvMailbox.data_len) {
     TasmotaGlobal.backlog_nodelay = (0 == (XdrvMailbox.index & 0x01));           // Backlog0, Backlog2
     TasmotaGlobal.backlog_no_mqtt_response = (2 == (XdrvMailbox.index & 0x02));  // Backlog2, Backlog3
+    LList<char*> &lane = (XdrvMailbox.index & 0x04) ? backlog_priority : backlog;  // Backlog4..7
 
     char *blcommand = strtok(XdrvMailbox.data, ";");
     while (blcommand != nullptr) {
@@ -539,10 +607,10 @@ void CmndBacklog(void) {
       }
       // Do not allow command Reset in backlog
       if ((*blcommand != '\0') && (strncasecmp_P(blcommand, PSTR(D_CMND_RESET), strlen(D_CMND_RESET)) != 0))  {
-        char* temp = (char*)malloc(strlen(blcommand)+1);
+        char* temp = (char*)HEAP_POOL_MALLOC(PSTR("backlog"), strlen(blcommand)+1);
         if (temp != nullptr) {
           strcpy(temp, blcommand);
-          char* &elem = backlog.addToLast();
+          char* &elem = lane.addToLast();
           elem = temp;
         }
       }
@@ -554,9 +622,13 @@ void CmndBacklog(void) {
   } else {
     bool blflag = BACKLOG_EMPTY;
     for (auto &elem : backlog) {
-      free(elem);
+      HEAP_POOL_FREE(elem);
       backlog.remove(&elem);
     }
+    for (auto &elem : backlog_priority) {
+      HEAP_POOL_FREE(elem);
+      backlog_priority.remove(&elem);
+    }
     ResponseCmndChar(blflag ? PSTR(D_JSON_EMPTY) : PSTR(D_JSON_ABORTED));
   }
 }
@@ -1027,6 +1099,7 @@ void CmndStatus(void)
 #endif // USE_IPV6
 #endif  // USE_ETHERNET
     float wifi_tx_power = WifiGetOutputPower();
+    ResponseAppendDnsStats();
     ResponseAppend_P(PSTR(",\"" D_CMND_WEBSERVER "\":%d,\"HTTP_API\":%d,\"" D_CMND_WIFICONFIG "\":%d,\"" D_CMND_WIFIPOWER "\":%1_f}}"),
                           Settings->webserver, Settings->flag5.disable_referer_chk, Settings->sta_config, &wifi_tx_power);
     CmndStatusResponse(5);
@@ -1935,7 +2008,7 @@ void ShowGpios(const uint16_t *NiceList, uint32_t size, uint32_t offset, uint32_
     }
     jsflg = true;
     char stemp1[TOPSZ];
-    if ((ResponseAppend_P(PSTR("\"%d\":\"%s\""), ridx, GetTextIndexed(stemp1, sizeof(stemp1), midx, kSensorNames)) > (MAX_LOGSZ - TOPSZ)) || (i == size -1)) {
+    if ((ResponseAppend_P(PSTR("\"%d\":\"%s\""), ridx, GetGpioNameIndexed(stemp1, sizeof(stemp1), midx)) > (MAX_LOGSZ - TOPSZ)) || (i == size -1)) {
       ResponseJsonEndEnd();
       MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, XdrvMailbox.command);
       jsflg = false;
@@ -2005,6 +2078,7 @@ void CmndTemplate(void)
         }
         j++;
       }
+      TemplateGpiosInvalidate();
     }
   }
   else {
@@ -2239,7 +2313,7 @@ void CmndAp(void)
     case 2:  // AP2
       Settings->sta_active = XdrvMailbox.payload -1;
     }
-    Settings->wifi_channel = 0;  // Disable stored AP
+    WifiClearApInfo(Settings->sta_active);  // Disable stored AP
     TasmotaGlobal.restart_flag = 2;
   }
   Response_P(S_JSON_COMMAND_NVALUE_SVALUE, XdrvMailbox.command, Settings->sta_active +1, EscapeJSONString(SettingsText(SET_STASSID1 + Settings->sta_active)).c_str());
@@ -2908,6 +2982,20 @@ void CmndSensor(void)
   XsnsCall(FUNC_COMMAND_SENSOR);
 }
 
+void CmndSensorInterval(void)
+{
+  // SensorInterval<id> 0..255 - seconds between periodic polls of sensor driver <id> (0 = poll on every tick)
+  if (XdrvMailbox.index < MAX_XSNS_DRIVERS) {
+    if ((XdrvMailbox.payload >= 0) && (XdrvMailbox.payload <= 255)) {
+      XsnsSetPollInterval(XdrvMailbox.index, XdrvMailbox.payload);
+    }
+    int32_t interval = XsnsGetPollInterval(XdrvMailbox.index);
+    if (interval >= 0) {
+      Response_P(PSTR("{\"" D_CMND_SENSORINTERVAL "%d\":%d}"), XdrvMailbox.index, interval);
+    }
+  }
+}
+
 void CmndDriver(void)
 {
   XdrvCall(FUNC_COMMAND_DRIVER);
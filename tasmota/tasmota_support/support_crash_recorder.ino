@@ -49,11 +49,78 @@ void CmndBlockedLoop(void)
   }
 }
 
+/*********************************************************************************************\
+ * Flight recorder - continuously running RTC-memory ring with the last loop iterations
+ * (active driver, loop duration, free heap, stack high-water) so CrashDump can show what the
+ * device was doing in the seconds before an exception
+\*********************************************************************************************/
+
+typedef struct {
+  uint8_t  driver;       // Driver or sensor id (bit 7 = sensor) last dispatched this iteration, 0 = none
+  uint8_t  loop_time;    // Active part of the loop iteration in ms, capped at 255
+  uint16_t free_stack;   // Stack high-water mark in bytes, capped at 65535
+  uint32_t free_heap;    // Free heap in bytes, 0 = slot not written yet
+} TFlightRecorderEntry;  // 8 bytes = 2 RTC words
+
+void FlightRecorderDumpEntry(TFlightRecorderEntry* entry, bool first) {
+  char slot[8];
+  slot[0] = '\0';
+  if (entry->driver) {
+    snprintf_P(slot, sizeof(slot), PSTR("%c%d"), (entry->driver & 0x80) ? 'S' : 'D', entry->driver & 0x7F);
+  }
+  ResponseAppend_P(PSTR("%s[\"%s\",%d,%d,%d]"), (first) ? "" : ",", slot, entry->loop_time, entry->free_stack, entry->free_heap);
+}
+
 #ifdef ESP8266
 
 const uint32_t crash_magic = 0x53415400;   // Stack trace magic number (TASx)
 const uint32_t crash_rtc_offset = 32;      // Offset in RTC memory skipping OTA used block
 const uint32_t crash_dump_max_len = 31;    // Dump only 31 call addresses to satisfy max JSON length of about 600 characters
+const uint32_t flight_magic = 0x544C4600;  // Flight recorder magic number (\0FLT) with the next slot index in the low byte
+const uint32_t flight_rtc_offset = 64;     // Offset in RTC memory after the crash recorder block (words 64..88)
+const uint32_t flight_entries = 12;        // Ring slots of 2 RTC words each
+
+void FlightRecorderTick(uint32_t loop_time) {
+  if (CrashFlag()) { return; }             // Preserve the pre-crash ring until the crash dump is cleared
+
+  uint32_t header;
+  ESP.rtcUserMemoryRead(flight_rtc_offset, &header, sizeof(header));
+  uint32_t next = header & 0xFF;
+  if (((header & 0xFFFFFF00) != flight_magic) || (next >= flight_entries)) {  // Garbage after power up - start over
+    TFlightRecorderEntry empty = { 0 };
+    for (uint32_t i = 0; i < flight_entries; i++) {
+      ESP.rtcUserMemoryWrite(flight_rtc_offset +1 + (i * 2), (uint32_t*)&empty, sizeof(empty));
+    }
+    next = 0;
+  }
+  TFlightRecorderEntry entry;
+  entry.driver = TasmotaGlobal.active_driver;
+  entry.loop_time = (loop_time > 255) ? 255 : loop_time;
+  uint32_t free_stack = ESP.getFreeContStack();
+  entry.free_stack = (free_stack > 65535) ? 65535 : free_stack;
+  entry.free_heap = ESP.getFreeHeap();
+  ESP.rtcUserMemoryWrite(flight_rtc_offset +1 + (next * 2), (uint32_t*)&entry, sizeof(entry));
+  next = (next +1) % flight_entries;
+  header = flight_magic | next;
+  ESP.rtcUserMemoryWrite(flight_rtc_offset, &header, sizeof(header));
+}
+
+void FlightRecorderDump(void) {
+  uint32_t header;
+  ESP.rtcUserMemoryRead(flight_rtc_offset, &header, sizeof(header));
+  if ((header & 0xFFFFFF00) != flight_magic) { return; }
+  uint32_t next = header & 0xFF;
+  ResponseAppend_P(PSTR(",\"FlightRecorder\":["));
+  bool first = true;
+  for (uint32_t i = 0; i < flight_entries; i++) {   // Oldest entry first
+    TFlightRecorderEntry entry;
+    ESP.rtcUserMemoryRead(flight_rtc_offset +1 + (((next + i) % flight_entries) * 2), (uint32_t*)&entry, sizeof(entry));
+    if (!entry.free_heap) { continue; }
+    FlightRecorderDumpEntry(&entry, first);
+    first = false;
+  }
+  ResponseAppend_P(PSTR("]"));
+}
 
 /**
  * Save crash information in RTC memory
@@ -82,6 +149,7 @@ void CrashDumpClear(void)
 {
   uint32_t value = 0;
   ESP.rtcUserMemoryWrite(crash_rtc_offset + crash_dump_max_len, (uint32_t*)&value, sizeof(value));
+  ESP.rtcUserMemoryWrite(flight_rtc_offset, &value, sizeof(value));  // Restart the flight recorder ring as well
 }
 
 /*********************************************************************************************\
@@ -117,6 +185,8 @@ void CrashDump(void)
     ResponseAppend_P(PSTR("]"));
   }
 
+  FlightRecorderDump();
+
   ResponseJsonEnd();
 }
 
@@ -137,6 +207,15 @@ RTC_NOINIT_ATTR volatile struct {
   uint32_t excvaddr;
 } crash_recorder;
 
+const uint32_t flight_magic = 0x544C4600;  // Flight recorder magic number (\0FLT)
+const uint32_t flight_entries = 16;        // Ring slots
+
+RTC_NOINIT_ATTR struct {
+  uint32_t magic;
+  uint32_t next;
+  TFlightRecorderEntry entry[flight_entries];
+} flight_recorder;
+
 bool CrashFlag(void)
 {
   return crash_recorder.magic == crash_magic;
@@ -149,6 +228,36 @@ void CrashDumpClear(void)
   for (uint32_t i=0; i<crash_dump_max_len; i++) {
     crash_recorder.stack[i] = 0;
   }
+  flight_recorder.magic = 0;               // Restart the flight recorder ring as well
+}
+
+void FlightRecorderTick(uint32_t loop_time) {
+  if (CrashFlag()) { return; }             // Preserve the pre-crash ring until the crash dump is cleared
+
+  if ((flight_recorder.magic != flight_magic) || (flight_recorder.next >= flight_entries)) {  // Garbage after power up - start over
+    memset((void*)&flight_recorder, 0, sizeof(flight_recorder));
+    flight_recorder.magic = flight_magic;
+  }
+  TFlightRecorderEntry* entry = &flight_recorder.entry[flight_recorder.next];
+  entry->driver = TasmotaGlobal.active_driver;
+  entry->loop_time = (loop_time > 255) ? 255 : loop_time;
+  uint32_t free_stack = uxTaskGetStackHighWaterMark(nullptr);
+  entry->free_stack = (free_stack > 65535) ? 65535 : free_stack;
+  entry->free_heap = ESP.getFreeHeap();
+  flight_recorder.next = (flight_recorder.next +1) % flight_entries;
+}
+
+void FlightRecorderDump(void) {
+  if ((flight_recorder.magic != flight_magic) || (flight_recorder.next >= flight_entries)) { return; }
+  ResponseAppend_P(PSTR(",\"FlightRecorder\":["));
+  bool first = true;
+  for (uint32_t i = 0; i < flight_entries; i++) {   // Oldest entry first
+    TFlightRecorderEntry* entry = &flight_recorder.entry[(flight_recorder.next + i) % flight_entries];
+    if (!entry->free_heap) { continue; }
+    FlightRecorderDumpEntry(entry, first);
+    first = false;
+  }
+  ResponseAppend_P(PSTR("]"));
 }
 
 #if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
@@ -258,6 +367,7 @@ void CrashDump(void)
       ResponseAppend_P(PSTR("\"%08x\""), return_addr);
     }
     ResponseAppend_P(PSTR("]"));
+    FlightRecorderDump();
   }
   ResponseJsonEnd();
 }
@@ -345,6 +455,7 @@ void CrashDump(void)
       ResponseAppend_P(PSTR("\"%08x\""), return_addr);
     }
     ResponseAppend_P(PSTR("]"));
+    FlightRecorderDump();
   }
   ResponseJsonEnd();
 }
@@ -25,6 +25,8 @@
 
 //#define DEVICE_GROUPS_DEBUG
 #define DGR_MULTICAST_REPEAT_COUNT  1       // Number of times to re-send each multicast
+#define DGR_UPDATE_WINDOW           25      // ms to hold an update multicast to coalesce rapid item changes
+#define DGR_UNICAST_RETRY_MEMBERS   2       // Skip repeat multicasts and unicast when this many or fewer members are missing
 #define DGR_ACK_WAIT_TIME           150     // Initial ms to wait for ack's
 #define DGR_MEMBER_TIMEOUT          45000   // ms to wait for ack's before removing a member
 #define DGR_ANNOUNCEMENT_INTERVAL   60000   // ms between announcements
@@ -32,6 +34,19 @@
 
 const char kDeviceGroupMessage[] PROGMEM = DEVICE_GROUP_MESSAGE;
 
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+#include <t_bearssl.h>
+#ifndef USE_UNISHOX_COMPRESSION
+#include <unishox.h>
+Unishox compressor;
+#endif  // USE_UNISHOX_COMPRESSION
+#define DEVICE_GROUP_MESSAGE_ENC    "TASMOTA_DGX"  // Header of compressed and authenticated messages - same length as the plain header
+#define DGR_CRYPTO_IV_SIZE          12
+#define DGR_CRYPTO_TAG_SIZE         16
+
+const char kDeviceGroupMessageEnc[] PROGMEM = DEVICE_GROUP_MESSAGE_ENC;
+#endif  // USE_DEVICE_GROUPS_CRYPTO
+
 struct device_group_member {
   struct device_group_member * flink;
   IPAddress ip_address;
@@ -43,8 +58,13 @@ struct device_group_member {
 struct device_group {
   uint32_t next_announcement_time;
   uint32_t next_ack_check_time;
+  uint32_t next_send_time;
   uint32_t member_timeout_time;
   uint32_t no_status_share;
+  uint32_t multicast_count;
+  uint32_t coalesced_count;
+  uint32_t retransmit_count;
+  uint32_t timeout_count;
   uint16_t outgoing_sequence;
   uint16_t last_full_status_sequence;
   uint16_t message_length;
@@ -54,6 +74,9 @@ struct device_group {
   uint8_t multicasts_remaining;
   char group_name[TOPSZ];
   uint8_t message[128];
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+  uint8_t crypto_key[32];
+#endif  // USE_DEVICE_GROUPS_CRYPTO
   struct device_group_member * device_group_members;
 #ifdef USE_DEVICE_GROUPS_SEND
   uint8_t values_8bit[DGR_ITEM_LAST_8BIT];
@@ -108,6 +131,85 @@ uint32_t DeviceGroupSharedMask(uint8_t item)
   return mask;
 }
 
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+// An encrypted datagram reuses the plain header with the TASMOTA_DGX magic so the group name
+// stays matchable, followed by a 12-byte nonce, the message body (Unishox-compressed when that
+// is actually smaller) encrypted with ChaCha20 and the 16-byte Poly1305 tag computed over the
+// header and nonce as well. The low bit of the first nonce byte flags a compressed body.
+
+struct device_group * DeviceGroupFind(const char * group_name)
+{
+  struct device_group * device_group = device_groups;
+  for (uint32_t device_group_index = 0; device_group_index < device_group_count; device_group_index++, device_group++) {
+    if (!strcmp(group_name, device_group->group_name)) return device_group;
+  }
+  return nullptr;
+}
+
+int32_t EncryptDeviceGroupMessage(struct device_group * device_group, uint8_t * message, int message_length, uint8_t * packet, size_t packet_size)
+{
+  uint32_t header_length = device_group->message_header_length;
+  uint32_t body_length = message_length - header_length;
+  if (header_length + DGR_CRYPTO_IV_SIZE + body_length + DGR_CRYPTO_TAG_SIZE > packet_size) return -1;
+
+  memcpy(packet, message, header_length);
+  memcpy_P(packet, kDeviceGroupMessageEnc, sizeof(DEVICE_GROUP_MESSAGE_ENC) - 1);
+  uint8_t * iv = packet + header_length;
+  uint8_t * body = iv + DGR_CRYPTO_IV_SIZE;
+
+  for (uint32_t i = 0; i < DGR_CRYPTO_IV_SIZE; i += 4) {
+    uint32_t random = HwRandom();
+    memcpy(iv + i, &random, 4);
+  }
+
+  int32_t body_out_length = 0;
+  if (body_length > 16) {
+    body_out_length = compressor.unishox_compress((char *)message + header_length, body_length, (char *)body, packet_size - header_length - DGR_CRYPTO_IV_SIZE - DGR_CRYPTO_TAG_SIZE);
+  }
+  if ((body_out_length > 0) && (body_out_length < (int32_t)body_length)) {
+    iv[0] |= 1;      // Only keep the compressed form when it is actually smaller
+  } else {
+    iv[0] &= ~1;
+    memcpy(body, message + header_length, body_length);
+    body_out_length = body_length;
+  }
+
+  br_poly1305_ctmul32_run(device_group->crypto_key, iv, body, body_out_length, packet, header_length + DGR_CRYPTO_IV_SIZE, body + body_out_length, br_chacha20_ct_run, 1);
+  return header_length + DGR_CRYPTO_IV_SIZE + body_out_length + DGR_CRYPTO_TAG_SIZE;
+}
+
+int32_t DecryptDeviceGroupMessage(struct device_group * device_group, uint8_t * packet, int packet_length, uint8_t * message, size_t message_size)
+{
+  uint32_t header_length = strlen((char *)packet) + 1;
+  if ((uint32_t)packet_length < header_length + DGR_CRYPTO_IV_SIZE + DGR_CRYPTO_TAG_SIZE) return -1;
+  uint8_t * iv = packet + header_length;
+  uint8_t * body = iv + DGR_CRYPTO_IV_SIZE;
+  uint32_t body_length = packet_length - header_length - DGR_CRYPTO_IV_SIZE - DGR_CRYPTO_TAG_SIZE;
+
+  uint8_t tag[DGR_CRYPTO_TAG_SIZE];
+  br_poly1305_ctmul32_run(device_group->crypto_key, iv, body, body_length, packet, header_length + DGR_CRYPTO_IV_SIZE, tag, br_chacha20_ct_run, 0);
+  uint8_t diff = 0;  // Constant-time compare - memcmp's early exit would leak how many tag bytes matched
+  for (uint32_t i = 0; i < DGR_CRYPTO_TAG_SIZE; i++) {
+    diff |= tag[i] ^ body[body_length + i];
+  }
+  if (diff) return -1;
+
+  if (header_length > message_size) return -1;
+  memcpy(message, packet, header_length);
+  memcpy_P(message, kDeviceGroupMessage, sizeof(DEVICE_GROUP_MESSAGE) - 1);
+  int32_t message_length;
+  if (iv[0] & 1) {
+    message_length = compressor.unishox_decompress((char *)body, body_length, (char *)message + header_length, message_size - header_length);
+    if (message_length <= 0) return -1;
+  } else {
+    if (header_length + body_length > message_size) return -1;
+    memcpy(message + header_length, body, body_length);
+    message_length = body_length;
+  }
+  return header_length + message_length;
+}
+#endif  // USE_DEVICE_GROUPS_CRYPTO
+
 void DeviceGroupsInit(void)
 {
   // If no module set the device group count, ...
@@ -154,6 +256,16 @@ void DeviceGroupsInit(void)
       }
     }
     device_group->message_header_length = sprintf_P((char *)device_group->message, PSTR("%s%s"), kDeviceGroupMessage, device_group->group_name) + 1;
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+    // Derive the per-group key from the WiFi password and the group name so different groups on
+    // the same network use different keys.
+    br_sha256_context sha256_context;
+    const char * password = SettingsText(SET_STAPWD1 + Settings->sta_active);
+    br_sha256_init(&sha256_context);
+    br_sha256_update(&sha256_context, password, strlen(password));
+    br_sha256_update(&sha256_context, device_group->group_name, strlen(device_group->group_name));
+    br_sha256_out(&sha256_context, device_group->crypto_key);
+#endif  // USE_DEVICE_GROUPS_CRYPTO
     device_group->no_status_share = 0;
     device_group->last_full_status_sequence = -1;
   }
@@ -468,6 +580,16 @@ write_log:
   else {
     int attempt;
     IPAddress ip_address = (device_group_member ? device_group_member->ip_address : IPAddress(DEVICE_GROUPS_ADDRESS));
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+    uint8_t packet_buffer[256];
+    int32_t packet_length = EncryptDeviceGroupMessage(device_group, message, message_length, packet_buffer, sizeof(packet_buffer));
+    if (packet_length < 0) {
+      AddLog(LOG_LEVEL_ERROR, PSTR("DGR: Error encrypting message"));
+      goto cleanup;
+    }
+    message = packet_buffer;
+    message_length = packet_length;
+#endif  // USE_DEVICE_GROUPS_CRYPTO
     for (attempt = 1; attempt <= 5; attempt++) {
       if (device_groups_udp.beginPacket(ip_address, DEVICE_GROUPS_PORT)) {
         device_groups_udp.write(message, message_length);
@@ -490,6 +612,22 @@ cleanup:
   }
 }
 
+void MulticastDeviceGroupUpdate(struct device_group * device_group)
+{
+  // Multicast the pending update message and begin waiting for the members to ack it.
+  uint32_t now = millis();
+  device_group->next_send_time = 0;
+  device_group->multicasts_remaining = DGR_MULTICAST_REPEAT_COUNT;
+  device_group->multicast_count++;
+  SendReceiveDeviceGroupMessage(device_group, nullptr, device_group->message, device_group->message_length, false);
+  device_group->ack_check_interval = DGR_ACK_WAIT_TIME;
+  device_group->next_ack_check_time = now + device_group->ack_check_interval;
+  if ((int32_t)(next_check_time - device_group->next_ack_check_time) > 0) next_check_time = device_group->next_ack_check_time;
+  device_group->member_timeout_time = now + DGR_MEMBER_TIMEOUT;
+  device_group->next_announcement_time = now + DGR_ANNOUNCEMENT_INTERVAL;
+  if ((int32_t)(next_check_time - device_group->next_announcement_time) > 0) next_check_time = device_group->next_announcement_time;
+}
+
 bool _SendDeviceGroupMessage(int32_t device, DevGroupMessageType message_type, ...)
 {
   // If device groups is not up, ignore this request.
@@ -829,10 +967,6 @@ bool _SendDeviceGroupMessage(int32_t device, DevGroupMessageType message_type, .
     return 0;
   }
 
-  // Multicast the packet.
-  device_group->multicasts_remaining = DGR_MULTICAST_REPEAT_COUNT;
-  SendReceiveDeviceGroupMessage(device_group, nullptr, device_group->message, device_group->message_length, false);
-
 #ifdef USE_DEVICE_GROUPS_SEND
   // If requested, handle this updated locally as well.
   if (with_local) {
@@ -842,20 +976,34 @@ bool _SendDeviceGroupMessage(int32_t device, DevGroupMessageType message_type, .
   }
 #endif  // USE_DEVICE_GROUPS_SEND
 
-  uint32_t now = millis();
+  // Hold normal updates for a short send window so a scene change that updates several items in
+  // rapid succession goes out as one multicast per window instead of one packet per item. The
+  // items were already merged into the pending message above; DeviceGroupsLoop multicasts it when
+  // the window closes. Status, direct and more-to-come updates still go out immediately.
+  if (DGR_MSGTYP_UPDATE == message_type) {
+    if (device_group->next_send_time) {
+      device_group->coalesced_count++;
+    }
+    else {
+      device_group->next_send_time = millis() + DGR_UPDATE_WINDOW;
+    }
+    if ((int32_t)(next_check_time - device_group->next_send_time) > 0) next_check_time = device_group->next_send_time;
+    return 0;
+  }
+
+  // Multicast the packet.
   if (message_type == DGR_MSGTYP_UPDATE_MORE_TO_COME) {
+    device_group->next_send_time = 0;
+    device_group->multicast_count++;
+    SendReceiveDeviceGroupMessage(device_group, nullptr, device_group->message, device_group->message_length, false);
     device_group->message_length = 0;
     device_group->next_ack_check_time = 0;
+    device_group->next_announcement_time = millis() + DGR_ANNOUNCEMENT_INTERVAL;
+    if ((int32_t)(next_check_time - device_group->next_announcement_time) > 0) next_check_time = device_group->next_announcement_time;
   }
   else {
-    device_group->ack_check_interval = DGR_ACK_WAIT_TIME;
-    device_group->next_ack_check_time = now + device_group->ack_check_interval;
-    if ((int32_t)(next_check_time - device_group->next_ack_check_time) > 0) next_check_time = device_group->next_ack_check_time;
-    device_group->member_timeout_time = now + DGR_MEMBER_TIMEOUT;
+    MulticastDeviceGroupUpdate(device_group);
   }
-
-  device_group->next_announcement_time = now + DGR_ANNOUNCEMENT_INTERVAL;
-  if ((int32_t)(next_check_time - device_group->next_announcement_time) > 0) next_check_time = device_group->next_announcement_time;
   return 0;
 }
 
@@ -910,7 +1058,7 @@ void DeviceGroupStatus(uint8_t device_group_index)
       snprintf_P(buffer, sizeof(buffer), PSTR("%s,{\"IPAddress\":\"%s\",\"ResendCount\":%u,\"LastRcvdSeq\":%u,\"LastAckedSeq\":%u}"), buffer, IPAddressToString(device_group_member->ip_address), device_group_member->unicast_count, device_group_member->received_sequence, device_group_member->acked_sequence);
       member_count++;
     }
-    Response_P(PSTR("{\"" D_CMND_DEVGROUPSTATUS "\":{\"Index\":%u,\"GroupName\":\"%s\",\"MessageSeq\":%u,\"MemberCount\":%d,\"Members\":[%s]}}"), device_group_index, device_group->group_name, device_group->outgoing_sequence, member_count, &buffer[1]);
+    Response_P(PSTR("{\"" D_CMND_DEVGROUPSTATUS "\":{\"Index\":%u,\"GroupName\":\"%s\",\"MessageSeq\":%u,\"SendPending\":%u,\"Multicasts\":%u,\"Coalesced\":%u,\"Retransmits\":%u,\"MemberTimeouts\":%u,\"MemberCount\":%d,\"Members\":[%s]}}"), device_group_index, device_group->group_name, device_group->outgoing_sequence, (device_group->next_send_time != 0), device_group->multicast_count, device_group->coalesced_count, device_group->retransmit_count, device_group->timeout_count, member_count, &buffer[1]);
   }
 }
 
@@ -923,9 +1071,27 @@ void DeviceGroupsLoop(void)
     int length = device_groups_udp.read(packet_buffer, sizeof(packet_buffer) - 1);
     if (length > 0) {
       packet_buffer[length] = 0;
+#ifdef USE_DEVICE_GROUPS_CRYPTO
+      // Only authenticated messages are accepted; plain ones from devices without the key are ignored.
+      if (!strncmp_P((char *)packet_buffer, kDeviceGroupMessageEnc, sizeof(DEVICE_GROUP_MESSAGE_ENC) - 1)) {
+        struct device_group * device_group = DeviceGroupFind((char *)packet_buffer + sizeof(DEVICE_GROUP_MESSAGE_ENC) - 1);
+        if (device_group) {
+          uint8_t message_buffer[512];
+          int32_t message_length = DecryptDeviceGroupMessage(device_group, packet_buffer, length, message_buffer, sizeof(message_buffer) - 1);
+          if (message_length > 0) {
+            message_buffer[message_length] = 0;
+            ProcessDeviceGroupMessage(message_buffer, message_length);
+          }
+          else {
+            AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Ignoring unauthenticated message from %s"), IPAddressToString(device_groups_udp.remoteIP()));
+          }
+        }
+      }
+#else  // No USE_DEVICE_GROUPS_CRYPTO
       if (!strncmp_P((char *)packet_buffer, kDeviceGroupMessage, sizeof(DEVICE_GROUP_MESSAGE) - 1)) {
         ProcessDeviceGroupMessage(packet_buffer, length);
       }
+#endif  // USE_DEVICE_GROUPS_CRYPTO
     }
   }
 
@@ -941,6 +1107,16 @@ AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking next_check_time=%u, now=%u"), next_c
     struct device_group * device_group = device_groups;
     for (uint32_t device_group_index = 0; device_group_index < device_group_count; device_group_index++, device_group++) {
 
+      // If a coalesced update is waiting and its send window has closed, multicast it now.
+      if (device_group->next_send_time) {
+        if ((int32_t)(now - device_group->next_send_time) >= 0) {
+          MulticastDeviceGroupUpdate(device_group);
+        }
+        else if ((int32_t)(next_check_time - device_group->next_send_time) > 0) {
+          next_check_time = device_group->next_send_time;
+        }
+      }
+
       // If we're still waiting for acks to the last update from this device group, ...
       if (device_group->next_ack_check_time) {
 
@@ -971,6 +1147,15 @@ AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking next_check_time=%u, now=%u"), next_c
 #ifdef DEVICE_GROUPS_DEBUG
             AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking for %s ack's"), device_group->group_name);
 #endif  // DEVICE_GROUPS_DEBUG
+            // Count the members that haven't acked the last update yet. When only a few are
+            // missing, skip any remaining multicasts and retransmit directly to just those
+            // members so the rest of the group isn't sent traffic it has already acked.
+            uint32_t unacked_count = 0;
+            for (struct device_group_member * member = device_group->device_group_members; member; member = member->flink) {
+              if (member->acked_sequence != device_group->outgoing_sequence) unacked_count++;
+            }
+            if (device_group->multicasts_remaining && unacked_count && unacked_count <= DGR_UNICAST_RETRY_MEMBERS) device_group->multicasts_remaining = 0;
+
             bool acked = true;
             struct device_group_member ** flink = &device_group->device_group_members;
             struct device_group_member * device_group_member;
@@ -983,6 +1168,7 @@ AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking next_check_time=%u, now=%u"), next_c
                 // they're offline and remove them from the group.
                 if ((int32_t)(now - device_group->member_timeout_time) >= 0) {
                   *flink = device_group_member->flink;
+                  device_group->timeout_count++;
                   free(device_group_member);
                   AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Member %s removed"), IPAddressToString(device_group_member->ip_address));
                   continue;
@@ -991,6 +1177,7 @@ AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking next_check_time=%u, now=%u"), next_c
                 // If we have more multicasts to do, multicast the packet to all members again;
                 // otherwise, unicast the message directly to this member.
                 if (device_group->multicasts_remaining) device_group_member = nullptr;
+                device_group->retransmit_count++;
                 SendReceiveDeviceGroupMessage(device_group, device_group_member, device_group->message, device_group->message_length, false);
                 acked = false;
                 if (device_group->multicasts_remaining) {
@@ -1034,7 +1221,7 @@ AddLog(LOG_LEVEL_DEBUG, PSTR("DGR: Checking next_check_time=%u, now=%u"), next_c
 #endif  // DEVICE_GROUPS_DEBUG
         if ((int32_t)(now - device_group->next_announcement_time) >= 0) {
           SendReceiveDeviceGroupMessage(device_group, nullptr, device_group->message, BeginDeviceGroupMessage(device_group, DGR_FLAG_ANNOUNCEMENT, true) - device_group->message, false);
-          device_group->next_announcement_time = now + DGR_ANNOUNCEMENT_INTERVAL + random(10000);
+          device_group->next_announcement_time = now + DGR_ANNOUNCEMENT_INTERVAL + FastRandomRange(0, 10000);
         }
         if ((int32_t)(next_check_time - device_group->next_announcement_time) > 0) next_check_time = device_group->next_announcement_time;
       }
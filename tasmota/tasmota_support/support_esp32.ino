@@ -170,13 +170,74 @@ uint32_t SettingsRead(void *data, size_t size) {
   return 0;
 }
 
-void SettingsWrite(const void *pSettings, unsigned nSettingsLen) {
+/*********************************************************************************************\
+ * Asynchronous settings persistence
+ *
+ * SettingsWrite snapshots the block and hands it to a low-priority task so the main loop
+ * does not carry the NVS commit and filesystem write. Pending snapshots are coalesced -
+ * only the latest one is written. SettingsWaitForWrite() is the barrier used before restart.
+\*********************************************************************************************/
+
+TaskHandle_t settings_write_task = nullptr;
+SemaphoreHandle_t settings_write_mutex;
+uint8_t *settings_write_pending = nullptr;
+size_t settings_write_pending_len;
+volatile bool settings_write_busy = false;
+
+void SettingsWriteNow(const void *pSettings, unsigned nSettingsLen) {
 #ifdef USE_UFILESYS
   TfsSaveFile(TASM_FILE_SETTINGS, (const uint8_t*)pSettings, nSettingsLen);
 #endif
   NvmSave("main", "Settings", pSettings, nSettingsLen);
 }
 
+void SettingsWriteTask(void *arg) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (true) {
+      xSemaphoreTake(settings_write_mutex, portMAX_DELAY);
+      uint8_t *data = settings_write_pending;
+      size_t len = settings_write_pending_len;
+      settings_write_pending = nullptr;
+      settings_write_busy = (data != nullptr);
+      xSemaphoreGive(settings_write_mutex);
+      if (!data) { break; }
+      SettingsWriteNow(data, len);
+      free(data);
+      settings_write_busy = false;
+    }
+  }
+}
+
+// Block until a queued snapshot has reached flash - call before restart, OTA or deepsleep
+void SettingsWaitForWrite(void) {
+  if (!settings_write_task) { return; }
+  while (settings_write_pending || settings_write_busy) {
+    delay(2);
+  }
+}
+
+void SettingsWrite(const void *pSettings, unsigned nSettingsLen) {
+  if (!settings_write_task) {
+    settings_write_mutex = xSemaphoreCreateMutex();
+    if (settings_write_mutex) {
+      xTaskCreatePinnedToCore(SettingsWriteTask, "tasmota_cfg", 4096, nullptr, 1, &settings_write_task, 0);
+    }
+  }
+  uint8_t *snapshot = (settings_write_task) ? (uint8_t*)malloc(nSettingsLen) : nullptr;
+  if (!snapshot) {
+    SettingsWriteNow(pSettings, nSettingsLen);    // No task or no memory - write synchronously as before
+    return;
+  }
+  memcpy(snapshot, pSettings, nSettingsLen);
+  xSemaphoreTake(settings_write_mutex, portMAX_DELAY);
+  free(settings_write_pending);                   // Coalesce - an unwritten older snapshot is superseded
+  settings_write_pending = snapshot;
+  settings_write_pending_len = nSettingsLen;
+  xSemaphoreGive(settings_write_mutex);
+  xTaskNotifyGive(settings_write_task);
+}
+
 void QPCRead(void *pSettings, unsigned nSettingsLen) {
   NvmLoad("qpc", "pcreg", pSettings, nSettingsLen);
 }
@@ -319,6 +380,38 @@ bool EspPrepSwitchPartition(uint32_t state) {
   return valid;
 }
 
+/*********************************************************************************************\
+ * Dual app partition rollback
+ *
+ * With two full size app slots (no safeboot factory partition) and a bootloader built with
+ * app rollback support a fresh OTA image boots as ESP_OTA_IMG_PENDING_VERIFY. It then has
+ * OTA_COMMIT_TIME seconds to bring the network and MQTT up; only then is the slot committed.
+ * A crash or failed health check reboots straight into the previous full image.
+\*********************************************************************************************/
+
+bool EspAppImagePendingVerify(void) {
+  if (EspSingleOtaPartition()) { return false; }  // Safeboot layout uses re-flash, not rollback
+  esp_ota_img_states_t ota_state;
+  if (esp_ota_get_state_partition(esp_ota_get_running_partition(), &ota_state) != ESP_OK) { return false; }
+  return (ESP_OTA_IMG_PENDING_VERIFY == ota_state);  // Undefined without rollback bootloader support
+}
+
+void EspOtaCommitEverySecond(void) {
+  static bool ota_pending_verify = EspAppImagePendingVerify();
+
+  if (!ota_pending_verify) { return; }
+  if (!TasmotaGlobal.global_state.data && !TasmotaGlobal.restart_flag) {
+    // Network and MQTT are up and no driver requested a restart - commit this image
+    esp_ota_mark_app_valid_cancel_rollback();
+    ota_pending_verify = false;
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_UPLOAD "Image committed"));
+  }
+  else if (TasmotaGlobal.uptime > OTA_COMMIT_TIME) {
+    AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_UPLOAD "Health check failed, restarting previous image"));
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+  }
+}
+
 uint32_t EspFlashBaseAddress(void) {
   if (EspSingleOtaPartition()) {       // Only one partition so start at end of sketch
     const esp_partition_t *running = esp_ota_get_running_partition();
@@ -624,28 +717,94 @@ bool CanUsePSRAM(void) {
   return true;
 }
 
+/*********************************************************************************************\
+ * Large allocation placement policy
+ *
+ * Big buffers (fonts, images, rings, codec scratch) must go to PSRAM when present so
+ * internal RAM stays available for WiFi and lwIP, while small blocks stay internal where
+ * access is fast and PSRAM bookkeeping overhead is not worth it. The threshold can be
+ * tuned per build with PSRAM_MIN_ALLOC_SIZE. special_malloc_tag() additionally accounts
+ * allocations per subsystem tag, queryable with the MemStats command.
+\*********************************************************************************************/
+
+#ifndef PSRAM_MIN_ALLOC_SIZE
+#define PSRAM_MIN_ALLOC_SIZE 256         // Blocks below this stay in internal RAM
+#endif
+
 void *special_malloc(uint32_t size) {
-  if (UsePSRAM()) {
+  if (UsePSRAM() && (size >= PSRAM_MIN_ALLOC_SIZE)) {
     return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
   } else {
     return malloc(size);
   }
 }
 void *special_realloc(void *ptr, size_t size) {
-  if (UsePSRAM()) {
+  if (UsePSRAM() && (size >= PSRAM_MIN_ALLOC_SIZE)) {
     return heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
   } else {
     return realloc(ptr, size);
   }
 }
 void *special_calloc(size_t num, size_t size) {
-  if (UsePSRAM()) {
+  if (UsePSRAM() && ((num * size) >= PSRAM_MIN_ALLOC_SIZE)) {
     return heap_caps_calloc(num, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
   } else {
     return calloc(num, size);
   }
 }
 
+#define ALLOC_STATS_SLOTS 12             // Distinct subsystem tags tracked
+
+struct {
+  const char *tag;                       // Flash string from the call site, nullptr = unused
+  uint32_t allocs;                       // Successful allocations
+  uint32_t fails;                        // Failed allocations
+  uint32_t bytes;                        // Total bytes requested
+} AllocStats[ALLOC_STATS_SLOTS];
+
+void AllocStatsAccount(const char *tag, uint32_t size, bool success) {
+  for (uint32_t i = 0; i < ALLOC_STATS_SLOTS; i++) {
+    if (nullptr == AllocStats[i].tag) {
+      AllocStats[i].tag = tag;
+    }
+    if ((AllocStats[i].tag == tag) || !strcmp(AllocStats[i].tag, tag)) {
+      if (success) {
+        AllocStats[i].allocs++;
+        AllocStats[i].bytes += size;
+      } else {
+        AllocStats[i].fails++;
+      }
+      return;
+    }
+  }
+}
+
+void *special_malloc_tag(const char *tag, uint32_t size) {
+  void *ptr = special_malloc(size);
+  AllocStatsAccount(tag, size, ptr != nullptr);
+  return ptr;
+}
+
+void CmndMemStats(void) {
+  Response_P(PSTR("{\"%s\":{\"Heap\":{\"Free\":%d,\"Largest\":%d}"), XdrvMailbox.command,
+    heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+    heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  if (UsePSRAM()) {
+    ResponseAppend_P(PSTR(",\"PSRAM\":{\"Free\":%d,\"Largest\":%d}"),
+      heap_caps_get_free_size(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT),
+      heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+  bool first = true;
+  for (uint32_t i = 0; i < ALLOC_STATS_SLOTS; i++) {
+    if (nullptr == AllocStats[i].tag) { break; }
+    ResponseAppend_P(PSTR("%s\"%s\":{\"Allocs\":%d,\"Bytes\":%d,\"Fails\":%d}"),
+      (first) ? ",\"Tags\":{" : ",", AllocStats[i].tag, AllocStats[i].allocs, AllocStats[i].bytes, AllocStats[i].fails);
+    first = false;
+  }
+  if (!first) { ResponseJsonEnd(); }
+  ResponseJsonEndEnd();
+}
+
 // Variants for IRAM heap, which need all accesses to be 32 bits aligned
 void *special_malloc32(uint32_t size) {
   return heap_caps_malloc(size, MALLOC_CAP_32BIT);
@@ -1015,6 +1174,81 @@ void GpioForceHoldRelay(void) {
 }
 #endif
 
+/*********************************************************************************************\
+ * Second-core driver executor
+ *
+ * Lets drivers hand work items (function pointer plus context) to a task pinned to the core
+ * the Arduino loop does NOT run on, so heavy jobs (sensor math, compression, frame encoding)
+ * no longer eat into the 50ms tick budget. Handoff uses a FreeRTOS queue which is ISR-safe,
+ * so jobs may also be posted from interrupt context via OffloadCallFromISR().
+ *
+ * Jobs run without the Tasmota loop lock - offloaded code must not touch Settings, the
+ * response buffer or other loop-owned state. Use a completion flag polled from FUNC_LOOP
+ * to hand results back.
+\*********************************************************************************************/
+
+#ifdef USE_OFFLOAD_EXECUTOR
+#ifndef CORE32SOLO1
+
+#ifndef OFFLOAD_QUEUE_DEPTH
+#define OFFLOAD_QUEUE_DEPTH    16                  // Pending job slots
+#endif
+#ifndef OFFLOAD_STACK_SIZE
+#define OFFLOAD_STACK_SIZE     4096                // Executor task stack in bytes
+#endif
+
+typedef void (*OffloadFunc)(void *arg);
+
+struct OffloadJob {
+  OffloadFunc func;
+  void *arg;
+};
+
+QueueHandle_t offload_queue = nullptr;
+
+void OffloadExecutorTask(void *pvParameters) {
+  OffloadJob job;
+  while (true) {
+    if (pdTRUE == xQueueReceive(offload_queue, &job, portMAX_DELAY)) {
+      job.func(job.arg);
+    }
+  }
+}
+
+bool OffloadInit(void) {
+  if (offload_queue) { return true; }
+  offload_queue = xQueueCreate(OFFLOAD_QUEUE_DEPTH, sizeof(OffloadJob));
+  if (!offload_queue) { return false; }
+  uint32_t core = (xPortGetCoreID() == 0) ? 1 : 0;  // Pin opposite to the Arduino loop core
+  if (pdPASS != xTaskCreatePinnedToCore(OffloadExecutorTask, "OFFLOAD", OFFLOAD_STACK_SIZE, nullptr, 1, nullptr, core)) {
+    vQueueDelete(offload_queue);
+    offload_queue = nullptr;
+    return false;
+  }
+  AddLog(LOG_LEVEL_DEBUG, PSTR("OFL: Executor started on core %d"), core);
+  return true;
+}
+
+bool OffloadCall(OffloadFunc func, void *arg) {
+  // Queue a job on the second core. Returns false if the executor is unavailable or the
+  // queue is full - the caller must then run the job inline or retry next loop.
+  if (!OffloadInit()) { return false; }
+  OffloadJob job = { func, arg };
+  return (pdTRUE == xQueueSend(offload_queue, &job, 0));
+}
+
+bool IRAM_ATTR OffloadCallFromISR(OffloadFunc func, void *arg) {
+  if (!offload_queue) { return false; }            // Executor must have been started from task context first
+  OffloadJob job = { func, arg };
+  BaseType_t higher_priority_task_woken = pdFALSE;
+  bool result = (pdTRUE == xQueueSendFromISR(offload_queue, &job, &higher_priority_task_woken));
+  if (higher_priority_task_woken) { portYIELD_FROM_ISR(); }
+  return result;
+}
+
+#endif  // Not CORE32SOLO1
+#endif  // USE_OFFLOAD_EXECUTOR
+
 /********************************************************************************************/
 
 #endif  // ESP32
@@ -105,7 +105,11 @@ float ESP_getFreeHeap1024(void) {
 */
 
 uint32_t ESP_getMaxAllocHeap(void) {
-  return ESP.getFreeHeap();
+  return ESP.getMaxFreeBlockSize();      // Largest contiguous block, not total free
+}
+
+int32_t ESP_getHeapFragmentation(void) {
+  return ESP.getHeapFragmentation();
 }
 
 uint32_t ESP_getFlashChipId(void) {
@@ -161,6 +165,13 @@ void *special_calloc(size_t num, size_t size) {
   return calloc(num, size);
 }
 
+void *special_malloc_tag(const char *tag, uint32_t size) {
+#ifdef USE_HEAP_STATS
+  HeapStatsAccount(tag, size);           // No placement policy without PSRAM but keep per-tag churn
+#endif  // USE_HEAP_STATS
+  return malloc(size);
+}
+
 String GetDeviceHardware(void) {
   /*
   ESP8266 SoCs
@@ -19,6 +19,9 @@
   --------------------------------------------------------------------------------------------
   Version Date      Action    Description
   --------------------------------------------------------------------------------------------
+  2.1.0.0 20260830  expand    - Namespaced records with registration API and pull-style
+                                read-back iterator, usable by multiple drivers at once
+  ---
   2.0.0.0 20240625  expand    - Add support for ESP32
   ---
   1.0.0.0 20190923  started   - further development by Christian Baars  - https://github.com/Staars/Sonoff-Tasmota
@@ -39,6 +42,7 @@
 class FLOG
 
 #define MAGIC_WORD_FL 0x464c //F, L
+#define FLOG_MAX_NAMESPACES 4
 
 {
 
@@ -60,8 +64,21 @@ void _findFirstErasedSector(void);
 void _showBuffer(void);
 void _initBuffer(void);
 void _saveBufferToSector(void);
+uint8_t _recordSize(uint8_t id);
 header_t _saved_header;
 
+struct namespace_t{
+    uint8_t id;           // record tag byte, 0x00 and 0xff are reserved
+    uint8_t record_size;  // payload size in bytes
+    };
+namespace_t _namespaces[FLOG_MAX_NAMESPACES];
+uint8_t _num_namespaces = 0;
+
+uint16_t _iter_sector;        // sector currently loaded for iteration
+uint16_t _iter_sectors_left;  // sectors still to visit including the loaded one
+uint16_t _iter_pos;           // read position inside the loaded sector
+uint8_t  _iter_id;            // namespace the iteration filters on
+
 public:
   uint32_t size;                // size of OTA-partition
   uint32_t start;               // start position of OTA-partition in bytes
@@ -79,6 +96,7 @@ public:
   bool  ready = false;              // the FLOG is initialized
   bool  running_download = false;   // a download operation is running
   bool  recording = false;          // ready for recording
+  bool  iterating = false;          // a read-back iteration is running
 
   union sector_t{
   uint32_t dword_buffer[SPI_FLASH_SEC_SIZE/4];
@@ -91,6 +109,12 @@ public:
   void startRecording(bool append);
   void stopRecording(void);
 
+  bool registerNamespace(uint8_t id, uint8_t record_size);
+  bool addRecord(uint8_t id, const uint8_t *record);
+  bool startIteration(uint8_t id);
+  bool nextRecord(uint8_t *dest);
+  void stopIteration(void);
+
   typedef void (*CallbackNoArgs) ();                      // simple typedef for a callback
   typedef void (*CallbackWithArgs) (uint8_t *_record);    // typedef for a callback with one argument
 
@@ -419,4 +443,138 @@ void FLOG::stopRecording(void){
   _initBuffer();
   }
 
+/**
+ * @brief Register a record namespace so multiple drivers can share one log. Records of a
+ *        registered namespace are stored with a one byte tag in front of the payload and
+ *        can be read back selectively with startIteration()/nextRecord().
+ *
+ * @param id          tag byte of the namespace, 0x00 and 0xff are reserved
+ * @param record_size fixed payload size in bytes
+ * @return true on success, false on reserved/duplicate id or full registry
+ */
+bool FLOG::registerNamespace(uint8_t id, uint8_t record_size){
+  if(id == 0 || id == 0xff || record_size == 0){
+    return false;
+  }
+  if(_recordSize(id) != 0){
+    return false; // already registered
+  }
+  if(_num_namespaces == FLOG_MAX_NAMESPACES){
+    return false;
+  }
+  _namespaces[_num_namespaces].id = id;
+  _namespaces[_num_namespaces].record_size = record_size;
+  _num_namespaces++;
+  return true;
+}
+
+/**
+ * @brief payload size of a namespace, 0 if the id is not registered
+ */
+uint8_t FLOG::_recordSize(uint8_t id){
+  for(uint32_t i = 0; i<_num_namespaces; i++){
+    if(_namespaces[i].id == id){
+      return _namespaces[i].record_size;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief add one record of a registered namespace, tag and payload stay in the same sector
+ *
+ * @param id     registered namespace
+ * @param record payload of the size given at registration
+ * @return true if the record was buffered
+ */
+bool FLOG::addRecord(uint8_t id, const uint8_t *record){
+  uint8_t size = _recordSize(id);
+  if(size == 0 || !recording){
+    return false;
+  }
+  uint8_t framed[256];
+  framed[0] = id;
+  memcpy(framed+1, record, size);
+  addToBuffer(framed, size+1);
+  return true;
+}
+
+/**
+ * @brief Start streaming read-back of one namespace from the oldest saved sector. Like
+ *        startDownload() this uses the global sector buffer, so the active recording buffer
+ *        is consumed and re-initialized by stopIteration().
+ *
+ * @param id registered namespace to filter on
+ * @return true if iteration started
+ */
+bool FLOG::startIteration(uint8_t id){
+  if(running_download || iterating || _recordSize(id) == 0){
+    return false;
+  }
+  _readSector(sector.header.physical_start_sector);
+  _iter_sector = sector.header.physical_start_sector;
+  _iter_sectors_left = sectors_left;
+  _iter_pos = sizeof(sector.header);
+  _iter_id = id;
+  iterating = true;
+  return true;
+}
+
+/**
+ * @brief copy the next record of the iterated namespace to dest, records of other
+ *        registered namespaces are skipped by their known size
+ *
+ * @param dest buffer of at least the registered payload size
+ * @return true if a record was copied, false when the log is exhausted or unparsable
+ */
+bool FLOG::nextRecord(uint8_t *dest){
+  if(!iterating){
+    return false;
+  }
+  while(true){
+    if(_iter_pos >= sector.header.buf_pointer){
+      if(_iter_sectors_left <= 1){
+        return false; // all saved sectors visited
+      }
+      _iter_sector++;
+      if(_iter_sector > num_sectors){
+        _iter_sector = 0;
+      }
+      _iter_sectors_left--;
+      _readSector(_iter_sector);
+      _iter_pos = sizeof(sector.header);
+      OsWatchLoop();
+      continue;
+    }
+    uint8_t id = sector.byte_buffer[_iter_pos];
+    uint8_t size = _recordSize(id);
+    if(size == 0){
+      return false; // unknown tag, the rest of this log is not parsable
+    }
+    if(_iter_pos + 1 + size > sector.header.buf_pointer){
+      return false; // truncated record
+    }
+    if(id == _iter_id){
+      memcpy(dest, &sector.byte_buffer[_iter_pos+1], size);
+      _iter_pos += 1 + size;
+      return true;
+    }
+    _iter_pos += 1 + size;
+  }
+}
+
+/**
+ * @brief finish an iteration and restore the state for recording or another read-back
+ */
+void FLOG::stopIteration(void){
+  if(!iterating){
+    return;
+  }
+  iterating = false;
+  _searchSaves();
+  _initBuffer();
+}
+
+FLOG *Flog = nullptr;         // Shared flash log instance, created by the first driver that needs it
+
 #endif  // USE_FLOG
\ No newline at end of file
@@ -138,6 +138,111 @@ bool jpg2rgb888(const uint8_t *src, size_t src_len, uint8_t * out, jpg_scale_t s
     return true;
 }
 
+/*********************************************************************************************\
+ * Streaming decode straight to the display
+ *
+ * jpg2rgb888() needs width * height * 3 bytes for the whole decoded image, which rules
+ * out megapixel photos on small boards. jpg2display() instead converts each MCU band to
+ * 16-bit color as it is decoded and pushes it to the panel through the address-window
+ * path, so at most one band (width * 16 pixels) is held in RAM. The decoder's
+ * fractional scaling (1:1 .. 1:8) is applied before pixels ever reach RAM.
+\*********************************************************************************************/
+#ifdef USE_DISPLAY
+
+#include <renderer.h>
+extern Renderer *renderer;
+
+typedef struct {
+  uint16_t width;         // scaled output size, known once decoding starts
+  uint16_t height;
+  uint16_t xp;            // panel target position
+  uint16_t yp;
+  bool inverted;
+  const uint8_t *input;
+  uint16_t *strip;        // one MCU band of 16-bit pixels
+  uint16_t strip_y;       // first image row held in the strip
+  uint16_t strip_h;       // rows valid in the strip
+} jpg_stream_decoder;
+
+static size_t _strip_read(void *arg, size_t index, uint8_t *buf, size_t len) {
+  jpg_stream_decoder *jpeg = (jpg_stream_decoder *)arg;
+  if (buf) {
+    memcpy(buf, jpeg->input + index, len);
+  }
+  return len;
+}
+
+// block data arrives in R,G,B order from the decoder
+static void _strip_to_565(const uint8_t *in, uint16_t *out, uint32_t len, bool inverted) {
+  for (uint32_t cnt = 0; cnt < len; cnt++) {
+    uint8_t red = *in++;
+    uint8_t grn = *in++;
+    uint8_t blu = *in++;
+    if (inverted) {
+      red = 255 - red;
+      grn = 255 - grn;
+      blu = 255 - blu;
+    }
+    *out++ = ((red >> 3) << 11) | ((grn >> 2) << 5) | (blu >> 3);
+  }
+}
+
+static void _strip_flush(jpg_stream_decoder *jpeg) {
+  if (jpeg->strip_h) {
+    renderer->pushColors(jpeg->strip, jpeg->width * jpeg->strip_h, true);
+    jpeg->strip_h = 0;
+    OsWatchLoop();
+  }
+}
+
+static bool _strip_write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+  jpg_stream_decoder *jpeg = (jpg_stream_decoder *)arg;
+  if (!data) {
+    if (x == 0 && y == 0) {
+      // decode start, dimensions already include the decoder scaling
+      jpeg->width = w;
+      jpeg->height = h;
+      jpeg->strip = (uint16_t *)special_malloc_tag(PSTR("jpeg"), w * 16 * 2);   // MCU bands are at most 16 rows
+      if (!jpeg->strip) return false;
+      renderer->setAddrWindow(jpeg->xp, jpeg->yp, jpeg->xp + w, jpeg->yp + h);
+    } else {
+      // decode end, push the last band
+      _strip_flush(jpeg);
+      renderer->setAddrWindow(0, 0, 0, 0);
+    }
+    return true;
+  }
+  if (y != jpeg->strip_y) {     // block starts the next band, push the completed one
+    _strip_flush(jpeg);
+    jpeg->strip_y = y;
+  }
+  if (h > jpeg->strip_h) jpeg->strip_h = h;
+  for (uint32_t j = 0; j < h; j++) {
+    _strip_to_565(data + j * w * 3, jpeg->strip + j * jpeg->width + x, w, jpeg->inverted);
+  }
+  return true;
+}
+
+bool jpg2display(const uint8_t *src, size_t src_len, uint16_t xp, uint16_t yp, uint8_t scale, bool inverted)
+{
+  if (!renderer) return false;
+  jpg_stream_decoder jpeg;
+  jpeg.width = 0;
+  jpeg.height = 0;
+  jpeg.xp = xp;
+  jpeg.yp = yp;
+  jpeg.inverted = inverted;
+  jpeg.input = src;
+  jpeg.strip = nullptr;
+  jpeg.strip_y = 0;
+  jpeg.strip_h = 0;
+  esp_err_t res = esp_jpg_decode(src_len, (jpg_scale_t)(scale & 3), _strip_read, _strip_write, (void *)&jpeg);
+  if (jpeg.strip) free(jpeg.strip);
+  return (res == ESP_OK);
+}
+
+#endif // USE_DISPLAY
+
 // https://web.archive.org/web/20131016210645/http://www.64lines.com/jpeg-width-height
 //Gets the JPEG size from the array of data passed to the function, file reference: http://www.obrador.com/essentialjpeg/headerinfo.htm
 char get_jpeg_size(unsigned char* data, unsigned int data_size, unsigned short *width, unsigned short *height) {
@@ -0,0 +1,342 @@
+/*
+  support_kvstore.ino - Persistent key-value store for Tasmota
+
+  SPDX-FileCopyrightText: 2026 Theo Arends
+
+  SPDX-License-Identifier: GPL-3.0-only
+*/
+
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+/*********************************************************************************************\
+ * Log-structured key-value store on the flash filesystem.
+ *
+ * Writes append a record to a single log file and update a small hash index in RAM, so a
+ * frequently updated value costs one small append instead of a full file rewrite like the
+ * Berry persist module. Values keep a type tag (raw, string, int, real). When more than half
+ * the log is superseded records it is compacted by rewriting the live records.
+ *
+ * C API for drivers:
+ *   bool    KvsSet(const char *key, const void *value, uint16_t len, uint8_t type);
+ *   int32_t KvsGet(const char *key, void *value, uint16_t size, uint8_t *type);
+ *           returns the stored length or -1, probe with value = nullptr
+ *   bool    KvsDelete(const char *key);
+ *   bool    KvsCompact(void);
+ *
+ * Berry module `kvstore` maps to the same store, see xdrv_52_3_berry_kvstore.ino
+ *
+ * Command KvStore             - report number of keys, log size and superseded bytes
+ * Command KvStore key         - report the value of key as string
+ * Command KvStore key value   - store value as string
+ * Command KvStore2 key        - delete key
+\*********************************************************************************************/
+
+#define KVS_FILE               "/.kvs"
+#define KVS_FILE_TMP           "/.kvs.tmp"
+
+// KVS_TYPE_xxx value type tags are defined in tasmota_globals.h
+
+#ifndef KVS_MAX_KEY_SIZE
+#define KVS_MAX_KEY_SIZE       64        // Maximum key length in bytes
+#endif
+#ifndef KVS_MAX_VALUE_SIZE
+#define KVS_MAX_VALUE_SIZE     1024      // Maximum value length in bytes
+#endif
+#ifndef KVS_COMPACT_MIN_SIZE
+#define KVS_COMPACT_MIN_SIZE   4096      // Log size in bytes before compaction is considered
+#endif
+
+extern FS *ffsp;
+extern uint8_t ffs_type;
+
+typedef struct {
+  uint8_t  klen;               // Key length in bytes, no zero terminator stored
+  uint8_t  type;               // KVS_TYPE_xxx
+  uint16_t vlen;               // Value length in bytes, 0xFFFF = deletion marker
+} TKvsRecord;                  // Followed by key and value bytes
+
+typedef struct {
+  uint32_t hash;               // FNV-1a hash of the key
+  uint32_t offset;             // Record offset in the log file
+  uint16_t vlen;               // Value length for dead byte accounting
+  uint8_t  klen;
+  uint8_t  type;
+} TKvsIndex;
+
+struct {
+  TKvsIndex *index = nullptr;  // Hash index over the log file
+  uint16_t count = 0;          // Used index entries
+  uint16_t size = 0;           // Allocated index entries
+  uint32_t file_size = 0;      // Append position
+  uint32_t dead_bytes = 0;     // Bytes of superseded records and deletion markers
+  bool init_done = false;
+  bool ready = false;
+} Kvs;
+
+uint32_t KvsHash(const char *key, uint32_t klen) {
+  uint32_t hash = 2166136261UL;
+  for (uint32_t i = 0; i < klen; i++) {
+    hash ^= (uint8_t)key[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+bool KvsIndexAdd(TKvsIndex *entry) {
+  if (Kvs.count == Kvs.size) {
+    uint16_t size = (Kvs.size) ? Kvs.size * 2 : 16;
+    TKvsIndex *index = (TKvsIndex*)special_malloc(size * sizeof(TKvsIndex));
+    if (!index) { return false; }
+    if (Kvs.index) {
+      memcpy(index, Kvs.index, Kvs.count * sizeof(TKvsIndex));
+      free(Kvs.index);
+    }
+    Kvs.index = index;
+    Kvs.size = size;
+  }
+  Kvs.index[Kvs.count++] = *entry;
+  return true;
+}
+
+int32_t KvsIndexFind(const char *key, uint32_t klen, File *fp) {
+  // Hash matches are verified against the key stored in the log to rule out collisions
+  uint32_t hash = KvsHash(key, klen);
+  for (uint32_t i = 0; i < Kvs.count; i++) {
+    if ((Kvs.index[i].hash == hash) && (Kvs.index[i].klen == klen)) {
+      char fkey[KVS_MAX_KEY_SIZE];
+      fp->seek(Kvs.index[i].offset + sizeof(TKvsRecord), SeekSet);
+      if (fp->read((uint8_t*)fkey, klen) != klen) { return -1; }
+      if (!memcmp(fkey, key, klen)) { return i; }
+    }
+  }
+  return -1;
+}
+
+bool KvsInit(void) {
+  if (Kvs.init_done) { return Kvs.ready; }
+  Kvs.init_done = true;
+  if (!ffs_type) { return false; }
+
+  File fp = ffsp->open(KVS_FILE, "r");
+  if (fp) {
+    // Replay the log oldest record first so the index ends up at the latest version of each key
+    TKvsRecord record;
+    char key[KVS_MAX_KEY_SIZE];
+    uint32_t offset = 0;
+    while (fp.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+      if ((0 == record.klen) || (record.klen > KVS_MAX_KEY_SIZE)) { break; }  // Corrupt log - keep what we have
+      fp.seek(offset + sizeof(record), SeekSet);
+      if (fp.read((uint8_t*)key, record.klen) != record.klen) { break; }
+      uint32_t vlen = (0xFFFF == record.vlen) ? 0 : record.vlen;
+      int32_t idx = KvsIndexFind(key, record.klen, &fp);
+      if (idx >= 0) {
+        Kvs.dead_bytes += sizeof(record) + Kvs.index[idx].klen + Kvs.index[idx].vlen;
+      }
+      if (0xFFFF == record.vlen) {
+        // Deletion marker supersedes the record and itself
+        if (idx >= 0) {
+          Kvs.index[idx] = Kvs.index[--Kvs.count];
+        }
+        Kvs.dead_bytes += sizeof(record) + record.klen;
+      } else {
+        TKvsIndex entry;
+        entry.hash = KvsHash(key, record.klen);
+        entry.offset = offset;
+        entry.vlen = record.vlen;
+        entry.klen = record.klen;
+        entry.type = record.type;
+        if (idx >= 0) {
+          Kvs.index[idx] = entry;
+        } else {
+          KvsIndexAdd(&entry);
+        }
+      }
+      offset += sizeof(record) + record.klen + vlen;
+      fp.seek(offset, SeekSet);
+    }
+    Kvs.file_size = offset;
+    fp.close();
+  }
+  Kvs.ready = true;
+  return true;
+}
+
+uint32_t KvsCount(void) {
+  KvsInit();
+  return Kvs.count;
+}
+
+bool KvsAppend(const char *key, uint32_t klen, const void *value, uint16_t vlen, uint8_t type) {
+  File fp = ffsp->open(KVS_FILE, "a");
+  if (!fp) { return false; }
+  if (fp.position() != Kvs.file_size) {
+    fp.seek(Kvs.file_size, SeekSet);   // Drop trailing garbage from an interrupted write
+  }
+  TKvsRecord record;
+  record.klen = klen;
+  record.type = type;
+  record.vlen = vlen;
+  bool result = (fp.write((uint8_t*)&record, sizeof(record)) == sizeof(record));
+  if (result) { result = (fp.write((uint8_t*)key, klen) == klen); }
+  if (result && (0xFFFF != vlen) && vlen) { result = (fp.write((uint8_t*)value, vlen) == vlen); }
+  fp.close();
+  if (result) {
+    Kvs.file_size += sizeof(record) + klen + ((0xFFFF == vlen) ? 0 : vlen);
+  }
+  return result;
+}
+
+bool KvsCompact(void) {
+  if (!KvsInit()) { return false; }
+
+  File fp = ffsp->open(KVS_FILE, "r");
+  if (!fp) { return false; }
+  File tp = ffsp->open(KVS_FILE_TMP, "w");
+  if (!tp) {
+    fp.close();
+    return false;
+  }
+  // Copy only the live version of every key, then swap the files and rebase the index
+  char buffer[KVS_MAX_KEY_SIZE];
+  uint32_t offset = 0;
+  bool result = true;
+  for (uint32_t i = 0; (i < Kvs.count) && result; i++) {
+    TKvsRecord record;
+    record.klen = Kvs.index[i].klen;
+    record.type = Kvs.index[i].type;
+    record.vlen = Kvs.index[i].vlen;
+    result = (tp.write((uint8_t*)&record, sizeof(record)) == sizeof(record));
+    fp.seek(Kvs.index[i].offset + sizeof(record), SeekSet);
+    uint32_t left = record.klen + record.vlen;
+    while (left && result) {
+      uint32_t chunk = (left > sizeof(buffer)) ? sizeof(buffer) : left;
+      result = (fp.read((uint8_t*)buffer, chunk) == chunk) && (tp.write((uint8_t*)buffer, chunk) == chunk);
+      left -= chunk;
+    }
+    Kvs.index[i].offset = offset;
+    offset += sizeof(record) + record.klen + record.vlen;
+  }
+  fp.close();
+  tp.close();
+  if (!result) {
+    ffsp->remove(KVS_FILE_TMP);
+    Kvs.ready = false;                 // Index offsets are rebased - force a replay on next access
+    Kvs.init_done = false;
+    Kvs.count = 0;
+    Kvs.dead_bytes = 0;
+    return false;
+  }
+  ffsp->remove(KVS_FILE);
+  ffsp->rename(KVS_FILE_TMP, KVS_FILE);
+  Kvs.file_size = offset;
+  Kvs.dead_bytes = 0;
+  return true;
+}
+
+bool KvsSet(const char *key, const void *value, uint16_t len, uint8_t type = KVS_TYPE_RAW) {
+  uint32_t klen = strlen(key);
+  if (!klen || (klen > KVS_MAX_KEY_SIZE) || (len > KVS_MAX_VALUE_SIZE)) { return false; }
+  if (!KvsInit()) { return false; }
+
+  File fp = ffsp->open(KVS_FILE, "r");
+  int32_t idx = (fp) ? KvsIndexFind(key, klen, &fp) : -1;
+  if (fp) { fp.close(); }
+
+  TKvsIndex entry;
+  entry.hash = KvsHash(key, klen);
+  entry.offset = Kvs.file_size;
+  entry.vlen = len;
+  entry.klen = klen;
+  entry.type = type;
+  if (!KvsAppend(key, klen, value, len, type)) { return false; }
+  if (idx >= 0) {
+    Kvs.dead_bytes += sizeof(TKvsRecord) + Kvs.index[idx].klen + Kvs.index[idx].vlen;
+    Kvs.index[idx] = entry;
+  } else {
+    KvsIndexAdd(&entry);
+  }
+  if ((Kvs.file_size > KVS_COMPACT_MIN_SIZE) && (Kvs.dead_bytes > Kvs.file_size / 2)) {
+    KvsCompact();
+  }
+  return true;
+}
+
+int32_t KvsGet(const char *key, void *value, uint16_t size, uint8_t *type = nullptr) {
+  uint32_t klen = strlen(key);
+  if (!klen || (klen > KVS_MAX_KEY_SIZE)) { return -1; }
+  if (!KvsInit()) { return -1; }
+
+  File fp = ffsp->open(KVS_FILE, "r");
+  if (!fp) { return -1; }
+  int32_t idx = KvsIndexFind(key, klen, &fp);
+  if (idx < 0) {
+    fp.close();
+    return -1;
+  }
+  if (type) { *type = Kvs.index[idx].type; }
+  int32_t vlen = Kvs.index[idx].vlen;
+  if (value) {
+    uint32_t read = ((uint32_t)vlen > size) ? size : vlen;
+    fp.seek(Kvs.index[idx].offset + sizeof(TKvsRecord) + klen, SeekSet);
+    if (fp.read((uint8_t*)value, read) != read) { vlen = -1; }
+  }
+  fp.close();
+  return vlen;
+}
+
+bool KvsDelete(const char *key) {
+  uint32_t klen = strlen(key);
+  if (!klen || (klen > KVS_MAX_KEY_SIZE)) { return false; }
+  if (!KvsInit()) { return false; }
+
+  File fp = ffsp->open(KVS_FILE, "r");
+  int32_t idx = (fp) ? KvsIndexFind(key, klen, &fp) : -1;
+  if (fp) { fp.close(); }
+  if (idx < 0) { return false; }
+
+  if (!KvsAppend(key, klen, nullptr, 0xFFFF, KVS_TYPE_RAW)) { return false; }
+  Kvs.dead_bytes += (2 * sizeof(TKvsRecord)) + (2 * klen) + Kvs.index[idx].vlen;  // Old record and the marker itself
+  Kvs.index[idx] = Kvs.index[--Kvs.count];
+  return true;
+}
+
+/*********************************************************************************************\
+ * Command KvStore
+\*********************************************************************************************/
+
+void CmndKvStore(void) {
+  if (2 == XdrvMailbox.index) {
+    if (XdrvMailbox.data_len && KvsDelete(XdrvMailbox.data)) {
+      ResponseCmndDone();
+    } else {
+      ResponseCmndError();
+    }
+    return;
+  }
+  if (XdrvMailbox.data_len) {
+    char *value = strchr(XdrvMailbox.data, ' ');
+    if (value) {
+      *value++ = '\0';
+      if (KvsSet(XdrvMailbox.data, value, strlen(value), KVS_TYPE_STRING)) {
+        Response_P(PSTR("{\"%s\":{\"%s\":\"%s\"}}"), XdrvMailbox.command, XdrvMailbox.data, EscapeJSONString(value).c_str());
+      } else {
+        ResponseCmndError();
+      }
+    } else {
+      char *buffer = (char*)malloc(KVS_MAX_VALUE_SIZE +1);
+      if (!buffer) { return; }
+      int32_t vlen = KvsGet(XdrvMailbox.data, buffer, KVS_MAX_VALUE_SIZE);
+      if (vlen >= 0) {
+        buffer[(vlen > KVS_MAX_VALUE_SIZE) ? KVS_MAX_VALUE_SIZE : vlen] = '\0';
+        Response_P(PSTR("{\"%s\":{\"%s\":\"%s\"}}"), XdrvMailbox.command, XdrvMailbox.data, EscapeJSONString(buffer).c_str());
+      } else {
+        Response_P(PSTR("{\"%s\":{\"%s\":null}}"), XdrvMailbox.command, XdrvMailbox.data);
+      }
+      free(buffer);
+    }
+  } else {
+    KvsInit();
+    Response_P(PSTR("{\"%s\":{\"Keys\":%d,\"Size\":%d,\"Dead\":%d}}"), XdrvMailbox.command, Kvs.count, Kvs.file_size, Kvs.dead_bytes);
+  }
+}
+
+#endif  // USE_UFILESYS && USE_KVSTORE
@@ -17,21 +17,85 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+/*********************************************************************************************\
+ * DNS resolve cache
+ *
+ * Remembers both successful and failed lookups so periodic senders like syslog do not issue a
+ * blocking DNS query per message, nor hammer an unreachable resolver on every attempt.
+\*********************************************************************************************/
+
+#ifndef DNS_CACHE_TTL
+#define DNS_CACHE_TTL               600     // Seconds a resolved address stays valid
+#endif
+#ifndef DNS_CACHE_NEGATIVE_TTL
+#define DNS_CACHE_NEGATIVE_TTL      30      // Seconds a failed lookup is not retried
+#endif
+#ifndef DNS_CACHE_ENTRIES
+#define DNS_CACHE_ENTRIES           4
+#endif
+
+struct DnsCacheEntry {
+  uint32_t name_hash;                 // Hash of the host name
+  uint32_t expire_time;               // millis() after which the entry is stale
+  IPAddress ip_address;
+  bool negative;                      // Lookup failed - do not retry until expired
+};
+DnsCacheEntry dns_resolve_cache[DNS_CACHE_ENTRIES];
+uint8_t dns_resolve_cache_next = 0;
+
+bool NetworkHostByName(const char* hostname, IPAddress& result) {
+  uint32_t now = millis();
+  uint32_t name_hash = GetHash(hostname, strlen(hostname));
+  for (uint32_t i = 0; i < DNS_CACHE_ENTRIES; i++) {
+    if ((dns_resolve_cache[i].name_hash == name_hash) && ((int32_t)(dns_resolve_cache[i].expire_time - now) > 0)) {
+      if (dns_resolve_cache[i].negative) { return false; }
+      result = dns_resolve_cache[i].ip_address;
+      return true;
+    }
+  }
+  bool success = WifiHostByName(hostname, result);
+  DnsCacheEntry* entry = &dns_resolve_cache[dns_resolve_cache_next];
+  dns_resolve_cache_next = (dns_resolve_cache_next + 1) % DNS_CACHE_ENTRIES;
+  entry->name_hash = name_hash;
+  entry->negative = !success;
+  entry->expire_time = now + (success ? DNS_CACHE_TTL : DNS_CACHE_NEGATIVE_TTL) * 1000;
+  if (success) { entry->ip_address = result; }
+  return success;
+}
+
 /*********************************************************************************************\
  * MDNS
 \*********************************************************************************************/
 
 struct {
+  uint32_t ip_registered = 0;         // IPv4 the responder records were built with
+  uint32_t update_timer = 0;          // Packet servicing tick (ESP8266)
   uint8_t begun = 0;                  // mDNS active
 } Mdns;
 
 #ifdef USE_DISCOVERY
 void StartMdns(void) {
   if (Settings->flag3.mdns_enabled) {  // SetOption55 - Control mDNS service
+    uint32_t ip = (uint32_t)WiFi.localIP();
+#ifdef WEBSERVER_ADVERTISE
+    bool readd_http = false;
+#endif  // WEBSERVER_ADVERTISE
+    if (Mdns.begun && (ip != Mdns.ip_registered)) {
+      // Address changed since the responder was started (reconnect or DHCP renew),
+      // restart it so its records announce the current address
+#ifdef WEBSERVER_ADVERTISE
+      readd_http = (2 == Mdns.begun);
+#endif  // WEBSERVER_ADVERTISE
+      Mdns.begun = 0;
+    }
     if (!Mdns.begun) {
       MDNS.end(); // close existing or MDNS.begin will fail
       Mdns.begun = (uint8_t)MDNS.begin(TasmotaGlobal.hostname);
+      Mdns.ip_registered = ip;
       AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_MDNS "%s '%s.local'"), (Mdns.begun) ? PSTR(D_INITIALIZED) : PSTR(D_FAILED), TasmotaGlobal.hostname);
+#ifdef WEBSERVER_ADVERTISE
+      if (readd_http) { MdnsAddServiceHttp(); }
+#endif  // WEBSERVER_ADVERTISE
     }
   }
 }
@@ -74,6 +138,8 @@ void MdnsAddServiceHttp(void) {
 #ifdef ESP8266 //Not needed with esp32 mdns
 void MdnsUpdate(void) {
   if (2 == Mdns.begun) {
+    if (!TimeReached(Mdns.update_timer)) { return; }  // batch packet servicing per tick instead of every loop pass
+    SetNextTimeInterval(Mdns.update_timer, 50);
     MDNS.update(); // this is basically passpacket like a webserver
    // being called in main loop so no logging
    // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_MDNS "MDNS.update"));
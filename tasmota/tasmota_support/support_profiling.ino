@@ -90,3 +90,408 @@ void AddLogFunction(const char *driver, uint8_t index, uint8_t function, uint32_
 #endif  // USE_PROFILE_DRIVER
 
 #endif  // USE_PROFILING
+
+/*********************************************************************************************\
+ * Per-driver dispatch statistics with duration histograms
+ *
+ * Cycle-count timing around every XdrvCall/XsnsCall dispatch of the hot tick events and
+ * FUNC_EVERY_SECOND. Command Profile dumps the table as JSON on the stat topic:
+ *   Profile    - report statistics
+ *   Profile 0  - stop collecting and release memory
+ *   Profile 1  - start (or restart) collecting
+\*********************************************************************************************/
+
+#ifdef USE_PROFILE_STATS
+
+#define PROFILE_STATS_BUCKETS  8                   // log2 histogram buckets: <64us, <128us, ... >=4096us
+
+struct ProfileStatSlot {
+  uint32_t count;
+  uint32_t total_us;
+  uint32_t max_us;                                 // Worst-case latch
+  uint32_t bucket[PROFILE_STATS_BUCKETS];
+};
+
+struct ProfileStatEntry {
+  ProfileStatSlot tick;                            // FUNC_LOOP, FUNC_SLEEP_LOOP and FUNC_EVERY_xx_MSECOND
+  ProfileStatSlot second;                          // FUNC_EVERY_SECOND
+};
+
+ProfileStatEntry *profile_stats_drv = nullptr;
+ProfileStatEntry *profile_stats_sns = nullptr;
+
+void ProfileStatsAdd(uint32_t sensor, uint32_t slot, uint32_t function, uint32_t start_cycles) {
+  if (!profile_stats_drv) { return; }
+  ProfileStatSlot *stat;
+  ProfileStatEntry *entry = (sensor) ? &profile_stats_sns[slot] : &profile_stats_drv[slot];
+  switch (function) {
+    case FUNC_LOOP:
+    case FUNC_SLEEP_LOOP:
+    case FUNC_EVERY_50_MSECOND:
+    case FUNC_EVERY_100_MSECOND:
+    case FUNC_EVERY_200_MSECOND:
+    case FUNC_EVERY_250_MSECOND:
+      stat = &entry->tick;
+      break;
+    case FUNC_EVERY_SECOND:
+      stat = &entry->second;
+      break;
+    default:
+      return;
+  }
+  uint32_t usec = (ESP.getCycleCount() - start_cycles) / ESP.getCpuFreqMHz();
+  stat->count++;
+  stat->total_us += usec;
+  if (usec > stat->max_us) { stat->max_us = usec; }
+  uint32_t bucket = 0;
+  while ((usec >= 64) && (bucket < PROFILE_STATS_BUCKETS -1)) {
+    usec >>= 1;
+    bucket++;
+  }
+  stat->bucket[bucket]++;
+}
+
+void ProfileStatsAppendSlot(const char *label, ProfileStatSlot *stat) {
+  ResponseAppend_P(PSTR("\"%s\":{\"Count\":%u,\"AvgUs\":%u,\"MaxUs\":%u,\"Hist\":["),
+    label, stat->count, (stat->count) ? stat->total_us / stat->count : 0, stat->max_us);
+  for (uint32_t i = 0; i < PROFILE_STATS_BUCKETS; i++) {
+    ResponseAppend_P(PSTR("%s%u"), (i) ? "," : "", stat->bucket[i]);
+  }
+  ResponseAppend_P(PSTR("]}"));
+}
+
+void ProfileStatsAppend(const char *type, ProfileStatEntry *stats, const uint8_t *id_list, uint32_t present) {
+  ResponseAppend_P(PSTR(",\"%s\":{"), type);
+  bool first = true;
+  for (uint32_t x = 0; x < present; x++) {
+    if (!stats[x].tick.count && !stats[x].second.count) { continue; }  // Skip drivers never dispatched
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t id = pgm_read_byte(id_list + x);
+#else
+    uint32_t id = id_list[x];
+#endif
+    ResponseAppend_P(PSTR("%s\"%u\":{"), (first) ? "" : ",", id);
+    first = false;
+    ProfileStatsAppendSlot("Tick", &stats[x].tick);
+    ResponseAppend_P(PSTR(","));
+    ProfileStatsAppendSlot("Sec", &stats[x].second);
+    ResponseAppend_P(PSTR("}"));
+  }
+  ResponseAppend_P(PSTR("}"));
+}
+
+void CmndProfile(void) {
+  if (0 == XdrvMailbox.payload) {                  // Profile 0 - stop and release
+    free(profile_stats_drv);
+    free(profile_stats_sns);
+    profile_stats_drv = nullptr;
+    profile_stats_sns = nullptr;
+    ResponseCmndDone();
+  }
+  else if (1 == XdrvMailbox.payload) {             // Profile 1 - (re)start collecting
+    if (!profile_stats_drv) {
+      profile_stats_drv = (ProfileStatEntry *)calloc(xdrv_present, sizeof(ProfileStatEntry));
+      profile_stats_sns = (ProfileStatEntry *)calloc(xsns_present, sizeof(ProfileStatEntry));
+      if (!profile_stats_drv || !profile_stats_sns) {
+        free(profile_stats_drv);
+        free(profile_stats_sns);
+        profile_stats_drv = nullptr;
+        profile_stats_sns = nullptr;
+        ResponseCmndChar(PSTR(D_JSON_ABORTED));
+        return;
+      }
+    } else {
+      memset(profile_stats_drv, 0, xdrv_present * sizeof(ProfileStatEntry));
+      memset(profile_stats_sns, 0, xsns_present * sizeof(ProfileStatEntry));
+    }
+    memset(&ResponseStats, 0, sizeof(ResponseStats));
+    ResponseCmndDone();
+  }
+  else {                                           // Profile - report
+    if (!profile_stats_drv) {
+      ResponseCmndChar(PSTR(D_JSON_EMPTY));
+      return;
+    }
+    Response_P(PSTR("{\"%s\":{\"Uptime\":%d"), XdrvMailbox.command, TasmotaGlobal.uptime);
+    ProfileStatsAppend("Drv", profile_stats_drv, kXdrvList, xdrv_present);
+    ProfileStatsAppend("Sns", profile_stats_sns, kXsnsList, xsns_present);
+    ResponseAppend_P(PSTR(",\"Response\":{\"Appends\":%u,\"Moves\":%u,\"Drops\":%u,\"MaxLen\":%u}"),
+      ResponseStats.appends, ResponseStats.moves, ResponseStats.drops, ResponseStats.max_len);
+    ResponseJsonEndEnd();
+  }
+}
+
+#endif  // USE_PROFILE_STATS
+
+/*********************************************************************************************\
+ * On-device microbenchmark suite
+ *
+ * Command Benchmark runs a fixed set of primitive operations and reports a JSON scorecard.
+ * Per-operation tests report nanoseconds per operation, flash read reports kBytes/s. Run it
+ * across firmware upgrades and chip revisions to catch performance regressions in the field.
+\*********************************************************************************************/
+
+#ifdef USE_BENCHMARK
+
+const char kBenchmarkJson[] PROGMEM = "{\"Time\":\"2026-01-01T12:00:00\",\"Switch1\":\"ON\",\"ENERGY\":{\"Total\":12.345,\"Power\":67,\"Voltage\":230},\"Dimmer\":50}";
+
+uint32_t BenchmarkNsPerOp(uint32_t start_us, uint32_t iterations) {
+  return (uint32_t)(((uint64_t)(micros() - start_us) * 1000) / iterations);
+}
+
+uint32_t BenchmarkResponseP(void) {
+  float fval = 1234.5678f;
+  uint32_t iterations = 200;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    Response_P(PSTR("{\"Uptime\":%d,\"MqttCount\":%d,\"Temperature\":%3_f,\"State\":\"%s\"}"),
+      TasmotaGlobal.uptime, i, &fval, PSTR("benchmark"));
+  }
+  return BenchmarkNsPerOp(start, iterations);
+}
+
+uint32_t BenchmarkJsonParse(void) {
+  char json[sizeof(kBenchmarkJson)];
+  uint32_t iterations = 100;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    strcpy_P(json, kBenchmarkJson);                // parser modifies the buffer in place
+    JsonParser parser(json);
+    JsonParserObject root = parser.getRootObject();
+    JsonParserToken val = root[PSTR("Dimmer")];
+    if (!val.isValid()) { return 0; }              // parse failure, report 0 as canary
+  }
+  return BenchmarkNsPerOp(start, iterations);
+}
+
+#ifdef USE_UNISHOX_COMPRESSION
+uint32_t BenchmarkUnishox(void) {
+  char uncompressed[sizeof(kBenchmarkJson)];
+  char buffer[sizeof(kBenchmarkJson) + 16];
+  char roundtrip[sizeof(kBenchmarkJson) + 16];
+  strcpy_P(uncompressed, kBenchmarkJson);
+  uint32_t len = strlen(uncompressed);
+  uint32_t iterations = 50;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    int32_t clen = compressor.unishox_compress(uncompressed, len, buffer, sizeof(buffer));
+    if (clen <= 0) { return 0; }
+    if (compressor.unishox_decompress(buffer, clen, roundtrip, sizeof(roundtrip)) != (int32_t)len) { return 0; }
+  }
+  return BenchmarkNsPerOp(start, iterations);
+}
+#endif  // USE_UNISHOX_COMPRESSION
+
+uint32_t BenchmarkFloatMath(void) {
+  volatile float x = 1.0001f;                      // volatile defeats constant folding
+  float acc = 0;
+  uint32_t iterations = 1000;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc += x * 1.5f;
+  }
+  x = acc;                                         // keep the result alive
+  return BenchmarkNsPerOp(start, iterations);
+}
+
+uint32_t BenchmarkFixedMath(void) {
+  volatile int32_t x = 65543;                      // ~1.0001 in Q16.16
+  int32_t acc = 0;
+  uint32_t iterations = 1000;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc += (int32_t)(((int64_t)x * 98304) >> 16);  // multiply by 1.5 in Q16.16
+  }
+  x = acc;                                         // keep the result alive
+  return BenchmarkNsPerOp(start, iterations);
+}
+
+uint32_t BenchmarkSin52(void) {
+  volatile float x = 0.7f;
+  float acc = 0;
+  uint32_t iterations = 200;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc += sin_52(x);
+  }
+  x = acc;                                         // keep the result alive
+  return BenchmarkNsPerOp(start, iterations);
+}
+
+uint32_t BenchmarkFlashRead(void) {
+  uint32_t buffer[256];                            // 1k block on the stack, read from the start of flash
+  uint32_t iterations = 32;
+  uint32_t start = millis();
+  for (uint32_t i = 0; i < iterations; i++) {
+    if (!ESP.flashRead(i * sizeof(buffer), buffer, sizeof(buffer))) { return 0; }
+  }
+  uint32_t elapsed = millis() - start;
+  if (0 == elapsed) { elapsed = 1; }
+  return (iterations * sizeof(buffer)) / elapsed;  // bytes per ms == kBytes/s
+}
+
+uint32_t BenchmarkSettingsSave(void) {
+  Settings->cfg_timestamp++;                       // force a settings write, overwritten with real time by the save
+  uint32_t start = millis();
+  SettingsSave(0);
+  return millis() - start;
+}
+
+void CmndBenchmark(void) {
+  uint32_t response_p = BenchmarkResponseP();      // clobbers the response buffer, run all tests first
+  yield();
+  uint32_t json_parse = BenchmarkJsonParse();
+  yield();
+#ifdef USE_UNISHOX_COMPRESSION
+  uint32_t unishox = BenchmarkUnishox();
+  yield();
+#endif  // USE_UNISHOX_COMPRESSION
+  uint32_t float_math = BenchmarkFloatMath();
+  uint32_t fixed_math = BenchmarkFixedMath();
+  uint32_t sin_math = BenchmarkSin52();
+  yield();
+  uint32_t flash_read = BenchmarkFlashRead();
+  yield();
+  uint32_t settings_save = BenchmarkSettingsSave();
+  uint32_t mqtt_pub = 0;
+  if (MqttIsConnected()) {
+    uint32_t start = micros();
+    MqttPublishPayloadPrefixTopic_P(STAT, PSTR("BENCHMARK"), "{\"Benchmark\":\"ping\"}");
+    mqtt_pub = micros() - start;
+  }
+  Response_P(PSTR("{\"%s\":{\"ResponseP\":%u,\"JsonParse\":%u"), XdrvMailbox.command, response_p, json_parse);
+#ifdef USE_UNISHOX_COMPRESSION
+  ResponseAppend_P(PSTR(",\"Unishox\":%u"), unishox);
+#endif  // USE_UNISHOX_COMPRESSION
+  ResponseAppend_P(PSTR(",\"Float\":%u,\"Fixed\":%u,\"Sin52\":%u,\"FlashReadKBs\":%u,\"SettingsSaveMs\":%u"),
+    float_math, fixed_math, sin_math, flash_read, settings_save);
+  if (mqtt_pub) {
+    ResponseAppend_P(PSTR(",\"MqttPubUs\":%u"), mqtt_pub);
+  }
+  ResponseJsonEndEnd();
+}
+
+#endif  // USE_BENCHMARK
+
+/*********************************************************************************************\
+ * Cycle-accurate hot-path tracepoints
+ *
+ * Named probes TRACE_BEGIN()/TRACE_END() bracket the driver and sensor dispatchers, MQTT
+ * publish, settings save and the display dispatcher. Each probe can mirror on a GPIO for
+ * scope or logic analyzer capture and append an 8 byte record (CPU cycle counter, probe id,
+ * begin/end) to a RAM ring downloadable as CSV from webserver page /trace:
+ *   Trace                     - report capture state and record count
+ *   Trace 0                   - stop capture and release the ring
+ *   Trace 1                   - start or restart capture into the RAM ring
+ *   TracePin <gpio>[,<probe>] - mirror probe 0..3 on a GPIO, TracePin -1 to disable
+\*********************************************************************************************/
+
+#ifdef USE_PROFILE_TRACE
+
+#ifndef TRACE_RING_RECORDS
+#define TRACE_RING_RECORDS           1024        // Trace ring size in records of 8 bytes
+#endif
+
+const char kProfileTraceNames[] PROGMEM = "Dispatch|MqttPublish|SettingsSave|DisplayFlush";
+
+struct TraceRecord {
+  uint32_t cycles;                               // ESP.getCycleCount() at the probe
+  uint16_t id;                                   // ProfileTracePoints
+  uint16_t begin;                                // 1 = begin, 0 = end
+};
+
+TraceRecord *trace_ring = nullptr;
+uint32_t trace_ring_head = 0;
+bool trace_ring_wrapped = false;
+int8_t trace_pin = -1;                           // GPIO mirroring one probe, -1 = disabled
+uint8_t trace_pin_probe = TRACE_DISPATCH;
+
+void ProfileTraceMark(uint32_t id, uint32_t begin) {
+  if ((trace_pin >= 0) && (id == trace_pin_probe)) {
+    digitalWrite(trace_pin, begin);
+  }
+  if (trace_ring) {
+    TraceRecord *record = &trace_ring[trace_ring_head];
+    record->cycles = ESP.getCycleCount();
+    record->id = id;
+    record->begin = begin;
+    trace_ring_head++;
+    if (trace_ring_head >= TRACE_RING_RECORDS) {
+      trace_ring_head = 0;
+      trace_ring_wrapped = true;
+    }
+  }
+}
+
+#ifdef USE_WEBSERVER
+void HandleTraceDownload(void) {
+  // Stream the trace ring as CSV, oldest record first. Cycle counts are raw ESP.getCycleCount()
+  // values; divide deltas by getCpuFrequencyMhz to get microseconds.
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  WSContentBegin(200, CT_PLAIN);
+  WSContentSend_P(PSTR("index,cycles,probe,phase\n"));
+  if (trace_ring) {
+    uint32_t count = (trace_ring_wrapped) ? TRACE_RING_RECORDS : trace_ring_head;
+    uint32_t first = (trace_ring_wrapped) ? trace_ring_head : 0;
+    char probe_name[16];
+    for (uint32_t i = 0; i < count; i++) {
+      TraceRecord *record = &trace_ring[(first + i) % TRACE_RING_RECORDS];
+      WSContentSend_P(PSTR("%u,%u,%s,%c\n"), i, record->cycles,
+        GetTextIndexed(probe_name, sizeof(probe_name), record->id, kProfileTraceNames),
+        (record->begin) ? 'B' : 'E');
+    }
+  }
+  WSContentEnd();
+}
+#endif  // USE_WEBSERVER
+
+void CmndTrace(void) {
+  if (0 == XdrvMailbox.payload) {                  // Trace 0 - stop capture and release the ring
+    free(trace_ring);
+    trace_ring = nullptr;
+    trace_ring_head = 0;
+    trace_ring_wrapped = false;
+    ResponseCmndDone();
+  }
+  else if (1 == XdrvMailbox.payload) {             // Trace 1 - start or restart capture
+    if (!trace_ring) {
+      trace_ring = (TraceRecord*)special_malloc_tag(PSTR("trace"), TRACE_RING_RECORDS * sizeof(TraceRecord));
+    }
+    if (!trace_ring) {
+      ResponseCmndChar(PSTR(D_JSON_ABORTED));
+      return;
+    }
+    trace_ring_head = 0;
+    trace_ring_wrapped = false;
+    ResponseCmndDone();
+  }
+  else {                                           // Trace - report capture state
+    char probe_name[16];
+    Response_P(PSTR("{\"%s\":{\"Active\":%d,\"Records\":%u,\"Size\":%u,\"Pin\":%d,\"PinProbe\":\"%s\"}}"),
+      XdrvMailbox.command, (trace_ring) ? 1 : 0,
+      (trace_ring_wrapped) ? TRACE_RING_RECORDS : trace_ring_head, TRACE_RING_RECORDS, trace_pin,
+      GetTextIndexed(probe_name, sizeof(probe_name), trace_pin_probe, kProfileTraceNames));
+  }
+}
+
+void CmndTracePin(void) {
+  // TracePin <gpio>[,<probe>] - mirror probe 0..3 on a GPIO, TracePin -1 to disable
+  if (XdrvMailbox.data_len > 0) {
+    if (XdrvMailbox.payload < 0) {
+      trace_pin = -1;
+    } else {
+      uint32_t parm[2] = { 0, trace_pin_probe };
+      ParseParameters(2, parm);
+      if ((parm[0] < 64) && (parm[1] < TRACE_MAX)) {
+        trace_pin = parm[0];
+        trace_pin_probe = parm[1];
+        pinMode(trace_pin, OUTPUT);
+        digitalWrite(trace_pin, 0);
+      }
+    }
+  }
+  ResponseCmndNumber(trace_pin);
+}
+
+#endif  // USE_PROFILE_TRACE
@@ -139,6 +139,66 @@ void PwmApplyGPIO(bool force_update_all) {
   PwmRearmChanges();      // reset expected changes
 }
 
+#ifdef USE_LIGHT_HW_FADE
+#include <driver/ledc.h>
+
+#if SOC_LEDC_SUPPORT_FADE_STOP
+bool pwm_hw_fade_installed = false;       // LEDC fade service installed
+#endif  // SOC_LEDC_SUPPORT_FADE_STOP
+
+// Stop any hardware fade running on the first `channels` PWM outputs and freeze the duty
+// at its current value. No-op if the fade service was never installed.
+void PwmFadeStopGPIO(uint32_t channels) {
+#if SOC_LEDC_SUPPORT_FADE_STOP
+  if (!pwm_hw_fade_installed) { return; }
+  if (channels > MAX_PWMS) { channels = MAX_PWMS; }
+  for (uint32_t i = 0; i < channels; i++) {
+    if (PinUsed(GPIO_PWM1, i)) {
+      int32_t chan = analogGetChannel2(Pin(GPIO_PWM1, i));
+      if (chan >= 0) {
+        ledc_fade_stop((ledc_mode_t)(chan / 8), (ledc_channel_t)(chan % 8));
+      }
+    }
+  }
+#endif  // SOC_LEDC_SUPPORT_FADE_STOP
+}
+
+// Program an autonomous LEDC fade on the first `channels` PWM outputs towards `values`
+// (logical duty, same units as `analogWritePhase()`) over `duration` milliseconds.
+// Any fade still running is stopped first, the new fade starts from the current duty.
+// `TasmotaGlobal.pwm_cur_value[]` is deliberately left untouched so the final
+// `PwmApplyGPIO()` at end of fade still writes the exact target duty and phase.
+// Returns `false` if hardware fading is unavailable, the caller must fall back to
+// software stepping.
+bool PwmFadeGPIO(const uint16_t *values, uint32_t channels, uint32_t duration) {
+#if SOC_LEDC_SUPPORT_FADE_STOP
+  if (channels > MAX_PWMS) { return false; }
+  if (!pwm_hw_fade_installed) {
+    esp_err_t err = ledc_fade_func_install(0);
+    if ((err != ESP_OK) && (err != ESP_ERR_INVALID_STATE)) { return false; }  // invalid state = already installed
+    pwm_hw_fade_installed = true;
+  }
+  PwmFadeStopGPIO(channels);
+  for (uint32_t i = 0; i < channels; i++) {
+    if (PinUsed(GPIO_PWM1, i)) {
+      int32_t chan = analogGetChannel2(Pin(GPIO_PWM1, i));
+      if (chan < 0) { return false; }
+      uint32_t range = (1 << ledcReadResolution(chan)) - 1;
+      uint32_t duty = values[i];
+      if (duty > range) { duty = range; }   // prevent overflow
+      if (ledc_set_fade_time_and_start((ledc_mode_t)(chan / 8), (ledc_channel_t)(chan % 8),
+                                       duty, duration, LEDC_FADE_NO_WAIT) != ESP_OK) {
+        return false;
+      }
+    }
+  }
+  return true;
+#else   // SOC_LEDC_SUPPORT_FADE_STOP
+  return false;   // original ESP32 cannot abort a running fade without blocking, use software stepping
+#endif  // SOC_LEDC_SUPPORT_FADE_STOP
+}
+#endif  // USE_LIGHT_HW_FADE
+
 void CmndPwm(void)
 {
   if (TasmotaGlobal.pwm_present && (XdrvMailbox.index > 0) && (XdrvMailbox.index <= MAX_PWMS)) {
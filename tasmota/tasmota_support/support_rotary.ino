@@ -51,6 +51,14 @@ const uint8_t rotary_offset = 128;
 const int8_t rotary_state_pos[16] = { 0, 1, -1, 2, -1, 0, -2, 1, 1, -2, 0, -1, 2, -1, 1, 0 };
 #endif  // ESP8266
 
+#ifdef ESP32
+#include "soc/soc_caps.h"
+#if SOC_PCNT_SUPPORTED
+#define ROTARY_USE_PCNT                        // Decode quadrature in the PCNT peripheral, GPIO interrupts remain as fallback
+#include "driver/pulse_cnt.h"
+#endif  // SOC_PCNT_SUPPORTED
+#endif  // ESP32
+
 struct ROTARY {
   uint8_t no_pullup_mask_a = 0;                // Rotary A pull-up bitmask flags
   uint8_t no_pullup_mask_b = 0;                // Rotary B pull-up bitmask flags
@@ -71,6 +79,10 @@ struct tEncoder {
   uint8_t timeout = 0;                         // Disallow direction change within 0.5 second
   int8_t abs_position[2] = { 0 };
   bool changed = false;
+#ifdef ROTARY_USE_PCNT
+  pcnt_unit_handle_t pcnt_unit = nullptr;      // Hardware quadrature decoder, nullptr when the ISR fallback is used
+  int32_t pcnt_remainder = 0;                  // Sub-detent counts carried between polls
+#endif  // ROTARY_USE_PCNT
 };
 tEncoder Encoder[MAX_ROTARIES];
 
@@ -139,6 +151,75 @@ static void IRAM_ATTR RotaryIsrArg(void *arg) {
   }
 }
 
+#ifdef ROTARY_USE_PCNT
+/*********************************************************************************************\
+ * PCNT quadrature backend
+ *
+ * The PCNT peripheral decodes the full 4x quadrature sequence in hardware, so fast spins
+ * are never lost to WiFi or flash interrupts. Detents are held in the hardware counter and
+ * folded into the existing position byte on every RotaryHandler() poll. The edge/level
+ * mapping keeps the direction of the GPIO interrupt decoder.
+\*********************************************************************************************/
+
+bool RotaryPcntInit(uint32_t index) {
+  pcnt_unit_config_t unit_config = {};
+  unit_config.low_limit = -32768;
+  unit_config.high_limit = 32767;
+  if (pcnt_new_unit(&unit_config, &Encoder[index].pcnt_unit) != ESP_OK) {
+    return false;                              // Out of PCNT units - fall back to the GPIO interrupt
+  }
+
+  pcnt_glitch_filter_config_t filter_config = {};
+  filter_config.max_glitch_ns = 1000;          // Contact bounce between adjacent states cancels out in 4x decode
+  pcnt_unit_set_glitch_filter(Encoder[index].pcnt_unit, &filter_config);
+
+  pcnt_chan_config_t chan_a_config = {};
+  chan_a_config.edge_gpio_num = Encoder[index].pina;
+  chan_a_config.level_gpio_num = Encoder[index].pinb;
+  pcnt_channel_handle_t chan_a;
+  pcnt_chan_config_t chan_b_config = {};
+  chan_b_config.edge_gpio_num = Encoder[index].pinb;
+  chan_b_config.level_gpio_num = Encoder[index].pina;
+  pcnt_channel_handle_t chan_b;
+  if ((pcnt_new_channel(Encoder[index].pcnt_unit, &chan_a_config, &chan_a) != ESP_OK) ||
+      (pcnt_new_channel(Encoder[index].pcnt_unit, &chan_b_config, &chan_b) != ESP_OK)) {
+    pcnt_del_unit(Encoder[index].pcnt_unit);
+    Encoder[index].pcnt_unit = nullptr;
+    return false;
+  }
+  // A falling while B high counts negative, matching RotaryIsrArg
+  pcnt_channel_set_edge_action(chan_a, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_DECREASE);
+  pcnt_channel_set_level_action(chan_a, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+  pcnt_channel_set_edge_action(chan_b, PCNT_CHANNEL_EDGE_ACTION_DECREASE, PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+  pcnt_channel_set_level_action(chan_b, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
+  // Re-apply the pull-ups the channel setup may have cleared
+  gpio_pullup_en((gpio_num_t)Encoder[index].pina);
+  if (bitRead(Rotary.no_pullup_mask_a, index)) { gpio_pullup_dis((gpio_num_t)Encoder[index].pina); }
+  gpio_pullup_en((gpio_num_t)Encoder[index].pinb);
+  if (bitRead(Rotary.no_pullup_mask_b, index)) { gpio_pullup_dis((gpio_num_t)Encoder[index].pinb); }
+
+  pcnt_unit_enable(Encoder[index].pcnt_unit);
+  pcnt_unit_clear_count(Encoder[index].pcnt_unit);
+  pcnt_unit_start(Encoder[index].pcnt_unit);
+  Encoder[index].pcnt_remainder = 0;
+  AddLog(LOG_LEVEL_DEBUG, PSTR("ROT: Rotary%d uses PCNT"), index +1);
+  return true;
+}
+
+int32_t RotaryPcntRead(uint32_t index) {
+  int count;
+  pcnt_unit_get_count(Encoder[index].pcnt_unit, &count);
+  pcnt_unit_clear_count(Encoder[index].pcnt_unit);
+  Encoder[index].pcnt_remainder += count;
+  int32_t detents = Encoder[index].pcnt_remainder;
+  if (Rotary.model) {
+    detents /= 4;                              // Four quadrature counts per detent, remainder carries over
+  }
+  Encoder[index].pcnt_remainder -= (Rotary.model) ? detents * 4 : detents;
+  return detents;
+}
+#endif  // ROTARY_USE_PCNT
+
 void RotaryInitMaxSteps(void) {
   if (0 == Settings->param[P_ROTARY_MAX_STEP]) {
     Settings->param[P_ROTARY_MAX_STEP] = ROTARY_MAX_STEPS;  // SetOption43
@@ -172,6 +253,12 @@ void RotaryInit(void) {
       Encoder[index].pinb = Pin(GPIO_ROT1B, index);
       pinMode(Encoder[index].pina, bitRead(Rotary.no_pullup_mask_a, index) ? INPUT : INPUT_PULLUP);
       pinMode(Encoder[index].pinb, bitRead(Rotary.no_pullup_mask_b, index) ? INPUT : INPUT_PULLUP);
+#ifdef ROTARY_USE_PCNT
+      if (RotaryPcntInit(index)) {
+        Rotary.present = true;
+        continue;                              // Quadrature decoded in hardware, no interrupts needed
+      }
+#endif  // ROTARY_USE_PCNT
       if (0 == Rotary.model) {
         attachInterruptArg(Encoder[index].pina, RotaryIsrArgMiDesk, &Encoder[index], CHANGE);
         attachInterruptArg(Encoder[index].pinb, RotaryIsrArgMiDesk, &Encoder[index], CHANGE);
@@ -205,6 +292,11 @@ void RotaryHandler(void) {
         Encoder[index].direction = 0;
       }
     }
+#ifdef ROTARY_USE_PCNT
+    if (Encoder[index].pcnt_unit) {
+      Encoder[index].position += RotaryPcntRead(index);  // Fold hardware detents into the position byte
+    }
+#endif  // ROTARY_USE_PCNT
     if (rotary_offset == Encoder[index].position) { continue; }
 
     Encoder[index].timeout = ROTARY_TIMEOUT;   // Prevent fast direction changes within 0.5 second
@@ -53,6 +53,76 @@ struct RTC {
   bool user_time_entry = false;               // Override NTP by user setting
 } Rtc;
 
+/*********************************************************************************************\
+ * NTP drift discipline
+ *
+ * Measure the local oscillator error against successive NTP syncs, slew the software clock
+ * between syncs with the smoothed rate and stretch the sync interval while drift is stable
+\*********************************************************************************************/
+
+#ifndef RTC_NTP_SYNC_INTERVAL
+#define RTC_NTP_SYNC_INTERVAL  60             // [minutes] Initial NTP re-sync interval
+#endif
+#ifndef RTC_NTP_MAX_INTERVAL
+#define RTC_NTP_MAX_INTERVAL   480            // [minutes] Maximum NTP re-sync interval when drift is stable
+#endif
+#define RTC_DRIFT_LIMIT        500000         // [ns/s] Discard drift samples beyond 500 ppm
+#define RTC_DRIFT_STABLE       5000           // [ns/s] Samples within 5 ppm of the rate count as stable
+
+struct RTCDRIFT {
+  uint32_t last_sync_time = 0;                // NTP seconds at last accepted sync
+  uint32_t last_sync_nanos = 0;               // NTP nanoseconds at last accepted sync
+  uint32_t last_sync_millis = 0;              // Local millis() at last accepted sync
+  int32_t rate = 0;                           // Smoothed correction rate in nanoseconds per second
+  uint16_t sync_interval = RTC_NTP_SYNC_INTERVAL;  // Minutes between NTP syncs
+  uint8_t stable_count = 0;                   // Consecutive samples agreeing with the rate
+  bool valid = false;                         // Rate is based on at least one measurement
+} RtcDrift;
+
+bool RtcNtpDue(void) {
+  if (!RtcDrift.last_sync_time) { return true; }
+  // Two minutes slack so an hourly check slot just short of the interval does not slip a full hour
+  return (Rtc.utc_time - RtcDrift.last_sync_time) >= ((uint32_t)RtcDrift.sync_interval * SECS_PER_MIN) - 120;
+}
+
+void RtcNtpMeasureDrift(uint32_t ntp_time, uint32_t ntp_nanos) {
+  // Called with a fresh NTP result before it is applied to Rtc.utc_time
+  uint32_t now_millis = millis();
+  if (RtcDrift.last_sync_time && (ntp_time > RtcDrift.last_sync_time)) {
+    uint32_t local_elapsed_ms = now_millis - RtcDrift.last_sync_millis;
+    if (local_elapsed_ms >= 600000) {         // Need at least ten minutes between samples for a meaningful rate
+      int64_t ntp_elapsed_ns = ((int64_t)(ntp_time - RtcDrift.last_sync_time) * 1000000000LL) + (int32_t)(ntp_nanos - RtcDrift.last_sync_nanos);
+      int64_t measured = (ntp_elapsed_ns - ((int64_t)local_elapsed_ms * 1000000LL)) * 1000LL / local_elapsed_ms;  // ns per local second
+      if ((measured > -RTC_DRIFT_LIMIT) && (measured < RTC_DRIFT_LIMIT)) {
+        int32_t delta = (int32_t)measured - RtcDrift.rate;
+        if (!RtcDrift.valid) {
+          RtcDrift.rate = (int32_t)measured;
+          RtcDrift.valid = true;
+        } else {
+          RtcDrift.rate += delta / 4;         // Smooth the correction rate
+        }
+        if ((delta > -RTC_DRIFT_STABLE) && (delta < RTC_DRIFT_STABLE)) {
+          if (RtcDrift.stable_count < 10) { RtcDrift.stable_count++; }
+          if ((RtcDrift.stable_count >= 2) && (RtcDrift.sync_interval < RTC_NTP_MAX_INTERVAL)) {
+            RtcDrift.sync_interval *= 2;      // Stretch the sync interval while drift is predictable
+          }
+        } else {
+          RtcDrift.stable_count = 0;
+          RtcDrift.sync_interval = RTC_NTP_SYNC_INTERVAL;
+        }
+        AddLog(LOG_LEVEL_DEBUG, PSTR("RTC: Drift %d ppb, sample %d ppb, next sync in %d minutes"),
+          RtcDrift.rate, (int32_t)measured, RtcDrift.sync_interval);
+      } else {
+        RtcDrift.stable_count = 0;            // Oscillator jumped or bad sample - start over
+        RtcDrift.sync_interval = RTC_NTP_SYNC_INTERVAL;
+      }
+    }
+  }
+  RtcDrift.last_sync_time = ntp_time;
+  RtcDrift.last_sync_nanos = ntp_nanos;
+  RtcDrift.last_sync_millis = now_millis;
+}
+
 uint32_t UtcTime(void) {
   return Rtc.utc_time;
 }
@@ -454,8 +524,22 @@ void RtcSecond(void) {
       uint32_t nanos = Rtc.nanos + (millis() - Rtc.millis) * 1000000U;
       Rtc.utc_time += nanos / 1000000000U;
       Rtc.nanos = nanos % 1000000000U;
-    } else
+    } else {
       Rtc.utc_time++;  // Increment every second
+      if (RtcDrift.valid && RtcDrift.rate) {
+        // Slew out the measured oscillator drift between NTP syncs
+        int32_t nanos = (int32_t)Rtc.nanos + RtcDrift.rate;
+        if (nanos < 0) {
+          nanos += 1000000000;
+          Rtc.utc_time--;
+        }
+        else if (nanos >= 1000000000) {
+          nanos -= 1000000000;
+          Rtc.utc_time++;
+        }
+        Rtc.nanos = nanos;
+      }
+    }
   }
   Rtc.millis = millis();
 
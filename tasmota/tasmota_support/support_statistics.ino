@@ -38,4 +38,177 @@ String GetStatistics(void)
   return String("");
 }
 
-#endif  // USE_STATS_CODE
\ No newline at end of file
+#endif  // USE_STATS_CODE
+
+#if defined(USE_TELEMETRY_RING) && defined(ESP32)
+/*********************************************************************************************\
+ * Telemetry ring - always-on 1 Hz sampling of loop load, free heap and WiFi RSSI with
+ * exponential retention in RTC memory: tier 0 holds the last 64 seconds, every tier wrap
+ * is summarized worst-case one level up, so about an hour and about three days stay
+ * available across restarts. With PSRAM the last full hour is additionally kept at 1 Hz.
+ *
+ * Telemetry       - report the current sample and active anomaly flags
+ * Telemetry 0..2  - dump retention tier 0 (1 s), 1 (64 s) or 2 (~68 min), oldest first
+ * Telemetry 3     - dump the PSRAM hour at minute resolution (when PSRAM is available)
+ *
+ * Anomaly flags (low heap, high loop load, weak RSSI, MQTT reconnect) are evaluated every
+ * second against the TELEMETRY_* thresholds and published as a rule event on change only.
+\*********************************************************************************************/
+
+#ifndef TELEMETRY_HEAP_MIN
+#define TELEMETRY_HEAP_MIN         16    // kB free heap below which the heap anomaly is raised
+#endif
+#ifndef TELEMETRY_LOAD_MAX
+#define TELEMETRY_LOAD_MAX         80    // Loop load percentage above which the load anomaly is raised
+#endif
+#ifndef TELEMETRY_RSSI_MIN
+#define TELEMETRY_RSSI_MIN        -85    // RSSI in dBm below which the wifi anomaly is raised
+#endif
+
+typedef struct {
+  uint16_t free_heap;    // Free heap in kB
+  uint8_t  loop_load;    // Loop load average in percent
+  int8_t   rssi;         // WiFi RSSI in dBm, 0 = no link
+} TTelemetryEntry;       // 4 bytes = 1 RTC word
+
+const uint32_t telemetry_magic = 0x544C4D30;    // Telemetry ring magic number (TLM0)
+const uint32_t telemetry_entries = 64;          // Ring slots per tier
+const uint32_t telemetry_tiers = 3;             // Retention 64 s / ~68 min / ~3 days
+
+static RTC_NOINIT_ATTR struct {
+  uint32_t magic;
+  uint8_t next[telemetry_tiers];                // Next slot per tier
+  uint8_t anomaly;                              // Active anomaly flags (bit 0 heap, 1 load, 2 rssi, 3 mqtt)
+  TTelemetryEntry entry[telemetry_tiers][telemetry_entries];
+} TelemetryRing;
+
+TTelemetryEntry *telemetry_psram = nullptr;     // Optional 1 Hz hour, only allocated when PSRAM is present
+uint16_t telemetry_psram_next = 0;
+const uint32_t telemetry_psram_entries = 3600;
+
+uint8_t telemetry_debounce[4] = { 0 };          // Seconds an anomaly condition differs from its flag
+uint16_t telemetry_mqtt_connects = 0;           // MqttConnectCount() at the previous sample
+
+void TelemetryRingStore(uint32_t tier, TTelemetryEntry *entry) {
+  TelemetryRing.entry[tier][TelemetryRing.next[tier]] = *entry;
+  TelemetryRing.next[tier] = (TelemetryRing.next[tier] +1) % telemetry_entries;
+  if ((0 == TelemetryRing.next[tier]) && (tier +1 < telemetry_tiers)) {
+    // Tier wrapped - keep its worst case one level up (min heap, max load, weakest rssi)
+    TTelemetryEntry worst = TelemetryRing.entry[tier][0];
+    for (uint32_t i = 1; i < telemetry_entries; i++) {
+      TTelemetryEntry *e = &TelemetryRing.entry[tier][i];
+      if (e->free_heap < worst.free_heap) { worst.free_heap = e->free_heap; }
+      if (e->loop_load > worst.loop_load) { worst.loop_load = e->loop_load; }
+      if ((0 == e->rssi) || ((0 != worst.rssi) && (e->rssi < worst.rssi))) { worst.rssi = e->rssi; }
+    }
+    TelemetryRingStore(tier +1, &worst);
+  }
+}
+
+void TelemetryAnomalyCheck(TTelemetryEntry *entry) {
+  uint8_t anomaly = TelemetryRing.anomaly;
+
+  bool cond[3];
+  cond[0] = (entry->free_heap < TELEMETRY_HEAP_MIN);
+  cond[1] = (entry->loop_load > TELEMETRY_LOAD_MAX);
+  cond[2] = (0 != entry->rssi) && (entry->rssi < TELEMETRY_RSSI_MIN);
+  for (uint32_t i = 0; i < 3; i++) {            // Level conditions must hold 5 s before the flag flips
+    if (cond[i] != (bool)((anomaly >> i) &1)) {
+      telemetry_debounce[i]++;
+      if (telemetry_debounce[i] >= 5) {
+        anomaly ^= (1 << i);
+        telemetry_debounce[i] = 0;
+      }
+    } else {
+      telemetry_debounce[i] = 0;
+    }
+  }
+
+  uint16_t connects = MqttConnectCount();       // A reconnect is an event - hold its flag for a minute
+  if ((connects != telemetry_mqtt_connects) && (TasmotaGlobal.uptime > 60)) {
+    telemetry_debounce[3] = 60;
+  }
+  telemetry_mqtt_connects = connects;
+  if (telemetry_debounce[3]) {
+    telemetry_debounce[3]--;
+    anomaly |= 0x08;
+  } else {
+    anomaly &= ~0x08;
+  }
+
+  if (anomaly != TelemetryRing.anomaly) {
+    TelemetryRing.anomaly = anomaly;
+    Response_P(PSTR("{\"Telemetry\":{\"Anomaly\":{\"Heap\":%d,\"Load\":%d,\"Rssi\":%d,\"Mqtt\":%d}}}"),
+      anomaly &1, (anomaly >> 1) &1, (anomaly >> 2) &1, (anomaly >> 3) &1);
+    MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR("Telemetry"));
+  }
+}
+
+void TelemetryRingEverySecond(void) {
+  bool garbage = (TelemetryRing.magic != telemetry_magic);
+  for (uint32_t tier = 0; tier < telemetry_tiers; tier++) {
+    if (TelemetryRing.next[tier] >= telemetry_entries) { garbage = true; }
+  }
+  if (garbage) {                                // Random data after power up - start over
+    memset(&TelemetryRing, 0, sizeof(TelemetryRing));
+    TelemetryRing.magic = telemetry_magic;
+  }
+
+  if (!telemetry_psram && UsePSRAM() && (1 == TasmotaGlobal.uptime)) {
+    telemetry_psram = (TTelemetryEntry*)special_malloc(telemetry_psram_entries * sizeof(TTelemetryEntry));
+    if (telemetry_psram) {
+      memset(telemetry_psram, 0, telemetry_psram_entries * sizeof(TTelemetryEntry));
+    }
+  }
+
+  TTelemetryEntry entry;
+  uint32_t free_heap = ESP_getFreeHeap() / 1024;
+  entry.free_heap = (free_heap > 65535) ? 65535 : free_heap;
+  entry.loop_load = (TasmotaGlobal.loop_load_avg > 100) ? 100 : TasmotaGlobal.loop_load_avg;
+  entry.rssi = TasmotaGlobal.global_state.wifi_down ? 0 : WiFi.RSSI();
+
+  TelemetryRingStore(0, &entry);
+  if (telemetry_psram) {
+    telemetry_psram[telemetry_psram_next] = entry;
+    telemetry_psram_next = (telemetry_psram_next +1) % telemetry_psram_entries;
+  }
+  TelemetryAnomalyCheck(&entry);
+}
+
+void TelemetryDumpEntry(TTelemetryEntry *entry, bool first) {
+  if (entry->free_heap || entry->loop_load || entry->rssi) {   // Skip slots not written yet
+    ResponseAppend_P(PSTR("%s[%d,%d,%d]"), (first) ? "" : ",", entry->free_heap, entry->loop_load, entry->rssi);
+  }
+}
+
+void CmndTelemetry(void) {
+  if ((XdrvMailbox.payload >= 0) && (XdrvMailbox.payload < (int32_t)telemetry_tiers)) {
+    uint32_t tier = XdrvMailbox.payload;
+    Response_P(PSTR("{\"%s\":{\"Tier\":%d,\"Entries\":["), XdrvMailbox.command, tier);
+    bool first = true;
+    for (uint32_t i = 0; i < telemetry_entries; i++) {          // Oldest entry first
+      TTelemetryEntry *entry = &TelemetryRing.entry[tier][(TelemetryRing.next[tier] + i) % telemetry_entries];
+      TelemetryDumpEntry(entry, first);
+      if (entry->free_heap || entry->loop_load || entry->rssi) { first = false; }
+    }
+    ResponseAppend_P(PSTR("]}}"));
+  }
+  else if (((uint32_t)XdrvMailbox.payload == telemetry_tiers) && telemetry_psram) {
+    Response_P(PSTR("{\"%s\":{\"Tier\":%d,\"Entries\":["), XdrvMailbox.command, telemetry_tiers);
+    bool first = true;
+    for (uint32_t i = 0; i < telemetry_psram_entries; i += 60) {  // Minute resolution, oldest first
+      TTelemetryEntry *entry = &telemetry_psram[(telemetry_psram_next + i) % telemetry_psram_entries];
+      TelemetryDumpEntry(entry, first);
+      if (entry->free_heap || entry->loop_load || entry->rssi) { first = false; }
+    }
+    ResponseAppend_P(PSTR("]}}"));
+  }
+  else {
+    uint32_t last = (TelemetryRing.next[0] + telemetry_entries -1) % telemetry_entries;
+    TTelemetryEntry *entry = &TelemetryRing.entry[0][last];
+    Response_P(PSTR("{\"%s\":{\"FreeHeap\":%d,\"LoopLoad\":%d,\"Rssi\":%d,\"Anomaly\":%d,\"Psram\":%d}}"),
+      XdrvMailbox.command, entry->free_heap, entry->loop_load, entry->rssi, TelemetryRing.anomaly, (telemetry_psram) ? 1 : 0);
+  }
+}
+
+#endif  // USE_TELEMETRY_RING && ESP32
\ No newline at end of file
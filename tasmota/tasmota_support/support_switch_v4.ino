@@ -43,16 +43,22 @@ const char kSwitchPressStates[] PROGMEM =
 
 Ticker TickerSwitch;
 
+void IRAM_ATTR SwitchEdgeIsr(void *arg);
+
 struct SWITCH {
   uint32_t debounce = 0;                         // Switch debounce timer
   uint32_t no_pullup_mask = 0;                   // Switch pull-up bitmask flags
   uint32_t pulldown_mask = 0;                    // Switch pull-down bitmask flags
   uint32_t used = 0;                             // Switch used bitmask
   uint32_t virtual_pin = 0;                      // Switch state bitmask
+  uint32_t isr_attached = 0;                     // Switch edge interrupt attached bitmask
+  volatile uint32_t edge_pending = 0;            // Switch edge seen by interrupt, not yet consumed by SwitchProbe
   uint8_t state[MAX_SWITCHES_SET] = { 0 };
   uint8_t last_state[MAX_SWITCHES_SET];          // Last wall switch states
   uint8_t hold_timer[MAX_SWITCHES_SET] = { 0 };  // Timer for wallswitch push button hold
   uint8_t debounced_state[MAX_SWITCHES_SET];     // Switch debounced states
+  uint8_t isr_index[MAX_SWITCHES_SET];           // Switch index passed to the edge interrupt
+  uint8_t full_scan_countdown = 0;               // Probes left until the next failsafe full scan
   uint8_t first_change = 0;
   bool probe_mutex;
 } Switch;
@@ -117,6 +123,11 @@ bool SwitchState(uint32_t index) {
 
 /*********************************************************************************************/
 
+void IRAM_ATTR SwitchEdgeIsr(void *arg) {
+  // Record the edge so SwitchProbe() polls this pin; quiet pins are skipped entirely
+  bitSet(Switch.edge_pending, *static_cast<uint8_t*>(arg));
+}
+
 void SwitchProbe(void) {
   if (Switch.probe_mutex || (TasmotaGlobal.uptime < 4)) { return; }  // Block GPIO for 4 seconds after poweron to workaround Wemos D1 / Obi RTS circuit
   Switch.probe_mutex = true;
@@ -140,9 +151,25 @@ void SwitchProbe(void) {
     state_filter = Settings->switch_debounce / SWITCH_PROBE_INTERVAL;	// 5, 10, 15
   }
 
+  bool full_scan = true;
+  uint32_t edges = Switch.edge_pending;
+  if (Switch.isr_attached) {
+    Switch.edge_pending &= ~edges;                           // Keep edges arriving during this probe for the next one
+    if (Switch.full_scan_countdown) {
+      Switch.full_scan_countdown--;
+      full_scan = false;
+    } else {
+      Switch.full_scan_countdown = 1000 / SWITCH_PROBE_INTERVAL;  // Failsafe poll in case an edge was missed
+    }
+  }
+
   uint32_t not_activated;
   for (uint32_t i = 0; i < MAX_SWITCHES_SET; i++) {
     if (!bitRead(Switch.used, i)) { continue; }
+    if (!full_scan && bitRead(Switch.isr_attached, i) && !bitRead(edges, i) &&
+        ((Switch.debounced_state[i] ? state_filter : 0) == Switch.state[i])) {
+      continue;                                              // No edge since last probe and debounce settled
+    }
 
     if (PinUsed(GPIO_SWT1, i)) {
       not_activated = digitalRead(Pin(GPIO_SWT1, i));
@@ -231,6 +258,7 @@ void SwitchProbe(void) {
 void SwitchInit(void) {
   bool ac_detect = (Settings->switch_debounce % 10 == 9);
   Switch.used = 0;
+  Switch.isr_attached = 0;
   for (uint32_t i = 0; i < MAX_SWITCHES_SET; i++) {
     Switch.last_state[i] = NOT_PRESSED;
     if (PinUsed(GPIO_SWT1, i)) {
@@ -246,6 +274,15 @@ void SwitchInit(void) {
         Switch.state[i] = 0x80 + 2 * SWITCH_AC_PERIOD;
         Switch.last_state[i] = 0;				 // Will set later in the debouncing code
       }
+      if (!ac_detect                             // AC detection needs continuous sampling
+#ifdef ESP8266
+          && (16 != Pin(GPIO_SWT1, i))           // GPIO16 does not support interrupts
+#endif  // ESP8266
+         ) {
+        Switch.isr_index[i] = i;
+        attachInterruptArg(Pin(GPIO_SWT1, i), SwitchEdgeIsr, &Switch.isr_index[i], CHANGE);
+        bitSet(Switch.isr_attached, i);          // Probe this pin on edges only
+      }
     }
     else {
       XdrvMailbox.index = i;
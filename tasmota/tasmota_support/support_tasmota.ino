@@ -869,6 +869,9 @@ void MqttShowState(void)
   ResponseAppend_P(PSTR(",\"" D_JSON_HEAPSIZE "\":%d,\"SleepMode\":\"%s\",\"Sleep\":%u,\"LoadAvg\":%u,\"MqttCount\":%u"),
     ESP_getFreeHeap1024(), GetTextIndexed(stemp1, sizeof(stemp1), Settings->flag3.sleep_normal, kSleepMode),  // SetOption60 - Enable normal sleep instead of dynamic sleep
     TasmotaGlobal.sleep, TasmotaGlobal.loop_load_avg, MqttConnectCount());
+#ifdef USE_SLEEP_GOVERNOR
+  ResponseAppend_P(PSTR(",\"SleepGov\":%u"), SleepGovernor.effective);  // Effective sleep of the loop governor
+#endif  // USE_SLEEP_GOVERNOR
 
 #ifdef USE_BERRY
     extern void BrShowState(void);
@@ -901,10 +904,10 @@ void MqttShowState(void)
 
   if (!TasmotaGlobal.global_state.wifi_down) {
     int32_t rssi = WiFi.RSSI();
-    ResponseAppend_P(PSTR(",\"" D_JSON_WIFI "\":{\"" D_JSON_AP "\":%d,\"" D_JSON_SSID "\":\"%s\",\"" D_JSON_BSSID "\":\"%s\",\"" D_JSON_CHANNEL "\":%d,\"" D_JSON_WIFI_MODE "\":\"%s\",\"" D_JSON_RSSI "\":%d,\"" D_JSON_SIGNAL "\":%d,\"" D_JSON_LINK_COUNT "\":%d,\"" D_JSON_DOWNTIME "\":\"%s\"}"),
+    ResponseAppend_P(PSTR(",\"" D_JSON_WIFI "\":{\"" D_JSON_AP "\":%d,\"" D_JSON_SSID "\":\"%s\",\"" D_JSON_BSSID "\":\"%s\",\"" D_JSON_CHANNEL "\":%d,\"" D_JSON_WIFI_MODE "\":\"%s\",\"" D_JSON_RSSI "\":%d,\"" D_JSON_SIGNAL "\":%d,\"" D_JSON_LINK_COUNT "\":%d,\"" D_JSON_FAST_RECONNECT "\":%d,\"" D_JSON_ROAM_COUNT "\":%d,\"" D_JSON_ROAM_LATENCY "\":%d,\"" D_JSON_DOWNTIME "\":\"%s\"}"),
       Settings->sta_active +1, EscapeJSONString(SettingsText(SET_STASSID1 + Settings->sta_active)).c_str(), WiFi.BSSIDstr().c_str(), WiFi.channel(),
       WifiGetPhyMode().c_str(), WifiGetRssiAsQuality(rssi), rssi,
-      WifiLinkCount(), WifiDowntime().c_str());
+      WifiLinkCount(), WifiFastReconnectCount(), WifiRoamCount(), WifiRoamLatency(), WifiDowntime().c_str());
   }
 
   ResponseJsonEnd();
@@ -1086,7 +1089,23 @@ void MqttPublishSensor(void) {
 
 void MqttPublishTeleperiodSensor(void) {
   ResponseClear();
-  if (MqttShowSensor(true)) {
+#ifdef USE_SENSOR_DELTA
+  Xsns_delta_sweep = true;                 // Apply per-channel deadband filters during this sweep
+#endif  // USE_SENSOR_DELTA
+#ifdef USE_TELEMETRY_COALESCE
+  // Publish only sensors whose readings changed since the last teleperiod, with a full
+  // payload every TELE_COALESCE_FULL cycles as keep-alive and late-subscriber refresh
+  static uint32_t coalesce_count = 0;
+  Xsns_coalesce_sweep = (++coalesce_count % TELE_COALESCE_FULL) != 0;
+  bool json_data_available = MqttShowSensor(true);
+  Xsns_coalesce_sweep = false;
+#else
+  bool json_data_available = MqttShowSensor(true);
+#endif  // USE_TELEMETRY_COALESCE
+#ifdef USE_SENSOR_DELTA
+  Xsns_delta_sweep = false;
+#endif  // USE_SENSOR_DELTA
+  if (json_data_available) {
     MqttPublishPrefixTopic_P(TELE, PSTR(D_RSLT_SENSOR), Settings->flag.mqtt_sensor_retain);  // CMND_SENSORRETAIN
     XdrvRulesProcess(1);
   }
@@ -1099,10 +1118,20 @@ void MqttPublishTeleperiodSensor(void) {
  * Every second
 \*-------------------------------------------------------------------------------------------*/
 
+uint16_t * rtc_tele_phase = nullptr;       // RTC registry slot preserving the TelePeriod phase over warm boots
+
 void PerformEverySecond(void)
 {
   TasmotaGlobal.uptime++;
 
+#if defined(USE_TELEMETRY_RING) && defined(ESP32)
+  TelemetryRingEverySecond();
+#endif  // USE_TELEMETRY_RING
+
+#ifdef ESP32
+  EspOtaCommitEverySecond();            // Commit or roll back a pending dual app partition image
+#endif  // ESP32
+
   if (POWER_CYCLE_TIME == TasmotaGlobal.uptime) {
     UpdateQuickPowerCycle(false);
   }
@@ -1190,14 +1219,22 @@ void PerformEverySecond(void)
 
   // Teleperiod
   if (Settings->tele_period || (3601 == TasmotaGlobal.tele_period)) {
+    if (nullptr == rtc_tele_phase) {
+      rtc_tele_phase = (uint16_t*) RtcRegistryReserve(RTC_REG_TELEPERIOD, sizeof(uint16_t));
+    }
     if (TasmotaGlobal.tele_period >= 9999) {
       if (!TasmotaGlobal.global_state.network_down) {
         TasmotaGlobal.tele_period = 0;  // Allow teleperiod once wifi is connected
+        if (rtc_tele_phase && (*rtc_tele_phase < Settings->tele_period)) {
+          TasmotaGlobal.tele_period = *rtc_tele_phase;  // Resume the phase preserved over a warm boot
+        }
       }
     } else {
       TasmotaGlobal.tele_period++;
+      if (rtc_tele_phase) { *rtc_tele_phase = TasmotaGlobal.tele_period; }
       if (TasmotaGlobal.tele_period >= Settings->tele_period) {
         TasmotaGlobal.tele_period = 0;
+        if (rtc_tele_phase) { *rtc_tele_phase = 0; }
 
         MqttPublishTeleState();
         MqttPublishTeleperiodSensor();
@@ -1237,6 +1274,8 @@ void PerformEverySecond(void)
     settings_lkg = true;
   }
 #endif
+
+  RtcSettingsSave();  // Flush RtcSettings and the RTC registry so a watchdog restart loses at most one second of counters
 }
 
 /*-------------------------------------------------------------------------------------------*\
@@ -1612,6 +1651,9 @@ void Every250mSeconds(void)
     }
     break;
   case 2:                                                 // Every x.5 second
+#ifdef ESP8266
+    SettingsEraseAhead();                                 // Pre-erase the next settings slot off the save path
+#endif  // ESP8266
     if (Settings->flag4.network_wifi) {
       WifiCheck(TasmotaGlobal.wifi_state_flag);
       TasmotaGlobal.wifi_state_flag = WIFI_RESTART;
@@ -1985,6 +2027,7 @@ void GpioInit(void)
       Settings->user_template.gp.io[i] = AGPIO(GPIO_USER);  // Fix not supported sensor ids in template
     }
   }
+  TemplateGpiosInvalidate();
 
   myio template_gp;
   TemplateGpios(&template_gp);
@@ -42,6 +42,11 @@ bool udp_connected = false;
 UdpListener<UDP_BUFFER_SIZE> UdpCtx(UDP_MAX_PACKETS);
 #endif
 
+#ifndef UDP_POLL_BUDGET
+#define UDP_POLL_BUDGET   8             // Max packets handled per service pass, so an SSDP burst
+                                        // is absorbed in one tick without starving the main loop
+#endif
+
 /*********************************************************************************************\
  * UPNP/SSDP search targets
 \*********************************************************************************************/
@@ -112,8 +117,14 @@ void PollUdp(void)
     if (TimeReached(udp_last_received + UDP_MSEARCH_DEBOUNCE)) {
       udp_last_received = 0;      // re-init timer
     }
+    uint32_t udp_budget = UDP_POLL_BUDGET;
 #ifdef ESP8266
-    while (UdpCtx.next()) {
+    static uint32_t udp_drops_reported = 0;
+    if (UdpCtx.drops() != udp_drops_reported) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("UDP: %d packet(s) dropped, queue depth max %d"), UdpCtx.drops() - udp_drops_reported, UdpCtx.depthMax());
+      udp_drops_reported = UdpCtx.drops();
+    }
+    while (udp_budget-- && UdpCtx.next()) {
       UdpPacket<UDP_BUFFER_SIZE> *packet;
       packet = UdpCtx.read();
       if (packet->len >= UDP_BUFFER_SIZE) {
@@ -125,7 +136,8 @@ void PollUdp(void)
       AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("UDP: Packet (%d)"), len);
 #endif  // ESP8266
 #ifdef ESP32
-    while (uint32_t pack_len = PortUdp.parsePacket()) {
+    uint32_t pack_len;
+    while (udp_budget-- && (pack_len = PortUdp.parsePacket())) {
       char packet_buffer[UDP_BUFFER_SIZE];     // buffer to hold incoming UDP/SSDP packet
 
       int32_t len = PortUdp.read(packet_buffer, UDP_BUFFER_SIZE -1);
@@ -35,6 +35,12 @@
 #ifndef WIFI_RETRY_SECONDS
 #define WIFI_RETRY_SECONDS      20         // Number of seconds connection to wifi network will retry
 #endif
+#ifndef WIFI_ROAM_RSSI_FLOOR
+#define WIFI_ROAM_RSSI_FLOOR    -70        // dBm; below this a roam scan is scheduled much sooner than the regular rescan
+#endif
+#ifndef WIFI_ROAM_SCAN_MINUTES
+#define WIFI_ROAM_SCAN_MINUTES  2          // Number of minutes between background roam scans while below the RSSI floor
+#endif
 
 const uint8_t WIFI_CONFIG_SEC = 180;       // seconds before restart
 const uint8_t WIFI_CHECK_SEC = 20;         // seconds
@@ -44,6 +50,10 @@ const uint8_t WIFI_RETRY_OFFSET_SEC = WIFI_RETRY_SECONDS;  // seconds
 #include "lwip/dns.h"
 #ifdef ESP32
   #include "esp_netif.h"
+#ifdef CONFIG_WPA_11KV_SUPPORT
+  #include "esp_rrm.h"                     // 802.11k neighbor reports
+  #include "esp_wnm.h"                     // 802.11v BSS transition management
+#endif  // CONFIG_WPA_11KV_SUPPORT
 #endif  // ESP32
 
 int WifiGetRssiAsQuality(int rssi) {
@@ -67,7 +77,8 @@ const char kWifiEncryptionTypes[] PROGMEM = "OPEN|WEP|WPA/PSK|WPA2/PSK|WPA/WPA2/
 #endif  // ESP32
 ;
 
-String WifiEncryptionType(uint32_t i) {
+uint32_t WifiScanEncryption(uint32_t i) {
+  // Map the encryption type of scan result i to an index into kWifiEncryptionTypes
 #ifdef ESP8266
   // Reference. WiFi.encryptionType =
   // 2 : ENC_TYPE_TKIP - WPA / PSK
@@ -81,11 +92,20 @@ String WifiEncryptionType(uint32_t i) {
   int type = WiFi.encryptionType(i);
 #endif
   if ((type < 0) || (type > 8)) { type = 0; }
+  return type;
+}
+
+String WifiEncryptionTypeStr(uint32_t type) {
+  if (type > 8) { type = 0; }
   char stemp1[20];
   GetTextIndexed(stemp1, sizeof(stemp1), type, kWifiEncryptionTypes);
   return stemp1;
 }
 
+String WifiEncryptionType(uint32_t i) {
+  return WifiEncryptionTypeStr(WifiScanEncryption(i));
+}
+
 bool WifiConfigCounter(void)
 {
   if (Wifi.config_counter) {
@@ -202,6 +222,74 @@ void WiFiSetSleepMode(void)
   delay(100);
 }
 
+/*********************************************************************************************\
+ * Fast reconnect using a last-good BSSID and channel cached per SSID slot
+ *
+ * The last successful association is cached per configured SSID in Settings (flash, survives
+ * power loss) and on ESP32 additionally in RTC memory (always current, no flash wear). A
+ * directed association to the cached AP is tried before falling back to a full scan.
+\*********************************************************************************************/
+
+void WifiSaveApInfo(uint32_t ap, uint8_t channel, const uint8_t *bssid) {
+  if (ap >= MAX_SSIDS) { return; }
+  if (0 == ap) {
+    Settings->wifi_channel = channel;
+    memcpy(Settings->wifi_bssid, bssid, sizeof(Settings->wifi_bssid));
+  } else {
+    Settings->wifi_channel2 = channel;
+    memcpy(Settings->wifi_bssid2, bssid, sizeof(Settings->wifi_bssid2));
+  }
+#ifdef ESP32
+  RtcFastWifi.channel[ap] = channel;
+  memcpy(RtcFastWifi.bssid[ap], bssid, sizeof(RtcFastWifi.bssid[ap]));
+  RtcFastWifi.valid = RTC_MEM_VALID;
+#endif  // ESP32
+}
+
+void WifiClearApInfo(uint32_t ap) {
+  if (ap >= MAX_SSIDS) { return; }
+  if (0 == ap) {
+    Settings->wifi_channel = 0;
+  } else {
+    Settings->wifi_channel2 = 0;
+  }
+#ifdef ESP32
+  if (RTC_MEM_VALID == RtcFastWifi.valid) {
+    RtcFastWifi.channel[ap] = 0;
+  }
+#endif  // ESP32
+}
+
+// Last-good channel for SSID slot <ap>, loading the matching BSSID into Wifi.bssid.
+// Returns 0 if nothing usable is cached. The RTC copy is preferred as Settings may
+// not have been saved to flash since the last roam.
+uint8_t WifiFastReconnectChannel(uint32_t ap) {
+  if (ap >= MAX_SSIDS) { return 0; }
+#ifdef ESP32
+  if ((RTC_MEM_VALID == RtcFastWifi.valid) && RtcFastWifi.channel[ap]) {
+    memcpy(Wifi.bssid, RtcFastWifi.bssid[ap], sizeof(Wifi.bssid));
+    return RtcFastWifi.channel[ap];
+  }
+#endif  // ESP32
+  uint8_t channel = (0 == ap) ? Settings->wifi_channel : Settings->wifi_channel2;
+  if (channel) {
+    memcpy(Wifi.bssid, (0 == ap) ? Settings->wifi_bssid : Settings->wifi_bssid2, sizeof(Wifi.bssid));
+  }
+  return channel;
+}
+
+uint16_t WifiFastReconnectCount(void) {
+  return Wifi.fast_reconnect_count;
+}
+
+uint16_t WifiRoamCount(void) {
+  return Wifi.roam_count;
+}
+
+uint32_t WifiRoamLatency(void) {
+  return Wifi.roam_latency;
+}
+
 void WifiBegin(uint8_t flag, uint8_t channel) {
 #ifdef USE_EMULATION
   UdpDisconnect();
@@ -246,6 +334,13 @@ void WifiBegin(uint8_t flag, uint8_t channel) {
   if (Settings->ipv4_address[0]) {
     WiFi.config(Settings->ipv4_address[0], Settings->ipv4_address[1], Settings->ipv4_address[2], Settings->ipv4_address[3], Settings->ipv4_address[4]);  // Set static IP
   }
+#ifdef USE_DEEPSLEEP
+  else if (Wifi.lease_ip) {
+    // Reapply the DHCP lease preserved over deep sleep as a static config, skipping the
+    // DHCP exchange on wake. Gateway, netmask and DNS were saved to Settings on connect.
+    WiFi.config(Wifi.lease_ip, Settings->ipv4_address[1], Settings->ipv4_address[2], Settings->ipv4_address[3], Settings->ipv4_address[4]);
+  }
+#endif  // USE_DEEPSLEEP
   WiFi.hostname(TasmotaGlobal.hostname);  // ESP8266 needs this here (after WiFi.mode)
 
   char stemp[40] = { 0 };
@@ -266,6 +361,94 @@ void WifiBegin(uint8_t flag, uint8_t channel) {
   }
 }
 
+/*********************************************************************************************\
+ * Per channel scan for the WifiScan command
+ *
+ * The connection management scan (scan_state 1..5) keeps its single full sweep, but the
+ * WifiScan command walks the channels one at a time with a short dwell so the radio is
+ * never away from the AP long enough to disturb the association. Each channel's APs are
+ * published as they arrive and collected into a bounded list sorted by RSSI, which
+ * answers later WifiScan queries without keeping the Arduino scan buffers alive.
+\*********************************************************************************************/
+
+#ifndef WIFI_SCAN_MAX_APS
+#define WIFI_SCAN_MAX_APS      20        // Strongest APs kept for WifiScan queries
+#endif
+#ifndef WIFI_SCAN_CHANNEL_MS
+#define WIFI_SCAN_CHANNEL_MS   120       // Dwell per channel, short enough to keep the association
+#endif
+#define WIFI_SCAN_MAX_CHANNEL  14
+
+struct WifiScanAP {
+  char ssid[33];
+  uint8_t bssid[6];
+  uint8_t channel;
+  int8_t rssi;
+  uint8_t encryption;                    // Index into kWifiEncryptionTypes
+};
+WifiScanAP *WifiScanList = nullptr;      // Allocated while scanning and for one minute after
+uint8_t wifi_scan_ap_count = 0;
+
+void WifiScanChannel(void) {
+  // Scan the single channel Wifi.scan_channel asynchronously
+#ifdef ESP32
+  WiFi.scanNetworks(true, false, false, WIFI_SCAN_CHANNEL_MS, Wifi.scan_channel);
+#else
+  WiFi.scanNetworks(true, false, Wifi.scan_channel);
+#endif
+}
+
+void WifiScanAddAp(uint32_t i) {
+  // Insert scan result i into the bounded list sorted by descending RSSI
+  if (WifiScanList == nullptr) { return; }
+  WifiScanAP ap;
+  strlcpy(ap.ssid, WiFi.SSID(i).c_str(), sizeof(ap.ssid));
+  memcpy(ap.bssid, WiFi.BSSID(i), sizeof(ap.bssid));
+  ap.channel = WiFi.channel(i);
+  ap.rssi = WiFi.RSSI(i);
+  ap.encryption = WifiScanEncryption(i);
+  for (uint32_t j = 0; j < wifi_scan_ap_count; j++) {
+    if (!memcmp(WifiScanList[j].bssid, ap.bssid, sizeof(ap.bssid))) { return; }  // Seen on an overlapping channel
+  }
+  uint32_t pos = wifi_scan_ap_count;
+  while ((pos > 0) && (WifiScanList[pos -1].rssi < ap.rssi)) { pos--; }
+  if (pos >= WIFI_SCAN_MAX_APS) { return; }                  // Weaker than all kept entries
+  uint32_t last = (wifi_scan_ap_count < WIFI_SCAN_MAX_APS) ? wifi_scan_ap_count : WIFI_SCAN_MAX_APS -1;
+  for (uint32_t j = last; j > pos; j--) {
+    WifiScanList[j] = WifiScanList[j -1];
+  }
+  WifiScanList[pos] = ap;
+  if (wifi_scan_ap_count < WIFI_SCAN_MAX_APS) { wifi_scan_ap_count++; }
+}
+
+void WifiScanFree(void) {
+  free(WifiScanList);
+  WifiScanList = nullptr;
+  wifi_scan_ap_count = 0;
+}
+
+bool WifiScanResponseList(void) {
+  // Append the collected AP list to the response, false when no results are held
+  if ((WifiScanList == nullptr) || !wifi_scan_ap_count) { return false; }
+  ResponseAppend_P(PSTR("{"));
+  char hex_char[18];
+  for (uint32_t i = 0; i < wifi_scan_ap_count; i++) {
+    if (ResponseSize() < ResponseLength() + 300) { break; }
+    ResponseAppend_P(PSTR("%s\"" D_STATUS5_NETWORK "%d\":{\"" D_SSID "\":\"%s\",\"" D_BSSID "\":\"%s\",\"" D_CHANNEL
+                    "\":\"%d\",\"" D_JSON_SIGNAL "\":\"%d\",\"" D_RSSI "\":\"%d\",\"" D_JSON_ENCRYPTION "\":\"%s\"}"),
+                    (i) ? "," : "",
+                    i+1,
+                    WifiScanList[i].ssid,
+                    ToHex_P(WifiScanList[i].bssid, 6, hex_char, sizeof(hex_char), ':'),
+                    WifiScanList[i].channel,
+                    WifiScanList[i].rssi,
+                    WifiGetRssiAsQuality(WifiScanList[i].rssi),
+                    WifiEncryptionTypeStr(WifiScanList[i].encryption).c_str());
+  }
+  ResponseJsonEnd();
+  return true;
+}
+
 void WifiBeginAfterScan(void)
 {
   // Not active
@@ -274,10 +457,12 @@ void WifiBeginAfterScan(void)
   if (1 == Wifi.scan_state) {
     memset((void*) &Wifi.bssid, 0, sizeof(Wifi.bssid));
     Wifi.best_network_db = -127;
+    Wifi.roam_scan = false;
     Wifi.scan_state = 3;
   }
   // Init scan when connected
   if (2 == Wifi.scan_state) {
+    Wifi.roam_scan = true;                          // Roam evaluation - only move to a significantly better AP
     uint8_t* bssid = WiFi.BSSID();                  // Get current bssid
     memcpy((void*) &Wifi.bssid, (void*) bssid, sizeof(Wifi.bssid));
     Wifi.best_network_db = WiFi.RSSI();             // Get current rssi and add threshold
@@ -356,77 +541,74 @@ void WifiBeginAfterScan(void)
     // If bssid changed then (re)connect wifi
     for (uint32_t i = 0; i < sizeof(Wifi.bssid); i++) {
       if (last_bssid[i] != Wifi.bssid[i]) {
+        if (Wifi.roam_scan) {
+          Wifi.roam_pending = true;               // Leaving a working AP for a better one - measure the gap
+          Wifi.roam_start = millis();
+          Wifi.roam_count++;
+        }
         WifiBegin(ap, channel);                     // 0 (AP1), 1 (AP2) or 3 (default AP)
         break;
       }
     }
   }
 
-  // Init scan for wifiscan command
+  // Init per channel scan for wifiscan command
   if (6 == Wifi.scan_state) {
     if (wifi_scan_result != WIFI_SCAN_RUNNING) {
-      WiFi.scanNetworks(true);                      // Start wifi scan async
+      if (WifiScanList == nullptr) {
+        WifiScanList = (WifiScanAP*)malloc(WIFI_SCAN_MAX_APS * sizeof(WifiScanAP));
+      }
+      wifi_scan_ap_count = 0;
+      Wifi.scan_ap_number = 0;
+      Wifi.scan_channel = 1;
+      WifiScanChannel();                            // Start async scan of first channel
       Wifi.scan_state++;
       AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "Network scan started..."));
       return;
     }
   }
-  // Check scan done
+  // Publish this channel's APs as they arrive and move on to the next channel
   if (7 == Wifi.scan_state) {
-    if (wifi_scan_result != WIFI_SCAN_RUNNING) {
-      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "Network scan finished..."));
-      Wifi.scan_state++;
-      return;
-    }
-  }
-  // Scan done. Show SSId's scan result by MQTT and in console
-  if (7 < Wifi.scan_state) {
-    Wifi.scan_state++;
-
-    ResponseClear();
-
-    int32_t initial_item = (Wifi.scan_state - 9)*10;
-
-    if ( wifi_scan_result > initial_item ) {
-      // Sort networks by RSSI
-      uint32_t indexes[wifi_scan_result];
-      for (uint32_t i = 0; i < wifi_scan_result; i++) {
-        indexes[i] = i;
-      }
-      for (uint32_t i = 0; i < wifi_scan_result; i++) {
-        for (uint32_t j = i + 1; j < wifi_scan_result; j++) {
-          if (WiFi.RSSI(indexes[j]) > WiFi.RSSI(indexes[i])) {
-            std::swap(indexes[i], indexes[j]);
-          }
-        }
-      }
-      delay(0);
-
-      // Publish the list
-      uint32_t end_item = ( wifi_scan_result > initial_item + 10 ) ? initial_item + 10 : wifi_scan_result;
-      for (uint32_t i = initial_item; i < end_item; i++) {
+    if (wifi_scan_result == WIFI_SCAN_RUNNING) { return; }
+    if (wifi_scan_result > 0) {
+      for (int32_t i = 0; i < wifi_scan_result; i++) {
         Response_P(PSTR("{\"" D_CMND_WIFISCAN "\":{\"" D_STATUS5_NETWORK "%d\":{\"" D_SSID "\":\"%s\",\"" D_BSSID "\":\"%s\",\"" D_CHANNEL
                         "\":\"%d\",\"" D_JSON_SIGNAL "\":\"%d\",\"" D_RSSI "\":\"%d\",\"" D_JSON_ENCRYPTION "\":\"%s\"}}}"),
-                        i+1,
-                        WiFi.SSID(indexes[i]).c_str(),
-                        WiFi.BSSIDstr(indexes[i]).c_str(),
-                        WiFi.channel(indexes[i]),
-                        WiFi.RSSI(indexes[i]),
-                        WifiGetRssiAsQuality(WiFi.RSSI(indexes[i])),
-                        WifiEncryptionType(indexes[i]).c_str());
+                        ++Wifi.scan_ap_number,
+                        WiFi.SSID(i).c_str(),
+                        WiFi.BSSIDstr(i).c_str(),
+                        WiFi.channel(i),
+                        WiFi.RSSI(i),
+                        WifiGetRssiAsQuality(WiFi.RSSI(i)),
+                        WifiEncryptionType(i).c_str());
         MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, PSTR(D_CMND_WIFISCAN));
+        WifiScanAddAp(i);
+        delay(0);
       }
-    } else if (9 == Wifi.scan_state) {
+      WiFi.scanDelete();                            // Clean up Ram, the bounded list keeps the results
+    }
+    Wifi.scan_channel++;
+    if (Wifi.scan_channel <= WIFI_SCAN_MAX_CHANNEL) {
+      WifiScanChannel();
+      return;
+    }
+    // All channels swept
+    if (!Wifi.scan_ap_number) {
       Response_P(PSTR("{\"" D_CMND_WIFISCAN "\":\"" D_NO_NETWORKS_FOUND "\"}"));
       MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, PSTR(D_CMND_WIFISCAN));
     }
-    delay(0);
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "Network scan finished, %d networks found"), Wifi.scan_ap_number);
+    Wifi.scan_state++;
+    return;
   }
-  // Wait 1 minute before cleaning the results so the user can ask for the them using wifiscan command (HTTP use-case)
-  if (69 == Wifi.scan_state) {
-    //AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "Network scan results deleted..."));
-    Wifi.scan_state = 0;
-    WiFi.scanDelete();                            // Clean up Ram
+  // Wait 1 minute before cleaning the results so the user can ask for them using wifiscan command (HTTP use-case)
+  if (7 < Wifi.scan_state) {
+    Wifi.scan_state++;
+    if (69 == Wifi.scan_state) {
+      //AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "Network scan results deleted..."));
+      Wifi.scan_state = 0;
+      WifiScanFree();
+    }
   }
 
 }
@@ -448,6 +630,7 @@ void WifiSetState(uint8_t state)
       TasmotaGlobal.rules_flag.wifi_connected = 1;
       Wifi.link_count++;
       Wifi.downtime += UpTime() - Wifi.last_event;
+      DnsCacheFlush();                   // New link may come with a different DNS server
     } else {
       TasmotaGlobal.rules_flag.wifi_disconnected = 1;
       Wifi.last_event = UpTime();
@@ -832,9 +1015,16 @@ void WifiCheckIp(void) {
       Settings->ipv4_address[4] = (uint32_t)WiFi.dnsIP(1);
 
       // Save current AP parameters for quick reconnect
-      Settings->wifi_channel = WiFi.channel();
-      uint8_t *bssid = WiFi.BSSID();
-      memcpy((void*) &Settings->wifi_bssid, (void*) bssid, sizeof(Settings->wifi_bssid));
+      WifiSaveApInfo(Settings->sta_active, WiFi.channel(), WiFi.BSSID());
+      if (Wifi.fast_reconnect) {
+        Wifi.fast_reconnect = false;
+        Wifi.fast_reconnect_count++;  // Connected by directed association, no scan needed
+      }
+      if (Wifi.roam_pending) {
+        Wifi.roam_pending = false;
+        Wifi.roam_latency = millis() - Wifi.roam_start;
+        AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_WIFI "Roamed to better AP in %d ms"), Wifi.roam_latency);
+      }
     }
     Wifi.status = WL_CONNECTED;
   } else {
@@ -849,7 +1039,7 @@ void WifiCheckIp(void) {
         break;
       case WL_NO_SSID_AVAIL:
         AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_WIFI D_CONNECT_FAILED_AP_NOT_REACHED));
-        Settings->wifi_channel = 0;  // Disable stored AP
+        WifiClearApInfo(Settings->sta_active);  // Disable stored AP
         if (WIFI_WAIT == Settings->sta_config) {
           Wifi.retry = Wifi.retry_init;
         } else {
@@ -863,7 +1053,7 @@ void WifiCheckIp(void) {
         break;
       case WL_CONNECT_FAILED:
         AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_WIFI D_CONNECT_FAILED_WRONG_PASSWORD));
-        Settings->wifi_channel = 0;  // Disable stored AP
+        WifiClearApInfo(Settings->sta_active);  // Disable stored AP
         if (Wifi.retry > (Wifi.retry_init / 2)) {
           Wifi.retry = Wifi.retry_init / 2;
         }
@@ -874,14 +1064,14 @@ void WifiCheckIp(void) {
       default:  // WL_IDLE_STATUS and WL_DISCONNECTED
         if (!Wifi.retry || ((Wifi.retry_init / 2) == Wifi.retry)) {
           AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_WIFI D_CONNECT_FAILED_AP_TIMEOUT));
-          Settings->wifi_channel = 0;  // Disable stored AP
+          WifiClearApInfo(Settings->sta_active);  // Disable stored AP
           Wifi.max_retry++;
           if (100 == Wifi.max_retry) {  // Restart after 100 * (WIFI_RETRY_OFFSET_SEC + MAC) / 2 seconds
             TasmotaGlobal.restart_flag = 2;
           }
         } else {
           if (!strlen(SettingsText(SET_STASSID1)) && !strlen(SettingsText(SET_STASSID2))) {
-            Settings->wifi_channel = 0;  // Disable stored AP
+            WifiClearApInfo(Settings->sta_active);  // Disable stored AP
             wifi_config_tool = WIFI_MANAGER;  // Skip empty SSIDs and start Wifi config tool
             Wifi.retry = 0;
           } else {
@@ -892,14 +1082,27 @@ void WifiCheckIp(void) {
     if (Wifi.retry) {
       if (Settings->flag3.use_wifi_scan) {  // SetOption56 - Scan wifi network at restart for configured AP's
         if (Wifi.retry_init == Wifi.retry) {
-          Wifi.scan_state = 1;    // Select scanned SSID
+          uint8_t channel = WifiFastReconnectChannel(Settings->sta_active);
+          if (channel) {
+            Wifi.fast_reconnect = true;
+            WifiBegin(3, channel);  // Directed association to last-good AP, full scan only as fallback
+          } else {
+            Wifi.scan_state = 1;    // Select scanned SSID
+          }
+        }
+        else if (Wifi.fast_reconnect && ((Wifi.retry_init / 2) == Wifi.retry)) {
+          Wifi.fast_reconnect = false;
+          Wifi.scan_state = 1;      // Directed association failed, fall back to full scan
         }
       } else {
         if (Wifi.retry_init == Wifi.retry) {
-          WifiBegin(3, Settings->wifi_channel);  // Select default SSID
+          uint8_t channel = WifiFastReconnectChannel(Settings->sta_active);
+          Wifi.fast_reconnect = (channel != 0);
+          WifiBegin(3, channel);    // Select default SSID
         }
         if ((Settings->sta_config != WIFI_WAIT) && ((Wifi.retry_init / 2) == Wifi.retry)) {
-          WifiBegin(2, 0);        // Select alternate SSID
+          Wifi.fast_reconnect = false;
+          WifiBegin(2, 0);          // Select alternate SSID
         }
       }
       Wifi.retry--;
@@ -934,7 +1137,19 @@ void WifiCheck(uint8_t param)
       if ((WL_CONNECTED == WiFi.status()) && WifiHasIP() && !Wifi.config_type) {
         WifiSetState(1);
         if (Settings->flag3.use_wifi_rescan) {  // SetOption57 - Scan wifi network every 44 minutes for configured AP's
-          if (!(TasmotaGlobal.uptime % (60 * WIFI_RESCAN_MINUTES))) {
+          bool roam_scan = (0 == (TasmotaGlobal.uptime % (60 * WIFI_RESCAN_MINUTES)));
+          if (!roam_scan && (WiFi.RSSI() <= WIFI_ROAM_RSSI_FLOOR) &&
+              (0 == (TasmotaGlobal.uptime % (60 * WIFI_ROAM_SCAN_MINUTES)))) {
+            // Weak link on a multi-AP site - re-evaluate much sooner than the regular rescan
+            // so a moving device does not cling to a fading AP until timeout
+            roam_scan = true;
+#if defined(ESP32) && defined(CONFIG_WPA_11KV_SUPPORT)
+            if (esp_wnm_is_btm_supported_connection()) {
+              esp_wnm_send_bss_transition_mgmt_query(REASON_RSSI, NULL, 0);  // Ask the AP to steer us to a better neighbor
+            }
+#endif  // ESP32 && CONFIG_WPA_11KV_SUPPORT
+          }
+          if (roam_scan) {
             if (!Wifi.scan_state) { Wifi.scan_state = 2; } // If wifi scan routine is free, use it. Otherwise, wait for next RESCAN TIME
           }
         }
@@ -1089,7 +1304,7 @@ void WifiConnect(void)
   Wifi.max_retry = 0;
   Wifi.counter = 1;
 
-  memcpy((void*) &Wifi.bssid, (void*) Settings->wifi_bssid, sizeof(Wifi.bssid));
+  WifiFastReconnectChannel(Settings->sta_active);  // Preload last-good BSSID for the active SSID slot
 
 #ifdef WIFI_RF_PRE_INIT
   if (rf_pre_init_flag) {
@@ -1147,6 +1362,9 @@ void WifiDisable(void) {
 void EspRestart(void) {
   ResetPwm();
   WifiShutdown(true);
+#ifdef ESP32
+  SettingsWaitForWrite();     // Barrier - make sure a queued settings snapshot reached flash
+#endif  // ESP32
 #ifndef FIRMWARE_MINIMAL
   CrashDumpClear();           // Clear the stack dump in RTC
 #endif // FIRMWARE_MINIMAL
@@ -1261,6 +1479,70 @@ bool WifiDNSGetIPv6Priority(void) {
   return false;
 }
 
+/*********************************************************************************************\
+ * DNS cache
+ *
+ * MQTT reconnects, WebQuery, Telegram polling and syslog all resolve through
+ * WifiHostByName, and a slow or flaky DNS server adds seconds to every reconnect storm.
+ * Remember the last few lookups keyed by hostname hash: fresh answers are served without
+ * a query, failed lookups are answered negatively for a short while, and when a lookup
+ * fails an expired address is served instead so reconnects keep working while the DNS
+ * server recovers. Resolution counters are reported in Status 5.
+\*********************************************************************************************/
+
+#ifndef DNS_CACHE_SIZE
+#define DNS_CACHE_SIZE     4             // Number of cached lookups
+#endif
+#ifndef DNS_CACHE_TTL
+#define DNS_CACHE_TTL      300           // Seconds a resolved address is served without a new query
+#endif
+#ifndef DNS_CACHE_NEG_TTL
+#define DNS_CACHE_NEG_TTL  30            // Seconds a failed lookup is answered without a retry
+#endif
+
+struct {
+  IPAddress addr;
+  uint32_t hash;                         // Hostname hash, 0 = unused slot
+  uint32_t expires;                      // Uptime when the entry goes stale
+  bool negative;                         // Lookup failed, answer false until expiry
+} DnsCache[DNS_CACHE_SIZE];
+uint32_t dns_cache_slot = 0;             // Round robin replacement index
+
+struct {
+  uint16_t queries;                      // Lookups sent to the DNS server
+  uint16_t hits;                         // Lookups answered from the cache
+  uint16_t failures;                     // Lookups failed (after cache fallback)
+  uint16_t last_ms;                      // Duration of the last real lookup
+} DnsStats;
+
+void DnsCacheStore(uint32_t hash, const IPAddress& addr, bool negative) {
+  int32_t idx = -1;
+  for (uint32_t i = 0; i < DNS_CACHE_SIZE; i++) {
+    if (DnsCache[i].hash == hash) { idx = i; break; }
+  }
+  if (idx < 0) {
+    idx = dns_cache_slot;
+    dns_cache_slot = (dns_cache_slot +1) % DNS_CACHE_SIZE;
+  }
+  DnsCache[idx].hash = hash;
+  DnsCache[idx].addr = addr;
+  DnsCache[idx].negative = negative;
+  DnsCache[idx].expires = TasmotaGlobal.uptime + ((negative) ? DNS_CACHE_NEG_TTL : DNS_CACHE_TTL);
+}
+
+void DnsCacheFlush(void) {
+  // Call when the network (and with it possibly the DNS server) changed
+  for (uint32_t i = 0; i < DNS_CACHE_SIZE; i++) {
+    DnsCache[i].hash = 0;
+  }
+}
+
+void ResponseAppendDnsStats(void) {
+  // Resolution counters for Status 5
+  ResponseAppend_P(PSTR(",\"DNSStats\":{\"Queries\":%d,\"CacheHits\":%d,\"Failures\":%d,\"LastMs\":%d}"),
+    DnsStats.queries, DnsStats.hits, DnsStats.failures, DnsStats.last_ms);
+}
+
 bool WifiHostByName(const char* aHostname, IPAddress& aResult) {
 #ifdef USE_IPV6
 #if ESP_IDF_VERSION_MAJOR >= 5
@@ -1272,16 +1554,45 @@ bool WifiHostByName(const char* aHostname, IPAddress& aResult) {
 #endif
 #endif // USE_IPV6
 
+  uint32_t hash = GetHash(aHostname, strlen(aHostname));
+  if (!hash) { hash = 1; }               // Reserve 0 for unused slots
+  int32_t stale = -1;
+  for (uint32_t i = 0; i < DNS_CACHE_SIZE; i++) {
+    if (DnsCache[i].hash == hash) {
+      if ((int32_t)(DnsCache[i].expires - TasmotaGlobal.uptime) > 0) {
+        DnsStats.hits++;
+        if (DnsCache[i].negative) { return false; }
+        aResult = DnsCache[i].addr;
+        return true;
+      }
+      if (!DnsCache[i].negative) { stale = i; }  // Expired address kept as fallback
+      break;
+    }
+  }
+
   uint32_t dns_start = millis();
   bool success = WiFiHelper::hostByName(aHostname, aResult, Settings->dns_timeout);
   uint32_t dns_end = millis();
+  DnsStats.queries++;
+  DnsStats.last_ms = dns_end - dns_start;
   if (success) {
     // Host name resolved
     if (0xFFFFFFFF != (uint32_t)aResult) {
+      DnsCacheStore(hash, aResult, false);
       AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_WIFI "DNS resolved '%s' (%s) in %i ms"), aHostname, aResult.toString().c_str(), dns_end - dns_start);
       return true;
     }
   }
+  if (stale >= 0) {
+    // Serve the last known address rather than stalling the caller on a flaky DNS server,
+    // and keep it alive for the negative TTL so the next lookup retry is rate limited
+    aResult = DnsCache[stale].addr;
+    DnsCache[stale].expires = TasmotaGlobal.uptime + DNS_CACHE_NEG_TTL;
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "DNS failed for %s, using last known address (%s)"), aHostname, aResult.toString().c_str());
+    return true;
+  }
+  DnsStats.failures++;
+  DnsCacheStore(hash, IPAddress(), true);
   AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_WIFI "DNS failed for %s after %i ms"), aHostname, dns_end - dns_start);
   return false;
 }
@@ -1291,6 +1602,14 @@ bool WifiDnsPresent(const char* aHostname) {
   return WifiHostByName(aHostname, aResult);
 }
 
+// Seed the cache with an externally preserved address, e.g. restored from RTC memory
+// after deep sleep, so the first lookup after boot is served without a DNS query
+void WifiDnsSeed(const char* aHostname, IPAddress aAddress) {
+  uint32_t hash = GetHash(aHostname, strlen(aHostname));
+  if (!hash) { hash = 1; }               // Reserve 0 for unused slots
+  DnsCacheStore(hash, aAddress, false);
+}
+
 void WifiPollNtp() {
   static uint8_t ntp_sync_minute = 0;
   static uint32_t ntp_run_time = 0;
@@ -1305,7 +1624,8 @@ void WifiPollNtp() {
   uint8_t offset = (TasmotaGlobal.uptime < 30) ? RtcTime.second + ntp_run_time : (((ESP_getChipId() & 0xF) * 3) + 3) ;
 
   if ( (((offset == RtcTime.second) && ( (RtcTime.year < 2016) ||                  // Never synced
-                                         (ntp_sync_minute == uptime_minute))) ||   // Re-sync every hour
+                                         ((ntp_sync_minute == uptime_minute) &&
+                                          RtcNtpDue()))) ||                        // Re-sync every hour unless the drift discipline stretched the interval
        TasmotaGlobal.ntp_force_sync ) ) {                                          // Forced sync
 
     TasmotaGlobal.ntp_force_sync = false;
@@ -1319,6 +1639,7 @@ void WifiPollNtp() {
     if (ntp_run_time < 5) { ntp_run_time = 0; }  // DNS timeout is around 10s
 
     if (ntp_time > START_VALID_TIME) {
+      RtcNtpMeasureDrift(ntp_time, ntp_nanos % 1000000000);
       Rtc.utc_time = ntp_time;
       Rtc.nanos = ntp_nanos % 1000000000;
       ntp_sync_minute = 60;             // Sync so block further requests
@@ -1338,7 +1659,7 @@ uint64_t WifiGetNtp(void) {
 
   char fallback_ntp_server[2][32];
   ext_snprintf_P(fallback_ntp_server[0], sizeof(fallback_ntp_server[0]), PSTR("%_I"), Settings->ipv4_address[1]);  // #17984
-  ext_snprintf_P(fallback_ntp_server[1], sizeof(fallback_ntp_server[1]), PSTR("%d.pool.ntp.org"), random(0,3));
+  ext_snprintf_P(fallback_ntp_server[1], sizeof(fallback_ntp_server[1]), PSTR("%d.pool.ntp.org"), FastRandomRange(0, 3));
 
   char* ntp_server;
   for (uint32_t i = 0; i < MAX_NTP_SERVERS +2; i++) {
@@ -1361,7 +1682,7 @@ uint64_t WifiGetNtp(void) {
 
   uint32_t attempts = 3;
   while (attempts > 0) {
-    uint32_t port = random(1025, 65535);   // Create a random port for the UDP connection.
+    uint32_t port = FastRandomRange(1025, 65535);   // Create a random port for the UDP connection.
 #ifdef USE_IPV6
     if (udp.begin(IPAddress(IPv6), port) != 0) {
 #else
@@ -27,9 +27,22 @@
 
 #define XDRV_01                                   1
 
-// Enable below demo feature only if defines USE_UNISHOX_COMPRESSION and USE_SCRIPT_WEB_DISPLAY are disabled
+// Live update channel for the root status page using server-sent events instead of XHR
+// polling. Works with and without USE_UNISHOX_COMPRESSION but not with USE_SCRIPT_WEB_DISPLAY
+// which ships its own root page script.
 //#define USE_WEB_SSE
 
+// Incremental refresh for the root status page. The device keeps a hash per refresh row
+// and the XHR reply only carries the rows that changed since the previous poll; the root
+// page script patches them into its cached copy before re-rendering. Cuts refresh
+// airtime to the few rows that actually changed. Not with USE_WEB_SSE or
+// USE_SCRIPT_WEB_DISPLAY which ship their own root page scripts.
+//#define USE_WEB_SENSOR_DELTA
+
+#if defined(USE_WEB_SENSOR_DELTA) && (defined(USE_WEB_SSE) || defined(USE_SCRIPT_WEB_DISPLAY))
+#undef USE_WEB_SENSOR_DELTA                       // Delta refresh only supports the default XHR root page script
+#endif
+
 #define USE_CONSOLE_CSS_FLEX
 
 #ifndef WIFI_SOFT_AP_CHANNEL
@@ -51,6 +64,23 @@
 
 const uint16_t CHUNKED_BUFFER_SIZE = 500;                // Chunk buffer size (needs to be well below stack space (4k for ESP8266, 8k for ESP32) but large enough to cache some small messages)
 
+#ifdef USE_WEB_SENSOR_DELTA
+const uint16_t WEB_SENSOR_DELTA_CHUNKS = 32;             // Maximum tracked root page refresh rows - more rows fall back to full refresh
+#endif  // USE_WEB_SENSOR_DELTA
+
+#ifdef USE_WEBAUTH_SESSION
+#ifndef WEBAUTH_SESSION_TTL
+#define WEBAUTH_SESSION_TTL                       3600   // Session lifetime in seconds, renewed on use
+#endif
+#ifndef WEBAUTH_FAIL_MAX
+#define WEBAUTH_FAIL_MAX                          5      // Failed logins from one IP before lockout
+#endif
+#ifndef WEBAUTH_FAIL_BLOCK
+#define WEBAUTH_FAIL_BLOCK                        60     // Lockout duration in seconds
+#endif
+const uint32_t WEBAUTH_TOKEN_SIZE = 16;                  // Session token size in bytes (32 hex chars in the cookie)
+#endif  // USE_WEBAUTH_SESSION
+
 const uint16_t HTTP_REFRESH_TIME = 2345;                 // milliseconds
 const uint16_t HTTP_RESTART_RECONNECT_TIME = 10000;      // milliseconds - Allow time for restart and wifi reconnect
 #ifdef ESP8266
@@ -84,7 +114,11 @@ const char HTTP_SCRIPT_COUNTER[] PROGMEM =
   #ifdef USE_SCRIPT_WEB_DISPLAY
     #include "./html_compressed/HTTP_SCRIPT_ROOT_WEB_DISPLAY.h"
   #else
-    #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #ifdef USE_WEB_SSE
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_SSE_NO_WEB_DISPLAY.h"
+    #else
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #endif  // USE_WEB_SSE
   #endif
   #include "./html_compressed/HTTP_SCRIPT_ROOT_PART2.h"
 #else
@@ -100,6 +134,47 @@ const char HTTP_SCRIPT_COUNTER[] PROGMEM =
   #include "./html_uncompressed/HTTP_SCRIPT_ROOT_PART2.h"
 #endif
 
+#ifdef USE_WEB_SENSOR_DELTA
+const char HTTP_SCRIPT_ROOT_DELTA[] PROGMEM =
+  "var ft,sc=[],gn=-1;"
+  "function la(p){"
+    "a=p||'';"
+    "clearTimeout(ft);clearTimeout(lt);"
+    "if(x!=null){x.abort()}"             // Abort if no response within 2 seconds (happens on restart 1)
+    "x=new XMLHttpRequest();"
+    "x.onreadystatechange=()=>{"
+      "if(x.readyState==4&&x.status==200){"
+        "var r=x.responseText;"
+        "if(r.substr(0,3)=='{g}'){"      // Server generation counter - echoed on the next poll
+          "r=r.slice(3);"
+          "gn=parseInt(r);"
+          "r=r.slice((''+gn).length);"
+        "}"
+        "if(r.substr(0,3)=='{c}'){"      // Delta refresh - patch changed rows into the cached copy
+          "var g=r.split('{c}');"
+          "for(var i=1;i<g.length;i++){"
+            "sc[parseInt(g[i])]=g[i].substr(g[i].indexOf('{v}')+3);"
+          "}"
+        "}else if(r.length>2){"          // Full refresh - rebuild the cached copy
+          "sc=r.split('{s}');"
+        "}"
+        "if(r.length>2){"                // Nothing changed - keep current page as is
+          "var s=sc.join('{s}').replace(/{t}/g,\"<table style='width:100%%'>\")"
+                              ".replace(/{s}/g,\"<tr><th>\")"
+                              ".replace(/{m}/g,\"</th><td style='width:20px;white-space:nowrap'>\")"  // I want a right justified column with left justified text
+                              ".replace(/{e}/g,\"</td></tr>\");"
+          "eb('l1').innerHTML=s;"
+        "}"
+        "clearTimeout(ft);clearTimeout(lt);"
+        "lt=setTimeout(la,%d);"               // Settings.web_refresh
+      "}"
+    "};"
+    "x.open('GET','.?m=1'+a+'&gn='+gn,true);"  // ?m related to Webserver->hasArg("m"), gn is last seen generation (-1 requests a full refresh)
+    "x.send();"
+    "ft=setTimeout(la,2e4);"              // 20s failure timeout
+  "}";
+#endif  // USE_WEB_SENSOR_DELTA
+
 const char HTTP_SCRIPT_WIFI[] PROGMEM =
   "function c(l){"
     "eb('s1').value=l.innerText||l.textContent;"
@@ -483,6 +558,21 @@ ESP8266WebServer *Webserver;
 
 struct WEB {
   String chunk_buffer = "";                         // Could be max 2 * CHUNKED_BUFFER_SIZE
+#ifdef USE_WEB_SENSOR_DELTA
+  String sensor_capture = "";                       // Root page refresh payload being captured for delta compare
+  uint32_t sensor_chunk_hash[WEB_SENSOR_DELTA_CHUNKS];
+  uint32_t sensor_chunk_gen[WEB_SENSOR_DELTA_CHUNKS];  // Generation a row last changed in
+  uint32_t sensor_gen = 0;                          // Incremented on every poll that found changed rows
+  uint8_t sensor_chunk_count = 0;
+  bool sensor_capture_active = false;
+#endif  // USE_WEB_SENSOR_DELTA
+#ifdef USE_WEBAUTH_SESSION
+  uint8_t session_token[WEBAUTH_TOKEN_SIZE];        // Random token issued after a successful login
+  uint32_t session_expire_time = 0;                 // millis() deadline of the session, 0 = no session
+  uint32_t auth_fail_ip = 0;                        // Last client IPv4 that presented wrong credentials
+  uint32_t auth_fail_block_time = 0;                // millis() until which auth_fail_ip is locked out
+  uint8_t auth_fail_count = 0;
+#endif  // USE_WEBAUTH_SESSION
   uint32_t upload_size = 0;
   uint32_t light_shutter_button_mask;
   uint32_t buttons_non_light_non_shutter;
@@ -492,12 +582,20 @@ struct WEB {
   uint16_t upload_error = 0;
   uint8_t state = HTTP_OFF;
   uint8_t upload_file_type;
+  uint32_t console_generation = 1;                  // Bumped when console clients must resend the full log (web server restart)
   uint8_t config_block_count = 0;
   bool upload_services_stopped = false;
-  bool reset_web_log_flag = false;                  // Reset web console log
   bool initial_config = false;
 } Web;
 
+const uint32_t WEB_CONSOLE_CLIENTS = 4;             // Tracked concurrent console clients, least recently served is recycled
+
+struct WebConsoleClient_t {
+  uint32_t ip = 0;                                  // Client IPv4, 0 = free slot
+  uint32_t last_served = 0;                         // millis() of last served refresh, for pacing and slot recycling
+  uint32_t generation = 0;                          // Web.console_generation the client last synced to
+} WebConsoleClients[WEB_CONSOLE_CLIENTS];
+
 /*********************************************************************************************/
 
 // Helper function to avoid code duplication (saves 4k Flash)
@@ -644,7 +742,14 @@ void StartWebserver(int type) {
     if (!Webserver) {
       Webserver = new ESP8266WebServer((HTTP_MANAGER == type || HTTP_MANAGER_RESET_ONLY == type) ? 80 : WEB_PORT);
 
-      const char* headerkeys[] = { "Referer", "Host" };
+      const char* headerkeys[] = { "Referer", "Host"
+#ifdef UFILESYS_STATIC_SERVING
+        , "If-None-Match"              // Allows the UFS static file handler to answer 304 Not Modified
+#endif  // UFILESYS_STATIC_SERVING
+#ifdef USE_WEBAUTH_SESSION
+        , "Cookie"                     // Session token (ESP32 collects this by default, ESP8266 does not)
+#endif  // USE_WEBAUTH_SESSION
+      };
       size_t headerkeyssize = sizeof(headerkeys) / sizeof(char*);
       Webserver->collectHeaders(headerkeys, headerkeyssize);
 
@@ -665,6 +770,9 @@ void StartWebserver(int type) {
       Webserver->on("/u2", HTTP_POST, HandleUploadDone, HandleUploadLoop);  // this call requires 2 functions so we keep a direct call
 #ifndef FIRMWARE_MINIMAL
       XdrvXsnsCall(FUNC_WEB_ADD_HANDLER);
+#ifdef USE_PROFILE_TRACE
+      WebServer_on(PSTR("/trace"), HandleTraceDownload);  // Trace ring download as CSV
+#endif  // USE_PROFILE_TRACE
 #endif  // Not FIRMWARE_MINIMAL
 
       if (!Web.initial_config) {
@@ -672,7 +780,7 @@ void StartWebserver(int type) {
         if (Web.initial_config) { AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Blank Device - Initial Configuration")); }
       }
     }
-    Web.reset_web_log_flag = false;
+    Web.console_generation++;        // Console clients resend the full log
 
     Webserver->begin(); // Web server start
   }
@@ -733,9 +841,90 @@ void PollDnsWebserver(void) {
 
 /*********************************************************************************************/
 
+#ifdef USE_WEBAUTH_SESSION
+void WebSessionInvalidate(void) {
+  Web.session_expire_time = 0;
+}
+
+// Issue (or renew) the session token and hand it to the client as a cookie
+void WebSessionStart(void) {
+  if (0 == Web.session_expire_time) {
+    for (uint32_t i = 0; i < WEBAUTH_TOKEN_SIZE / 4; i++) {
+      ((uint32_t*)Web.session_token)[i] = HwRandom();
+    }
+  }
+  Web.session_expire_time = millis() + (WEBAUTH_SESSION_TTL * 1000);
+  char cookie[80];
+  snprintf_P(cookie, sizeof(cookie), PSTR("TASID="));
+  char *p = cookie + 6;
+  for (uint32_t i = 0; i < WEBAUTH_TOKEN_SIZE; i++) {
+    sprintf_P(p, PSTR("%02x"), Web.session_token[i]);
+    p += 2;
+  }
+  strcpy_P(p, PSTR("; Path=/; SameSite=Strict; HttpOnly"));
+  Webserver->sendHeader(F("Set-Cookie"), cookie);
+}
+
+// Validate the session cookie with a constant-time compare against the cached token
+bool WebAuthenticateSession(void) {
+  if (0 == Web.session_expire_time) { return false; }
+  if (TimeReached(Web.session_expire_time)) {
+    Web.session_expire_time = 0;
+    return false;
+  }
+  String cookie = Webserver->header(F("Cookie"));
+  int32_t idx = cookie.indexOf(F("TASID="));
+  if (idx < 0) { return false; }
+  const char *hex = cookie.c_str() + idx + 6;
+  uint8_t token[WEBAUTH_TOKEN_SIZE];
+  for (uint32_t i = 0; i < WEBAUTH_TOKEN_SIZE; i++) {
+    if (!isxdigit(hex[2 * i]) || !isxdigit(hex[2 * i + 1])) { return false; }
+    char buf[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+    token[i] = strtol(buf, nullptr, 16);
+  }
+  uint8_t diff = 0;
+  for (uint32_t i = 0; i < WEBAUTH_TOKEN_SIZE; i++) {
+    diff |= token[i] ^ Web.session_token[i];
+  }
+  if (diff) { return false; }
+  Web.session_expire_time = millis() + (WEBAUTH_SESSION_TTL * 1000);  // Sliding renewal
+  return true;
+}
+#endif  // USE_WEBAUTH_SESSION
+
 bool WebAuthenticate(void) {
   if (strlen(SettingsText(SET_WEBPWD)) && (HTTP_MANAGER_RESET_ONLY != Web.state)) {
+#ifdef USE_WEBAUTH_SESSION
+    if (WebAuthenticateSession()) { return true; }
+    uint32_t client_ip = (uint32_t)Webserver->client().remoteIP();
+    if ((client_ip == Web.auth_fail_ip) && (Web.auth_fail_count >= WEBAUTH_FAIL_MAX)) {
+      if (!TimeReached(Web.auth_fail_block_time)) {
+        return false;                              // IP locked out, don't even check credentials
+      }
+      Web.auth_fail_count = 0;
+    }
+    if (Webserver->authenticate(WEB_USERNAME, SettingsText(SET_WEBPWD))) {
+      if (client_ip == Web.auth_fail_ip) { Web.auth_fail_count = 0; }
+      WebSessionStart();
+      return true;
+    }
+    if (Webserver->header(F("Authorization")).length()) {
+      // Wrong credentials presented - requests without credentials (the browser's first
+      // try before it prompts) don't count towards the lockout
+      if (client_ip != Web.auth_fail_ip) {
+        Web.auth_fail_ip = client_ip;
+        Web.auth_fail_count = 0;
+      }
+      if (Web.auth_fail_count < 255) { Web.auth_fail_count++; }
+      if (Web.auth_fail_count >= WEBAUTH_FAIL_MAX) {
+        Web.auth_fail_block_time = millis() + (WEBAUTH_FAIL_BLOCK * 1000);
+        AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_HTTP "Login from %_I blocked for %d seconds"), client_ip, WEBAUTH_FAIL_BLOCK);
+      }
+    }
+    return false;
+#else
     return Webserver->authenticate(WEB_USERNAME, SettingsText(SET_WEBPWD));
+#endif  // USE_WEBAUTH_SESSION
   } else {
     return true;
   }
@@ -744,6 +933,9 @@ bool WebAuthenticate(void) {
 /*-------------------------------------------------------------------------------------------*/
 
 bool HttpCheckPriviledgedAccess(bool autorequestauth = true) {
+#ifdef USE_SLEEP_GOVERNOR
+  SleepGovernorBoost();                            // Keep loop latency low while the GUI is in use
+#endif  // USE_SLEEP_GOVERNOR
   if (HTTP_USER == Web.state) {
     HandleRoot();
     return false;
@@ -834,6 +1026,12 @@ void WSContentBegin(int code, int ctype) {
 void _WSContentSend(const char* content, size_t size) {  // Lowest level sendContent for all core versions
   Webserver->sendContent(content, size);
 
+  // Heavy management pages emit many chunks back to back - yield between chunks so the
+  // wifi stack can drain its buffers and the watchdog is serviced instead of blocking
+  // the loop for the whole page render (same pacing as the UFS download loop)
+  delay(0);
+  OsWatchLoop();
+
   SHOW_FREE_MEM(PSTR("WSContentSend"));
   DEBUG_CORE_LOG(PSTR("WEB: Chunk size %d"), size);
 }
@@ -856,6 +1054,12 @@ void WSContentFlush(void) {
 /*-------------------------------------------------------------------------------------------*/
 
 void _WSContentSendBufferChunk(const char* content) {
+#ifdef USE_WEB_SENSOR_DELTA
+  if (Web.sensor_capture_active) {                 // Root page refresh - capture for delta compare instead of sending
+    Web.sensor_capture += content;
+    return;
+  }
+#endif  // USE_WEB_SENSOR_DELTA
   int len = strlen(content);
   if (len < CHUNKED_BUFFER_SIZE) {                 // Append chunk buffer with small content
     Web.chunk_buffer += content;
@@ -879,6 +1083,12 @@ void WSContentSend(const char* content, size_t size) {
     strlcpy(buffer, content, sizeof(buffer));      // Terminate with '\0'
     _WSContentSendBufferChunk(buffer);
   } else {
+#ifdef USE_WEB_SENSOR_DELTA
+    if (Web.sensor_capture_active) {               // Root page refresh - capture for delta compare instead of sending
+      Web.sensor_capture.concat(content, size);
+      return;
+    }
+#endif  // USE_WEB_SENSOR_DELTA
     WSContentFlush();                              // Flush chunk buffer
     _WSContentSend(content, size);
   }
@@ -1362,8 +1572,12 @@ void HandleRoot(void) {
   WSContentStart_P(PSTR(D_MAIN_MENU));
 #ifdef USE_SCRIPT_WEB_DISPLAY
   WSContentSend_P(HTTP_SCRIPT_ROOT, Settings->web_refresh, Settings->web_refresh);
+#else
+#ifdef USE_WEB_SENSOR_DELTA
+  WSContentSend_P(HTTP_SCRIPT_ROOT_DELTA, Settings->web_refresh);
 #else
   WSContentSend_P(HTTP_SCRIPT_ROOT, Settings->web_refresh);
+#endif  // USE_WEB_SENSOR_DELTA
 #endif
   WSContentSend_P(HTTP_SCRIPT_ROOT_PART2);
   WSContentSendStyle();
@@ -1664,6 +1878,90 @@ bool WebUpdateSliderTime(void) {
 
 /*-------------------------------------------------------------------------------------------*/
 
+#ifdef USE_WEB_SENSOR_DELTA
+void WebSensorDeltaSend(void) {
+  // Split the captured refresh payload on the '{s}' row markers, hash every row and
+  // resend only the rows that changed since the generation the client last saw as
+  // '{c}<index>{v}<row>' records prefixed by '{g}<generation>'. The root page script
+  // keeps the row list client side, reassembles the page from it and echoes the
+  // generation on its next poll, so several open browsers each get their own delta.
+  // Row count changes, overflow and page (re)loads fall back to a full refresh which
+  // is also cheaper once most rows changed anyway.
+  const char *payload = Web.sensor_capture.c_str();
+  const char *starts[WEB_SENSOR_DELTA_CHUNKS];
+  uint16_t lens[WEB_SENSOR_DELTA_CHUNKS];
+  uint32_t hashes[WEB_SENSOR_DELTA_CHUNKS];
+  uint32_t count = 0;
+  bool overflow = false;
+  const char *cursor = payload;
+  for (;;) {
+    const char *next = strstr_P(cursor + ((count) ? 3 : 0), PSTR("{s}"));  // Skip this rows own leading marker
+    if (count == WEB_SENSOR_DELTA_CHUNKS) {
+      overflow = true;
+      break;
+    }
+    uint32_t len = (next) ? (uint32_t)(next - cursor) : strlen(cursor);
+    starts[count] = cursor;
+    lens[count] = len;
+    uint32_t hash = 5381;                          // djb2 xor variant
+    for (uint32_t i = 0; i < len; i++) {
+      hash = (hash * 33) ^ (uint8_t)cursor[i];
+    }
+    hashes[count] = hash;
+    count++;
+    if (!next) { break; }
+    cursor = next;
+  }
+
+  // Fold this poll into the tracked state before deciding what the client needs
+  bool restructured = (count != Web.sensor_chunk_count);
+  bool any_change = restructured;
+  for (uint32_t i = 0; i < count; i++) {
+    if (hashes[i] != Web.sensor_chunk_hash[i]) { any_change = true; }
+  }
+  if (any_change) {
+    Web.sensor_gen++;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if (hashes[i] != Web.sensor_chunk_hash[i]) {
+      Web.sensor_chunk_hash[i] = hashes[i];
+      Web.sensor_chunk_gen[i] = Web.sensor_gen;
+    }
+  }
+  Web.sensor_chunk_count = count;
+
+  char tmp[16];
+  WebGetArg(PSTR("gn"), tmp, sizeof(tmp));         // Generation the client last saw, -1 after page (re)load
+  uint32_t client_gen = strtoul(tmp, nullptr, 10);
+  bool full = overflow || restructured ||
+              (0 == strlen(tmp)) || ('-' == tmp[0]) ||
+              (client_gen > Web.sensor_gen);       // Device restarted - client generation is from a previous life
+  if (!full) {
+    uint32_t changed = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      if (Web.sensor_chunk_gen[i] > client_gen) { changed++; }
+    }
+    full = (changed > count / 2);
+  }
+
+  WSContentSend_P(PSTR("{g}%u"), Web.sensor_gen);
+  if (full) {
+    WSContentSend(payload, Web.sensor_capture.length());
+  } else {
+    for (uint32_t i = 0; i < count; i++) {
+      if (Web.sensor_chunk_gen[i] > client_gen) {
+        WSContentSend_P(PSTR("{c}%d{v}"), i);
+        // The client row list is split on '{s}' so rows are cached without their leading marker
+        WSContentSend(starts[i] + ((i) ? 3 : 0), lens[i] - ((i) ? 3 : 0));
+      }
+    }
+  }
+  Web.sensor_capture = "";
+}
+#endif  // USE_WEB_SENSOR_DELTA
+
+/*-------------------------------------------------------------------------------------------*/
+
 bool HandleRootStatusRefresh(void) {
   if (!WebAuthenticate()) {
     Webserver->requestAuthentication();
@@ -1784,6 +2082,11 @@ bool HandleRootStatusRefresh(void) {
   WSContentBegin(200, CT_HTML);
 #endif  // USE_WEB_SSE
 
+#ifdef USE_WEB_SENSOR_DELTA
+  Web.sensor_capture = "";                         // Divert refresh payload into capture buffer for delta compare
+  Web.sensor_capture_active = true;
+#endif  // USE_WEB_SENSOR_DELTA
+
   bool msg_exec_javascript = false;
   if (TasmotaGlobal.devices_present) {
     // Update changed web buttons
@@ -1923,6 +2226,11 @@ bool HandleRootStatusRefresh(void) {
     Web.slider_update_time = 0;
   }
 
+#ifdef USE_WEB_SENSOR_DELTA
+  Web.sensor_capture_active = false;
+  WebSensorDeltaSend();
+#endif  // USE_WEB_SENSOR_DELTA
+
   WSContentSend_P(PSTR("\n\n"));  // Prep for SSE
   WSContentEnd();
 
@@ -1975,7 +2283,7 @@ void WSContentSendNiceLists(uint32_t option) {
     }
     uint32_t ridx = pgm_read_word(&kGpioNiceList[i]) & 0xFFE0;
     uint32_t midx = BGPIO(ridx);
-    WSContentSend_P(HTTP_MODULE_TEMPLATE_REPLACE_NO_INDEX, ridx, GetTextIndexed(stemp, sizeof(stemp), midx, kSensorNames));
+    WSContentSend_P(HTTP_MODULE_TEMPLATE_REPLACE_NO_INDEX, ridx, GetGpioNameIndexed(stemp, sizeof(stemp), midx));
   }
   WSContentSend_P(PSTR("\";"));
 
@@ -2018,7 +2326,7 @@ void WSContentSendAdcNiceList(uint32_t option) {
     }
     uint32_t ridx = pgm_read_word(kAdcNiceList + i) & 0xFFE0;
     uint32_t midx = BGPIO(ridx);
-    WSContentSend_P(HTTP_MODULE_TEMPLATE_REPLACE_NO_INDEX, ridx, GetTextIndexed(stemp, sizeof(stemp), midx, kSensorNames));
+    WSContentSend_P(HTTP_MODULE_TEMPLATE_REPLACE_NO_INDEX, ridx, GetGpioNameIndexed(stemp, sizeof(stemp), midx));
   }
 }
 #endif  // USE_ADC
@@ -3706,16 +4014,41 @@ void HandleConsoleRefresh(void) {
   uint32_t index = 0;                // Initial start, dump all
   if (strlen(stmp)) { index = atoi(stmp); }
 
+  // Find this client's slot or recycle the least recently served one, so each
+  // open console keeps its own reset state and pacing instead of sharing one flag
+  uint32_t client_ip = (uint32_t)Webserver->client().remoteIP();
+  WebConsoleClient_t *client = &WebConsoleClients[0];
+  for (uint32_t i = 0; i < WEB_CONSOLE_CLIENTS; i++) {
+    if (WebConsoleClients[i].ip == client_ip) {
+      client = &WebConsoleClients[i];
+      break;
+    }
+    if (TimePassedSince(WebConsoleClients[i].last_served) > TimePassedSince(client->last_served)) {
+      client = &WebConsoleClients[i];
+    }
+  }
+  bool reset_done = (client->ip == client_ip) && (client->generation == Web.console_generation);
+  if (reset_done && ((uint32_t)TimePassedSince(client->last_served) < (Settings->web_refresh / 2))) {
+    // Pace this client - echo its cursor back without formatting, lines stay queued for the next poll
+    WSContentBegin(200, CT_PLAIN);
+    WSContentSend_P(PSTR("%d}1%d}1}1"), index, 1);
+    WSContentEnd();
+    return;
+  }
+  client->ip = client_ip;
+  client->last_served = millis();
+  client->generation = Web.console_generation;
+
+  uint32_t head = TasmotaGlobal.log_buffer_pointer;  // Snapshot - lines logged while we stream are picked up next poll
   WSContentBegin(200, CT_PLAIN);
-  WSContentSend_P(PSTR("%d}1%d}1"), TasmotaGlobal.log_buffer_pointer, Web.reset_web_log_flag);
-  if (!Web.reset_web_log_flag) {
+  WSContentSend_P(PSTR("%d}1%d}1"), head, reset_done);
+  if (!reset_done) {
     index = 0;
-    Web.reset_web_log_flag = true;
   }
   bool cflg = (index);
   char* line;
   size_t len;
-  while (GetLog(Settings->weblog_level, &index, &line, &len)) {
+  while ((index != head) && GetLog(Settings->weblog_level, &index, &line, &len)) {
     if (cflg) { WSContentSend_P(PSTR("\n")); }
     WSContentSend(line, len -1);
     cflg = true;
@@ -4067,6 +4400,9 @@ void CmndWebPassword(void) {
   bool show_asterisk = (2 == XdrvMailbox.index);
   if (XdrvMailbox.data_len > 0) {
     SettingsUpdateText(SET_WEBPWD, (SC_CLEAR == Shortcut()) ? "" : (SC_DEFAULT == Shortcut()) ? WEB_PASSWORD : XdrvMailbox.data);
+#ifdef USE_WEBAUTH_SESSION
+    WebSessionInvalidate();                        // Existing sessions must log in with the new password
+#endif  // USE_WEBAUTH_SESSION
     if (!show_asterisk) {
       ResponseCmndChar(SettingsText(SET_WEBPWD));
     }
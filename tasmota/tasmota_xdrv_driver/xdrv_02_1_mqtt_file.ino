@@ -43,12 +43,54 @@ struct FMQTT {
   MD5Builder md5;                        // MQTT md5
   String file_md5;                       // MQTT received file md5 (32 chars)
   uint16_t topic_size;                   // MQTT topic length with terminating <null>
+  uint8_t ack_window = 1;                // MQTT chunks per acknowledge (1 = lock-step)
+  uint8_t chunk_count = 0;               // MQTT chunks received since last acknowledge
   uint8_t file_id = 0;                   // MQTT unique file id during upload/download
   bool file_binary = false;              // MQTT binary file transfer
 } FMqtt;
 
 const uint32_t FileTransferHeaderSize = 21;       // {"Id":116,"Data":""}<null>
 
+/*********************************************************************************************\
+ * Base64 download chunk streamed through MqttPublishStream
+\*********************************************************************************************/
+
+struct FileDownloadStream {
+  base64_encode_state b64;               // Streaming base64 encoder state
+  uint8_t* data;                         // Unencoded chunk data
+  uint32_t data_len;                     // Unencoded chunk size
+  uint32_t data_done;                    // Unencoded bytes consumed so far
+  uint32_t prefix_len;                   // Payload prefix length
+  bool tail_sent;                        // Closing quote and brace emitted
+  char prefix[32];                       // {"Id":117,"Data":"
+};
+
+uint32_t MqttFileDownloadWriter(uint32_t offset, uint8_t* out, uint32_t size, void* context) {
+  FileDownloadStream* stream = (FileDownloadStream*)context;
+
+  if (offset < stream->prefix_len) {
+    uint32_t len = stream->prefix_len - offset;
+    if (len > size) { len = size; }
+    memcpy(out, stream->prefix + offset, len);
+    return len;
+  }
+
+  uint32_t len = 0;
+  if (stream->data_done < stream->data_len) {
+    uint32_t slice = ((size / 4) * 3) -2;                    // Worst case the encoder carries two bytes into this slice
+    if (slice > stream->data_len - stream->data_done) { slice = stream->data_len - stream->data_done; }
+    len = encode_base64_update(&stream->b64, stream->data + stream->data_done, slice, out);
+    stream->data_done += slice;
+  }
+  if ((stream->data_done == stream->data_len) && !stream->tail_sent && (len +4 +2 <= size)) {
+    len += encode_base64_final(&stream->b64, out + len);     // Padded last quad so the writer never returns 0 before the tail
+    out[len++] = '"';
+    out[len++] = '}';
+    stream->tail_sent = true;
+  }
+  return len;
+}
+
 void MqttFileValidate(uint32_t error) {
   if (error) {
     FMqtt.file_buffer = nullptr;
@@ -72,6 +114,8 @@ void MqttFilePublish(void) {
     FMqtt.file_id = 0;
     FMqtt.file_size = 0;
     FMqtt.file_type = 0;
+    FMqtt.ack_window = 1;
+    FMqtt.chunk_count = 0;
     FMqtt.file_binary = false;
     FMqtt.file_md5 = (const char*) nullptr;                  // Force deallocation of the String internal memory
     FMqtt.file_password = nullptr;
@@ -195,6 +239,9 @@ void CmndFileUpload(void) {
 
   Start an upload session:
     FileUpload {"Password":"","File":"Config_wemos10_9.4.0.3.dmp","Id":116,"Type":2,"Size":4096}
+  Optional "Ack" selects a windowed pipeline - the device acknowledges every Ack chunks (max 16)
+  with the current file offset so the sender can keep chunks in flight and resume on a mismatch:
+    FileUpload {"Password":"","File":"Config_wemos10_9.4.0.3.dmp","Id":116,"Type":2,"Size":4096,"Ack":8}
 
   Upload data using base64:
     FileUpload {"Id":116,"Data":"CRJcTQ9fYGF ... OT1BRUlNUVVZXWFk="}
@@ -227,6 +274,13 @@ void CmndFileUpload(void) {
         if (val) { base64_data = val.getStr(); }
         val = root[PSTR("PASSWORD")];
         if (val) { FMqtt.file_password = val.getStr(); }
+        val = root[PSTR("ACK")];
+        if (val) {                                           // Chunks in flight before an acknowledge is sent
+          uint32_t ack_window = val.getUInt();
+          if (ack_window < 1) { ack_window = 1; }
+          if (ack_window > 16) { ack_window = 16; }
+          FMqtt.ack_window = ack_window;
+        }
       }
     }
   } else {
@@ -241,10 +295,13 @@ void CmndFileUpload(void) {
       unsigned char* raw_data = (unsigned char*)XdrvMailbox.data;
       uint32_t rcvd_bytes = XdrvMailbox.data_len;
       if (!binary_data) {
-        raw_data = (unsigned char*)malloc(XdrvMailbox.data_len);
-        if (raw_data) {
-          rcvd_bytes = decode_base64((unsigned char*)base64_data, (unsigned char*)raw_data);
-        }
+        // Decode over the received buffer - the streaming decoder emits three bytes
+        // per four characters so the output never overtakes the input being read
+        base64_decode_state b64;
+        decode_base64_init(&b64);
+        raw_data = (unsigned char*)base64_data;
+        rcvd_bytes = decode_base64_update(&b64, (unsigned char*)base64_data, strlen(base64_data), raw_data);
+        rcvd_bytes += decode_base64_final(&b64, raw_data + rcvd_bytes);
       }
 
       if (raw_data) {
@@ -262,10 +319,6 @@ void CmndFileUpload(void) {
           }
         }
 
-        if (!binary_data) {
-          free(raw_data);
-        }
-
         FMqtt.file_pos += read_bytes;
       }
 
@@ -282,8 +335,13 @@ void CmndFileUpload(void) {
       if (!binary_data && !FMqtt.file_pos) {
         FMqtt.chunk_size = (((FMqtt.chunk_size - FileTransferHeaderSize) / 4) * 3) -2;  // Calculate base64 chunk size
       }
-      // {"Id":116,"MaxSize":"765"}
-      Response_P(PSTR("{\"Id\":%d,\"MaxSize\":%d}"), FMqtt.file_id, FMqtt.chunk_size);
+      if (FMqtt.file_pos && (FMqtt.file_pos < FMqtt.file_size) && (++FMqtt.chunk_count < FMqtt.ack_window)) {
+        ResponseClear();                                     // Windowed pipeline - acknowledge only every ack_window chunks
+        return;
+      }
+      FMqtt.chunk_count = 0;
+      // {"Id":116,"MaxSize":765,"Offset":1400}
+      Response_P(PSTR("{\"Id\":%d,\"MaxSize\":%d,\"Offset\":%d}"), FMqtt.file_id, FMqtt.chunk_size, FMqtt.file_pos);
     } else {
       FMqtt.md5.calculate();
       if (strcasecmp(FMqtt.file_md5.c_str(), FMqtt.md5.toString().c_str())) {
@@ -420,20 +478,19 @@ void CmndFileDownload(void) {
         MqttPublishPayloadPrefixTopic_P(STAT, XdrvMailbox.command, (const char*)buffer, write_bytes);
       } else {
         // {"Id":117,"Data":"CRJcTQ9fYGF ... OT1BRUlNUVVZXWFk="}
-        char* base64_data = (char*)malloc(encode_base64_length(write_bytes) +2);
-        if (base64_data) {
-          Response_P(PSTR("{\"Id\":%d,\"Data\":\""), FMqtt.file_id);  // FileTransferHeaderSize
-
-          SHOW_FREE_MEM(PSTR("CmndFileDownload"));
-
-          encode_base64((unsigned char*)buffer, write_bytes, (unsigned char*)base64_data);
-          ResponseAppend_P(base64_data);
-          ResponseAppend_P("\"}");
-          MqttPublishPrefixTopic_P(STAT, XdrvMailbox.command);
-          free(base64_data);
-        } else {
-          XdrvMailbox.payload = 0;                           // Abort
-        }
+        // Encode in small slices straight into the MQTT client instead of staging the whole encoded chunk
+        FileDownloadStream stream;
+        encode_base64_init(&stream.b64);
+        stream.data = buffer;
+        stream.data_len = write_bytes;
+        stream.data_done = 0;
+        stream.tail_sent = false;
+        stream.prefix_len = snprintf_P(stream.prefix, sizeof(stream.prefix), PSTR("{\"Id\":%d,\"Data\":\""), FMqtt.file_id);
+
+        SHOW_FREE_MEM(PSTR("CmndFileDownload"));
+
+        uint32_t plength = stream.prefix_len + (((write_bytes + 2) / 3) * 4) + 2;  // Prefix, encoded data, closing quote and brace
+        MqttPublishStreamPrefixTopic_P(STAT, XdrvMailbox.command, plength, false, MqttFileDownloadWriter, &stream);
       }
       ResponseClear();
       if (XdrvMailbox.payload != 0) { return; }              // No error
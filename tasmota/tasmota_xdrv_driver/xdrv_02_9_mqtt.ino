@@ -25,6 +25,7 @@
 
 #ifdef USE_MQTT_TLS
   #include "WiFiClientSecureLightBearSSL.h"
+  #include "ESP32HwAES.h"                 // Defines TLS_HW_AES_CTR when the AES peripheral is usable
   BearSSL::WiFiClientSecure_light *tlsClient;
 #endif
 WiFiClient EspClient;                     // Wifi Client - non-TLS
@@ -54,7 +55,7 @@ const char kMqttCommands[] PROGMEM = "|"  // No prefix
   D_SO_MQTTNORETAIN "|" D_SO_MQTTDETACHRELAY "|"
   // regular commands
 #if defined(USE_MQTT_TLS)
-  D_CMND_MQTTFINGERPRINT "|"
+  D_CMND_MQTTFINGERPRINT "|" "TlsBench" "|"
 #endif
   D_CMND_MQTTUSER "|" D_CMND_MQTTPASSWORD "|" D_CMND_MQTTKEEPALIVE "|" D_CMND_MQTTTIMEOUT "|" D_CMND_MQTTWIFITIMEOUT "|"
 #if defined(USE_MQTT_TLS) && defined(USE_MQTT_CLIENT_CERT)
@@ -81,7 +82,7 @@ SO_SYNONYMS(kMqttSynonyms,
 void (* const MqttCommand[])(void) PROGMEM = {
 #ifndef FIRMWARE_MINIMAL
 #if defined(USE_MQTT_TLS)
-  &CmndMqttFingerprint,
+  &CmndMqttFingerprint, &CmndTlsBench,
 #endif
   &CmndMqttUser, &CmndMqttPassword, &CmndMqttKeepAlive, &CmndMqttTimeout, &CmndMqttWifiTimeout,
 #if defined(USE_MQTT_TLS) && defined(USE_MQTT_CLIENT_CERT)
@@ -108,6 +109,84 @@ struct MQTT {
   bool disable_logging = false;          // Temporarly disable logging on some commands
 } Mqtt;
 
+#ifdef USE_MQTT_STORE_FORWARD
+/*********************************************************************************************\
+ * Offline store-and-forward queue
+ *
+ * While the broker is unreachable, failed publishes are parked in a FIFO of heap records
+ * (PSRAM preferred on ESP32) and replayed in order after reconnect, a few per 100ms so
+ * neither broker nor wifi gets flooded. Oldest messages are dropped once the byte budget
+ * is exceeded.
+\*********************************************************************************************/
+
+#ifndef MQTT_SF_BUDGET
+#define MQTT_SF_BUDGET       16384     // Maximum queued bytes
+#endif
+#ifndef MQTT_SF_DRAIN_BURST
+#define MQTT_SF_DRAIN_BURST  2         // Messages replayed per 100ms after reconnect
+#endif
+
+struct MqttSfRecord {
+  MqttSfRecord *next;
+  uint16_t payload_len;
+  bool retained;
+  char data[];                         // topic\0 followed by payload
+};
+
+MqttSfRecord *mqtt_sf_head = nullptr;  // Oldest queued message
+MqttSfRecord *mqtt_sf_tail = nullptr;
+uint32_t mqtt_sf_bytes = 0;
+
+void MqttSfDropOldest(void) {
+  MqttSfRecord *rec = mqtt_sf_head;
+  if (!rec) { return; }
+  mqtt_sf_head = rec->next;
+  if (!mqtt_sf_head) { mqtt_sf_tail = nullptr; }
+  mqtt_sf_bytes -= sizeof(MqttSfRecord) + strlen(rec->data) +1 + rec->payload_len;
+  free(rec);
+}
+
+void MqttSfEnqueue(const char* topic, const char* payload, uint32_t payload_len, bool retained) {
+  uint32_t topic_len = strlen(topic) +1;
+  uint32_t size = sizeof(MqttSfRecord) + topic_len + payload_len;
+  if ((size > MQTT_SF_BUDGET) || (payload_len > 0xFFFF)) { return; }
+  while (mqtt_sf_bytes + size > MQTT_SF_BUDGET) {
+    MqttSfDropOldest();                // Budget exceeded - oldest telemetry is least valuable
+  }
+#ifdef ESP32
+  MqttSfRecord *rec = (MqttSfRecord *)special_malloc_tag(PSTR("mqtt"), size);
+#else
+  MqttSfRecord *rec = (MqttSfRecord *)malloc(size);
+#endif
+  if (!rec) { return; }
+  rec->next = nullptr;
+  rec->payload_len = payload_len;
+  rec->retained = retained;
+  memcpy(rec->data, topic, topic_len);
+  memcpy(rec->data + topic_len, payload, payload_len);
+  if (mqtt_sf_tail) {
+    mqtt_sf_tail->next = rec;
+  } else {
+    mqtt_sf_head = rec;
+  }
+  mqtt_sf_tail = rec;
+  mqtt_sf_bytes += size;
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Queued %s while offline (%d bytes held)"), topic, mqtt_sf_bytes);
+}
+
+void MqttSfDrain(void) {
+  if (!mqtt_sf_head || !Mqtt.connected || !MqttIsConnected()) { return; }
+  for (uint32_t i = 0; i < MQTT_SF_DRAIN_BURST; i++) {
+    MqttSfRecord *rec = mqtt_sf_head;
+    if (!rec) { break; }
+    if (!MqttPublishLib(rec->data, (const uint8_t*)(rec->data + strlen(rec->data) +1), rec->payload_len, rec->retained)) {
+      break;                           // Connection dropped again - keep the message queued
+    }
+    MqttSfDropOldest();
+  }
+}
+#endif  // USE_MQTT_STORE_FORWARD
+
 #ifdef USE_MQTT_TLS
 
 // This part of code is necessary to store Private Key and Cert in Flash
@@ -147,6 +226,42 @@ bool is_fingerprint_mono_value(uint8_t finger[20], uint8_t value) {
 	}
 	return true;
 }
+
+uint32_t TlsBenchCtr(const br_block_ctr_class *vt, uint8_t *data, uint32_t kbytes) {
+  // Run AES-128-CTR over kbytes of data with the given implementation, return kB/s
+  const uint8_t key[16] = { 0x54, 0x61, 0x73, 0x6D, 0x6F, 0x74, 0x61, 0x20,
+                            0x54, 0x6C, 0x73, 0x42, 0x65, 0x6E, 0x63, 0x68 };
+  const uint8_t iv[12] = { 0 };
+  br_aes_gen_ctr_keys keys;
+  vt->init(&keys.vtable, key, sizeof(key));
+  uint32_t cc = 0;
+  uint32_t start = millis();
+  for (uint32_t i = 0; i < kbytes; i++) {
+    cc = vt->run(&keys.vtable, iv, cc, data, 1024);
+    yield();                             // Feed the watchdog, software AES is slow
+  }
+  uint32_t elapsed = millis() - start;
+  if (!elapsed) { elapsed = 1; }
+  return (kbytes * 1000) / elapsed;
+}
+
+void CmndTlsBench(void) {
+  // TlsBench 1..1024 - run AES-128-CTR (the TLS record cipher) over x kB (default 64)
+  //                    through the software implementation and the hardware one when
+  //                    present, reporting both in kB/s
+  uint32_t kbytes = ((XdrvMailbox.payload >= 1) && (XdrvMailbox.payload <= 1024)) ? XdrvMailbox.payload : 64;
+  uint8_t *data = (uint8_t*)malloc(1024);
+  if (data == nullptr) { ResponseCmndFailed(); return; }
+  memset(data, 0xA5, 1024);
+  uint32_t sw_kbs = TlsBenchCtr(&br_aes_small_ctr_vtable, data, kbytes);
+#ifdef TLS_HW_AES_CTR
+  uint32_t hw_kbs = TlsBenchCtr(&br_aes_esp32_ctr_vtable, data, kbytes);
+  Response_P(PSTR("{\"%s\":{\"AES128CTR\":{\"" D_JSON_SIZE "\":%d,\"SW\":%d,\"HW\":%d}}}"), XdrvMailbox.command, kbytes, sw_kbs, hw_kbs);
+#else
+  Response_P(PSTR("{\"%s\":{\"AES128CTR\":{\"" D_JSON_SIZE "\":%d,\"SW\":%d}}}"), XdrvMailbox.command, kbytes, sw_kbs);
+#endif  // TLS_HW_AES_CTR
+  free(data);
+}
 #endif  // USE_MQTT_TLS
 
 void MakeValidMqtt(uint32_t option, char* str) {
@@ -263,6 +378,11 @@ void MqttInit(void) {
       tlsClient->setTrustAnchor(Tasmota_TA, nitems(Tasmota_TA));
     }
 
+    // Cache negotiated session parameters across broker reconnects so most handshakes
+    // are abbreviated resumptions instead of full RSA/ECDSA exchanges
+    static br_ssl_session_parameters tls_session = { 0 };
+    tlsClient->setSession(&tls_session);
+
     MqttClient.setClient(*tlsClient);
   } else {
     MqttClient.setClient(EspClient);    // non-TLS
@@ -571,6 +691,62 @@ bool MqttPublishLib(const char* topic, const uint8_t* payload, unsigned int plen
   return true;
 }
 
+/*********************************************************************************************\
+ * Streaming publish
+ *
+ * Publish a payload produced in chunks by a writer callback, bypassing the ResponseData
+ * staging buffer. The total payload length must be known up front (MQTT fixed header).
+ * The writer is called repeatedly with the current offset and a scratch buffer and returns
+ * the number of bytes filled, 0 when exhausted. Intended for large generated payloads like
+ * file transfers and bulk telemetry that today have to be staged in full.
+\*********************************************************************************************/
+
+typedef uint32_t (*MqttStreamWriter)(uint32_t offset, uint8_t* buffer, uint32_t size, void* context);
+
+bool MqttPublishStream(const char* topic, uint32_t plength, bool retained, MqttStreamWriter writer, void* context) {
+  if (!MqttIsConnected()) { return false; }
+
+  // If Prefix1 equals Prefix2 disable next MQTT subscription to prevent loop
+  if (!strcmp(SettingsText(SET_MQTTPREFIX1), SettingsText(SET_MQTTPREFIX2))) {
+    char *str = strstr(topic, SettingsText(SET_MQTTPREFIX1));
+    if (str == topic) {
+      TasmotaGlobal.mqtt_cmnd_blocked_reset = 4;  // Allow up to four seconds before resetting residual cmnd blocks
+      TasmotaGlobal.mqtt_cmnd_blocked++;
+    }
+  }
+
+  if (!MqttClient.beginPublish(topic, plength, retained)) {
+    return false;
+  }
+  uint8_t chunk[256];
+  uint32_t offset = 0;
+  while (offset < plength) {
+    uint32_t len = writer(offset, chunk, sizeof(chunk), context);
+    if (!len || (len > sizeof(chunk))) { break; }
+    if (MqttClient.write(chunk, len) != len) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Stream write failed at %d/%d"), offset, plength);
+      return false;
+    }
+    offset += len;
+    delay(0);                                    // Keep wifi and watchdog happy on large payloads
+  }
+  MqttClient.endPublish();
+  delay(0);
+  return (offset == plength);
+}
+
+bool MqttPublishStreamPrefixTopic_P(uint32_t prefix, const char* subtopic, uint32_t plength, bool retained, MqttStreamWriter writer, void* context) {
+  // Stream publish <prefix>/<device>/<RESULT or <subtopic>> using a writer callback (See MqttPublishPayloadPrefixTopic_P for prefix)
+  char romram[64];                      // Claim 64 bytes from 4k stack
+  strcpy_P(romram, ((prefix > 3) && !Settings->flag.mqtt_response) ? S_RSLT_RESULT : subtopic);  // SetOption4 - Switch between MQTT RESULT or COMMAND
+  UpperCase(romram, romram);
+
+  prefix &= 3;
+  char stopic[TOPSZ];                   // Claim TOPSZ bytes from 4k stack
+  GetTopic_P(stopic, prefix, TasmotaGlobal.mqtt_topic, romram);
+  return MqttPublishStream(stopic, plength, retained, writer, context);
+}
+
 void MqttDataHandler(char* mqtt_topic, uint8_t* mqtt_data, unsigned int data_len) {
   SHOW_FREE_MEM(PSTR("MqttDataHandler"));
 
@@ -652,6 +828,7 @@ void MqttDataHandler(char* mqtt_topic, uint8_t* mqtt_data, unsigned int data_len
   XdrvMailbox.data_len = data_len;
   XdrvMailbox.topic = topic;
   XdrvMailbox.data = (char*)mqtt_data;
+  if (MqttTopicHandlerDispatch(topic)) { return; }  // Registered prefix handlers first - one hash instead of a driver broadcast
   if (XdrvCall(FUNC_MQTT_DATA)) { return; }
 
   ShowSource(SRC_MQTT);
@@ -675,6 +852,64 @@ void MqttRetryCounter(uint8_t value) {
   Mqtt.retry_counter = value;
 }
 
+/*********************************************************************************************\
+ * Hashed first-segment topic dispatch
+ *
+ * Drivers subscribing to a fixed foreign topic prefix (domoticz/out, Hue, user bridges)
+ * can register prefix and handler here. MqttDataHandler hashes the first segment of every
+ * incoming topic once and calls only handlers whose prefix hash matches instead of
+ * broadcasting FUNC_MQTT_DATA through all compiled drivers. Handlers read the prepared
+ * XdrvMailbox like a FUNC_MQTT_DATA callback and return true when the message is consumed.
+ * Unmatched topics (device, group and command topics) take the existing broadcast path.
+\*********************************************************************************************/
+
+#ifndef MQTT_TOPIC_HANDLERS_MAX
+#define MQTT_TOPIC_HANDLERS_MAX  8
+#endif
+
+typedef bool (*MqttTopicHandler)(void);
+
+struct {
+  uint32_t hash;
+  MqttTopicHandler handler;
+} mqtt_topic_handlers[MQTT_TOPIC_HANDLERS_MAX];
+uint32_t mqtt_topic_handler_count = 0;
+
+uint32_t MqttTopicHash(const char* topic) {
+  // FNV-1a over the first topic segment - MQTT topics are case sensitive
+  uint32_t hash = 0x811C9DC5;
+  while (*topic && (*topic != '/')) {
+    hash ^= (uint8_t)*topic++;
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+void MqttTopicHandlerRegister(const char* prefix, MqttTopicHandler handler) {
+  uint32_t hash = MqttTopicHash(prefix);
+  for (uint32_t i = 0; i < mqtt_topic_handler_count; i++) {
+    if ((mqtt_topic_handlers[i].hash == hash) && (mqtt_topic_handlers[i].handler == handler)) {
+      return;                                    // Idempotent - drivers re-register on every reconnect
+    }
+  }
+  if (mqtt_topic_handler_count < MQTT_TOPIC_HANDLERS_MAX) {
+    mqtt_topic_handlers[mqtt_topic_handler_count].hash = hash;
+    mqtt_topic_handlers[mqtt_topic_handler_count].handler = handler;
+    mqtt_topic_handler_count++;
+  }
+}
+
+bool MqttTopicHandlerDispatch(const char* topic) {
+  if (!mqtt_topic_handler_count) { return false; }
+  uint32_t hash = MqttTopicHash(topic);
+  for (uint32_t i = 0; i < mqtt_topic_handler_count; i++) {
+    if (mqtt_topic_handlers[i].hash == hash) {
+      if (mqtt_topic_handlers[i].handler()) { return true; }
+    }
+  }
+  return false;
+}
+
 void MqttSubscribe(const char *topic) {
   AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT D_SUBSCRIBE_TO " %s"), topic);
   MqttSubscribeLib(topic);
@@ -704,6 +939,8 @@ void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_
   // Publish <topic> payload string or binary when binary_length set with optional retained
   SHOW_FREE_MEM(PSTR("MqttPublishPayload"));
 
+  TRACE_BEGIN(TRACE_MQTT_PUBLISH);
+
   bool binary_data = (binary_length > 0);
   if (!binary_data) {
     binary_length = strlen(payload);
@@ -723,6 +960,11 @@ void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_
 #endif  // USE_TASMESH
     log_data_topic += topic;                             // stat/tasmota/STATUS2
   } else {
+#ifdef USE_MQTT_STORE_FORWARD
+    if (Settings->flag.mqtt_enabled && !MqttIsConnected()) {  // SetOption3 - Enable MQTT
+      MqttSfEnqueue(topic, payload, binary_length, retained);  // Park for replay after reconnect
+    }
+#endif  // USE_MQTT_STORE_FORWARD
     log_data_topic = F(D_LOG_RESULT);                    // RSL:
     char *command = strrchr(topic, '/');                 // If last part of topic it is always the command
     log_data_topic += (command == nullptr) ? topic : command +1;  // STATUS2
@@ -746,6 +988,8 @@ void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_
   if (Settings->ledstate &0x04) {
     TasmotaGlobal.blinks++;
   }
+
+  TRACE_END(TRACE_MQTT_PUBLISH);
 }
 
 void MqttPublishPayload(const char* topic, const char* payload) {
@@ -870,10 +1114,133 @@ void MqttPublishPayloadPrefixTopicRulesProcess_P(uint32_t prefix, const char* su
   MqttPublishPayloadPrefixTopicRulesProcess_P(prefix, subtopic, payload, false);
 }
 
+#ifdef USE_MQTT_TELE_CBOR
+/*********************************************************************************************\
+ * CBOR telemetry encoding (SetOption165)
+ *
+ * Converts the JSON response to CBOR in one pass at publish time and sends it binary on
+ * tele/STATE and tele/SENSOR. Drivers keep appending JSON and rules keep processing it,
+ * only the wire format changes. Maps and arrays use indefinite length encoding, numbers
+ * shrink to compact integers or single precision floats.
+\*********************************************************************************************/
+
+struct CborWriter {
+  uint8_t *buf;
+  uint32_t len;                          // May exceed size, checked once after conversion
+  uint32_t size;
+};
+
+void CborEmit(CborWriter *w, uint8_t b) {
+  if (w->len < w->size) { w->buf[w->len] = b; }
+  w->len++;
+}
+
+void CborHead(CborWriter *w, uint32_t major, uint32_t value) {
+  major <<= 5;
+  if (value < 24) {
+    CborEmit(w, major | value);
+  } else if (value < 256) {
+    CborEmit(w, major | 24);
+    CborEmit(w, value);
+  } else if (value < 65536) {
+    CborEmit(w, major | 25);
+    CborEmit(w, value >> 8);
+    CborEmit(w, value);
+  } else {
+    CborEmit(w, major | 26);
+    CborEmit(w, value >> 24);
+    CborEmit(w, value >> 16);
+    CborEmit(w, value >> 8);
+    CborEmit(w, value);
+  }
+}
+
+int CborToken(void *ctx, jsmn_stream_event_t event, char *value, size_t len, uint32_t depth) {
+  CborWriter *w = (CborWriter*)ctx;
+  switch (event) {
+    case JSMN_STREAM_OBJECT_START:
+      CborEmit(w, 0xBF);                 // Indefinite length map
+      break;
+    case JSMN_STREAM_ARRAY_START:
+      CborEmit(w, 0x9F);                 // Indefinite length array
+      break;
+    case JSMN_STREAM_OBJECT_END:
+    case JSMN_STREAM_ARRAY_END:
+      CborEmit(w, 0xFF);                 // Break
+      break;
+    case JSMN_STREAM_KEY:
+    case JSMN_STREAM_STRING:
+      json_unescape(value);
+      len = strlen(value);
+      CborHead(w, 3, len);               // Text string
+      for (uint32_t i = 0; i < len; i++) { CborEmit(w, value[i]); }
+      break;
+    case JSMN_STREAM_PRIMITIVE:
+      if (!strcmp_P(value, PSTR("true"))) {
+        CborEmit(w, 0xF5);
+      } else if (!strcmp_P(value, PSTR("false"))) {
+        CborEmit(w, 0xF4);
+      } else if (!strcmp_P(value, PSTR("null"))) {
+        CborEmit(w, 0xF6);
+      } else if (strchr(value, '.') || strchr(value, 'e') || strchr(value, 'E')) {
+        union { float f; uint32_t u; } fu;
+        fu.f = (float)CharToFloat(value);
+        CborEmit(w, 0xFA);               // Single precision float
+        CborEmit(w, fu.u >> 24);
+        CborEmit(w, fu.u >> 16);
+        CborEmit(w, fu.u >> 8);
+        CborEmit(w, fu.u);
+      } else {
+        int32_t v = atoi(value);
+        if ((v < 0) || ('-' == value[0])) {
+          CborHead(w, 1, -1 - v);        // Negative integer
+        } else {
+          CborHead(w, 0, strtoul(value, nullptr, 10));  // Unsigned integer keeping 32 bits
+        }
+      }
+      break;
+  }
+  return 0;
+}
+
+bool MqttPublishCbor(uint32_t prefix, const char* subtopic, bool retained) {
+  // Publish the JSON response as CBOR when SetOption165 is set and the target is
+  // tele/STATE or tele/SENSOR. Returns true when the publish has been taken over.
+  if (!Settings->flag6.mqtt_tele_cbor) { return false; }       // SetOption165
+  if (2 != (prefix & 3)) { return false; }                     // TELE only
+  char stemp[16];
+  strncpy_P(stemp, subtopic, sizeof(stemp));
+  stemp[sizeof(stemp) -1] = '\0';
+  if (strcasecmp_P(stemp, PSTR(D_RSLT_STATE)) && strcasecmp_P(stemp, PSTR(D_RSLT_SENSOR))) {
+    return false;
+  }
+
+  uint32_t size = ResponseLength() + 16;                       // CBOR is smaller except degenerate floats
+  uint8_t *cbor = (uint8_t*)malloc(size);
+  if (nullptr == cbor) { return false; }
+  CborWriter writer = { cbor, 0, size };
+  jsmn_stream_parser parser;
+  jsmn_stream_init(&parser, CborToken, &writer);
+  if (jsmn_stream_feed(&parser, ResponseData(), ResponseLength()) ||
+      jsmn_stream_end(&parser) ||
+      (writer.len > size)) {
+    free(cbor);
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "CBOR conversion failed"));
+    return false;                                              // Fall back to JSON publish
+  }
+  MqttPublishPayloadPrefixTopic_P(prefix, subtopic, (const char*)cbor, writer.len, retained);
+  free(cbor);
+  return true;
+}
+#endif  // USE_MQTT_TELE_CBOR
+
 void MqttPublishPrefixTopic_P(uint32_t prefix, const char* subtopic, bool retained) {
   // Publish <prefix>/<device>/<RESULT or <subtopic>> default ResponseData string with optional retained
   SHOW_FREE_MEM(PSTR("MqttPublishPrefixTopic_P"));
 
+#ifdef USE_MQTT_TELE_CBOR
+  if (MqttPublishCbor(prefix, subtopic, retained)) { return; }
+#endif  // USE_MQTT_TELE_CBOR
   MqttPublishPayloadPrefixTopic_P(prefix, subtopic, ResponseData(), 0, retained);
 }
 
@@ -2108,6 +2475,11 @@ bool Xdrv02(uint32_t function)
       case FUNC_EVERY_50_MSECOND:  // https://github.com/knolleary/pubsubclient/issues/556
         MqttClient.loop();
         break;
+#ifdef USE_MQTT_STORE_FORWARD
+      case FUNC_EVERY_100_MSECOND:
+        MqttSfDrain();
+        break;
+#endif  // USE_MQTT_STORE_FORWARD
 #ifdef USE_WEBSERVER
 #ifndef FIRMWARE_MINIMAL    // not needed in minimal/safeboot because of disabled feature and Settings are not saved anyways
       case FUNC_WEB_ADD_BUTTON:
@@ -94,6 +94,8 @@ typedef struct {
   float yesterday_sum;                          // 123.123 kWh
   float daily_sum_import_balanced;              // 123.123 kWh
   float daily_sum_export_balanced;              // 123.123 kWh
+  int64_t import_sum_balanced;                  // 12312312 Wh * 10^-2 (deca milli Watt hours) - integer accumulator behind daily_sum_import_balanced
+  int64_t export_sum_balanced;                  // 12312312 Wh * 10^-2 (deca milli Watt hours) - integer accumulator behind daily_sum_export_balanced
 
   int32_t kWhtoday_delta[ENERGY_MAX_PHASES];    // 1212312345 Wh 10^-5 (deca micro Watt hours) - Overflows to Energy->kWhtoday (HLW and CSE only)
   int32_t kWhtoday_offset[ENERGY_MAX_PHASES];   // 12312312 Wh * 10^-2 (deca milli Watt hours) - 5764 = 0.05764 kWh = 0.058 kWh = Energy->daily
@@ -124,12 +126,12 @@ typedef struct {
   uint16_t power_history[3][ENERGY_MAX_PHASES];
   uint8_t power_steady_counter;                 // Allow for power on stabilization
   uint8_t margin_stable;
-  bool min_power_flag;
-  bool max_power_flag;
-  bool min_voltage_flag;
-  bool max_voltage_flag;
-  bool min_current_flag;
-  bool max_current_flag;
+  uint8_t min_power_flags;                      // Margin state as one bit per phase
+  uint8_t max_power_flags;
+  uint8_t min_voltage_flags;
+  uint8_t max_voltage_flags;
+  uint8_t min_current_flags;
+  uint8_t max_current_flags;
 
 #ifdef USE_ENERGY_POWER_LIMIT
   uint16_t mpl_hold_counter;
@@ -304,10 +306,13 @@ void EnergyUpdateToday(void) {
   }
 
   if (delta_sum_balanced > 0) {
-    Energy->daily_sum_import_balanced += (float)delta_sum_balanced / 100000;
+    Energy->import_sum_balanced += delta_sum_balanced;
   } else {
-    Energy->daily_sum_export_balanced += (float)abs(delta_sum_balanced) / 100000;
+    Energy->export_sum_balanced += abs(delta_sum_balanced);
   }
+  // Convert at the presentation boundary only - accumulating in float absorbs the small deltas once the sum has grown
+  Energy->daily_sum_import_balanced = (float)Energy->import_sum_balanced / 100000;
+  Energy->daily_sum_export_balanced = (float)Energy->export_sum_balanced / 100000;
 
   if (RtcTime.valid){ // We calc the difference only if we have a valid RTC time.
 
@@ -431,6 +436,8 @@ void Energy200ms(void) {
 //        Energy->kWhtoday_delta = 0;                                 // dont zero this, we need to carry the remainder over to tomorrow
           Energy->daily_sum_import_balanced = 0.0;
           Energy->daily_sum_export_balanced = 0.0;
+          Energy->import_sum_balanced = 0;
+          Energy->export_sum_balanced = 0;
         }
         EnergyUpdateToday();
       }
@@ -462,18 +469,33 @@ void EnergySaveState(void) {
 }
 
 #ifdef USE_ENERGY_MARGIN_DETECTION
-bool EnergyMargin(bool type, uint16_t margin, uint16_t value, bool &flag, bool &save_flag) {
-  bool change;
-
+bool EnergyMarginPhases(bool type, uint16_t margin, const uint16_t *values, bool &flag, uint8_t &save_flags) {
   if (!margin) return false;
-  change = save_flag;
-  if (type) {
-    flag = (value > margin);
-  } else {
-    flag = (value < margin);
+  uint16_t band = margin >> 5;                  // Hysteresis of ~3% keeps a value hovering at the margin from re-firing every second
+  if (!band) { band = 1; }
+  uint8_t flags = save_flags;
+  for (uint32_t phase = 0; phase < Energy->phase_count; phase++) {
+    uint8_t mask = 1 << phase;
+    if (type) {
+      if (values[phase] > margin) {
+        flags |= mask;
+      }
+      else if ((int32_t)values[phase] <= (int32_t)margin - band) {
+        flags &= ~mask;
+      }
+    } else {
+      if (values[phase] < margin) {
+        flags |= mask;
+      }
+      else if ((int32_t)values[phase] >= (int32_t)margin + band) {
+        flags &= ~mask;
+      }
+    }
   }
-  save_flag = flag;
-  return (change != save_flag);
+  bool change = ((flags != 0) != (save_flags != 0));  // Report any-phase state to keep the Margins message format
+  save_flags = flags;
+  flag = (flags != 0);
+  return change;
 }
 
 void EnergyMarginCheck(void) {
@@ -533,33 +555,39 @@ void EnergyMarginCheck(void) {
   uint16_t energy_power_u = (uint16_t)(Energy->active_power[0]);
 
   if (Energy->power_on && (Settings->energy_min_power || Settings->energy_max_power || Settings->energy_min_voltage || Settings->energy_max_voltage || Settings->energy_min_current || Settings->energy_max_current)) {
-    uint16_t energy_voltage_u = (uint16_t)(Energy->voltage[0]);
-    uint16_t energy_current_u = (uint16_t)(Energy->current[0] * 1000);
+    uint16_t energy_powers_u[ENERGY_MAX_PHASES];
+    uint16_t energy_voltages_u[ENERGY_MAX_PHASES];
+    uint16_t energy_currents_u[ENERGY_MAX_PHASES];
+    for (uint32_t phase = 0; phase < Energy->phase_count; phase++) {
+      energy_powers_u[phase] = (uint16_t)(Energy->active_power[phase]);
+      energy_voltages_u[phase] = (uint16_t)(Energy->voltage[phase]);
+      energy_currents_u[phase] = (uint16_t)(Energy->current[phase] * 1000);
+    }
 
-    DEBUG_DRIVER_LOG(PSTR("NRG: W %d, U %d, I %d"), energy_power_u, energy_voltage_u, energy_current_u);
+    DEBUG_DRIVER_LOG(PSTR("NRG: W %d, U %d, I %d"), energy_powers_u[0], energy_voltages_u[0], energy_currents_u[0]);
 
     bool flag;
-    if (EnergyMargin(false, Settings->energy_min_power, energy_power_u, flag, Energy->min_power_flag)) {
+    if (EnergyMarginPhases(false, Settings->energy_min_power, energy_powers_u, flag, Energy->min_power_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_POWERLOW "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
-    if (EnergyMargin(true, Settings->energy_max_power, energy_power_u, flag, Energy->max_power_flag)) {
+    if (EnergyMarginPhases(true, Settings->energy_max_power, energy_powers_u, flag, Energy->max_power_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_POWERHIGH "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
-    if (EnergyMargin(false, Settings->energy_min_voltage, energy_voltage_u, flag, Energy->min_voltage_flag)) {
+    if (EnergyMarginPhases(false, Settings->energy_min_voltage, energy_voltages_u, flag, Energy->min_voltage_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_VOLTAGELOW "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
-    if (EnergyMargin(true, Settings->energy_max_voltage, energy_voltage_u, flag, Energy->max_voltage_flag)) {
+    if (EnergyMarginPhases(true, Settings->energy_max_voltage, energy_voltages_u, flag, Energy->max_voltage_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_VOLTAGEHIGH "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
-    if (EnergyMargin(false, Settings->energy_min_current, energy_current_u, flag, Energy->min_current_flag)) {
+    if (EnergyMarginPhases(false, Settings->energy_min_current, energy_currents_u, flag, Energy->min_current_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_CURRENTLOW "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
-    if (EnergyMargin(true, Settings->energy_max_current, energy_current_u, flag, Energy->max_current_flag)) {
+    if (EnergyMarginPhases(true, Settings->energy_max_current, energy_currents_u, flag, Energy->max_current_flags)) {
       ResponseAppend_P(PSTR("%s\"" D_CMND_CURRENTHIGH "\":\"%s\""), (jsonflg)?",":"", GetStateText(flag));
       jsonflg = true;
     }
@@ -1516,6 +1544,7 @@ bool Xdrv03(uint32_t function)
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         XnrgCall(FUNC_LOOP);
+        SleepRequestWake(1);             // Serial and IRQ paced energy monitors need service every millisecond
         break;
       case FUNC_EVERY_100_MSECOND:
       case FUNC_EVERY_250_MSECOND:
@@ -1543,6 +1572,11 @@ bool Xdrv03(uint32_t function)
       case FUNC_NETWORK_DOWN:
         XnrgCall(FUNC_NETWORK_DOWN);
         break;
+#ifdef USE_WEBSERVER
+      case FUNC_WEB_ADD_HANDLER:
+        XnrgCall(FUNC_WEB_ADD_HANDLER);
+        break;
+#endif  // USE_WEBSERVER
       case FUNC_ACTIVE:
         result = true;
         break;
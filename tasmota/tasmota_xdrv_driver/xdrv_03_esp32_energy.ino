@@ -43,6 +43,9 @@
 #define D_CMND_FREQUENCYCAL "FrequencyCal"
 #define D_CMND_TARIFF "Tariff"
 #define D_CMND_MODULEADDRESS "ModuleAddress"
+#ifdef USE_ENERGY_HISTORY
+#define D_CMND_ENERGYHISTORY "EnergyHistory"
+#endif  // USE_ENERGY_HISTORY
 
 enum EnergyDisplayModes {
   ENERGY_DISPLAY_MIN_OPTION,
@@ -63,7 +66,11 @@ const char kEnergyCommands[] PROGMEM = "|"  // No prefix
   D_CMND_MAXENERGY "|" D_CMND_MAXENERGYSTART "|"
   D_CMND_MAXPOWER "|" D_CMND_MAXPOWERHOLD "|" D_CMND_MAXPOWERWINDOW "|"
   D_CMND_ENERGYTODAY "|" D_CMND_ENERGYYESTERDAY "|" D_CMND_ENERGYTOTAL "|" D_CMND_ENERGYEXPORTACTIVE "|" D_CMND_ENERGYUSAGE "|" D_CMND_ENERGYEXPORT "|"
-  D_CMND_TARIFF "|" D_CMND_ENERGYDISPLAY "|" D_CMND_ENERGYCOLS ;
+  D_CMND_TARIFF "|" D_CMND_ENERGYDISPLAY "|" D_CMND_ENERGYCOLS
+#ifdef USE_ENERGY_HISTORY
+  "|" D_CMND_ENERGYHISTORY
+#endif  // USE_ENERGY_HISTORY
+  ;
 
 void (* const EnergyCommand[])(void) PROGMEM = {
   &CmndPowerCal, &CmndVoltageCal, &CmndCurrentCal, &CmndFrequencyCal,
@@ -72,7 +79,11 @@ void (* const EnergyCommand[])(void) PROGMEM = {
   &CmndMaxEnergy, &CmndMaxEnergyStart,
   &CmndMaxPower, &CmndMaxPowerHold, &CmndMaxPowerWindow,
   &CmndEnergyToday, &CmndEnergyYesterday, &CmndEnergyTotal, &CmndEnergyExportActive, &CmndEnergyUsage, &CmndEnergyExport,
-  &CmndTariff, &CmndEnergyDisplay, &CmndEnergyCols };
+  &CmndTariff, &CmndEnergyDisplay, &CmndEnergyCols
+#ifdef USE_ENERGY_HISTORY
+  , &CmndEnergyHistory
+#endif  // USE_ENERGY_HISTORY
+  };
 
 /********************************************************************************************/
 
@@ -171,6 +182,7 @@ typedef struct {
 
   int32_t kWhtoday_delta[ENERGY_MAX_PHASES];    // 1212312345 Wh 10^-5 (deca micro Watt hours) - Overflows to Energy->kWhtoday (HLW and CSE only)
   int32_t kWhtoday[ENERGY_MAX_PHASES];          // 12312312 Wh * 10^-2 (deca milli Watt hours) - 5764 = 0.05764 kWh = 0.058 kWh = Energy->daily
+  int32_t kWhtoday_export[ENERGY_MAX_PHASES];   // 12312312 Wh * 10^-2 (deca milli Watt hours) - export pending flush in whole Wh to energy_export_kWh
 
   // Local only
   char* value;
@@ -180,6 +192,8 @@ typedef struct {
   float period_kWh[ENERGY_MAX_PHASES];          // 123.12312 kWh = Energy->daily
   float daily_sum_import_balanced;              // 123.123 kWh
   float daily_sum_export_balanced;              // 123.123 kWh
+  int64_t import_sum_balanced;                  // 12312312 Wh * 10^-2 (deca milli Watt hours) - integer accumulator behind daily_sum_import_balanced
+  int64_t export_sum_balanced;                  // 12312312 Wh * 10^-2 (deca milli Watt hours) - integer accumulator behind daily_sum_export_balanced
 
   uint16_t power_history[3][ENERGY_MAX_PHASES];
   uint16_t mpl_hold_counter[ENERGY_MAX_PHASES];
@@ -547,7 +561,12 @@ void EnergyUpdateToday(void) {
         Energy->kWhtoday[i] += delta;
       }
       if (delta < 0) {     // Export energy
-        RtcEnergySettings.energy_export_kWh[i] += (((float)delta / 100) *-1) / 1000;
+        Energy->kWhtoday_export[i] += (delta *-1);
+        if (Energy->kWhtoday_export[i] > 100) {
+          int32_t delta_export = Energy->kWhtoday_export[i] / 100;   // Whole Wh - adding the raw deca milli Watt hour quanta to the float would absorb them on grown totals
+          Energy->kWhtoday_export[i] -= (delta_export * 100);
+          RtcEnergySettings.energy_export_kWh[i] += (float)delta_export / 1000;
+        }
       }
     }
 
@@ -564,10 +583,13 @@ void EnergyUpdateToday(void) {
   }
 
   if (delta_sum_balanced > 0) {
-    Energy->daily_sum_import_balanced += (float)delta_sum_balanced / 100000;
+    Energy->import_sum_balanced += delta_sum_balanced;
   } else {
-    Energy->daily_sum_export_balanced += (float)abs(delta_sum_balanced) / 100000;
+    Energy->export_sum_balanced += abs(delta_sum_balanced);
   }
+  // Convert at the presentation boundary only - accumulating in float absorbs the small deltas once the sum has grown
+  Energy->daily_sum_import_balanced = (float)Energy->import_sum_balanced / 100000;
+  Energy->daily_sum_export_balanced = (float)Energy->export_sum_balanced / 100000;
 
   if (RtcTime.valid){ // We calc the difference only if we have a valid RTC time.
 
@@ -686,6 +708,8 @@ void Energy200ms(void) {
 //        Energy->kWhtoday_delta = 0;                                 // dont zero this, we need to carry the remainder over to tomorrow
           Energy->daily_sum_import_balanced = 0.0;
           Energy->daily_sum_export_balanced = 0.0;
+          Energy->import_sum_balanced = 0;
+          Energy->export_sum_balanced = 0;
         }
         EnergyUpdateToday();
       }
@@ -724,11 +748,24 @@ void EnergySaveState(void) {
 
 bool EnergyMargin(bool type, uint16_t margin, uint16_t value, bool &flag, bool &save_flag) {
   if (!margin) { return false; }
+  uint16_t band = margin >> 5;                   // Hysteresis of ~3% keeps a value hovering at the margin from re-firing every second
+  if (!band) { band = 1; }
   bool change = save_flag;
+  flag = save_flag;
   if (type) {
-    flag = (value > margin);
+    if (value > margin) {
+      flag = true;
+    }
+    else if ((int32_t)value <= (int32_t)margin - band) {
+      flag = false;
+    }
   } else {
-    flag = (value < margin);
+    if (value < margin) {
+      flag = true;
+    }
+    else if ((int32_t)value >= (int32_t)margin + band) {
+      flag = false;
+    }
   }
   save_flag = flag;
   return (change != save_flag);
@@ -991,6 +1028,10 @@ void EnergyEverySecond(void) {
       EnergyMqttShow();
     }
   }
+
+#ifdef USE_ENERGY_HISTORY
+  EnergyHistoryEverySecond();
+#endif  // USE_ENERGY_HISTORY
 }
 
 /*********************************************************************************************\
@@ -1506,6 +1547,163 @@ void CmndMaxEnergyStart(void) {
   ResponseCmndIdxEnergyMargin(&Energy->Settings.phase[0].max_energy_start, 23);
 }
 
+#ifdef USE_ENERGY_HISTORY
+/*********************************************************************************************\
+ * Energy history - tiered on-device ring of power/voltage/current per phase
+ *
+ * Three rings with multi-resolution downsampling, preferably in PSRAM:
+ *   Tier 1 - 1 second samples for the last hour
+ *   Tier 2 - 1 minute averages for the last day
+ *   Tier 3 - 15 minute averages for the last 30 days
+ * Read out in pages with command EnergyHistory<tier> <page>[,<phase>] so graphing
+ * clients can backfill locally instead of relying on full-rate telemetry
+\*********************************************************************************************/
+
+#define ENERGY_HISTORY_TIER0_SIZE   3600   // Slots of 1 second - last hour
+#define ENERGY_HISTORY_TIER1_SIZE   1440   // Slots of 1 minute - last day
+#define ENERGY_HISTORY_TIER2_SIZE   2880   // Slots of 15 minutes - last 30 days
+#define ENERGY_HISTORY_TIER1_RATIO  60     // Tier 1 slots per tier 2 slot
+#define ENERGY_HISTORY_TIER2_RATIO  15     // Tier 2 slots per tier 3 slot
+#define ENERGY_HISTORY_PAGE         48     // Samples per EnergyHistory read-out page
+
+typedef struct {
+  int16_t  power;                          // Active power in W, signed for export
+  uint16_t voltage;                        // Voltage in dV (0.1 V)
+  uint16_t current;                        // Current in cA (0.01 A)
+} tEnergyHistorySample;
+
+struct {
+  tEnergyHistorySample *tier[3];           // Ring buffers, one sample per phase per slot
+  uint32_t head[3];                        // Free running count of slots written per tier
+  uint8_t phases;                          // Number of phases allocated
+} EnergyHistory;
+
+const uint16_t kEnergyHistorySizes[3] = { ENERGY_HISTORY_TIER0_SIZE, ENERGY_HISTORY_TIER1_SIZE, ENERGY_HISTORY_TIER2_SIZE };
+const uint16_t kEnergyHistoryPeriods[3] = { 1, 60, 900 };   // Slot duration in seconds per tier
+
+tEnergyHistorySample * EnergyHistorySlot(uint32_t tier, uint32_t slot) {
+  return &EnergyHistory.tier[tier][(slot % kEnergyHistorySizes[tier]) * EnergyHistory.phases];
+}
+
+int16_t EnergyHistoryPower(float value) {
+  if (isnan(value)) { return 0; }
+  if (value > 32767) { return 32767; }
+  if (value < -32768) { return -32768; }
+  return (int16_t)value;
+}
+
+uint16_t EnergyHistoryUnsigned(float value) {
+  if (isnan(value) || (value <= 0)) { return 0; }
+  if (value > 65535) { return 65535; }
+  return (uint16_t)value;
+}
+
+void EnergyHistoryInit(void) {
+  EnergyHistory.phases = Energy->phase_count;
+  uint32_t bytes = 0;
+  for (uint32_t tier = 0; tier < 3; tier++) {
+    EnergyHistory.tier[tier] = (tEnergyHistorySample*)special_calloc(kEnergyHistorySizes[tier] * EnergyHistory.phases, sizeof(tEnergyHistorySample));
+    if (nullptr == EnergyHistory.tier[tier]) {
+      while (tier--) {
+        free(EnergyHistory.tier[tier]);
+        EnergyHistory.tier[tier] = nullptr;
+      }
+      AddLog(LOG_LEVEL_INFO, PSTR("NRG: No memory for energy history"));
+      return;
+    }
+    bytes += kEnergyHistorySizes[tier] * EnergyHistory.phases * sizeof(tEnergyHistorySample);
+  }
+  AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Energy history %d phases using %d bytes"), EnergyHistory.phases, bytes);
+}
+
+// Average the last `count` slots of the previous tier into the next slot of `tier`
+void EnergyHistoryDownsample(uint32_t tier, uint32_t count) {
+  tEnergyHistorySample *dest = EnergyHistorySlot(tier, EnergyHistory.head[tier]);
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    int32_t power = 0;
+    uint32_t voltage = 0;
+    uint32_t current = 0;
+    for (uint32_t slot = 0; slot < count; slot++) {
+      tEnergyHistorySample *src = EnergyHistorySlot(tier -1, EnergyHistory.head[tier -1] - count + slot);
+      power += src[i].power;
+      voltage += src[i].voltage;
+      current += src[i].current;
+    }
+    dest[i].power = power / (int32_t)count;
+    dest[i].voltage = voltage / count;
+    dest[i].current = current / count;
+  }
+  EnergyHistory.head[tier]++;
+}
+
+void EnergyHistoryEverySecond(void) {
+  if (nullptr == EnergyHistory.tier[0]) { return; }
+
+  tEnergyHistorySample *slot = EnergyHistorySlot(0, EnergyHistory.head[0]);
+  for (uint32_t i = 0; i < EnergyHistory.phases; i++) {
+    slot[i].power = EnergyHistoryPower(Energy->active_power[i]);
+    slot[i].voltage = EnergyHistoryUnsigned(Energy->voltage[i] * 10);    // dV
+    slot[i].current = EnergyHistoryUnsigned(Energy->current[i] * 100);   // cA
+  }
+  EnergyHistory.head[0]++;
+
+  if (0 == (EnergyHistory.head[0] % ENERGY_HISTORY_TIER1_RATIO)) {
+    EnergyHistoryDownsample(1, ENERGY_HISTORY_TIER1_RATIO);
+    if (0 == (EnergyHistory.head[1] % ENERGY_HISTORY_TIER2_RATIO)) {
+      EnergyHistoryDownsample(2, ENERGY_HISTORY_TIER2_RATIO);
+    }
+  }
+}
+
+void CmndEnergyHistory(void) {
+  // EnergyHistory<tier> <page>[,<phase>] - Read out one page of history samples
+  //   tier  1..3 - resolution tier (1s / 1min / 15min)
+  //   page  0..n - page of ENERGY_HISTORY_PAGE samples, 0 = most recent
+  //   phase 1..8 - phase to read, default 1
+  // Response units: Power W, Voltage dV, Current cA. Head is the free running
+  // slot count, Start the absolute slot number of the first returned sample,
+  // so a client can page backwards until it reaches its last synced slot.
+  if ((XdrvMailbox.index < 1) || (XdrvMailbox.index > 3)) { return; }
+  uint32_t tier = XdrvMailbox.index -1;
+  if (nullptr == EnergyHistory.tier[tier]) {
+    ResponseCmndChar(PSTR("No history"));
+    return;
+  }
+  uint32_t values[2] = { 0, 0 };
+  uint32_t count = ParseParameters(2, values);
+  uint32_t page = (count >= 1) ? values[0] : 0;
+  uint32_t phase = 0;
+  if ((count >= 2) && (values[1] >= 1) && (values[1] <= EnergyHistory.phases)) {
+    phase = values[1] -1;
+  }
+
+  uint32_t head = EnergyHistory.head[tier];
+  uint32_t available = (head < kEnergyHistorySizes[tier]) ? head : kEnergyHistorySizes[tier];
+  uint32_t offset = page * ENERGY_HISTORY_PAGE;      // Samples to skip from the newest backwards
+  uint32_t samples = 0;
+  if (offset < available) {
+    samples = available - offset;
+    if (samples > ENERGY_HISTORY_PAGE) { samples = ENERGY_HISTORY_PAGE; }
+  }
+  uint32_t start = head - offset - samples;
+
+  Response_P(PSTR("{\"%s%d\":{\"Period\":%d,\"Phase\":%d,\"Head\":%u,\"Start\":%u,\"Power\":["),
+    XdrvMailbox.command, XdrvMailbox.index, kEnergyHistoryPeriods[tier], phase +1, head, start);
+  for (uint32_t i = 0; i < samples; i++) {
+    ResponseAppend_P(PSTR("%s%d"), (i) ? "," : "", EnergyHistorySlot(tier, start + i)[phase].power);
+  }
+  ResponseAppend_P(PSTR("],\"Voltage\":["));
+  for (uint32_t i = 0; i < samples; i++) {
+    ResponseAppend_P(PSTR("%s%d"), (i) ? "," : "", EnergyHistorySlot(tier, start + i)[phase].voltage);
+  }
+  ResponseAppend_P(PSTR("],\"Current\":["));
+  for (uint32_t i = 0; i < samples; i++) {
+    ResponseAppend_P(PSTR("%s%d"), (i) ? "," : "", EnergyHistorySlot(tier, start + i)[phase].current);
+  }
+  ResponseAppend_P(PSTR("]}}"));
+}
+#endif  // USE_ENERGY_HISTORY
+
 /********************************************************************************************/
 
 void EnergyDrvInit(void) {
@@ -1566,6 +1764,9 @@ void EnergySnsInit(void) {
       }
     }
     EnergyUpdateToday();
+#ifdef USE_ENERGY_HISTORY
+    EnergyHistoryInit();
+#endif  // USE_ENERGY_HISTORY
     ticker_energy.attach_ms(200, Energy200ms);
   }
 }
@@ -1918,6 +2119,7 @@ bool Xdrv03(uint32_t function)
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         XnrgCall(FUNC_LOOP);
+        SleepRequestWake(1);             // Serial and IRQ paced energy monitors need service every millisecond
         break;
       case FUNC_EVERY_100_MSECOND:
       case FUNC_EVERY_250_MSECOND:
@@ -1953,6 +2155,11 @@ bool Xdrv03(uint32_t function)
       case FUNC_NETWORK_DOWN:
         XnrgCall(FUNC_NETWORK_DOWN);
         break;
+#ifdef USE_WEBSERVER
+      case FUNC_WEB_ADD_HANDLER:
+        XnrgCall(FUNC_WEB_ADD_HANDLER);
+        break;
+#endif  // USE_WEBSERVER
       case FUNC_ACTIVE:
         result = true;
         break;
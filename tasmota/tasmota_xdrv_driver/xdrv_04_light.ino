@@ -130,6 +130,10 @@
 #define XDRV_04              4
 // #define DEBUG_LIGHT
 
+#ifndef CUSTOM_GAMMA_POINTS
+#define CUSTOM_GAMMA_POINTS 8        // max DimmerCurve breakpoints, see xdrv_04_light_utils.ino
+#endif
+
 #ifdef USE_NETWORK_LIGHT_SCHEMES
 enum LightSchemes { LS_POWER, LS_WAKEUP, LS_CYCLEUP, LS_CYCLEDN, LS_RANDOM, LS_DDP, LS_MAX };
 #else
@@ -159,6 +163,7 @@ const char kLightCommands[] PROGMEM = "|"  // No prefix
 #ifdef USE_LIGHT_ARTNET
   "|" D_CMND_ARTNET "|" D_CMND_ARTNET_CONFIG
 #endif
+  "|DimmerCurve"
    "|UNDOCA" ;
 
 SO_SYNONYMS(kLightSynonyms,
@@ -183,6 +188,7 @@ void (* const LightCommand[])(void) PROGMEM = {
 #ifdef USE_LIGHT_ARTNET
   &CmndArtNet, &CmndArtNetConfig,
 #endif
+  &CmndDimmerCurve,
   &CmndUndocA };
 
 // Light color mode, either RGB alone, or white-CT alone, or both only available if ct_rgb_linked is false
@@ -252,6 +258,9 @@ struct LIGHT {
 
   bool     fade_initialized = false;      // dont't fade at startup
   bool     fade_running = false;
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+  bool     fade_hw = false;               // fade is ramping autonomously in the LEDC hardware
+#endif  // USE_LIGHT_HW_FADE
 #ifdef USE_DEVICE_GROUPS
   uint8_t  last_dgr_scheme = 0;
   bool     devgrp_no_channels_out = false; // don't share channels with device group (e.g. if scheme set by other device)
@@ -1959,6 +1968,9 @@ void LightAnimate(void)
       if (!LightGetFadeSetting() || TasmotaGlobal.skip_light_fade || power_off || (!Light.fade_initialized)) { // no fade
         // record the current value for a future Fade
         memcpy(Light.fade_start_10, cur_col_10, sizeof(Light.fade_start_10));
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+        LightHwFadeStop();    // release the LEDC fade engine before writing duties directly
+#endif  // USE_LIGHT_HW_FADE
         // push the final values at 8 and 10 bits resolution to the PWMs
         LightSetOutputs(cur_col_10);
         LightStopFade();
@@ -2070,7 +2082,47 @@ uint8_t LightGetCurFadeBri(void) {
   return max_bri;
 }
 
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+// Abort any fade still ramping in the LEDC hardware and freeze the duty at its current value
+void LightHwFadeStop(void) {
+  if (Light.fade_hw) {
+    PwmFadeStopGPIO(Light.subtype - Light.pwm_offset);
+    Light.fade_hw = false;
+  }
+}
+
+// Try to hand the fade over to the LEDC hardware fade engine, targetting `fade_end_10`
+// over `fade_duration` milliseconds. Returns `true` if the hardware now runs the fade,
+// `false` if this light must be stepped in software (non-PWM light, zero-cross dimmer,
+// PWM Dimmer brightness leds, or LEDC without fade-stop support).
+bool LightHwFadeStart(void) {
+  if (TasmotaGlobal.light_type >= LT_PWM6) { return false; }   // only for direct PWM lights, not for Tuya, Armtronix...
+  if (Settings->flag4.zerocross_dimmer) { return false; }
+#ifdef USE_PWM_DIMMER
+  if (PWM_DIMMER == TasmotaGlobal.module_type) { return false; }   // keep software steps so the brightness leds follow the fade
+#ifdef USE_I2C
+  if (TasmotaGlobal.gpio_optiona.linkind_support) { return false; }   // Option_A6, duty is pushed over I2C
+#endif  // USE_I2C
+#endif  // USE_PWM_DIMMER
+
+  int32_t channel_ct = ChannelCT();  // Channel for PWM CT or -1 if no CT or regular CT
+  uint16_t duty[LST_MAX];
+  uint32_t channels = Light.subtype - Light.pwm_offset;
+  for (uint32_t i = 0; i < channels; i++) {
+    uint16_t cur_col = Light.fade_end_10[i + Light.pwm_offset];
+    if (i != channel_ct) {   // if CT don't use pwm_min and pwm_max
+      cur_col = cur_col > 0 ? changeUIntScale(cur_col, 0, Settings->pwm_range, Light.pwm_min, Light.pwm_max) : 0;   // shrink to the range of pwm_min..pwm_max
+    }
+    duty[i] = cur_col;
+  }
+  return PwmFadeGPIO(duty, channels, Light.fade_duration);
+}
+#endif  // USE_LIGHT_HW_FADE
+
 void LightStopFade(void) {
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+  LightHwFadeStop();
+#endif  // USE_LIGHT_HW_FADE
   Light.fade_running = false;
 #ifdef USE_PWM_DIMMER
   // If the power is off and the fade is done, turn the relay off.
@@ -2114,6 +2166,12 @@ bool LightApplyFade(void) {   // did the value chanegd and needs to be applied
           TasmotaGlobal.save_data_counter = delay_seconds;      // pospone
         }
       }
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+      // Offload the fade to the LEDC hardware when possible: target duty and duration are
+      // programmed once and the peripheral ramps autonomously. Software keeps tracking
+      // `fade_cur_10` below so status and a restarted fade start from the right values.
+      Light.fade_hw = LightHwFadeStart();
+#endif  // USE_LIGHT_HW_FADE
     } else {
       // no fade needed, we keep the duration at zero, it will fallback directly to end of fade
       LightStopFade();
@@ -2133,6 +2191,9 @@ bool LightApplyFade(void) {   // did the value chanegd and needs to be applied
       //                                        0, Light.fade_duration,
       //                                        Light.fade_start_10[i], Light.fade_end_10[i]);
     }
+#if defined(ESP32) && defined(USE_LIGHT_HW_FADE)
+    if (Light.fade_hw) { return false; }    // the hardware is ramping the duty, don't write over it
+#endif  // USE_LIGHT_HW_FADE
   } else {
     // stop fade
 //AddLop_P2(LOG_LEVEL_DEBUG, PSTR("Stop fade"));
@@ -3106,6 +3167,41 @@ void CmndDimmerRange(void)
   Response_P(PSTR("{\"" D_CMND_DIMMER_RANGE "\":{\"Min\":%d,\"Max\":%d}}"), Settings->dimmer_hw_min, Settings->dimmer_hw_max);
 }
 
+void CmndDimmerCurve(void)
+{
+  // DimmerCurve                          - Show the active dimming curve breakpoints
+  // DimmerCurve 0                        - Revert to the built-in gamma curve
+  // DimmerCurve 30,8,512,200,1023,1023   - Install custom breakpoints as (in,out) pairs, 10 bits each
+  //                                        The curve is compiled into segment slopes at set time and
+  //                                        replaces both the gamma and the fast fade curve.
+  //                                        A non-zero first out value is a low-end anti-flicker floor.
+  // Not persisted; use a boot time rule to reinstall the curve after restart
+  if (XdrvMailbox.data_len > 0) {
+    uint32_t parm[2 * CUSTOM_GAMMA_POINTS] = { 0 };
+    uint32_t parsed = ParseParameters(2 * CUSTOM_GAMMA_POINTS, parm);
+    if ((1 == parsed) && (0 == parm[0])) {
+      ledGammaSetCustomTable(nullptr, 0);
+    } else if ((parsed < 2) || (parsed & 1) || !ledGammaSetCustomTable(parm, parsed / 2)) {
+      ResponseCmndChar_P(PSTR("Invalid curve"));
+      return;
+    }
+    LightCalcPWMRange();
+    Light.update = true;
+  }
+  uint32_t count = ledGammaCustomCount();
+  if (count) {
+    Response_P(PSTR("{\"DimmerCurve\":["));
+    for (uint32_t i = 0; i < count; i++) {
+      uint16_t src, out;
+      ledGammaCustomPoint(i, &src, &out);
+      ResponseAppend_P(PSTR("%s[%d,%d]"), (i) ? "," : "", src, out);
+    }
+    ResponseAppend_P(PSTR("]}"));
+  } else {
+    Response_P(PSTR("{\"DimmerCurve\":\"Gamma\"}"));
+  }
+}
+
 void CmndDimmerStep(void)
 {
   // DimmerStep       - Show current dimmer step as used by Dimmer +/-
@@ -3445,6 +3541,7 @@ bool Xdrv04(uint32_t function)
             LightSetOutputs(Light.fade_cur_10);
           }
         }
+        XlgtCall(FUNC_LOOP);
 #ifdef USE_LIGHT_ARTNET
         ArtNetLoop();
 #endif // USE_LIGHT_ARTNET
@@ -37,6 +37,11 @@
 #define WS2812_ARTNET_MAX_SLEEP     5     // sleep at most 5ms
 #endif
 
+#ifndef WS2812_ARTNET_PACKET_BUDGET
+#define WS2812_ARTNET_PACKET_BUDGET 60    // Max packets per service pass (two full 30-row frames),
+                                          // so a sender storm cannot starve the main loop
+#endif
+
 typedef struct {
   uint8_t rows = 1;     // number of rows (min:1)
   uint8_t cols = 0;     // number of columns (if cols == 0 then apply to the entire light)
@@ -50,10 +55,12 @@ typedef struct {
   // metrics
   uint32_t packet_received = 0;
   uint32_t packet_accepted = 0;
+  uint32_t packet_stale = 0;    // packets dropped because an equal or newer sequence was already shown
   uint32_t strip_refresh = 0;
 } ArtNetConfig;
 
 uint32_t * packets_per_row = nullptr;
+uint8_t * artnet_seq = nullptr;     // last ArtDMX sequence number seen per universe (row)
 
 ArtNetConfig artnet_conf;
 
@@ -122,6 +129,42 @@ bool ArtNetSetChannels(void)
   return false;
 }
 
+// ArtDMX sequence field: latest-frame-wins policy
+// Returns true if this frame is older than one already processed for this universe,
+// sequence 0 means the controller disabled sequencing
+bool ArtNetStaleSeq(uint16_t row, uint8_t seq) {
+  if ((artnet_seq == nullptr) || (0 == seq)) { return false; }
+  if (artnet_seq[row] && ((int8_t)(seq - artnet_seq[row]) <= 0)) {
+    artnet_conf.packet_stale++;
+    return true;
+  }
+  artnet_seq[row] = seq;
+  return false;
+}
+
+// reverse pixel order (for alternate rows) and apply dimmer, in place
+// `data` may point directly into the strip framebuffer
+void ArtNetPostProcessRow(uint8_t * data, size_t datalen, size_t pix_size, bool reverse) {
+  if (reverse) {
+    for (int32_t i = 0, j = datalen - pix_size; i < j; i += pix_size, j -= pix_size) {
+      for (int32_t k = 0; k < pix_size; k++) {
+        uint8_t temp = data[i+k];
+        data[i+k] = data[j+k];
+        data[j+k] = temp;
+      }
+    }
+  }
+  // process dimmer
+  if (artnet_conf.dimm != 100) {
+    // No Gamma for now
+    for (int32_t i = 0; i < datalen; i += pix_size) {
+      for (int32_t k = 0; k < pix_size; k++) {
+        data[i+k] = changeUIntScale(data[i+k], 0, 100, 0, artnet_conf.dimm);
+      }
+    }
+  }
+}
+
 // process ArtNet packet
 // returns `true` if strip is dirty, i.e. we changed the value of some leds
 void ArtNetProcessPacket(uint8_t * buf, size_t len) {
@@ -146,6 +189,7 @@ void ArtNetProcessPacket(uint8_t * buf, size_t len) {
   if (universe < artnet_conf.univ || universe >= artnet_conf.univ + artnet_conf.rows) { return; }  // universe is not ours, ignore
   size_t idx = 18;      // start of payload data in the UDP frame
   uint16_t row = universe - artnet_conf.univ;
+  if (ArtNetStaleSeq(row, buf[12])) { return; }  // an equal or newer frame was already shown for this universe
 
   if (artnet_conf.matrix) {
     // Ws2812 led strip
@@ -156,35 +200,11 @@ void ArtNetProcessPacket(uint8_t * buf, size_t len) {
     datalen = datalen - (datalen % pix_size);
 
     size_t offset_in_matrix = 0;
-    if (artnet_conf.alt && (row % 2)) {
-      for (int32_t i = idx, j = idx + datalen - pix_size; i < j; i += pix_size, j -= pix_size) {
-          for (int32_t k = 0; k < pix_size; k++) {
-              uint8_t temp = buf[i+k];
-              buf[i+k] = buf[j+k];
-              buf[j+k] = temp;
-          }
-      }
+    bool reverse = (artnet_conf.alt && (row % 2));
+    if (reverse) {
       offset_in_matrix = artnet_conf.cols * pix_size - datalen; // add a potential offset if the frame is smaller than the columns
     }
-
-    // process dimmer
-    if (artnet_conf.dimm != 100) {
-      // No Gamma for now
-      if (pix_size == 3) {
-        for (int32_t i = idx; i < idx+datalen; i += pix_size) {
-          buf[i] = changeUIntScale(buf[i], 0, 100, 0, artnet_conf.dimm);
-          buf[i+1] = changeUIntScale(buf[i+1], 0, 100, 0, artnet_conf.dimm);
-          buf[i+2] = changeUIntScale(buf[i+2], 0, 100, 0, artnet_conf.dimm);
-        }
-      } else if (pix_size == 4) {
-        for (int32_t i = idx; i < idx+datalen; i += pix_size) {
-          buf[i] = changeUIntScale(buf[i], 0, 100, 0, artnet_conf.dimm);
-          buf[i+1] = changeUIntScale(buf[i+1], 0, 100, 0, artnet_conf.dimm);
-          buf[i+2] = changeUIntScale(buf[i+2], 0, 100, 0, artnet_conf.dimm);
-          buf[i+3] = changeUIntScale(buf[i+2], 0, 100, 0, artnet_conf.dimm);
-        }
-      }
-    }
+    ArtNetPostProcessRow(&buf[idx], datalen, pix_size, reverse);
 
     // process pixels
     size_t h_bytes = artnet_conf.cols * pix_size;   // size in bytes of a single row
@@ -222,6 +242,62 @@ void ArtNetProcessPacket(uint8_t * buf, size_t len) {
   }
 }
 
+#ifdef ESP32
+// Parse the ArtDMX header from the UDP stream and read the payload straight into the
+// strip framebuffer at the row offset, skipping the intermediate packet buffer.
+// Returns with the current UDP packet consumed.
+void ArtNetReceiveDirect(int32_t packet_len) {
+  artnet_conf.packet_received++;
+  uint8_t hdr[18];
+  if ((packet_len <= 18) || (ArtNetUdp->read(hdr, sizeof(hdr)) != sizeof(hdr))) {
+    ArtNetUdp->flush();
+    return;
+  }
+  static const char ARTNET_SIG[] = "Art-Net";
+  uint16_t opcode = hdr[8] | (hdr[9] << 8);
+  uint16_t protocol = (hdr[10] << 8) | hdr[11];   // Big Endian
+  uint16_t universe = hdr[14] | (hdr[15] << 8);
+  int32_t datalen = (hdr[16] << 8) | hdr[17];
+  if (memcmp(hdr, ARTNET_SIG, sizeof(ARTNET_SIG)) || (opcode != 0x5000) || (protocol != 14) ||
+      (universe < artnet_conf.univ) || (universe >= artnet_conf.univ + artnet_conf.rows)) {
+    ArtNetUdp->flush();
+    return;
+  }
+  uint16_t row = universe - artnet_conf.univ;
+  if (ArtNetStaleSeq(row, hdr[12])) {  // an equal or newer frame was already shown for this universe
+    ArtNetUdp->flush();
+    return;
+  }
+
+  size_t pix_size = Ws2812StripGetPixelSize();
+  if (datalen > packet_len - 18) { datalen = packet_len - 18; }   // truncated packet
+  if (datalen > artnet_conf.cols * pix_size) { datalen = artnet_conf.cols * pix_size; }
+  datalen = datalen - (datalen % pix_size);    // round to exact number of pixels
+
+  size_t h_bytes = artnet_conf.cols * pix_size;   // size in bytes of a single row
+  bool reverse = (artnet_conf.alt && (row % 2));
+  size_t offset_in_matrix = artnet_conf.offs * pix_size + row * h_bytes;
+  if (reverse) {
+    offset_in_matrix += h_bytes - datalen;      // add a potential offset if the frame is smaller than the columns
+  }
+  if ((datalen <= 0) || (offset_in_matrix + datalen > Ws2812StripGetPixelCount() * pix_size)) {
+    ArtNetUdp->flush();
+    return;
+  }
+  uint8_t * dest = Ws2812StripPixels() + offset_in_matrix;
+  int32_t read_len = ArtNetUdp->read(dest, datalen);
+  ArtNetUdp->flush();
+  if (read_len != datalen) { return; }          // short read, next frame overwrites the row anyway
+  ArtNetPostProcessRow(dest, datalen, pix_size, reverse);
+  Ws2812StripDirty();
+
+  artnet_conf.packet_accepted++;
+  if (packets_per_row) {
+    packets_per_row[row]++;
+  }
+}
+#endif  // ESP32
+
 //
 // Called at event loop, checks for incoming data from the CC2530
 //
@@ -231,6 +307,7 @@ void ArtNetLoop(void)
     ArtNetLoadSettings();
     bool packet_ready = false;
     int32_t packet_len = 0;
+    uint32_t packet_budget = WS2812_ARTNET_PACKET_BUDGET;
 #ifdef ESP8266
     packet_ready = ArtNetUdp->next();
     while (packet_ready) {
@@ -242,13 +319,19 @@ void ArtNetLoop(void)
     packet_len = ArtNetUdp->parsePacket();
     packet_ready = (packet_len > 0);
     while (packet_ready) {
-      uint8_t packet_buffer[WS2812_ARTNET_UDP_BUFFER_SIZE];     // buffer to hold incoming UDP/SSDP packet
-
-      packet_len = ArtNetUdp->read(packet_buffer, WS2812_ARTNET_UDP_BUFFER_SIZE);
-      ArtNetUdp->flush();   // Finish reading the current packet
+      uint8_t stack_buffer[WS2812_ARTNET_UDP_BUFFER_SIZE];      // buffer to hold incoming UDP/SSDP packet, only used for single lights
+      uint8_t * packet_buffer = nullptr;
+
+      if (artnet_conf.on && artnet_conf.matrix) {
+        ArtNetReceiveDirect(packet_len);    // payload lands directly in the strip framebuffer
+      } else {
+        packet_buffer = stack_buffer;
+        packet_len = ArtNetUdp->read(packet_buffer, WS2812_ARTNET_UDP_BUFFER_SIZE);
+        ArtNetUdp->flush();   // Finish reading the current packet
+      }
 #endif
       // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("UDP: Packet %*_H (%d)"), 32, packet_buffer, packet_len);
-      if (artnet_conf.on) {
+      if (artnet_conf.on && (packet_buffer != nullptr)) {
         ArtNetProcessPacket(packet_buffer, packet_len);
       }
 
@@ -269,6 +352,9 @@ void ArtNetLoop(void)
         packet_ready = (packet_len > 0);
       }
 #endif
+      if (0 == --packet_budget) {
+        packet_ready = false;     // budget exhausted, remaining packets are handled next pass
+      }
     }
     if (artnet_conf.on) {                 // ignore action if not on
       if (artnet_conf.matrix) {
@@ -286,8 +372,13 @@ void ArtNetLoop(void)
 //
 void ArtNetJSONAppend(void) {
   if (artnet_udp_connected) {
-    ResponseAppend_P(PSTR(",\"ArtNet\":{\"PacketsReceived\":%u,\"PacketsAccepted\":%u,\"Frames\":%u"),
-                    artnet_conf.packet_received, artnet_conf.packet_accepted, artnet_conf.strip_refresh);
+    ResponseAppend_P(PSTR(",\"ArtNet\":{\"PacketsReceived\":%u,\"PacketsAccepted\":%u,\"PacketsStale\":%u,\"Frames\":%u"),
+                    artnet_conf.packet_received, artnet_conf.packet_accepted, artnet_conf.packet_stale, artnet_conf.strip_refresh);
+#ifdef ESP8266
+    if (ArtNetUdp) {
+      ResponseAppend_P(PSTR(",\"QueueDepthMax\":%d,\"QueueDrops\":%u"), ArtNetUdp->depthMax(), ArtNetUdp->drops());
+    }
+#endif
     if (packets_per_row) {
       ResponseAppend_P(PSTR(",\"PacketsPerRow\":["));
       for (int32_t i = 0; i < artnet_conf.rows; i++) {
@@ -371,6 +462,8 @@ bool ArtNetStart(void) {
 
       packets_per_row = (uint32_t*) malloc(artnet_conf.rows * sizeof(uint32_t*));
       if (packets_per_row) { memset((void*)packets_per_row, 0, artnet_conf.rows * sizeof(uint32_t*)); }
+      artnet_seq = (uint8_t*) malloc(artnet_conf.rows);
+      if (artnet_seq) { memset((void*)artnet_seq, 0, artnet_conf.rows); }
       // set sleep to at most 5
       if (TasmotaGlobal.sleep > WS2812_ARTNET_MAX_SLEEP) {
         TasmotaGlobal.sleep = WS2812_ARTNET_MAX_SLEEP;
@@ -418,6 +511,10 @@ void ArtNetStop(void) {
     free((void*)packets_per_row);
     packets_per_row = nullptr;
   }
+  if (artnet_seq) {
+    free((void*)artnet_seq);
+    artnet_seq = nullptr;
+  }
 }
 
 void CmndArtNet(void) {
@@ -300,16 +300,125 @@ uint8_t change10to8(uint16_t v) {
 /*********************************************************************************************\
  * Gamma correction
 \*********************************************************************************************/
+// Precomputed 16.16 fixed-point slopes for each segment of the gamma tables above.
+// They replace the division done per channel per call by changeUIntScale with a
+// multiply and shift - a full 5-channel recompute runs on every fade tick, so this
+// is a hot path on PWM and SM2135-style bulbs. Result is within 1/1023 of the
+// previous computation and remains monotonic.
+typedef struct gamma_slope_t {
+  uint32_t fwd;               // (delta_gamma << 16) / delta_src
+  uint32_t rev;               // (delta_src << 16) / delta_gamma
+} gamma_slope_t;
+
+gamma_slope_t ac_dimmer_slope[sizeof(ac_dimmer_table) / sizeof(ac_dimmer_table[0])];
+gamma_slope_t gamma_slope[sizeof(gamma_table) / sizeof(gamma_table[0])];
+gamma_slope_t gamma_fast_slope[sizeof(gamma_table_fast) / sizeof(gamma_table_fast[0])];
+bool gamma_slope_init_done = false;
+
+void ledGammaSlopeInitTable(const gamma_table_t *gt, gamma_slope_t *slope, uint32_t count) {
+  uint32_t from_src = 0;
+  uint32_t from_gamma = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t dsrc = gt[i].to_src - from_src;
+    uint32_t dgamma = gt[i].to_gamma - from_gamma;
+    slope[i].fwd = dsrc ? (((dgamma << 16) + (dsrc / 2)) / dsrc) : 0;       // rounded to nearest
+    slope[i].rev = dgamma ? (((dsrc << 16) + (dgamma / 2)) / dgamma) : 0;
+    from_src = gt[i].to_src;
+    from_gamma = gt[i].to_gamma;
+  }
+}
+
+// User-defined dimming curve, installed at set time by `DimmerCurve` and used
+// in place of the built-in gamma curves (including the fast Fade curve) while
+// active. Two extra entries hold the forced (1023,1023) endpoint and fail-safe.
+#ifndef CUSTOM_GAMMA_POINTS
+#define CUSTOM_GAMMA_POINTS 8       // max user supplied breakpoints
+#endif
+
+gamma_table_t custom_gamma_table[CUSTOM_GAMMA_POINTS + 2];
+gamma_slope_t custom_gamma_slope[CUSTOM_GAMMA_POINTS + 2];
+uint8_t custom_gamma_count = 0;     // 0 = built-in curves active
+
+// Install a custom curve from `count` breakpoint pairs (src, out), both 10 bits,
+// strictly increasing in src and monotonic in out. The segment slopes are
+// precompiled here so the per-channel fade cost is identical to the built-in
+// curves. A first pair with a non-zero out value acts as a low-end anti-flicker
+// floor: any non-zero brightness maps at or above it. count == 0 reverts to the
+// built-in gamma curves.
+bool ledGammaSetCustomTable(const uint32_t *pairs, uint32_t count) {
+  if (0 == count) {
+    custom_gamma_count = 0;
+    return true;
+  }
+  if (count > CUSTOM_GAMMA_POINTS) { return false; }
+  uint16_t prev_src = 0;
+  uint16_t prev_out = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t src = pairs[2*i];
+    uint32_t out = pairs[2*i + 1];
+    if ((src > 1023) || (out > 1023)) { return false; }
+    if ((i > 0) && ((src <= prev_src) || (out < prev_out))) { return false; }
+    custom_gamma_table[i].to_src = src;
+    custom_gamma_table[i].to_gamma = out;
+    prev_src = src;
+    prev_out = out;
+  }
+  uint32_t len = count;
+  if (prev_src < 1023) {            // force full output at full input
+    custom_gamma_table[len].to_src = 1023;
+    custom_gamma_table[len].to_gamma = 1023;
+    len++;
+  }
+  custom_gamma_table[len].to_src = 0xFFFF;    // fail-safe if out of range
+  custom_gamma_table[len].to_gamma = 0xFFFF;
+  len++;
+  ledGammaSlopeInitTable(custom_gamma_table, custom_gamma_slope, len);
+  custom_gamma_count = count;
+  return true;
+}
+
+// Accessors for the command handler - globals defined here are not visible in
+// earlier .ino files of this translation unit, functions are
+uint32_t ledGammaCustomCount(void) {
+  return custom_gamma_count;
+}
+
+void ledGammaCustomPoint(uint32_t index, uint16_t *src, uint16_t *out) {
+  *src = custom_gamma_table[index].to_src;
+  *out = custom_gamma_table[index].to_gamma;
+}
+
+const gamma_slope_t * ledGammaSlopes(const gamma_table_t *gt_ptr) {
+  if (!gamma_slope_init_done) {
+    ledGammaSlopeInitTable(ac_dimmer_table, ac_dimmer_slope, sizeof(ac_dimmer_slope) / sizeof(ac_dimmer_slope[0]));
+    ledGammaSlopeInitTable(gamma_table, gamma_slope, sizeof(gamma_slope) / sizeof(gamma_slope[0]));
+    ledGammaSlopeInitTable(gamma_table_fast, gamma_fast_slope, sizeof(gamma_fast_slope) / sizeof(gamma_fast_slope[0]));
+    gamma_slope_init_done = true;
+  }
+  if (gt_ptr == gamma_table)        { return gamma_slope; }
+  if (gt_ptr == gamma_table_fast)   { return gamma_fast_slope; }
+  if (gt_ptr == ac_dimmer_table)    { return ac_dimmer_slope; }
+  if (gt_ptr == custom_gamma_table) { return custom_gamma_slope; }
+  return nullptr;
+}
+
 // Calculate the gamma corrected value for LEDS
 uint16_t ledGamma_internal(uint16_t v, const struct gamma_table_t *gt_ptr) {
+  const gamma_slope_t *slope = ledGammaSlopes(gt_ptr);
   uint16_t from_src = 0;
   uint16_t from_gamma = 0;
 
-  for (const gamma_table_t *gt = gt_ptr; ; gt++) {
-    uint16_t to_src = gt->to_src;
-    uint16_t to_gamma = gt->to_gamma;
+  for (uint32_t i = 0; ; i++) {
+    uint16_t to_src = gt_ptr[i].to_src;
+    uint16_t to_gamma = gt_ptr[i].to_gamma;
     if (v <= to_src) {
-      return changeUIntScale(v, from_src, to_src, from_gamma, to_gamma);
+      if (v >= to_src) { return to_gamma; }
+      if (v <= from_src) { return from_gamma; }
+      if (nullptr == slope) {     // unknown table, fall back to the slower exact computation
+        return changeUIntScale(v, from_src, to_src, from_gamma, to_gamma);
+      }
+      uint32_t result = from_gamma + (((uint32_t)(v - from_src) * slope[i].fwd + 0x8000) >> 16);
+      return (result > to_gamma) ? to_gamma : result;
     }
     from_src = to_src;
     from_gamma = to_gamma;
@@ -317,14 +426,21 @@ uint16_t ledGamma_internal(uint16_t v, const struct gamma_table_t *gt_ptr) {
 }
 // Calculate the reverse gamma value for LEDS
 uint16_t ledGammaReverse_internal(uint16_t vg, const struct gamma_table_t *gt_ptr) {
+  const gamma_slope_t *slope = ledGammaSlopes(gt_ptr);
   uint16_t from_src = 0;
   uint16_t from_gamma = 0;
 
-  for (const gamma_table_t *gt = gt_ptr; ; gt++) {
-    uint16_t to_src = gt->to_src;
-    uint16_t to_gamma = gt->to_gamma;
+  for (uint32_t i = 0; ; i++) {
+    uint16_t to_src = gt_ptr[i].to_src;
+    uint16_t to_gamma = gt_ptr[i].to_gamma;
     if (vg <= to_gamma) {
-      return changeUIntScale(vg, from_gamma, to_gamma, from_src, to_src);
+      if (vg >= to_gamma) { return to_src; }
+      if (vg <= from_gamma) { return from_src; }
+      if (nullptr == slope) {
+        return changeUIntScale(vg, from_gamma, to_gamma, from_src, to_src);
+      }
+      uint32_t result = from_src + (((uint32_t)(vg - from_gamma) * slope[i].rev + 0x8000) >> 16);
+      return (result > to_src) ? to_src : result;
     }
     from_src = to_src;
     from_gamma = to_gamma;
@@ -338,7 +454,7 @@ uint16_t ac_zero_cross_power(uint16_t v) {
 
 // 10 bits in, 10 bits out
 uint16_t ledGamma10_10(uint16_t v) {
-  return ledGamma_internal(v, gamma_table);
+  return ledGamma_internal(v, custom_gamma_count ? custom_gamma_table : gamma_table);
 }
 
 // 10 bits resolution, 8 bits in
@@ -353,14 +469,15 @@ uint8_t ledGamma(uint8_t v) {
 
 // Reverse 10 bits
 uint16_t ledGammaReverse(uint16_t vg) {
-  return ledGammaReverse_internal(vg, gamma_table);
+  return ledGammaReverse_internal(vg, custom_gamma_count ? custom_gamma_table : gamma_table);
 }
 
-// Fast versions for Fading
+// Fast versions for Fading - a custom curve replaces the fast curve as well,
+// its slopes are precompiled so the fade cost does not change
 uint16_t ledGammaFast(uint16_t v) {
-  return ledGamma_internal(v, gamma_table_fast);
+  return ledGamma_internal(v, custom_gamma_count ? custom_gamma_table : gamma_table_fast);
 }
 
 uint16_t leddGammaReverseFast(uint16_t vg) {
-  return ledGammaReverse_internal(vg, gamma_table_fast);
+  return ledGammaReverse_internal(vg, custom_gamma_count ? custom_gamma_table : gamma_table_fast);
 }
@@ -75,10 +75,10 @@ enum IrErrors { IE_RESPONSE_PROVIDED, IE_NO_ERROR, IE_INVALID_RAWDATA, IE_INVALI
                 IE_UNSUPPORTED_HVAC, IE_UNSUPPORTED_PROTOCOL, IE_MEMORY, IE_INVALID_HEXDATA };
 
 const char kIrRemoteCommands[] PROGMEM = "|"
-  D_CMND_IRHVAC "|" D_CMND_IRSEND ; // No prefix
+  D_CMND_IRHVAC "|" D_CMND_IRSEND "|" D_CMND_IRENABLE ; // No prefix
 
 void (* const IrRemoteCommand[])(void) PROGMEM = {
-  &CmndIrHvac, &CmndIrSend };
+  &CmndIrHvac, &CmndIrSend, &CmndIrEnable };
 
 bool ir_send_active = false;    // do we have a GPIO configured for IR_SEND
 bool ir_recv_active = false;    // do we have a GPIO configured for IR_RECV
@@ -178,7 +178,12 @@ uint64_t reverseBitsInBytes64(uint64_t b) {
  * IR Receive
 \*********************************************************************************************/
 
+#ifdef ESP32
+const bool IR_FULL_RCV_SAVE_BUFFER = true;          // Decode from a snapshot copy so a frame arriving during a slow
+                                                    // decode cannot corrupt the one being decoded (+2k mem)
+#else
 const bool IR_FULL_RCV_SAVE_BUFFER = false;         // false = do not use buffer, true = use buffer for decoding
+#endif  // ESP32
 
 #ifndef IR_TIME_AVOID_DUPLICATE
 #define IR_TIME_AVOID_DUPLICATE 50           // Milliseconds
@@ -197,6 +202,33 @@ IRrecv *irrecv = nullptr;
 
 unsigned long ir_lasttime = 0;
 
+/*-------------------------------------------------------------------------------------------*\
+ * Transmission bracket
+ *
+ * The library bit-bangs the mark/space train with busy-waits, so on ESP32 a tick
+ * preemption in the middle of a long AC frame stretches a space by milliseconds and the
+ * receiver discards the frame. Raise the task priority for the duration of the send.
+\*-------------------------------------------------------------------------------------------*/
+
+#ifdef ESP32
+UBaseType_t ir_tx_priority;
+#endif  // ESP32
+
+void IrTxStart(void) {
+  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+#ifdef ESP32
+  ir_tx_priority = uxTaskPriorityGet(NULL);
+  vTaskPrioritySet(NULL, configMAX_PRIORITIES - 2);
+#endif  // ESP32
+}
+
+void IrTxEnd(void) {
+#ifdef ESP32
+  vTaskPrioritySet(NULL, ir_tx_priority);
+#endif  // ESP32
+  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+}
+
 void IrReceiveUpdateThreshold(void)
 {
   if (irrecv != nullptr) {
@@ -214,12 +246,29 @@ void IrReceiveUpdateTolerance(void)
   }
 }
 
+void IrReceiveUpdateProtocolMask(void)
+{
+  if (irrecv != nullptr) {
+    uint32_t bits = 0;
+    for (uint32_t i = 0; i < sizeof(Settings->ir_protocol_mask); i++) {
+      bits += Settings->ir_protocol_mask[i];
+    }
+    if (0 == bits) {                     // Uninitialized mask - enable every protocol
+      for (uint32_t i = decode_type_t::UNUSED + 1; i <= decode_type_t::kLastDecodeType; i++) {
+        Settings->ir_protocol_mask[i / 8] |= 1 << (i % 8);
+      }
+    }
+    irrecv->setProtocolMask(Settings->ir_protocol_mask);
+  }
+}
+
 void IrReceiveInit(void)
 {
   // an IR led is at GPIO_IRRECV
   irrecv = new IRrecv(Pin(GPIO_IRRECV), IR_FULL_BUFFER_SIZE, IR__FULL_RCV_TIMEOUT, IR_FULL_RCV_SAVE_BUFFER);
   irrecv->setUnknownThreshold(Settings->param[P_IR_UNKNOW_THRESHOLD]);
   IrReceiveUpdateTolerance();
+  IrReceiveUpdateProtocolMask();
   irrecv->enableIRIn();                  // Start the receiver
 }
 
@@ -334,9 +383,21 @@ void sendIRJsonState(const struct decode_results &results) {
 void IrReceiveCheck(void) {
   decode_results results;
 
+  uint32_t decode_start = micros();
   if (irrecv->decode(&results)) {
+    uint32_t decode_time = micros() - decode_start;
     uint32_t now = millis();
 
+    AddLog(LOG_LEVEL_DEBUG, PSTR("IR : %s decoded in %d us"),
+      typeToString(results.decode_type).c_str(), decode_time);
+
+    // A few decoders serve several protocols behind one mask bit, so a
+    // disabled protocol can still come out of decode() - drop it here
+    if (!irrecv->protocolEnabled(results.decode_type)) {
+      irrecv->resume();
+      return;
+    }
+
 //    if ((now - ir_lasttime > IR_TIME_AVOID_DUPLICATE) && (UNKNOWN != results.decode_type) && (results.bits > 0)) {
     if (now - ir_lasttime > IR_TIME_AVOID_DUPLICATE) {
       ir_lasttime = now;
@@ -516,7 +577,7 @@ uint32_t IrRemoteCmndIrHvacJson(void)
   state.iFeel = strToBool(root[PSTR(D_JSON_IRHVAC_IFEEL)], state.iFeel);
   state.sensorTemperature = root.getFloat(PSTR(D_JSON_IRHVAC_SENSOR_TEMP), state.sensorTemperature);
 
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+  IrTxStart();
   if (stateMode == StateModes::SEND_ONLY || stateMode == StateModes::SEND_STORE) {
     int8_t channel = root.getUInt(PSTR(D_JSON_IR_CHANNEL), 1) - 1;
     if (channel < 0) { channel = GPIO_ANY; }    // take first available GPIO
@@ -532,7 +593,7 @@ uint32_t IrRemoteCmndIrHvacJson(void)
   if (stateMode == StateModes::STORE_ONLY || stateMode == StateModes::SEND_STORE) { // store state in memory
     irac_prev_state = state;
   }
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+  IrTxEnd();
 
   Response_P(PSTR("{\"" D_CMND_IRHVAC "\":%s}"), sendACJsonState(state).c_str());
   return IE_RESPONSE_PROVIDED;
@@ -623,11 +684,11 @@ uint32_t IrRemoteCmndIrSendJson(void)
     value = root[PSTR(D_JSON_IR_DATA)];
     if (value) { data64 = value.getULong(); }       // or classical MSB (takes priority)
 
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+    IrTxStart();
     IRsend irsend = IrSendInitGPIO(channel);
     // AddLog(LOG_LEVEL_INFO, PSTR("IRS: protocol %d, bits %d, data 0x%08X, repeat %d"), protocol, bits, (uint32_t) data64, repeat);
     success = irsend.send(protocol, data64, bits, repeat);
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+    IrTxEnd();
 
   } else {
     uint8_t * data65 = nullptr;   // for 65 bits and more
@@ -664,11 +725,11 @@ uint32_t IrRemoteCmndIrSendJson(void)
       reverseBits(data_bytes, bits);
     }
 
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+    IrTxStart();
     IRsend irsend = IrSendInitGPIO(channel);
     // AddLog(LOG_LEVEL_INFO, PSTR("IRS: protocol %d, bits %d, data 0x%08X"), protocol, bits, *(uint32_t*)data_bytes);
     success = irsend.send(protocol, data_bytes, (bits + 7) / 8);
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+    IrTxEnd();
   }
 
   if (!success) {
@@ -692,12 +753,12 @@ uint32_t IrRemoteSendGC(char ** pp, uint32_t count, uint32_t repeat) {
     GC[i] = strtol(strtok_r(nullptr, ",", pp), nullptr, 0);
     if (!GC[i]) { return IE_INVALID_RAWDATA; }
   }
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+  IrTxStart();
   IRsend irsend = IrSendInitGPIO();
   for (uint32_t r = 0; r <= repeat; r++) {
     irsend.sendGC(GC, count+1);
   }
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+  IrTxEnd();
   return IE_NO_ERROR;
 }
 
@@ -748,7 +809,7 @@ uint32_t IrRemoteSendRawFormatted(char ** pp, uint32_t count, uint32_t repeat) {
         raw_array[i++] = mark;                    // Mark
       }
     }
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+    IrTxStart();
     IRsend irsend = IrSendInitGPIO();
     for (uint32_t r = 0; r <= repeat; r++) {
       // AddLog(LOG_LEVEL_DEBUG, PSTR("sendRaw count=%d, space=%d, mark=%d, freq=%d"), count, space, mark, freq);
@@ -757,7 +818,7 @@ uint32_t IrRemoteSendRawFormatted(char ** pp, uint32_t count, uint32_t repeat) {
         irsend.space(40000);   // since we don't know the inter-message gap, place an arbitrary 40ms gap
       }
     }
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+    IrTxEnd();
   } else if (6 == count) {                          // NEC Protocol
     // IRsend raw,0,8620,4260,544,411,1496,010101101000111011001110000000001100110000000001100000000000000010001100
     uint16_t raw_array[strlen(*pp)*2+3];            // Header + bits + end
@@ -776,7 +837,7 @@ uint32_t IrRemoteSendRawFormatted(char ** pp, uint32_t count, uint32_t repeat) {
       }
     }
     raw_array[i++] = parm[2];                     // Trailing mark
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+    IrTxStart();
     IRsend irsend = IrSendInitGPIO();
     for (uint32_t r = 0; r <= repeat; r++) {
       // AddLog(LOG_LEVEL_DEBUG, PSTR("sendRaw %d %d %d %d %d %d"), raw_array[0], raw_array[1], raw_array[2], raw_array[3], raw_array[4], raw_array[5]);
@@ -785,7 +846,7 @@ uint32_t IrRemoteSendRawFormatted(char ** pp, uint32_t count, uint32_t repeat) {
         irsend.space(inter_message);   // since we don't know the inter-message gap, place an arbitrary 40ms gap
       }
     }
-    if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+    IrTxEnd();
   }
   else { return IE_INVALID_RAWDATA; }                   // Invalid number of parameters
   return IE_NO_ERROR;
@@ -854,12 +915,12 @@ uint32_t IrRemoteSendRawStandard(char ** pp, uint16_t freq, uint32_t count, uint
   // AddLog(LOG_LEVEL_DEBUG, PSTR("Arr %d %d %d %d %d %d %d %d"), arr[0], arr[1], arr[2], arr[3], arr[4], arr[5], arr[6], arr[7]);
   if (0 == count) { return IE_INVALID_RAWDATA; }
 
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->pause(); }
+  IrTxStart();
   IRsend irsend = IrSendInitGPIO();
   for (uint32_t r = 0; r <= repeat; r++) {
     irsend.sendRaw(arr, count, freq);
   }
-  if (!IR_RCV_WHILE_SENDING && (irrecv != nullptr)) { irrecv->resume(); }
+  IrTxEnd();
 
   if (nullptr != arr) {
     free(arr);
@@ -929,6 +990,50 @@ void CmndIrSend(void) {
   IrRemoteCmndResponse(error);
 }
 
+void CmndIrEnable(void) {
+  // IREnable              - list the enabled receive protocols
+  // IREnable a            - enable all compiled-in protocols
+  // IREnable NEC,HITACHI_AC - enable exactly the listed protocols, all others are skipped by the decoder
+  if (XdrvMailbox.data_len > 0) {
+    if ((1 == XdrvMailbox.data_len) && ('A' == toupper(XdrvMailbox.data[0]))) {
+      memset(Settings->ir_protocol_mask, 0, sizeof(Settings->ir_protocol_mask));
+    } else {
+      uint8_t mask[sizeof(Settings->ir_protocol_mask)] = { 0 };
+      char *p;
+      char *str = strtok_r(XdrvMailbox.data, ", ", &p);
+      while (str != nullptr) {
+        decode_type_t protocol = strToDecodeType(str);
+        if ((decode_type_t::UNKNOWN == protocol) || (decode_type_t::UNUSED == protocol)) {
+          ResponseCmndChar_P(PSTR(D_JSON_PROTOCOL_NOT_SUPPORTED));
+          return;
+        }
+        mask[protocol / 8] |= 1 << (protocol % 8);
+        str = strtok_r(nullptr, ", ", &p);
+      }
+      memcpy(Settings->ir_protocol_mask, mask, sizeof(mask));
+    }
+    IrReceiveUpdateProtocolMask();       // An all-zero mask is expanded to all protocols here
+  }
+
+  uint32_t enabled = 0;
+  for (uint32_t i = decode_type_t::UNUSED + 1; i <= decode_type_t::kLastDecodeType; i++) {
+    if (Settings->ir_protocol_mask[i / 8] & (1 << (i % 8))) { enabled++; }
+  }
+  if (enabled == decode_type_t::kLastDecodeType) {
+    Response_P(PSTR("{\"" D_CMND_IRENABLE "\":\"All\"}"));
+  } else {
+    Response_P(PSTR("{\"" D_CMND_IRENABLE "\":\""));
+    bool first = true;
+    for (uint32_t i = decode_type_t::UNUSED + 1; i <= decode_type_t::kLastDecodeType; i++) {
+      if (Settings->ir_protocol_mask[i / 8] & (1 << (i % 8))) {
+        ResponseAppend_P(PSTR("%s%s"), first ? "" : ",", typeToString((decode_type_t)i).c_str());
+        first = false;
+      }
+    }
+    ResponseAppend_P(PSTR("\"}"));
+  }
+}
+
 void IrRemoteCmndResponse(uint32_t error)
 {
   switch (error) {
@@ -994,7 +1099,7 @@ bool Xdrv05(uint32_t function)
       }
       break;
     case FUNC_COMMAND:
-      if (ir_send_active) {
+      if (ir_send_active || ir_recv_active) {
         result = DecodeCommand(kIrRemoteCommands, IrRemoteCommand);
       }
       break;
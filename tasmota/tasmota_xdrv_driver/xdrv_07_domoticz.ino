@@ -236,6 +236,7 @@ void DomoticzMqttSubscribe(void) {
   if (any_relay) {
     Domoticz->subscribe = true;
     MqttSubscribe(stopic);
+    MqttTopicHandlerRegister(DOMOTICZ_OUT_TOPIC, DomoticzMqttData);  // Fast-path dispatch on topic hash
   }
 }
 
@@ -733,6 +734,9 @@ bool Xdrv07(uint32_t function) {
       case FUNC_EVERY_SECOND:
         DomoticzMqttUpdate();
         break;
+      case FUNC_EVENT_MASK:
+        XdrvMailbox.payload = 0;  // No hot tick events handled
+        break;
       case FUNC_MQTT_DATA:
         result = DomoticzMqttData();
         break;
@@ -39,6 +39,9 @@
  * SSerialMode 1                 - Enable console tee
  * SSerialMode 2                 - Enable dump of serial data in log level 4
  * SSerialMode 3                 - Enable Sonoff WTS01 sensor decoding (ESP32 only)
+ * SSerialMode 4                 - Enable bulk transfer mode (ESP32 only) - large receive ring,
+ *                                 optional RTS/CTS hardware flow control and binary safe batched
+ *                                 publishes with sequence numbers
  * SerialDelimiter 255           - Receive data between 32 and 127 only
  * SerialDelimiter 254           - Receive hexadecimal data
  * SerialDelimiter 128           - Receive no data between 32 and 127
@@ -51,6 +54,7 @@
 
 #ifdef ESP32
 #define USE_SERIAL_BRIDGE_WTS01
+#define USE_SERIAL_BRIDGE_BULK
 #endif  // ESP32
 
 #ifdef SERIAL_BRIDGE_BUFFER_SIZE
@@ -63,7 +67,16 @@ const uint16_t SERIAL_BRIDGE_BUFSIZE = INPUT_BUFFER_SIZE;         // 800
 #endif  // ESP32
 #endif  // SERIAL_BRIDGE_BUFFER_SIZE
 
-enum SerialBridgeModes { SB_NONE, SB_TEE, SB_DUMP, SB_WTS01 };
+#ifdef USE_SERIAL_BRIDGE_BULK
+#ifndef SERIAL_BRIDGE_BULK_BUFFER_SIZE
+#define SERIAL_BRIDGE_BULK_BUFFER_SIZE  4096     // Serial driver receive ring in bulk mode
+#endif
+#ifndef SERIAL_BRIDGE_BULK_CHUNK_SIZE
+#define SERIAL_BRIDGE_BULK_CHUNK_SIZE   512      // Max payload bytes per published batch
+#endif
+#endif  // USE_SERIAL_BRIDGE_BULK
+
+enum SerialBridgeModes { SB_NONE, SB_TEE, SB_DUMP, SB_WTS01, SB_BULK };
 
 const char kSerialBridgeCommands[] PROGMEM = "|"  // No prefix
   D_CMND_SSERIALSEND "|" D_CMND_SBAUDRATE "|" D_CMND_SSERIALBUFFER "|" D_CMND_SSERIALCONFIG "|" D_CMND_SSERIALMODE;
@@ -81,12 +94,22 @@ struct {
   int      in_byte_counter = 0;
   float    temperature;
   bool     raw = false;
+#ifdef USE_SERIAL_BRIDGE_BULK
+  uint32_t bulk_sequence = 0;
+#endif  // USE_SERIAL_BRIDGE_BULK
 } SBridge;
 
 /********************************************************************************************/
 
 bool SetSSerialBegin(void) {
-  return SerialBridgeSerial->begin(Settings->sbaudrate * 300, ConvertSerialConfig(Settings->sserial_config));  // Reinitialize serial port with new baud rate
+  bool result = SerialBridgeSerial->begin(Settings->sbaudrate * 300, ConvertSerialConfig(Settings->sserial_config));  // Reinitialize serial port with new baud rate
+#ifdef USE_SERIAL_BRIDGE_BULK
+  if (result && (SB_BULK == Settings->sserial_mode)) {
+    SerialBridgeSerial->setHwFlowCtrl(PinUsed(GPIO_SBR_RTS) ? Pin(GPIO_SBR_RTS) : -1,
+                                      PinUsed(GPIO_SBR_CTS) ? Pin(GPIO_SBR_CTS) : -1);
+  }
+#endif  // USE_SERIAL_BRIDGE_BULK
+  return result;
 }
 
 void SetSSerialConfig(uint32_t serial_config) {
@@ -117,7 +140,38 @@ void SerialBridgePrintf(PGM_P formatP, ...) {
 
 /********************************************************************************************/
 
+#ifdef USE_SERIAL_BRIDGE_BULK
+void SerialBridgeBulkInput(void) {
+  // Drain the serial receive ring in large chunks and publish each chunk as a
+  // hex encoded (binary safe) batch. The sequence number lets the receiver
+  // detect lost batches; with RTS/CTS wired the attached MCU is stalled by
+  // hardware while a publish is in progress instead of data being dropped.
+  uint8_t buffer[SERIAL_BRIDGE_BULK_CHUNK_SIZE];
+  size_t chunk_size = (ResponseSize() - 80) / 2;   // Hex encoding doubles the payload; leave room for the JSON frame
+  if (chunk_size > sizeof(buffer)) { chunk_size = sizeof(buffer); }
+  while (SerialBridgeSerial->available()) {
+    size_t len = SerialBridgeSerial->read(buffer, chunk_size);
+    if (0 == len) { break; }
+    SBridge.bulk_sequence++;
+    Response_P(PSTR("{\"" D_JSON_SSERIALRECEIVED "\":{\"Seq\":%u,\"Len\":%u,\"Data\":\"%*_H\"}}"),
+      SBridge.bulk_sequence, len, len, buffer);
+    if (Settings->flag6.mqtt_disable_publish) {    // SetOption147 - No MQTT publish, rules only
+      XdrvRulesProcess(0);
+    } else {
+      MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_SSERIALRECEIVED));
+    }
+    yield();
+  }
+}
+#endif  // USE_SERIAL_BRIDGE_BULK
+
 void SerialBridgeInput(void) {
+#ifdef USE_SERIAL_BRIDGE_BULK
+  if (SB_BULK == Settings->sserial_mode) {
+    SerialBridgeBulkInput();
+    return;
+  }
+#endif  // USE_SERIAL_BRIDGE_BULK
   while (SerialBridgeSerial->available()) {
     yield();
     uint8_t serial_in_byte = SerialBridgeSerial->read();
@@ -257,11 +311,17 @@ void SerialBridgeInput(void) {
 
 void SerialBridgeInit(void) {
   if (PinUsed(GPIO_SBR_RX) || PinUsed(GPIO_SBR_TX)) {
+    uint16_t buffer_size = MIN_INPUT_BUFFER_SIZE;                               // 256
+#ifdef USE_SERIAL_BRIDGE_BULK
+    if (SB_BULK == Settings->sserial_mode) {
+      buffer_size = SERIAL_BRIDGE_BULK_BUFFER_SIZE;                             // 4096
+    }
+#endif  // USE_SERIAL_BRIDGE_BULK
     SerialBridgeSerial = new TasmotaSerial(Pin(GPIO_SBR_RX),
                                            Pin(GPIO_SBR_TX),
                                            HARDWARE_FALLBACK,
                                            0,                                   // Software receive mode (FALLING edge)
-                                           MIN_INPUT_BUFFER_SIZE,               // 256
+                                           buffer_size,
                                            Settings->flag3.sb_receive_invert);  // SetOption69  - (Serial) Invert Serial receive on SerialBridge
     if (SetSSerialBegin()) {
       if (SerialBridgeSerial->hardwareSerial()) {
@@ -284,7 +344,11 @@ void SerialBridgeInit(void) {
 \*********************************************************************************************/
 
 void CmndSSerialSend(void) {
-  if (Settings->sserial_mode > SB_DUMP) { return; }                         // Not supported in receive only mode
+  if ((Settings->sserial_mode > SB_DUMP)
+#ifdef USE_SERIAL_BRIDGE_BULK
+      && (SB_BULK != Settings->sserial_mode)                                // Bulk mode needs the downlink (SSerialSend5 is binary safe)
+#endif  // USE_SERIAL_BRIDGE_BULK
+     ) { return; }                                                          // Not supported in receive only mode
   if (XdrvMailbox.index > 9) { XdrvMailbox.index -= 10; }
   if ((XdrvMailbox.index > 0) && (XdrvMailbox.index <= 6)) {
     SBridge.raw = (XdrvMailbox.index > 3);
@@ -386,9 +450,15 @@ void CmndSSerialMode(void) {
   // SSerialMode 1  - Toggle console tee
   // SSerialMode 2  - Dump hex data to log level 4 for analysis
   // SSerialMode 3  - Sonoff WTS01 decode
+  // SSerialMode 4  - Bulk transfer mode
   if (XdrvMailbox.payload >= 0) {
     switch (XdrvMailbox.payload) {
       case SB_NONE:
+#ifdef USE_SERIAL_BRIDGE_BULK
+        if (SB_BULK == Settings->sserial_mode) {
+          SerialBridgeSerial->setHwFlowCtrl(-1, -1);
+        }
+#endif  // USE_SERIAL_BRIDGE_BULK
         Settings->sserial_mode = XdrvMailbox.payload;
   //      Settings->serial_delimiter = 255;
         Settings->sbaudrate = 115200 / 300;        // 115200bps
@@ -410,6 +480,14 @@ void CmndSSerialMode(void) {
         SetSSerialConfig(3);                       // 8N1
         break;
 #endif  // USE_SERIAL_BRIDGE_WTS01
+#ifdef USE_SERIAL_BRIDGE_BULK
+      case SB_BULK:
+        Settings->sserial_mode = XdrvMailbox.payload;
+        SBridge.bulk_sequence = 0;
+        SerialBridgeSerial->setRxBufferSize(SERIAL_BRIDGE_BULK_BUFFER_SIZE);
+        SetSSerialBegin();                         // Enables RTS/CTS if SerBr RTS/CTS GPIOs are configured
+        break;
+#endif  // USE_SERIAL_BRIDGE_BULK
       default:
         return;                                    // Not supported
     }
@@ -457,6 +535,7 @@ bool Xdrv08(uint32_t function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         SerialBridgeInput();
+        SleepRequestWake(1);             // Drain the uart every millisecond to prevent buffer overrun
         break;
       case FUNC_JSON_APPEND:
         SerialBridgeShow(1);
@@ -54,6 +54,7 @@ void (* const TimerCommand[])(void) PROGMEM = {
 
 uint16_t timer_last_minute = 60;
 int8_t timer_window[MAX_TIMERS] = { 0 };
+int16_t timer_next_fire = -2;            // Earliest armed minute-of-day still due today, -1 = none left today, -2 = recompute
 
 #ifdef USE_SUNRISE
 /*********************************************************************************************\
@@ -280,16 +281,52 @@ void TimerSetRandomWindows(void)
   for (uint32_t i = 0; i < MAX_TIMERS; i++) { TimerSetRandomWindow(i); }
 }
 
+void TimerComputeNextFire(void)
+{
+  // Compile the armed timers into the earliest minute-of-day still due today so
+  // TimerEverySecond() is a single comparison until that minute is reached.
+  // Sunrise/sunset offsets are resolved here instead of on every pass.
+  timer_next_fire = -1;
+  int32_t time = (RtcTime.hour *60) + RtcTime.minute;
+  uint8_t days = 1 << (RtcTime.day_of_week -1);
+
+  for (uint32_t i = 0; i < MAX_TIMERS; i++) {
+    Timer xtimer = Settings->timer[i];
+    if (!xtimer.arm) { continue; }
+#ifdef USE_SUNRISE
+    if ((1 == xtimer.mode) || (2 == xtimer.mode)) {      // Sunrise or Sunset
+      ApplyTimerOffsets(&xtimer);
+      if (xtimer.time >= 2046) { continue; }
+    }
+#endif
+    if (!(xtimer.days & days)) { continue; }             // Not scheduled for today
+    int32_t set_time = xtimer.time + timer_window[i];    // Same window handling as the fire loop below
+    if (set_time < 0) { set_time = abs(timer_window[i]); }
+    if (set_time > 1439) { set_time = xtimer.time - abs(timer_window[i]); }
+    if (set_time > 1439) { set_time = 1439; }
+    if (set_time < time) { continue; }                   // Already passed today
+    if ((timer_next_fire < 0) || (set_time < timer_next_fire)) { timer_next_fire = set_time; }
+  }
+
+  DEBUG_DRIVER_LOG(PSTR("TIM: Next fire at minute %d"), timer_next_fire);
+}
+
 void TimerEverySecond(void)
 {
   if (RtcTime.valid) {
-    if (!RtcTime.hour && !RtcTime.minute && !RtcTime.second) { TimerSetRandomWindows(); }  // Midnight
+    if (!RtcTime.hour && !RtcTime.minute && !RtcTime.second) {
+      TimerSetRandomWindows();                           // Midnight - new day mask, sun times and windows
+      timer_next_fire = -2;
+    }
     if (Settings->flag3.timers_enable &&                            // CMND_TIMERS
         (TasmotaGlobal.uptime > 60) && (RtcTime.minute != timer_last_minute)) {  // Execute from one minute after restart every minute only once
       timer_last_minute = RtcTime.minute;
       int32_t time = (RtcTime.hour *60) + RtcTime.minute;
       uint8_t days = 1 << (RtcTime.day_of_week -1);
 
+      if (-2 == timer_next_fire) { TimerComputeNextFire(); }
+      if ((timer_next_fire < 0) || (time < timer_next_fire)) { return; }  // Nothing due yet
+
       for (uint32_t i = 0; i < MAX_TIMERS; i++) {
         Timer xtimer = Settings->timer[i];
         if (xtimer.arm) {
@@ -324,6 +361,8 @@ void TimerEverySecond(void)
           }
         }
       }
+
+      TimerComputeNextFire();                            // A timer fired or its minute passed
     }
   }
 }
@@ -473,6 +512,7 @@ void CmndTimer(void)
       }
     }
     if (!error) {
+      if (XdrvMailbox.data_len) { timer_next_fire = -2; }  // Timer changed - recompute next fire
       Response_P(PSTR("{"));
       PrepShowTimer(index);
       ResponseJsonEnd();
@@ -502,6 +542,7 @@ void CmndTimers(void)
 void CmndLongitude(void) {
   if (XdrvMailbox.data_len) {
     Settings->longitude = (int)(CharToFloat(XdrvMailbox.data) *1000000);
+    timer_next_fire = -2;                // Sun times changed - recompute next fire
   }
   ResponseCmndFloat((float)(Settings->longitude) /1000000, 6);
 }
@@ -509,6 +550,7 @@ void CmndLongitude(void) {
 void CmndLatitude(void) {
   if (XdrvMailbox.data_len) {
     Settings->latitude = (int)(CharToFloat(XdrvMailbox.data) *1000000);
+    timer_next_fire = -2;                // Sun times changed - recompute next fire
   }
   ResponseCmndFloat((float)(Settings->latitude) /1000000, 6);
 }
@@ -516,6 +558,7 @@ void CmndLatitude(void) {
 void CmndSunrise(void) {
   if ((XdrvMailbox.payload >= 0) && (XdrvMailbox.payload <= 3)) {
     Settings->mbflag2.sunrise_dawn_angle = XdrvMailbox.payload;
+    timer_next_fire = -2;                // Sun times changed - recompute next fire
   }
   ResponseCmndNumber(Settings->mbflag2.sunrise_dawn_angle);
 }
@@ -917,6 +960,7 @@ void TimerSaveSettings(void)
       if (flag) TimerSetRandomWindow(i);
     }
   }
+  timer_next_fire = -2;                  // Timers changed - recompute next fire
   char command[CMDSZ];
   snprintf_P(command, sizeof(command), PSTR(D_CMND_TIMERS));
   ExecuteWebCommand(command);
@@ -953,6 +997,9 @@ bool Xdrv09(uint32_t function)
     case FUNC_EVERY_SECOND:
       TimerEverySecond();
       break;
+    case FUNC_EVENT_MASK:
+      XdrvMailbox.payload = 0;  // No hot tick events handled
+      break;
     case FUNC_COMMAND:
       result = DecodeCommand(kTimerCommands, TimerCommand);
       break;
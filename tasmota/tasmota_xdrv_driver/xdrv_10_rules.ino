@@ -164,12 +164,20 @@ void (* const RulesCommand[])(void) PROGMEM = {
 #endif
   };
 
+#define RULE_MAX_FILTER_KEYS  16   // Max trigger keys remembered per rule set before reverting to full text scan
+#define RULE_FILTER_SCAN_ALL  0xFF // Marker in filter_count - rule set cannot be prefiltered
+
 struct RULES {
   String event_value;
   unsigned long timer[MAX_RULE_TIMERS] = { 0 };
   uint32_t triggers[MAX_RULE_SETS] = { 0 };
   uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
 
+  uint16_t filter_hash[MAX_RULE_SETS][RULE_MAX_FILTER_KEYS];  // Hashed first segment of every trigger
+  uint32_t filter_bloom[MAX_RULE_SETS] = { 0 };               // Bit per hashed trigger key for an O(1) reject
+  uint8_t filter_count[MAX_RULE_SETS] = { 0 };                // Number of hashes, or RULE_FILTER_SCAN_ALL
+  uint8_t filter_stale = 0xFF;                                // Bitmask of rule sets whose trigger filter needs (re)building
+
   long new_power = -1;
   long old_power = -1;
   long old_dimm = -1;
@@ -185,6 +193,8 @@ struct RULES {
 } Rules;
 
 char rules_vars[MAX_RULE_VARS][33] = {{ 0 }};
+float rules_vars_num[MAX_RULE_VARS] = { 0 };  // Typed value of a rule variable, valid when its bit is set in rules_vars_numeric
+uint16_t rules_vars_numeric = 0;              // Bitmask supporting MAX_RULE_VARS bits
 
 #if (MAX_RULE_VARS>16)
 #error MAX_RULE_VARS is bigger than 16
@@ -193,6 +203,46 @@ char rules_vars[MAX_RULE_VARS][33] = {{ 0 }};
 #error MAX_RULE_MEMS is bigger than 16
 #endif
 
+/*
+ * Rule variables are typed - the float is the master copy for numeric values and arithmetic
+ * (Add/Sub/Mult/Scale) works on it directly, so repeated operations no longer accumulate the
+ * rounding error of a dtostrfd/CharToFloat round-trip per step. The text form in rules_vars
+ * remains the external interface (%VARn% substitution, JSON, other drivers) and is rendered
+ * once at assignment.
+ */
+
+// Store a numeric value in a rule variable
+void RulesVarSetFloat(uint32_t idx, float value) {
+  rules_vars_num[idx] = value;
+  bitSet(rules_vars_numeric, idx);
+  dtostrfd(value, Settings->flag2.calc_resolution, rules_vars[idx]);
+}
+
+// Store a text value in a rule variable, caching its numeric value if it is a plain decimal
+void RulesVarSetText(uint32_t idx, const char *text) {
+  strlcpy(rules_vars[idx], text, sizeof(rules_vars[idx]));
+  const char *p = rules_vars[idx];
+  if (('+' == *p) || ('-' == *p)) { p++; }
+  bool digits = false;
+  bool dot = false;
+  bool numeric = ('\0' != *p);
+  for (; *p; p++) {
+    if (isdigit(*p)) { digits = true; }
+    else if (('.' == *p) && !dot) { dot = true; }
+    else { numeric = false; break; }
+  }
+  if (numeric && digits) {
+    rules_vars_num[idx] = CharToFloat(rules_vars[idx]);
+    bitSet(rules_vars_numeric, idx);
+  } else {
+    bitClear(rules_vars_numeric, idx);
+  }
+}
+
+float RulesVarGetFloat(uint32_t idx) {
+  return bitRead(rules_vars_numeric, idx) ? rules_vars_num[idx] : CharToFloat(rules_vars[idx]);
+}
+
 
 /*******************************************************************************************/
 /*
@@ -331,6 +381,7 @@ int32_t SetRule_compress(uint32_t idx, const char *in, size_t in_len, char *out,
 //   <0 : not enough space
 int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
   if (nullptr == content) { content = ""; }   // if nullptr, use empty string
+  bitSet(Rules.filter_stale, idx);            // Rule text changes, trigger filter will be rebuilt on next event
   size_t len_in = strlen(content);
   bool needsCompress = false;
   size_t offset = 0;
@@ -367,6 +418,7 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
     }
 #endif  // USE_UNISHOX_COMPRESSION
 
+    RulesBuildTriggerFilter(idx);             // Rebuild trigger index at save time, off the event path
     return len_in + offset;
   } else {
 #ifdef USE_UNISHOX_COMPRESSION
@@ -400,6 +452,9 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
       k_rules[idx] = (const char *) nullptr;
     }
     free(buf_out);
+    if (len_compressed >= 0) {
+      RulesBuildTriggerFilter(idx);           // Rebuild trigger index at save time, off the event path
+    }
     return len_compressed;
 #else   // No USE_UNISHOX_COMPRESSION
     return -1;                                // the rule does not fit and we can't compress
@@ -408,6 +463,128 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
 
 }
 
+/*******************************************************************************************/
+/*
+ * Trigger prefilter
+ *
+ * Every trigger can only match if the top-level JSON key of the event equals the first
+ * segment of the trigger name ("INA219" in "INA219#CURRENT>0.100"). The first segments are
+ * hashed once per rule set when the rule text changes, so events that cannot possibly match
+ * any trigger of a rule set skip the expensive per-event text scan in RuleSetProcess.
+ *
+ * The filter is conservative: rule sets with triggers that cannot be classified (placeholders
+ * or operators in the first segment, more than RULE_MAX_FILTER_KEYS triggers, syntax errors)
+ * are marked RULE_FILTER_SCAN_ALL and always scanned, as are sets with Rule ONCE active since
+ * its trigger state machine needs to see non-matching events too.
+ */
+/*******************************************************************************************/
+
+uint16_t RulesFilterHash(const char *str, size_t len) {
+  uint32_t hash = 2166136261UL;               // FNV-1a folded to 16 bits - collisions only cause a redundant scan
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (uint8_t)str[i];
+    hash *= 16777619UL;
+  }
+  return (uint16_t)(hash ^ (hash >> 16));
+}
+
+void RulesBuildTriggerFilter(uint32_t rule_set) {
+  Rules.filter_count[rule_set] = RULE_FILTER_SCAN_ALL;    // Scan everything until parsed successfully
+  Rules.filter_bloom[rule_set] = 0xFFFFFFFF;
+  bitClear(Rules.filter_stale, rule_set);
+
+  String rules = GetRule(rule_set);
+  rules.toUpperCase();
+  uint32_t count = 0;
+  uint32_t bloom = 0;
+  int plen = 0;
+  int plen2 = 0;
+  while (true) {
+    rules = rules.substring(plen);                        // Same block splitting as RuleSetProcess
+    rules.trim();
+    if (!rules.length()) { break; }                       // No more rules
+    if (!rules.startsWith(F("ON "))) { return; }          // Bad syntax - leave it to RuleSetProcess
+    int pevt = rules.indexOf(F(" DO "));
+    if (pevt == -1) { return; }
+    String trigger = rules.substring(3, pevt);
+    trigger.trim();
+
+    plen = rules.indexOf(F(" ENDON"));
+    plen2 = rules.indexOf(F(" BREAK"));
+    if ((plen == -1) && (plen2 == -1)) { return; }
+    if (plen == -1) { plen = 9999; }
+    if (plen2 == -1) { plen2 = 9999; }
+    plen = tmin(plen, plen2) + 6;
+
+    if (trigger.startsWith(F("TELE-"))) {                 // Matches the same event key during teleperiod
+      trigger = trigger.substring(5);
+    }
+    int pos = trigger.indexOf('#');
+    if (pos < 1) { return; }                              // No key segment - cannot classify
+    for (int i = 0; i < pos; i++) {
+      char c = trigger[i];
+      if (!isalnum(c) && ('_' != c)) { return; }          // Operator or placeholder in key segment - cannot classify
+    }
+    if (count >= RULE_MAX_FILTER_KEYS) { return; }        // Too many triggers - cheaper to just scan
+    uint16_t trigger_hash = RulesFilterHash(trigger.c_str(), pos);
+    bloom |= 1UL << (trigger_hash & 31);
+    Rules.filter_hash[rule_set][count++] = trigger_hash;
+  }
+  Rules.filter_count[rule_set] = count;
+  Rules.filter_bloom[rule_set] = bloom;
+}
+
+// Collect the hashes of the top-level JSON keys of an (uppercased) event
+// Returns 0 if the event cannot be analysed - caller must scan all rule sets
+uint32_t RulesEventKeys(const char *event, uint16_t *hash, uint32_t max_keys) {
+  uint32_t count = 0;
+  int32_t depth = 0;
+  bool in_string = false;
+  const char *key = nullptr;
+  for (const char *p = event; *p; p++) {
+    char c = *p;
+    if (in_string) {
+      if (('\\' == c) && p[1]) {
+        p++;                                              // Skip escaped character
+      }
+      else if ('"' == c) {
+        in_string = false;
+        if ((1 == depth) && key) {
+          const char *q = p + 1;
+          while ((' ' == *q) || ('\t' == *q)) { q++; }
+          if (':' == *q) {                                // String at depth 1 followed by colon is a top-level key
+            if (count >= max_keys) { return 0; }
+            hash[count++] = RulesFilterHash(key, p - key);
+          }
+          key = nullptr;
+        }
+      }
+    } else {
+      switch (c) {
+        case '"': in_string = true; key = p +1; break;
+        case '{': case '[': depth++; break;
+        case '}': case ']': depth--; break;
+      }
+    }
+  }
+  return count;
+}
+
+bool RulesSetMayMatch(uint32_t rule_set, uint32_t event_bloom, const uint16_t *event_hash, uint32_t event_hash_count) {
+  if (bitRead(Rules.filter_stale, rule_set)) {
+    RulesBuildTriggerFilter(rule_set);
+  }
+  if (RULE_FILTER_SCAN_ALL == Rules.filter_count[rule_set]) { return true; }
+  if (bitRead(Settings->rule_once, rule_set)) { return true; }    // Rule ONCE needs to see non-matching events
+  if (!(event_bloom & Rules.filter_bloom[rule_set])) { return false; }  // No event key bit overlaps any trigger key bit
+  for (uint32_t i = 0; i < Rules.filter_count[rule_set]; i++) {
+    for (uint32_t j = 0; j < event_hash_count; j++) {
+      if (Rules.filter_hash[rule_set][i] == event_hash[j]) { return true; }
+    }
+  }
+  return false;
+}
+
 /*******************************************************************************************/
 
 bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all_rules)
@@ -903,8 +1080,16 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event '%s'"), event_saved.c_str());
 #endif
 
+  uint16_t event_key_hash[RULE_MAX_FILTER_KEYS];
+  uint32_t event_key_count = RulesEventKeys(event_saved.c_str(), event_key_hash, RULE_MAX_FILTER_KEYS);
+  uint32_t event_bloom = 0;
+  for (uint32_t i = 0; i < event_key_count; i++) {
+    event_bloom |= 1UL << (event_key_hash[i] & 31);
+  }
+
   for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
     if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
+      if (event_key_count && !RulesSetMayMatch(i, event_bloom, event_key_hash, event_key_count)) { continue; }  // No trigger references any event key
       if (RuleSetProcess(i, event_saved)) { serviced = true; }
     }
   }
@@ -1441,7 +1626,7 @@ bool findNextVariableValue(char * &pVarname, float &value)
   if (sVarName.startsWith(F("VAR"))) {
     int index = sVarName.substring(3).toInt();
     if (index > 0 && index <= MAX_RULE_VARS) {
-      value = CharToFloat(rules_vars[index -1]);
+      value = RulesVarGetFloat(index -1);
     }
   } else if (sVarName.startsWith(F("MEM"))) {
     int index = sVarName.substring(3).toInt();
@@ -2098,7 +2283,7 @@ void ExecuteCommandBlock(const char * commands, int len)
 
     if (strlen(blcommand)) {
       //Insert into backlog
-      char* temp = (char*)malloc(strlen(blcommand)+1);
+      char* temp = (char*)HEAP_POOL_MALLOC(PSTR("backlog"), strlen(blcommand)+1);
       if (temp != nullptr) {
         strcpy(temp, blcommand);
         char* &elem = backlog.insertAt(insertPosition++);
@@ -2374,12 +2559,12 @@ void CmndVariable(void)
       if (XdrvMailbox.data_len > 0) {
 #ifdef USE_EXPRESSION
         if (XdrvMailbox.data[0] == '=') {  // Spaces already been skipped in data
-          dtostrfd(evaluateExpression(XdrvMailbox.data + 1, XdrvMailbox.data_len - 1), Settings->flag2.calc_resolution, rules_vars[XdrvMailbox.index -1]);
+          RulesVarSetFloat(XdrvMailbox.index -1, evaluateExpression(XdrvMailbox.data + 1, XdrvMailbox.data_len - 1));
         } else {
-          strlcpy(rules_vars[XdrvMailbox.index -1], ('"' == XdrvMailbox.data[0]) ? "" : XdrvMailbox.data, sizeof(rules_vars[XdrvMailbox.index -1]));
+          RulesVarSetText(XdrvMailbox.index -1, ('"' == XdrvMailbox.data[0]) ? "" : XdrvMailbox.data);
         }
 #else
-        strlcpy(rules_vars[XdrvMailbox.index -1], ('"' == XdrvMailbox.data[0]) ? "" : XdrvMailbox.data, sizeof(rules_vars[XdrvMailbox.index -1]));
+        RulesVarSetText(XdrvMailbox.index -1, ('"' == XdrvMailbox.data[0]) ? "" : XdrvMailbox.data);
 #endif  // USE_EXPRESSION
         bitSet(Rules.vars_event, XdrvMailbox.index -1);
       }
@@ -2425,8 +2610,7 @@ void CmndAddition(void)
 {
   if ((XdrvMailbox.index > 0) && (XdrvMailbox.index <= MAX_RULE_VARS)) {
     if (XdrvMailbox.data_len > 0) {
-      float tempvar = CharToFloat(rules_vars[XdrvMailbox.index -1]) + CharToFloat(XdrvMailbox.data);
-      dtostrfd(tempvar, Settings->flag2.calc_resolution, rules_vars[XdrvMailbox.index -1]);
+      RulesVarSetFloat(XdrvMailbox.index -1, RulesVarGetFloat(XdrvMailbox.index -1) + CharToFloat(XdrvMailbox.data));
       bitSet(Rules.vars_event, XdrvMailbox.index -1);
     }
     ResponseCmndIdxChar(rules_vars[XdrvMailbox.index -1]);
@@ -2437,8 +2621,7 @@ void CmndSubtract(void)
 {
   if ((XdrvMailbox.index > 0) && (XdrvMailbox.index <= MAX_RULE_VARS)) {
     if (XdrvMailbox.data_len > 0) {
-      float tempvar = CharToFloat(rules_vars[XdrvMailbox.index -1]) - CharToFloat(XdrvMailbox.data);
-      dtostrfd(tempvar, Settings->flag2.calc_resolution, rules_vars[XdrvMailbox.index -1]);
+      RulesVarSetFloat(XdrvMailbox.index -1, RulesVarGetFloat(XdrvMailbox.index -1) - CharToFloat(XdrvMailbox.data));
       bitSet(Rules.vars_event, XdrvMailbox.index -1);
     }
     ResponseCmndIdxChar(rules_vars[XdrvMailbox.index -1]);
@@ -2449,8 +2632,7 @@ void CmndMultiply(void)
 {
   if ((XdrvMailbox.index > 0) && (XdrvMailbox.index <= MAX_RULE_VARS)) {
     if (XdrvMailbox.data_len > 0) {
-      float tempvar = CharToFloat(rules_vars[XdrvMailbox.index -1]) * CharToFloat(XdrvMailbox.data);
-      dtostrfd(tempvar, Settings->flag2.calc_resolution, rules_vars[XdrvMailbox.index -1]);
+      RulesVarSetFloat(XdrvMailbox.index -1, RulesVarGetFloat(XdrvMailbox.index -1) * CharToFloat(XdrvMailbox.data));
       bitSet(Rules.vars_event, XdrvMailbox.index -1);
     }
     ResponseCmndIdxChar(rules_vars[XdrvMailbox.index -1]);
@@ -2470,7 +2652,7 @@ void CmndScale(void)
         float toLow = CharToFloat(ArgV(argument, 4));
         float toHigh = CharToFloat(ArgV(argument, 5));
         float value = map_float(valueIN, fromLow, fromHigh, toLow, toHigh);
-        dtostrfd(value, Settings->flag2.calc_resolution, rules_vars[XdrvMailbox.index -1]);
+        RulesVarSetFloat(XdrvMailbox.index -1, value);
         bitSet(Rules.vars_event, XdrvMailbox.index -1);
       } else {
         return;  // Command Error
@@ -88,6 +88,10 @@ const uint8_t SCRIPT_VERS[2] = {5, 3};
 #define SCRIPT_GC_OPTIONS_SIZE 320
 #endif
 
+#ifndef SCRIPT_GC_MAX_POINTS
+#define SCRIPT_GC_MAX_POINTS 500
+#endif
+
 #ifndef SCRIPT_WS_LINE_SIZE
 #define SCRIPT_WS_LINE_SIZE 256
 #endif
@@ -101,6 +105,9 @@ const uint8_t SCRIPT_VERS[2] = {5, 3};
 
 #define SCRIPT_EOL '\n'
 #define SCRIPT_FLOAT_PRECISION 2
+#ifndef SCRIPT_MAX_SECTIONS
+#define SCRIPT_MAX_SECTIONS 32    // size of section jump table, scripts with more sections fall back to scanning
+#endif
 #define PMEM_SIZE sizeof(Settings->script_pram)
 #define SCRIPT_MAXPERM (PMEM_SIZE)-4/sizeof(TS_FLOAT)
 #define MAX_SCRIPT_SIZE MAX_RULE_SIZE*MAX_RULE_SETS
@@ -636,6 +643,9 @@ typedef struct {
     char *html_script = 0;
     char *teleperiod = 0;
     char *web_pages[10];
+    char *section_index[SCRIPT_MAX_SECTIONS];  // pointers to all section headers in script order
+    char *section_index_script = 0;            // script the index was built for, 0 = index invalid
+    uint8_t section_index_count;
     uint32_t script_lastmillis;
     bool event_handeled = false;
     bool res_ivar = false;
@@ -950,6 +960,35 @@ uint32_t Script_Find_Vars(char *sp) {
 }
 
 
+// build the section jump table, called after the script is (re)loaded
+// Run_script_sub uses it to jump directly to a section header instead of lexing the whole
+// source on every call, the header itself is still matched and decoded by the interpreter
+void Script_Build_Section_Index(void) {
+  glob_script_mem.section_index_script = 0;
+  glob_script_mem.section_index_count = 0;
+  char *lp = glob_script_mem.scriptptr;
+  if (!lp) {
+    return;
+  }
+  while (*lp) {
+    while (*lp == '\t' || *lp == ' ') {
+      lp++;
+    }
+    if ((*lp == '>') || (*lp == '#')) {
+      if (glob_script_mem.section_index_count >= SCRIPT_MAX_SECTIONS) {
+        return;                       // too many sections, leave index invalid and scan as before
+      }
+      glob_script_mem.section_index[glob_script_mem.section_index_count++] = lp;
+    }
+    lp = strchr(lp, SCRIPT_EOL);
+    if (!lp) {
+      break;
+    }
+    lp++;
+  }
+  glob_script_mem.section_index_script = glob_script_mem.scriptptr;
+}
+
 // allocates all variables and presets them
 int16_t Init_Scripter(void) {
 char *script;
@@ -1432,6 +1471,7 @@ char *script;
     // store start of actual program here
     glob_script_mem.scriptptr = lp - 1;
     glob_script_mem.scriptptr_bu = glob_script_mem.scriptptr;
+    Script_Build_Section_Index();
 
 #ifdef USE_SCRIPT_GLOBVARS
     if (glob_script_mem.udp_flags.udp_used) {
@@ -7827,6 +7867,22 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
       check = 1;
     }
 
+    if (!section && (tlen > 1) && (glob_script_mem.section_index_script == glob_script_mem.scriptptr)) {
+      // jump directly to the section header recorded at load time instead of scanning the source
+      // tlen == 1 is excluded to keep the cmdline '>' special case working
+      char *sp = 0;
+      for (uint32_t cnt = 0; cnt < glob_script_mem.section_index_count; cnt++) {
+        if (!strncmp(glob_script_mem.section_index[cnt], type, tlen)) {
+          sp = glob_script_mem.section_index[cnt];
+          break;
+        }
+      }
+      if (sp) {
+        lp = sp;                      // the header is matched and decoded again below
+      } else {
+        return -1;                    // section not in script
+      }
+    }
 
     while (1) {
         // check line
@@ -11483,6 +11539,43 @@ uint16_t cipos = 0;
   return lp;
 }
 
+// downsample oversized chart arrays to SCRIPT_GC_MAX_POINTS with min/max binning so long
+// logs keep their spikes but page size and browser render time stay bounded.
+// replaces the array pointers with bins inside the returned buffer which the caller must free
+TS_FLOAT *gc_downsample(TS_FLOAT **arrays, uint8_t anum, uint16_t *rentries, uint16_t *rpos, uint8_t asflg) {
+  uint16_t entries = *rentries;
+  uint16_t bins = SCRIPT_GC_MAX_POINTS / 2;
+  TS_FLOAT *buf = (TS_FLOAT*)special_malloc(anum * bins * 2 * sizeof(TS_FLOAT));
+  if (!buf) {
+    return nullptr;
+  }
+  uint32_t start = (asflg) ? *rpos : 0;   // unroll the filter ring, oldest entry first
+  for (uint32_t ind = 0; ind < anum; ind++) {
+    TS_FLOAT *src = arrays[ind];
+    TS_FLOAT *dst = buf + (ind * bins * 2);
+    for (uint32_t bin = 0; bin < bins; bin++) {
+      uint32_t from = bin * (uint32_t)entries / bins;
+      uint32_t to = (bin + 1) * (uint32_t)entries / bins;
+      TS_FLOAT fmin = src[(start + from) % entries];
+      TS_FLOAT fmax = fmin;
+      uint32_t minpos = from;
+      uint32_t maxpos = from;
+      for (uint32_t cnt = from + 1; cnt < to; cnt++) {
+        TS_FLOAT fval = src[(start + cnt) % entries];
+        if (fval < fmin) { fmin = fval; minpos = cnt; }
+        if (fval > fmax) { fmax = fval; maxpos = cnt; }
+      }
+      // keep both extremes of the bin in their original time order
+      dst[bin * 2] = (minpos <= maxpos) ? fmin : fmax;
+      dst[bin * 2 + 1] = (minpos <= maxpos) ? fmax : fmin;
+    }
+    arrays[ind] = dst;
+  }
+  *rentries = bins * 2;
+  *rpos = 0;
+  return buf;
+}
+
 char *gc_send_labels(char *lp,uint32_t anum) {
   WSContentSend_P("[");
   for (uint32_t cnt = 0; cnt < anum + 1; cnt++) {
@@ -12326,6 +12419,7 @@ exgc:
         SCRIPT_SKIP_SPACES
 
         TS_FLOAT *arrays[MAX_GARRAY];
+        TS_FLOAT *dsbuf = nullptr;
         uint8_t anum = 0;
         uint16_t entries = 0;
         uint16_t ipos = 0;
@@ -12425,6 +12519,11 @@ exgc:
           asflg = 0;
         }
 
+        if (entries > SCRIPT_GC_MAX_POINTS) {
+          // reduce long logs server side before streaming them to the browser
+          dsbuf = gc_downsample(arrays, anum, &entries, &ipos, asflg);
+        }
+
         int16_t divflg = 1;
         int16_t todflg = -1;
         uint8_t hmflg = 0;
@@ -12519,6 +12618,7 @@ exgc:
         if (tonly) {
           WSContentSend_P("]);");
           if (options) free(options);
+          if (dsbuf) free(dsbuf);
           WS_LINE_RETURN
           //goto nextwebline;
         }
@@ -12591,6 +12691,7 @@ exgc:
         WSContentSend_P(SCRIPT_MSG_GTABLEbx, gc_str, glob_script_mem.chartindex);
         glob_script_mem.chartindex++;
         if (options) free(options);
+        if (dsbuf) free(dsbuf);
       } else {
         WSContentSend_P(PSTR("%s"), lin);
       }
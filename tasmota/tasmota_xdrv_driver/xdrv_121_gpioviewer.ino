@@ -89,6 +89,10 @@
 
 #define GV_KEEP_ALIVE         1000         // milliseconds - If no activity after this do a heap size event anyway
 
+#ifndef GV_NOISE_THRESHOLD
+#define GV_NOISE_THRESHOLD    4            // Minimum ADC/PWM counts change before a pin state event is streamed
+#endif
+
 const char *GVRelease = "1.6.2";
 
 /*********************************************************************************************/
@@ -592,7 +596,11 @@ void GVMonitorTask(void) {
       uint32_t pin_type = GetPin(pin) / 32;
       GV->lastPinStates[pin] = (pin_type != GPIO_NONE) ? -1 : originalValue;  // During init provide configured GPIOs fixing slow browsers
     }
-    if (originalValue != GV->lastPinStates[pin]) { 
+    int32_t delta = originalValue - GV->lastPinStates[pin];
+    if (delta < 0) { delta = -delta; }
+    // Suppress ADC/PWM noise retriggering events - a pending init (-1) is always streamed
+    uint32_t threshold = ((GV_AnalogPin == pintype) || (GV_PWMPin == pintype)) ? GV_NOISE_THRESHOLD : 1;
+    if (((uint32_t)delta >= threshold) || (GV->lastPinStates[pin] < 0)) {
       GV->pinmode[pin] = pinmode;
       if (hasChanges) { jsonMessage += ","; }
       jsonMessage += "\"" + String(pin) + "\":{\"s\":" + currentState + ",\"v\":" + originalValue + ",\"t\":" + pintype + "}";
@@ -214,6 +214,7 @@ const char kHAssError3[] PROGMEM =
   "HASS: Unable to create one or more entities from Json data, please check your configuration. Failed to parse";
 
 uint8_t hass_mode = 0;
+uint8_t hass_announce_step = 0;            // Discovery work queue position, 0 = idle
 int hass_tele_period = 0;
 
 /*********************************************************************************************\
@@ -1157,25 +1158,42 @@ void HAssDiscovery(void)
   if (Settings->flag.hass_discovery || (1 == hass_mode))
   { // SetOption19 - Control Home Assistantautomatic discovery (See SetOption59)
     hass_mode = 2; // Needed for generating bluetooth entities for MI_ESP32
+    hass_announce_step = 1; // Start the discovery work queue, one entity group per pass
+  }
+}
+
+void HAssAnnounceWork(void)
+{
+  // Discovery work queue. Generating all payloads in one go spikes the heap and blocks
+  // the loop for seconds on multi-relay devices, so send one entity group per 100ms pass.
+  switch (hass_announce_step++) {
+  case 1:
     // Send info about buttons
     HAssAnnounceButtons();
-
+    break;
+  case 2:
     // Send info about switches
     HAssAnnounceSwitches();
-
+    break;
+  case 3:
     // Send info about sensors
     HAssAnnounceSensors();
-
+    break;
+  case 4:
     // Send info about shutters
     HAssAnnounceShutters();
-
+    break;
+  case 5:
     // Send info about relays and lights
     HAssAnnounceRelayLight();
-
+    break;
+  default:
     // Send info about status sensor
     HAssAnnounceDeviceInfoAndStatusSensor();
     TasmotaGlobal.masterlog_level = 0; // Restores weblog level
     hass_mode = 3; // Needed for generating bluetooth entities for MI_ESP32
+    hass_announce_step = 0; // Queue done
+    break;
   }
 }
 
@@ -1257,13 +1275,18 @@ bool Xdrv12(uint32_t function)
   { // SetOption3 - Enable MQTT
     switch (function)
     {
+    case FUNC_EVERY_100_MSECOND:
+      if (hass_announce_step) {
+        HAssAnnounceWork(); // Drain the discovery work queue one entity group at a time
+      }
+      break;
     case FUNC_EVERY_SECOND:
       if (TasmotaGlobal.discovery_counter)
       {
         TasmotaGlobal.discovery_counter--;
         if (!TasmotaGlobal.discovery_counter)
         {
-          HAssDiscovery(); // Scheduled discovery using available resources
+          HAssDiscovery(); // Scheduled discovery, queues the announces using available resources
           NewHAssDiscovery(); // Send the topics for Home Assistant Official Integration
         }
       }
@@ -978,7 +978,7 @@ extern FS *ffsp;
                     if (fp > 0) {
                       uint32_t size = fp.size();
                       if (ram_font) free (ram_font);
-                      ram_font = (uint8_t*)special_malloc(size + 4);
+                      ram_font = (uint8_t*)special_malloc_tag(PSTR("display"), size + 4);
                       fp.read((uint8_t*)ram_font, size);
                       fp.close();
                       if (renderer) renderer->SetRamfont(ram_font);
@@ -1926,12 +1926,16 @@ void DisplaySetPower(void) {
 \*********************************************************************************************/
 
 void CmndDisplay(void) {
+  uint32_t glyph_hits;
+  uint32_t glyph_misses;
+  Renderer::GlyphCacheStats(&glyph_hits, &glyph_misses);    // glyph cache diagnostics, [hits,misses]
   Response_P(PSTR("{\"" D_PRFX_DISPLAY "\":{\"" D_CMND_DISP_MODEL "\":%d,\"" D_CMND_DISP_TYPE "\":%d,\"" D_CMND_DISP_WIDTH "\":%d,\"" D_CMND_DISP_HEIGHT "\":%d,\""
     D_CMND_DISP_MODE "\":%d,\"" D_CMND_DISP_DIMMER "\":%d,\"" D_CMND_DISP_SIZE "\":%d,\"" D_CMND_DISP_FONT "\":%d,\""
-    D_CMND_DISP_ROTATE "\":%d,\"" D_CMND_DISP_INVERT "\":%d,\"" D_CMND_DISP_REFRESH "\":%d,\"" D_CMND_DISP_COLS "\":[%d,%d],\"" D_CMND_DISP_ROWS "\":%d}}"),
+    D_CMND_DISP_ROTATE "\":%d,\"" D_CMND_DISP_INVERT "\":%d,\"" D_CMND_DISP_REFRESH "\":%d,\"" D_CMND_DISP_COLS "\":[%d,%d],\"" D_CMND_DISP_ROWS "\":%d,\"GlyphCache\":[%u,%u]}}"),
     Settings->display_model, Settings->display_options.type, Settings->display_width, Settings->display_height,
     Settings->display_mode, GetDisplayDimmer(), Settings->display_size, Settings->display_font,
-    Settings->display_rotate, Settings->display_options.invert, Settings->display_refresh, Settings->display_cols[0], Settings->display_cols[1], Settings->display_rows);
+    Settings->display_rotate, Settings->display_options.invert, Settings->display_refresh, Settings->display_cols[0], Settings->display_cols[1], Settings->display_rows,
+    glyph_hits, glyph_misses);
 }
 
 void CmndDisplayModel(void) {
@@ -2301,6 +2305,7 @@ char ppath[16];
 #include "esp_jpg_decode.h"
 bool jpg2rgb888(const uint8_t *src, size_t src_len, uint8_t * out, jpg_scale_t scale);
 bool jpg2rgb565(const uint8_t *src, size_t src_len, uint8_t * out, jpg_scale_t scale);
+bool jpg2display(const uint8_t *src, size_t src_len, uint16_t xp, uint16_t yp, uint8_t scale, bool inverted);
 char get_jpeg_size(unsigned char* data, unsigned int data_size, unsigned short *width, unsigned short *height);
 #endif // JPEG_PICTS
 #endif // ESP32
@@ -2310,6 +2315,183 @@ char get_jpeg_size(unsigned char* data, unsigned int data_size, unsigned short *
 #ifdef USE_UFILESYS
 extern FS *ufsp;
 #define XBUFF_LEN 128
+
+#if defined(ESP32) && defined(JPEG_PICTS)
+#ifdef USE_DISPLAY_IMG_CACHE
+/*********************************************************************************************\
+ * Image conversion cache
+ *
+ * Jpg files are decoded once, converted to the raw RGB565 layout of the .rgb format and
+ * stored hash-keyed on the filesystem; subsequent draws blit the blob directly. The most
+ * recently drawn blob additionally stays in RAM (PSRAM preferred) and skips the filesystem.
+\*********************************************************************************************/
+
+#ifndef DISPLAY_IMG_CACHE_DIR
+#define DISPLAY_IMG_CACHE_DIR "/.dcache"
+#endif
+#ifndef DISPLAY_IMG_CACHE_MAX_PIXELS
+#define DISPLAY_IMG_CACHE_MAX_PIXELS (160 * 160)  // Largest image converted to a cached blob
+#endif
+
+struct {
+  uint32_t key = 0;            // Key of the blob held in ram
+  uint16_t xsize = 0;
+  uint16_t ysize = 0;
+  uint16_t *blob = nullptr;    // Hot copy of the most recently drawn blob
+} DispImgCache;
+
+void DrawImgCacheName(uint32_t key, char *name, size_t len) {
+  snprintf_P(name, len, PSTR(DISPLAY_IMG_CACHE_DIR "/%08x.rgb"), key);
+}
+
+uint32_t DrawImgCacheKey(const char *file, uint32_t fsize, bool inverted) {
+  char key[64];
+  snprintf_P(key, sizeof(key), PSTR("%s|%u|%d"), file, fsize, inverted);
+  return GetHash(key, strlen(key));
+}
+
+// Blit a cached blob, from ram when hot else from the filesystem. Returns false on cache miss
+bool DrawImgCacheBlit(uint32_t key, uint16_t xp, uint16_t yp) {
+  if ((DispImgCache.key != key) || (nullptr == DispImgCache.blob)) {
+    char name[32];
+    DrawImgCacheName(key, name, sizeof(name));
+    File fp = ufsp->open(name, FS_FILE_READ);
+    if (!fp) return false;
+    uint16_t xsize = 0;
+    fp.read((uint8_t*)&xsize, 2);
+    uint16_t ysize = 0;
+    fp.read((uint8_t*)&ysize, 2);
+    if (!xsize || !ysize) {
+      fp.close();
+      return false;
+    }
+    uint16_t *blob = (uint16_t *)special_malloc_tag(PSTR("display"), xsize * ysize * 2);
+    if (!blob) {
+      fp.close();
+      return false;
+    }
+    fp.read((uint8_t*)blob, xsize * ysize * 2);
+    fp.close();
+    free(DispImgCache.blob);
+    DispImgCache.blob = blob;
+    DispImgCache.xsize = xsize;
+    DispImgCache.ysize = ysize;
+    DispImgCache.key = key;
+  }
+  renderer->setAddrWindow(xp, yp, xp + DispImgCache.xsize, yp + DispImgCache.ysize);
+  renderer->pushColors(DispImgCache.blob, DispImgCache.xsize * DispImgCache.ysize, true);
+  renderer->setAddrWindow(0, 0, 0, 0);
+  OsWatchLoop();
+  return true;
+}
+
+// Install a converted blob as hot copy and persist it on the filesystem
+void DrawImgCacheInstall(uint32_t key, uint16_t *blob, uint16_t xsize, uint16_t ysize) {
+  if (!ufsp->exists(DISPLAY_IMG_CACHE_DIR)) {
+    ufsp->mkdir(DISPLAY_IMG_CACHE_DIR);
+  }
+  char name[32];
+  DrawImgCacheName(key, name, sizeof(name));
+  File fp = ufsp->open(name, FS_FILE_WRITE);
+  if (fp) {
+    fp.write((uint8_t*)&xsize, 2);
+    fp.write((uint8_t*)&ysize, 2);
+    fp.write((uint8_t*)blob, xsize * ysize * 2);
+    fp.close();
+  }
+  free(DispImgCache.blob);
+  DispImgCache.blob = blob;
+  DispImgCache.xsize = xsize;
+  DispImgCache.ysize = ysize;
+  DispImgCache.key = key;
+}
+
+// Decode a jpg and convert it to a RGB565 blob. Returns nullptr when the decode fails
+uint16_t *DrawImgCacheConvert(const uint8_t *jpg, size_t len, uint32_t pixels, bool inverted) {
+  uint8_t *rgb888 = (uint8_t *)special_malloc(pixels * 3);
+  if (!rgb888) return nullptr;
+  uint16_t *blob = nullptr;
+  if (jpg2rgb888(jpg, len, rgb888, JPG_SCALE_NONE)) {
+    blob = (uint16_t *)special_malloc(pixels * 2);
+    if (blob) {
+      if (inverted) {
+        rgb888_to_565i(rgb888, blob, pixels);
+      } else {
+        rgb888_to_565(rgb888, blob, pixels);
+      }
+    }
+  }
+  free(rgb888);
+  return blob;
+}
+
+#if defined(USE_OFFLOAD_EXECUTOR) && !defined(CORE32SOLO1)
+struct {
+  volatile bool busy = false;  // Copy submitted and not yet adopted
+  volatile bool done = false;  // Worker finished, result ready for adoption
+  bool inverted;
+  uint32_t key;
+  uint16_t xsize;
+  uint16_t ysize;
+  size_t len;
+  uint8_t *jpg = nullptr;      // Worker owned copy of the jpg data
+  uint16_t *blob = nullptr;    // Conversion result, nullptr when the decode failed
+} DispImgCacheJob;
+
+// Runs on the offload task. Touches only the job record and the heap - no filesystem,
+// Settings or other loop-owned state (hence special_malloc, tag accounting is not locked)
+void DrawImgCacheDecode(void *arg) {
+  DispImgCacheJob.blob = DrawImgCacheConvert(DispImgCacheJob.jpg, DispImgCacheJob.len,
+                                             DispImgCacheJob.xsize * DispImgCacheJob.ysize, DispImgCacheJob.inverted);
+  free(DispImgCacheJob.jpg);
+  DispImgCacheJob.jpg = nullptr;
+  DispImgCacheJob.done = true;
+}
+
+// Install a conversion finished on the offload task, polled from loop context
+void DrawImgCacheAdopt(void) {
+  if (!DispImgCacheJob.done) return;
+  DispImgCacheJob.done = false;
+  if (DispImgCacheJob.blob) {
+    DrawImgCacheInstall(DispImgCacheJob.key, DispImgCacheJob.blob, DispImgCacheJob.xsize, DispImgCacheJob.ysize);
+    DispImgCacheJob.blob = nullptr;
+  }
+  DispImgCacheJob.busy = false;
+}
+#endif // USE_OFFLOAD_EXECUTOR
+
+// Decode a jpg once, convert to RGB565 and keep the blob on the filesystem and as hot copy
+void DrawImgCacheStore(uint32_t key, const uint8_t *jpg, size_t len, uint16_t xsize, uint16_t ysize, bool inverted) {
+  if ((uint32_t)xsize * ysize > DISPLAY_IMG_CACHE_MAX_PIXELS) return;   // too big, keep using streaming decode
+#if defined(USE_OFFLOAD_EXECUTOR) && !defined(CORE32SOLO1)
+  if (!DispImgCacheJob.busy) {
+    // Hand decode and conversion to the offload task. The caller streams the image to the
+    // panel this one time and blits the blob from the next draw on
+    uint8_t *copy = (uint8_t *)special_malloc_tag(PSTR("display"), len);
+    if (copy) {
+      memcpy(copy, jpg, len);
+      DispImgCacheJob.key = key;
+      DispImgCacheJob.xsize = xsize;
+      DispImgCacheJob.ysize = ysize;
+      DispImgCacheJob.inverted = inverted;
+      DispImgCacheJob.jpg = copy;
+      DispImgCacheJob.len = len;
+      DispImgCacheJob.done = false;
+      DispImgCacheJob.busy = true;
+      if (OffloadCall(DrawImgCacheDecode, nullptr)) return;
+      DispImgCacheJob.jpg = nullptr;     // Executor unavailable or queue full, convert inline
+      DispImgCacheJob.busy = false;
+      free(copy);
+    }
+  }
+#endif // USE_OFFLOAD_EXECUTOR
+  uint16_t *blob = DrawImgCacheConvert(jpg, len, xsize * ysize, inverted);
+  if (!blob) return;
+  DrawImgCacheInstall(key, blob, xsize, ysize);
+}
+#endif // USE_DISPLAY_IMG_CACHE
+#endif // ESP32 && JPEG_PICTS
+
 void Draw_RGB_Bitmap(char *file, uint16_t xp, uint16_t yp, uint8_t scale, bool inverted, uint16_t xs, uint16_t ys ) {
   if (!renderer) return;
   File fp;
@@ -2383,7 +2565,7 @@ void Draw_RGB_Bitmap(char *file, uint16_t xp, uint16_t yp, uint8_t scale, bool i
       return;
     }
     uint32_t size = fp.size();
-    uint8_t *mem = (uint8_t *)special_malloc(size + 4);
+    uint8_t *mem = (uint8_t *)special_malloc_tag(PSTR("display"), size + 4);
     if (mem) {
       uint8_t res = fp.read(mem, size);
       if (res) {
@@ -2402,31 +2584,19 @@ void Draw_RGB_Bitmap(char *file, uint16_t xp, uint16_t yp, uint8_t scale, bool i
           }
           //Serial.printf(" x,y,fs %d - %d - %d\n",xsize, ysize, size );
           if (xsize && ysize) {
-            uint8_t *out_buf = (uint8_t *)special_malloc((xsize * ysize * 3) + 4);
-            if (out_buf) {
-              uint16_t *pixb = (uint16_t *)special_malloc((xsize * 2) + 4);
-              if (pixb) {
-                uint8_t *ob = out_buf;
-                if (jpg2rgb888(mem, size, out_buf, (jpg_scale_t)JPG_SCALE_NONE)) {
-                  renderer->setAddrWindow(xp, yp, xp + xsize, yp + ysize);
-                  for (int32_t j = 0; j < ysize; j++) {
-                    if (inverted == false) {
-                      rgb888_to_565(ob, pixb, xsize);
-                    } else {
-                      rgb888_to_565i(ob, pixb, xsize);
-                    }
-                    ob += xsize * 3;
-                    renderer->pushColors(pixb, xsize, true);
-                    OsWatchLoop();
-                  }
-                  renderer->setAddrWindow(0, 0, 0, 0);
-                }
-                free(out_buf);
-                free(pixb);
-              } else {
-                free(out_buf);
+#ifdef USE_DISPLAY_IMG_CACHE
+            // blit the pre-converted blob when available, convert on first use
+            uint32_t key = DrawImgCacheKey(file, size, inverted);
+            if (!DrawImgCacheBlit(key, xp, yp)) {
+              DrawImgCacheStore(key, mem, size, xsize, ysize, inverted);
+              if (!DrawImgCacheBlit(key, xp, yp)) {
+                jpg2display(mem, size, xp, yp, 0, inverted);
               }
             }
+#else
+            // stream decoded bands straight to the panel, no full-size decode buffer
+            jpg2display(mem, size, xp, yp, 0, inverted);
+#endif // USE_DISPLAY_IMG_CACHE
           }
           if (scale) {
             if (renderer) renderer->drawRect(xp, yp, xsize, ysize, GetColorFromIndex(scale));
@@ -2446,23 +2616,8 @@ void Draw_RGB_Bitmap(char *file, uint16_t xp, uint16_t yp, uint8_t scale, bool i
 #define JPG_DEFSIZE 150000
 void Draw_jpeg(uint8_t *mem, uint16_t jpgsize, uint16_t xp, uint16_t yp, uint8_t scale) {
   if (mem[0] == 0xff && mem[1] == 0xd8) {
-    uint16_t xsize;
-    uint16_t ysize;
-    get_jpeg_size(mem, jpgsize, &xsize, &ysize);
-    //AddLog(LOG_LEVEL_INFO, PSTR("Pict size %d - %d - %d"), xsize, ysize, jpgsize);
-    scale &= 3;
-    uint8_t fac = 1 << scale;
-    xsize /= fac;
-    ysize /= fac;
-    renderer->setAddrWindow(xp, yp, xp + xsize, yp + ysize);
-    uint8_t *rgbmem = (uint8_t *)special_malloc(xsize * ysize * 2);
-    if (rgbmem) {
-      //jpg2rgb565(mem, jpgsize, rgbmem, JPG_SCALE_NONE);
-      jpg2rgb565(mem, jpgsize, rgbmem, (jpg_scale_t)scale);
-      renderer->pushColors((uint16_t*)rgbmem, xsize * ysize, true);
-      free(rgbmem);
-    }
-    renderer->setAddrWindow(0, 0, 0, 0);
+    // the decoder scales by 1 << scale and the bands go straight to the panel
+    jpg2display(mem, jpgsize, xp, yp, scale & 3, false);
   }
 }
 
@@ -2477,7 +2632,7 @@ void Draw_JPG_from_URL(char *url, uint16_t xp, uint16_t yp, uint8_t scale) {
   //AddLog(LOG_LEVEL_INFO, PSTR("HTTP RESULT %d %s"), httpCode , weburl.c_str());
   uint32_t jpgsize = 0;
   if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY) {
-    mem = (uint8_t *)special_malloc(JPG_DEFSIZE);
+    mem = (uint8_t *)special_malloc_tag(PSTR("display"), JPG_DEFSIZE);
     if (!mem) return;
     uint8_t *jpgp = mem;
     WiFiClient *stream = http.getStreamPtr();
@@ -2927,7 +3082,10 @@ bool Xdrv13(uint32_t function) {
         }
         break;
       case FUNC_EVERY_50_MSECOND:
-        if (Settings->display_model) { 
+#if defined(USE_UFILESYS) && defined(ESP32) && defined(JPEG_PICTS) && defined(USE_DISPLAY_IMG_CACHE) && defined(USE_OFFLOAD_EXECUTOR) && !defined(CORE32SOLO1)
+        DrawImgCacheAdopt();               // Install image conversions finished on the offload task
+#endif
+        if (Settings->display_model) {
           XdspCall(FUNC_DISPLAY_EVERY_50_MSECOND);
         }
         break;
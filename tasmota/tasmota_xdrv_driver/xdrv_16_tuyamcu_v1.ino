@@ -1689,7 +1689,10 @@ bool Xdrv16(uint32_t function) {
     switch (function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
-        if (TuyaSerial) { TuyaSerialInput(); }
+        if (TuyaSerial) {
+          TuyaSerialInput();
+          SleepRequestWake(1);           // Drain the MCU uart every millisecond to prevent buffer overrun
+        }
         break;
       case FUNC_PRE_INIT:
         TuyaInit();
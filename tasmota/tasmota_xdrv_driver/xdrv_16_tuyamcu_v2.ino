@@ -128,6 +128,9 @@
 
 #define TUYA_BUFFER_SIZE       256
 
+// drop a desired DP value after this many unacknowledged sends
+#define TUYA_SET_DP_RETRIES    3
+
 #define TUYA_BYTE_TIMEOUT_MS   500
 
 #define HEARTBEAT_INTERVAL_S   15
@@ -178,6 +181,10 @@ typedef struct TUYA_DP_STORE_tag {
   uint8_t toSet;
   // flag to indicate we saw it at least once from MCU.
   uint8_t rxed;
+  // set while a batched TUYA_CMD_SET_DP carrying this DP awaits its ack
+  uint8_t inFlight;
+  // consecutive unacknowledged sends of the current desired value
+  uint8_t sendRetries;
 } TUYA_DP_STORE;
 
 typedef struct TUYA_STRUCT_tag {
@@ -246,6 +253,11 @@ typedef struct TUYA_STRUCT_tag {
 
   uint8_t last_button;
 
+  // direct-index dpId->fnId table, rebuilt on demand when the fnid map changes.
+  // saves scanning Settings->tuya_fnid_map for every received DP unit.
+  uint8_t fnid_cache[256];
+  uint8_t fnid_cache_valid;
+
   int sends;
   int rxs;
 
@@ -634,6 +646,9 @@ void TuyaAddMcuFunc(uint8_t fnId, uint8_t dpId) {
     }
   }
   UpdateDevices();
+  if (pTuya) {
+    pTuya->fnid_cache_valid = 0;
+  }
 }
 
 void UpdateDevices() {
@@ -665,6 +680,18 @@ inline bool TuyaFuncIdValid(uint8_t fnId) {
 }
 
 uint8_t TuyaGetFuncId(uint8_t dpid) {
+  if (pTuya) {
+    if (!pTuya->fnid_cache_valid) {
+      memset(pTuya->fnid_cache, TUYA_MCU_FUNC_NONE, sizeof(pTuya->fnid_cache));
+      for (uint8_t i = 0; i < MAX_TUYA_FUNCTIONS; i++) {
+        if (Settings->tuya_fnid_map[i].dpid > 0) {
+          pTuya->fnid_cache[Settings->tuya_fnid_map[i].dpid] = Settings->tuya_fnid_map[i].fnid;
+        }
+      }
+      pTuya->fnid_cache_valid = 1;
+    }
+    return pTuya->fnid_cache[dpid];
+  }
   for (uint8_t i = 0; i < MAX_TUYA_FUNCTIONS; i++) {
     if (Settings->tuya_fnid_map[i].dpid == dpid) {
       return Settings->tuya_fnid_map[i].fnid;
@@ -882,9 +909,12 @@ void Tuya_statemachine(int cmd = -1, int len = 0, unsigned char *payload = (unsi
         //TuyaSendLowPowerSuccessIfNeeded();
       }
 
-      // send any DP chang requests
+      // send any DP chang requests, batched into one SET_DP frame
       // only if different from the received or last send values
       int i;
+      int payload_len = 0;
+      int batched = 0;
+      uint8_t payload_buffer[TUYA_MAX_STORED_DPs * (4 + TUYA_MAX_STRING_SIZE)];
       for (i = 0; i < pTuya->numRxedDPids; i++){
         TUYA_DP_STORE *dp = &pTuya->DPStore[i];
         // if set requested, and MCU has reported at least once
@@ -917,32 +947,52 @@ void Tuya_statemachine(int cmd = -1, int len = 0, unsigned char *payload = (unsi
             }
 
             if (send){
-              TuyaSendState(dp->DPid,
+              if (dp->sendRetries >= TUYA_SET_DP_RETRIES){
+                AddLog(LOG_LEVEL_ERROR, PSTR("TYA: DP%d set unacked after %d sends - dropped"), dp->DPid, dp->sendRetries);
+                dp->toSet = 0;
+                dp->inFlight = 0;
+                dp->sendRetries = 0;
+                continue;
+              }
+              int newlen = TuyaAppendDpUnit(payload_buffer, payload_len, sizeof(payload_buffer), dp->DPid,
                 dp->Type,
                 (uint8_t*)dp->desiredValue, dp->desiredValueLen);
-              // assume it worked? maybe not
-              //dp->rxedValueLen = dp->desiredValueLen;
-              //memcpy(dp->rxedValue, dp->desiredValue, dp->desiredValueLen);
-              dp->toSet = 0;
-              pTuya->expectedResponseCmd = TUYA_CMD_STATE;
-              pTuya->timeout = 300;
-              pTuya->timeout_state = TUYA_STARTUP_STATE_SEND_CMD;
-              pTuya->startup_state = TUYA_STARTUP_STATE_WAIT_ACK_CMD;
-#ifdef TUYA_MORE_DEBUG
-              MqttPublishLoggingAsync(false);
-              SyslogAsync(false);
-#endif
-
-              break;
+              if (newlen < 0){
+                // no room - leave remainder toSet for the next pass
+                break;
+              }
+              payload_len = newlen;
+              // toSet is cleared on ack, or dropped after TUYA_SET_DP_RETRIES sends
+              dp->inFlight = 1;
+              dp->sendRetries++;
+              batched++;
             }
           } else {
             // if equal values, ignore set
             AddLog(LOG_LEVEL_DEBUG, PSTR("TYA: DPset ign-same value dp%d=0x%x,%d"), dp->DPid, dp->desiredValue[0], dp->desiredValueLen);
             dp->toSet = 0;
+            dp->inFlight = 0;
+            dp->sendRetries = 0;
           }
         }
       }
 
+      if (payload_len){
+        TuyaSendCmd(TUYA_CMD_SET_DP, payload_buffer, payload_len);
+        if (batched > 1){
+          AddLog(LOG_LEVEL_DEBUG, PSTR("TYA: %d DP sets batched in one frame"), batched);
+        }
+        pTuya->expectedResponseCmd = TUYA_CMD_STATE;
+        pTuya->timeout = 300;
+        pTuya->timeout_state = TUYA_STARTUP_STATE_SEND_CMD;
+        pTuya->startup_state = TUYA_STARTUP_STATE_WAIT_ACK_CMD;
+#ifdef TUYA_MORE_DEBUG
+        MqttPublishLoggingAsync(false);
+        SyslogAsync(false);
+#endif
+        break;
+      }
+
       // triggered from second timer
       if (pTuya->send_heartbeat) {
         pTuya->send_heartbeat = 0;
@@ -953,6 +1003,16 @@ void Tuya_statemachine(int cmd = -1, int len = 0, unsigned char *payload = (unsi
 
     case TUYA_STARTUP_STATE_WAIT_ACK_CMD:
       if (cmd == pTuya->expectedResponseCmd){
+        // the state report acks the batched SET_DP frame.
+        // DPs posted again while in flight had inFlight cleared, so keep their toSet.
+        for (int j = 0; j < pTuya->numRxedDPids; j++){
+          TUYA_DP_STORE *dp = &pTuya->DPStore[j];
+          if (dp->inFlight){
+            dp->toSet = 0;
+            dp->inFlight = 0;
+            dp->sendRetries = 0;
+          }
+        }
         pTuya->timeout = 0;
         pTuya->timeout_state = TUYA_STARTUP_STATE_SEND_CMD;
         pTuya->startup_state = TUYA_STARTUP_STATE_SEND_CMD;
@@ -1057,6 +1117,8 @@ void TuyaPostState(uint8_t id, uint8_t type, uint8_t *value, int len = 4){
           memcpy(dp->desiredValue, value, len);
           dp->desiredValueLen = len;
           dp->toSet = 1;
+          dp->inFlight = 0;     // a pending ack no longer covers this value
+          dp->sendRetries = 0;
           AddLog(LOG_LEVEL_DEBUG, PSTR("TYA: DP%d des v set (0x%x,%d)"), id, dp->desiredValue[0], dp->desiredValueLen);
 
           if (TuyaDpIdIsDimmer(id)){
@@ -1082,6 +1144,8 @@ void TuyaPostState(uint8_t id, uint8_t type, uint8_t *value, int len = 4){
         memcpy(dp->desiredValue, value, len);
         dp->desiredValueLen = len;
         dp->toSet = 1;
+        dp->inFlight = 0;
+        dp->sendRetries = 0;
         AddLog(LOG_LEVEL_DEBUG, PSTR("TYA: NEW DP %d desiredvalue set (0x%08x len %d)"), id, dp->desiredValue[0], dp->desiredValueLen);
       } else {
         AddLog(LOG_LEVEL_ERROR, PSTR("TYA: DP %d value over len (%d > %d)"), id, len, TUYA_MAX_STRING_SIZE);
@@ -1113,47 +1177,52 @@ void TuyaPostState(uint8_t id, uint8_t type, uint8_t *value, int len = 4){
 }
 
 
-// note - direct send using TuyaSendCmd
-void TuyaSendState(uint8_t id, uint8_t type, uint8_t* value, int len)
+// appends one self-describing DP unit (id, type, len16, data) to a
+// TUYA_CMD_SET_DP payload under construction - the MCU accepts several
+// units concatenated in a single 0x06 frame.
+// returns the new payload length, or -1 if the unit is invalid or does not fit.
+int TuyaAppendDpUnit(uint8_t *buffer, int payload_len, int buffer_len, uint8_t id, uint8_t type, uint8_t* value, int len)
 {
-  uint16_t payload_len = 4;
-  uint8_t payload_buffer[8+TUYA_MAX_STRING_SIZE];
-  payload_buffer[0] = id;
-  payload_buffer[1] = type;
+  int data_len = 0;
   switch (type) {
     case TUYA_TYPE_BOOL:
     case TUYA_TYPE_ENUM:
-      payload_len += 1;
-      payload_buffer[2] = 0x00;
-      payload_buffer[3] = 0x01;
-      payload_buffer[4] = value[0];
+      data_len = 1;
       break;
     case TUYA_TYPE_VALUE:
-      payload_len += 4;
-      payload_buffer[2] = 0x00;
-      payload_buffer[3] = 0x04;
-      // note - already reversed
-      payload_buffer[4] = value[0];
-      payload_buffer[5] = value[1];
-      payload_buffer[6] = value[2];
-      payload_buffer[7] = value[3];
+      data_len = 4;
       break;
     case TUYA_TYPE_STRING:
     case TUYA_TYPE_RAW:
-      payload_buffer[2] = len >> 8;
-      payload_buffer[3] = len & 0xFF;
-
-      if (len <= TUYA_MAX_STRING_SIZE){
-        for (uint16_t i = 0; i < len; i++) {
-          payload_buffer[payload_len++] = value[i];
-        }
-      } else {
+      if (len > TUYA_MAX_STRING_SIZE){
         AddLog(LOG_LEVEL_ERROR, PSTR("TYA: SendState: DP %d value over len (%d > %d)"), id, len, TUYA_MAX_STRING_SIZE);
-        return;
+        return -1;
       }
+      data_len = len;
       break;
   }
+  if (payload_len + 4 + data_len > buffer_len){
+    return -1;
+  }
+  buffer[payload_len++] = id;
+  buffer[payload_len++] = type;
+  buffer[payload_len++] = data_len >> 8;
+  buffer[payload_len++] = data_len & 0xFF;
+  // note - value types already reversed
+  for (int i = 0; i < data_len; i++) {
+    buffer[payload_len++] = value[i];
+  }
+  return payload_len;
+}
 
+// note - direct send using TuyaSendCmd
+void TuyaSendState(uint8_t id, uint8_t type, uint8_t* value, int len)
+{
+  uint8_t payload_buffer[8+TUYA_MAX_STRING_SIZE];
+  int payload_len = TuyaAppendDpUnit(payload_buffer, 0, sizeof(payload_buffer), id, type, value, len);
+  if (payload_len <= 0){
+    return;
+  }
   TuyaSendCmd(TUYA_CMD_SET_DP, payload_buffer, payload_len);
 }
 
@@ -2481,7 +2550,10 @@ bool Xdrv16(uint32_t function) {
     switch (function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
-        if (TuyaSerial) { TuyaSerialInput(); }
+        if (TuyaSerial) {
+          TuyaSerialInput();
+          SleepRequestWake(1);           // Drain the MCU uart every millisecond to prevent buffer overrun
+        }
         break;
       case FUNC_PRE_INIT:
         TuyaInit();
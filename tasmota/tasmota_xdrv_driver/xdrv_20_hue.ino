@@ -502,6 +502,72 @@ char     prev_x_str[24] = "\0"; // store previously set xy by Alexa app
 char     prev_y_str[24] = "\0";
 
 #ifdef USE_LIGHT
+/*********************************************************************************************\
+ * Per-light response cache
+ *
+ * Echo devices poll /api/<user>/lights aggressively and each poll used to rebuild every
+ * light description with Unishox decompression and String concatenation. The fragment for
+ * each light is cached and only rebuilt when a signature over its inputs changes.
+\*********************************************************************************************/
+
+struct HUEFRAGMENT {
+  char* buf = nullptr;          // malloc'ed "{\"state\":...}" fragment for one light
+  uint16_t len = 0;
+  uint32_t signature = 0;
+};
+HUEFRAGMENT hue_fragment[MAX_HUE_DEVICES];
+uint16_t hue_fragment_total = 0;  // Total length of all cached fragments, used to presize the response
+
+uint32_t HueLightSignature(uint8_t device) {
+  // Combine every input that shapes the per-light JSON so the cached fragment
+  // self-invalidates on any state, name or option change
+  uint32_t sig = (TasmotaGlobal.power >> (device -1)) & 1;
+  sig = (sig * 31) + LightGetBri(device);
+  if (TasmotaGlobal.light_type) {
+    uint8_t sat;
+    light_state.getHSB(nullptr, &sat, nullptr);
+    sig = (sig * 31) + light_state.getHue16();
+    sig = (sig * 31) + sat;
+    sig = (sig * 31) + light_state.getCT();
+    sig = (sig * 31) + light_state.getColorMode();
+  }
+  sig = (sig * 31) + (g_gotct ? 1 : 0);
+  sig = (sig * 31) + Settings->flag4.alexa_gen_1;  // SetOption109
+  sig ^= GetHash(prev_x_str, strlen(prev_x_str));
+  sig ^= GetHash(prev_y_str, strlen(prev_y_str));
+  const char* fname = SettingsText(device <= MAX_FRIENDLYNAMES ? SET_FRIENDLYNAME1 + device -1 : SET_FRIENDLYNAME1 + MAX_FRIENDLYNAMES -1);
+  sig ^= GetHash(fname, strlen(fname));
+  sig ^= GetHash(Settings->user_template_name, strlen(Settings->user_template_name));
+#ifdef USE_SHUTTER
+  if (ShutterState(device)) {
+    sig = (sig * 31) + Settings->shutter_position[device -1];
+  }
+#endif  // USE_SHUTTER
+  return sig;
+}
+
+void HueLightFragment(uint8_t device, String* response) {
+  // Append the "{"state":...}" fragment for one light, from cache while unchanged
+  HUEFRAGMENT& cache = hue_fragment[device -1];
+  uint32_t signature = HueLightSignature(device);
+  if (!cache.buf || (cache.signature != signature)) {
+    String fragment = F("{\"state\":");
+    HueLightStatus1(device, &fragment);
+    HueLightStatus2(device, &fragment);
+    char* buf = (char*)realloc(cache.buf, fragment.length() +1);
+    if (buf == nullptr) {
+      *response += fragment;    // Out of memory - respond uncached
+      return;
+    }
+    strcpy(buf, fragment.c_str());
+    hue_fragment_total += fragment.length() - cache.len;
+    cache.buf = buf;
+    cache.len = fragment.length();
+    cache.signature = signature;
+  }
+  *response += cache.buf;
+}
+
 uint8_t getLocalLightSubtype(uint8_t device) {
   if (TasmotaGlobal.light_type) {
     if (device >= Light.device) {
@@ -557,7 +623,7 @@ void HueLightStatus1(uint8_t device, String *response)
   }
 
   const size_t buf_size = 256;
-  char * buf = (char*) malloc(buf_size);     // temp buffer for strings, avoid stack
+  char * buf = (char*) HEAP_POOL_MALLOC(PSTR("hue"), buf_size);  // temp buffer for strings, avoid stack
   UnishoxStrings msg(HUE_LIGHTS);
 
   snprintf_P(buf, buf_size, PSTR("{\"on\":%s,"), (TasmotaGlobal.power & (1 << (device-1))) ? PSTR("true") : PSTR("false"));
@@ -584,7 +650,7 @@ void HueLightStatus1(uint8_t device, String *response)
   snprintf_P(buf, buf_size, msg[HUE_LIGHTS_STATUS_JSON1_SUFFIX], buf);
 
   *response += buf;
-  free(buf);
+  HEAP_POOL_FREE(buf);
 }
 
 // Check whether this device should be reported to Alexa or considered hidden.
@@ -750,14 +816,15 @@ void HueAuthentication(String *path)
 // refactored to remove code duplicates
 void CheckHue(String * response, bool &appending) {
   uint8_t maxhue = (TasmotaGlobal.devices_present > MAX_HUE_DEVICES) ? MAX_HUE_DEVICES : TasmotaGlobal.devices_present;
+  // Presize the response from the tracked fragment lengths so appending does not reallocate per light
+  response->reserve(response->length() + hue_fragment_total + (maxhue * 16) + 16);
   for (uint32_t i = 1; i <= maxhue; i++) {
     if (HueActive(i)) {
       if (appending) { *response += ","; }
       *response += F("\"");
       *response += EncodeLightId(i);
-      *response += F("\":{\"state\":");
-      HueLightStatus1(i, response);
-      HueLightStatus2(i, response);
+      *response += F("\":");
+      HueLightFragment(i, response);
       appending = true;
     }
   }
@@ -774,7 +841,7 @@ void HueLightsCommand(uint8_t device, uint32_t device_id, String &response) {
   uint8_t local_light_subtype = getLocalLightSubtype(device); // get the subtype for this device
 
   const size_t buf_size = 100;
-  char * buf = (char*) malloc(buf_size);
+  char * buf = (char*) HEAP_POOL_MALLOC(PSTR("hue"), buf_size);
   UnishoxStrings msg(HUE_LIGHTS);
 
   if (Webserver->args()) {
@@ -965,7 +1032,7 @@ void HueLightsCommand(uint8_t device, uint32_t device_id, String &response) {
   else {
     response = msg[HUE_ERROR_JSON];
   }
-  free(buf);
+  HEAP_POOL_FREE(buf);
 }
 #endif // USE_LIGHT
 
@@ -1064,9 +1131,7 @@ void HueLights(String *path_req)
     if ((device < 1) || (device > maxhue)) {
       device = 1;
     }
-    response += F("{\"state\":");
-    HueLightStatus1(device, &response);
-    HueLightStatus2(device, &response);
+    HueLightFragment(device, &response);
 #endif // USE_LIGHT
   }
   else {
@@ -1139,6 +1204,10 @@ void HandleHueApi(String *path)
 
   uint8_t args = 0;
 
+  // Echo devices poll every few seconds - advertise connection reuse so each poll
+  // does not pay TCP setup. The webserver keeps the socket open between requests.
+  Webserver->sendHeader(F("Connection"), F("keep-alive"));
+
   path->remove(0, 4);                                // remove /api
   uint16_t apilen = path->length();
   AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_HTTP D_HUE_API " (%s) from %s"), path->c_str(), Webserver->client().remoteIP().toString().c_str());         // HTP: Hue API (//lights/1/state) from 192.168.1.20
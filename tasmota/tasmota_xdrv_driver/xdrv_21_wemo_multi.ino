@@ -26,6 +26,16 @@
 
 //#define USE_EMULATION_WEMO_DEBUG
 
+#ifndef WEMO_RATELIMIT_MS
+#define WEMO_RATELIMIT_MS 3000           // Answer at most one M-SEARCH per source in this window -
+                                         // controllers retransmit each probe two or three times
+#endif
+#ifndef WEMO_JITTER_MS
+#define WEMO_JITTER_MS    100            // Response delay spread (per device, derived from chip id) so a
+                                         // fleet does not answer a multicast probe in the same millisecond
+#endif
+#define WEMO_SOURCES      4              // Number of M-SEARCH sources tracked for rate limiting
+
 const char WEMO_MSEARCH[] PROGMEM =
     "HTTP/1.1 200 OK\r\n"
     "CACHE-CONTROL: max-age=86400\r\n"
@@ -235,6 +245,9 @@ private:
   ESP8266WebServer *_webServer = NULL;
   int _localPort = 80;
   int _deviceId;
+  char *_msearch_cache[2] = { nullptr, nullptr };  // Prebuilt M-SEARCH responses per echo type
+  uint16_t _msearch_len[2] = { 0, 0 };
+  uint32_t _msearch_ip = 0;              // IP address the cached responses were built for
 
   String WemoSerialnumber(void) {
     char serial[20];
@@ -286,18 +299,34 @@ public:
     char message[TOPSZ];
 
     if (PortUdp.beginPacket(udp_remote_ip, udp_remote_port)) {
-      char type[24];
-      if (1 == echo_type) {              // type1 echo 1g & dot 2g
-        strcpy_P(type, URN_BELKIN_DEVICE_CAP);
-      } else {                           // type2 echo 2g (echo, plus, show)
-        strcpy_P(type, UPNP_ROOTDEVICE);
+      uint32_t idx = (1 == echo_type) ? 0 : 1;
+      if ((nullptr == _msearch_cache[idx]) || ((uint32_t)WiFi.localIP() != _msearch_ip)) {
+        // Build the response once and reuse it for every probe until the IP changes
+        char type[24];
+        if (1 == echo_type) {            // type1 echo 1g & dot 2g
+          strcpy_P(type, URN_BELKIN_DEVICE_CAP);
+        } else {                         // type2 echo 2g (echo, plus, show)
+          strcpy_P(type, UPNP_ROOTDEVICE);
+        }
+        char response[400];
+        snprintf_P(response, sizeof(response), WEMO_MSEARCH, WiFi.localIP().toString().c_str(), _localPort, type, WemoUuid().c_str(), type);
+        char *cache = (char*)realloc(_msearch_cache[idx], strlen(response) +1);
+        if (nullptr == cache) {
+          PortUdp.write((const uint8_t*)response, strlen(response));  // Out of memory - respond uncached
+          PortUdp.endPacket();
+          AddLog(LOG_LEVEL_DEBUG, PSTR("WMO: WeMo Type %d, " D_RESPONSE_SENT " to %s:%d"),
+            echo_type, udp_remote_ip.toString().c_str(), udp_remote_port);
+          return;
+        }
+        strcpy(cache, response);
+        _msearch_cache[idx] = cache;
+        _msearch_len[idx] = strlen(response);
+        _msearch_ip = (uint32_t)WiFi.localIP();
       }
-      char response[400];
-      snprintf_P(response, sizeof(response), WEMO_MSEARCH, WiFi.localIP().toString().c_str(), _localPort, type, WemoUuid().c_str(), type);
-      PortUdp.write((const uint8_t*)response, strlen(response));
+      PortUdp.write((const uint8_t*)_msearch_cache[idx], _msearch_len[idx]);
       PortUdp.endPacket();
 
-//      AddLog(LOG_LEVEL_DEBUG, PSTR("WMO: Sending packet device %d: %s"), _deviceId, response);
+//      AddLog(LOG_LEVEL_DEBUG, PSTR("WMO: Sending packet device %d: %s"), _deviceId, _msearch_cache[idx]);
 
       snprintf_P(message, sizeof(message), PSTR(D_RESPONSE_SENT));
     } else {
@@ -423,9 +452,59 @@ public:
 WemoSwitch *wemoDevice[MAX_FRIENDLYNAMES] = {};
 int numOfWemoSwitch = 0;
 
+struct WEMOSOURCE {
+  uint32_t ip = 0;                       // Source address of a recently answered M-SEARCH
+  uint32_t last_time = 0;                // millis() of the last response to that source
+} wemo_source[WEMO_SOURCES];
+
+struct {
+  IPAddress ip;                          // Destination for the deferred response
+  uint16_t port = 0;
+  uint8_t echo_type = 0;
+  uint32_t send_time = 0;                // millis() when the response is due
+  bool pending = false;
+} wemo_pending;
+
 void WemoRespondToMSearch(int echo_type) {
+  // Rate limit per source - controllers retransmit every probe so dropping repeats within
+  // the window loses nothing, and it keeps a chatty controller from flooding a large fleet
+  uint32_t source_ip = (uint32_t)udp_remote_ip;
+  uint32_t now = millis();
+  uint32_t slot = 0;
+  for (uint32_t i = 0; i < WEMO_SOURCES; i++) {
+    if (wemo_source[i].ip == source_ip) {
+      if (now - wemo_source[i].last_time < WEMO_RATELIMIT_MS) {
+#ifdef USE_EMULATION_WEMO_DEBUG
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("WMO: M-SEARCH from %s rate limited"), udp_remote_ip.toString().c_str());
+#endif
+        return;
+      }
+      slot = i;
+      break;
+    }
+    if (wemo_source[i].last_time < wemo_source[slot].last_time) {
+      slot = i;                          // Oldest entry is replaced when the source is new
+    }
+  }
+  wemo_source[slot].ip = source_ip;
+  wemo_source[slot].last_time = now;
+
+  // Defer the response by a per-device offset so a fleet sharing one chip id distribution
+  // spreads its answers over the jitter window instead of bursting on the multicast probe
+  wemo_pending.ip = udp_remote_ip;
+  wemo_pending.port = udp_remote_port;
+  wemo_pending.echo_type = echo_type;
+  wemo_pending.send_time = now + (ESP_getChipId() % WEMO_JITTER_MS);
+  wemo_pending.pending = true;
+}
+
+void WemoSendPending(void) {
+  if (!wemo_pending.pending || !TimeReached(wemo_pending.send_time)) { return; }
+  wemo_pending.pending = false;
+  udp_remote_ip = wemo_pending.ip;       // The device responders send to these globals
+  udp_remote_port = wemo_pending.port;
   for (uint32_t i = 0; i < numOfWemoSwitch; i++) {
-    wemoDevice[i]->WemoRespondToMSearch(echo_type);
+    wemoDevice[i]->WemoRespondToMSearch(wemo_pending.echo_type);
   }
 }
 
@@ -440,6 +519,7 @@ bool Xdrv21(uint32_t function)
   if (TasmotaGlobal.devices_present && (EMUL_WEMO == Settings->flag2.emulation)) {
     switch (function) {
       case FUNC_LOOP:
+        WemoSendPending();               // Send any jitter-delayed M-SEARCH response
         for (uint32_t i = 1; i < numOfWemoSwitch; i++) { // Handle devices web server
           wemoDevice[i]->HandleServerLoop();
         }
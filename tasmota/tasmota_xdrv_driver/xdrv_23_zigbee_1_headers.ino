@@ -31,7 +31,7 @@
 // contains some definitions for functions used before their declarations
 
 typedef int32_t (*ZB_Func)(uint8_t value);
-typedef int32_t (*ZB_RecvMsgFunc)(int32_t res, const SBuffer &buf);
+typedef int32_t (*ZB_RecvMsgFunc)(int32_t res, const SBufferView &buf);
 
 // Labels used in the State Machine -- internal only
 const uint8_t  ZIGBEE_LABEL_RESTART = 1;     // Restart the state_machine in a different mode
@@ -44,6 +44,46 @@ int strcmp_PP(const char *p1, const char *p2) {
   return c1 - c2;
 }
 
+/*********************************************************************************************\
+ *
+ * Per-message allocation arena
+ *
+ * Incoming frames build their Z_attribute_list from many small key and string value
+ * allocations that are freed again as soon as the message is published. To avoid the
+ * resulting heap fragmentation, these strings are carved from a single buffer that is
+ * rewound for each message. Attributes that outlive the message (coalesced publishing,
+ * device data) are deep copies and always use the regular heap.
+ *
+\*********************************************************************************************/
+
+const uint16_t Z_ARENA_SIZE = 768;      // covers the largest common reports, overflow falls back to heap
+
+uint8_t * z_arena = nullptr;            // allocated on first message, kept allocated afterwards
+uint16_t  z_arena_len = 0;              // bytes used by the current message
+bool      z_arena_active = false;       // allocate from the arena only while a message is being processed
+
+// Open the arena scope for a new incoming message, discarding the strings of the previous one
+void ZbMsgArenaBegin(void) {
+  if (nullptr == z_arena) {
+    z_arena = (uint8_t*) malloc(Z_ARENA_SIZE);
+  }
+  z_arena_len = 0;
+  z_arena_active = (z_arena != nullptr);
+}
+
+// Close the arena scope. Bytes already handed out stay valid until the next ZbMsgArenaBegin()
+void ZbMsgArenaEnd(void) {
+  z_arena_active = false;
+}
+
+// Return `len` bytes from the arena, or nullptr when inactive or full (caller uses the heap)
+char * ZbMsgArenaAlloc(size_t len) {
+  if (!z_arena_active || (z_arena_len + len > Z_ARENA_SIZE)) { return nullptr; }
+  char * p = (char*) z_arena + z_arena_len;
+  z_arena_len += len;
+  return p;
+}
+
 /*********************************************************************************************\
  *
  * Variables for Rules from last Zigbee message received
@@ -105,7 +145,9 @@ public:
   Za_type       type;             // uint8_t in size, type of attribute, see above
   bool          key_is_str;       // is the key a string?
   bool          key_is_pmem;      // is the string in progmem, so we don't need to make a copy
+  bool          key_is_arena;     // key was carved from the per-message arena, don't free
   bool          val_str_raw;      // if val is String, it is raw JSON and should not be escaped
+  bool          val_is_arena;     // string value was carved from the per-message arena, don't free
   bool          key_is_cmd;       // if command, cmd_id is the low 8 bits of attr_id.
                                   // Bit #8 is `0` command sent to device or `1` command received from device
                                   // Bit #9 is `0` command is cluster specific, or `1` general_command
@@ -125,7 +167,9 @@ public:
     type(Za_type::Za_none),
     key_is_str(false),
     key_is_pmem(false),
+    key_is_arena(false),
     val_str_raw(false),
+    val_is_arena(false),
     key_is_cmd(false),
     key_suffix(1),
     attr_type(0xFF),
@@ -190,6 +234,8 @@ public:
     setStr(_val);
     val_str_raw = true;
   }
+  // set the string value from a slice of a frame buffer, in a single copy
+  void setStrFromBuffer(const SBuffer &buf, size_t index, size_t len);
 
   Z_attribute_list & newAttrList(void);
   JsonGeneratorArray & newJsonArray(void);
@@ -343,8 +389,9 @@ Z_attribute & Z_attribute_list::addAttributePMEM(const char * name) {
 
 // free any allocated memoruy for keys
 void Z_attribute::freeKey(void) {
-  if (key_is_str && key && !key_is_pmem) { delete[] key; }
+  if (key_is_str && key && !key_is_pmem && !key_is_arena) { delete[] key; }
   key = nullptr;
+  key_is_arena = false;
 }
 
 // set key name
@@ -368,7 +415,9 @@ void Z_attribute::setKeyName(const char * _key, const char * _key2) {
     if (_key2) {
       key_len += strlen_P(_key2);
     }
-    key = new char[key_len+1];
+    key = ZbMsgArenaAlloc(key_len+1);
+    key_is_arena = (key != nullptr);
+    if (nullptr == key) { key = new char[key_len+1]; }
     strcpy_P(key, _key);
     if (_key2) {
       strcat_P(key, _key2);
@@ -460,13 +509,31 @@ void Z_attribute::setStr(const char * _val) {
   if (_val) {
     size_t len = strlen_P(_val);
     if (len) {
-      val.sval = new char[len+1];
+      val.sval = ZbMsgArenaAlloc(len+1);
+      val_is_arena = (val.sval != nullptr);
+      if (nullptr == val.sval) { val.sval = new char[len+1]; }
       strcpy_P(val.sval, _val);
     }
   }
   type = Za_type::Za_str;
 }
 
+// set the string value from `len` bytes of a frame buffer, adding the terminating NUL.
+// ZCL strings carry no terminator so they can't be referenced in place, but copying
+// straight from the frame avoids an intermediate buffer and a second copy
+void Z_attribute::setStrFromBuffer(const SBuffer &buf, size_t index, size_t len) {
+  freeVal();     // free any previously allocated memory
+  val_str_raw = false;
+  if (len) {
+    val.sval = ZbMsgArenaAlloc(len+1);
+    val_is_arena = (val.sval != nullptr);
+    if (nullptr == val.sval) { val.sval = new char[len+1]; }
+    memcpy(val.sval, buf.buf(index), len);
+    val.sval[len] = 0x00;
+  }
+  type = Za_type::Za_str;
+}
+
 Z_attribute_list & Z_attribute::newAttrList(void) {
   freeVal();
   val.objval = new Z_attribute_list();
@@ -724,6 +791,7 @@ String Z_attribute::toString(bool prefix_comma) const {
 }
 
 // copy value from one attribute to another, without changing its type
+// copies always use the heap so they may outlive the per-message arena
 void Z_attribute::copyVal(const Z_attribute & rhs) {
   freeVal();
   // copy value
@@ -753,7 +821,8 @@ void Z_attribute::freeVal(void) {
       if (val.bval) { delete val.bval; val.bval = nullptr; }
       break;
     case Za_type::Za_str:
-      if (val.sval) { delete[] val.sval; val.sval = nullptr; }
+      if (val.sval && !val_is_arena) { delete[] val.sval; }
+      val.sval = nullptr;
       break;
     case Za_type::Za_obj:
       if (val.objval) { delete val.objval; val.objval = nullptr; }
@@ -764,6 +833,7 @@ void Z_attribute::freeVal(void) {
     default:
       break;
   }
+  val_is_arena = false;
 }
 
 void Z_attribute::deepCopy(const Z_attribute & rhs) {
@@ -786,6 +856,7 @@ void Z_attribute::deepCopy(const Z_attribute & rhs) {
   }
   key_is_str = rhs.key_is_str;
   key_is_pmem = rhs.key_is_pmem;
+  key_is_arena = false;           // the key above is a heap or PMEM copy, never an arena slice
   key_is_cmd = rhs.key_is_cmd;
   key_suffix = rhs.key_suffix;
   attr_type = rhs.attr_type;
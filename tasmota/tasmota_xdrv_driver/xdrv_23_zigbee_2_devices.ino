@@ -963,6 +963,7 @@ public:
   bool                  is_router;         // flag used by ZbMap to distibguish routers from end-devices
   bool                  hidden;
   bool                  reachable;
+  bool                  save_pending;      // record changed since last save, only this record needs appending (see Z_Devices::dirty(device))
   // Light information for Hue integration integration, last known values
 
   // New version of device data handling
@@ -975,7 +976,7 @@ public:
   uint8_t               lqi;                // lqi from last message, 0xFF means unknown
   uint8_t               batt_percent;       // battery percentage (0..100), 0xFF means unknwon
   Z_no_advertize        no_advertize;       // no advertize for Hue or Matter
-  uint8_t               reserved_for_alignment;
+  uint8_t               coalesce_10ms;      // coalescing window for attribute reports in 10 ms units, 0xFF = use default, 0 = publish immediately (was reserved_for_alignment)
 
   // Debounce informmation when receiving commands
   // If we receive the same ZCL transaction number from the same device and the same endpoint within 300ms
@@ -998,6 +999,7 @@ public:
     is_router(false),
     hidden(false),
     reachable(false),
+    save_pending(false),
     data(),
     last_seen(0),
     batt_last_seen(0),
@@ -1005,7 +1007,7 @@ public:
     lqi(0xFF),
     batt_percent(0xFF),
     no_advertize(Z_no_advertize::Z_no_ad_default),
-    reserved_for_alignment(0xFF),
+    coalesce_10ms(0xFF),
     debounce_endpoint(0),
     debounce_transact(0)
     { };
@@ -1046,6 +1048,11 @@ public:
     }
   }
   
+  // Per-device coalescing window for attribute reports, see command `ZbCoalesce`
+  // 0xFF = use default (USE_ZIGBEE_COALESCE_ATTR_TIMER), 0 = publish immediately
+  inline uint16_t getCoalesceMs(void)   const { return (0xFF == coalesce_10ms) ? USE_ZIGBEE_COALESCE_ATTR_TIMER : coalesce_10ms * 10; }
+  inline void setCoalesceMs(int32_t ms)       { coalesce_10ms = (ms < 0) ? 0xFF : ((ms > 2540) ? 254 : ms / 10); }
+
   inline void setReachable(bool _reachable)   { reachable = _reachable; }
   inline bool getReachable(void)        const { return reachable; }
   inline bool getPower(uint8_t ep = 0)  const;
@@ -1125,7 +1132,7 @@ public:
   }
   void setLightChannels(int8_t channels, uint8_t ep);
 
-  static void setStringAttribute(char*& attr, const char * str);
+  static bool setStringAttribute(char*& attr, const char * str);    // true if the value changed
 };
 
 /*********************************************************************************************\
@@ -1267,7 +1274,8 @@ public:
   bool removeDevice(uint16_t shortaddr);
 
   // Mark data as 'dirty' and requiring to save in Flash
-  void dirty(void);
+  void dirty(void);               // structural change (addresses, removal), the whole table is rewritten
+  void dirty(Z_Device & device);  // only this device's record changed, it is appended instead of a full rewrite
   void clean(void);   // avoid writing to flash the last changes
 
   // Find device by name, can be short_addr, long_addr, number_in_array or name
@@ -1279,8 +1287,30 @@ private:
   LList<Z_Device>           _devices;     // list of devices
   LList<Z_Deferred>         _deferred;    // list of deferred calls
   uint32_t                  _saveTimer = 0;
+  bool                      _full_save = true;  // whole table needs rewriting, not just the `save_pending` records
   uint8_t                   _seqnumber = 0;     // global seqNumber if device is unknown
 
+  // Hash indices over shortaddr and longaddr for O(1) per-frame lookups.
+  // Lazily (re)built on the first lookup after a structural change, see rebuildHash()
+#ifdef ESP8266
+  static constexpr uint16_t hash_size = 64;     // power of two, > 2x the typical device count
+#else
+  static constexpr uint16_t hash_size = 128;    // power of two, > 2x the typical device count
+#endif
+  mutable Z_Device **       _short_hash = nullptr;  // open-addressing index by shortaddr, nullptr = empty slot
+  mutable Z_Device **       _long_hash = nullptr;   // open-addressing index by longaddr
+  mutable bool              _hash_valid = false;    // invalidated by dirty() on every structural change
+  mutable bool              _hash_overflow = false; // table too full (or no memory), fall back to linear scan
+
+  void rebuildHash(void) const;
+  static inline uint32_t hashShortAddr(uint16_t shortaddr) {
+    return (shortaddr ^ (shortaddr >> 7)) & (hash_size - 1);
+  }
+  static inline uint32_t hashLongAddr(uint64_t longaddr) {
+    uint32_t h = (uint32_t) longaddr ^ (uint32_t) (longaddr >> 32);
+    return (h ^ (h >> 16) ^ (h >> 7)) & (hash_size - 1);
+  }
+
   //int32_t findShortAddrIdx(uint16_t shortaddr) const;
   // Create a new entry in the devices list - must be called if it is sure it does not already exist
   Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr = 0);
@@ -54,42 +54,94 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 }
 
 //
-// Scan all devices to find a corresponding shortaddr
-// Looks info device.shortaddr entry
+// (Re)build the hash indices over shortaddr and longaddr
+//
+// Pointers into the device list are stable (LList elements never move) so the tables
+// only need rebuilding after a structural change, signalled by dirty(). Devices with
+// an unassigned shortaddr (0x0000) or longaddr are not indexed and keep using the
+// linear scan, preserving the previous first-match semantics for those keys.
+//
+void Z_Devices::rebuildHash(void) const {
+  if (nullptr == _short_hash) {
+    _short_hash = (Z_Device**) malloc(hash_size * sizeof(Z_Device*));
+    _long_hash  = (Z_Device**) malloc(hash_size * sizeof(Z_Device*));
+    if ((nullptr == _short_hash) || (nullptr == _long_hash)) {
+      free(_short_hash);  _short_hash = nullptr;
+      free(_long_hash);   _long_hash = nullptr;
+      _hash_overflow = true;        // no memory, keep the linear scan
+      _hash_valid = true;
+      return;
+    }
+  }
+  memset(_short_hash, 0, hash_size * sizeof(Z_Device*));
+  memset(_long_hash,  0, hash_size * sizeof(Z_Device*));
+  _hash_overflow = (_devices.length() > hash_size - (hash_size / 4));   // keep 25% of slots free so probe chains stay short
+  _hash_valid = true;
+  if (_hash_overflow) { return; }
+  for (const auto & device : _devices) {
+    if ((0x0000 != device.shortaddr) && (BAD_SHORTADDR != device.shortaddr)) {
+      uint32_t slot = hashShortAddr(device.shortaddr);
+      while (_short_hash[slot]) { slot = (slot + 1) & (hash_size - 1); }
+      _short_hash[slot] = (Z_Device*) &device;
+    }
+    if (device.longaddr) {
+      uint32_t slot = hashLongAddr(device.longaddr);
+      while (_long_hash[slot]) { slot = (slot + 1) & (hash_size - 1); }
+      _long_hash[slot] = (Z_Device*) &device;
+    }
+  }
+}
+
+//
+// Find a device by its shortaddr
+// Looks into the hash index, falls back to a linear scan for non-indexed keys
 // In:
 //    shortaddr (not BAD_SHORTADDR)
 // Out:
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
-  for (auto & elem : _devices) {
-    if (elem.shortaddr == shortaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices *)this)->findShortAddr(shortaddr);
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if ((0x0000 != shortaddr) && (BAD_SHORTADDR != shortaddr)) {
+    if (!_hash_valid) { rebuildHash(); }
+    if (!_hash_overflow) {
+      uint32_t slot = hashShortAddr(shortaddr);
+      while (_short_hash[slot]) {
+        if (_short_hash[slot]->shortaddr == shortaddr) { return *_short_hash[slot]; }
+        slot = (slot + 1) & (hash_size - 1);
+      }
+      return device_unk;
+    }
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
   return device_unk;
 }
 //
-// Scan all devices to find a corresponding longaddr
-// Looks info device.longaddr entry
+// Find a device by its longaddr (unique key if not null)
+// Looks into the hash index, falls back to a linear scan when the index is unusable
 // In:
 //    longaddr (non null)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    reference to device, or to device_unk if not found
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
-  if (!longaddr) { return device_unk; }
-  for (auto &elem : _devices) {
-    if (elem.longaddr == longaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices *)this)->findLongAddr(longaddr);
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (!_hash_valid) { rebuildHash(); }
+  if (!_hash_overflow) {
+    uint32_t slot = hashLongAddr(longaddr);
+    while (_long_hash[slot]) {
+      if (_long_hash[slot]->longaddr == longaddr) { return *_long_hash[slot]; }
+      slot = (slot + 1) & (hash_size - 1);
+    }
+    return device_unk;
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
@@ -322,11 +374,11 @@ bool Z_Device::setEPName(uint8_t ep, const char * name) {
   return false;
 }
 
-void Z_Device::setStringAttribute(char*& attr, const char * str) {
+bool Z_Device::setStringAttribute(char*& attr, const char * str) {
   if (nullptr == str)  { str = ""; }    // nullptr is considered empty string, don't use PROGMEM to avoid crash
   size_t str_len = strlen(str);
 
-  if ((nullptr == attr) && (0 == str_len)) { return; } // if both empty, don't do anything
+  if ((nullptr == attr) && (0 == str_len)) { return false; } // if both empty, don't do anything
   if (attr) {
     // we already have a value
     if (strcmp(attr, str) != 0) {
@@ -334,7 +386,7 @@ void Z_Device::setStringAttribute(char*& attr, const char * str) {
       free(attr);      // free previous value
       attr = nullptr;
     } else {
-      return;        // same value, don't change anything
+      return false;        // same value, don't change anything
     }
   }
   if (str_len) {
@@ -342,7 +394,7 @@ void Z_Device::setStringAttribute(char*& attr, const char * str) {
     attr = (char*) malloc(str_len + 1);
     strlcpy(attr, str, str_len + 1);
   }
-  zigbee_devices.dirty();
+  return true;
 }
 
 //
@@ -355,15 +407,15 @@ void Z_Device::setStringAttribute(char*& attr, const char * str) {
 // - Any actual change in ManufId (i.e. setting a different value) triggers a `dirty()` and saving to Flash
 //
 void Z_Device::setManufId(const char * str) {
-  setStringAttribute(manufacturerId, str);
+  if (setStringAttribute(manufacturerId, str)) { zigbee_devices.dirty(*this); }
 }
 
 void Z_Device::setModelId(const char * str) {
-  setStringAttribute(modelId, str);
+  if (setStringAttribute(modelId, str)) { zigbee_devices.dirty(*this); }
 }
 
 void Z_Device::setFriendlyName(const char * str) {
-  setStringAttribute(friendlyName, str);
+  if (setStringAttribute(friendlyName, str)) { zigbee_devices.dirty(*this); }
 }
 
 void Z_Device::setFriendlyEPName(uint8_t ep, const char * str) {
@@ -372,7 +424,9 @@ void Z_Device::setFriendlyEPName(uint8_t ep, const char * str) {
 
 // needs to push the implementation here to use Z_Device static method
 void Z_EP_Name::setName(const char *new_name) {
-  Z_Device::setStringAttribute(name, new_name);
+  if (Z_Device::setStringAttribute(name, new_name)) {
+    zigbee_devices.dirty();     // no device context here, schedule a full save
+  }
 }
 
 void Z_Device::setLastSeenNow(void) {
@@ -432,7 +486,7 @@ void Z_Device::setLightChannels(int8_t channels, uint8_t ep) {
     Z_Data_Light & light = data.get<Z_Data_Light>(ep);
     if (channels != light.getConfig()) {
       light.setConfig(channels);
-      zigbee_devices.dirty();
+      zigbee_devices.dirty(*this);
     }
     Z_Data_OnOff & onoff = data.get<Z_Data_OnOff>(ep);
     (void)onoff;
@@ -444,7 +498,7 @@ void Z_Device::setLightChannels(int8_t channels, uint8_t ep) {
         if (ep == 0 || data_elt.getEndpoint() == ep) {    // if remove ep==0 then remove all definitions
           // remove light object
           data.remove(&data_elt);
-          zigbee_devices.dirty();
+          zigbee_devices.dirty(*this);
         }
       }
     }
@@ -460,7 +514,7 @@ void Z_Devices::hideHueBulb(uint16_t shortaddr, bool hidden) {
   Z_Device &device = getShortAddr(shortaddr);
   if (device.hidden != hidden) {
     device.hidden = hidden;
-    dirty();
+    dirty(device);
   }
 }
 // true if device is not knwon or not a bulb - it wouldn't make sense to publish a non-bulb
@@ -538,7 +592,12 @@ void Z_Devices::runTimer(void) {
 
   // check if we need to save to Flash
   if ((_saveTimer) && TimeReached(_saveTimer)) {
-    saveZigbeeDevices();
+    if (_full_save) {
+      saveZigbeeDevices();
+    } else {
+      appendZigbeeDevices();    // only the records marked by dirty(device)
+    }
+    _full_save = false;
     _saveTimer = 0;
   }
 }
@@ -686,6 +745,9 @@ void Z_Devices::jsonPublishFlush(uint16_t shortaddr) {
   Z_attribute_list &attr_list = device.attr_list;
 
   if (!attr_list.isEmpty()) {
+#if defined(USE_WEBSERVER) && defined(USE_EMULATION) && defined(USE_EMULATION_HUE)
+    ZigbeeHueInvalidate(shortaddr);     // attributes changed, drop any cached Hue light fragment
+#endif
     // save parameters is global variables to be used by Rules
     gZbLastMessage.device = shortaddr;                // %zbdevice%
     gZbLastMessage.groupaddr = attr_list.group_id;      // %zbgroup%
@@ -708,10 +770,28 @@ void Z_Devices::jsonPublishNow(uint16_t shortaddr, Z_attribute_list &attr_list)
 }
 
 void Z_Devices::dirty(void) {
+  _hash_valid = false;          // addresses may have changed, rebuild the hash index on next lookup
+  _full_save = true;            // structural change, the whole table needs rewriting
   _saveTimer = kZigbeeSaveDelaySeconds * 1000 + millis();
+#if defined(USE_WEBSERVER) && defined(USE_EMULATION) && defined(USE_EMULATION_HUE)
+  ZigbeeHueInvalidate(BAD_SHORTADDR);   // devices added or removed, drop all cached Hue light fragments
+#endif
+}
+// Only this device's record changed (name, config...), append the single record on save
+// instead of rewriting the whole table. Addresses are untouched so the hash index stays valid.
+void Z_Devices::dirty(Z_Device & device) {
+  device.save_pending = true;
+  _saveTimer = kZigbeeSaveDelaySeconds * 1000 + millis();
+#if defined(USE_WEBSERVER) && defined(USE_EMULATION) && defined(USE_EMULATION_HUE)
+  ZigbeeHueInvalidate(device.shortaddr);  // name, bulb type or options changed, drop its cached Hue fragment
+#endif
 }
 void Z_Devices::clean(void) {
   _saveTimer = 0;
+  _full_save = false;
+  for (Z_Device & device : _devices) {
+    device.save_pending = false;
+  }
 }
 
 // Parse the command parameters for either:
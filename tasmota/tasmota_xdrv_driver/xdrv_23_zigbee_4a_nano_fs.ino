@@ -258,9 +258,9 @@ public:
   uint8_t   entry_idx;      // entry number in the directory
 
   ZFS_Write_File(void) : name(0), cursor(0), length(0), blk_start(0) {}
-  void init(uint32_t _name) {
+  void init(uint32_t _name, bool append = false) {
     name = _name;
-    findOrCreate();
+    findOrCreate(append);
   }
 
   inline bool valid(void) const { return blk_start != 0; }       // does the file exist?
@@ -269,7 +269,7 @@ public:
   int32_t close(void);
 
 protected:
-  void findOrCreate(void);
+  void findOrCreate(bool append = false);
 };
 
 
@@ -442,11 +442,12 @@ void ZFS_File_Entry::read(uint8_t entry_idx) {
   zigbee.eeprom.readBytes(getAddress(entry_idx), sizeof(ZFS_File_Entry), (byte*)this);
 }
 
-void ZFS_Write_File::findOrCreate(void) {
+void ZFS_Write_File::findOrCreate(bool append) {
   ZFS_File_Entry entry;
 
   if (ZFS::findFileEntry(name, entry, &entry_idx)) {
     blk_start = entry.blk_start;
+    if (append) { length = entry.length; }    // resume writing after the existing content
   }
 };
 
@@ -601,8 +602,8 @@ public:
 #ifdef USE_ZIGBEE_EEPROM
   ZFS_Write_File eeprom_file;
 
-  void init(uint32_t _name) {
-    eeprom_file.init(_name);
+  void init(uint32_t _name, bool append = false) {
+    eeprom_file.init(_name, append);
     is_valid = eeprom_file.valid();
   }
 #endif // USE_ZIGBEE_EEPROM
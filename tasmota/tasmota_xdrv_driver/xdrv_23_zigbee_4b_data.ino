@@ -53,6 +53,9 @@ int32_t hydrateDeviceWideData(class Z_Device & device, const SBuffer & buf, size
   if (segment_len >= 11) {
     device.no_advertize = (Z_no_advertize)buf.get8(start+11);
   }
+  if (segment_len >= 12) {
+    device.coalesce_10ms = buf.get8(start+12);
+  }
   return segment_len + 1;
 }
 
@@ -124,7 +127,7 @@ SBuffer hibernateDeviceData(const struct Z_Device & device) {
     buf.add16(device.shortaddr);
 
     // device wide data
-    buf.add8(11);        // 10 bytes
+    buf.add8(12);        // 12 bytes
     buf.add32(device.last_seen);
     buf.add8(device.lqi);
     buf.add8(device.batt_percent);
@@ -132,6 +135,8 @@ SBuffer hibernateDeviceData(const struct Z_Device & device) {
     buf.add32(device.batt_last_seen);
     // now storing no_advertize
     buf.add8((uint8_t)device.no_advertize);
+    // now storing the coalescing window
+    buf.add8(device.coalesce_10ms);
 
     for (const auto & data_elt : device.data) {
       size_t item_len = data_elt.DataTypeToLength(data_elt.getType());
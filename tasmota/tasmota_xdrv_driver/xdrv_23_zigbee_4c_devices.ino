@@ -416,7 +416,10 @@ bool loadZigbeeDevices(void) {
   AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee device information found in %s (%d devices - %d bytes)"), storage_class, num_devices, file_len);
 
   uint32_t k = 1;   // byte index in global buffer
-  for (uint32_t i = 0; (i < num_devices) && (k < file_len); i++) {
+  // Read until the end of file, not only `num_devices` records: incremental saves append
+  // updated records after the initial full write, they are replayed in order and the
+  // last record for a device wins (see appendZigbeeDevices)
+  for (uint32_t i = 0; k < file_len; i++) {
     uint16_t dev_record_len = 0;
     size_t dev_record_len_bytes = file_version >= 4 ? 2 : 1;
     f.readBytes((uint8_t*)&dev_record_len, dev_record_len_bytes);   // starting with v4, length is 2 bytes
@@ -451,6 +454,9 @@ bool loadZigbeeDevices(void) {
  * Save device configuration from storage.
  * Order of storage for saving is: 1/ EEPROM 2/ File system 3/ Flash (ESP8266 only)
 \*********************************************************************************************/
+uint16_t z_devices_appended = 0;            // device records appended since the last full rewrite
+const uint16_t Z_DEVICES_APPEND_MAX = 32;   // compact with a full rewrite after this many appended records
+
 void saveZigbeeDevices(void) {
   Univ_Write_File f;
   const char * storage_class = PSTR("");
@@ -494,6 +500,12 @@ void saveZigbeeDevices(void) {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data saved in %s (%d bytes)"), storage_class, buf_len);
   }
 
+  // the full table is now on storage, any pending per-device append is superseded
+  for (uint32_t i = 0; i < zigbee_devices.devicesSize(); i++) {
+    zigbee_devices.devicesAt(i).save_pending = false;
+  }
+  z_devices_appended = 0;
+
 #if defined(ESP8266)
   if (written && sbuffer != nullptr) {
     // first copy SPI buffer into ram
@@ -525,6 +537,77 @@ void saveZigbeeDevices(void) {
 }
 
 
+/*********************************************************************************************\
+ * appendZigbeeDevices
+ *
+ * Incremental variant of saveZigbeeDevices: append only the device records marked
+ * by `Z_Devices::dirty(device)` after the existing table, instead of rewriting it.
+ * A routine change (friendly name, light config...) then costs a few dozen bytes
+ * instead of a full serialize of the table. At load time records are replayed in
+ * order and the last record for a device wins.
+ *
+ * The table is compacted with a full rewrite once Z_DEVICES_APPEND_MAX records
+ * have been appended, or whenever appending is not possible: no appendable storage
+ * (ESP8266 raw Flash requires a sector erase), storage full, or table not yet written.
+\*********************************************************************************************/
+void appendZigbeeDevices(void) {
+  if (z_devices_appended >= Z_DEVICES_APPEND_MAX) {
+    saveZigbeeDevices();      // compaction, drops all superseded records
+    return;
+  }
+
+  Univ_Write_File f;
+  const char * storage_class = PSTR("");
+
+#ifdef USE_ZIGBEE_EEPROM
+  if (!f.valid() && zigbee.eeprom_ready && (ZFS::getLength(ZIGB_NAME4) > 0)) {
+    f.init(ZIGB_NAME4, true);     // append after the existing v4 table
+    storage_class = PSTR("EEPROM");
+  }
+#endif
+
+#ifdef USE_UFILESYS
+  File file;
+  if (!f.valid() && dfsp) {
+    file = dfsp->open(TASM_FILE_ZIGBEE, "a");
+    if (file && (file.size() > 0)) {    // append only to an existing table, it carries the header
+      f.init(&file);
+      storage_class = PSTR("File System");
+    } else if (file) {
+      file.close();
+    }
+  }
+#endif
+
+  if (!f.valid()) {
+    saveZigbeeDevices();      // no appendable storage, fall back to a full write
+    return;
+  }
+
+  uint32_t records = 0;
+  bool written = true;
+  for (uint32_t i = 0; i < zigbee_devices.devicesSize(); i++) {
+    Z_Device & device = zigbee_devices.devicesAt(i);
+    if (!device.save_pending) { continue; }
+    const SBuffer buf = hibernateDevice(device);
+    if (buf.len() > 0) {
+      int32_t ret = f.writeBytes(buf.getBuffer(), buf.len());
+      if (ret != buf.len()) { written = false; break; }   // storage full, compact instead
+    }
+    device.save_pending = false;
+    records++;
+  }
+  size_t buf_len = f.getCursor();
+  f.close();
+
+  if (!written) {
+    saveZigbeeDevices();
+    return;
+  }
+  z_devices_appended += records;
+  AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data appended in %s (%d records, %d bytes)"), storage_class, records, buf_len);
+}
+
 /*********************************************************************************************\
  * eraseZigbeeDevices
  *
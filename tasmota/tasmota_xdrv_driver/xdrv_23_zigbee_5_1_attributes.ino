@@ -442,6 +442,23 @@ public:
                                           // needs to be freed by ZbUnload only (to allow reuse between mutliple instances)
 };
 
+//
+//
+// Z_plugin_index_entry : one slot of the compiled cluster+attribute index
+//
+// The index is a flat array over all loaded templates, sorted by
+// `cluster << 16 | attribute` and stable on load order, so template
+// precedence is identical to the linear scan it replaces
+//
+//
+class Z_plugin_index_entry {
+public:
+  uint32_t key;                         // cluster << 16 | attribute
+  const Z_plugin_template * tmpl;       // owning template, for device matcher checks
+  const Z_attribute_synonym * syn;      // set for synonym entries, `nullptr` otherwise
+  const Z_plugin_attribute * attr;      // set for attribute entries, `nullptr` otherwise
+};
+
 //
 //
 // Z_plugin_templates
@@ -455,10 +472,107 @@ public:
   const Z_plugin_attribute * matchAttributeById(const char *model, const char *manufacturer, uint16_t cluster, uint16_t attribute);
   const Z_plugin_attribute * matchAttributeByName(const char *model, const char *manufacturer, const char *name);
   const Z_attribute_synonym * matchAttributeSynonym(const char *model, const char *manufacturer, uint16_t cluster, uint16_t attribute);
+
+  // compiled index over cluster+attribute
+  // `ZbLoad`/`ZbUnload` invalidate, first lookup afterwards rebuilds, so a boot
+  // loading many plug-in files pays for a single build instead of one per file
+  void indexInvalidate(void);
+  void indexBuild(void);
+  const Z_plugin_index_entry * indexFind(uint32_t key) const;   // lower bound of `key` or `nullptr`
+
+protected:
+  Z_plugin_index_entry * index = nullptr;
+  uint16_t index_len = 0;
+  bool index_valid = false;             // stays `false` when allocation failed, lookups then fall back to the linear scan
 };
 
+void Z_plugin_templates::indexInvalidate(void) {
+  if (index) { free(index); index = nullptr; }
+  index_len = 0;
+  index_valid = false;
+}
+
+void Z_plugin_templates::indexBuild(void) {
+  indexInvalidate();
+  size_t count = 0;
+  for (const Z_plugin_template & tmpl : *this) {
+    count += tmpl.synonyms.length() + tmpl.attributes.length();
+  }
+  if (count == 0 || count > 0xFFFF) {
+    index_valid = (count == 0);
+    return;
+  }
+  index = (Z_plugin_index_entry*) special_malloc(count * sizeof(Z_plugin_index_entry));
+  if (index == nullptr) { return; }
+
+  for (const Z_plugin_template & tmpl : *this) {
+    for (const Z_attribute_synonym & syn : tmpl.synonyms) {
+      index[index_len].key = ((uint32_t)syn.cluster << 16) | syn.attribute;
+      index[index_len].tmpl = &tmpl;
+      index[index_len].syn = &syn;
+      index[index_len].attr = nullptr;
+      index_len++;
+    }
+    for (const Z_plugin_attribute & attr : tmpl.attributes) {
+      index[index_len].key = ((uint32_t)attr.cluster << 16) | attr.attribute;
+      index[index_len].tmpl = &tmpl;
+      index[index_len].syn = nullptr;
+      index[index_len].attr = &attr;
+      index_len++;
+    }
+  }
+  // stable insertion sort on key, load order within equal keys is preserved
+  for (uint32_t i = 1; i < index_len; i++) {
+    Z_plugin_index_entry entry = index[i];
+    int32_t j = i - 1;
+    while (j >= 0 && index[j].key > entry.key) {
+      index[j + 1] = index[j];
+      j--;
+    }
+    index[j + 1] = entry;
+  }
+  index_valid = true;
+}
+
+const Z_plugin_index_entry * Z_plugin_templates::indexFind(uint32_t key) const {
+  int32_t low = 0;
+  int32_t high = (int32_t)index_len - 1;
+  int32_t found = -1;
+  while (low <= high) {
+    int32_t mid = (low + high) / 2;
+    if (index[mid].key >= key) {
+      if (index[mid].key == key) { found = mid; }
+      high = mid - 1;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return (found >= 0) ? &index[found] : nullptr;
+}
+
+// check if any matcher of the template matches the device
+static bool Z_plugin_template_match(const Z_plugin_template & tmpl, const char *model, const char *manufacturer) {
+  for (const Z_plugin_matcher & mtch : tmpl.matchers) {
+    if (mtch.match(model, manufacturer)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 const Z_attribute_synonym * Z_plugin_templates::matchAttributeSynonym(const char *model, const char *manufacturer, uint16_t cluster, uint16_t attribute) {
-  // scan through all templates
+  if (!index_valid) { indexBuild(); }
+  if (index_valid) {
+    uint32_t key = ((uint32_t)cluster << 16) | attribute;
+    for (const Z_plugin_index_entry * entry = indexFind(key); entry != nullptr && entry->key == key; entry++) {
+      if (entry->syn != nullptr && Z_plugin_template_match(*entry->tmpl, model, manufacturer)) {
+        return entry->syn;
+      }
+      if (entry == &index[index_len - 1]) { break; }
+    }
+    return nullptr;
+  }
+  // index could not be allocated, scan through all templates
   for (const Z_plugin_template & tmpl : *this) {
     const LList<Z_plugin_matcher> & matchers = tmpl.matchers;       // get synonyms
     const LList<Z_attribute_synonym> & synonyms = tmpl.synonyms; // get synonyms
@@ -479,7 +593,18 @@ const Z_attribute_synonym * Z_plugin_templates::matchAttributeSynonym(const char
 }
 
 const Z_plugin_attribute * Z_plugin_templates::matchAttributeById(const char *model, const char *manufacturer, uint16_t cluster, uint16_t attribute) {
-  // scan through all templates
+  if (!index_valid) { indexBuild(); }
+  if (index_valid) {
+    uint32_t key = ((uint32_t)cluster << 16) | attribute;
+    for (const Z_plugin_index_entry * entry = indexFind(key); entry != nullptr && entry->key == key; entry++) {
+      if (entry->attr != nullptr && Z_plugin_template_match(*entry->tmpl, model, manufacturer)) {
+        return entry->attr;
+      }
+      if (entry == &index[index_len - 1]) { break; }
+    }
+    return nullptr;
+  }
+  // index could not be allocated, scan through all templates
   for (const Z_plugin_template & tmpl : *this) {
     const LList<Z_plugin_matcher> & matchers = tmpl.matchers;       // get synonyms
     const LList<Z_plugin_attribute> & attributes = tmpl.attributes; // get synonyms
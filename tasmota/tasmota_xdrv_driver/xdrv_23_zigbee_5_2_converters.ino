@@ -142,7 +142,7 @@ public:
     }
   }
 
-  static ZCLFrame parseRawFrame(const SBuffer &buf, uint8_t offset, uint8_t len, uint16_t clusterid, uint16_t groupid,
+  static ZCLFrame parseRawFrame(const SBufferView &buf, uint8_t offset, uint8_t len, uint16_t clusterid, uint16_t groupid,
                                 uint16_t srcaddr, uint8_t srcendpoint, uint8_t dstendpoint, uint8_t wasbroadcast,
                                 uint8_t linkquality, uint8_t securityuse, uint8_t seqnumber) { // parse a raw frame and build the ZCL frame object
     uint32_t i = offset;
@@ -498,10 +498,7 @@ uint32_t parseSingleAttribute(Z_attribute & attr, const SBuffer &buf,
         if ((Zoctstr == attrtype) || (Zoctstr16 == attrtype)) { parse_as_string = false; }
 
         if (parse_as_string) {
-          char str[len+1];
-          strncpy(str, buf.charptr(i), len);
-          str[len] = 0x00;
-          attr.setStr(str);
+          attr.setStrFromBuffer(buf, i, len);
         } else {
           attr.setBuf(buf, i, len);
         }
@@ -1536,7 +1533,7 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
           case Zint32:  *(int32_t*)attr_address  = ival32;           break;
         }
         if (Z_Data_Set::updateData(data)) {
-          zigbee_devices.dirty();
+          zigbee_devices.dirty(device);
         }
       }
 
@@ -22,6 +22,64 @@
 
 // Add global functions for Hue Emulation
 
+/*********************************************************************************************\
+ * Cache of rendered Hue light fragments
+ *
+ * Hue apps and Echo devices poll `/lights` every few seconds, and each light costs a
+ * Unishox decompression plus a dozen snprintf calls to render. Keep the last rendered
+ * JSON object per light and serve it until an attribute changes: the local echo of a
+ * Hue command below, an incoming attribute report (hooked when `Z_Devices` flushes its
+ * coalescing buffer) or a device config change (hooked in `Z_Devices::dirty()`).
+ *
+ * The light ids themselves need no caching or persistence: `EncodeLightIdZigbee()`
+ * derives them from the short address, which is stable across restarts.
+\*********************************************************************************************/
+
+const uint32_t ZIGBEE_HUE_CACHE_SIZE = 8;   // rendered lights kept, eldest evicted - enough for typical installs
+
+typedef struct Z_Hue_Fragment {
+  String    payload;                        // rendered `{"state":...}` object for one light
+  uint16_t  shortaddr = BAD_SHORTADDR;      // BAD_SHORTADDR = free slot
+  uint8_t   ep = 0;                         // endpoint as announced in the light id, `0` = first endpoint
+  uint8_t   echo_gen = 0;                   // rendering differs between Echo generations
+} Z_Hue_Fragment;
+
+Z_Hue_Fragment zigbee_hue_cache[ZIGBEE_HUE_CACHE_SIZE];
+uint8_t zigbee_hue_cache_next = 0;          // round-robin eviction
+
+// Drop the cached fragments of one device, or all of them with BAD_SHORTADDR
+void ZigbeeHueInvalidate(uint16_t shortaddr) {
+  for (uint32_t i = 0; i < ZIGBEE_HUE_CACHE_SIZE; i++) {
+    if ((BAD_SHORTADDR == shortaddr) || (zigbee_hue_cache[i].shortaddr == shortaddr)) {
+      zigbee_hue_cache[i].shortaddr = BAD_SHORTADDR;
+      zigbee_hue_cache[i].payload = String();   // release the heap buffer
+    }
+  }
+}
+
+// Append the full JSON object for one light (state + metadata), from cache when fresh
+void ZigbeeHueLightJson(uint16_t shortaddr, uint8_t ep, uint8_t bulbtype, String *response) {
+  uint8_t echo_gen = findEchoGeneration();    // rendering depends on the polling client
+  for (uint32_t i = 0; i < ZIGBEE_HUE_CACHE_SIZE; i++) {
+    const Z_Hue_Fragment & frag = zigbee_hue_cache[i];
+    if ((frag.shortaddr == shortaddr) && (frag.ep == ep) && (frag.echo_gen == echo_gen)) {
+      *response += frag.payload;
+      return;
+    }
+  }
+  String payload;
+  payload += F("{\"state\":");
+  HueLightStatus1Zigbee(shortaddr, ep, bulbtype, &payload);
+  HueLightStatus2Zigbee(shortaddr, ep, &payload);
+  Z_Hue_Fragment & frag = zigbee_hue_cache[zigbee_hue_cache_next];
+  zigbee_hue_cache_next = (zigbee_hue_cache_next + 1) % ZIGBEE_HUE_CACHE_SIZE;
+  frag.shortaddr = shortaddr;
+  frag.ep = ep;
+  frag.echo_gen = echo_gen;
+  frag.payload = payload;
+  *response += payload;
+}
+
 // idx: index in the list of zigbee_devices
 void HueLightStatus1Zigbee(uint16_t shortaddr, uint8_t ep, uint8_t local_light_subtype, String *response) {
   static const char HUE_LIGHTS_STATUS_JSON1_SUFFIX_ZIGBEE[] PROGMEM =
@@ -125,9 +183,7 @@ void HueLightStatus2Zigbee(uint16_t shortaddr, uint8_t ep, String *response)
 int32_t ZigbeeHueStatus(String * response, uint16_t shortaddr, uint8_t ep) {
   int8_t bulbtype = zigbee_devices.getHueBulbtype(shortaddr, ep);
   if (bulbtype >= 0) {  // respond only if eligible
-    *response += F("{\"state\":");
-    HueLightStatus1Zigbee(shortaddr, ep, zigbee_devices.getHueBulbtype(shortaddr, ep), response);
-    HueLightStatus2Zigbee(shortaddr, ep, response);
+    ZigbeeHueLightJson(shortaddr, ep, bulbtype, response);
     return 200;
   } else {
     return -3;
@@ -149,9 +205,8 @@ void ZigbeeCheckHue(String & response, bool * appending) {
         if (*appending) { response += ","; }
         response += "\"";
         response += EncodeLightIdZigbee((i == 0) ? 0 : ep, shortaddr);
-        response += F("\":{\"state\":");
-        HueLightStatus1Zigbee(shortaddr, ep, bulbtype, &response);
-        HueLightStatus2Zigbee(shortaddr, (i == 0) ? 0 : ep, &response); // if first endpoint ,announce as `0`
+        response += F("\":");
+        ZigbeeHueLightJson(shortaddr, (i == 0) ? 0 : ep, bulbtype, &response); // if first endpoint, announce as `0`
         *appending = true;
       }
     }
@@ -196,6 +251,7 @@ void ZigbeeHuePower(uint16_t shortaddr, uint8_t ep, bool power) {
   SBuffer s(0);
   ZigbeeSendHue(shortaddr, ep, 0x0006, power ? 1 : 0, s);
   zigbee_devices.getShortAddr(shortaddr).setPower(power, ep);
+  ZigbeeHueInvalidate(shortaddr);
 }
 
 // Dimmer
@@ -206,6 +262,7 @@ void ZigbeeHueDimmer(uint16_t shortaddr, uint8_t ep, uint8_t dimmer) {
   s.add16(0x000A);    // transition time = 1s
   ZigbeeSendHue(shortaddr, ep, 0x0008, 0x04, s);
   zigbee_devices.getLight(shortaddr, ep).setDimmer(dimmer);
+  ZigbeeHueInvalidate(shortaddr);
 }
 
 // CT
@@ -218,6 +275,7 @@ void ZigbeeHueCT(uint16_t shortaddr, uint8_t ep, uint16_t ct) {
   Z_Data_Light & light = zigbee_devices.getLight(shortaddr, ep);
   light.setColorMode(2);      // "ct"
   light.setCT(ct);
+  ZigbeeHueInvalidate(shortaddr);
 }
 
 // XY
@@ -233,6 +291,7 @@ void ZigbeeHueXY(uint16_t shortaddr, uint8_t ep, uint16_t x, uint16_t y) {
   light.setColorMode(1);      // "xy"
   light.setX(x);
   light.setY(y);
+  ZigbeeHueInvalidate(BAD_SHORTADDR);   // `prev_x_str`/`prev_y_str` are shared by every light, flush all
 }
 
 // HueSat
@@ -248,6 +307,7 @@ void ZigbeeHueHS(uint16_t shortaddr, uint8_t ep, uint16_t hue, uint8_t sat) {
   light.setColorMode(0);      // "hs"
   light.setSat(sat);
   light.setHue(hue);
+  ZigbeeHueInvalidate(shortaddr);
 }
 
 int32_t ZigbeeHandleHue(uint16_t shortaddr, uint8_t ep, uint32_t device_id, uint8_t endpoint, String &response) {
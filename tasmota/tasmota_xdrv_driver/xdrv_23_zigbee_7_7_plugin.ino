@@ -126,6 +126,7 @@ extern FS *ffsp;
 #endif
 
 bool ZbLoad_inner(const char *filename, File &fp) {
+  g_plugin_templates.indexInvalidate();   // rebuilt lazily at first attribute lookup
   char * filename_imported = nullptr;
   Z_plugin_template * tmpl = nullptr;   // current template with matchers and attributes
   bool new_matchers = false;            // indicates that we have finished the current matchers
@@ -378,6 +379,7 @@ bool ZbUnload(const char *filename_raw) {
   }
   // free memory for filename
   if (filename_registered) {
+    g_plugin_templates.indexInvalidate();   // drop entries pointing to the removed templates
     free(filename_registered);
     AddLog(LOG_LEVEL_INFO, "ZIG: ZbUnload '%s' sucessful", filename_raw);
     return true;
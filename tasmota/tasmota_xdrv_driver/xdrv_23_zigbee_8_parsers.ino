@@ -74,7 +74,7 @@ void EZ_ERROR(uint8_t error_code) {
   MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_ZIGBEE_STATE));
 }
 
-int32_t EZ_ReadAPSUnicastMessage(int32_t res, SBuffer &buf) {
+int32_t EZ_ReadAPSUnicastMessage(int32_t res, const SBufferView &buf) {
   // Called when receiving a response from getConfigurationValue
   // Value is in bytes 2+3
   // uint16_t value = buf.get16(2);
@@ -88,7 +88,7 @@ int32_t EZ_ReadAPSUnicastMessage(int32_t res, SBuffer &buf) {
 //
 // Handle a "getEui64" incoming message
 //
-int32_t EZ_GetEUI64(int32_t res, SBuffer &buf) {
+int32_t EZ_GetEUI64(int32_t res, const SBufferView &buf) {
   localIEEEAddr = buf.get64(2);
   return res;
 }
@@ -96,7 +96,7 @@ int32_t EZ_GetEUI64(int32_t res, SBuffer &buf) {
 //
 // Handle a "getEui64" incoming message
 //
-int32_t EZ_GetNodeId(int32_t res, SBuffer &buf) {
+int32_t EZ_GetNodeId(int32_t res, const SBufferView &buf) {
   localShortAddr = buf.get8(2);
   return res;
 }
@@ -104,7 +104,7 @@ int32_t EZ_GetNodeId(int32_t res, SBuffer &buf) {
 //
 // Handle a "getNetworkParameters" incoming message
 //
-int32_t EZ_NetworkParameters(int32_t res, SBuffer &buf) {
+int32_t EZ_NetworkParameters(int32_t res, const SBufferView &buf) {
   uint8_t  node_type = buf.get8(3);
   // ext panid: 4->11
   // panid: 12->13
@@ -128,7 +128,7 @@ int32_t EZ_NetworkParameters(int32_t res, SBuffer &buf) {
 //
 // Analyze response to "getKey" and check NWK key
 //
-int32_t EZ_CheckKeyNWK(int32_t res, SBuffer &buf) {
+int32_t EZ_CheckKeyNWK(int32_t res, const SBufferView &buf) {
   // uint8_t  status = buf.get8(2);
   // uint16_t bitmask = buf.get16(3);
   uint8_t  key_type = buf.get8(5);
@@ -147,7 +147,7 @@ int32_t EZ_CheckKeyNWK(int32_t res, SBuffer &buf) {
 //
 // Handle a "incomingRouteErrorHandler" incoming message
 //
-int32_t EZ_RouteError(int32_t res, const SBuffer &buf) {
+int32_t EZ_RouteError(int32_t res, const SBufferView &buf) {
   uint8_t  status = buf.get8(2);
   uint16_t shortaddr = buf.get16(3);
 
@@ -163,7 +163,7 @@ int32_t EZ_RouteError(int32_t res, const SBuffer &buf) {
 //
 // Handle EZSP Energy Scan result
 //
-int32_t EZSP_EnergyScanResult(int32_t res, const SBuffer &buf) {
+int32_t EZSP_EnergyScanResult(int32_t res, const SBufferView &buf) {
   uint8_t  channel = buf.get8(2);
   int8_t   energy = buf.get8(3);
 
@@ -175,7 +175,7 @@ int32_t EZSP_EnergyScanResult(int32_t res, const SBuffer &buf) {
 //
 // Handle EZSP Energy Scan complete
 //
-int32_t EZSP_EnergyScanComplete(int32_t res, const SBuffer &buf) {
+int32_t EZSP_EnergyScanComplete(int32_t res, const SBufferView &buf) {
   // uint8_t  channel = buf.get8(2);
   uint8_t   status = buf.get8(3);
 
@@ -217,7 +217,7 @@ void EnergyScanResults(void) {
 //
 // Handle a "permitJoining" incoming message
 //
-int32_t EZ_PermitJoinRsp(int32_t res, const SBuffer &buf) {
+int32_t EZ_PermitJoinRsp(int32_t res, const SBufferView &buf) {
   uint8_t  status = buf.get8(2);
 
   if (status) {     // only report if there is an error
@@ -232,7 +232,7 @@ int32_t EZ_PermitJoinRsp(int32_t res, const SBuffer &buf) {
 //
 // We normally ignore the message, but it's a way to sniff group ids for IKEA remote
 // In case of a multicast message sent to 0xFFFD with non-null group id, we log the group id
-int32_t EZ_MessageSent(int32_t res, const SBuffer &buf) {
+int32_t EZ_MessageSent(int32_t res, const SBufferView &buf) {
   uint8_t  message_type = buf.get8(2);
   uint16_t dst_addr = buf.get16(3);
   uint16_t group_addr = buf.get16(13);
@@ -300,7 +300,7 @@ void Z_Map(uint16_t shortaddr, uint16_t groupaddr, uint16_t cluster, uint8_t end
 //
 // Handle a "getEui64" incoming message
 //
-int32_t Z_EZSPGetEUI64(int32_t res, SBuffer &buf) {
+int32_t Z_EZSPGetEUI64(int32_t res, const SBufferView &buf) {
   localIEEEAddr = buf.get64(2);
   return res;
 }
@@ -308,7 +308,7 @@ int32_t Z_EZSPGetEUI64(int32_t res, SBuffer &buf) {
 //
 // Handle a "getEui64" incoming message
 //
-int32_t Z_EZSPGetNodeId(int32_t res, SBuffer &buf) {
+int32_t Z_EZSPGetNodeId(int32_t res, const SBufferView &buf) {
   localShortAddr = buf.get8(2);
   return res;
 }
@@ -316,7 +316,7 @@ int32_t Z_EZSPGetNodeId(int32_t res, SBuffer &buf) {
 //
 // Handle a "getNetworkParameters" incoming message
 //
-int32_t Z_EZSPNetworkParameters(int32_t res, SBuffer &buf) {
+int32_t Z_EZSPNetworkParameters(int32_t res, const SBufferView &buf) {
   uint8_t  node_type = buf.get8(3);
   // ext panid: 4->11
   // panid: 12->13
@@ -344,7 +344,7 @@ int32_t Z_EZSPNetworkParameters(int32_t res, SBuffer &buf) {
 //
 // Handle a "Receive Device Info" incoming message
 //
-int32_t ZNP_ReceiveDeviceInfo(int32_t res, SBuffer &buf) {
+int32_t ZNP_ReceiveDeviceInfo(int32_t res, const SBufferView &buf) {
   // Ex= 6700.00.6263151D004B1200.0000.07.09.02.83869991
   // IEEE Adr (8 bytes) = 0x00124B001D156362
   // Short Addr (2 bytes) = 0x0000
@@ -386,7 +386,7 @@ int32_t ZNP_ReceiveDeviceInfo(int32_t res, SBuffer &buf) {
   return res;
 }
 
-int32_t ZNP_CheckNVWrite(int32_t res, SBuffer &buf) {
+int32_t ZNP_CheckNVWrite(int32_t res, const SBufferView &buf) {
   // Check the status after NV Init "ZNP Has Configured"
   // Good response should be 610700 or 610709 (Success or Created)
   // We only filter the response on 6107 and check the code in this function
@@ -398,7 +398,7 @@ int32_t ZNP_CheckNVWrite(int32_t res, SBuffer &buf) {
   }
 }
 
-int32_t ZNP_Reboot(int32_t res, SBuffer &buf) {
+int32_t ZNP_Reboot(int32_t res, const SBufferView &buf) {
   // print information about the reboot of device
   // 4180.02.02.00.02.06.03
   //
@@ -437,7 +437,7 @@ int32_t ZNP_Reboot(int32_t res, SBuffer &buf) {
 }
 
 #ifdef USE_ZIGBEE_ZNP
-int32_t ZNP_ReceiveCheckVersion(int32_t res, SBuffer &buf) {
+int32_t ZNP_ReceiveCheckVersion(int32_t res, const SBufferView &buf) {
   // check that the version is supported
   // typical version for ZNP 1.2
   // 61020200-02.06.03.D9143401.0200000000
@@ -470,7 +470,7 @@ int32_t ZNP_ReceiveCheckVersion(int32_t res, SBuffer &buf) {
 #endif // USE_ZIGBEE_ZNP
 
 #ifdef USE_ZIGBEE_EZSP
-int32_t EZ_ReceiveCheckVersion(int32_t res, SBuffer &buf) {
+int32_t EZ_ReceiveCheckVersion(int32_t res, const SBufferView &buf) {
   uint8_t protocol_version = buf.get8(2);
   uint8_t stack_type = buf.get8(3);
   zigbee.ezsp_version = buf.get16(4);
@@ -524,7 +524,7 @@ int32_t EZ_GotoIfResetConfig(uint8_t value) {
 // If coordinator continue
 // If router goto ZIGBEE_LABEL_START_ROUTER
 // If device goto ZIGBEE_LABEL_START_DEVICE
-int32_t Z_SwitchDeviceType(int32_t res, SBuffer &buf) {
+int32_t Z_SwitchDeviceType(int32_t res, const SBufferView &buf) {
   switch (Settings->zb_pan_id) {
     case 0xFFFF:    return ZIGBEE_LABEL_INIT_ROUTER;
     case 0xFFFE:    return ZIGBEE_LABEL_INIT_DEVICE;
@@ -535,7 +535,7 @@ int32_t Z_SwitchDeviceType(int32_t res, SBuffer &buf) {
 //
 // Helper function, checks if the incoming buffer matches the 2-bytes prefix, i.e. message type in PMEM
 //
-bool Z_ReceiveMatchPrefix(const SBuffer &buf, const uint8_t *match) {
+bool Z_ReceiveMatchPrefix(const SBufferView &buf, const uint8_t *match) {
   if ( (pgm_read_byte(&match[0]) == buf.get8(0)) &&
        (pgm_read_byte(&match[1]) == buf.get8(1)) ) {
     return true;
@@ -547,7 +547,7 @@ bool Z_ReceiveMatchPrefix(const SBuffer &buf, const uint8_t *match) {
 //
 // Handle Permit Join response
 //
-int32_t ZNP_ReceivePermitJoinStatus(int32_t res, const SBuffer &buf) {
+int32_t ZNP_ReceivePermitJoinStatus(int32_t res, const SBufferView &buf) {
   // we received a PermitJoin status change
   uint8_t     duration = buf.get8(2);
   uint8_t     status_code;
@@ -579,7 +579,7 @@ int32_t ZNP_ReceivePermitJoinStatus(int32_t res, const SBuffer &buf) {
 //
 // ZNP only
 //
-int32_t ZNP_ReceiveNodeDesc(int32_t res, const SBuffer &buf) {
+int32_t ZNP_ReceiveNodeDesc(int32_t res, const SBufferView &buf) {
   // Received ZDO_NODE_DESC_RSP
   // Z_ShortAddress    srcAddr = buf.get16(2);
   uint8_t           status  = buf.get8(4);
@@ -621,7 +621,7 @@ int32_t ZNP_ReceiveNodeDesc(int32_t res, const SBuffer &buf) {
 //
 // Porcess Receive Active Endpoint
 //
-int32_t Z_ReceiveActiveEp(int32_t res, const SBuffer &buf) {
+int32_t Z_ReceiveActiveEp(int32_t res, const SBufferView &buf) {
   // Received ZDO_ACTIVE_EP_RSP
 #ifdef USE_ZIGBEE_ZNP
   // Z_ShortAddress    srcAddr = buf.get16(2);
@@ -679,7 +679,7 @@ int32_t Z_ClusterToCxBinding(uint16_t cluster) {
   return -1;
 }
 
-void Z_AutoBindDefer(uint16_t shortaddr, uint8_t endpoint, const SBuffer &buf,
+void Z_AutoBindDefer(uint16_t shortaddr, uint8_t endpoint, const SBufferView &buf,
                     size_t in_index, size_t in_len, size_t out_index, size_t out_len) {
   // We use bitmaps to mark clusters that need binding and config attributes
   // All clusters in 'in' and 'out' are bounded
@@ -739,7 +739,7 @@ void Z_AutoBindDefer(uint16_t shortaddr, uint8_t endpoint, const SBuffer &buf,
   }
 }
 
-int32_t Z_ReceiveSimpleDesc(int32_t res, const SBuffer &buf) {
+int32_t Z_ReceiveSimpleDesc(int32_t res, const SBufferView &buf) {
 #ifdef USE_ZIGBEE_ZNP
   // Received ZDO_SIMPLE_DESC_RSP
   // Z_ShortAddress    srcAddr = buf.get16(2);
@@ -803,7 +803,7 @@ int32_t Z_ReceiveSimpleDesc(int32_t res, const SBuffer &buf) {
     Z_Device & device = zigbee_devices.getShortAddr(nwkAddr);
     device.addEndpoint(endpoint);
     device.data.get<Z_Data_Mode>(endpoint).setConfig(ZM_Tuya);
-    zigbee_devices.dirty();
+    zigbee_devices.dirty(device);
   }
 
   return -1;
@@ -813,7 +813,7 @@ int32_t Z_ReceiveSimpleDesc(int32_t res, const SBuffer &buf) {
 // Handle IEEEAddr incoming message
 //
 // Same works for both ZNP and EZSP
-int32_t Z_ReceiveIEEEAddr(int32_t res, const SBuffer &buf) {
+int32_t Z_ReceiveIEEEAddr(int32_t res, const SBufferView &buf) {
 #ifdef USE_ZIGBEE_ZNP
   uint8_t           status = buf.get8(2);
   Z_IEEEAddress     ieeeAddr = buf.get64(3);
@@ -850,7 +850,7 @@ int32_t Z_ReceiveIEEEAddr(int32_t res, const SBuffer &buf) {
 // Report any AF_DATA_CONFIRM message
 // Ex: {"ZbConfirm":{"Endpoint":1,"Status":0,"StatusMessage":"SUCCESS"}}
 //
-int32_t ZNP_DataConfirm(int32_t res, const SBuffer &buf) {
+int32_t ZNP_DataConfirm(int32_t res, const SBufferView &buf) {
   uint8_t           status = buf.get8(2);
   uint8_t           endpoint = buf.get8(3);
   //uint8_t           transId = buf.get8(4);    // unused
@@ -881,7 +881,7 @@ int32_t ZNP_DataConfirm(int32_t res, const SBuffer &buf) {
 // 0x08: Starting as ZigBee Coordinator
 // 0x09: Started as ZigBee Coordinator
 // 0x0A: Device has lost information about its parent
-int32_t ZNP_ReceiveStateChange(int32_t res, const SBuffer &buf) {
+int32_t ZNP_ReceiveStateChange(int32_t res, const SBufferView &buf) {
   uint8_t           state = buf.get8(2);
   const char *      msg = nullptr;
 
@@ -931,7 +931,7 @@ int32_t ZNP_ReceiveStateChange(int32_t res, const SBuffer &buf) {
 // This message is also received when a previously paired device is powered up
 // Send back Active Ep Req message
 //
-int32_t Z_ReceiveEndDeviceAnnonce(int32_t res, const SBuffer &buf) {
+int32_t Z_ReceiveEndDeviceAnnonce(int32_t res, const SBufferView &buf) {
 #ifdef USE_ZIGBEE_ZNP
   // Z_ShortAddress    srcAddr = buf.get16(2);
   Z_ShortAddress    nwkAddr = buf.get16(4);
@@ -986,7 +986,7 @@ int32_t Z_ReceiveEndDeviceAnnonce(int32_t res, const SBuffer &buf) {
 // Handle Receive TC Dev Ind incoming message
 // 45CA
 //
-int32_t ZNP_ReceiveTCDevInd(int32_t res, const SBuffer &buf) {
+int32_t ZNP_ReceiveTCDevInd(int32_t res, const SBufferView &buf) {
   Z_ShortAddress    srcAddr = buf.get16(2);
   Z_IEEEAddress     ieeeAddr = buf.get64(4);
   Z_ShortAddress    parentNw = buf.get16(12);
@@ -1008,7 +1008,7 @@ int32_t ZNP_ReceiveTCDevInd(int32_t res, const SBuffer &buf) {
 //
 // Handle Bind Rsp incoming message
 //
-int32_t Z_BindRsp(int32_t res, const SBuffer &buf) {
+int32_t Z_BindRsp(int32_t res, const SBufferView &buf) {
 #ifdef USE_ZIGBEE_ZNP
   Z_ShortAddress    nwkAddr = buf.get16(2);
   uint8_t           status = buf.get8(4);
@@ -1041,7 +1041,7 @@ int32_t Z_BindRsp(int32_t res, const SBuffer &buf) {
 //
 // Handle Unbind Rsp incoming message
 //
-int32_t Z_UnbindRsp(int32_t res, const SBuffer &buf) {
+int32_t Z_UnbindRsp(int32_t res, const SBufferView &buf) {
 #ifdef USE_ZIGBEE_ZNP
   Z_ShortAddress    nwkAddr = buf.get16(2);
   uint8_t           status = buf.get8(4);
@@ -1074,7 +1074,7 @@ int32_t Z_UnbindRsp(int32_t res, const SBuffer &buf) {
 //
 // Handle MgMt Bind Rsp incoming message
 //
-int32_t Z_MgmtBindRsp(int32_t res, const SBuffer &buf) {
+int32_t Z_MgmtBindRsp(int32_t res, const SBufferView &buf) {
   return Z_Mgmt_Lqi_Bind_Rsp(res, buf, false);
 }
 
@@ -1114,7 +1114,7 @@ const char * Z_DeviceType(uint32_t value) {
 //
 // If the response has a follow-up, send more requests automatically
 //
-int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBuffer &buf, boolean lqi) {
+int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBufferView &buf, boolean lqi) {
 #ifdef USE_ZIGBEE_ZNP
   uint16_t    shortaddr   = buf.get16(2);
   uint8_t     status      = buf.get8(4);
@@ -1273,7 +1273,7 @@ int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBuffer &buf, boolean lqi) {
 //
 // Handle MgMt Bind Rsp incoming message
 //
-int32_t Z_MgmtLqiRsp(int32_t res, const SBuffer &buf) {
+int32_t Z_MgmtLqiRsp(int32_t res, const SBufferView &buf) {
   return Z_Mgmt_Lqi_Bind_Rsp(res, buf, true);
 }
 
@@ -1282,7 +1282,7 @@ int32_t Z_MgmtLqiRsp(int32_t res, const SBuffer &buf) {
 // Handle Parent Annonce Rsp incoming message
 //
 // rsp: true = ZDO_Parent_annce_rsp, false = ZDO_Parent_annce
-int32_t EZ_ParentAnnceRsp(int32_t res, const SBuffer &buf, bool rsp) {
+int32_t EZ_ParentAnnceRsp(int32_t res, const SBufferView &buf, bool rsp) {
   size_t prefix_len;
   uint8_t     status;
   uint8_t     num_children;
@@ -1638,7 +1638,7 @@ void Z_AutoConfigReportingForCluster(uint16_t shortaddr, uint16_t groupaddr, uin
 // 2400
 //
 #ifdef USE_ZIGBEE_EZSP
-int32_t EZ_ReceiveTCJoinHandler(int32_t res, const SBuffer &buf) {
+int32_t EZ_ReceiveTCJoinHandler(int32_t res, const SBufferView &buf) {
   uint16_t      srcAddr = buf.get16(2);
   uint64_t      ieeeAddr = buf.get64(4);
   uint8_t       status = buf.get8(12);
@@ -1697,6 +1697,7 @@ void Z_IncomingMessage(class ZCLFrame &zcl_received) {
   char shortaddr[8];
   snprintf_P(shortaddr, sizeof(shortaddr), PSTR("0x%04X"), srcaddr);
 
+  ZbMsgArenaBegin();      // attribute keys and string values are carved from the per-message arena
   Z_attribute_list attr_list;
   attr_list.lqi = linkquality;
   attr_list.src_ep = srcendpoint;
@@ -1764,6 +1765,7 @@ void Z_IncomingMessage(class ZCLFrame &zcl_received) {
     // discard the message if it was sent by us (broadcast or group loopback)
     if (srcaddr == localShortAddr) {
       AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE  "loopback message, ignoring"));
+      ZbMsgArenaEnd();
       return;     // abort the rest of message management
     }
 
@@ -1779,21 +1781,27 @@ void Z_IncomingMessage(class ZCLFrame &zcl_received) {
     callBerryZigbeeDispatcher("attributes_refined", &zcl_received, &attr_list, srcaddr);
 #endif // USE_BERRY
 
+    // strings stored past this point (coalesced publishing) must outlive the message, close the
+    // arena so merged copies are allocated from the heap - existing arena slices stay readable
+    ZbMsgArenaEnd();
+
     if (!attr_list.isEmpty()) {
-      if (defer_attributes) {
+      uint16_t coalesce_ms = device.getCoalesceMs();    // per-device coalescing window, see `ZbCoalesce`
+      if (defer_attributes && coalesce_ms) {
         // Prepare for publish
         if (zigbee_devices.jsonIsConflict(srcaddr, attr_list)) {
           // there is conflicting values, force a publish of the previous message now and don't coalesce
           zigbee_devices.jsonPublishFlush(srcaddr);
         }
         zigbee_devices.jsonAppend(srcaddr, attr_list);
-          zigbee_devices.setTimer(srcaddr, 0 /* groupaddr */, USE_ZIGBEE_COALESCE_ATTR_TIMER, 0 /*clusterid*/, srcendpoint, Z_CAT_READ_ATTR, 0, &Z_PublishAttributes);
+          zigbee_devices.setTimer(srcaddr, 0 /* groupaddr */, coalesce_ms, 0 /*clusterid*/, srcendpoint, Z_CAT_READ_ATTR, 0, &Z_PublishAttributes);
       } else {
         // Publish immediately
         zigbee_devices.jsonPublishNow(srcaddr, attr_list);
       }
     }
   }
+  ZbMsgArenaEnd();        // also covers the ignored commands path
 }
 
 #ifdef USE_ZIGBEE_EZSP
@@ -1856,7 +1864,7 @@ void EZ_SendZDO(uint16_t shortaddr, uint16_t cmd, const unsigned char *payload,
  * Send specific EZSP messages
 \*********************************************************************************************/
 
-int32_t EZ_IncomingMessage(int32_t res, const SBuffer &buf) {
+int32_t EZ_IncomingMessage(int32_t res, const SBufferView &buf) {
   uint8_t         msgtype = buf.get8(2);      // see EZSP_EmberIncomingMessageType
   bool            wasbroadcast = (msgtype >= EMBER_INCOMING_MULTICAST) && (msgtype <= EMBER_INCOMING_BROADCAST_LOOPBACK);
   uint16_t        profileid = buf.get16(3);   // HA = 0x0104, ZDO = 0x0000
@@ -1884,10 +1892,14 @@ int32_t EZ_IncomingMessage(int32_t res, const SBuffer &buf) {
       device.setLastSeenNow();
     }
     // Since ZDO messages start with a sequence number, we skip it
-    // but we add the source address in the last 2 bytes
-    SBuffer zdo_buf(buf.get8(20) - 1 + 2);
-    zdo_buf.addBuffer(buf.buf(22), buf.get8(20) - 1);
-    zdo_buf.add16(srcaddr);
+    // but we add the source address in the last 2 bytes.
+    // Small stack copy (not a pure view) because of the appended srcaddr, no heap
+    uint8_t  zdo_raw[256];
+    uint32_t zdo_len = buf.get8(20) - 1;
+    memcpy(zdo_raw, buf.buf(22), zdo_len);
+    zdo_raw[zdo_len]   = srcaddr & 0xFF;
+    zdo_raw[zdo_len+1] = srcaddr >> 8;
+    SBufferView zdo_buf(zdo_raw, zdo_len + 2);
     switch (clusterid) {
       case ZDO_Device_annce:
         return Z_ReceiveEndDeviceAnnonce(res, zdo_buf);
@@ -1950,7 +1962,7 @@ int32_t EZ_Reset_Device(uint8_t value) {
  * Default resolver
 \*********************************************************************************************/
 
-int32_t EZ_Recv_Default(int32_t res, const SBuffer &buf) {
+int32_t EZ_Recv_Default(int32_t res, const SBufferView &buf) {
   // Default message handler for new messages
   if (zigbee.init_phase) {
     // if still during initialization phase, ignore any unexpected message
@@ -2019,7 +2031,7 @@ int32_t ZNP_Reset_Device(uint8_t value) {
   return 0;                              // continue
 }
 
-int32_t ZNP_ReceiveAfIncomingMessage(int32_t res, const SBuffer &buf) {
+int32_t ZNP_ReceiveAfIncomingMessage(int32_t res, const SBufferView &buf) {
   uint16_t        groupid = buf.get16(2);
   uint16_t        clusterid = buf.get16(4);
   uint16_t        srcaddr = buf.get16(6);
@@ -2078,7 +2090,7 @@ const Z_Dispatcher Z_DispatchTable[] PROGMEM = {
  * Default resolver
 \*********************************************************************************************/
 
-int32_t ZNP_Recv_Default(int32_t res, const SBuffer &buf) {
+int32_t ZNP_Recv_Default(int32_t res, const SBufferView &buf) {
   // Default message handler for new messages
   if (zigbee.init_phase) {
     // if still during initialization phase, ignore any unexpected message
@@ -70,12 +70,254 @@ bool Z_LedStatusSet(bool onoff) {
 #include <TasmotaSerial.h>
 TasmotaSerial *ZigbeeSerial = nullptr;
 
+/********************************************************************************************/
+//
+// Event-driven serial RX (optional, ESP32 only)
+//
+// The polled input below runs once per event loop, so under load MCU frames queue up
+// behind slow ticks and the coordinator retransmits. When USE_ZIGBEE_EVENT_RX is enabled
+// the frame assembler runs in the HardwareSerial receive-event task instead: bytes are
+// assembled and validated as they arrive, and only complete frames are queued for the
+// main loop which does the logging/MQTT and calls ZigbeeProcessInput as before.
+// High-water statistics quantify the serial backpressure, see command `ZbSerial`.
+//
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+
+const uint8_t ZIGBEE_RX_QUEUE_SIZE = 8;   // max complete frames waiting for the main loop
+
+struct ZIGBEE_RX_STATS {
+  uint32_t bytes_received;        // total bytes seen by the assembler
+  uint32_t bytes_discarded;       // bytes discarded while waiting for a frame start
+  uint32_t frames_received;       // complete valid frames handed to the main loop
+  uint32_t frames_bad;            // frames rejected (bad FCS/CRC or wrong size)
+  uint32_t frames_dropped;        // valid frames dropped because the queue was full
+  uint32_t timeouts;              // incomplete frames discarded after ZIGBEE_POLLING ms
+  uint16_t rx_pending_max;        // high water of bytes pending in the UART buffer on event entry
+  uint8_t  queue_max;             // high water of complete frames waiting for the main loop
+} Z_RxStats;
+
+QueueHandle_t ZigbeeRxQueue = nullptr;    // queue of SBuffer* holding complete frames
+SBuffer *z_evt_buffer = nullptr;          // frame assembly buffer, only touched by the event task
+uint32_t z_evt_last_byte = 0;             // millis() of last byte received
+
+// Queue a completed frame for the main loop, or drop it if the loop is too far behind
+void ZigbeeEventQueueFrame(SBuffer *frame) {
+  if (xQueueSend(ZigbeeRxQueue, &frame, 0) != pdTRUE) {
+    delete frame;
+    Z_RxStats.frames_dropped++;
+    return;
+  }
+  Z_RxStats.frames_received++;
+  uint32_t waiting = uxQueueMessagesWaiting(ZigbeeRxQueue);
+  if (waiting > Z_RxStats.queue_max) { Z_RxStats.queue_max = waiting; }
+}
+
+//
+// Frame assembler, called from the HardwareSerial receive-event task.
+// Mirrors the byte logic of the polled input below, but performs only pure
+// frame validation - anything touching Tasmota globals stays in the main loop.
+//
+void ZigbeeSerialEvent(void) {
+  HardwareSerial *hws = ZigbeeSerial->getesp32hws();
+
+  uint32_t pending = hws->available();
+  if (pending > Z_RxStats.rx_pending_max) { Z_RxStats.rx_pending_max = pending; }
+
+  // discard a stale partial frame before processing new bytes
+  if (z_evt_buffer->len() && (millis() > (z_evt_last_byte + ZIGBEE_POLLING))) {
+    Z_RxStats.timeouts++;
+    z_evt_buffer->setLen(0);
+  }
+
+#ifdef USE_ZIGBEE_ZNP
+  static uint8_t fcs = ZIGBEE_SOF;
+  static uint32_t zigbee_frame_len = 5;		      // minimal zigbee frame length, will be updated when buf[1] is read
+
+  while (hws->available()) {
+    uint8_t zigbee_in_byte = hws->read();
+    Z_RxStats.bytes_received++;
+    z_evt_last_byte = millis();
+
+    if (0 == z_evt_buffer->len()) {  // make sure all variables are correctly initialized
+      zigbee_frame_len = 5;
+      fcs = ZIGBEE_SOF;
+      // forgive the missed lsb of the first byte, see polled input for explanation
+      if (ZIGBEE_SOF_ALT == zigbee_in_byte) {
+        zigbee_in_byte = ZIGBEE_SOF;
+      }
+      if (ZIGBEE_SOF != zigbee_in_byte) {
+        // waiting for SOF (Start Of Frame) byte, discard anything else
+        Z_RxStats.bytes_discarded++;
+        continue;
+      }
+    }
+
+    z_evt_buffer->add8(zigbee_in_byte);
+    fcs ^= zigbee_in_byte;
+
+    // recalculate frame length
+    if (02 == z_evt_buffer->len()) {
+      // We just received the Length byte
+      uint8_t len_byte = z_evt_buffer->get8(1);
+      if (len_byte > 250)  len_byte = 250;    // ZNP spec says len is 250 max
+      zigbee_frame_len = len_byte + 5;        // SOF + LEN + CMD1 + CMD2 + FCS = 5 bytes overhead
+    }
+
+    if (z_evt_buffer->len() >= zigbee_frame_len) {
+      // frame complete, check integrity
+      if (0x00 != fcs) {
+        Z_RxStats.frames_bad++;
+      } else {
+        SBuffer *frame = new SBuffer(zigbee_frame_len - 3);
+        frame->addBuffer(z_evt_buffer->buf(2), zigbee_frame_len - 3);	// remove SOF, LEN and FCS
+        ZigbeeEventQueueFrame(frame);
+      }
+      z_evt_buffer->setLen(0);		// empty buffer
+    }
+  }
+#endif // USE_ZIGBEE_ZNP
+
+#ifdef USE_ZIGBEE_EZSP
+  static bool escape = false;                          // was the previous byte an escape?
+
+  while (hws->available()) {
+    uint8_t zigbee_in_byte = hws->read();
+    Z_RxStats.bytes_received++;
+    z_evt_last_byte = millis();
+
+    if ((0x11 == zigbee_in_byte) || (0x13 == zigbee_in_byte)) {
+      continue;           // ignore reserved bytes XON/XOFF
+    }
+
+    if (ZIGBEE_EZSP_ESCAPE == zigbee_in_byte) {
+      escape = true;
+      continue;
+    }
+
+    if (ZIGBEE_EZSP_CANCEL == zigbee_in_byte) {
+      z_evt_buffer->setLen(0);		// empty buffer
+      escape = false;
+      continue;
+    }
+
+    if (ZIGBEE_EZSP_EOF == zigbee_in_byte) {
+      // end of frame, check CRC
+      uint32_t frame_len = z_evt_buffer->len();
+      if (frame_len >= 3) {
+        uint16_t crc = 0xFFFF;                 // frame CRC
+        for (uint32_t i=0; i<frame_len-2; i++) {
+          crc = crc ^ ((uint16_t)z_evt_buffer->get8(i) << 8);
+          for (uint32_t j=0; j<8; j++) {
+            if (crc & 0x8000) {
+              crc = (crc << 1) ^ 0x1021;          // polynom is x^16 + x^12 + x^5 + 1, CCITT standard
+            } else {
+              crc <<= 1;
+            }
+          }
+        }
+        uint16_t crc_received = z_evt_buffer->get8(frame_len - 2) << 8 | z_evt_buffer->get8(frame_len - 1);
+        if (crc_received != crc) {
+          Z_RxStats.frames_bad++;
+        } else {
+          SBuffer *frame = new SBuffer(frame_len - 2);
+          frame->addBuffer(z_evt_buffer->buf(0), frame_len - 2);   // remove CRC
+          // CRC is correct, apply de-stuffing if DATA frame
+          if (0 == (frame->get8(0) & 0x80)) {
+            uint8_t rand = 0x42;
+            for (uint32_t i=1; i<frame->len(); i++) {
+              frame->set8(i, frame->get8(i) ^ rand);
+              if (rand & 1) { rand = (rand >> 1) ^ 0xB8; }
+              else          { rand = (rand >> 1); }
+            }
+          }
+          ZigbeeEventQueueFrame(frame);
+        }
+      } else if (frame_len) {
+        Z_RxStats.frames_bad++;
+      }
+      z_evt_buffer->setLen(0);		// empty buffer
+      escape = false;
+      continue;
+    }
+
+    if (z_evt_buffer->len() < ZIGBEE_BUFFER_SIZE) {
+      if (escape) {
+        // invert bit 5
+        zigbee_in_byte ^= 0x20;
+        escape = false;
+      }
+      z_evt_buffer->add8(zigbee_in_byte);
+    }
+  }
+#endif // USE_ZIGBEE_EZSP
+}
+
+//
+// Drain complete frames queued by the event task, called from the main event loop.
+// Logging, MQTT and frame processing happen here, exactly as in the polled input.
+//
+void ZigbeeEventRxDrain(void) {
+  SBuffer *frame = nullptr;
+
+  Z_LedStatusSet(false);
+  while (xQueueReceive(ZigbeeRxQueue, &frame, 0) == pdTRUE) {
+    Z_LedStatusSet(true); // turn on receive LED<1>
+
+#ifdef USE_ZIGBEE_ZNP
+    Response_P(PSTR("{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%_B\"}"), frame);
+    if (Settings->flag3.tuya_serial_mqtt_publish) {
+      MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_RSLT_SENSOR));
+    } else {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "%s"), ResponseData());
+    }
+    ZigbeeProcessInput(*frame);
+#endif // USE_ZIGBEE_ZNP
+
+#ifdef USE_ZIGBEE_EZSP
+    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "2\":\"%_B\"}"), frame);
+    ZigbeeProcessInputRaw(*frame);
+#endif // USE_ZIGBEE_EZSP
+
+    delete frame;
+  }
+}
+
+//
+// Attach the frame assembler to the UART receive events.
+// Falls back to the polled input when not using hardware serial or out of memory.
+//
+void ZigbeeEventRxInit(void) {
+  if (!ZigbeeSerial->hardwareSerial()) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Event RX needs hardware serial, keeping polled input"));
+    return;
+  }
+  ZigbeeRxQueue = xQueueCreate(ZIGBEE_RX_QUEUE_SIZE, sizeof(SBuffer*));
+  z_evt_buffer = new SBuffer(ZIGBEE_BUFFER_SIZE);
+  if ((nullptr == ZigbeeRxQueue) || (nullptr == z_evt_buffer)) {
+    if (ZigbeeRxQueue) { vQueueDelete(ZigbeeRxQueue); ZigbeeRxQueue = nullptr; }
+    if (z_evt_buffer) { delete z_evt_buffer; z_evt_buffer = nullptr; }
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Event RX out of memory, keeping polled input"));
+    return;
+  }
+  ZigbeeSerial->getesp32hws()->onReceive(ZigbeeSerialEvent);
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "Event-driven serial RX enabled"));
+}
+
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+
 /********************************************************************************************/
 //
 // Called at event loop, checks for incoming data from the CC2530
 //
 void ZigbeeInputLoop(void) {
 
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+  if (ZigbeeRxQueue) {
+    ZigbeeEventRxDrain();
+    return;
+  }
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+
 #ifdef USE_ZIGBEE_ZNP
 	static uint32_t zigbee_polling_window = 0;    // number of milliseconds since first byte
 	static uint8_t fcs = ZIGBEE_SOF;
@@ -148,16 +390,16 @@ void ZigbeeInputLoop(void) {
 			// frame is correct
 			//AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received correct frame %s"), hex_char);
 
-			SBuffer znp_buffer = zigbee_buffer->subBuffer(2, zigbee_frame_len - 3);	// remove SOF, LEN and FCS
+			SBufferView znp_view(*zigbee_buffer, 2, zigbee_frame_len - 3);	// remove SOF, LEN and FCS - view, no copy
 
-      Response_P(PSTR("{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%_B\"}"), &znp_buffer);
+      Response_P(PSTR("{\"" D_JSON_ZIGBEEZNPRECEIVED "\":\"%*_H\"}"), znp_view.len(), znp_view.getBuffer());
       if (Settings->flag3.tuya_serial_mqtt_publish) {
         MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_RSLT_SENSOR));
       } else {
         AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "%s"), ResponseData());
       }
 			// now process the message
-      ZigbeeProcessInput(znp_buffer);
+      ZigbeeProcessInput(znp_view);
 		}
 		zigbee_buffer->setLen(0);		// empty buffer
   }
@@ -247,23 +489,22 @@ void ZigbeeInputLoop(void) {
       if (crc_received != crc) {
         AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": bad crc (received 0x%04X, computed 0x%04X) %_B"), crc_received, crc, zigbee_buffer);
       } else {
-        // copy buffer
-    	  SBuffer ezsp_buffer = zigbee_buffer->subBuffer(0, frame_len - 2);	// CRC
+        SBufferView ezsp_view(*zigbee_buffer, 0, frame_len - 2);	// remove CRC - view, no copy
 
-        // CRC is correct, apply de-stuffing if DATA frame
-        if (0 == (ezsp_buffer.get8(0) & 0x80)) {
+        // CRC is correct, apply de-stuffing in place if DATA frame
+        if (0 == (ezsp_view.get8(0) & 0x80)) {
           // DATA frame
           uint8_t rand = 0x42;
-          for (uint32_t i=1; i<ezsp_buffer.len(); i++) {
-            ezsp_buffer.set8(i, ezsp_buffer.get8(i) ^ rand);
+          for (uint32_t i=1; i<ezsp_view.len(); i++) {
+            ezsp_view.set8(i, ezsp_view.get8(i) ^ rand);
             if (rand & 1) { rand = (rand >> 1) ^ 0xB8; }
             else          { rand = (rand >> 1); }
           }
         }
 
-        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "2\":\"%_B\"}"), &ezsp_buffer);
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "2\":\"%*_H\"}"), ezsp_view.len(), ezsp_view.getBuffer());
         // now process the message
-        ZigbeeProcessInputRaw(ezsp_buffer);
+        ZigbeeProcessInputRaw(ezsp_view);
       }
     } else {
       // the buffer timed-out, print error and discard
@@ -324,6 +565,9 @@ void ZigbeeInitSerial(void)
 		zigbee.init_phase = true;			// start the state machine
     zigbee.state_machine = true;      // start the state machine
     ZigbeeSerial->flush();
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+    ZigbeeEventRxInit();
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
   }
 }
 
@@ -557,11 +801,11 @@ void ZigbeeEZSPSendDATA(const uint8_t *msg, size_t len) {
 }
 
 // Receive a high-level EZSP command/response, starting with 16-bits frame ID
-void ZigbeeProcessInputEZSP(SBuffer &buf) {
+void ZigbeeProcessInputEZSP(const SBufferView &raw) {
   // verify errors in first 2 bytes.
   // TODO
-  // uint8_t  sequence_num = buf.get8(0);
-  uint16_t frame_control = buf.get16(1);
+  // uint8_t  sequence_num = raw.get8(0);
+  uint16_t frame_control = raw.get16(1);
   bool truncated = frame_control & 0x02;
   bool overflow = frame_control & 0x01;
   // bool callbackPending = frame_control & 0x04;
@@ -570,14 +814,11 @@ void ZigbeeProcessInputEZSP(SBuffer &buf) {
     AddLog(LOG_LEVEL_INFO, PSTR("ZIG: specific frame_control 0x%04X"), frame_control);
   }
 
-  // remove first 2 bytes, be
-  for (uint32_t i=0; i<buf.len()-3; i++) {
-    buf.set8(i, buf.get8(i+3));
-  }
-  buf.setLen(buf.len() - 3);
+  // skip the first 3 bytes (sequence number and frame control) - view, no copy
+  SBufferView buf = raw.sub(3);
 
   // log message
-  Response_P(PSTR("{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "\":\"%_B\"}"), &buf);
+  Response_P(PSTR("{\"" D_JSON_ZIGBEE_EZSP_RECEIVED "\":\"%*_H\"}"), buf.len(), buf.getBuffer());
   if (Settings->flag3.tuya_serial_mqtt_publish) {
     MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_RSLT_SENSOR));
   } else {
@@ -637,7 +878,7 @@ void EZSP_HandleAck(uint8_t new_ack) {
 }
 
 // Receive raw ASH frame (CRC was removed, data unstuffed) but still contains frame numbers
-void ZigbeeProcessInputRaw(SBuffer &buf) {
+void ZigbeeProcessInputRaw(const SBufferView &buf) {
   uint8_t control_byte = buf.get8(0);
   uint8_t ack_num = control_byte & 0x07;        // keep 3 LSB
   if (control_byte & 0x80) {  // non DATA frame
@@ -665,11 +906,9 @@ void ZigbeeProcessInputRaw(SBuffer &buf) {
       EZSP_Serial.to_send = 0;
 
       // pass it to state machine with a special 0xFFFE frame code (EZSP_RSTACK_ID)
-      buf.set8(0, Z_B0(EZSP_rstAck));
-      buf.set8(1, Z_B1(EZSP_rstAck));
-      // keep byte #2 with code
-      buf.setLen(3);
-      ZigbeeProcessInput(buf);
+      uint8_t rstack_frame[3] = { Z_B0(EZSP_rstAck), Z_B1(EZSP_rstAck), buf.get8(2) };   // keep byte #2 with code
+      SBufferView rstack_view(rstack_frame, sizeof(rstack_frame));
+      ZigbeeProcessInput(rstack_view);
     } else if (control_byte == 0xC2) {
 
       // ERROR
@@ -694,13 +933,8 @@ void ZigbeeProcessInputRaw(SBuffer &buf) {
     ZigbeeEZSPSendRaw(&ack_byte, 1, false);   // send a 1-byte ACK
 
     // build the EZSP frame
-    // remove first byte
-    for (uint8_t i=0; i<buf.len()-1; i++) {
-      buf.set8(i, buf.get8(i+1));
-    }
-    buf.setLen(buf.len()-1);
-    // pass to next level
-    ZigbeeProcessInputEZSP(buf);
+    // skip the control byte - view, no copy
+    ZigbeeProcessInputEZSP(buf.sub(1));
   }
 }
 
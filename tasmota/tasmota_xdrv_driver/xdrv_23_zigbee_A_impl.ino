@@ -39,11 +39,14 @@ const char kZbCommands[] PROGMEM = D_PRFX_ZB "|"    // prefix
   D_CMND_ZIGBEE_STATUS "|" D_CMND_ZIGBEE_RESET "|" D_CMND_ZIGBEE_SEND "|" D_CMND_ZIGBEE_PROBE "|"
   D_CMND_ZIGBEE_INFO "|" D_CMND_ZIGBEE_FORGET "|" D_CMND_ZIGBEE_SAVE "|" D_CMND_ZIGBEE_NAME "|"
   D_CMND_ZIGBEE_BIND "|" D_CMND_ZIGBEE_UNBIND "|" D_CMND_ZIGBEE_PING "|" D_CMND_ZIGBEE_MODELID "|"
-  D_CMND_ZIGBEE_LIGHT "|" D_CMND_ZIGBEE_OCCUPANCY "|"
+  D_CMND_ZIGBEE_LIGHT "|" D_CMND_ZIGBEE_OCCUPANCY "|" D_CMND_ZIGBEE_COALESCE "|"
   D_CMND_ZIGBEE_RESTORE "|" D_CMND_ZIGBEE_BIND_STATE "|" D_CMND_ZIGBEE_MAP "|" D_CMND_ZIGBEE_LEAVE "|"
   D_CMND_ZIGBEE_CONFIG "|" D_CMND_ZIGBEE_DATA "|" D_CMND_ZIGBEE_SCAN "|" D_CMND_ZIGBEE_ENROLL "|" D_CMND_ZIGBEE_CIE "|"
   D_CMND_ZIGBEE_EMULATION "|"
   D_CMND_ZIGBEE_LOAD "|" D_CMND_ZIGBEE_UNLOAD "|" D_CMND_ZIGBEE_LOADDUMP
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+  "|" D_CMND_ZIGBEE_SERIAL
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
 #ifdef ZIGBEE_DOC
    "|" D_CMND_ZIGBEE_ATTRDUMP
 #endif // ZIGBEE_DOC
@@ -65,12 +68,15 @@ void (* const ZigbeeCommand[])(void) PROGMEM = {
   &CmndZbStatus, &CmndZbReset, &CmndZbSend, &CmndZbProbe,
   &CmndZbInfo, &CmndZbForget, &CmndZbSave, &CmndZbName,
   &CmndZbBind, &CmndZbUnbind, &CmndZbPing, &CmndZbModelId,
-  &CmndZbLight, &CmndZbOccupancy,
+  &CmndZbLight, &CmndZbOccupancy, &CmndZbCoalesce,
   &CmndZbRestore, &CmndZbBindState, &CmndZbMap, &CmndZbLeave,
   &CmndZbConfig, &CmndZbData, &CmndZbScan,
   &CmndZbenroll, &CmndZbCIE,
   &CmndZbEmulation,
   &CmndZbLoad, &CmndZbUnload, &CmndZbLoadDump,
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+  &CmndZbSerial,
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
 #ifdef ZIGBEE_DOC
   &CmndZbAttrDump,
 #endif // ZIGBEE_DOC
@@ -1294,7 +1300,7 @@ void CmndZbOccupancy(void) {
     Z_Data_PIR & pir = (Z_Data_PIR&) device.data.getByType(Z_Data_Type::Z_PIR);
     occupancy_time = strtol(p, nullptr, 10);
     pir.setTimeoutSeconds(occupancy_time);
-    zigbee_devices.dirty();
+    zigbee_devices.dirty(device);
   } else {
     const Z_Data_PIR & pir_found = (const Z_Data_PIR&) device.data.find(Z_Data_Type::Z_PIR);
     if (&pir_found != &z_data_unk) {
@@ -1307,6 +1313,35 @@ void CmndZbOccupancy(void) {
   ResponseCmndDone();
 }
 
+//
+// Command `ZbCoalesce`
+// Set or display the coalescing window for attribute reports of a device
+//
+// Syntax is:
+//  ZbCoalesce <device_id>,<ms>            - set the coalescing window in milliseconds (rounded to 10 ms, max 2540)
+//                                           0 publishes every report immediately, -1 reverts to the default
+//  ZbCoalesce <device_id>                 - display the current window
+// Where <device_id> can be: short_addr, long_addr, device_index, friendly_name
+//
+void CmndZbCoalesce(void) {
+  // check if parameters contain a comma ','
+  char *p;
+  strtok_r(XdrvMailbox.data, ",", &p);
+
+  // parse first part, <device_id>
+  Z_Device & device = zigbee_devices.parseDeviceFromName(XdrvMailbox.data, nullptr, nullptr, XdrvMailbox.payload);  // in case of short_addr, it must be already registered
+  if (!device.valid()) { ResponseCmndChar_P(PSTR(D_ZIGBEE_UNKNOWN_DEVICE)); return; }
+
+  if (p) {
+    device.setCoalesceMs(strtol(p, nullptr, 10));
+    zigbee_devices.dirty(device);
+  }
+  Response_P(PSTR("{\"" D_PRFX_ZB D_CMND_ZIGBEE_COALESCE "\":%d}"), device.getCoalesceMs());
+
+  MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, PSTR(D_PRFX_ZB D_CMND_ZIGBEE_COALESCE));
+  ResponseCmndDone();
+}
+
 //
 // Command `ZbForget`
 // Remove an old Zigbee device from the list of known devices, use ZigbeeStatus to know all registered devices
@@ -1829,6 +1864,27 @@ void CmndZbData(void) {
   ResponseCmndDone();
 }
 
+#if defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+//
+// Command `ZbSerial`
+// Report statistics from the event-driven serial frame assembler.
+// `ZbSerial 0` resets the counters and high-water marks.
+//
+void CmndZbSerial(void) {
+  if (nullptr == ZigbeeRxQueue) {
+    ResponseCmndChar_P(PSTR("Polled input"));    // event RX fell back to the polled input
+    return;
+  }
+  if ((XdrvMailbox.data_len > 0) && (0 == XdrvMailbox.payload)) {
+    memset(&Z_RxStats, 0, sizeof(Z_RxStats));
+  }
+  Response_P(PSTR("{\"" D_PRFX_ZB D_CMND_ZIGBEE_SERIAL "\":{\"Bytes\":%u,\"Discarded\":%u,\"Frames\":%u,\"Bad\":%u,\"Dropped\":%u,\"Timeout\":%u,\"RxPendingMax\":%u,\"QueueMax\":%u}}"),
+    Z_RxStats.bytes_received, Z_RxStats.bytes_discarded, Z_RxStats.frames_received,
+    Z_RxStats.frames_bad, Z_RxStats.frames_dropped, Z_RxStats.timeouts,
+    Z_RxStats.rx_pending_max, Z_RxStats.queue_max);
+}
+#endif // defined(ESP32) && defined(USE_ZIGBEE_EVENT_RX)
+
 //
 // Command `ZbConfig`
 //
@@ -1861,8 +1917,8 @@ void CmndZbConfig(void) {
     // if network key is zero, we generate a truly random key with a hardware generator from ESP
     if ((0 == zb_precfgkey_l) && (0 == zb_precfgkey_h)) {
       AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE D_ZIGBEE_GENERATE_KEY));
-      zb_precfgkey_l = (uint64_t)HwRandom() << 32 | HwRandom();
-      zb_precfgkey_h = (uint64_t)HwRandom() << 32 | HwRandom();
+      GetRandomBytes((uint8_t*)&zb_precfgkey_l, sizeof(zb_precfgkey_l));
+      GetRandomBytes((uint8_t*)&zb_precfgkey_h, sizeof(zb_precfgkey_h));
     }
 
     // Check if a parameter was changed after all
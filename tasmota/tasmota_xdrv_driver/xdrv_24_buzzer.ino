@@ -24,6 +24,10 @@
 
 #define XDRV_24                    24
 
+#include <Ticker.h>
+
+Ticker TickerBuzzer;
+
 struct BUZZER {
   uint32_t tune = 0;
   uint32_t tune_reload = 0;
@@ -37,7 +41,6 @@ struct BUZZER {
   uint8_t state = 0;
   uint8_t tune_size = 0;
   uint8_t size = 0;
-  uint8_t sleep;                   // Current copy of TasmotaGlobal.sleep
 } Buzzer;
 
 /*********************************************************************************************/
@@ -101,14 +104,11 @@ void BuzzerBeep(uint32_t count, uint32_t on, uint32_t off, uint32_t tune, uint32
 
   Buzzer.enable = (Buzzer.count > 0);
   if (Buzzer.enable) {
-    Buzzer.sleep = TasmotaGlobal.sleep;
-    if (Settings->sleep > PWM_MAX_SLEEP) {
-      TasmotaGlobal.sleep = PWM_MAX_SLEEP;   // Set a maxumum value of 10 milliseconds to ensure that buzzer periods are a bit more accurate
-    } else {
-      TasmotaGlobal.sleep = Settings->sleep;  // Or keep the current sleep if it's lower than 10
+    if (2 != Buzzer.mode) {
+      TickerBuzzer.attach_ms(100, BuzzerTick);  // Step the pattern from the RTC timer so it stays crisp when loop() is busy
     }
   } else {
-    TasmotaGlobal.sleep = Buzzer.sleep;      // Restore original sleep
+    TickerBuzzer.detach();
     BuzzerSet(0);
   }
 }
@@ -150,31 +150,37 @@ void BuzzerInit(void) {
   }
 }
 
-void BuzzerEvery100mSec(void) {
-  if (Buzzer.enable && (Buzzer.mode != 2)) {
-    if (Buzzer.count) {
-      if (Buzzer.duration) {
-        Buzzer.duration--;
-        if (!Buzzer.duration) {
-          if (Buzzer.size) {
-            Buzzer.size--;
-            Buzzer.state = Buzzer.tune & 1;
-            Buzzer.tune >>= 1;
-          } else {
-            Buzzer.size = Buzzer.tune_size;
-            Buzzer.tune = Buzzer.tune_reload;
-            Buzzer.count -= (Buzzer.tune_reload) ? 2 : 1;
-            Buzzer.state = Buzzer.count & 1;
-            if (Buzzer.mode) {
-              Buzzer.count |= 2;
-            }
+void BuzzerTick(void) {
+  // No Logging allowed. RTC Timer
+  if (Buzzer.count) {
+    if (Buzzer.duration) {
+      Buzzer.duration--;
+      if (!Buzzer.duration) {
+        if (Buzzer.size) {
+          Buzzer.size--;
+          Buzzer.state = Buzzer.tune & 1;
+          Buzzer.tune >>= 1;
+        } else {
+          Buzzer.size = Buzzer.tune_size;
+          Buzzer.tune = Buzzer.tune_reload;
+          Buzzer.count -= (Buzzer.tune_reload) ? 2 : 1;
+          Buzzer.state = Buzzer.count & 1;
+          if (Buzzer.mode) {
+            Buzzer.count |= 2;
           }
-          Buzzer.duration = Buzzer.set[Buzzer.state];
         }
+        Buzzer.duration = Buzzer.set[Buzzer.state];
       }
-      BuzzerSet(Buzzer.state);
-    } else {
-      TasmotaGlobal.sleep = Buzzer.sleep;      // Restore original sleep
+    }
+    BuzzerSet(Buzzer.state);
+  }
+}
+
+void BuzzerEvery100mSec(void) {
+  // Pattern stepping is done by BuzzerTick() on the RTC timer, the loop only releases it at completion
+  if (Buzzer.enable && (Buzzer.mode != 2)) {
+    if (!Buzzer.count) {
+      TickerBuzzer.detach();
       Buzzer.enable = false;
     }
   }
@@ -134,6 +134,11 @@ bool Xdrv25(uint32_t function)
       case FUNC_INIT:
         A4988Init();
         break;
+      case FUNC_EVERY_100_MSECOND:
+        if (myA4988) {
+          myA4988->service();              // Stop the step timer and disable the driver after a move
+        }
+        break;
       case FUNC_COMMAND:
         result = DecodeCommand(kA4988Commands, A4988Command);
         break;
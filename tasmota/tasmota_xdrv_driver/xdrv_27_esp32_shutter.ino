@@ -181,6 +181,10 @@ struct SHUTTER {
   uint16_t last_reported_time = 0;     // get information on skipped 50ms loop() slots
   uint32_t last_stop_time = 0;         // record the last time the relay was switched off
   uint8_t  button_simu_pressed = 0;    // record if both button where pressed simultanously
+  int32_t  last_tick_position = 0;     // position at the previous 50ms tick, used for ms interpolation
+  uint32_t move_start_ms = 0;          // millis() at movement start, for per-move timing stats
+  volatile uint32_t stop_detect_ms = 0;  // millis() when the ms comparator detected the target crossing
+  volatile uint8_t fast_stop = 0;      // ms comparator has already cut the direction relay
 } Shutter[MAX_SHUTTERS_ESP32];
 
 struct SHUTTERGLOBAL {
@@ -196,6 +200,7 @@ struct SHUTTERGLOBAL {
   uint8_t  stopp_armed = 0;                  // Count each step power usage is below limit of 1 Watt
   uint16_t cycle_time = 0;                   // used for shuttersetup to get accurate timing
   bool     sensor_data_reported = false;     // ensure that shutter sensor data reported every sedond is only reported if shutter is moving and there is a change.
+  uint8_t  ms_prescaler = 0;                 // millisecond ticks since the last 50ms integrator run
 } ShutterGlobal;
 
 #define SHT_DIV_ROUND(__A, __B) (((__A) + (__B)/2) / (__B))
@@ -607,7 +612,7 @@ void ShutterInit(void)
       }
       AddLog(LOG_LEVEL_INFO, PSTR("SHT: ShutterMode: %d"), ShutterGlobal.position_mode);
       // main function for stepper and servos to control velocity and acceleration.
-      TickerShutter.attach_ms(50, ShutterRtc50mS );
+      TickerShutter.attach_ms(1, ShutterRtc1mS );  // 1ms stop comparator, integrator runs every 50th tick
 
       // default the 50 percent should not have any impact without changing it. set to 60
       ShutterSettings.shutter_set50percent[i] = (ShutterSettings.shutter_set50percent[i] > 0) ? ShutterSettings.shutter_set50percent[i] : 50;
@@ -778,8 +783,15 @@ int32_t ShutterPercentToRealPosition(int16_t percent, uint32_t index)
 
 void ShutterPowerOff(uint8_t i)
 {
-  bool pwm_apply = false; 
+  bool pwm_apply = false;
   AddLog(LOG_LEVEL_DEBUG, PSTR("SHT: Stop %d Mode %d time %d, last source %d"), i+1,Shutter[i].switch_mode, Shutter[i].time, TasmotaGlobal.last_source); // fix log to indicate correct shutter number
+  if (Shutter[i].move_start_ms) {
+    // Per-move timing stats: total move duration and how far the ms comparator beat the loop
+    AddLog(LOG_LEVEL_DEBUG, PSTR("SHT: Shtr%d move %d ms, ms-stop lead %d ms"), i+1, millis() - Shutter[i].move_start_ms,
+      Shutter[i].stop_detect_ms ? millis() - Shutter[i].stop_detect_ms : 0);
+    Shutter[i].move_start_ms = 0;
+  }
+  Shutter[i].fast_stop = 0;
   ShutterDecellerateForStop(i);
   uint8_t cur_relay = ShutterSettings.shutter_startrelay[i] + (Shutter[i].direction == 1 ? 0 : (uint8_t)(ShutterGlobal.position_mode == SHT_TIME)) ;
   if (Shutter[i].direction !=0) {
@@ -985,6 +997,36 @@ void ShutterReportPosition(bool always, uint32_t index)
   //AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("SHT: rules_flag.shutter_moving: %d, moved %d"), TasmotaGlobal.rules_flag.shutter_moving, TasmotaGlobal.rules_flag.shutter_moved);
 }
 
+void ShutterRtc1mS(void)
+{
+  // No Logging allowed. RTC Timer
+  // Millisecond stop comparator: between two 50ms integrator runs the position is
+  // interpolated linearly and the direction relay is cut the moment the target is
+  // crossed, so fast motors no longer overshoot by up to a full 50ms tick. Only
+  // plain relay switching with time based position control qualifies - pulse mode,
+  // steppers, servos and tilt moves are stopped by the regular loop as before.
+  for (uint8_t i = 0; i < TasmotaGlobal.shutters_present; i++) {
+    if (Shutter[i].direction && !Shutter[i].fast_stop && (0 == Shutter[i].tiltmoving) &&
+        (SHT_SWITCH == Shutter[i].switch_mode) &&
+        ((SHT_TIME == ShutterGlobal.position_mode) || (SHT_TIME_UP_DOWN == ShutterGlobal.position_mode))) {
+      int32_t delta = Shutter[i].real_position - Shutter[i].last_tick_position;
+      int32_t interpolated = Shutter[i].real_position + (delta * ShutterGlobal.ms_prescaler) / 50;
+      if (interpolated * Shutter[i].direction >= Shutter[i].target_position * Shutter[i].direction) {
+        uint8_t cur_relay = ShutterSettings.shutter_startrelay[i] + (Shutter[i].direction == 1 ? 0 : (uint8_t)(ShutterGlobal.position_mode == SHT_TIME));
+        if ((cur_relay <= TasmotaGlobal.devices_present) && PinUsed(GPIO_REL1, cur_relay -1)) {
+          digitalWrite(Pin(GPIO_REL1, cur_relay -1), bitRead(TasmotaGlobal.rel_inverted, cur_relay -1) ? 1 : 0);
+          Shutter[i].stop_detect_ms = millis();
+          Shutter[i].fast_stop = 1;      // Loop follows up with the full stop sequence
+        }
+      }
+    }
+  }
+  if (++ShutterGlobal.ms_prescaler >= 50) {
+    ShutterGlobal.ms_prescaler = 0;
+    ShutterRtc50mS();
+  }
+}
+
 void ShutterRtc50mS(void)
 {
   bool pwm_apply = false;
@@ -992,6 +1034,7 @@ void ShutterRtc50mS(void)
   for (uint8_t i = 0; i < TasmotaGlobal.shutters_present; i++) {
     if (Shutter[i].direction) {
       // update position data before increasing counter
+      Shutter[i].last_tick_position = Shutter[i].real_position;
       Shutter[i].real_position =  ShutterCalculatePosition(i);
       Shutter[i].time++;
       ShutterCalculateAccelerator(i);
@@ -1196,6 +1239,10 @@ void ShutterStartInit(uint32_t i, int32_t direction, int32_t target_pos)
     ShutterGlobal.skip_relay_change         = 0;
     TasmotaGlobal.rules_flag.shutter_moved  = 0;
     ShutterGlobal.start_reported            = 0;
+    Shutter[i].last_tick_position           = Shutter[i].real_position;
+    Shutter[i].move_start_ms                = millis();
+    Shutter[i].stop_detect_ms               = 0;
+    Shutter[i].fast_stop                    = 0;
     Shutter[i].tilt_real_pos                = tmax(tmin(Shutter[i].tilt_real_pos,Shutter[i].tilt_config[1]),Shutter[i].tilt_config[0]);
     Shutter[i].tilt_start_pos               = Shutter[i].tilt_real_pos;
     if (Shutter[i].tilt_config[1] - Shutter[i].tilt_config[0] != 0) {
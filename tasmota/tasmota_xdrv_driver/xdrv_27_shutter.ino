@@ -118,6 +118,10 @@ struct SHUTTER {
   uint16_t min_TiltChange = 0;         // minimum change of the tilt before the shutter operates. different for PWM and time based operations
   uint16_t last_reported_time = 0;     // get information on skipped 50ms loop() slots
   uint32_t last_stop_time = 0;         // record the last time the relay was switched off
+  int32_t  last_tick_position = 0;     // position at the previous 50ms tick, used for ms interpolation
+  uint32_t move_start_ms = 0;          // millis() at movement start, for per-move timing stats
+  volatile uint32_t stop_detect_ms = 0;  // millis() when the ms comparator detected the target crossing
+  volatile uint8_t fast_stop = 0;      // ms comparator has already cut the direction relay
 } Shutter[MAX_SHUTTERS];
 
 struct SHUTTERGLOBAL {
@@ -129,6 +133,7 @@ struct SHUTTERGLOBAL {
   uint8_t  skip_relay_change;                // avoid overrun at endstops
   uint8_t  start_reported = 0;               // indicates of the shutter start was reported through MQTT JSON
   uint16_t open_velocity_max = RESOLUTION;   // maximum of PWM change during opening. Defines velocity on opening. Steppers and Servos only
+  uint8_t  ms_prescaler = 0;                 // millisecond ticks since the last 50ms integrator run
 } ShutterGlobal;
 
 #define SHT_DIV_ROUND(__A, __B) (((__A) + (__B)/2) / (__B))
@@ -205,6 +210,36 @@ void ShutterUpdateVelocity(uint8_t i)
   }
 }
 
+void ShutterRtc1mS(void)
+{
+  // No Logging allowed. RTC Timer
+  // Millisecond stop comparator: between two 50ms integrator runs the position is
+  // interpolated linearly and the direction relay is cut the moment the target is
+  // crossed, so fast motors no longer overshoot by up to a full 50ms tick. Only
+  // plain relay switching with time based position control qualifies - pulse mode,
+  // steppers, servos and tilt moves are stopped by the regular loop as before.
+  for (uint8_t i = 0; i < TasmotaGlobal.shutters_present; i++) {
+    if (Shutter[i].direction && !Shutter[i].fast_stop && (0 == Shutter[i].tiltmoving) &&
+        (SHT_SWITCH == Shutter[i].switch_mode) &&
+        ((SHT_TIME == ShutterGlobal.position_mode) || (SHT_TIME_UP_DOWN == ShutterGlobal.position_mode))) {
+      int32_t delta = Shutter[i].real_position - Shutter[i].last_tick_position;
+      int32_t interpolated = Shutter[i].real_position + (delta * ShutterGlobal.ms_prescaler) / 50;
+      if (interpolated * Shutter[i].direction >= Shutter[i].target_position * Shutter[i].direction) {
+        uint8_t cur_relay = Settings->shutter_startrelay[i] + (Shutter[i].direction == 1 ? 0 : (uint8_t)(ShutterGlobal.position_mode == SHT_TIME));
+        if ((cur_relay <= TasmotaGlobal.devices_present) && PinUsed(GPIO_REL1, cur_relay -1)) {
+          digitalWrite(Pin(GPIO_REL1, cur_relay -1), bitRead(TasmotaGlobal.rel_inverted, cur_relay -1) ? 1 : 0);
+          Shutter[i].stop_detect_ms = millis();
+          Shutter[i].fast_stop = 1;      // Loop follows up with the full stop sequence
+        }
+      }
+    }
+  }
+  if (++ShutterGlobal.ms_prescaler >= 50) {
+    ShutterGlobal.ms_prescaler = 0;
+    ShutterRtc50mS();
+  }
+}
+
 void ShutterRtc50mS(void)
 {
 #ifdef ESP32
@@ -214,6 +249,7 @@ void ShutterRtc50mS(void)
   for (uint8_t i = 0; i < TasmotaGlobal.shutters_present; i++) {
     if (Shutter[i].direction) {
       // update position data before increasing counter
+      Shutter[i].last_tick_position = Shutter[i].real_position;
       Shutter[i].real_position =  ShutterCalculatePosition(i);
       Shutter[i].time++;
       ShutterCalculateAccelerator(i);
@@ -375,7 +411,7 @@ void ShutterInit(void)
       }
       AddLog(LOG_LEVEL_INFO, PSTR("SHT: ShutterMode: %d"), ShutterGlobal.position_mode);
       // main function for stepper and servos to control velocity and acceleration.
-      TickerShutter.attach_ms(50, ShutterRtc50mS );
+      TickerShutter.attach_ms(1, ShutterRtc1mS );  // 1ms stop comparator, integrator runs every 50th tick
 
       // default the 50 percent should not have any impact without changing it. set to 60
       Settings->shutter_set50percent[i] = (Settings->shutter_set50percent[i] > 0) ? Settings->shutter_set50percent[i] : 50;
@@ -598,6 +634,13 @@ void ShutterDecellerateForStop(uint8_t i)
 void ShutterPowerOff(uint8_t i)
 {
   AddLog(LOG_LEVEL_DEBUG, PSTR("SHT: Stop %d Mode %d time %d"), i+1,Shutter[i].switch_mode, Shutter[i].time); // fix log to indicate correct shutter number
+  if (Shutter[i].move_start_ms) {
+    // per-move timing stats: total move duration and lead of the ms comparator over the loop stop
+    AddLog(LOG_LEVEL_DEBUG, PSTR("SHT: Shtr%d move %d ms, ms-stop lead %d ms"), i+1, millis() - Shutter[i].move_start_ms,
+      Shutter[i].stop_detect_ms ? millis() - Shutter[i].stop_detect_ms : 0);
+    Shutter[i].move_start_ms = 0;
+  }
+  Shutter[i].fast_stop = 0;
   ShutterDecellerateForStop(i);
   uint8_t cur_relay = Settings->shutter_startrelay[i] + (Shutter[i].direction == 1 ? 0 : (uint8_t)(ShutterGlobal.position_mode == SHT_TIME)) ;
   if (Shutter[i].direction !=0) {
@@ -781,6 +824,10 @@ void ShutterStartInit(uint32_t i, int32_t direction, int32_t target_pos)
     ShutterGlobal.skip_relay_change = 0;
     TasmotaGlobal.rules_flag.shutter_moved  = 0;
     ShutterGlobal.start_reported = 0;
+    Shutter[i].last_tick_position = Shutter[i].real_position;
+    Shutter[i].move_start_ms = millis();
+    Shutter[i].stop_detect_ms = 0;
+    Shutter[i].fast_stop = 0;
     Shutter[i].tilt_real_pos = tmax(tmin(Shutter[i].tilt_real_pos,Shutter[i].tilt_config[1]),Shutter[i].tilt_config[0]);
     Shutter[i].tilt_start_pos =  Shutter[i].tilt_real_pos;
     if (Shutter[i].tilt_config[1]-Shutter[i].tilt_config[0] != 0) {
@@ -733,6 +733,7 @@ bool Xdrv28(uint32_t function) {
         if (!Pcf8574.interrupt) { return false; }
 //        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("PCF: Interrupt"));
         Pcf8574ServiceInput();
+        SleepRequestWake(1);             // Keep per-millisecond cadence while edges are arriving
         break;
       case FUNC_EVERY_100_MSECOND:
         if (Pcf8574.button_max || Pcf8574.switch_max) {
@@ -50,6 +50,98 @@ void (* const DeepsleepCommand[])(void) PROGMEM = {
 uint32_t deepsleep_sleeptime = 0;
 uint8_t deepsleep_flag = 0;
 
+/*********************************************************************************************\
+ * Wake snapshot in RTC memory
+ *
+ * A sleepy node repeats the expensive parts of a boot on every wake: scan for the AP,
+ * run a DHCP exchange and resolve the MQTT broker before the first publish. The last
+ * good results survive deep sleep in RTC memory and are replayed on wake:
+ * - AP channel and BSSID are already cached, see WifiFastReconnectChannel()
+ * - the DHCP lease is reapplied as a static config, skipping the DHCP exchange
+ * - the resolved broker address seeds the DNS cache, skipping the first lookup
+ * The snapshot is only taken when the network was healthy at bedtime, so a wake that
+ * fails to connect automatically falls back to the full procedure on the next wake.
+\*********************************************************************************************/
+
+const uint32_t DEEPSLEEP_SNAPSHOT_RTC_OFFSET = 92;  // RTC memory words 92..94 - crash flight recorder ends at 88, TRtcReboot starts at 96
+
+typedef struct {
+  uint16_t      valid;                     // RTC_MEM_VALID
+  uint8_t       lease_valid;               // wifi_ip was leased while gateway/netmask/DNS in Settings were current
+  uint8_t       free_003[1];
+  uint32_t      wifi_ip;                   // DHCP leased IP address
+  uint32_t      mqtt_ip;                   // Resolved MQTT broker address, `0` = unknown
+} TRtcWakeSnapshot;
+TRtcWakeSnapshot RtcWakeSnapshot;
+#ifdef ESP32
+static RTC_NOINIT_ATTR TRtcWakeSnapshot RtcDataWakeSnapshot;
+#endif  // ESP32
+
+void DeepSleepSnapshotSave(void) {
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(DEEPSLEEP_SNAPSHOT_RTC_OFFSET, (uint32_t*)&RtcWakeSnapshot, sizeof(RtcWakeSnapshot));
+#endif  // ESP8266
+#ifdef ESP32
+  RtcDataWakeSnapshot = RtcWakeSnapshot;
+#endif  // ESP32
+}
+
+void DeepSleepSnapshotLoad(void) {
+#ifdef ESP8266
+  ESP.rtcUserMemoryRead(DEEPSLEEP_SNAPSHOT_RTC_OFFSET, (uint32_t*)&RtcWakeSnapshot, sizeof(RtcWakeSnapshot));
+#endif  // ESP8266
+#ifdef ESP32
+  RtcWakeSnapshot = RtcDataWakeSnapshot;
+#endif  // ESP32
+  if (RTC_MEM_VALID != RtcWakeSnapshot.valid) {
+    memset(&RtcWakeSnapshot, 0, sizeof(RtcWakeSnapshot));
+  }
+}
+
+// Capture the network state just before going to sleep
+void DeepSleepSnapshotTake(void) {
+  memset(&RtcWakeSnapshot, 0, sizeof(RtcWakeSnapshot));
+  // Only a fully working session is worth replaying: wifi up and, when MQTT is
+  // used, the broker reached. Anything else keeps the snapshot invalid so the
+  // next wake runs the normal scan/DHCP/DNS procedure.
+  if ((WL_CONNECTED == Wifi.status) && (!Settings->flag.mqtt_enabled || !TasmotaGlobal.global_state.mqtt_down)) {  // SetOption3 - Enable MQTT
+    RtcWakeSnapshot.valid = RTC_MEM_VALID;
+    if (!Settings->ipv4_address[0]) {      // DHCP in use, lease worth reapplying
+      RtcWakeSnapshot.lease_valid = 1;
+      RtcWakeSnapshot.wifi_ip = (uint32_t)WiFi.localIP();
+    }
+    if (Settings->flag.mqtt_enabled) {     // SetOption3 - Enable MQTT
+      IPAddress mqtt_ip;
+      if (WifiHostByName(SettingsText(SET_MQTT_HOST), mqtt_ip)) {  // Served from the DNS cache while connected
+        RtcWakeSnapshot.mqtt_ip = (uint32_t)mqtt_ip;
+      }
+    }
+  }
+  DeepSleepSnapshotSave();
+}
+
+// Replay the snapshot on a deep sleep wake, before wifi is started
+void DeepSleepSnapshotRestore(void) {
+  DeepSleepSnapshotLoad();
+  if (RTC_MEM_VALID != RtcWakeSnapshot.valid) { return; }
+  if (RtcWakeSnapshot.lease_valid && !Settings->ipv4_address[0]) {
+    Wifi.lease_ip = RtcWakeSnapshot.wifi_ip;       // Reapplied as static config in WifiBegin()
+  }
+  if (RtcWakeSnapshot.mqtt_ip) {
+    WifiDnsSeed(SettingsText(SET_MQTT_HOST), IPAddress(RtcWakeSnapshot.mqtt_ip));
+  }
+  AddLog(LOG_LEVEL_DEBUG, PSTR("DSL: Wake snapshot restored, ip %_I, mqtt %_I"), RtcWakeSnapshot.wifi_ip, RtcWakeSnapshot.mqtt_ip);
+}
+
+// Wake plan: on a deep-sleep wake the awake window is the battery budget. Sensors with a
+// warm-up or settling time (CCS811, SCD40, ...) are kicked before wifi association starts
+// so their settling overlaps network bring-up instead of following it.
+void DeepSleepWakePlan(void) {
+  uint32_t start = millis();
+  XsnsCall(FUNC_WAKE_WARMUP);
+  AddLog(LOG_LEVEL_DEBUG, PSTR("DSL: Sensor warm-up kick took %d ms"), millis() - start);
+}
+
 bool DeepSleepEnabled(void)
 {
 #if defined(USE_RULES) && defined(USE_TIMERS) 
@@ -89,6 +181,8 @@ void DeepSleepReInit(void)
       yield();
       // Sleeping
     }
+    DeepSleepSnapshotRestore();   // Staying awake, replay the network state of the last session
+    DeepSleepWakePlan();          // Kick sensor warm-up before wifi association starts
   }
   // Stay awake
   RtcSettings.ultradeepsleep = 0;
@@ -231,6 +325,7 @@ void DeepSleepStart(void)
   Response_P(PSTR("{\"" D_PRFX_DEEPSLEEP "\":{\"" D_JSON_TIME "\":\"%s\",\"" D_PRFX_DEEPSLEEP "\":%d,\"Wakeup\":%d}}"), (char*)dt.c_str(), LocalTime(), RtcSettings.nextwakeup);
   MqttPublishPrefixTopicRulesProcess_P(TELE, PSTR(D_PRFX_DEEPSLEEP), true);
 
+    DeepSleepSnapshotTake();
     WifiShutdown();
     RtcSettings.ultradeepsleep = RtcSettings.nextwakeup - LocalTime();
     RtcSettingsSave();
@@ -27,11 +27,13 @@
 #include "lwip/timeouts.h"
 
 const char kPingCommands[] PROGMEM =  "|"    // no prefix
-  D_CMND_PING
+  D_CMND_PING "|"
+  D_CMND_PING "Monitor"
   ;
 
 void (* const PingCommand[])(void) PROGMEM = {
   &CmndPing,
+  &CmndPingMonitor,
   };
 
 extern "C" {
@@ -58,6 +60,7 @@ extern "C" {
     uint32_t    sum_time;           // cumulated time in ms for all successful responses (used to compute the average)
     bool        done;               // indicates the ping campaign is finished
     bool        fast;               // fast mode, i.e. stop pings when first successful response
+    bool        monitor;            // probe of a monitored host, result routed to its monitor instead of published
     String      hostname;           // original hostname before convertion to IP address
   } Ping_t;
 
@@ -304,7 +307,7 @@ extern "C" {
   //  0: OK
   // -1: ping already ongoing for this address
   // -2: unable to resolve address
-  int32_t t_ping_start(const char *hostname, uint32_t count) {
+  int32_t t_ping_start(const char *hostname, uint32_t count, bool monitor) {
     IPAddress ipfull;
     bool host_resolved = WifiHostByName(hostname, ipfull);
 
@@ -329,6 +332,7 @@ extern "C" {
     ping->min_time = UINT32_MAX;
     ping->ip = ip;
     ping->to_send_count = count - 1;
+    ping->monitor = monitor;
     ping->hostname = hostname;
 
     // add to Linked List from head
@@ -353,6 +357,83 @@ extern "C" {
 
 }
 
+/*********************************************************************************************\
+ * Continuous monitoring of multiple hosts
+ *
+ * Each monitored host is probed on its own period by the concurrent engine above.
+ * Rolling statistics are kept per host; a result is only published when the
+ * reachability state flips (down after three missed probes in a row, up on the
+ * first reply), so rules and Berry see transitions instead of a poll stream.
+\*********************************************************************************************/
+
+typedef struct PingMon_t {
+  struct PingMon_t *next;           // next object in linked list
+  String   hostname;                // monitored host
+  uint16_t period;                  // seconds between probes
+  uint16_t countdown;               // seconds until the next probe
+  uint8_t  history;                 // rolling bitmap of the last 8 probes, bit 0 = latest, 1 = reply received
+  uint8_t  probes;                  // probes recorded in history, saturates at 8
+  uint32_t rtt_avg;                 // smoothed round trip time in ms (EWMA 1/8)
+  bool     alive;                   // current reachability state
+} PingMon_t;
+
+PingMon_t *ping_mon_head = nullptr;
+
+PingMon_t *PingMonFind(const char *hostname) {
+  for (PingMon_t *mon = ping_mon_head; mon != nullptr; mon = mon->next) {
+    if (mon->hostname.equalsIgnoreCase(hostname)) {
+      return mon;
+    }
+  }
+  return nullptr;
+}
+
+// Route the result of a monitor probe to its monitor
+void PingMonUpdate(Ping_t *ping) {
+  PingMon_t *mon = PingMonFind(ping->hostname.c_str());
+  if (nullptr == mon) { return; }   // monitor was removed while the probe was flying
+
+  bool success = (ping->success_count > 0);
+  mon->history = (mon->history << 1) | success;
+  if (mon->probes < 8) { mon->probes++; }
+  if (success) {
+    uint32_t rtt = ping->sum_time / ping->success_count;
+    mon->rtt_avg = (mon->rtt_avg) ? (mon->rtt_avg * 7 + rtt) / 8 : rtt;
+  }
+
+  bool alive = mon->alive;
+  if (success) {
+    alive = true;
+  } else if ((mon->probes >= 3) && (0 == (mon->history & 0x07))) {
+    alive = false;
+  }
+  if (alive != mon->alive) {
+    mon->alive = alive;
+    Response_P(PSTR("{\"" D_JSON_PING "\":{\"%s\":{"
+                    "\"Reachable\":%s"
+                    ",\"AvgTime\":%d"
+                    "}}}"),
+                    mon->hostname.c_str(),
+                    alive ? PSTR("true") : PSTR("false"),
+                    mon->rtt_avg
+                    );
+    MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_PING));
+  }
+}
+
+// Launch the probes whose period elapsed
+void PingMonEverySecond(void) {
+  if (TasmotaGlobal.global_state.network_down) { return; }
+  for (PingMon_t *mon = ping_mon_head; mon != nullptr; mon = mon->next) {
+    if (mon->countdown > 1) {
+      mon->countdown--;
+    } else {
+      mon->countdown = mon->period;
+      t_ping_start(mon->hostname.c_str(), 1, true);   // single probe, ignore -1 if one is still flying
+    }
+  }
+}
+
 // Check if any ping requests is completed, and publish the results
 void PingResponsePoll(void) {
   Ping_t *ping = ping_head;
@@ -363,7 +444,9 @@ void PingResponsePoll(void) {
       uint32_t success = ping->success_count;
       bool resolved = !ip_addr_isany_val(ping->ip);
 
-      if (!resolved) {
+      if (ping->monitor) {
+        PingMonUpdate(ping);            // routed to the monitor, published on state transitions only
+      } else if (!resolved) {
         Response_P(PSTR("{\"" D_JSON_PING "\":{\"%s\":{"
                         "\"Reachable\":false"
                         ",\"IP\":\"\""
@@ -396,7 +479,9 @@ void PingResponsePoll(void) {
                         success ? ping->sum_time / success : 0
                         );
       }
-      MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_PING));
+      if (!ping->monitor) {
+        MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_PING));
+      }
 
       // remove from linked list
       *prev_link = ping->next;
@@ -421,7 +506,7 @@ void CmndPing(void) {
   RemoveSpace(XdrvMailbox.data);
   if (count > 10) { count = 8; }   // max 8 seconds
 
-  int32_t res = t_ping_start(XdrvMailbox.data, count);
+  int32_t res = t_ping_start(XdrvMailbox.data, count, false);
   if (0 == res) {
     ResponseCmndDone();
   } else if (-1 == res) {
@@ -432,6 +517,77 @@ void CmndPing(void) {
 }
 
 
+void CmndPingMonitor(void) {
+  // PingMonitor<period> <host> - probe <host> every <period> seconds (default 60)
+  // PingMonitor0 <host>        - stop monitoring <host>
+  // PingMonitor0               - stop all monitors
+  // PingMonitor                - report rolling statistics per monitored host
+  RemoveSpace(XdrvMailbox.data);
+  uint32_t period = XdrvMailbox.index;
+
+  if (XdrvMailbox.data_len > 0) {
+    if (0 == period) {                             // Stop monitoring this host
+      PingMon_t *mon = ping_mon_head;
+      PingMon_t **prev_link = &ping_mon_head;
+      while (mon != nullptr) {
+        if (mon->hostname.equalsIgnoreCase(XdrvMailbox.data)) {
+          *prev_link = mon->next;
+          delete mon;
+          break;
+        }
+        prev_link = &mon->next;
+        mon = mon->next;
+      }
+    } else {
+      if (period < 5) { period = 60; }             // Index 1 (no explicit period) and anything shorter
+      if (period > 3600) { period = 3600; }
+      PingMon_t *mon = PingMonFind(XdrvMailbox.data);
+      if (nullptr == mon) {
+        mon = new PingMon_t();
+        mon->hostname = XdrvMailbox.data;
+        mon->alive = true;
+        uint32_t stagger = 0;                      // Spread first probes so the schedules do not burst together
+        for (PingMon_t *m = ping_mon_head; m != nullptr; m = m->next) { stagger++; }
+        mon->countdown = 1 + (stagger % period);
+        mon->next = ping_mon_head;
+        ping_mon_head = mon;
+      }
+      mon->period = period;
+    }
+    ResponseCmndDone();
+  } else {
+    if (0 == period) {                             // Stop all monitors
+      while (ping_mon_head != nullptr) {
+        PingMon_t *mon = ping_mon_head;
+        ping_mon_head = mon->next;
+        delete mon;
+      }
+      ResponseCmndDone();
+    } else {                                       // Report rolling statistics
+      Response_P(PSTR("{\"%s\":{"), XdrvMailbox.command);
+      bool first = true;
+      for (PingMon_t *mon = ping_mon_head; mon != nullptr; mon = mon->next) {
+        uint32_t window = (mon->probes < 8) ? mon->probes : 8;
+        uint32_t replies = __builtin_popcount(mon->history & ((1 << window) -1));
+        if (!first) { ResponseAppend_P(PSTR(",")); }
+        ResponseAppend_P(PSTR("\"%s\":{"
+                        "\"Reachable\":%s"
+                        ",\"AvgTime\":%d"
+                        ",\"Loss\":%d"
+                        ",\"Period\":%d"
+                        "}"),
+                        mon->hostname.c_str(),
+                        mon->alive ? PSTR("true") : PSTR("false"),
+                        mon->rtt_avg,
+                        window ? ((window - replies) * 100) / window : 0,
+                        mon->period);
+        first = false;
+      }
+      ResponseAppend_P(PSTR("}}"));
+    }
+  }
+}
+
 /*********************************************************************************************\
  * Interface
 \*********************************************************************************************/
@@ -444,6 +600,9 @@ bool Xdrv38(uint32_t function)
     case FUNC_EVERY_250_MSECOND:
       PingResponsePoll();   // TODO
       break;
+    case FUNC_EVERY_SECOND:
+      PingMonEverySecond();
+      break;
     case FUNC_COMMAND:
       result = DecodeCommand(kPingCommands, PingCommand);
       break;
@@ -26,7 +26,7 @@
  * TmFingerprint <fp> - Set fingerprint
  * TmToken <token>    - Add your BotFather created bot token (default none)
  * TmChatId <chat_id> - Add your BotFather created bot chat id (default none)
- * TmPoll <seconds>   - Telegram receive poll time (default 10 seconds)
+ * TmPoll <seconds>   - Telegram receive poll time, held open server side as long poll timeout (default 10 seconds)
  * TmState 0          - Disable telegram sending (default)
  * TmState 1          - Enable telegram sending (needs valid TmChatId)
  * TmState 2          - Disable telegram listener (default)
@@ -78,6 +78,9 @@ typedef struct {
   uint8_t retry = 0;
   uint8_t poll = TELEGRAM_LOOP_WAIT;
   uint8_t wait = 0;
+  uint8_t fails = 0;          // Consecutive poll failures, drives reconnect backoff
+  uint32_t poll_start = 0;    // millis() when the long poll request was sent
+  bool polling = false;       // getUpdates request held open by the server
   bool recv_busy = false;
   bool skip = true;           // Skip first telegram if restarted
 } Telegram_t;
@@ -95,6 +98,9 @@ bool TelegramStart(void) {
   HexToBytes(SettingsText(SET_TELEGRAM_FINGERPRINT), Telegram->fingerprint, sizeof(Telegram->fingerprint));
   telegramClient->setPubKeyFingerprint(Telegram->fingerprint, Telegram->fingerprint, false); // check server fingerprint
 
+  static br_ssl_session_parameters tls_session = { 0 };
+  telegramClient->setSession(&tls_session);  // Abbreviated TLS handshake when the connection needs to be redone
+
   Telegram->message_count = 0;     // Number of received messages
   Telegram->next_update_id = 0;    // Code of last read Message
   Telegram->message[0].text = "";
@@ -108,25 +114,48 @@ void TelegramStop(void) {
     telegramClient->stop();
     delete telegramClient;
     telegramClient = nullptr;
+    Telegram->polling = false;
+    Telegram->state = 0;
     AddLog(LOG_LEVEL_INFO, PSTR("TGM: Stopped"));
   }
 }
 
-String TelegramConnectToTelegram(const String &command) {
-//  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TGM: Cmnd '%s'"), command.c_str());
-
-  if (!TelegramStart()) { return ""; }
+bool TelegramConnected(void) {
+  if (!TelegramStart()) { return false; }
+  if (telegramClient->connected()) { return true; }
 
-  String response = "";
-  String host = F("api.telegram.org");
   uint32_t tls_connect_time = millis();
-  if (telegramClient->connect(host.c_str(), 443)) {
-
+  if (telegramClient->connect("api.telegram.org", 443)) {
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TGM: Connected in %d ms, max ThunkStack used %d"), millis() - tls_connect_time, telegramClient->getMaxThunkStackUse());
-    
-//    telegramClient->println("GET /"+command);  // Fails after 20210621
-    String request = "GET /" + command + " HTTP/1.1\r\nHost: " + host + "\r\nConnection: close\r\n\r\n";
-    telegramClient->print(request);
+    return true;
+  }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR("TGM: TLS connection error %d"), telegramClient->getLastError());
+
+  const uint8_t *recv_fingerprint = telegramClient->getRecvPubKeyFingerprint();
+  char buf_fingerprint[64];
+  if (!Settings->sbflag1.telegram_disable_af) {  // CMND_TMSTATE 6/7 - Disable Telegram auto-fingerprint fix
+    // Replace current fingerprint with the fingerprint received
+    ToHex_P(recv_fingerprint, 20, buf_fingerprint, sizeof(buf_fingerprint));
+    SettingsUpdateText(SET_TELEGRAM_FINGERPRINT, buf_fingerprint);
+    TelegramStop();
+  } else {
+    // Create a printable version of the fingerprint received
+    ToHex_P(recv_fingerprint, 20, buf_fingerprint, sizeof(buf_fingerprint), ' ');
+    AddLog(LOG_LEVEL_DEBUG, PSTR("TGM: Telegram fingerprint %s"), buf_fingerprint);
+  }
+  return false;
+}
+
+void TelegramSendRequest(const String &command) {
+  while (telegramClient->available()) { telegramClient->read(); }  // Drop stale bytes of an earlier response
+
+//  telegramClient->println("GET /"+command);  // Fails after 20210621
+  String request = "GET /" + command + " HTTP/1.1\r\nHost: api.telegram.org\r\nConnection: keep-alive\r\n\r\n";
+  telegramClient->print(request);
+}
+
+String TelegramReadResponse(void) {
 /*
     Response before 20210621:
     {"ok":true,"result":[]}
@@ -145,54 +174,64 @@ String TelegramConnectToTelegram(const String &command) {
 
     {"ok":true,"result":[]}
 */
-    char c;
-    bool available = false;
-    uint32_t now = millis();
-    while (!available && (millis() -now < 1500)) {
-      while (telegramClient->available()) {
-        c = telegramClient->read();
-        if (c == '{') {
-          available = true;               // Skip headers (+-400 bytes) and start response at first JSON
-        }
-        if (available) {
-          response += c;
-          if (response.length() > 2000) {  // Allow up to 5 messages
-            break;
-          }
+  String response = "";
+  char c;
+  bool available = false;
+  uint32_t now = millis();
+  while (!available && (millis() -now < 1500)) {
+    while (telegramClient->available()) {
+      c = telegramClient->read();
+      if (c == '{') {
+        available = true;               // Skip headers (+-400 bytes) and start response at first JSON
+      }
+      if (available) {
+        response += c;
+        if (response.length() > 2000) {  // Allow up to 5 messages
+          break;
         }
       }
     }
+  }
+  return response;
+}
+
+String TelegramConnectToTelegram(const String &command) {
+//  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TGM: Cmnd '%s'"), command.c_str());
 
+  if (Telegram->polling) {
+    // A getUpdates request is still held open - drop the connection so this request
+    // does not pipeline behind it. The poll state machine reconnects and polls again.
     telegramClient->stop();
-  } else {
-    AddLog(LOG_LEVEL_DEBUG, PSTR("TGM: TLS connection error %d"), telegramClient->getLastError());
-
-    const uint8_t *recv_fingerprint = telegramClient->getRecvPubKeyFingerprint();
-    char buf_fingerprint[64];
-    if (!Settings->sbflag1.telegram_disable_af) {  // CMND_TMSTATE 6/7 - Disable Telegram auto-fingerprint fix
-      // Replace current fingerprint with the fingerprint received
-      ToHex_P(recv_fingerprint, 20, buf_fingerprint, sizeof(buf_fingerprint));
-      SettingsUpdateText(SET_TELEGRAM_FINGERPRINT, buf_fingerprint);
-      TelegramStop();
-    } else {
-      // Create a printable version of the fingerprint received
-      ToHex_P(recv_fingerprint, 20, buf_fingerprint, sizeof(buf_fingerprint), ' ');
-      AddLog(LOG_LEVEL_DEBUG, PSTR("TGM: Telegram fingerprint %s"), buf_fingerprint);
-    }
+    Telegram->polling = false;
   }
+  if (!TelegramConnected()) { return ""; }
 
+  TelegramSendRequest(command);
+  String response = TelegramReadResponse();
+  if (!response.length()) {
+    telegramClient->stop();             // No (complete) reply - reconnect on next use
+  }
   return response;
 }
 
-void TelegramGetUpdates(uint32_t offset) {
+bool TelegramStartGetUpdates(uint32_t offset) {
   AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TGM: getUpdates"));
 
-  if (!TelegramStart()) { return; }
+  if (!TelegramConnected()) { return false; }
 
+  // The timeout parameter makes the server hold the request open until a message
+  // arrives (long poll) - the reply is collected asynchronously by TelegramLoop
+  uint32_t timeout = Telegram->poll;
+  if (timeout > 50) { timeout = 50; }                         // Telegram getUpdates limit
   String _token = SettingsText(SET_TELEGRAM_TOKEN);
-  String command = "bot" + _token + "/getUpdates?offset=" + String(offset);
-  String response = TelegramConnectToTelegram(command);       //recieve reply from telegram.org
+  String command = "bot" + _token + "/getUpdates?offset=" + String(offset) + "&timeout=" + String(timeout);
+  TelegramSendRequest(command);
+  Telegram->poll_start = millis();
+  Telegram->polling = true;
+  return true;
+}
 
+void TelegramParseUpdates(const String &response) {
   // {"ok":true,"result":[]}
   // or
   // {"ok":true,"result":[
@@ -361,6 +400,14 @@ String TelegramExecuteCommand(const char *svalue) {
   return response;
 }
 
+void TelegramPollFailed(void) {
+  // Back off on consecutive failures: poll, 2x, 4x, 8x poll seconds capped at 60
+  uint32_t wait = (uint32_t)Telegram->poll << Telegram->fails;
+  Telegram->wait = (wait > 60) ? 60 : wait;
+  if (Telegram->fails < 3) { Telegram->fails++; }
+  Telegram->state = 3;
+}
+
 void TelegramLoop(void) {
   if (!TasmotaGlobal.global_state.network_down && (Settings->sbflag1.telegram_recv_enable || Settings->sbflag1.telegram_echo_enable)) {
     switch (Telegram->state) {
@@ -369,10 +416,11 @@ void TelegramLoop(void) {
         Telegram->state++;
         break;
       case 1:
-        TelegramGetUpdates(Telegram->next_update_id);   // Launch API GetUpdates up to xxx message
-        Telegram->index = 0;
-        Telegram->retry = TELEGRAM_SEND_RETRY;
-        Telegram->state++;
+        if (TelegramStartGetUpdates(Telegram->next_update_id)) {  // Launch API GetUpdates up to xxx message
+          Telegram->state = 4;
+        } else {
+          TelegramPollFailed();
+        }
         break;
       case 2:
         if (Settings->sbflag1.telegram_echo_enable) {
@@ -385,7 +433,7 @@ void TelegramLoop(void) {
             }
           } else {
             Telegram->message_count = 0;   // All messages have been replied - reset new messages
-            Telegram->wait = Telegram->poll;
+            Telegram->wait = 1;            // The held-open poll provides the pacing
             Telegram->state++;
           }
         } else {
@@ -400,7 +448,7 @@ void TelegramLoop(void) {
             }
           }
           Telegram->message_count = 0;   // All messages have been replied - reset new messages
-          Telegram->wait = Telegram->poll;
+          Telegram->wait = 1;            // The held-open poll provides the pacing
           Telegram->state++;
         }
         break;
@@ -410,6 +458,26 @@ void TelegramLoop(void) {
         } else {
           Telegram->state = 1;
         }
+        break;
+      case 4:                              // Collect the long poll reply
+        if (telegramClient->available()) {
+          String response = TelegramReadResponse();
+          Telegram->polling = false;
+          Telegram->fails = 0;
+          TelegramParseUpdates(response);
+          Telegram->index = 0;
+          Telegram->retry = TELEGRAM_SEND_RETRY;
+          Telegram->state = 2;
+        }
+        else if (!Telegram->polling) {     // Poll was cancelled by an interleaved send - poll again
+          Telegram->state = 1;
+        }
+        else if (!telegramClient->connected() ||
+                 (millis() - Telegram->poll_start > (((uint32_t)Telegram->poll +10) * 1000))) {
+          telegramClient->stop();          // Connection lost or the reply never came
+          Telegram->polling = false;
+          TelegramPollFailed();
+        }
     }
   }
 }
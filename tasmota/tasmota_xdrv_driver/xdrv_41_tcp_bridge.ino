@@ -22,13 +22,25 @@
 #define XDRV_41                    41
 
 #ifndef TCP_BRIDGE_CONNECTIONS
+#ifdef ESP32
+#define TCP_BRIDGE_CONNECTIONS 6    // number of maximum parallel connections, e.g. concurrent Modbus-RTU masters
+#else
 #define TCP_BRIDGE_CONNECTIONS 2    // number of maximum parallel connections
 #endif
+#endif
 
 #ifndef TCP_BRIDGE_BUF_SIZE
 #define TCP_BRIDGE_BUF_SIZE    255  // size of the buffer, above 132 required for efficient XMODEM
 #endif
 
+#ifndef TCP_BRIDGE_TX_BUDGET
+#ifdef ESP32
+#define TCP_BRIDGE_TX_BUDGET   8192 // aggregate serial->TCP buffer budget in bytes, split between connections (PSRAM preferred)
+#else
+#define TCP_BRIDGE_TX_BUDGET   2048 // aggregate serial->TCP buffer budget in bytes, split between connections
+#endif
+#endif
+
 //const uint16_t tcp_port = 8880;
 WiFiServer   *server_tcp = nullptr;
 //WiFiClient   client_tcp1, client_tcp2;
@@ -39,6 +51,20 @@ bool         ip_filter_enabled = false;
 IPAddress    ip_filter;
 bool         tcp_serial = false;
 
+// Per-client state. Serial->TCP data is buffered in a per-client ring so one
+// stalled or slow client only loses its own data instead of blocking the loop
+// (and thereby all other clients) in a socket write.
+struct TCPClientState {
+  uint8_t *tx_ring = nullptr;       // serial->TCP ring, TCPRingSize bytes
+  uint16_t tx_start = 0;            // oldest unsent byte
+  uint16_t tx_len = 0;              // pending bytes
+  uint32_t rx_bytes = 0;            // TCP->serial total
+  uint32_t tx_bytes = 0;            // serial->TCP total
+  uint32_t tx_drops = 0;            // serial->TCP bytes dropped (ring overflow)
+};
+TCPClientState tcp_state[TCP_BRIDGE_CONNECTIONS];
+uint16_t     TCPRingSize = 0;       // 0 = rings unavailable, write directly
+
 #include <TasmotaSerial.h>
 TasmotaSerial *TCPSerial = nullptr;
 
@@ -50,6 +76,67 @@ void (* const TCPCommand[])(void) PROGMEM = {
   &CmndTCPStart, &CmndTCPBaudrate, &CmndTCPConfig, &CmndTCPConnect
   };
 
+void TCPClientReset(uint32_t idx) {
+  TCPClientState &state = tcp_state[idx];
+  state.tx_start = 0;
+  state.tx_len = 0;
+  state.rx_bytes = 0;
+  state.tx_bytes = 0;
+  state.tx_drops = 0;
+}
+
+// Queue serial data for one client, dropping the oldest pending bytes if the
+// ring is full. Falls back to a direct (possibly blocking) write if no ring
+// could be allocated.
+void TCPRingEnqueue(uint32_t idx, const uint8_t *data, uint32_t len) {
+  TCPClientState &state = tcp_state[idx];
+  if (!state.tx_ring) {
+    client_tcp[idx].write(data, len);
+    state.tx_bytes += len;
+    return;
+  }
+  if (len > TCPRingSize) {          // keep only the most recent bytes
+    state.tx_drops += len - TCPRingSize;
+    data += len - TCPRingSize;
+    len = TCPRingSize;
+  }
+  uint32_t free_len = TCPRingSize - state.tx_len;
+  if (free_len < len) {             // drop oldest to make room
+    uint32_t drop = len - free_len;
+    state.tx_start = (state.tx_start + drop) % TCPRingSize;
+    state.tx_len -= drop;
+    state.tx_drops += drop;
+  }
+  uint32_t pos = (state.tx_start + state.tx_len) % TCPRingSize;
+  uint32_t chunk = TCPRingSize - pos;
+  if (chunk > len) { chunk = len; }
+  memcpy(state.tx_ring + pos, data, chunk);
+  if (len > chunk) {
+    memcpy(state.tx_ring, data + chunk, len - chunk);
+  }
+  state.tx_len += len;
+}
+
+// Send as much pending data as the socket accepts without blocking
+bool TCPRingDrain(uint32_t idx, WiFiClient &client) {
+  TCPClientState &state = tcp_state[idx];
+  bool sent_any = false;
+  while (state.tx_len) {
+    int32_t can_send = client.availableForWrite();
+    if (can_send <= 0) { break; }
+    uint32_t chunk = TCPRingSize - state.tx_start;  // contiguous run
+    if (chunk > state.tx_len) { chunk = state.tx_len; }
+    if (chunk > (uint32_t)can_send) { chunk = can_send; }
+    int32_t sent = client.write(state.tx_ring + state.tx_start, chunk);
+    if (sent <= 0) { break; }
+    state.tx_start = (state.tx_start + sent) % TCPRingSize;
+    state.tx_len -= sent;
+    state.tx_bytes += sent;
+    sent_any = true;
+  }
+  return sent_any;
+}
+
 //
 // Called at event loop, checks for incoming data from the CC2530
 //
@@ -80,6 +167,7 @@ void TCPLoop(void)
       WiFiClient &client = client_tcp[i];
       if (!client) {
         client = new_client;
+        TCPClientReset(i);
         break;
       }
     }
@@ -88,6 +176,7 @@ void TCPLoop(void)
       WiFiClient &client = client_tcp[i];
       client.stop();
       client = new_client;
+      TCPClientReset(i);
     }
   }
 
@@ -108,7 +197,17 @@ void TCPLoop(void)
 
       for (uint32_t i=0; i<nitems(client_tcp); i++) {
         WiFiClient &client = client_tcp[i];
-        if (client) { client.write(tcp_buf, buf_len); }
+        if (client) { TCPRingEnqueue(i, tcp_buf, buf_len); }
+      }
+    }
+
+    // drain pending serial data to each client as far as its socket accepts
+    for (uint32_t i=0; i<nitems(client_tcp); i++) {
+      WiFiClient &client = client_tcp[i];
+      if (client && tcp_state[i].tx_len) {
+        if (TCPRingDrain(i, client)) {
+          busy = true;
+        }
       }
     }
 
@@ -126,6 +225,7 @@ void TCPLoop(void)
       if (buf_len > 0) {
         AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_TCP "to MCU/%d: %*_H"), i+1, buf_len, tcp_buf);
         TCPSerial->write(tcp_buf, buf_len);
+        tcp_state[i].rx_bytes += buf_len;
       }
     }
 
@@ -141,10 +241,24 @@ void TCPInit(void) {
       Settings->tcp_config = 0x80 | ParseSerialConfig("8N1");  // default as 8N1 for backward compatibility
     }
     tcp_buf = (uint8_t*) malloc(TCP_BRIDGE_BUF_SIZE);
-    if (!tcp_buf) { 
+    if (!tcp_buf) {
       AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_TCP "could not allocate buffer"));
       return;
     }
+    // Split the aggregate buffer budget in per-client TX rings, PSRAM preferred
+    TCPRingSize = TCP_BRIDGE_TX_BUDGET / TCP_BRIDGE_CONNECTIONS;
+    for (uint32_t i=0; i<nitems(client_tcp); i++) {
+      tcp_state[i].tx_ring = (uint8_t*) special_malloc_tag(PSTR("tcpbridge"), TCPRingSize);
+      if (!tcp_state[i].tx_ring) {
+        AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_TCP "no memory for client buffers, using direct writes"));
+        for (uint32_t j=0; j<i; j++) {
+          free(tcp_state[j].tx_ring);
+          tcp_state[j].tx_ring = nullptr;
+        }
+        TCPRingSize = 0;
+        break;
+      }
+    }
 
     if (!Settings->tcp_baudrate) { 
       Settings->tcp_baudrate = 115200 / 300;
@@ -266,6 +380,7 @@ void CmndTCPConnect(void) {
       WiFiClient &client = client_tcp[i];
       if (!client) {
         client = new_client;
+        TCPClientReset(i);
         break;
       }
     }
@@ -274,6 +389,7 @@ void CmndTCPConnect(void) {
       WiFiClient &client = client_tcp[i];
       client.stop();
       client = new_client;
+      TCPClientReset(i);
     }
   } else {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_TCP "Usage: port,ip_address"));
@@ -282,6 +398,26 @@ void CmndTCPConnect(void) {
   ResponseCmndDone();
 }
 
+/*********************************************************************************************\
+ * Presentation
+\*********************************************************************************************/
+
+void TCPShow(void) {
+  if (!server_tcp) { return; }
+  ResponseAppend_P(PSTR(",\"TCPBridge\":{"));
+  bool first = true;
+  for (uint32_t i=0; i<nitems(client_tcp); i++) {
+    WiFiClient &client = client_tcp[i];
+    if (!client) { continue; }
+    TCPClientState &state = tcp_state[i];
+    ResponseAppend_P(PSTR("%s\"Client%d\":{\"IP\":\"%s\",\"RxBytes\":%u,\"TxBytes\":%u,\"TxPending\":%u,\"TxDrops\":%u}"),
+      (first) ? "" : ",", i+1, client.remoteIP().toString().c_str(),
+      state.rx_bytes, state.tx_bytes, state.tx_len, state.tx_drops);
+    first = false;
+  }
+  ResponseJsonEnd();
+}
+
 /*********************************************************************************************\
  * Interface
 \*********************************************************************************************/
@@ -297,6 +433,9 @@ bool Xdrv41(uint32_t function)
       case FUNC_LOOP:
         TCPLoop();
         break;
+      case FUNC_JSON_APPEND:
+        TCPShow();
+        break;
       case FUNC_COMMAND:
         result = DecodeCommand(kTCPCommands, TCPCommand);
         break;
@@ -93,7 +93,10 @@ typedef struct{
     uint8_t  channels = 2;          // B08 - mono/stereo - 1 is added for both
     bool     apll = 1;              // B09 - will be ignored on unsupported SOC's
     bool     stream_enable = 0;     // B0A - enable streaming of MP3
-    uint8_t  spare[5];              // B0B-0F
+    bool     dma_autogrow = 0;      // B0B - grow DMA buffering on the next start when underruns occured
+    uint16_t dma_frame_num = 0;     // B0C-0D - DMA buffer size in samples, `0` = use IDF default (240)
+    uint8_t  dma_desc_num = 0;      // B0E - number of DMA buffers, `0` = use IDF default (6)
+    uint8_t  spare[1];              // B0F
   } tx;
   struct {
     uint32_t sample_rate = 32000;  // B00-03 - 32000 is compatible with MP3 encoding
@@ -124,7 +127,10 @@ typedef struct{
     bool     bit_order_lsb = false; // B14 - lsb first
     uint16_t dma_frame_num = 576;   // B015/16 - DMA buffer size in samples, 576 should be okay up to ~32000 bps
     uint8_t  dma_desc_num = 3;      // B17 - number of DMA buffers, maybe increased with smaller buffers
-    uint8_t  spare[3];              // B018-20 - padding
+    // voice activity detection - mic record/stream only starts encoding while someone speaks
+    uint8_t  vad_threshold = 0;     // B18 - VAD mean amplitude trigger in steps of 32 counts, `0` = VAD disabled
+    uint8_t  vad_hang = 0;          // B19 - silence time before auto-stop in 100 ms units, `0` = default (1000 ms)
+    uint8_t  vad_preroll = 0;       // B1A - pre-roll ring length in 100 ms units, `0` = default (300 ms)
   } rx;
 } tI2SSettings;
 
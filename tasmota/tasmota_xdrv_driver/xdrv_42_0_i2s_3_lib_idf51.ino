@@ -152,6 +152,8 @@ public:
 #else
   inline bool isDACMode(void) const { return false; }
 #endif
+  inline uint32_t getTxUnderruns(void) const { return _tx_underruns; }
+  inline uint32_t getTxDmaHighWater(void) const { return _tx_queued_high; }
 
   inline uint8_t getRxMode(void) const { return _rx_mode; }
   inline uint8_t getRxBitsPerSample(void) const { return 16; }      // TODO - hardcoded to 16 bits for recording
@@ -161,6 +163,7 @@ public:
   inline i2s_chan_handle_t getRxHandle(void) const { return _rx_handle; }
   inline float getRxGain(void) const { return ((float)_rx_gain) / 16; }
   inline int32_t getRxDCOffset(void) const { return _rx_dc_offset; }
+  inline uint32_t getRxOverruns(void) const { return _rx_overruns; }
   inline uint16_t getRxLowpassAlpha(void) const { return ((float)_rx_lowpass_alpha / 0x8000); }
 
   // ------------------------------------------------------------------------------------------
@@ -173,6 +176,8 @@ public:
     }
   }
   inline void setTxChannels(uint8_t channels) { _tx_channels = channels; }
+  inline void setTxDmaBuffers(uint8_t desc_num, uint16_t frame_num) { _tx_dma_desc_num = desc_num; _tx_dma_frame_num = frame_num; }  // `0` = keep IDF default
+  inline void setTxDmaAutogrow(bool autogrow) { _tx_autogrow = autogrow; }
   inline void setTxRunning(bool running) { _tx_running = running; }
   inline void setRxMode(uint8_t mode) { _rx_mode = mode; }
   inline void setRxChannels(uint8_t channels) { _rx_channels = channels; }
@@ -228,6 +233,13 @@ protected:
   bool delTxHandle(void);                 // remove handle
   bool delRxHandle(void);
 
+  void autogrowTx(void);                  // grow DMA buffering for the next start when underruns occured
+
+  // DMA event callbacks, called in ISR context
+  static bool txSentCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+  static bool txUnderrunCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+  static bool rxOverrunCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+
 protected:
 
   bool    _exclusive = false;             // in exclusive mode, stopping this instance needs to uninstall driver, and reinstall for next use
@@ -243,6 +255,13 @@ protected:
   i2s_chan_handle_t _tx_handle = nullptr; // I2S channel handle, automatically computed
   uint8_t   _tx_slot_config = I2S_SLOT_MSB;// I2S slot configuration
   uint8_t   _tx_bps = 16;                 // bits per sample, 16 or 8
+  uint16_t  _tx_dma_frame_num = 0;        // DMA buffer size in samples, `0` = use IDF default (240)
+  uint8_t   _tx_dma_desc_num = 0;         // number of DMA buffers, `0` = use IDF default (6)
+  bool      _tx_autogrow = false;         // grow DMA buffering on the next start when underruns occured
+  uint32_t  _tx_underruns = 0;            // Tx DMA queue overflows, i.e. the DMA ran dry and replayed stale samples
+  uint32_t  _tx_underruns_grown = 0;      // value of `_tx_underruns` at the last autogrow step
+  volatile uint32_t _tx_queued = 0;       // estimate of bytes currently waiting in the DMA queue
+  uint32_t  _tx_queued_high = 0;          // high-water mark of `_tx_queued`, shows how much buffering is really used
 
   // RX
   bool      _rx_configured = false;       // true = configured, false = not configured
@@ -254,6 +273,7 @@ protected:
   // uint8_t   _rx_slot_config;              // I2S slot configuration
   uint16_t  _rx_freq = 32000;             // I2S Rx sampling frequency in Hz - default 32 kHz to prevent problems with Shine Encoder
   uint8_t   _rx_bps = 16;                 // bits per sample, 16 or 8
+  uint32_t  _rx_overruns = 0;             // Rx DMA queue overflows, i.e. samples were dropped before being read
 
   uint16_t  _rx_gain = 0x10;              // Microphone gain in Q12.4 format (0x10 = 1.0)
   int16_t   _rx_dc_offset = 0x8000;       // DC offset for PCM data, or 0x8000 if not set yet
@@ -305,6 +325,46 @@ void TasmotaI2S::setPinout(int32_t bclk, int32_t ws, int32_t dout, int32_t mclk,
         _tx_configured, _rx_configured);
 }
 
+// DMA event callbacks, keep them trivial - they run in ISR context
+bool IRAM_ATTR TasmotaI2S::txSentCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx) {
+  TasmotaI2S *i2s = (TasmotaI2S *)user_ctx;
+  uint32_t queued = i2s->_tx_queued;
+  i2s->_tx_queued = (queued > event->size) ? queued - event->size : 0;
+  return false;
+}
+
+bool IRAM_ATTR TasmotaI2S::txUnderrunCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx) {
+  ((TasmotaI2S *)user_ctx)->_tx_underruns++;
+  return false;
+}
+
+bool IRAM_ATTR TasmotaI2S::rxOverrunCb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx) {
+  ((TasmotaI2S *)user_ctx)->_rx_overruns++;
+  return false;
+}
+
+// DMA buffers cannot be resized on a live channel, so when underruns occured during
+// the last run we bump the sizes and drop the handle - the next start re-creates the
+// channel with the grown buffering. Descriptor count is grown first (cheap, keeps
+// latency low), buffer length only when the descriptor count is maxed out.
+void TasmotaI2S::autogrowTx(void) {
+  if (_tx_underruns <= _tx_underruns_grown) { return; }   // no new underruns since the last step
+  _tx_underruns_grown = _tx_underruns;
+  uint16_t frame_num = _tx_dma_frame_num ? _tx_dma_frame_num : 240;   // IDF defaults
+  uint8_t desc_num = _tx_dma_desc_num ? _tx_dma_desc_num : 6;
+  if (desc_num < 12) {
+    desc_num += 2;
+  } else if (frame_num < 1020) {
+    frame_num = (frame_num * 2 > 1020) ? 1020 : frame_num * 2;   // stay below the 4092 bytes hardware limit per descriptor (16 bit stereo)
+  } else {
+    return;             // already at the ceiling
+  }
+  _tx_dma_desc_num = desc_num;
+  _tx_dma_frame_num = frame_num;
+  AddLog(LOG_LEVEL_INFO, "I2S: %u Tx underruns, growing DMA buffers to %u x %u frames", _tx_underruns, desc_num, frame_num);
+  delTxHandle();
+}
+
 bool TasmotaI2S::beginTx(void) {
   AddLog(LOG_LEVEL_DEBUG, "I2S: Calling beginTX (tx_handle:%i already_running:%i)", _tx_handle, _tx_running);
   if (_tx_running) { return true; }
@@ -354,6 +414,7 @@ bool TasmotaI2S::stopTx() {
     AddLog(LOG_LEVEL_DEBUG, "I2S: stopTx i2s_channel_disable err=0x%04X", err);
     _tx_running = false;
   }
+  if (_tx_autogrow && !isDACMode()) { autogrowTx(); }
   if (_exclusive) {    // exclusive mode, deregister channel
     if (_tx_handle) {
       if (isDACMode()) {
@@ -480,6 +541,9 @@ int32_t TasmotaI2S::consumeSamples(int16_t *samples, size_t count) {
     i2s_bytes_written = send_dac_data((uint8_t*)ms, sizeof(ms));
   } else {
     err = i2s_channel_write(_tx_handle, ms, sizeof(ms), &i2s_bytes_written, 0);
+    uint32_t queued = _tx_queued + i2s_bytes_written;   // `txSentCb` decrements concurrently, the high-water mark is a close estimate
+    _tx_queued = queued;
+    if (queued > _tx_queued_high) { _tx_queued_high = queued; }
   }
   if (err && err != ESP_ERR_TIMEOUT) {
     AddLog(LOG_LEVEL_INFO, "I2S: Could not write samples (count=%i): %i", count, err);
@@ -521,6 +585,8 @@ bool TasmotaI2S::startI2SChannel(bool tx, bool rx) {
   if (tx && !isDACMode()) {
     // default dma_desc_num = 6 (DMA buffers), dma_frame_num = 240 (frames per buffer)
     i2s_chan_config_t tx_chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(_i2s_port, I2S_ROLE_MASTER);
+    if (_tx_dma_desc_num) { tx_chan_cfg.dma_desc_num = _tx_dma_desc_num; }
+    if (_tx_dma_frame_num) { tx_chan_cfg.dma_frame_num = _tx_dma_frame_num; }
 
     AddLog(LOG_LEVEL_DEBUG, "I2S: tx_chan_cfg id:%i role:%i dma_desc_num:%i dma_frame_num:%i auto_clear:%i",
           tx_chan_cfg.id, tx_chan_cfg.role, tx_chan_cfg.dma_desc_num, tx_chan_cfg.dma_frame_num, tx_chan_cfg.auto_clear);
@@ -532,6 +598,15 @@ bool TasmotaI2S::startI2SChannel(bool tx, bool rx) {
       return false;
     }
 
+    i2s_event_callbacks_t tx_cbs = {
+      .on_recv = nullptr,
+      .on_recv_q_ovf = nullptr,
+      .on_sent = txSentCb,
+      .on_send_q_ovf = txUnderrunCb,    // the DMA ran dry, i.e. an audible underrun
+    };
+    i2s_channel_register_event_callback(_tx_handle, &tx_cbs, this);
+    _tx_queued = 0;
+
     // by default we configure for MSB 2 slots `I2S_STD_MSB_SLOT_DEFAULT_CONFIG`
     i2s_slot_mode_t tx_slot_mode = (_tx_channels == 1) ? I2S_SLOT_MODE_MONO : I2S_SLOT_MODE_STEREO;
     i2s_data_bit_width_t tx_data_bit_width = (_tx_bps == 8) ? I2S_DATA_BIT_WIDTH_8BIT : I2S_DATA_BIT_WIDTH_16BIT;
@@ -574,6 +649,14 @@ bool TasmotaI2S::startI2SChannel(bool tx, bool rx) {
       err = i2s_channel_init_std_mode(_rx_handle, &tx_std_cfg);
       AddLog(LOG_LEVEL_DEBUG, "I2S: i2s_channel_init_std_mode err:%i", err);
       AddLog(LOG_LEVEL_DEBUG, "I2S: RX channel added in full duplex mode");
+
+      i2s_event_callbacks_t rx_cbs = {
+        .on_recv = nullptr,
+        .on_recv_q_ovf = rxOverrunCb,   // the DMA filled up, i.e. samples were dropped
+        .on_sent = nullptr,
+        .on_send_q_ovf = nullptr,
+      };
+      i2s_channel_register_event_callback(_rx_handle, &rx_cbs, this);
     }
   }   // if (tx)
 
@@ -618,6 +701,14 @@ bool TasmotaI2S::startI2SChannel(bool tx, bool rx) {
 
     err = i2s_new_channel(&rx_chan_cfg, NULL, &_rx_handle);
     AddLog(LOG_LEVEL_DEBUG, "I2S: i2s_new_channel Rx err:%i", err);
+
+    i2s_event_callbacks_t rx_cbs = {
+      .on_recv = nullptr,
+      .on_recv_q_ovf = rxOverrunCb,     // the DMA filled up, i.e. samples were dropped
+      .on_sent = nullptr,
+      .on_send_q_ovf = nullptr,
+    };
+    i2s_channel_register_event_callback(_rx_handle, &rx_cbs, this);
     switch (_rx_mode){
 #if SOC_I2S_SUPPORTS_PDM_RX
       case I2S_MODE_PDM:
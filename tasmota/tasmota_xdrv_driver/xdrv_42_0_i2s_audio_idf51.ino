@@ -229,6 +229,9 @@ void CmndI2SConfig(void) {
       cfg->tx.slot_config = tx.getUInt(PSTR("SlotConfig"), cfg->tx.slot_config);
       cfg->tx.channels = tx.getUInt(PSTR("Channels"), cfg->tx.channels);
       cfg->tx.apll = tx.getUInt(PSTR("APLL"), cfg->tx.apll);
+      cfg->tx.dma_frame_num = tx.getUInt(PSTR("DMAFrame"), cfg->tx.dma_frame_num);
+      cfg->tx.dma_desc_num = tx.getUInt(PSTR("DMADesc"), cfg->tx.dma_desc_num);
+      cfg->tx.dma_autogrow = tx.getUInt(PSTR("DMAAutogrow"), cfg->tx.dma_autogrow);
     }
 
     JsonParserToken rx_tk = root["Rx"];
@@ -254,6 +257,9 @@ void CmndI2SConfig(void) {
       cfg->rx.bit_order_lsb = rx.getUInt(PSTR("LsbOrder"), cfg->rx.bit_order_lsb);
       cfg->rx.dma_frame_num = rx.getUInt(PSTR("DMAFrame"), cfg->rx.dma_frame_num);
       cfg->rx.dma_desc_num = rx.getUInt(PSTR("DMADesc"), cfg->rx.dma_desc_num);
+      cfg->rx.vad_threshold = rx.getUInt(PSTR("VADThreshold"), cfg->rx.vad_threshold);
+      cfg->rx.vad_hang = rx.getUInt(PSTR("VADHang"), cfg->rx.vad_hang);
+      cfg->rx.vad_preroll = rx.getUInt(PSTR("VADPreroll"), cfg->rx.vad_preroll);
     }
     I2SSettingsSave(AUDIO_CONFIG_FILENAME);
   }
@@ -282,7 +288,10 @@ void CmndI2SConfig(void) {
                     "\"SlotMask\":%d,"
                     "\"SlotConfig\":%d,"
                     "\"Channels\":%d,"
-                    "\"APLL\":%d"
+                    "\"APLL\":%d,"
+                    "\"DMAFrame\":%d,"
+                    "\"DMADesc\":%d,"
+                    "\"DMAAutogrow\":%d"
                   "},"
                   "\"Rx\":{"
                     "\"SampleRate\":%d,"
@@ -302,7 +311,16 @@ void CmndI2SConfig(void) {
                     "\"BigEndian\":%d,"
                     "\"LsbOrder\":%d,"
                     "\"DMAFrame\":%d,"
-                    "\"DMADesc\":%d"
+                    "\"DMADesc\":%d,"
+                    "\"VADThreshold\":%d,"
+                    "\"VADHang\":%d,"
+                    "\"VADPreroll\":%d"
+                  "},"
+                  // live DMA queue statistics since restart, not saved
+                  "\"Stats\":{"
+                    "\"TxUnderruns\":%u,"
+                    "\"TxHighWater\":%u,"
+                    "\"RxOverruns\":%u"
                   "}}}",
                   cfg->sys.version,
                   cfg->sys.duplex,
@@ -324,6 +342,9 @@ void CmndI2SConfig(void) {
                   cfg->tx.slot_config,
                   cfg->tx.channels,
                   cfg->tx.apll,
+                  cfg->tx.dma_frame_num,
+                  cfg->tx.dma_desc_num,
+                  cfg->tx.dma_autogrow,
                   //
                   cfg->rx.sample_rate,
                   &mic_gain,
@@ -342,7 +363,14 @@ void CmndI2SConfig(void) {
                   cfg->rx.big_endian,
                   cfg->rx.bit_order_lsb,
                   cfg->rx.dma_frame_num,
-                  cfg->rx.dma_desc_num
+                  cfg->rx.dma_desc_num,
+                  cfg->rx.vad_threshold,
+                  cfg->rx.vad_hang,
+                  cfg->rx.vad_preroll,
+                  //
+                  audio_i2s.out ? audio_i2s.out->getTxUnderruns() : 0,
+                  audio_i2s.out ? audio_i2s.out->getTxDmaHighWater() : 0,
+                  audio_i2s.in ? audio_i2s.in->getRxOverruns() : 0
                   );
 }
 
@@ -556,6 +584,8 @@ void I2sInit(void) {
                       audio_i2s.Settings->tx.slot_mask, audio_i2s.Settings->rx.slot_mask);
     if (tx) {
       i2s->setTxMode(audio_i2s.Settings->tx.mode);
+      i2s->setTxDmaBuffers(audio_i2s.Settings->tx.dma_desc_num, audio_i2s.Settings->tx.dma_frame_num);
+      i2s->setTxDmaAutogrow(audio_i2s.Settings->tx.dma_autogrow);
       // i2s->setTxChannels(audio_i2s.Settings->tx.channels);
       // i2s->setRate(audio_i2s.Settings->tx.sample_rate);
     }
@@ -607,7 +637,7 @@ void I2sInit(void) {
   if (audio_i2s.Settings->sys.mp3_preallocate == 1){
     // if (UsePSRAM()) {
     AddLog(LOG_LEVEL_DEBUG,PSTR("I2S: will allocate buffer for mp3 encoder"));
-    audio_i2s_mp3.preallocateCodec = special_malloc(preallocateCodecSize);
+    audio_i2s_mp3.preallocateCodec = special_malloc_tag(PSTR("audio"), preallocateCodecSize);
   }
 #endif // USE_I2S_MP3
   AddLog(LOG_LEVEL_DEBUG, "I2S: I2sInit done");
@@ -241,6 +241,39 @@ class AudioEncoderOpusWebm : public AudioEncoder
 };
 #endif // USE_I2S_OPUS
 
+/*********************************************************************************************\
+ * Voice activity detection over the DMA frames
+ *
+ * With `rx.vad_threshold` set the mic task starts in a listening state where frames are
+ * only classified (short-term energy plus zero-crossing rate) and kept in a small pre-roll
+ * ring - the encoder and the network/file writes stay idle. Once some consecutive frames
+ * are voiced the ring is replayed into the encoder so the utterance start isn't clipped
+ * and encoding runs as usual. After `rx.vad_hang` of silence a stream drops back to
+ * listening while a recording is finalized.
+\*********************************************************************************************/
+
+#define I2S_VAD_ZCR_MIN          10    // Zero crossings per 1024 samples - below is hum/DC wander
+#define I2S_VAD_ZCR_MAX          400   // Zero crossings per 1024 samples - above is broadband hiss
+#define I2S_VAD_TRIGGER_FRAMES   2     // Consecutive voiced frames needed to start the encoder
+#define I2S_VAD_PREROLL_MAX      16    // Pre-roll ring size limit in frames
+
+// Classify one frame of samples as voiced
+bool I2sVadVoiced(const int16_t *samples, uint32_t count, uint32_t threshold) {
+  if (0 == count) { return false; }
+  uint32_t energy = 0;
+  uint32_t crossings = 0;
+  int32_t last = samples[0];
+  for (uint32_t i = 0; i < count; i++) {
+    int32_t sample = samples[i];
+    energy += (sample < 0) ? -sample : sample;
+    if ((sample ^ last) < 0) { crossings++; }
+    last = sample;
+  }
+  energy /= count;                               // mean absolute amplitude
+  uint32_t zcr = (crossings * 1024) / count;
+  return (energy > threshold) && (zcr >= I2S_VAD_ZCR_MIN) && (zcr <= I2S_VAD_ZCR_MAX);
+}
+
 // micro to mp3/webm - file or stream
 void I2sMicTask(void *arg){
   int8_t error = 0;
@@ -257,6 +290,16 @@ void I2sMicTask(void *arg){
   uint32_t __enctime;
   TickType_t xLastWakeTime;
 
+  uint32_t vad_threshold = audio_i2s.Settings->rx.vad_threshold * 32;
+  uint8_t *vad_ring = nullptr;
+  uint32_t vad_ring_frames = 0;
+  uint32_t vad_ring_head = 0;
+  uint32_t vad_ring_filled = 0;
+  uint32_t vad_voiced_cnt = 0;
+  uint32_t vad_silence_cnt = 0;
+  uint32_t vad_hang_frames = 0;
+  bool vad_active = (0 == vad_threshold);        // No VAD - encode from the first frame on
+
   if (!audio_i2s_mp3.use_stream) {
     rec_file = ufsp->open(audio_i2s_mp3.mic_path, "w");
     if (!rec_file) {
@@ -303,6 +346,24 @@ void I2sMicTask(void *arg){
   timeForOneRead = 1000 / ((audio_i2s.Settings->rx.sample_rate / (mic_enc->samplesPerPass * audio_i2s.Settings->rx.channels )));
   // timeForOneRead -= 1; // be very in time
   AddLog(LOG_LEVEL_DEBUG, PSTR("I2S: samples %u, bytesize %u, time: %u"),mic_enc->samplesPerPass, mic_enc->byteSize, timeForOneRead);
+
+  if (!vad_active) {
+    uint32_t hang = audio_i2s.Settings->rx.vad_hang;
+    vad_hang_frames = (((hang) ? hang : 10) * 100) / timeForOneRead;
+    if (vad_hang_frames < 1) { vad_hang_frames = 1; }
+    uint32_t preroll = audio_i2s.Settings->rx.vad_preroll;
+    vad_ring_frames = (((preroll) ? preroll : 3) * 100) / timeForOneRead;
+    if (vad_ring_frames < 1) { vad_ring_frames = 1; }
+    if (vad_ring_frames > I2S_VAD_PREROLL_MAX) { vad_ring_frames = I2S_VAD_PREROLL_MAX; }
+    vad_ring = (uint8_t*)malloc(vad_ring_frames * mic_enc->byteSize);
+    if (!vad_ring) {
+      AddLog(LOG_LEVEL_INFO, PSTR("I2S: no memory for VAD pre-roll - VAD disabled"));
+      vad_active = true;
+    } else {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("I2S: VAD armed, threshold %u, hang %u frames, pre-roll %u frames"), vad_threshold, vad_hang_frames, vad_ring_frames);
+    }
+  }
+
   xLastWakeTime = xTaskGetTickCount();
 
   while (!audio_i2s_mp3.mic_stop) {
@@ -319,8 +380,46 @@ void I2sMicTask(void *arg){
     }
 
     __enctime = millis();
+    written = 0;
     if(bytes_read != 0){
-      written = mic_enc->encode(bytes_read >> 1); //transmit samples, written is an error code
+      if (!vad_active) {
+        // Listening - keep the pre-roll ring current and watch for voice, encoder stays idle
+        memcpy(vad_ring + (vad_ring_head * mic_enc->byteSize), mic_enc->inBuffer, mic_enc->byteSize);
+        vad_ring_head = (vad_ring_head + 1) % vad_ring_frames;
+        if (vad_ring_filled < vad_ring_frames) { vad_ring_filled++; }
+        if (I2sVadVoiced(mic_enc->inBuffer, bytes_read >> 1, vad_threshold)) {
+          vad_voiced_cnt++;
+          if (vad_voiced_cnt >= I2S_VAD_TRIGGER_FRAMES) {
+            // Utterance start - replay the pre-roll ring so the first syllable isn't clipped
+            vad_active = true;
+            vad_silence_cnt = 0;
+            uint32_t idx = (vad_ring_head + vad_ring_frames - vad_ring_filled) % vad_ring_frames;
+            for (uint32_t i = 0; (i < vad_ring_filled) && (written >= 0); i++) {
+              memcpy(mic_enc->inBuffer, vad_ring + (idx * mic_enc->byteSize), mic_enc->byteSize);
+              written = mic_enc->encode(mic_enc->byteSize >> 1);
+              idx = (idx + 1) % vad_ring_frames;
+            }
+            vad_ring_head = 0;
+            vad_ring_filled = 0;
+          }
+        } else {
+          vad_voiced_cnt = 0;
+        }
+      } else {
+        written = mic_enc->encode(bytes_read >> 1); //transmit samples, written is an error code
+        if (vad_ring) {                            // Silence auto-stop armed
+          if (I2sVadVoiced(mic_enc->inBuffer, bytes_read >> 1, vad_threshold)) {
+            vad_silence_cnt = 0;
+          } else if (++vad_silence_cnt >= vad_hang_frames) {
+            if (audio_i2s_mp3.use_stream) {
+              vad_active = false;                  // Back to listening, the stream stays open
+              vad_voiced_cnt = 0;
+            } else {
+              break;                               // Recording - finalize the file
+            }
+          }
+        }
+      }
     }
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("_mic: %u , %i, %i"), millis() - __enctime, written, bytes_read);
     if(written < 0){
@@ -347,6 +446,7 @@ void I2sMicTask(void *arg){
 
 exit:
   delete mic_enc;
+  if (vad_ring) { free(vad_ring); }
   audio_i2s_mp3.use_stream = false;
   audio_i2s.in->stopRx();
   audio_i2s_mp3.mic_stop = 0;
@@ -25,6 +25,128 @@ struct AUDIO_I2S_WEBRADIO_t {
   char wr_title[64];
 } Audio_webradio;
 
+/*********************************************************************************************\
+ * Jitter buffer between the ICY stream and the decoder
+ *
+ * AudioFileSourceBuffer only smooths out single packets, so every longer WiFi hiccup
+ * (e.g. AP roaming) starves the decoder. This ring holds several seconds of compressed
+ * audio in PSRAM, blocks until the prebuffer threshold is reached before the first
+ * sample is served, and after an underrun pauses again until the refill watermark is
+ * reached instead of limping along at an empty buffer.
+\*********************************************************************************************/
+
+#ifndef I2S_WEBRADIO_JITTER_BUFFER
+#define I2S_WEBRADIO_JITTER_BUFFER (64*1024)   // ring size with PSRAM, ~4 seconds of 128 kbit/s MP3
+#endif
+#ifndef I2S_WEBRADIO_PREBUFFER_TIMEOUT
+#define I2S_WEBRADIO_PREBUFFER_TIMEOUT 5000    // max milliseconds to wait for the prebuffer/refill threshold
+#endif
+
+class AudioFileSourceJitterBuffer : public AudioFileSource
+{
+public:
+  AudioFileSourceJitterBuffer(AudioFileSource *source, void *inBuff, uint32_t buffSizeBytes) {
+    src = source;
+    buffer = (uint8_t *)inBuff;
+    buffSize = buffSizeBytes;
+    readPtr = 0;
+    writePtr = 0;
+    length = 0;
+    refill_level = buffSize / 4;        // after an underrun wait for a quarter ring
+    fill_target = buffSize / 2;         // before playback starts wait for half a ring
+  }
+
+  virtual uint32_t read(void *data, uint32_t len) override {
+    if (!buffer) { return src->read(data, len); }   // no ring, plain pass-through
+
+    if (fill_target) {    // prebuffer - runs in the decoder task, so blocking here is fine
+      cb.st(STATUS_FILLING, PSTR("Prebuffering"));
+      uint32_t start = millis();
+      while ((length < fill_target) && (millis() - start < I2S_WEBRADIO_PREBUFFER_TIMEOUT)) {
+        if (!fill()) { break; }         // source is gone, play out what we have
+        if (length < fill_target) { delay(1); }
+      }
+      fill_target = 0;
+    }
+
+    uint8_t *ptr = (uint8_t *)data;
+    uint32_t bytes = 0;
+    uint32_t from_ring = (len < length) ? len : length;
+    while (from_ring) {                 // up to two segments when wrapping around
+      uint32_t seg = buffSize - readPtr;
+      if (seg > from_ring) { seg = from_ring; }
+      memcpy(ptr, &buffer[readPtr], seg);
+      readPtr = (readPtr + seg) % buffSize;
+      length -= seg;
+      ptr += seg;
+      bytes += seg;
+      len -= seg;
+      from_ring -= seg;
+    }
+    if (len) {                          // ran dry, pause until the refill watermark before serving more
+      bytes += src->read(ptr, len);
+      if (src->isOpen()) {
+        fill_target = refill_level;
+        cb.st(STATUS_UNDERFLOW, PSTR("Buffer underflow"));
+      }
+    }
+    fill();
+    return bytes;
+  }
+
+  virtual bool seek(int32_t pos, int dir) override {
+    if ((dir == SEEK_CUR) && (pos >= 0) && ((uint32_t)pos <= length)) {
+      readPtr = (readPtr + pos) % buffSize;
+      length -= pos;
+      return true;
+    }
+    readPtr = 0;      // invalidate the ring
+    writePtr = 0;
+    length = 0;
+    return src->seek(pos, dir);
+  }
+
+  virtual bool close() override { return src->close(); }
+  virtual bool isOpen() override { return src->isOpen(); }
+  virtual uint32_t getSize() override { return src->getSize(); }
+  virtual uint32_t getPos() override { return src->getPos(); }
+  uint32_t getFillLevel(void) const { return length; }
+
+  virtual bool loop() override {
+    if (!src->loop()) { return false; }
+    fill();
+    return true;
+  }
+
+  enum { STATUS_FILLING=2, STATUS_UNDERFLOW };    // same codes as AudioFileSourceBuffer
+
+private:
+  // move whatever the socket has into the ring without blocking
+  // returns false when the source is closed
+  bool fill(void) {
+    while (length < buffSize) {
+      uint32_t seg = buffSize - writePtr;
+      uint32_t space = buffSize - length;
+      if (seg > space) { seg = space; }
+      int cnt = src->readNonBlock(&buffer[writePtr], seg);
+      if (cnt <= 0) { break; }
+      writePtr = (writePtr + cnt) % buffSize;
+      length += cnt;
+      if ((uint32_t)cnt < seg) { break; }
+    }
+    return src->isOpen();
+  }
+
+  AudioFileSource *src;
+  uint8_t *buffer;
+  uint32_t buffSize;
+  uint32_t readPtr;
+  uint32_t writePtr;
+  uint32_t length;
+  uint32_t refill_level;
+  uint32_t fill_target;     // bytes to buffer before serving data, `0` = streaming normally
+};
+
 void I2sMDCallback(void *cbData, const char *type, bool isUnicode, const char *str) {
   const char *ptr = reinterpret_cast<const char *>(cbData);
   (void) isUnicode; // Punt this ball for now
@@ -51,10 +173,10 @@ bool I2SWebradio(const char *url, uint32_t decoder_type) {
 
   // allocate buffers if not already done
   if (audio_i2s_mp3.preallocateBuffer == NULL) {
-    audio_i2s_mp3.preallocateBuffer = special_malloc(preallocateBufferSize);
+    audio_i2s_mp3.preallocateBuffer = special_malloc_tag(PSTR("audio"), preallocateBufferSize);
   }
   if (audio_i2s_mp3.preallocateCodec == NULL) {
-    audio_i2s_mp3.preallocateCodec = special_malloc(preallocateCodecSize);
+    audio_i2s_mp3.preallocateCodec = special_malloc_tag(PSTR("audio"), preallocateCodecSize);
   }
   // check if we have buffers
   if (audio_i2s_mp3.preallocateBuffer == NULL || audio_i2s_mp3.preallocateCodec == NULL) {
@@ -79,7 +201,17 @@ bool I2SWebradio(const char *url, uint32_t decoder_type) {
   AddLog(LOG_LEVEL_INFO, "I2S: did connect to %s",url);
 
   I2SAudioPower(true);
-  audio_i2s_mp3.buff = new AudioFileSourceBuffer(Audio_webradio.ifile, audio_i2s_mp3.preallocateBuffer, preallocateBufferSize);
+  {
+    uint32_t jbuf_size = preallocateBufferSize;
+    if (UsePSRAM()) {   // grow the preallocated buffer to a few seconds of compressed audio
+      void *jbuf = special_realloc(audio_i2s_mp3.preallocateBuffer, I2S_WEBRADIO_JITTER_BUFFER);
+      if (jbuf) {
+        audio_i2s_mp3.preallocateBuffer = jbuf;
+        jbuf_size = I2S_WEBRADIO_JITTER_BUFFER;
+      }
+    }
+    audio_i2s_mp3.buff = new AudioFileSourceJitterBuffer(Audio_webradio.ifile, audio_i2s_mp3.preallocateBuffer, jbuf_size);
+  }
   if(audio_i2s_mp3.buff == nullptr){
     goto i2swr_fail;
   }
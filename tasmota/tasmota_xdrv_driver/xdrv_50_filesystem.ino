@@ -373,6 +373,78 @@ uint8_t UfsReject(char *name) {
   return 0;
 }
 
+/*********************************************************************************************\
+ * Tfs stat cache
+ *
+ * Drivers probe the same settings and script paths over and over (exists -> size -> load)
+ * and every probe costs a directory walk on LittleFS. Remember the last few results keyed
+ * by path hash. Writes through the Tfs layer update or drop their entry at once; entries
+ * also expire after TFS_STAT_CACHE_TTL ms so files touched outside the Tfs layer (Berry,
+ * direct ffsp writers) are picked up soon after.
+\*********************************************************************************************/
+
+#ifndef TFS_STAT_CACHE_SIZE
+#define TFS_STAT_CACHE_SIZE    8           // Number of cached stat results (13 bytes each)
+#endif
+#ifndef TFS_STAT_CACHE_TTL
+#define TFS_STAT_CACHE_TTL     5000        // Entry lifetime in ms bounding staleness from writers bypassing Tfs
+#endif
+
+const uint32_t TFS_STAT_SIZE_UNKNOWN = 0xFFFFFFFF;  // Existence known but size not (yet) determined
+
+struct {
+  uint32_t hash;                           // Path hash, 0 = unused slot
+  uint32_t fsize;                          // File size or TFS_STAT_SIZE_UNKNOWN
+  uint32_t cached_at;                      // millis() of store for TTL expiry
+  bool exists;
+} TfsStatCache[TFS_STAT_CACHE_SIZE];
+uint32_t tfs_stat_cache_slot = 0;          // Round robin replacement index
+
+uint32_t TfsStatCacheHash(const char *fname) {
+  uint32_t hash = GetHash(fname, strlen(fname));
+  return (hash) ? hash : 1;                // Reserve 0 for unused slots
+}
+
+int32_t TfsStatCacheFind(uint32_t hash) {
+  for (uint32_t i = 0; i < TFS_STAT_CACHE_SIZE; i++) {
+    if (TfsStatCache[i].hash == hash) {
+      if (TimePassedSince(TfsStatCache[i].cached_at) > TFS_STAT_CACHE_TTL) {
+        TfsStatCache[i].hash = 0;          // Expired
+        return -1;
+      }
+      return i;
+    }
+  }
+  return -1;
+}
+
+void TfsStatCacheStore(const char *fname, bool exists, uint32_t fsize) {
+  uint32_t hash = TfsStatCacheHash(fname);
+  int32_t idx = TfsStatCacheFind(hash);
+  if (idx < 0) {
+    idx = tfs_stat_cache_slot;
+    tfs_stat_cache_slot = (tfs_stat_cache_slot +1) % TFS_STAT_CACHE_SIZE;
+    TfsStatCache[idx].hash = hash;
+  }
+  TfsStatCache[idx].exists = exists;
+  TfsStatCache[idx].fsize = fsize;
+  TfsStatCache[idx].cached_at = millis();
+}
+
+void TfsStatCacheInvalidate(const char *fname) {
+  uint32_t hash = TfsStatCacheHash(fname);
+  for (uint32_t i = 0; i < TFS_STAT_CACHE_SIZE; i++) {
+    if (TfsStatCache[i].hash == hash) { TfsStatCache[i].hash = 0; }
+  }
+}
+
+void TfsStatCacheFlush(void) {
+  // Call after web uploads, deletes or renames which may have changed any file behind our back
+  for (uint32_t i = 0; i < TFS_STAT_CACHE_SIZE; i++) {
+    TfsStatCache[i].hash = 0;
+  }
+}
+
 /*********************************************************************************************\
  * Tfs low level functions
 \*********************************************************************************************/
@@ -380,7 +452,10 @@ uint8_t UfsReject(char *name) {
 bool TfsFileExists(const char *fname){
   if (!ffs_type) { return false; }
 
+  int32_t idx = TfsStatCacheFind(TfsStatCacheHash(fname));
+  if (idx >= 0) { return TfsStatCache[idx].exists; }
   bool yes = ffsp->exists(fname);
+  TfsStatCacheStore(fname, yes, TFS_STAT_SIZE_UNKNOWN);
   if (!yes) {
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TFS: File '%s' not found"), fname +1);  // Skip leading slash
   }
@@ -390,10 +465,19 @@ bool TfsFileExists(const char *fname){
 size_t TfsFileSize(const char *fname){
   if (!ffs_type) { return 0; }
 
+  int32_t idx = TfsStatCacheFind(TfsStatCacheHash(fname));
+  if (idx >= 0) {
+    if (!TfsStatCache[idx].exists) { return 0; }
+    if (TfsStatCache[idx].fsize != TFS_STAT_SIZE_UNKNOWN) { return TfsStatCache[idx].fsize; }
+  }
   File file = ffsp->open(fname, "r");
-  if (!file) { return 0; }
+  if (!file) {
+    TfsStatCacheStore(fname, false, 0);
+    return 0;
+  }
   size_t flen = file.size();
   file.close();
+  TfsStatCacheStore(fname, true, flen);
   return flen;
 }
 
@@ -432,6 +516,11 @@ bool TfsSaveFile(const char *fname, const uint8_t *buf, uint32_t len) {
 #ifdef USE_WEBCAM
   WcInterrupt(1);
 #endif
+  if (result) {
+    TfsStatCacheStore(fname, true, len);
+  } else {
+    TfsStatCacheInvalidate(fname);
+  }
   return result;
 }
 
@@ -441,6 +530,7 @@ bool TfsInitFile(const char *fname, uint32_t len, uint8_t init_value) {
   File file = ffsp->open(fname, "w");
   if (!file) {
     AddLog(LOG_LEVEL_INFO, PSTR("TFS: Erase failed"));
+    TfsStatCacheInvalidate(fname);
     return false;
   }
 
@@ -448,19 +538,27 @@ bool TfsInitFile(const char *fname, uint32_t len, uint8_t init_value) {
     file.write(&init_value, 1);
   }
   file.close();
+  TfsStatCacheStore(fname, true, len);
   return true;
 }
 
 bool TfsLoadFile(const char *fname, uint8_t *buf, uint32_t len) {
   if (!ffs_type) { return false; }
 
+  int32_t idx = TfsStatCacheFind(TfsStatCacheHash(fname));
+  if ((idx >= 0) && !TfsStatCache[idx].exists) {  // Skip the open for known absent files
+    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TFS: File '%s' not found"), fname +1);  // Skip leading slash
+    return false;
+  }
   File file = ffsp->open(fname, "r");
   if (!file) {
+    TfsStatCacheStore(fname, false, 0);
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("TFS: File '%s' not found"), fname +1);  // Skip leading slash
     return false;
   }
 
   size_t flen = file.size();
+  TfsStatCacheStore(fname, true, flen);
   if (len > flen) { len = flen; }           // Adjust requested length to smaller file length
   file.read(buf, len);
   file.close();
@@ -479,24 +577,135 @@ bool TfsDeleteFile(const char *fname) {
 
   if (!ffsp->remove(fname)) {
     AddLog(LOG_LEVEL_INFO, PSTR("TFS: Delete failed"));
+    TfsStatCacheInvalidate(fname);
     return false;
   }
+  TfsStatCacheStore(fname, false, 0);
   return true;
 }
 
 bool TfsRenameFile(const char *fname1, const char *fname2) {
   if (!ffs_type) { return false; }
 
+  TfsStatCacheInvalidate(fname2);
   if (!ffsp->rename(fname1, fname2)) {
     AddLog(LOG_LEVEL_INFO, PSTR("TFS: Rename failed"));
+    TfsStatCacheInvalidate(fname1);
+    return false;
+  }
+  TfsStatCacheStore(fname1, false, 0);
+  return true;
+}
+
+/*********************************************************************************************\
+ * Tfs buffered write streams
+ *
+ * Appending small records one at a time makes LittleFS rewrite the tail block on every
+ * call, wearing flash and stalling the caller. A write stream collects appends in a RAM
+ * (or PSRAM) block and writes them out in one go when the block fills, at latest every
+ * TFS_STREAM_FLUSH_SECS seconds, and always before restart.
+ *
+ * handle = TfsStreamOpen("/sensor.log");  // Returns -1 when no slot or no memory
+ * TfsStreamWrite(handle, data, len);      // Buffered append
+ * TfsStreamClose(handle);                 // Final flush and release of the slot
+\*********************************************************************************************/
+
+#ifndef TFS_STREAM_COUNT
+#define TFS_STREAM_COUNT       2           // Concurrent buffered write streams
+#endif
+#ifndef TFS_STREAM_BUFFER_SIZE
+#define TFS_STREAM_BUFFER_SIZE 1024        // Bytes collected before writing out a block
+#endif
+#ifndef TFS_STREAM_FLUSH_SECS
+#define TFS_STREAM_FLUSH_SECS  10          // Maximum seconds appends may sit in RAM
+#endif
+
+struct {
+  char fname[48];                          // Empty = unused slot (sized as UFS_FILENAME_SIZE)
+  uint8_t *buffer;
+  uint32_t len;
+  uint32_t last_flush;                     // Uptime of last write out
+} TfsStream[TFS_STREAM_COUNT];
+
+int32_t TfsStreamOpen(const char *fname) {
+  if (!ffs_type) { return -1; }
+  for (uint32_t i = 0; i < TFS_STREAM_COUNT; i++) {
+    if (TfsStream[i].fname[0] && !strcmp(TfsStream[i].fname, fname)) { return i; }  // Already open
+  }
+  for (uint32_t i = 0; i < TFS_STREAM_COUNT; i++) {
+    if (!TfsStream[i].fname[0]) {
+      TfsStream[i].buffer = (uint8_t*)special_malloc_tag(PSTR("ufs"), TFS_STREAM_BUFFER_SIZE);
+      if (TfsStream[i].buffer == nullptr) { return -1; }
+      strlcpy(TfsStream[i].fname, fname, sizeof(TfsStream[i].fname));
+      TfsStream[i].len = 0;
+      TfsStream[i].last_flush = TasmotaGlobal.uptime;
+      return i;
+    }
+  }
+  return -1;                               // All slots in use
+}
+
+bool TfsStreamFlush(int32_t handle) {
+  if ((handle < 0) || (handle >= TFS_STREAM_COUNT) || !TfsStream[handle].fname[0]) { return false; }
+  TfsStream[handle].last_flush = TasmotaGlobal.uptime;
+  if (!TfsStream[handle].len) { return true; }
+  File file = ffsp->open(TfsStream[handle].fname, "a");
+  if (!file) {
+    AddLog(LOG_LEVEL_INFO, PSTR("TFS: Stream flush failed"));
     return false;
   }
+  file.write(TfsStream[handle].buffer, TfsStream[handle].len);
+  file.close();
+  TfsStream[handle].len = 0;
+  TfsStatCacheInvalidate(TfsStream[handle].fname);
+  return true;
+}
+
+bool TfsStreamWrite(int32_t handle, const uint8_t *buf, uint32_t len) {
+  if ((handle < 0) || (handle >= TFS_STREAM_COUNT) || !TfsStream[handle].fname[0]) { return false; }
+  if (TfsStream[handle].len + len > TFS_STREAM_BUFFER_SIZE) {
+    if (!TfsStreamFlush(handle)) { return false; }
+  }
+  if (len > TFS_STREAM_BUFFER_SIZE) {      // Oversized record goes straight to the file
+    File file = ffsp->open(TfsStream[handle].fname, "a");
+    if (!file) { return false; }
+    file.write(buf, len);
+    file.close();
+    TfsStatCacheInvalidate(TfsStream[handle].fname);
+    return true;
+  }
+  memcpy(TfsStream[handle].buffer + TfsStream[handle].len, buf, len);
+  TfsStream[handle].len += len;
   return true;
 }
 
+void TfsStreamClose(int32_t handle) {
+  if ((handle < 0) || (handle >= TFS_STREAM_COUNT) || !TfsStream[handle].fname[0]) { return; }
+  TfsStreamFlush(handle);
+  free(TfsStream[handle].buffer);
+  TfsStream[handle].buffer = nullptr;
+  TfsStream[handle].fname[0] = '\0';
+}
+
+void TfsStreamEverySecond(void) {
+  for (uint32_t i = 0; i < TFS_STREAM_COUNT; i++) {
+    if (TfsStream[i].fname[0] && TfsStream[i].len &&
+        (TasmotaGlobal.uptime - TfsStream[i].last_flush >= TFS_STREAM_FLUSH_SECS)) {
+      TfsStreamFlush(i);
+    }
+  }
+}
+
+void TfsStreamFlushAll(void) {
+  // Crash safe sync before restart or settings save
+  for (uint32_t i = 0; i < TFS_STREAM_COUNT; i++) {
+    if (TfsStream[i].fname[0]) { TfsStreamFlush(i); }
+  }
+}
+
 /*********************************************************************************************\
  * Log file
- * 
+ *
  * Enable with command `FileLog 1..4` or `FileLog 11..14`
  * Rotate max 16 x FILE_LOG_SIZE kB log files /log01 -> /log02 ... /log16 -> /log01 ...
  * Filesystem needs to be larger than 10k (FILE_LOG_FREE)
@@ -781,17 +990,21 @@ bool _UfsJsonSettingsUpdate(const char* data) {
   }
   ofile.close();
 
-  if (index > sizeof(buffer) -2) { 
+  if (index > sizeof(buffer) -2) {
     // No changes
     ffsp->remove(bfname);
+    TfsStatCacheInvalidate(bfname);
     return false;                      // Error - Key name too long
   }
   ffsp->remove(filename);
   ffsp->rename(bfname, filename);
+  TfsStatCacheInvalidate(filename);    // Bypassed the Tfs layer above
+  TfsStatCacheInvalidate(bfname);
   if (!append) {
     // Delete data
     if (!entries) {
       ffsp->remove(filename);
+      TfsStatCacheInvalidate(filename);
     }
     return deleted;                    // State - 0 = Not found, 1 = Deleted
   }
@@ -912,7 +1125,7 @@ char* UfsFilename(char* fname, char* fname_in) {
 }
 
 const char kUFSCommands[] PROGMEM = "Ufs|"  // Prefix
-  "|Type|Size|Free|Delete|Rename|Run"
+  "|Type|Size|Free|Delete|Rename|Run|Bench"
 #ifdef UFILESYS_STATIC_SERVING
   "|Serve"
 #endif
@@ -922,7 +1135,7 @@ const char kUFSCommands[] PROGMEM = "Ufs|"  // Prefix
   ;
 
 void (* const kUFSCommand[])(void) PROGMEM = {
-  &UFSInfo, &UFSType, &UFSSize, &UFSFree, &UFSDelete, &UFSRename, &UFSRun
+  &UFSInfo, &UFSType, &UFSSize, &UFSFree, &UFSDelete, &UFSRename, &UFSRun, &UFSBench
 #ifdef UFILESYS_STATIC_SERVING
   ,&UFSServe
 #endif
@@ -978,6 +1191,10 @@ void UFSDelete(void) {
     if (!result) {
       ResponseCmndFailed();
     } else {
+      TfsStatCacheFlush();             // May have deleted on ffsp via ufsp
+#ifdef UFILESYS_STATIC_SERVING
+      UfsStatCacheFlush();
+#endif  // UFILESYS_STATIC_SERVING
       ResponseCmndDone();
     }
   }
@@ -1004,6 +1221,10 @@ void UFSRename(void) {
     if (!result) {
       ResponseCmndFailed();
     } else {
+      TfsStatCacheFlush();             // May have renamed on ffsp via ufsp
+#ifdef UFILESYS_STATIC_SERVING
+      UfsStatCacheFlush();
+#endif  // UFILESYS_STATIC_SERVING
       ResponseCmndDone();
     }
   }
@@ -1027,6 +1248,52 @@ void UFSRename(void) {
 
 //#define SERVING_DEBUG
 
+#ifndef UFS_STAT_CACHE_SIZE
+#define UFS_STAT_CACHE_SIZE 4              // Hot files whose size/mtime are cached to skip repeated open/stat
+#endif
+
+// Small LRU of file stats so repeatedly fetched files (icons, descriptors) can be
+// revalidated with a 304 without touching the filesystem at all.
+struct {
+  String path;
+  uint32_t size;
+  uint32_t mtime;
+  uint32_t last_used;
+} UfsStatCache[UFS_STAT_CACHE_SIZE];
+
+bool UfsStatCacheGet(const String& path, uint32_t* size, uint32_t* mtime) {
+  for (uint32_t i = 0; i < UFS_STAT_CACHE_SIZE; i++) {
+    if (UfsStatCache[i].path == path) {
+      *size = UfsStatCache[i].size;
+      *mtime = UfsStatCache[i].mtime;
+      UfsStatCache[i].last_used = millis();
+      return true;
+    }
+  }
+  return false;
+}
+
+void UfsStatCachePut(const String& path, uint32_t size, uint32_t mtime) {
+  uint32_t oldest = 0;
+  for (uint32_t i = 0; i < UFS_STAT_CACHE_SIZE; i++) {
+    if (UfsStatCache[i].path == path) { oldest = i; break; }
+    if (TimePassedSince(UfsStatCache[i].last_used) > TimePassedSince(UfsStatCache[oldest].last_used)) {
+      oldest = i;
+    }
+  }
+  UfsStatCache[oldest].path = path;
+  UfsStatCache[oldest].size = size;
+  UfsStatCache[oldest].mtime = mtime;
+  UfsStatCache[oldest].last_used = millis();
+}
+
+void UfsStatCacheFlush(void) {
+  // Call after uploads, deletes or renames so stale entries cannot answer 304 for changed content
+  for (uint32_t i = 0; i < UFS_STAT_CACHE_SIZE; i++) {
+    UfsStatCache[i].path = (const char*)nullptr;
+  }
+}
+
 // class to allow us to request auth when required.
 // StaticRequestHandler is in the above header
 class StaticRequestHandlerAuth : public StaticRequestHandler {
@@ -1069,10 +1336,29 @@ public:
 
         // look for gz file, only if the original specified path is not a gz.  So part only works to send gzip via content encoding when a non compressed is asked for
         // if you point the the path to gzip you will serve the gzip as content type "application/x-gzip", not text or javascript etc...
+        bool is_gzip = false;
         if (!path.endsWith(FPSTR(mimeTable[gz].endsWith)) && !_fs.exists(path))  {
             String pathWithGz = path + FPSTR(mimeTable[gz].endsWith);
-            if(_fs.exists(pathWithGz))
+            if(_fs.exists(pathWithGz)) {
                 path += FPSTR(mimeTable[gz].endsWith);
+                is_gzip = true;       // Keep original content type, announce gzip transfer encoding below
+            }
+        }
+
+        // Revalidation from the stat LRU - hot files answer 304 without any filesystem access
+        char etag[24];
+        String inm = server.header(F("If-None-Match"));
+        uint32_t fsize, fmtime;
+        if (inm.length() && UfsStatCacheGet(path, &fsize, &fmtime)) {
+            snprintf_P(etag, sizeof(etag), PSTR("\"%x-%x\""), fmtime, fsize);
+            if (inm == etag) {
+                if (_requireAuth && !WebAuthenticate()) {
+                    server.requestAuthentication();
+                    return true;
+                }
+                server.send(304, contentType, "");
+                return true;
+            }
         }
 
         File f = _fs.open(path, "r");
@@ -1080,6 +1366,7 @@ public:
             AddLog(LOG_LEVEL_DEBUG, PSTR("UFS: ::handler missing file?"));
             return false;
         }
+        UfsStatCachePut(path, f.size(), f.getLastWrite());
 #ifdef SERVING_DEBUG
         AddLog(LOG_LEVEL_DEBUG, PSTR("UFS: ::handler file open %d"), f.available());
 #endif
@@ -1091,9 +1378,20 @@ public:
           return true;
         }
 
+        snprintf_P(etag, sizeof(etag), PSTR("\"%x-%x\""), (uint32_t)f.getLastWrite(), (uint32_t)f.size());
+        if (inm.length() && (inm == etag)) {
+            f.close();
+            server.send(304, contentType, "");
+            return true;
+        }
+        server.sendHeader(F("ETag"), etag);
+
         if (_cache_header.length() != 0)
             server.sendHeader("Cache-Control", _cache_header);
 
+        if (is_gzip)
+            server.sendHeader(F("Content-Encoding"), F("gzip"));
+
 #ifdef SERVING_DEBUG
         AddLog(LOG_LEVEL_DEBUG, PSTR("UFS: ::handler sending"));
 #endif
@@ -1183,6 +1481,68 @@ void UFSRun(void) {
   }
 }
 
+#define UFS_BENCH_BLOCK_SIZE 4096
+
+void UFSBench(void) {
+  // UfsBench 1..16384 - write then read back <x> kB (default 512) on the active filesystem
+  //                     and report both rates in kB/s. Used to validate SD cards in the field
+  //                     and to compare SPI mode against SDIO.
+  if (!ufs_type) { ResponseCmndFailed(); return; }
+  uint32_t kbytes = (XdrvMailbox.payload >= 1) && (XdrvMailbox.payload <= 16384) ? XdrvMailbox.payload : 512;
+  uint32_t kbytes_free = UfsInfo(1, 0);
+  if (kbytes_free < 2 * UFS_BENCH_BLOCK_SIZE / 1024) { ResponseCmndFailed(); return; }
+  if (kbytes > kbytes_free / 2) { kbytes = kbytes_free / 2; }  // Never fill the filesystem
+  uint32_t blocks = (kbytes * 1024) / UFS_BENCH_BLOCK_SIZE;
+  if (!blocks) { blocks = 1; }
+
+  uint8_t *block = (uint8_t*)special_malloc_tag(PSTR("ufs"), UFS_BENCH_BLOCK_SIZE);
+  if (block == nullptr) { ResponseCmndFailed(); return; }
+  for (uint32_t i = 0; i < UFS_BENCH_BLOCK_SIZE; i++) { block[i] = i; }  // Pattern defeating controller compression
+
+  char fname_bench[14];
+  snprintf_P(fname_bench, sizeof(fname_bench), PSTR("/bench.tmp"));
+
+  File file = ufsp->open(fname_bench, "w");
+  if (!file) {
+    free(block);
+    ResponseCmndFailed();
+    return;
+  }
+  uint32_t start = millis();
+  uint32_t written = 0;
+  for (uint32_t i = 0; i < blocks; i++) {
+    if (file.write(block, UFS_BENCH_BLOCK_SIZE) != UFS_BENCH_BLOCK_SIZE) { break; }
+    written += UFS_BENCH_BLOCK_SIZE;
+    yield();                             // Feed the watchdog on slow media
+  }
+  file.close();
+  uint32_t write_ms = millis() - start;
+
+  uint32_t read = 0;
+  uint32_t read_ms = 0;
+  file = ufsp->open(fname_bench, "r");
+  if (file) {
+    start = millis();
+    while (file.read(block, UFS_BENCH_BLOCK_SIZE) == UFS_BENCH_BLOCK_SIZE) {
+      read += UFS_BENCH_BLOCK_SIZE;
+      yield();
+    }
+    read_ms = millis() - start;
+    file.close();
+  }
+  ufsp->remove(fname_bench);
+  free(block);
+
+  if (!written || !read) {
+    ResponseCmndFailed();
+    return;
+  }
+  if (!write_ms) { write_ms = 1; }
+  if (!read_ms) { read_ms = 1; }
+  Response_P(PSTR("{\"%s\":{\"" D_JSON_SIZE "\":%d,\"Write\":%d,\"Read\":%d}}"),
+    XdrvMailbox.command, written / 1024, written / write_ms, read / read_ms);  // write/read in kB/s as bytes/ms = kB/s
+}
+
 
 
 /*********************************************************************************************\
@@ -1340,6 +1700,7 @@ void UfsDirectory(void) {
         download_file.close();
         dfsp->remove(cp);
       }
+      TfsStatCacheFlush();             // dfsp may be the flash filesystem
     }
   }
 
@@ -1671,6 +2032,10 @@ bool UfsUploadFileWrite(uint8_t *upload_buf, size_t current_size) {
 
 void UfsUploadFileClose(void) {
   ufs_upload_file.close();
+  TfsStatCacheFlush();                 // dfsp may be the flash filesystem
+#ifdef UFILESYS_STATIC_SERVING
+  UfsStatCacheFlush();
+#endif  // UFILESYS_STATIC_SERVING
 }
 
 //******************************************************************************************
@@ -1797,6 +2162,10 @@ void UfsEditorUpload(void) {
   }
 
   fp.close();
+  TfsStatCacheFlush();                 // dfsp may be the flash filesystem
+#ifdef UFILESYS_STATIC_SERVING
+  UfsStatCacheFlush();
+#endif  // UFILESYS_STATIC_SERVING
 
   // zap file name off the end
   folderOnly(fname);
@@ -1864,7 +2233,12 @@ bool Xdrv50(uint32_t function) {
 #endif
 
       break;
-    
+    case FUNC_EVERY_SECOND:
+      TfsStreamEverySecond();
+      break;
+    case FUNC_SAVE_BEFORE_RESTART:
+      TfsStreamFlushAll();
+      break;
     case FUNC_NETWORK_UP:
 #ifdef USE_FTP
       if (Settings->mbflag2.FTP_Mode && !ftpSrv) {
@@ -107,6 +107,12 @@ public:
 #endif // USE_BERRY_GPIOVIEWER
   bool autoexec_done = false;           // do we still need to load 'autoexec.be'
   bool repl_active = false;             // is REPL running (activates log recording)
+  // GC pause tracking, recorded by the observability hook, exposed by `tasmota.gc(true)`
+  uint16_t gc_budget_ms = 0;            // pause budget for a single GC run in ms, `0` means no budget
+  uint32_t gc_count = 0;                // number of GC runs
+  uint32_t gc_over_budget = 0;          // number of GC runs that exceeded the budget
+  uint32_t gc_max_ms = 0;               // longest GC pause observed in ms
+  uint32_t gc_hist[8] = {};             // pause histogram, buckets <1, <2, <5, <10, <20, <50, <100, >=100 ms
   // output log is stored as a LinkedList of buffers
   // and active only when a REPL command is running
   BerryLog log;
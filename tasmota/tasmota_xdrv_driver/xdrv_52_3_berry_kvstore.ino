@@ -0,0 +1,110 @@
+/*
+  xdrv_52_3_berry_kvstore.ino - Berry scripting language, persistent key-value store
+
+  SPDX-FileCopyrightText: 2026 Stephan Hadinger, Berry language by Guan Wenliang https://github.com/Skiars/berry
+
+  SPDX-License-Identifier: GPL-3.0-only
+*/
+
+#ifdef USE_BERRY
+#if defined(USE_UFILESYS) && defined(USE_KVSTORE)
+
+#include <berry.h>
+
+extern "C" {
+  /*********************************************************************************************\
+   * Native functions mapped to Berry functions
+   *
+   * import kvstore
+   *
+   * kvstore.set(key:string, value:string|bytes|int|real) -> bool
+   * kvstore.get(key:string) -> any or nil when absent
+   * kvstore.remove(key:string) -> bool
+   * kvstore.compact() -> bool
+   * kvstore.count() -> int
+   *
+   * Values are stored with a type tag so `get` returns the type that was set.
+   * Unlike `persist` every `set` appends one small record instead of rewriting a file.
+  \*********************************************************************************************/
+
+  int be_ntv_kvstore_set(bvm *vm) {
+    int32_t argc = be_top(vm);
+    if (argc >= 2 && be_isstring(vm, 1)) {
+      const char *key = be_tostring(vm, 1);
+      bool result = false;
+      if (be_isint(vm, 2)) {
+        int32_t val = be_toint(vm, 2);
+        result = KvsSet(key, &val, sizeof(val), KVS_TYPE_INT);
+      } else if (be_isreal(vm, 2)) {
+        float val = be_toreal(vm, 2);
+        result = KvsSet(key, &val, sizeof(val), KVS_TYPE_REAL);
+      } else if (be_isstring(vm, 2)) {
+        const char *val = be_tostring(vm, 2);
+        result = KvsSet(key, val, strlen(val), KVS_TYPE_STRING);
+      } else if (be_isbytes(vm, 2)) {
+        size_t len;
+        const void *val = be_tobytes(vm, 2, &len);
+        result = KvsSet(key, val, len, KVS_TYPE_RAW);
+      } else {
+        be_raise(vm, "type_error", "value must be int, real, string or bytes");
+      }
+      be_pushbool(vm, result);
+      be_return(vm);
+    }
+    be_raise(vm, "type_error", nullptr);
+  }
+
+  int be_ntv_kvstore_get(bvm *vm) {
+    int32_t argc = be_top(vm);
+    if (argc >= 1 && be_isstring(vm, 1)) {
+      const char *key = be_tostring(vm, 1);
+      uint8_t type;
+      int32_t vlen = KvsGet(key, nullptr, 0, &type);
+      if (vlen < 0) {
+        be_return_nil(vm);
+      }
+      if (KVS_TYPE_INT == type) {
+        int32_t val = 0;
+        KvsGet(key, &val, sizeof(val));
+        be_pushint(vm, val);
+      } else if (KVS_TYPE_REAL == type) {
+        float val = 0;
+        KvsGet(key, &val, sizeof(val));
+        be_pushreal(vm, val);
+      } else if (KVS_TYPE_STRING == type) {
+        void *buf = be_pushbuffer(vm, vlen);
+        KvsGet(key, buf, vlen);
+        be_pushnstring(vm, (const char*)buf, vlen);
+      } else {
+        void *buf = be_pushbytes(vm, NULL, vlen);
+        if (vlen > 0) {
+          KvsGet(key, buf, vlen);
+        }
+      }
+      be_return(vm);
+    }
+    be_raise(vm, "type_error", nullptr);
+  }
+
+  int be_ntv_kvstore_remove(bvm *vm) {
+    int32_t argc = be_top(vm);
+    if (argc >= 1 && be_isstring(vm, 1)) {
+      be_pushbool(vm, KvsDelete(be_tostring(vm, 1)));
+      be_return(vm);
+    }
+    be_raise(vm, "type_error", nullptr);
+  }
+
+  int be_ntv_kvstore_compact(bvm *vm) {
+    be_pushbool(vm, KvsCompact());
+    be_return(vm);
+  }
+
+  int be_ntv_kvstore_count(bvm *vm) {
+    be_pushint(vm, KvsCount());
+    be_return(vm);
+  }
+}
+
+#endif  // USE_UFILESYS && USE_KVSTORE
+#endif  // USE_BERRY
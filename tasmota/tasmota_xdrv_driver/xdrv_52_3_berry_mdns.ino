@@ -26,6 +26,110 @@
 #include <string.h>
 #include "IPAddress.h"
 
+/*********************************************************************************************\
+ * Background service browser cache
+ *
+ * Service types registered with `mdns.browse_start()` are re-queried in the background with
+ * the async mDNS API and the last results kept, so Berry reads answers instantly from the
+ * cache instead of blocking several seconds on a multicast round-trip. A service missing
+ * from a sweep stays cached for MDNS_BROWSE_TTL seconds since single empty sweeps happen;
+ * add/remove events are queued for Berry to drain with `mdns.browse_events()`.
+\*********************************************************************************************/
+
+#define MDNS_BROWSE_INTERVAL      15        // Seconds between background queries of each browsed service
+#define MDNS_BROWSE_QUERY_TIME    3         // Seconds an async query is left collecting answers
+#define MDNS_BROWSE_TTL           60        // Seconds an unseen service stays cached
+#define MDNS_BROWSE_MAX_RESULTS   20
+
+struct MdnsBrowseEvent {
+  MdnsBrowseEvent * next;
+  bool add;
+  char instance[1];                         // Allocated to fit
+};
+
+struct MdnsBrowse {
+  MdnsBrowse * next;
+  mdns_search_once_t * search;              // In-flight background query or nullptr
+  mdns_result_t * results;                  // Latest results with answers, owned
+  MdnsBrowseEvent * events;                 // Queued add/remove events, oldest first
+  uint32_t results_time;                    // Uptime of the last sweep with answers
+  uint32_t query_time;                      // Uptime the running or last query was started
+  char service[32];
+  char proto[8];
+};
+
+MdnsBrowse * mdns_browses = nullptr;
+
+MdnsBrowse * MdnsBrowseFind(const char * service, const char * proto) {
+  for (MdnsBrowse * browse = mdns_browses; browse != nullptr; browse = browse->next) {
+    if (!strcmp(browse->service, service) && !strcmp(browse->proto, proto)) { return browse; }
+  }
+  return nullptr;
+}
+
+const char * MdnsBrowseInstance(const mdns_result_t * result) {
+  return (result->instance_name) ? result->instance_name : (result->hostname) ? result->hostname : "";
+}
+
+bool MdnsBrowseContains(mdns_result_t * results, const char * instance) {
+  for (mdns_result_t * result = results; result != nullptr; result = result->next) {
+    if (!strcmp(MdnsBrowseInstance(result), instance)) { return true; }
+  }
+  return false;
+}
+
+void MdnsBrowseQueueEvent(MdnsBrowse * browse, bool add, const char * instance) {
+  MdnsBrowseEvent * event = (MdnsBrowseEvent *)malloc(sizeof(MdnsBrowseEvent) + strlen(instance));
+  if (!event) { return; }
+  event->next = nullptr;
+  event->add = add;
+  strcpy(event->instance, instance);
+  MdnsBrowseEvent * * tail = &browse->events;
+  while (*tail) { tail = &(*tail)->next; }
+  *tail = event;
+}
+
+void MdnsBrowseSweepDone(MdnsBrowse * browse, mdns_result_t * results) {
+  if (!results && browse->results && ((TasmotaGlobal.uptime - browse->results_time) < MDNS_BROWSE_TTL)) {
+    return;                                 // Keep the cache until the TTL expires
+  }
+  for (mdns_result_t * result = results; result != nullptr; result = result->next) {
+    if (!MdnsBrowseContains(browse->results, MdnsBrowseInstance(result))) {
+      MdnsBrowseQueueEvent(browse, true, MdnsBrowseInstance(result));
+    }
+  }
+  for (mdns_result_t * result = browse->results; result != nullptr; result = result->next) {
+    if (!MdnsBrowseContains(results, MdnsBrowseInstance(result))) {
+      MdnsBrowseQueueEvent(browse, false, MdnsBrowseInstance(result));
+    }
+  }
+  if (browse->results) { mdns_query_results_free(browse->results); }
+  browse->results = results;
+  if (results) { browse->results_time = TasmotaGlobal.uptime; }
+}
+
+void MdnsBrowseEverySecond(void) {
+  for (MdnsBrowse * browse = mdns_browses; browse != nullptr; browse = browse->next) {
+    if (browse->search) {
+      mdns_result_t * results = nullptr;
+      uint8_t num_results = 0;
+      if (mdns_query_async_get_results(browse->search, 0, &results, &num_results)) {
+        mdns_query_async_delete(browse->search);
+        browse->search = nullptr;
+        MdnsBrowseSweepDone(browse, results);
+      }
+      else if ((TasmotaGlobal.uptime - browse->query_time) > (2 * MDNS_BROWSE_QUERY_TIME)) {
+        mdns_query_async_delete(browse->search);   // Should not happen - drop a stuck query
+        browse->search = nullptr;
+      }
+    }
+    else if ((TasmotaGlobal.uptime - browse->query_time) >= MDNS_BROWSE_INTERVAL) {
+      browse->query_time = TasmotaGlobal.uptime;
+      browse->search = mdns_query_async_new(nullptr, browse->service, browse->proto, MDNS_TYPE_PTR, MDNS_BROWSE_QUERY_TIME * 1000, MDNS_BROWSE_MAX_RESULTS, nullptr);
+    }
+  }
+}
+
 extern "C" {
   //
   // `mdsn.start([hostname:string]) -> nil`
@@ -277,11 +381,71 @@ extern "C" {
     be_raise(vm, "value_error", "wrong or missing arguments");
   }
 
+  //
+  // Convert a chain of mDNS results to a Berry `list` of `map`s, left on top of the stack.
+  // Shared by `find_service` and the browse cache readers.
+  void m_dns_push_results(struct bvm *vm, mdns_result_t * results) {
+    static const char * ip_protocol_str[] = {"v4", "v6", "max"};
+    mdns_result_t * r = results;
+    mdns_ip_addr_t * a = NULL;
+    be_newobject(vm, "list");
+    while (r) {
+      be_newobject(vm, "map");
+      be_map_insert_str(vm, "type", ip_protocol_str[r->ip_protocol]);
+      if (r->instance_name) { be_map_insert_str(vm, "instance", r->instance_name); }
+      if (r->hostname) { be_map_insert_str(vm, "hostname", r->hostname); }
+      // TXT
+      be_pushstring(vm, "txt");
+      be_newobject(vm, "map");
+      for (int32_t t=0; t < r->txt_count; t++){
+        be_map_insert_str(vm, r->txt[t].key, r->txt[t].value);
+      }
+      //
+      be_pop(vm, 1);
+      be_data_insert(vm, -3);
+      be_pop(vm, 2);
+      //
+
+      // IP addresses
+      be_pushstring(vm, "ip");
+      be_newobject(vm, "list");
+      //
+      for (a = r->addr; a != NULL; a = a->next) {
+#ifdef USE_IPV6
+        ip_addr_t ip_addr;
+        if (a->addr.type == IPADDR_TYPE_V6) {
+          ip_addr_copy_from_ip6(ip_addr, a->addr.u_addr.ip6);
+        } else if (a->addr.type == IPADDR_TYPE_V4) {
+          ip_addr_copy_from_ip4(ip_addr, a->addr.u_addr.ip4);
+        } else {
+          continue;
+        }
+        be_pushstring(vm, IPAddress(&ip_addr).toString(true).c_str());
+#else
+        uint32_t ip_addr = a->addr.u_addr.ip4.addr;
+        be_pushstring(vm, IPAddress(ip_addr).toString().c_str());
+#endif
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+      }
+      //
+      be_pop(vm, 1);
+      be_data_insert(vm, -3);
+      be_pop(vm, 2);
+
+      be_pop(vm, 1);
+      be_data_push(vm, -2);
+      be_pop(vm, 1);
+
+      r = r->next;
+    }
+    be_pop(vm, 1);                  // now list is on top
+  }
+
   //
   // `mdns.find_service(service:string, proto:string [timeout_ms:int(3000), max_responses:int(20)]) -> map`
   //
   int32_t m_dns_find_service(struct bvm *vm) {
-    static const char * ip_protocol_str[] = {"v4", "v6", "max"};
     int32_t top = be_top(vm);
     if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
       const char* service_name = be_tostring(vm, 1);
@@ -300,62 +464,110 @@ extern "C" {
       if (err != ESP_OK) { be_raisef(vm, "value_error", "mdns_query_ptr err=%i", err); }
       if (results == NULL) { be_return_nil(vm); }
 
-      mdns_result_t * r = results;
-      mdns_ip_addr_t * a = NULL;
-      be_newobject(vm, "list");
-      while (r) {
-        be_newobject(vm, "map");
-        be_map_insert_str(vm, "type", ip_protocol_str[r->ip_protocol]);
-        if (r->instance_name) { be_map_insert_str(vm, "instance", r->instance_name); }
-        if (r->hostname) { be_map_insert_str(vm, "hostname", r->hostname); }
-        // TXT
-        be_pushstring(vm, "txt");
-        be_newobject(vm, "map");
-        for (int32_t t=0; t < r->txt_count; t++){
-          be_map_insert_str(vm, r->txt[t].key, r->txt[t].value);
-        }
-        //
-        be_pop(vm, 1);
-        be_data_insert(vm, -3);
-        be_pop(vm, 2);
-        //
-
-        // IP addresses
-        be_pushstring(vm, "ip");
-        be_newobject(vm, "list");
-        //
-        for (a = r->addr; a != NULL; a = a->next) {
-  #ifdef USE_IPV6
-          ip_addr_t ip_addr;
-          if (a->addr.type == IPADDR_TYPE_V6) {
-            ip_addr_copy_from_ip6(ip_addr, a->addr.u_addr.ip6);
-          } else if (a->addr.type == IPADDR_TYPE_V4) {
-            ip_addr_copy_from_ip4(ip_addr, a->addr.u_addr.ip4);
-          } else {
-            continue;
+      m_dns_push_results(vm, results);
+      mdns_query_results_free(results);
+      be_return(vm);
+    }
+    be_raise(vm, "value_error", "wrong or missing arguments");
+  }
+
+  //
+  // `mdns.browse_start(service:string, proto:string) -> nil`
+  //
+  // register a service type for continuous background browsing
+  //
+  int32_t m_dns_browse_start(struct bvm *vm) {
+    int32_t top = be_top(vm);
+    if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
+      const char* service = be_tostring(vm, 1);
+      const char* proto = be_tostring(vm, 2);
+      if (MdnsBrowseFind(service, proto) == nullptr) {
+        MdnsBrowse * browse = (MdnsBrowse *)calloc(1, sizeof(MdnsBrowse));
+        if (browse == nullptr) { be_raise(vm, "memory_error", nullptr); }
+        strlcpy(browse->service, service, sizeof(browse->service));
+        strlcpy(browse->proto, proto, sizeof(browse->proto));
+        browse->query_time = TasmotaGlobal.uptime - MDNS_BROWSE_INTERVAL;  // First query on the next second
+        browse->next = mdns_browses;
+        mdns_browses = browse;
+      }
+      be_return_nil(vm);
+    }
+    be_raise(vm, "value_error", "wrong or missing arguments");
+  }
+
+  //
+  // `mdns.browse_stop(service:string, proto:string) -> nil`
+  //
+  // stop browsing a service type and drop its cached records and events
+  //
+  int32_t m_dns_browse_stop(struct bvm *vm) {
+    int32_t top = be_top(vm);
+    if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
+      const char* service = be_tostring(vm, 1);
+      const char* proto = be_tostring(vm, 2);
+      MdnsBrowse * * flink = &mdns_browses;
+      while (*flink) {
+        MdnsBrowse * browse = *flink;
+        if (!strcmp(browse->service, service) && !strcmp(browse->proto, proto)) {
+          *flink = browse->next;
+          if (browse->search) { mdns_query_async_delete(browse->search); }
+          if (browse->results) { mdns_query_results_free(browse->results); }
+          while (browse->events) {
+            MdnsBrowseEvent * event = browse->events;
+            browse->events = event->next;
+            free(event);
           }
-          be_pushstring(vm, IPAddress(&ip_addr).toString(true).c_str());
-  #else
-          uint32_t ip_addr = a->addr.u_addr.ip4.addr;
-          be_pushstring(vm, IPAddress(ip_addr).toString().c_str());
-  #endif
-          be_data_push(vm, -2);
-          be_pop(vm, 1);
+          free(browse);
+          break;
         }
-        //
-        be_pop(vm, 1);
-        be_data_insert(vm, -3);
-        be_pop(vm, 2);
+        flink = &browse->next;
+      }
+      be_return_nil(vm);
+    }
+    be_raise(vm, "value_error", "wrong or missing arguments");
+  }
+
+  //
+  // `mdns.browse_read(service:string, proto:string) -> list`
+  //
+  // read the cached records of a browsed service type, same format as `find_service`,
+  // but returns instantly without a network round-trip
+  //
+  int32_t m_dns_browse_read(struct bvm *vm) {
+    int32_t top = be_top(vm);
+    if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
+      MdnsBrowse * browse = MdnsBrowseFind(be_tostring(vm, 1), be_tostring(vm, 2));
+      if (browse == nullptr) { be_raise(vm, "value_error", "service is not being browsed"); }
+      m_dns_push_results(vm, browse->results);
+      be_return(vm);
+    }
+    be_raise(vm, "value_error", "wrong or missing arguments");
+  }
 
+  //
+  // `mdns.browse_events(service:string, proto:string) -> list`
+  //
+  // drain the queued add/remove events of a browsed service type as a list of maps
+  // with keys `action` ("add" or "remove") and `instance`
+  //
+  int32_t m_dns_browse_events(struct bvm *vm) {
+    int32_t top = be_top(vm);
+    if (top >= 2 && be_isstring(vm, 1) && be_isstring(vm, 2)) {
+      MdnsBrowse * browse = MdnsBrowseFind(be_tostring(vm, 1), be_tostring(vm, 2));
+      if (browse == nullptr) { be_raise(vm, "value_error", "service is not being browsed"); }
+      be_newobject(vm, "list");
+      while (browse->events) {
+        MdnsBrowseEvent * event = browse->events;
+        browse->events = event->next;
+        be_newobject(vm, "map");
+        be_map_insert_str(vm, "action", (event->add) ? "add" : "remove");
+        be_map_insert_str(vm, "instance", event->instance);
         be_pop(vm, 1);
         be_data_push(vm, -2);
         be_pop(vm, 1);
-
-        r = r->next;
+        free(event);
       }
       be_pop(vm, 1);                  // now list is on top
-
-      mdns_query_results_free(results);
       be_return(vm);
     }
     be_raise(vm, "value_error", "wrong or missing arguments");
@@ -0,0 +1,189 @@
+/*
+  xdrv_52_3_berry_profiler.ino - Berry scripting language, sampling execution profiler
+
+  Copyright (C) 2021 Stephan Hadinger, Berry language by Guan Wenliang https://github.com/Skiars/berry
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef USE_BERRY
+
+#include <berry.h>
+#include "be_vm.h"
+#include "be_object.h"
+#include "be_string.h"
+#undef str      // do not leak the short-lived `str()` helper macro into the rest of the build
+
+/*********************************************************************************************\
+ * Sampling profiler for Berry code
+ *
+ * Piggybacks on the BE_OBS_VM_HEARTBEAT observability event, which the VM already raises
+ * every 2^(BE_VM_OBSERVABILITY_SAMPLING-1) instructions from its execution loop. Each
+ * heartbeat attributes one sample to the closure currently executing bytecode, so the
+ * sample distribution converges to the share of VM time spent per function. The extra
+ * work is a small linear scan a few times per second of VM time, cheap enough to stay
+ * enabled on fleet devices.
+ *
+ * Functions are keyed by their proto pointer; the name is copied into the slot so a slot
+ * stays printable after the closure is garbage collected. A proto freed and reallocated
+ * at the same address while sampling runs would merge two functions, which is acceptable
+ * for a statistical profiler.
+ *
+ * import profiler
+ * profiler.start()      -- clear counters and start sampling
+ * profiler.stop()       -- stop sampling, counters are kept
+ * profiler.counters()   -- map of function name -> samples (json.dump for reporting)
+ * profiler.dump()       -- sorted per-function breakdown to the console
+\*********************************************************************************************/
+
+#define BERRY_PROFILER_SLOTS        24      // max number of distinct functions tracked
+#define BERRY_PROFILER_NAME_SIZE    28      // truncated copy of "source:function"
+
+struct BrProfilerSlot {
+  const void * proto;                       // identity of the function, never dereferenced
+  uint32_t samples;
+  char name[BERRY_PROFILER_NAME_SIZE];
+};
+
+struct BrProfiler {
+  bool running;
+  uint32_t total;                           // samples recorded, including missed ones
+  uint32_t missed;                          // samples arrived when all slots were taken
+  uint32_t start_ms;                        // millis() when sampling (re)started
+  BrProfilerSlot slot[BERRY_PROFILER_SLOTS];
+};
+BrProfiler * br_profiler = nullptr;         // allocated on first `profiler.start()`
+
+// Called from the BE_OBS_VM_HEARTBEAT observability event.
+// The heartbeat fires from the bytecode execution loop, so the innermost frame is the
+// Berry closure being executed; time spent in native leaves is attributed to the caller.
+void BrProfilerSample(struct bvm *vm) {
+  BrProfiler * prof = br_profiler;
+  if ((prof == nullptr) || (!prof->running)) { return; }
+  bvalue * func = vm->cf->func;
+  if (!var_isclosure(func)) { return; }
+  bproto * proto = ((bclosure*) var_toobj(func))->proto;
+
+  prof->total++;
+  uint32_t free_slot = BERRY_PROFILER_SLOTS;
+  for (uint32_t i = 0; i < BERRY_PROFILER_SLOTS; i++) {
+    if (prof->slot[i].proto == proto) {
+      prof->slot[i].samples++;
+      return;
+    }
+    if ((prof->slot[i].proto == nullptr) && (free_slot == BERRY_PROFILER_SLOTS)) {
+      free_slot = i;
+    }
+  }
+  if (free_slot == BERRY_PROFILER_SLOTS) {
+    prof->missed++;                         // all slots taken, keep totals honest
+    return;
+  }
+
+  BrProfilerSlot * slot = &prof->slot[free_slot];
+  slot->proto = proto;
+  slot->samples = 1;
+  const char * name = (proto->name != nullptr) ? be_str2cstr(proto->name) : "<anonymous>";
+#if BE_DEBUG_SOURCE_FILE
+  const char * source = (proto->source != nullptr) ? be_str2cstr(proto->source) : "";
+  const char * file = strrchr(source, '/');         // keep only the file name of the source path
+  file = (file != nullptr) ? file + 1 : source;
+  snprintf(slot->name, sizeof(slot->name), "%s:%s", file, name);
+#else
+  snprintf(slot->name, sizeof(slot->name), "%s", name);
+#endif
+}
+
+extern "C" {
+  // Berry: `profiler.start() -> nil`
+  int32_t be_profiler_start(bvm *vm);
+  int32_t be_profiler_start(bvm *vm) {
+    if (br_profiler == nullptr) {
+      br_profiler = (BrProfiler*) berry_malloc(sizeof(BrProfiler));
+      if (br_profiler == nullptr) {
+        be_raise(vm, "memory_error", "cannot allocate profiler");
+      }
+    }
+    memset(br_profiler, 0, sizeof(BrProfiler));
+    br_profiler->start_ms = millis();
+    br_profiler->running = true;
+    be_return_nil(vm);
+  }
+
+  // Berry: `profiler.stop() -> nil`
+  int32_t be_profiler_stop(bvm *vm);
+  int32_t be_profiler_stop(bvm *vm) {
+    if (br_profiler != nullptr) {
+      br_profiler->running = false;
+    }
+    be_return_nil(vm);
+  }
+
+  // Berry: `profiler.counters() -> map`
+  //
+  // Per-function sample counters, plus `(missed)` for samples that found no free slot;
+  // parentheses are invalid in Berry identifiers so the meta key cannot collide.
+  int32_t be_profiler_counters(bvm *vm);
+  int32_t be_profiler_counters(bvm *vm) {
+    be_newobject(vm, "map");
+    if (br_profiler != nullptr) {
+      for (uint32_t i = 0; i < BERRY_PROFILER_SLOTS; i++) {
+        if (br_profiler->slot[i].proto != nullptr) {
+          be_map_insert_int(vm, br_profiler->slot[i].name, br_profiler->slot[i].samples);
+        }
+      }
+      if (br_profiler->missed) {
+        be_map_insert_int(vm, "(missed)", br_profiler->missed);
+      }
+    }
+    be_pop(vm, 1);
+    be_return(vm);
+  }
+
+  // Berry: `profiler.dump() -> nil`
+  //
+  // Sorted per-function breakdown with percentages to the console
+  int32_t be_profiler_dump(bvm *vm);
+  int32_t be_profiler_dump(bvm *vm) {
+    BrProfiler * prof = br_profiler;
+    if ((prof == nullptr) || (0 == prof->total)) {
+      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_BERRY "Profiler: no samples"));
+      be_return_nil(vm);
+    }
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_BERRY "Profiler: %u samples over %u ms%s"),
+           prof->total, millis() - prof->start_ms, (prof->running) ? " (running)" : "");
+    // selection over the small slot table, do not disturb the live counters
+    bool reported[BERRY_PROFILER_SLOTS] = {};
+    while (true) {
+      int32_t best = -1;
+      for (uint32_t i = 0; i < BERRY_PROFILER_SLOTS; i++) {
+        if ((prof->slot[i].proto == nullptr) || reported[i]) { continue; }
+        if ((best < 0) || (prof->slot[i].samples > prof->slot[best].samples)) { best = i; }
+      }
+      if (best < 0) { break; }
+      reported[best] = true;
+      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_BERRY "Profiler: %6u (%2u%%) %s"),
+             prof->slot[best].samples,
+             (prof->slot[best].samples * 100) / prof->total,
+             prof->slot[best].name);
+    }
+    if (prof->missed) {
+      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_BERRY "Profiler: %6u (%2u%%) (missed, all %d slots taken)"),
+             prof->missed, (prof->missed * 100) / prof->total, BERRY_PROFILER_SLOTS);
+    }
+    be_return_nil(vm);
+  }
+}
+
+#endif  // USE_BERRY
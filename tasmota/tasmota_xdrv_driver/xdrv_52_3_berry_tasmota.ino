@@ -108,7 +108,7 @@ extern "C" {
     if (top == 2 && be_isstring(vm, 2)) {  // only 1 argument of type string accepted
       const char * command = be_tostring(vm, 2);
       be_pop(vm, top);    // clear the stack before calling, because of re-entrant call to Berry in a Rule
-      ExecuteCommand(command, SRC_BERRY);
+      ExecuteCommandDirect(command, SRC_BERRY);   // programmatic call, skip the topic machinery
       be_return_nil(vm); // Return
     }
     be_raise(vm, kTypeError, nullptr);
@@ -196,6 +196,38 @@ extern "C" {
     be_return(vm);
   }
 
+  // Berry: tasmota._gc_info(budget_ms:int) -> int, set the GC pause budget in ms (0 disables)
+  //        tasmota._gc_info(any) -> map of GC pause statistics, see `tasmota.gc(true)`
+  //
+  int32_t l_gc_info(struct bvm *vm);
+  int32_t l_gc_info(struct bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 1 && be_isint(vm, 1)) {    // set the pause budget
+      int32_t budget = be_toint(vm, 1);
+      if (budget < 0) { budget = 0; }
+      if (budget > 0xFFFF) { budget = 0xFFFF; }
+      berry.gc_budget_ms = budget;
+      be_pushint(vm, berry.gc_budget_ms);
+      be_return(vm);
+    }
+    be_newobject(vm, "map");
+    be_map_insert_int(vm, "count", berry.gc_count);
+    be_map_insert_int(vm, "max_ms", berry.gc_max_ms);
+    be_map_insert_int(vm, "budget_ms", berry.gc_budget_ms);
+    be_map_insert_int(vm, "over_budget", berry.gc_over_budget);
+    // histogram of pause durations in ms
+    be_map_insert_int(vm, "<1", berry.gc_hist[0]);
+    be_map_insert_int(vm, "<2", berry.gc_hist[1]);
+    be_map_insert_int(vm, "<5", berry.gc_hist[2]);
+    be_map_insert_int(vm, "<10", berry.gc_hist[3]);
+    be_map_insert_int(vm, "<20", berry.gc_hist[4]);
+    be_map_insert_int(vm, "<50", berry.gc_hist[5]);
+    be_map_insert_int(vm, "<100", berry.gc_hist[6]);
+    be_map_insert_int(vm, ">=100", berry.gc_hist[7]);
+    be_pop(vm, 1);
+    be_return(vm);
+  }
+
   // Berry: tasmota.memory() -> map
   //
   int32_t l_memory(struct bvm *vm);
@@ -555,8 +587,9 @@ extern "C" {
     int32_t top = be_top(vm); // Get the number of arguments
     if (top == 2 && be_isstring(vm, 2)) {
       const char *msg = be_tostring(vm, 2);
+      size_t len = be_strlen(vm, 2);    // Berry strings know their length
       be_pop(vm, top);  // avoid Error be_top is non zero message
-      ResponseAppend_P(PSTR("%s"), msg);
+      ResponseAppendBuffer(msg, len);   // append as-is, no printf pass nor intermediate copy
       be_return_nil(vm);
     }
     be_raise(vm, kTypeError, nullptr);
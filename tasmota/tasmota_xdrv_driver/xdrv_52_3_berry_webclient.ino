@@ -132,9 +132,50 @@ extern "C" {
     return (WiFiClient*) p;
   }
 
+#ifndef USE_BERRY_WEBCLIENT_ASYNC_STACK
+#define USE_BERRY_WEBCLIENT_ASYNC_STACK 10240   // TLS handshake needs a deep stack
+#endif
+
+  // State of an async request, shared between the instance and the worker task.
+  // The worker task owns the HTTP client while `running` is true.
+  struct WcAsync {
+    HTTPClientLight *cl = nullptr;
+    uint8_t *payload = nullptr;     // copied body for POST/PUT/PATCH/DELETE, nullptr for GET
+    size_t payload_len = 0;
+    int32_t op = 0;
+    volatile int32_t httpCode = 0;
+    uint32_t http_connect_time = 0;
+    volatile bool running = false;  // true while the worker task owns the client
+    bool logged = false;            // result already logged by wc.result()
+  };
+
+  WcAsync * wc_getasync(struct bvm *vm) {
+    be_getmember(vm, 1, ".a");
+    void *p = be_iscomptr(vm, -1) ? be_tocomptr(vm, -1) : nullptr;
+    be_pop(vm, 1);
+    return (WcAsync*) p;
+  }
+
+  // Raise if an async request currently owns the client, i.e. before any
+  // synchronous use of the underlying HTTP client
+  void wc_assert_no_async(struct bvm *vm) {
+    WcAsync * async = wc_getasync(vm);
+    if (async != nullptr && async->running) {
+      be_raise(vm, "internal_error", "async request still running");
+    }
+  }
+
   int32_t wc_deinit(struct bvm *vm);
   int32_t wc_deinit(struct bvm *vm) {
     // int32_t argc = be_top(vm); // Get the number of arguments
+    WcAsync * async = wc_getasync(vm);
+    if (async != nullptr) {
+      while (async->running) { vTaskDelay(10 / portTICK_PERIOD_MS); }   // wait for the worker task to release the client
+      free(async->payload);
+      delete async;
+      be_pushnil(vm);
+      be_setmember(vm, 1, ".a");
+    }
     HTTPClientLight * cl = wc_getclient(vm);
     if (cl != nullptr) { delete cl; }
     be_pushnil(vm);
@@ -172,6 +213,7 @@ extern "C" {
     int32_t argc = be_top(vm);
     if (argc == 1 || !be_tostring(vm, 2)) { be_raise(vm, "attribute_error", "missing URL as string"); }
     const char * url = be_tostring(vm, 2);
+    wc_assert_no_async(vm);
     HTTPClientLight * cl = wc_getclient(vm);
     // open connection
     if (!cl->begin(url)) {
@@ -208,6 +250,7 @@ extern "C" {
   // wc.close(void) -> nil
   int32_t wc_close(struct bvm *vm);
   int32_t wc_close(struct bvm *vm) {
+    wc_assert_no_async(vm);
     HTTPClientLight * cl = wc_getclient(vm);
     cl->end();
     be_return_nil(vm);
@@ -450,6 +493,7 @@ extern "C" {
   // cw.GET(void) -> httpCode:int
   int32_t wc_GET(struct bvm *vm);
   int32_t wc_GET(struct bvm *vm) {
+    wc_assert_no_async(vm);
     HTTPClientLight * cl = wc_getclient(vm);
     uint32_t http_connect_time = millis();
     int32_t httpCode = cl->GET();
@@ -469,6 +513,7 @@ extern "C" {
   int32_t wc_PostPutPatchDelete(struct bvm *vm, int32_t op) {
     int32_t argc = be_top(vm);
     if (argc >= 2 && (be_isstring(vm, 2) || be_isbytes(vm, 2))) {
+      wc_assert_no_async(vm);
       HTTPClientLight * cl = wc_getclient(vm);
       const char * buf = nullptr;
       size_t buf_len = 0;
@@ -527,8 +572,141 @@ extern "C" {
     return wc_PostPutPatchDelete(vm, wc_DELETE_op);
   }
 
+  /*********************************************************************************************\
+   * Async requests
+   *
+   * The request runs blocking on its own FreeRTOS task so the Berry VM and the
+   * main loop keep running; the script polls `wc.pending()` (typically from a
+   * timer or fast_loop) and reads the http code with `wc.result()` once done.
+  \*********************************************************************************************/
+
+  void wc_async_task(void *arg) {
+    WcAsync * async = (WcAsync*) arg;
+    int32_t httpCode;
+    switch (async->op) {
+      case wc_POST_op:
+        httpCode = async->cl->POST(async->payload, async->payload_len);
+        break;
+      case wc_PUT_op:
+        httpCode = async->cl->PUT(async->payload, async->payload_len);
+        break;
+      case wc_PATCH_op:
+        httpCode = async->cl->PATCH(async->payload, async->payload_len);
+        break;
+      case wc_DELETE_op:
+        httpCode = async->cl->DELETE(async->payload, async->payload_len);
+        break;
+      default:
+        httpCode = async->cl->GET();
+        break;
+    }
+    async->httpCode = httpCode;
+    async->running = false;     // release the client back to the VM
+    vTaskDelete(NULL);
+  }
+
+  // op is wc_POST_op..wc_DELETE_op, or -1 for GET (no payload)
+  int32_t wc_start_async(struct bvm *vm, int32_t op) {
+    int32_t argc = be_top(vm);
+    wc_assert_no_async(vm);
+    HTTPClientLight * cl = wc_getclient(vm);
+    WcAsync * async = wc_getasync(vm);
+    if (async == nullptr) {
+      async = new WcAsync();
+      be_pushcomptr(vm, (void*) async);
+      be_setmember(vm, 1, ".a");
+    }
+    free(async->payload);
+    async->payload = nullptr;
+    async->payload_len = 0;
+    if (op >= 0) {
+      if (argc < 2 || !(be_isstring(vm, 2) || be_isbytes(vm, 2))) {
+        be_raise(vm, kTypeError, nullptr);
+      }
+      const char * buf = nullptr;
+      size_t buf_len = 0;
+      if (be_isstring(vm, 2)) {  // string
+        buf = be_tostring(vm, 2);
+        buf_len = strlen(buf);
+      } else { // bytes
+        buf = (const char*) be_tobytes(vm, 2, &buf_len);
+      }
+      // Copy the payload, the VM may move or collect the original while the task runs
+      async->payload = (uint8_t*) malloc(buf_len);
+      if (async->payload == nullptr) { be_throw(vm, BE_MALLOC_FAIL); }
+      memcpy(async->payload, buf, buf_len);
+      async->payload_len = buf_len;
+    }
+    async->cl = cl;
+    async->op = op;
+    async->httpCode = 0;
+    async->logged = false;
+    async->http_connect_time = millis();
+    async->running = true;
+    if (xTaskCreate(wc_async_task, "bwc", USE_BERRY_WEBCLIENT_ASYNC_STACK, async, 1, nullptr) != pdPASS) {
+      async->running = false;
+      be_raise(vm, "internal_error", "cannot start async task");
+    }
+    be_pushvalue(vm, 1);
+    be_return(vm);  /* return self */
+  }
+
+  // wc.GET_async(void) -> self
+  int32_t wc_GET_async(struct bvm *vm);
+  int32_t wc_GET_async(struct bvm *vm) {
+    return wc_start_async(vm, -1);
+  }
+
+  // wc.POST_async(string | bytes) -> self
+  int32_t wc_POST_async(struct bvm *vm);
+  int32_t wc_POST_async(struct bvm *vm) {
+    return wc_start_async(vm, wc_POST_op);
+  }
+
+  // wc.PUT_async(string | bytes) -> self
+  int32_t wc_PUT_async(struct bvm *vm);
+  int32_t wc_PUT_async(struct bvm *vm) {
+    return wc_start_async(vm, wc_PUT_op);
+  }
+
+  // wc.PATCH_async(string | bytes) -> self
+  int32_t wc_PATCH_async(struct bvm *vm);
+  int32_t wc_PATCH_async(struct bvm *vm) {
+    return wc_start_async(vm, wc_PATCH_op);
+  }
+
+  // wc.DELETE_async(string | bytes) -> self
+  int32_t wc_DELETE_async(struct bvm *vm);
+  int32_t wc_DELETE_async(struct bvm *vm) {
+    return wc_start_async(vm, wc_DELETE_op);
+  }
+
+  // wc.pending(void) -> bool, true while an async request is on the wire
+  int32_t wc_pending(struct bvm *vm);
+  int32_t wc_pending(struct bvm *vm) {
+    WcAsync * async = wc_getasync(vm);
+    be_pushbool(vm, (async != nullptr) && async->running);
+    be_return(vm);  /* return code */
+  }
+
+  // wc.result(void) -> httpCode:int, or nil while pending or when no async request was made
+  int32_t wc_result(struct bvm *vm);
+  int32_t wc_result(struct bvm *vm) {
+    WcAsync * async = wc_getasync(vm);
+    if ((async == nullptr) || async->running) {
+      be_return_nil(vm);
+    }
+    if (!async->logged) {
+      async->logged = true;
+      wc_errorCodeMessage(async->httpCode, async->http_connect_time);
+    }
+    be_pushint(vm, async->httpCode);
+    be_return(vm);  /* return code */
+  }
+
   int32_t wc_getstring(struct bvm *vm);
   int32_t wc_getstring(struct bvm *vm) {
+    wc_assert_no_async(vm);
     HTTPClientLight * cl = wc_getclient(vm);
     int32_t sz = cl->getSize();
     // abort if we exceed 32KB size, things will not go well otherwise
@@ -732,6 +910,7 @@ protected:
 extern "C" {
   int32_t wc_getbytes(struct bvm *vm);
   int32_t wc_getbytes(struct bvm *vm) {
+    wc_assert_no_async(vm);
     HTTPClientLight * cl = wc_getclient(vm);
     int32_t sz = cl->getSize();
     // abort if we exceed 32KB size, things will not go well otherwise
@@ -75,14 +75,30 @@ extern "C" {
   void *berry_malloc(size_t size);
   void *berry_realloc(void *ptr, size_t size);
 #ifdef USE_BERRY_PSRAM
+  // Split allocations by size: small blocks are hot mutable objects (GC pools,
+  // instances, map slots) and stay in internal RAM where access is fast; blocks of
+  // USE_BERRY_PSRAM_THRESHOLD bytes and above are dominated by immutable or cold data
+  // (long string bodies, compiled code and constant tables, bytes buffers) and go to
+  // PSRAM. special_malloc falls back to internal RAM when no PSRAM is connected.
+  // Keep the threshold above the be_mem.c pool block size (~504 bytes), the pools
+  // back every allocation up to 32 bytes and must stay internal.
   void *berry_malloc(size_t size) {
-    return special_malloc(size);
+    if (size >= USE_BERRY_PSRAM_THRESHOLD) {
+      return special_malloc(size);
+    }
+    return malloc(size);
   }
   void *berry_realloc(void *ptr, size_t size) {
-    return special_realloc(ptr, size);
+    if (size >= USE_BERRY_PSRAM_THRESHOLD) {
+      return special_realloc(ptr, size);    // moves the block to PSRAM if it was internal
+    }
+    return realloc(ptr, size);              // shrinking below the threshold moves it back
   }
   void *berry_calloc(size_t num, size_t size) {
-    return special_calloc(num, size);
+    if (num * size >= USE_BERRY_PSRAM_THRESHOLD) {
+      return special_calloc(num, size);
+    }
+    return calloc(num, size);
   }
 #else
   void *berry_malloc(size_t size) {
@@ -292,6 +308,17 @@ void BerryObservability(bvm *vm, int event...) {
         if (!UsePSRAM() && vm->gc.threshold > 20*1024) {
           vm->gc.threshold = vm->gc.usage + 10*1024;    // increase by only 10 KB
         }
+        // record the pause in the histogram exposed by `tasmota.gc(true)`
+        static const uint8_t gc_hist_bounds[] = { 1, 2, 5, 10, 20, 50, 100 };
+        uint32_t bucket = 0;
+        while ((bucket < nitems(gc_hist_bounds)) && (gc_elapsed >= gc_hist_bounds[bucket])) { bucket++; }
+        berry.gc_hist[bucket]++;
+        berry.gc_count++;
+        if (gc_elapsed > berry.gc_max_ms) { berry.gc_max_ms = gc_elapsed; }
+        if (berry.gc_budget_ms && (gc_elapsed > berry.gc_budget_ms)) {
+          berry.gc_over_budget++;
+          AddLog(LOG_LEVEL_DEBUG, D_LOG_BERRY "GC pause %i ms exceeded budget %i ms", gc_elapsed, berry.gc_budget_ms);
+        }
       }
       break;
     case BE_OBS_STACK_RESIZE_START:
@@ -304,6 +331,7 @@ void BerryObservability(bvm *vm, int event...) {
     case BE_OBS_VM_HEARTBEAT:
       {
         // AddLog(LOG_LEVEL_INFO, ">>>: Heartbeat now=%i timeout=%i", millis(), berry.timeout);
+        BrProfilerSample(vm);     // attribute one sample to the running closure (see `import profiler`)
         if (berry.timeout) {
           if (TimeReached(berry.timeout)) {
             be_raise(vm, "timeout_error", "Berry code running for too long");
@@ -336,6 +364,24 @@ void BrShowState(void) {
   }
 }
 
+/*********************************************************************************************\
+ * Proactive GC in loop idle time
+ *
+ * The Berry GC is stop-the-world: when the allocator triggers it in the middle of
+ * a Berry callback (display refresh, Matter handler...) the pause adds to the
+ * callback time and can blow the 50 ms tick. Collecting from the main loop once
+ * usage gets close to the auto-GC threshold moves most pauses to idle time where
+ * they don't delay a tick. Pause durations are recorded by the observability hook
+ * and can be checked against the budget with `tasmota.gc(true)`.
+\*********************************************************************************************/
+void BrGcIdle(void) {
+  if (nullptr == berry.vm) { return; }
+  // collect slightly before the threshold that would trigger the in-callback auto-GC
+  if (berry.vm->gc.usage > berry.vm->gc.threshold - (berry.vm->gc.threshold >> 3)) {    // within 12.5% of the threshold
+    be_gc_collect(berry.vm);
+  }
+}
+
 /*********************************************************************************************\
  * VM Init
 \*********************************************************************************************/
@@ -906,6 +952,9 @@ bool Xdrv52(uint32_t function)
       if (TasmotaGlobal.berry_fast_loop_enabled) {    // call only if enabled at global level
         callBerryFastLoop(true);      // call `tasmota.fast_loop()` optimized for minimal performance impact
       }
+      if (TasmotaGlobal.berry_deferred_ready || TasmotaGlobal.berry_fast_loop_enabled) {
+        SleepRequestWake(1);          // immediate functions and fast_loop expect per-millisecond cadence
+      }
       break;
     case FUNC_LOOP:
       if (!berry.autoexec_done) {
@@ -935,6 +984,7 @@ bool Xdrv52(uint32_t function)
       if (TasmotaGlobal.berry_fast_loop_enabled) {    // call only if enabled at global level
         callBerryFastLoop(false);      // call `tasmota.fast_loop()` optimized for minimal performance impact
       }
+      BrGcIdle();     // proactive GC in idle time when usage approaches the auto-GC threshold
       break;
 
     // Berry wide commands and events
@@ -965,6 +1015,9 @@ bool Xdrv52(uint32_t function)
       callBerryEventDispatcher(PSTR("every_250ms"), nullptr, 0, nullptr);
       break;
     case FUNC_EVERY_SECOND:
+#ifdef USE_DISCOVERY
+      MdnsBrowseEverySecond();          // Background mDNS service browse cache
+#endif  // USE_DISCOVERY
       callBerryEventDispatcher(PSTR("every_second"), nullptr, 0, nullptr);
       break;
     case FUNC_SET_DEVICE_POWER:
@@ -30,6 +30,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 
 // callback type when a screen paint is done
 typedef void (*lv_paint_cb_t)(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint8_t *pixels);
@@ -42,6 +43,10 @@ struct LVGL_Glue {
   Ticker tick;
   File * screenshot = nullptr;
   lv_paint_cb_t paint_cb = nullptr;
+#ifdef USE_LVGL_FLUSH_TASK
+  QueueHandle_t flush_queue = nullptr;
+  TaskHandle_t flush_task = nullptr;
+#endif // USE_LVGL_FLUSH_TASK
 };
 LVGL_Glue * lvgl_glue;
 
@@ -58,6 +63,39 @@ static void lvbe_debug(lv_log_level_t, const char *msg) {
 #endif
 #endif
 
+#ifdef USE_LVGL_FLUSH_TASK
+/************************************************************
+ * Dedicated flush task
+ *
+ * Rendered areas are handed to a task pinned to the core the
+ * Arduino loop does NOT run on, which pushes the pixels to the
+ * panel and only then reports the buffer as free. With the two
+ * LVGL buffers, lv_timer_handler() renders the next area into
+ * one buffer while the previous one is still going out over
+ * SPI, so rendering and display output overlap.
+ ************************************************************/
+struct LVGL_FlushJob {
+  lv_display_t *disp;
+  lv_area_t area;
+  uint8_t *pixels;
+};
+
+static void lv_flush_task(void *pvParameters) {
+  LVGL_FlushJob job;
+  while (true) {
+    if (pdTRUE == xQueueReceive(lvgl_glue->flush_queue, &job, portMAX_DELAY)) {
+      uint16_t width = (job.area.x2 - job.area.x1 + 1);
+      uint16_t height = (job.area.y2 - job.area.y1 + 1);
+      renderer->setAddrWindow(job.area.x1, job.area.y1, job.area.x1 + width, job.area.y1 + height);
+      renderer->pushColors((uint16_t *)job.pixels, width * height, true);
+      renderer->setAddrWindow(0, 0, 0, 0);
+      renderer->Updateframe();
+      lv_disp_flush_ready(job.disp);    // release the buffer, LVGL may already be rendering into the other one
+    }
+  }
+}
+#endif // USE_LVGL_FLUSH_TASK
+
 /************************************************************
  * Main screen refresh function
  ************************************************************/
@@ -88,6 +126,20 @@ void lv_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color
     return; // ok
   }
 
+#ifdef USE_LVGL_FLUSH_TASK
+  // Hand the rendered area to the flush task and return without waiting; the send
+  // only blocks when a previous area is still in flight. Paint callbacks run Berry
+  // code and must stay on the main task, so fall back to the synchronous path then.
+  if (lvgl_glue->flush_task && nullptr == lvgl_glue->paint_cb) {
+    LVGL_FlushJob job;
+    job.disp = disp;
+    job.area = *area;
+    job.pixels = color_p;
+    xQueueSend(lvgl_glue->flush_queue, &job, portMAX_DELAY);
+    return;     // lv_disp_flush_ready() is called by the flush task
+  }
+#endif // USE_LVGL_FLUSH_TASK
+
   uint32_t pixels_len = width * height;
   uint32_t chrono_start = millis();
   renderer->setAddrWindow(area->x1, area->y1, area->x1+width, area->y1+height);
@@ -420,8 +472,14 @@ void start_lvgl(const char * uconfig) {
     if (0 == flushlines) flushlines = LV_BUFFER_ROWS;
 
     lvgl_buffer_size = renderer->width() * flushlines;
-    if (renderer->lvgl_pars()->use_dma) {
-      lvgl_buffer_size /= 2;
+    bool double_buffer = renderer->lvgl_pars()->use_dma;
+#ifdef USE_LVGL_FLUSH_TASK
+    double_buffer = true;     // the flush task needs a second buffer to render into while the first is pushed
+#endif // USE_LVGL_FLUSH_TASK
+    if (double_buffer) {
+      if (renderer->lvgl_pars()->use_dma) {
+        lvgl_buffer_size /= 2;
+      }
       if (lvgl_buffer_size < 1000000) {
         // allocate preferably in internal memory which is faster than PSRAM
         AddLog(LOG_LEVEL_DEBUG, "LVG: Allocating buffer2 %i bytes in main memory (flushlines %i)", (lvgl_buffer_size * (LV_COLOR_DEPTH / 8)) / 1024, flushlines);
@@ -468,6 +526,26 @@ void start_lvgl(const char * uconfig) {
   lv_indev_set_type(lvgl_glue->lv_indev, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(lvgl_glue->lv_indev, lvgl_touchscreen_read);
 
+#ifdef USE_LVGL_FLUSH_TASK
+  // Start the flush task; on failure keep flushing synchronously from the main task
+  lvgl_glue->flush_queue = xQueueCreate(1, sizeof(LVGL_FlushJob));
+  if (lvgl_glue->flush_queue) {
+#ifdef CORE32SOLO1
+    uint32_t flush_core = 0;
+#else
+    uint32_t flush_core = (xPortGetCoreID() == 0) ? 1 : 0;    // pin opposite to the Arduino loop core
+#endif
+    if (pdPASS != xTaskCreatePinnedToCore(lv_flush_task, "lvgl_flush", 2048, nullptr, 2, &lvgl_glue->flush_task, flush_core)) {
+      vQueueDelete(lvgl_glue->flush_queue);
+      lvgl_glue->flush_queue = nullptr;
+      lvgl_glue->flush_task = nullptr;
+      AddLog(LOG_LEVEL_ERROR, D_LOG_LVGL "Could not start flush task");
+    } else {
+      AddLog(LOG_LEVEL_DEBUG, D_LOG_LVGL "Flush task started on core %d", flush_core);
+    }
+  }
+#endif // USE_LVGL_FLUSH_TASK
+
   // ESP 32------------------------------------------------
   lvgl_glue->tick.attach_ms(lv_tick_interval_ms, lv_tick_handler);
   // -----------------------------------------
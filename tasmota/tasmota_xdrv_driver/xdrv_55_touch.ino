@@ -51,6 +51,7 @@ enum TS_Gesture {
   TS_Gest_Move_Right = 0x13,
   TS_Gest_Zoom_In = 0x20,
   TS_Gest_Zoom_Out = 0x21,
+  TS_Gest_Long_Press = 0x30,
 };
 
 typedef struct TSGlobal_t {
@@ -82,6 +83,47 @@ bool utouch_found = false;
 VButton *buttons[MAX_TOUCH_BUTTONS];
 #endif
 
+/*******************************************************************************************\
+ * IRQ driven sampling. With an interrupt pin registered the controller is only sampled
+ * after an edge and for a short tail while the finger is down - no bus traffic while the
+ * screen is untouched. Without an interrupt pin sampling stays at the 100ms poll rate
+\*******************************************************************************************/
+
+#ifndef TOUCH_RELEASE_TICKS
+#define TOUCH_RELEASE_TICKS 3     // keep sampling this many 100ms ticks after the last activity
+#endif
+
+volatile bool Touch_irq_pending = false;
+int8_t Touch_irq_pin = -1;
+uint8_t Touch_active_ticks = 0;
+
+void IRAM_ATTR TouchIsr(void) {
+  Touch_irq_pending = true;
+}
+
+void Touch_IrqInit(int8_t irq_pin) {
+  if ((irq_pin >= 0) && (Touch_irq_pin < 0)) {
+    Touch_irq_pin = irq_pin;
+    pinMode(irq_pin, INPUT_PULLUP);
+    attachInterrupt(irq_pin, TouchIsr, FALLING);
+    AddLog(LOG_LEVEL_INFO, PSTR("TS : using IRQ pin %d"), irq_pin);
+  }
+}
+
+bool Touch_CheckPending(void) {
+  if (Touch_irq_pin < 0) { return true; }
+  if (Touch_irq_pending) {
+    Touch_irq_pending = false;
+    Touch_active_ticks = TOUCH_RELEASE_TICKS;
+  }
+  if (!Touch_active_ticks) { return false; }
+  Touch_active_ticks--;
+  if (TSGlobal.touched) {
+    Touch_active_ticks = TOUCH_RELEASE_TICKS;   // finger still down, extend the tail to catch the release
+  }
+  return true;
+}
+
 void Touch_SetStatus(uint8_t touches, uint16_t raw_x, uint16_t raw_y, uint8_t gesture) {
   TSGlobal.external_ts = true;
   TSGlobal.gesture = gesture;
@@ -101,7 +143,7 @@ bool Touch_GetStatus(uint8_t* touches, uint16_t* x, uint16_t* y, uint8_t* gestur
     if (y)          { *y = TSGlobal.touch_yp; }
     if (raw_x)      { *raw_x = TSGlobal.raw_touch_xp; }
     if (raw_y)      { *raw_y = TSGlobal.raw_touch_yp; }
-    if (gesture)    { *touches = TSGlobal.gesture; }
+    if (gesture)    { *gesture = TSGlobal.gesture; }
     return true;
   }
   return false;
@@ -193,7 +235,7 @@ uint8_t CST816S_map_gesture(uint8_t gesture) {
     case 0x04: return TS_Gest_Move_Right; // SWIPE_RIGHT
     case 0x05: return TS_Gest_None;       // SINGLE_CLICK
     case 0x0B: return TS_Gest_None;       // DOUBLE_CLICK
-    case 0x0C: return TS_Gest_None;       // LONG_PRESS
+    case 0x0C: return TS_Gest_Long_Press; // LONG_PRESS
     default: return TS_Gest_None;         // NONE
   }
 }
@@ -287,6 +329,7 @@ bool FT5206_Touch_Init(TwoWire &i2c) {
   if (FT5206_touchp->begin(i2c, FT5206_address)) {
     AddLog(LOG_LEVEL_INFO, PSTR("UTI: FT5206 initialized"));
     FT5206_found = true;
+    Touch_IrqInit(Pin(GPIO_TS_IRQ));   // the FT5206 lib has no IRQ support, gate the polls here
   }
   //AddLog(LOG_LEVEL_INFO, PSTR("UTI: FT5206 %d"),FT5206_found);
   return FT5206_found;
@@ -323,6 +366,7 @@ bool GT911_Touch_Init(TwoWire *i2c, int8_t irq_pin, int8_t rst_pin, uint16_t xs,
 }
 
 void GT911_CheckTouch(void) {
+  if (!GT911_touchp->avaliable()) { return; }   // IRQ flag maintained by the lib, no I2C while untouched
   GT911_touchp->update();
   TSGlobal.touched = !GT911_touchp->isFingerUp();
   if (TSGlobal.touched) {
@@ -381,6 +425,56 @@ int16_t XPT2046_y() {
 }
 #endif  // USE_XPT2046
 
+#if defined(USE_FT5206) || defined(USE_GT911) || defined(USE_XPT2046) || defined(SIMPLE_RES_TOUCH)
+// Synthesize swipe and long press gestures from the raw points of controllers without
+// native gesture support, so consumers receive gestures instead of a point stream
+
+#ifndef TOUCH_SWIPE_PIXELS
+#define TOUCH_SWIPE_PIXELS 40     // minimum travel in raw pixels for a swipe
+#endif
+#ifndef TOUCH_LONGPRESS_MS
+#define TOUCH_LONGPRESS_MS 1000
+#endif
+
+void Touch_GestureDetect(void) {
+  static int16_t start_x, start_y;
+  static uint32_t start_time;
+  static bool in_progress = false;
+  static bool reported = false;
+
+  TSGlobal.gesture = TS_Gest_None;
+  int16_t dx = TSGlobal.raw_touch_xp - start_x;
+  int16_t dy = TSGlobal.raw_touch_yp - start_y;
+  if (TSGlobal.touched) {
+    if (!in_progress) {
+      in_progress = true;
+      reported = false;
+      start_x = TSGlobal.raw_touch_xp;
+      start_y = TSGlobal.raw_touch_yp;
+      start_time = millis();
+    }
+    else if (!reported && (abs(dx) < TOUCH_SWIPE_PIXELS) && (abs(dy) < TOUCH_SWIPE_PIXELS) &&
+             (millis() - start_time > TOUCH_LONGPRESS_MS)) {
+      TSGlobal.gesture = TS_Gest_Long_Press;
+      reported = true;
+    }
+  }
+  else if (in_progress) {
+    in_progress = false;
+    if (!reported) {
+      // classify the swipe on release along the dominant axis
+      if (abs(dx) >= abs(dy)) {
+        if (dx >= TOUCH_SWIPE_PIXELS) { TSGlobal.gesture = TS_Gest_Move_Right; }
+        else if (dx <= -TOUCH_SWIPE_PIXELS) { TSGlobal.gesture = TS_Gest_Move_Left; }
+      } else {
+        if (dy >= TOUCH_SWIPE_PIXELS) { TSGlobal.gesture = TS_Gest_Move_Down; }
+        else if (dy <= -TOUCH_SWIPE_PIXELS) { TSGlobal.gesture = TS_Gest_Move_Up; }
+      }
+    }
+  }
+}
+#endif  // USE_FT5206 || USE_GT911 || USE_XPT2046 || SIMPLE_RES_TOUCH
+
 void Touch_Check(void(*rotconvert)(int16_t *x, int16_t *y)) {
   static bool was_touched = false;    // flag used to log the data sent when the screen was just released
 
@@ -437,6 +531,12 @@ void Touch_Check(void(*rotconvert)(int16_t *x, int16_t *y)) {
   }
 #endif // USE_XPT2046
 
+#if defined(USE_FT5206) || defined(USE_GT911) || defined(USE_XPT2046) || defined(SIMPLE_RES_TOUCH)
+  if (FT5206_found || GT911_found || XPT2046_found || SRES_found) {
+    Touch_GestureDetect();
+  }
+#endif  // USE_FT5206 || USE_GT911 || USE_XPT2046 || SIMPLE_RES_TOUCH
+
   TSGlobal.touch_xp = TSGlobal.raw_touch_xp;
   TSGlobal.touch_yp = TSGlobal.raw_touch_yp;
 
@@ -598,7 +698,9 @@ bool Xdrv55(uint32_t function) {
       break;
     case FUNC_EVERY_100_MSECOND:
       if (CST816S_found || FT5206_found || XPT2046_found || GT911_found || utouch_found || SRES_found) {
-        Touch_Check(TS_RotConvert);
+        if (Touch_CheckPending()) {
+          Touch_Check(TS_RotConvert);
+        }
       }
       break;
     case FUNC_ACTIVE:
@@ -78,6 +78,15 @@
 #ifndef INFLUXDB_RP
 #define INFLUXDB_RP        ""            // [IfxRP] Influxdb v1 retention policy (blank is default, usually autogen infinite)
 #endif
+#ifndef INFLUXDB_BATCH_SIZE
+#define INFLUXDB_BATCH_SIZE 0            // Collect line protocol up to this many bytes before posting (0 = post every cycle)
+#endif
+#ifndef INFLUXDB_BATCH_FLUSH
+#define INFLUXDB_BATCH_FLUSH 60          // Post a non-empty batch after this many seconds even if not full
+#endif
+#ifndef INFLUXDB_SPOOL_SIZE
+#define INFLUXDB_SPOOL_SIZE 16384        // With filesystem, retain unsent data up to this many bytes and replay after an outage
+#endif
 
 static const char UninitializedMessage[] PROGMEM = "Unconfigured instance";
 // This cannot be put to PROGMEM due to the way how it is used
@@ -95,6 +104,8 @@ struct {
   String _serverUrl;                     // Connection info
   String _writeUrl;                      // Cached full write url
   String _lastErrorResponse;             // Server reponse or library error message for last failed request
+  String batch = "";                     // Collected line protocol awaiting a batched post
+  uint32_t batch_time = 0;               // Uptime second the oldest batched line was collected
   uint32_t _lastRequestTime = 0;         // Last time in ms we made a request to server
   int interval = 0;
   int _lastStatusCode = 0;               // HTTP status code of last request to server
@@ -141,6 +152,8 @@ bool InfluxDbParameterInit(void) {
   }
   if (!InfluxDbHostByName()) { return false; }
 
+  IFDB._connectionReuse = (INFLUXDB_BATCH_SIZE > 0);  // Keep the connection alive between batched posts
+
   IFDB._writeUrl = IFDB._serverUrl;
   if (2 == Settings->influxdb_version) {
     IFDB._writeUrl += "/api/v2/write?org=";
@@ -283,6 +296,128 @@ int InfluxDbPostData(const char *data) {
   return IFDB._lastStatusCode;
 }
 
+/*********************************************************************************************\
+ * Batching and spooling
+\*********************************************************************************************/
+
+#ifdef USE_UFILESYS
+const char INFLUXDB_SPOOL_FILE[] PROGMEM = "/ifx.spool";
+
+void InfluxDbSpool(const char *data) {
+  // Retain unsent line protocol on the filesystem for replay once the server is reachable again
+  if (!ffsp) { return; }
+  char filename[16];
+  strcpy_P(filename, INFLUXDB_SPOOL_FILE);
+  File file = ffsp->open(filename, "a");
+  if (!file) { return; }
+  size_t len = strlen(data);
+  if (file.size() + len + 1 <= INFLUXDB_SPOOL_SIZE) {
+    file.write((const uint8_t*)data, len);
+    file.write((const uint8_t*)"\n", 1);
+  } else {
+    AddLog(LOG_LEVEL_INFO, PSTR("IFX: Spool full, dropping %d bytes"), len);
+  }
+  file.close();
+}
+
+void InfluxDbSpoolReplay(void) {
+  // Replay spooled line protocol oldest first, keeping whatever could not be posted
+  if (!ffsp) { return; }
+  char filename[16];
+  strcpy_P(filename, INFLUXDB_SPOOL_FILE);
+  if (!ffsp->exists(filename)) { return; }
+  File file = ffsp->open(filename, "r");
+  if (!file) { return; }
+  size_t size = file.size();
+  char *spool = (char*)special_malloc(size + 1);
+  if (nullptr == spool) {
+    file.close();
+    return;
+  }
+  size = file.read((uint8_t*)spool, size);
+  spool[size] = '\0';
+  file.close();
+
+  uint32_t limit = (INFLUXDB_BATCH_SIZE > 0) ? INFLUXDB_BATCH_SIZE : 1024;
+  char *p = spool;
+  while (*p) {
+    // Post whole lines up to one batch per request
+    size_t chunk = strlen(p);
+    if (chunk > limit) {
+      size_t cut = limit;
+      while (cut && ('\n' != p[cut - 1])) { cut--; }
+      if (0 == cut) {                    // Single line longer than a batch
+        char *nl = (char*)strchr(p + limit, '\n');
+        cut = (nl) ? (nl - p) + 1 : chunk;
+      }
+      chunk = cut;
+    }
+    char saved = p[chunk];
+    p[chunk] = '\0';
+    int status = InfluxDbPostData(p);    // Trims the trailing \n in place which is fine here
+    p[chunk] = saved;
+    if (204 != status) { break; }
+    p += chunk;
+  }
+
+  if (*p) {
+    File out = ffsp->open(filename, "w");  // Rewrite the unposted tail as the new spool
+    if (out) {
+      out.write((uint8_t*)p, strlen(p));
+      out.close();
+    }
+  } else {
+    ffsp->remove(filename);
+  }
+  free(spool);
+}
+#endif  // USE_UFILESYS
+
+void InfluxDbFlush(void) {
+  if (0 == IFDB.batch.length()) { return; }
+  if (TasmotaGlobal.global_state.network_down) {
+#ifdef USE_UFILESYS
+    InfluxDbSpool(IFDB.batch.c_str());
+    IFDB.batch = "";
+#endif  // USE_UFILESYS
+    return;
+  }
+  if (204 == InfluxDbPostData(IFDB.batch.c_str())) {
+    IFDB.batch = "";
+#ifdef USE_UFILESYS
+    InfluxDbSpoolReplay();               // Server reachable so drain any spooled backlog
+#endif  // USE_UFILESYS
+  } else {
+#ifdef USE_UFILESYS
+    InfluxDbSpool(IFDB.batch.c_str());   // Retain across the outage, replayed after the next successful post
+    IFDB.batch = "";
+#else
+    // No filesystem so retry from memory next flush. PostData trimmed the trailing \n in place
+    // leaving an embedded terminator, restore it before more lines are appended
+    IFDB.batch.setCharAt(IFDB.batch.length() -1, '\n');
+    while (IFDB.batch.length() > (INFLUXDB_BATCH_SIZE * 2)) {  // Cap memory by dropping oldest lines
+      int nl = IFDB.batch.indexOf('\n');
+      if (nl < 0) {
+        IFDB.batch = "";
+        break;
+      }
+      IFDB.batch.remove(0, nl +1);
+    }
+#endif  // USE_UFILESYS
+  }
+}
+
+void InfluxDbWrite(const char *data) {
+  // Collect line protocol and post in batches to reduce connection and request overhead
+  if (0 == IFDB.batch.length()) {
+    IFDB.batch_time = TasmotaGlobal.uptime;
+  }
+  IFDB.batch += data;
+  if (IFDB.batch.length() >= INFLUXDB_BATCH_SIZE) {  // Default batch size 0 posts every cycle
+    InfluxDbFlush();
+  }
+}
+
 /*********************************************************************************************\
  * Data preparation
 \*********************************************************************************************/
@@ -407,7 +542,7 @@ void InfluxDbProcessJson(bool use_copy = false) {
     }
     if (data.length() > 0 ) {
 //      AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Sensor data:\n%s"), data.c_str());
-      InfluxDbPostData(data.c_str());
+      InfluxDbWrite(data.c_str());
     }
   }
 
@@ -458,6 +593,9 @@ void InfluxDbLoop(void) {
 
       }
     }
+    if (IFDB.batch.length() && ((TasmotaGlobal.uptime - IFDB.batch_time) >= INFLUXDB_BATCH_FLUSH)) {
+      InfluxDbFlush();                   // Age out a partial batch
+    }
   }
 }
 
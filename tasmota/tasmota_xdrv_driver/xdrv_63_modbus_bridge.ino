@@ -52,10 +52,21 @@
 #define MBR_MAX_REGISTERS 64
 #define MBR_RECEIVE_BUFFER_SIZE (MBR_MAX_REGISTERS * 2) + 9 // Addres(1), Function(1), Length(1) or StartAddress(2), N/A or Number of addresses(2),Data(1..n), CRC(2)
 
+#ifndef MBR_SEND_QUEUE_SIZE
+#define MBR_SEND_QUEUE_SIZE 8    // Number of ModbusSend commands that can wait for the bus
+#endif
+#ifndef MBR_CACHE_ENTRIES
+#define MBR_CACHE_ENTRIES 4      // Number of distinct read responses kept in the cache
+#endif
+#ifndef MBR_CACHE_TTL_MS
+#define MBR_CACHE_TTL_MS 0       // [ModbusCacheTime] Default time in ms identical reads are served from cache (0 = disabled)
+#endif
+
 #define D_CMND_MODBUS_SEND "Send"
 #define D_CMND_MODBUS_SETBAUDRATE "Baudrate"
 #define D_CMND_MODBUS_SETSERIALCONFIG "SerialConfig"
 #define D_CMND_MODBUS_SETSERIALTIMEOUT "SerialTimeout"
+#define D_CMND_MODBUS_SETCACHETIME "CacheTime"
 
 #define D_JSON_MODBUS_RECEIVED "ModbusReceived"
 #define D_JSON_MODBUS_DEVICE_ADDRESS "DeviceAddress"
@@ -69,10 +80,10 @@
 
 #ifndef USE_MODBUS_BRIDGE_TCP
 const char kModbusBridgeCommands[] PROGMEM = "Modbus|" // Prefix
-    D_CMND_MODBUS_SEND "|" D_CMND_MODBUS_SETBAUDRATE "|" D_CMND_MODBUS_SETSERIALCONFIG "|" D_CMND_MODBUS_SETSERIALTIMEOUT;
+    D_CMND_MODBUS_SEND "|" D_CMND_MODBUS_SETBAUDRATE "|" D_CMND_MODBUS_SETSERIALCONFIG "|" D_CMND_MODBUS_SETSERIALTIMEOUT "|" D_CMND_MODBUS_SETCACHETIME;
 
 void (*const ModbusBridgeCommand[])(void) PROGMEM = {
-    &CmndModbusBridgeSend, &CmndModbusBridgeSetBaudrate, &CmndModbusBridgeSetConfig, &CmndModbusBridgeSetTimeout};
+    &CmndModbusBridgeSend, &CmndModbusBridgeSetBaudrate, &CmndModbusBridgeSetConfig, &CmndModbusBridgeSetTimeout, &CmndModbusBridgeSetCacheTime};
 #endif
 
 #ifdef USE_MODBUS_BRIDGE_TCP
@@ -85,11 +96,11 @@ void (*const ModbusBridgeCommand[])(void) PROGMEM = {
 #define D_CMND_MODBUS_TCP_MQTT "TCPMqtt"
 
 const char kModbusBridgeCommands[] PROGMEM = "Modbus|" // Prefix
-    D_CMND_MODBUS_TCP_START "|" D_CMND_MODBUS_TCP_CONNECT "|" D_CMND_MODBUS_TCP_MQTT "|" D_CMND_MODBUS_SEND "|" D_CMND_MODBUS_SETBAUDRATE "|" D_CMND_MODBUS_SETSERIALCONFIG "|" D_CMND_MODBUS_SETSERIALTIMEOUT;
+    D_CMND_MODBUS_TCP_START "|" D_CMND_MODBUS_TCP_CONNECT "|" D_CMND_MODBUS_TCP_MQTT "|" D_CMND_MODBUS_SEND "|" D_CMND_MODBUS_SETBAUDRATE "|" D_CMND_MODBUS_SETSERIALCONFIG "|" D_CMND_MODBUS_SETSERIALTIMEOUT "|" D_CMND_MODBUS_SETCACHETIME;
 
 void (*const ModbusBridgeCommand[])(void) PROGMEM = {
     &CmndModbusTCPStart, &CmndModbusTCPConnect, &CmndModbusTCPMqtt,
-    &CmndModbusBridgeSend, &CmndModbusBridgeSetBaudrate, &CmndModbusBridgeSetConfig, &CmndModbusBridgeSetTimeout};
+    &CmndModbusBridgeSend, &CmndModbusBridgeSetBaudrate, &CmndModbusBridgeSetConfig, &CmndModbusBridgeSetTimeout, &CmndModbusBridgeSetCacheTime};
 
 struct ModbusBridgeTCP
 {
@@ -182,10 +193,15 @@ struct ModbusBridge
   uint8_t *buffer = nullptr;    // Buffer for storing read / write data
   bool enabled = false;
 
-  // Buffer to store command data received from CmndModbusBridgeSend()
-  char *command_data = nullptr;
+  uint32_t cache_ttl_ms = MBR_CACHE_TTL_MS;  // [ModbusCacheTime] How long identical reads are served from cache
+  uint32_t cache_key = 0;                    // Cache key of the read request currently on the bus
 
 private:
+  // FIFO of commands received from CmndModbusBridgeSend() while the bus is busy
+  char *send_queue[MBR_SEND_QUEUE_SIZE] = { nullptr };
+  uint8_t send_queue_head = 0;
+  uint8_t send_queue_count = 0;
+
   // Timeout in [ms]. How long we will wait for Modbus response.
   uint32_t modbusSerialTimeout_ms = MODBUS_SERIAL_TIMEOUT_MS;
   // Holds the value of millis() after we set
@@ -224,6 +240,37 @@ public:
 
     return (t1 > modbusSerialTimeout_ms) ? true : false;
   }
+
+  bool sendQueueIsEmpty() const
+  {
+    return send_queue_count == 0;
+  }
+
+  bool sendQueuePush(const char *data, uint32_t len)
+  {
+    if (send_queue_count == MBR_SEND_QUEUE_SIZE)
+      return false;
+    char *copy = (char *)malloc(len + 1);
+    if (nullptr == copy)
+      return false;
+    memcpy(copy, data, len);
+    copy[len] = '\0';
+    send_queue[(send_queue_head + send_queue_count) % MBR_SEND_QUEUE_SIZE] = copy;
+    send_queue_count++;
+    return true;
+  }
+
+  // Returns the oldest queued command or nullptr. Caller must free the result.
+  char *sendQueuePop()
+  {
+    if (send_queue_count == 0)
+      return nullptr;
+    char *data = send_queue[send_queue_head];
+    send_queue[send_queue_head] = nullptr;
+    send_queue_head = (send_queue_head + 1) % MBR_SEND_QUEUE_SIZE;
+    send_queue_count--;
+    return data;
+  }
 };
 
 ModbusBridge modbusBridge;
@@ -242,6 +289,86 @@ void ModbusBridgeAllocError(const char* s)
   AddLog(LOG_LEVEL_ERROR, PSTR("MBS: could not allocate %s buffer"), s);
 }
 
+/********************************************************************************************/
+//
+// Short lived cache of published read responses. Multiple pollers requesting the same
+// registers within [ModbusCacheTime] ms share one bus transaction.
+//
+struct ModbusBridgeCacheEntry
+{
+  uint32_t key = 0;        // Hash of the request parameters
+  uint32_t time_ms = 0;    // millis() when the response was stored
+  char *payload = nullptr; // Published ModbusReceived JSON
+};
+
+ModbusBridgeCacheEntry modbusBridgeCache[MBR_CACHE_ENTRIES];
+
+// Hash of the request parameters currently held by modbusBridge
+uint32_t ModbusBridgeCacheKey(void)
+{
+  char key[32];
+  snprintf_P(key, sizeof(key), PSTR("%d|%d|%d|%d|%d|%d"),
+    modbusBridge.deviceAddress, (uint8_t)modbusBridge.functionCode, modbusBridge.startAddress,
+    modbusBridge.count, (uint8_t)modbusBridge.type, (uint8_t)modbusBridge.endian);
+  return GetHash(key, strlen(key));
+}
+
+const char *ModbusBridgeCacheGet(uint32_t key)
+{
+  if (0 == modbusBridge.cache_ttl_ms)
+    return nullptr;
+  for (uint32_t i = 0; i < MBR_CACHE_ENTRIES; i++)
+  {
+    if ((modbusBridgeCache[i].key == key) && (modbusBridgeCache[i].payload != nullptr) &&
+        (millis() - modbusBridgeCache[i].time_ms <= modbusBridge.cache_ttl_ms))
+      return modbusBridgeCache[i].payload;
+  }
+  return nullptr;
+}
+
+// Store the response currently in the response buffer for the read on the bus,
+// replacing a matching or the oldest entry
+void ModbusBridgeCacheStore(void)
+{
+  if ((0 == modbusBridge.cache_ttl_ms) || (0 == modbusBridge.cache_key))
+    return;
+  uint32_t oldest = 0;
+  for (uint32_t i = 0; i < MBR_CACHE_ENTRIES; i++)
+  {
+    if (modbusBridgeCache[i].key == modbusBridge.cache_key)
+    {
+      oldest = i;
+      break;
+    }
+    if (millis() - modbusBridgeCache[i].time_ms > millis() - modbusBridgeCache[oldest].time_ms)
+      oldest = i;
+  }
+  ModbusBridgeCacheEntry &entry = modbusBridgeCache[oldest];
+  free(entry.payload);
+  entry.payload = (char *)malloc(strlen(ResponseData()) + 1);
+  if (nullptr == entry.payload)
+  {
+    entry.key = 0;
+    modbusBridge.cache_key = 0;
+    return;
+  }
+  strcpy(entry.payload, ResponseData());
+  entry.key = modbusBridge.cache_key;
+  entry.time_ms = millis();
+  modbusBridge.cache_key = 0;
+}
+
+// Drop all cached responses, used when a write may change cached registers
+void ModbusBridgeCacheFlush(void)
+{
+  for (uint32_t i = 0; i < MBR_CACHE_ENTRIES; i++)
+  {
+    free(modbusBridgeCache[i].payload);
+    modbusBridgeCache[i].payload = nullptr;
+    modbusBridgeCache[i].key = 0;
+  }
+}
+
 /********************************************************************************************/
 //
 // Applies serial configuration to modbus serial port
@@ -645,6 +772,10 @@ void ModbusBridgeHandle(void)
       else
         errorcode = ModbusBridgeError::wrongfunctioncode;
     }
+    if ((errorcode == ModbusBridgeError::noerror) && ((uint8_t)modbusBridge.functionCode <= 4))
+    {
+      ModbusBridgeCacheStore(); // Keep the published read response for identical requests
+    }
     if (errorcode != ModbusBridgeError::noerror)
     {
       AddLog(LOG_LEVEL_DEBUG, PSTR("MBS: MBR Recv Error %d"), (uint8_t)errorcode);
@@ -813,6 +944,7 @@ void ModbusTCPHandle(void)
         AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("MBS: MBRTCP to Modbus TransactionId:%d, deviceAddress:%d, functionCode:%d, startAddress:%d, count:%d, recvCount:%d, recvBytes:%d"),
                modbusBridgeTCP.tcp_transaction_id, mbdeviceaddress, mbfunctioncode, mbstartaddress, count, modbusBridge.dataCount, modbusBridge.byteCount);
 
+        modbusBridge.cache_key = 0; // TCP responses are not cached
         if (modbusBridgeModbus->Send(mbdeviceaddress, mbfunctioncode, mbstartaddress, count, writeData) == 0)
         {
           modbusBridge.setWaitingForAnswerFromSerial(true);
@@ -840,43 +972,18 @@ void ModbusTCPHandle(void)
 
 void CmndModbusBridgeSend(void)
 {
-  if (!modbusBridge.isWaitingForAnswerFromSerial())
+  if (!modbusBridge.isWaitingForAnswerFromSerial() && modbusBridge.sendQueueIsEmpty())
   {
-    if (modbusBridge.command_data == nullptr)
-    {
-      CmndModbusBridgeSend(XdrvMailbox.data);
-      return;
-    }
-    else
-    {
-      // There is already a command pending
-      ResponseCmndFailed();
-      return;
-    }
+    CmndModbusBridgeSend(XdrvMailbox.data);
+    return;
   }
-  else
+  // The bus is busy, queue the command for transmission from the main loop
+  if (!modbusBridge.sendQueuePush(XdrvMailbox.data, XdrvMailbox.data_len))
   {
-    if (modbusBridge.command_data == nullptr)
-    {
-      // Let's store the command data
-      modbusBridge.command_data = (char *)malloc(XdrvMailbox.data_len);
-
-      if (modbusBridge.command_data == nullptr)
-      {
-        // We couldn't store the command data.
-        ModbusBridgeAllocError(PSTR("COMMAND"));
-        ResponseCmndFailed();
-        return;
-      }
-
-      memcpy(modbusBridge.command_data, XdrvMailbox.data, XdrvMailbox.data_len);
-    }
-    else
-    {
-        // We're processing a command and yet another is waiting.
-        ResponseCmndFailed();
-        return;
-    }
+    // Queue full or out of memory
+    ModbusBridgeAllocError(PSTR("COMMAND"));
+    ResponseCmndFailed();
+    return;
   }
 }
 
@@ -1134,6 +1241,32 @@ void CmndModbusBridgeSend(char *json_in)
   if ((modbusBridge.functionCode == ModbusBridgeFunctionCode::mb_writeSingleCoil) || (modbusBridge.functionCode == ModbusBridgeFunctionCode::mb_writeSingleRegister))
     modbusBridge.dataCount = 1;
 
+  modbusBridge.cache_key = 0;
+  if ((uint8_t)modbusBridge.functionCode <= 4)
+  {
+    // Serve identical read requests from the short lived response cache
+    uint32_t key = ModbusBridgeCacheKey();
+    const char *payload = ModbusBridgeCacheGet(key);
+    if (payload != nullptr)
+    {
+      free(writeData);
+      Response_P(PSTR("%s"), payload);
+      if (Settings->flag6.mqtt_disable_modbus) {  // SetOption158  If it is activated, Tasmota will not publish ModbusReceived MQTT messages, but it will proccess event trigger rules
+        XdrvRulesProcess(0);
+      } else {
+        MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_MODBUS_RECEIVED));
+      }
+      modbusBridge.deviceAddress = 0;
+      ResponseCmndDone();
+      return;
+    }
+    modbusBridge.cache_key = key;
+  }
+  else
+  {
+    ModbusBridgeCacheFlush(); // Writes may change registers held in the cache
+  }
+
   uint8_t error = modbusBridgeModbus->Send(modbusBridge.deviceAddress, (uint8_t)modbusBridge.functionCode, modbusBridge.startAddress, modbusBridge.dataCount, writeData);
   free(writeData);
 
@@ -1197,6 +1330,21 @@ void CmndModbusBridgeSetTimeout(void)
   ResponseCmndNumber(modbusBridge.getModbusSerialTimeout_ms());
 }
 
+void CmndModbusBridgeSetCacheTime(void)
+{
+  // Time in ms identical read requests are answered from the response cache, 0 disables the cache
+  if (XdrvMailbox.data_len > 0)
+  {
+    modbusBridge.cache_ttl_ms = XdrvMailbox.payload;
+    if (0 == modbusBridge.cache_ttl_ms)
+    {
+      ModbusBridgeCacheFlush();
+    }
+  }
+
+  ResponseCmndNumber(modbusBridge.cache_ttl_ms);
+}
+
 #ifdef USE_MODBUS_BRIDGE_TCP
 //
 // Command `TCPStart`
@@ -1316,11 +1464,12 @@ bool Xdrv63(uint32_t function)
       case FUNC_LOOP:
         ModbusBridgeHandle();
 
-        // Check whether we can send a stored command
-        if (modbusBridge.command_data && !modbusBridge.isWaitingForAnswerFromSerial())
+        // Check whether we can send a queued command
+        if (!modbusBridge.sendQueueIsEmpty() && !modbusBridge.isWaitingForAnswerFromSerial())
         {
-          CmndModbusBridgeSend(modbusBridge.command_data);
-          free(modbusBridge.command_data), modbusBridge.command_data = nullptr;
+          char *command_data = modbusBridge.sendQueuePop();
+          CmndModbusBridgeSend(command_data);
+          free(command_data);
         }
 
 #ifdef USE_MODBUS_BRIDGE_TCP
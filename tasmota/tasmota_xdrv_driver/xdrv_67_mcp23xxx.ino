@@ -865,6 +865,7 @@ bool Xdrv67(uint32_t function) {
         if (!Mcp23x.interrupt) { return false; }
         AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("MCP: Interrupt"));
         MCP23xServiceInput();
+        SleepRequestWake(1);             // Keep per-millisecond cadence while edges are arriving
         break;
       case FUNC_EVERY_100_MSECOND:
         if (Mcp23x.button_max || Mcp23x.switch_max) {
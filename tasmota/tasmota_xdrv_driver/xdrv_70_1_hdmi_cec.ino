@@ -344,6 +344,7 @@ bool Xdrv70(uint32_t function)
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         HDMI_CEC_device->run();
+        SleepRequestWake(1);             // CEC bus timing needs service every millisecond
         break;
       case FUNC_COMMAND:
         result = DecodeCommand(kHDMICommands, HDMICommand);
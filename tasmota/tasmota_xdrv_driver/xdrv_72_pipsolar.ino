@@ -1029,6 +1029,7 @@ bool Xdrv72(uint32_t function)
     case FUNC_LOOP:
     case FUNC_SLEEP_LOOP:
       PIPSOLARInput();
+      SleepRequestWake(1);               // Drain the inverter uart every millisecond to prevent buffer overrun
       break;
     case FUNC_EVERY_50_MSECOND:
       break;
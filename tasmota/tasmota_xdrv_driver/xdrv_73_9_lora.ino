@@ -466,6 +466,7 @@ bool Xdrv73(uint32_t function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         LoraInput();
+        SleepRequestWake(1);             // Poll the radio for received packets every millisecond
         break;
       case FUNC_RESET_SETTINGS:
         LoraSettingsLoad(1);
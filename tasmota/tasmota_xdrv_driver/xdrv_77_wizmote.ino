@@ -336,6 +336,7 @@ bool Xdrv77(uint32_t function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         WizMoteResponse();
+        SleepRequestWake(1);             // Respond to received remote data every millisecond
         break;
       case FUNC_ACTIVE:
         result = true;
@@ -486,6 +486,23 @@ std::vector<String> bleFilterNames;
 int minRSSI = -100;
 #endif
 
+// native advertisement prefilter - applied at the top of the scan callback
+// before any payload parsing or downstream callback, so uninteresting
+// advertisers cost almost nothing.  unlike the compile-time name/rssi
+// filters above this is always built and configured at runtime.
+#define BLE_PREFILTER_MAX_MACS 8
+struct {
+  uint8_t mac[BLE_PREFILTER_MAX_MACS][6]; // MAC allowlist, most significant byte first
+  uint8_t maclen[BLE_PREFILTER_MAX_MACS]; // compare length in bytes - < 6 is a prefix match
+  uint8_t maccount;
+  uint16_t uuid;              // 16 bit service (data) UUID required, 0 = off
+  int rssifloor;              // drop adverts weaker than this, -128 = off
+  // per-filter drop counters
+  uint32_t macdrops;
+  uint32_t uuiddrops;
+  uint32_t rssidrops;
+} BLEPreFilter = { {{0}}, {0}, 0, 0, -128, 0, 0, 0 };
+
 /*********************************************************************************************\
  * constants
 \*********************************************************************************************/
@@ -493,7 +510,7 @@ int minRSSI = -100;
 #define D_CMND_BLE "BLE"
 
 const char kBLE_Commands[] PROGMEM = D_CMND_BLE "|"
-  "Period|Adv|Op|Mode|Details|Scan|Alias|Name|Debug|Devices|MaxAge|AddrFilter|EnableUnsaved|FilterNames|MinRssiLevel";
+  "Period|Adv|Op|Mode|Details|Scan|Alias|Name|Debug|Devices|MaxAge|AddrFilter|EnableUnsaved|FilterNames|MinRssiLevel|PreFilter";
 
 static void CmndBLEPeriod(void);
 static void CmndBLEAdv(void);
@@ -510,6 +527,7 @@ static void CmndBLEAddrFilter(void);
 static void CmndBLEEnableUnsaved(void);
 static void CmndBleFilterNames(void);
 static void CmndSetMinRSSI(void);
+static void CmndBLEPreFilter(void);
 
 void (*const BLE_Commands[])(void) PROGMEM = {
   &BLE_ESP32::CmndBLEPeriod,
@@ -526,7 +544,8 @@ void (*const BLE_Commands[])(void) PROGMEM = {
   &BLE_ESP32::CmndBLEAddrFilter,
   &BLE_ESP32::CmndBLEEnableUnsaved,
   &BLE_ESP32::CmndBleFilterNames,
-  &BLE_ESP32::CmndSetMinRSSI
+  &BLE_ESP32::CmndSetMinRSSI,
+  &BLE_ESP32::CmndBLEPreFilter
 };
 
 const char *successStates[] PROGMEM = {
@@ -1164,6 +1183,57 @@ bool isDeviceInFilter(const String& deviceName) {
 }
 #endif
 
+/**
+ * @brief true if the advertisement carries the 16 bit UUID in its
+ * service or service data fields
+ */
+static bool advertHasUUID(NimBLEAdvertisedDevice *advertisedDevice, uint16_t uuid){
+  NimBLEUUID wanted(uuid);
+  if (advertisedDevice->isAdvertisingService(wanted)) return true;
+  int svcdataCount = advertisedDevice->getServiceDataCount();
+  for (int i = 0; i < svcdataCount; i++){
+    if (advertisedDevice->getServiceDataUUID(i) == wanted) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief runtime prefilter, called at the top of the scan callback before
+ * any payload parsing or downstream callback.  cheapest checks run first.
+ * returns true if the advertisement should be dropped.
+ */
+bool prefilterAdvertisment(NimBLEAdvertisedDevice *advertisedDevice){
+  if (BLEPreFilter.rssifloor > -128){
+    if (advertisedDevice->getRSSI() < BLEPreFilter.rssifloor){
+      BLEPreFilter.rssidrops++;
+      return true;
+    }
+  }
+  if (BLEPreFilter.maccount){
+    uint8_t addr[6];
+    memcpy(addr, advertisedDevice->getAddress().getNative(), 6);
+    ReverseMAC(addr);
+    bool allowed = false;
+    for (int i = 0; i < BLEPreFilter.maccount; i++){
+      if (!memcmp(addr, BLEPreFilter.mac[i], BLEPreFilter.maclen[i])){
+        allowed = true;
+        break;
+      }
+    }
+    if (!allowed){
+      BLEPreFilter.macdrops++;
+      return true;
+    }
+  }
+  if (BLEPreFilter.uuid){
+    if (!advertHasUUID(advertisedDevice, BLEPreFilter.uuid)){
+      BLEPreFilter.uuiddrops++;
+      return true;
+    }
+  }
+  return false;
+}
+
 /*********************************************************************************************\
  * Advertisment details
 \*********************************************************************************************/
@@ -1376,6 +1446,11 @@ class BLEAdvCallbacks: public NimBLEScanCallbacks {
     uint64_t now = esp_timer_get_time();
     BLEScanLastAdvertismentAt = now; // note the time of the last advertisment
 
+    // drop uninteresting advertisers before any parsing or copying
+    if (prefilterAdvertisment(advertisedDevice)){
+      return;
+    }
+
     uint32_t totalCount = BLEAdvertisment.totalCount;
     memset(&BLEAdvertisment, 0, sizeof(BLEAdvertisment));
     BLEAdvertisment.totalCount = totalCount+1;
@@ -2926,14 +3001,69 @@ void CmndBleFilterNames(void) {
 }
 
 void CmndSetMinRSSI(void) {
-#ifdef BLE_ESP32_FILTER_BY_RSSI  
+#ifdef BLE_ESP32_FILTER_BY_RSSI
   if (XdrvMailbox.data_len) {
     minRSSI = atoi(XdrvMailbox.data);
-  } 
+  }
   Response_P(PSTR("{\"MinRSSI\":\"%d\"}"), minRSSI);
 #endif
 }
 
+//////////////////////////////////////////////////////////////
+// Native advertisement prefilter
+// BLEPreFilter0 -> clear all prefilters and drop counters
+// BLEPreFilter1 mac[,mac..] -> set MAC allowlist.  fewer than 12 hex digits = prefix match
+// BLEPreFilter2 uuid -> require a 16 bit service (data) UUID, e.g. fe95.  0 to clear
+// BLEPreFilter3 rssi -> drop adverts weaker than this, e.g. -70.  0 to clear
+// always responds with the active filters and per-filter drop counters
+void CmndBLEPreFilter(void){
+  switch(XdrvMailbox.index){
+    case 0:{
+      memset(&BLEPreFilter, 0, sizeof(BLEPreFilter));
+      BLEPreFilter.rssifloor = -128;
+    } break;
+    case 1:{
+      if (XdrvMailbox.data_len) {
+        BLEPreFilter.maccount = 0;
+        char *p = strtok(XdrvMailbox.data, " ,");
+        while (p && (BLEPreFilter.maccount < BLE_PREFILTER_MAX_MACS)){
+          int len = fromHex(BLEPreFilter.mac[BLEPreFilter.maccount], p, 6);
+          if (!len){
+            AddLog(LOG_LEVEL_ERROR,PSTR("BLE: PreFilter invalid mac %s"), p);
+          } else {
+            BLEPreFilter.maclen[BLEPreFilter.maccount] = len;
+            BLEPreFilter.maccount++;
+          }
+          p = strtok(nullptr, " ,");
+        }
+      }
+    } break;
+    case 2:{
+      if (XdrvMailbox.data_len) {
+        BLEPreFilter.uuid = strtol(XdrvMailbox.data, nullptr, 16);
+      }
+    } break;
+    case 3:{
+      if (XdrvMailbox.data_len) {
+        BLEPreFilter.rssifloor = atoi(XdrvMailbox.data);
+        if (!BLEPreFilter.rssifloor) BLEPreFilter.rssifloor = -128;
+      }
+    } break;
+  }
+
+  char macs[BLE_PREFILTER_MAX_MACS*14];
+  macs[0] = 0;
+  char *m = macs;
+  for (int i = 0; i < BLEPreFilter.maccount; i++){
+    if (i) *(m++) = ',';
+    dump(m, 14, BLEPreFilter.mac[i], BLEPreFilter.maclen[i]);
+    m += strlen(m);
+  }
+  Response_P(PSTR("{\"BLEPreFilter\":{\"MAC\":\"%s\",\"UUID\":\"%04x\",\"RSSI\":%d,\"Drops\":{\"MAC\":%u,\"UUID\":%u,\"RSSI\":%u}}}"),
+    macs, BLEPreFilter.uuid, (BLEPreFilter.rssifloor > -128) ? BLEPreFilter.rssifloor : 0,
+    BLEPreFilter.macdrops, BLEPreFilter.uuiddrops, BLEPreFilter.rssidrops);
+}
+
 void CmndBLEAlias(void){
 #ifdef BLE_ESP32_ALIASES
   int op = XdrvMailbox.index;
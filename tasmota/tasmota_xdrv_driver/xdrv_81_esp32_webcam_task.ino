@@ -291,6 +291,50 @@ bool HttpCheckPriviledgedAccess(bool);
 extern ESP8266WebServer *Webserver;
 
 SemaphoreHandle_t WebcamMutex = nullptr;
+// serializes access to the client lists between the main loop and the stream task,
+// WITHOUT involving the capture task - always take BEFORE WebcamMutex when both are needed
+SemaphoreHandle_t WebcamClientMutex = nullptr;
+
+/*********************************************************************************************\
+ * Reference counted camera frames
+ *
+ * A frame stays in the camera driver pool while any consumer still holds a reference
+ * and is returned with esp_camera_fb_return() when the last reference is released.
+ * This lets the capture task hand frames to the stream task by pointer instead of
+ * copying them or waiting for slow network clients.
+\*********************************************************************************************/
+
+typedef struct {
+  camera_fb_t *fb;
+  volatile int8_t refcnt;
+} wc_frame;
+
+static portMUX_TYPE WcFrameMux = portMUX_INITIALIZER_UNLOCKED;
+
+static wc_frame *WcFrameWrap(camera_fb_t *fb){
+  wc_frame *frame = (wc_frame *)malloc(sizeof(wc_frame));
+  if (frame){
+    frame->fb = fb;
+    frame->refcnt = 1;
+  }
+  return frame;
+}
+
+static void WcFrameRef(wc_frame *frame){
+  portENTER_CRITICAL(&WcFrameMux);
+  frame->refcnt++;
+  portEXIT_CRITICAL(&WcFrameMux);
+}
+
+static void WcFrameRelease(wc_frame *frame){
+  portENTER_CRITICAL(&WcFrameMux);
+  int8_t left = --frame->refcnt;
+  portEXIT_CRITICAL(&WcFrameMux);
+  if (!left){
+    esp_camera_fb_return(frame->fb);
+    free(frame);
+  }
+}
 
 
 
@@ -353,9 +397,11 @@ struct PICSTORE {
 class localOV2640Streamer : public CStreamer {
     BufPtr f_ptr; // temp pointer to frame buffer
     int f_len;
+    const ParsedJPEG *f_parsed; // frame parsed once by the caller, shared by all sessions
 public:
     localOV2640Streamer(SOCKET aClient, int width, int height);
     void setframe(BufPtr ptr, int len);
+    void setframe(const ParsedJPEG *parsed);
     void clearframe();
     virtual void    streamImage(uint32_t curMsec);
 };
@@ -370,11 +416,19 @@ void localOV2640Streamer::setframe(BufPtr ptr, int len) {
   f_ptr = ptr;
   f_len = len;
 }
+void localOV2640Streamer::setframe(const ParsedJPEG *parsed) {
+  f_parsed = parsed;
+}
 void localOV2640Streamer::clearframe() {
   f_ptr = nullptr;
   f_len = 0;
+  f_parsed = nullptr;
 }
 void localOV2640Streamer::streamImage(uint32_t curMsec){
+  if (f_parsed) {   // jpeg was parsed once for all sessions
+    streamFrame(*f_parsed, curMsec);
+    return;
+  }
   if (!f_ptr) return;
   streamFrame(f_ptr, f_len, curMsec);
   //AddLog(LOG_LEVEL_DEBUG,PSTR("CAM: RTSP Stream Frame %d"), f_len);
@@ -417,6 +471,9 @@ struct {
   volatile int8_t  disable_cam; // set to 1 when TAS is busy doning something and has turned the camera off
   volatile int8_t  taskRunning; // 0 = not started, 1 = running, 2 = request stop
   TaskHandle_t taskHandle; // the task handle
+  volatile int8_t  streamTaskRunning; // 0 = not started, 1 = running, 2 = request stop
+  TaskHandle_t streamTaskHandle; // the network stream task handle
+  wc_frame * volatile streamFrame; // newest undelivered frame for the stream task (drop-oldest slot)
   volatile int8_t  taskGetFrame; // set to n to trigger capture of n frames to picstore
   volatile int8_t  taskTakePic; // set to n to trigger capture of n frames to picstore
   uint8_t  berryFrames;
@@ -625,6 +682,9 @@ struct WC_Motion {
   uint8_t pixelThreshold;
   uint32_t  pixel_trigger_limit; // pertenthousand changed pixels
 
+  uint8_t blockThreshold; // mean 8x8 block difference to count a block as changed (0 = block scoring off)
+  uint32_t block_trigger_limit; // pertenthousand changed blocks to trigger motion
+
   uint8_t enable_mask; // enable mask buffer
   uint32_t auto_mask; // number of motion runs to run automask over
   uint8_t auto_mask_pixel_threshold; // pixel change threshold to add pixel to mask
@@ -655,6 +715,7 @@ struct WC_Motion {
   int scaledwidth;
   int scaledheight;
   uint32_t changedPixelPertenthousand;
+  uint32_t changedBlockPertenthousand;
 
   uint32_t required_motion_buffer_len; // required frame buffer len - used to prevent continual reallocation after failure
 
@@ -1088,7 +1149,8 @@ uint32_t WcSetup(int32_t fsiz) {
   if (Wc.psram) {
     config.frame_size = FRAMESIZE_UXGA;
     config.jpeg_quality = 10;
-    config.fb_count = 2;
+    // 3 buffers so capture can continue while the stream task still references a frame
+    config.fb_count = 3;
 #ifdef WEBCAM_DEV_DEBUG  
     AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: PSRAM found"));
 #endif
@@ -1560,6 +1622,7 @@ void HandleWebcamMjpegFn(int type) {
     Wc.CamServer->send(403,"","");
     return;
   }
+  TasAutoMutex clientmutex(&WebcamClientMutex, "HandleWebcamMjpeg", 200);
   TasAutoMutex localmutex(&WebcamMutex, "HandleWebcamMjpeg", 200);
   wc_client *client = new wc_client;
   client->active = 1;
@@ -1625,6 +1688,146 @@ uint32_t WcSetStreamserver(uint32_t flag) {
 
 #define WEBCAM_CORE 0
 
+// hand the newest frame to the stream task, dropping an undelivered older one -
+// a slow consumer never builds a backlog and never makes capture wait
+static void WcPublishFrame(wc_frame *frame){
+  WcFrameRef(frame);
+  portENTER_CRITICAL(&WcFrameMux);
+  wc_frame *old = Wc.streamFrame;
+  Wc.streamFrame = frame;
+  portEXIT_CRITICAL(&WcFrameMux);
+  if (old) { WcFrameRelease(old); }
+}
+
+// this IS a task.
+// plain MJPEG web clients and rtsp clients are served here, so a slow or stalled
+// network client only delays its own frames - the capture task keeps running and
+// simply replaces the frame it could not deliver yet
+static void WCStreamTask(void *pvParameters){
+  Wc.streamTaskRunning = 1;
+  while (Wc.streamTaskRunning == 1){
+    wc_frame *frame;
+    portENTER_CRITICAL(&WcFrameMux);
+    frame = Wc.streamFrame;
+    Wc.streamFrame = nullptr;
+    portEXIT_CRITICAL(&WcFrameMux);
+    if (!frame){
+      vTaskDelay(2 / portTICK_PERIOD_MS);
+      continue;
+    }
+
+    uint8_t *_jpg_buf = frame->fb->buf;
+    size_t _jpg_buf_len = frame->fb->len;
+    { // closure for auto mutex - note: NOT WebcamMutex, capture must not wait for us
+      TasAutoMutex clientmutex(&WebcamClientMutex, "WcStreamTask", 30000);
+
+      // iterate over http streaming clients - motion (diff) clients stay on the capture task
+      wc_client *client = Wc.client_p;
+      while (client){
+        if (client->active && (0 == client->type)){
+          uint32_t client_start = millis();
+
+          if (!client->client.connected()){
+#ifdef WEBCAM_DEV_DEBUG
+            AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: Client fail"));
+#endif
+            client->active = 0;
+            WcStats.clientfail++;
+          }
+          if (1 == client->active) {
+            client->client.flush();
+            client->client.setTimeout(3);
+#ifdef WEBCAM_DEV_DEBUG
+            AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: Start stream"));
+#endif
+            client->client.print("HTTP/1.1 200 OK\r\n"
+              "Content-Type: multipart/x-mixed-replace;boundary=" BOUNDARY "\r\n"
+              "\r\n");
+            client->active = 2;
+          }
+          if (2 == client->active) {
+            if (0 == client->client.availableForWrite()) {
+              // previous frame still stuck in this client's send buffer - skip
+              // this frame for it instead of blocking all other clients
+              client = client->p_next;
+              continue;
+            }
+            client->client.printf(
+              "--" BOUNDARY "\r\n"
+              "Content-Type: image/jpeg\r\n"
+              "Content-Length: %d\r\n"
+              "\r\n", static_cast<int>(_jpg_buf_len));
+            client->client.write(_jpg_buf, _jpg_buf_len);
+            client->client.print("\r\n");
+          }
+          // if it took more than 20s to send to the client, then kill it.
+          // this was observed on wifi rescan
+          if (millis() - client_start > 20000){
+            AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: Cl timeout on send"));
+            WcStats.clientfail++;
+            client->client.stop();
+            client->active = 0;
+          }
+        }
+        client = client->p_next;
+      }
+
+#ifdef ENABLE_RTSPSERVER
+      // iterate over rtsp clients - the jpeg is parsed once and the result
+      // fanned out to every session, each keeps its own sequence/timestamp
+      ParsedJPEG parsed_jpg;
+      bool parsed_ok = false;
+      if (Wc.rtspclient) {
+        parsed_ok = parseJPEGfile(_jpg_buf, _jpg_buf_len, &parsed_jpg);
+      }
+      volatile wc_rtspclient *rtspclient = Wc.rtspclient;
+      while (rtspclient) {
+        if (parsed_ok && rtspclient->camStreamer && rtspclient->rtsp_session){
+          rtspclient->camStreamer->setframe(&parsed_jpg);
+          rtspclient->rtsp_session->broadcastCurrentFrame(millis());
+          rtspclient->camStreamer->clearframe();
+        }
+        rtspclient = rtspclient->p_next;
+      }
+#endif // ENABLE_RTSPSERVER
+    }
+    WcFrameRelease(frame);
+  }
+
+  // release a frame that was left undelivered in the slot
+  portENTER_CRITICAL(&WcFrameMux);
+  wc_frame *left = Wc.streamFrame;
+  Wc.streamFrame = nullptr;
+  portEXIT_CRITICAL(&WcFrameMux);
+  if (left) { WcFrameRelease(left); }
+
+  AddLog(LOG_LEVEL_DEBUG,PSTR("CAM: Left stream task"));
+  Wc.streamTaskRunning = 0;
+  vTaskDelete( NULL );
+}
+
+static void WCStartStreamTask(){
+  if (Wc.streamTaskRunning == 0){
+    xTaskCreatePinnedToCore(
+      WCStreamTask,         /* Task function. */
+      "WCStreamTask",       /* String with name of task. */
+      4096,                 /* Stack size in bytes. */
+      NULL,                 /* Parameter passed as input of the task */
+      1,                    /* Priority of the task */
+      &Wc.streamTaskHandle, /* Task handle. */
+#ifdef CONFIG_FREERTOS_UNICORE
+      0);                   /* Core where the task should run */
+#else
+      WEBCAM_CORE);         /* Core where the task should run */
+#endif
+    // wait for task to start
+    int loops = 10;
+    while(!Wc.streamTaskRunning && loops--){
+      vTaskDelay(10/ portTICK_PERIOD_MS);
+    }
+  }
+}
+
 static void WCOperationTask(void *pvParameters);
 static void WCStartOperationTask(){
   if (Wc.taskRunning == 0){
@@ -1650,6 +1853,7 @@ static void WCStartOperationTask(){
       vTaskDelay(10/ portTICK_PERIOD_MS);
     }
   }
+  WCStartStreamTask();
 }
 
 
@@ -1696,6 +1900,8 @@ static void WCOperationTask(void *pvParameters){
 
         // read a frame buffer pointer.  this will block until a frame is available
         camera_fb_t *wc_fb = esp_camera_fb_get();
+        // set when the frame has been handed to the stream task by reference
+        wc_frame *fb_wrapper = nullptr;
 
         if (!wc_fb) {
           // add framecount so we show this right away if we were showing frames.
@@ -1869,6 +2075,23 @@ static void WCOperationTask(void *pvParameters){
                   WcDetectMotionFn(_jpg_buf, _jpg_buf_len);
                 }
 #endif
+                // hand JPEG frames to the stream task by reference - plain MJPEG and
+                // rtsp clients are then served without blocking this task
+                bool deferred = false;
+                if ((1 == Wc.streamTaskRunning) && (PIXFORMAT_JPEG == wc_fb->format)
+#ifdef ENABLE_RTSPSERVER
+                    && (Wc.client_p || Wc.rtspclient)
+#else
+                    && Wc.client_p
+#endif
+                    ) {
+                  fb_wrapper = WcFrameWrap(wc_fb);
+                  if (fb_wrapper) {
+                    WcPublishFrame(fb_wrapper);
+                    deferred = true;
+                  }
+                }
+
                 // if http streaming is active, we will have one or more clients
                 wc_client *client = Wc.client_p;
                 // iterate over clients
@@ -1879,6 +2102,12 @@ static void WCOperationTask(void *pvParameters){
 #endif
                 while(client){
                   if (client->active){
+                    if (deferred && (0 == client->type)) {
+                      // already served by reference from the stream task
+                      client = client->p_next;
+                      webclientcount++;
+                      continue;
+                    }
                     uint32_t client_start = millis();
 
                     if (!client->client.connected()){
@@ -1976,11 +2205,18 @@ static void WCOperationTask(void *pvParameters){
 
     #ifdef ENABLE_RTSPSERVER
                 // if rtsp is active, we will have one or more clients
+                // parse the jpeg once and fan the result out to every session
+                ParsedJPEG parsed_jpg;
+                bool parsed_ok = false;
+                if (!deferred && Wc.rtspclient) {
+                  parsed_ok = parseJPEGfile(_jpg_buf, _jpg_buf_len, &parsed_jpg);
+                }
                 volatile wc_rtspclient *rtspclient = Wc.rtspclient;
                 uint8_t rtspclientcount = 0;
                 while (rtspclient) {
-                  if (rtspclient->camStreamer && rtspclient->rtsp_session){
-                    rtspclient->camStreamer->setframe(_jpg_buf, _jpg_buf_len);
+                  // when deferred, the stream task broadcasts the frame instead
+                  if (parsed_ok && rtspclient->camStreamer && rtspclient->rtsp_session){
+                    rtspclient->camStreamer->setframe(&parsed_jpg);
                     rtspclient->rtsp_session->broadcastCurrentFrame(now);
                     rtspclient->camStreamer->clearframe();
                   }
@@ -2006,7 +2242,12 @@ static void WCOperationTask(void *pvParameters){
           }
 
           // free resources and return frame buffer for re-use AFTER we have used the data
-          esp_camera_fb_return(wc_fb);
+          // (the buffer only goes back to the driver pool once the stream task is done with it)
+          if (fb_wrapper) {
+            WcFrameRelease(fb_wrapper);
+          } else {
+            esp_camera_fb_return(wc_fb);
+          }
         }
       } else {
         if (Wc.up){
@@ -2036,6 +2277,8 @@ static void WCOperationTask(void *pvParameters){
 }
 
 void WcRemoveDeadCients(){
+  // the stream task iterates the list while sending, so keep it away during removal
+  TasAutoMutex clientmutex(&WebcamClientMutex, "WcRemoveDeadCients", 200);
   // iterate over clients removing dead ones
   wc_client *client = Wc.client_p;
   wc_client **prev = &Wc.client_p;
@@ -2117,6 +2360,9 @@ void WcLoop(void) {
   if (Settings->webcam_config.rtsp){
     if (!TasmotaGlobal.global_state.wifi_down) {
       // pretty sure we don;t need the mutex here
+      // the client mutex keeps the stream task from broadcasting on a session
+      // that is being handled or deleted here
+      TasAutoMutex clientmutex(&WebcamClientMutex, "WcLoop2", 30000);
       TasAutoMutex localmutex(&WebcamMutex, "WcLoop2", 30000);
       if (!Wc.rtspp) {
         Wc.rtspp = new WiFiServer(8554);
@@ -2185,6 +2431,7 @@ void WcLoop(void) {
 // kill all rtsp clients
 void WcEndRTSP(){
   // we should use a mutext here, in case we are currently sending
+  TasAutoMutex clientmutex(&WebcamClientMutex, "WcEndRTSP", 2000);
   TasAutoMutex localmutex(&WebcamMutex, "WcEndRTSP", 2000);
   wc_rtspclient * volatile rtspclient = Wc.rtspclient;
   wc_rtspclient * volatile * prev = &Wc.rtspclient;
@@ -2207,6 +2454,7 @@ void WcEndRTSP(){
 // kill all http streaming clients
 void WcEndStream(){
   // we should use a mutext here, in case we are currently sending
+  TasAutoMutex clientmutex(&WebcamClientMutex, "WcEndStream", 20000);
   TasAutoMutex localmutex(&WebcamMutex, "WcLoop2", 20000);
   // if http streaming is active
   wc_client *client = Wc.client_p;
@@ -2464,6 +2712,11 @@ void CmndWebcamStartTask(void) {
 }
 
 void WcStopTask(void){
+  if (Wc.streamTaskRunning == 1){
+    // set to 2, and wait until cleared
+    WcWaitZero(&Wc.streamTaskRunning, 2, 20000);
+    Wc.streamTaskHandle = nullptr;
+  }
   if (Wc.taskRunning == 1){
     // set to 2, and wait until cleared
     WcWaitZero(&Wc.taskRunning, 2, 20000);
@@ -93,6 +93,26 @@ WCsetMotiondetect6 0-1
 normalised value, try 1000...
 WCsetMotiondetect7 0-nnnnn
 
+### Block difference threshold
+if set > 0, the difference image is averaged over 8x8 blocks and blocks with a
+mean difference > threshold are counted.  Much less sensitive to sensor noise
+than single pixel counts.  Forces the difference buffer on.
+WCsetMotiondetect10 <mean block diff threshold 1-255, 0 to disable>
+WCsetMotiondetect10 12
+
+### Blocks over threshold trigger
+if the number of blocks changed (per 10000) is > limit, motion is triggered.
+set 0 to disable.
+WCsetMotiondetect11 <block count trigger thresh, in 1/10000>
+WCsetMotiondetect11 100
+
+### Runtime zone mask
+fill a rectangle of the motion mask, coordinates in percent of the frame so
+they survive resolution and scale changes.  1 (default) masks the zone out of
+detection, 0 re-enables it.  Enables the mask buffer if not already on.
+WCsetMotiondetect12 <x y w h [1|0]>
+WCsetMotiondetect12 0 0 50 100
+
 
 Endpoints:
 http://IP/motionlbuff.jpg - last motion buffer as jpeg (fully scaled) - if motion enabled, else 404
@@ -329,16 +349,17 @@ bool WcConvertFrame(int32_t bnum_i, int format, int scale) {
 
 
 void WcMotionLog(){
-  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("CAM: motion: w:%d h:%d scale:1/%d:1/%d ms:%u val:%d br: %d triggerpoint:%d, px10000:%d"), 
-    (Wc.width/(1<<wc_motion.scale))/(1<<wc_motion.swscale), 
-    (Wc.height/(1<<wc_motion.scale))/(1<<wc_motion.swscale), 
-    (1<<wc_motion.scale), 
-    (1<<wc_motion.swscale), 
+  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("CAM: motion: w:%d h:%d scale:1/%d:1/%d ms:%u val:%d br: %d triggerpoint:%d, px10000:%d, blk10000:%d"),
+    (Wc.width/(1<<wc_motion.scale))/(1<<wc_motion.swscale),
+    (Wc.height/(1<<wc_motion.scale))/(1<<wc_motion.swscale),
+    (1<<wc_motion.scale),
+    (1<<wc_motion.swscale),
     wc_motion.last_duration,
-    wc_motion.motion_trigger, 
-    wc_motion.motion_brightness, 
+    wc_motion.motion_trigger,
+    wc_motion.motion_brightness,
     wc_motion.motion_trigger_limit,
-    wc_motion.changedPixelPertenthousand
+    wc_motion.changedPixelPertenthousand,
+    wc_motion.changedBlockPertenthousand
   );
 }
 
@@ -636,6 +657,29 @@ void WcAutoMask(){
 }
 
 
+/*********************************************************************************************/
+// fill a rectangle of the motion mask, coordinates in percent of the frame so
+// they survive resolution and scale changes.  masked (255) pixels are ignored
+// by the difference scan.  returns 1 on success
+int WcSetMotionZone(int zx, int zy, int zw, int zh, uint8_t val){
+  if (!wc_motion.mask || !wc_motion.mask->buff) return 0;
+  int scaledwidth = wc_motion.mask->width;
+  int scaledheight = wc_motion.mask->height;
+  int x0 = (zx * scaledwidth) / 100;
+  int y0 = (zy * scaledheight) / 100;
+  int x1 = ((zx + zw) * scaledwidth) / 100;
+  int y1 = ((zy + zh) * scaledheight) / 100;
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > scaledwidth) x1 = scaledwidth;
+  if (y1 > scaledheight) y1 = scaledheight;
+  if ((x0 >= x1) || (y0 >= y1)) return 0;
+  for (int y = y0; y < y1; y++){
+    memset(wc_motion.mask->buff + y*scaledwidth + x0, val, x1 - x0);
+  }
+  return 1;
+}
+
 /*********************************************************************************************/
 // motion detect routine.
 // Wc.width and Wc.height must be set
@@ -671,10 +715,13 @@ void WcDetectMotionFn(uint8_t *_jpg_buf, int _jpg_buf_len){
     }
   }
 
+  // block scoring works over the difference image, so it forces the diff buffer on
+  uint8_t want_diff = wc_motion.enable_diffbuff || (wc_motion.blockThreshold != 0);
+
   // if diff enable changed
-  if ((wc_motion.enable_diffbuff && !wc_motion.diff) ||
-      (!wc_motion.enable_diffbuff && wc_motion.diff)){
-    AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: diff enable now %d"), wc_motion.enable_diffbuff);
+  if ((want_diff && !wc_motion.diff) ||
+      (!want_diff && wc_motion.diff)){
+    AddLog(LOG_LEVEL_DEBUG, PSTR("CAM: diff enable now %d"), want_diff);
     newbuffers = true;
   }
   
@@ -710,7 +757,7 @@ void WcDetectMotionFn(uint8_t *_jpg_buf, int _jpg_buf_len){
       AddLog(LOG_LEVEL_ERROR, PSTR("CAM: motion: no allocate last_motion"));
       pic_free_p(&wc_motion.last_motion);
     }
-    if (wc_motion.enable_diffbuff){
+    if (want_diff){
       pic_alloc_p(&wc_motion.diff, scaledwidth, scaledheight, 0, PIXFORMAT_GRAYSCALE, WC_ALLOC_ALWAYS);
       if (!wc_motion.diff || !wc_motion.diff->allocatedLen) {
         AddLog(LOG_LEVEL_ERROR, PSTR("CAM: motion: no allocate diff"));
@@ -782,7 +829,7 @@ void WcDetectMotionFn(uint8_t *_jpg_buf, int _jpg_buf_len){
   if (wc_motion.diff && wc_motion.diff->buff) pxdy = wc_motion.diff->buff;
   // optional backkground buffer - may be nullptr unless enabled
   uint8_t *pxby = nullptr;
-  if (wc_motion.background && wc_motion.background->buff) pxdy = wc_motion.background->buff;
+  if (wc_motion.background && wc_motion.background->buff) pxby = wc_motion.background->buff;
   // optional mask buffer - may be nullptr unless enabled
   uint8_t *pxmy = nullptr;
   if (wc_motion.mask && wc_motion.mask->buff) pxmy = wc_motion.mask->buff;
@@ -905,6 +952,34 @@ void WcDetectMotionFn(uint8_t *_jpg_buf, int _jpg_buf_len){
   // we only capture background once when asked to by this flag
   wc_motion.capture_background = 0;
 
+  // block-level scoring: average the difference image over 8x8 blocks and count
+  // the blocks whose mean change exceeds the threshold.  masked pixels are
+  // already zero in the difference image, so zones are respected for free.
+  wc_motion.changedBlockPertenthousand = 0;
+  if (wc_motion.blockThreshold && pxdy){
+    int blocksw = scaledwidth / 8;
+    int blocksh = scaledheight / 8;
+    if (blocksw && blocksh){
+      uint32_t changedBlocks = 0;
+      for (int by = 0; by < blocksh; by++){
+        for (int bx = 0; bx < blocksw; bx++){
+          uint8_t *pxd = pxdy + (by*8)*scaledwidth + bx*8;
+          uint32_t sum = 0;
+          for (int yb = 0; yb < 8; yb++){
+            for (int xb = 0; xb < 8; xb++){
+              sum += pxd[xb];
+            }
+            pxd += scaledwidth;
+          }
+          if ((sum / 64) > wc_motion.blockThreshold){
+            changedBlocks++;
+          }
+        }
+      }
+      wc_motion.changedBlockPertenthousand = (changedBlocks * 10000) / (blocksw * blocksh);
+    }
+  }
+
   // when scaledpixelcount is < 100, float becomes necessary
   float divider = (((float)scaledpixelcount) / 100.0);
 
@@ -921,6 +996,10 @@ void WcDetectMotionFn(uint8_t *_jpg_buf, int _jpg_buf_len){
       wc_motion.motion_triggered = 1;
     }
 
+    if (wc_motion.block_trigger_limit && wc_motion.changedBlockPertenthousand > wc_motion.block_trigger_limit){
+      wc_motion.motion_triggered = 1;
+    }
+
   } else {
     // first run, 
     wc_motion.motion_state = 1;
@@ -1169,6 +1248,44 @@ void CmndWebcamSetMotionDetect(void) {
       }
       res = wc_motion.enable_diffbuff;
       break;
+    case 10: // mean 8x8 block difference threshold - 0 disables block scoring
+      if (XdrvMailbox.payload >= 0 && XdrvMailbox.payload <= 255){
+        wc_motion.blockThreshold = XdrvMailbox.payload;
+      }
+      res = wc_motion.blockThreshold;
+      break;
+    case 11: // blocks changed (per 10000) to trigger motion, 0 to disable
+      if (XdrvMailbox.payload >= 0){
+        wc_motion.block_trigger_limit = XdrvMailbox.payload;
+      }
+      res = wc_motion.block_trigger_limit;
+      break;
+    case 12: { // runtime zone mask: "x y w h [1|0]" in percent of frame
+      if (0 == XdrvMailbox.data_len) {
+        res = wc_motion.enable_mask ? 1 : 0;
+        break;
+      }
+      char tmp[40];
+      strncpy(tmp, XdrvMailbox.data, sizeof(tmp)-1);
+      tmp[sizeof(tmp)-1] = 0;
+      int zx, zy, zw, zh;
+      int val = 1;
+      if (sscanf(tmp, "%d %d %d %d %d", &zx, &zy, &zw, &zh, &val) < 4){
+        AddLog(LOG_LEVEL_ERROR, PSTR("CAM: motion: zone expects 'x y w h [1|0]' in percent"));
+        break;
+      }
+      if (!wc_motion.enable_mask || !wc_motion.mask){
+        TasAutoMutex localmutex(&WebcamMutex, "setMotionDetect", 30000);
+        wc_motion.enable_mask = 1;
+        // force buffer allocation now
+        WcDetectMotionFn(nullptr, 0);
+      }
+      if (!wc_motion.mask || !wc_motion.mask->buff){
+        AddLog(LOG_LEVEL_ERROR, PSTR("CAM: motion: unable to allocate mask buffer"));
+        break;
+      }
+      res = WcSetMotionZone(zx, zy, zw, zh, val ? 255 : 0);
+    } break;
   }
   ResponseCmndNumber(res);
 }
@@ -241,6 +241,11 @@ typedef struct {
   float energy_total[SSPM_TOTAL_MODULES][4];      // Total energy in kWh - float allows up to 262143.99 kWh
   float energy_yesterday[SSPM_TOTAL_MODULES][4];  // Energy yesterday in kWh - float allows up to 262143.99 kWh
   uint32_t simulate_count;
+  uint8_t module_topology[SSPM_MAX_MODULES][SSPM_MODULE_NAME_SIZE];  // (v0x0105) Module ids cached from last scan
+  uint32_t module_topology_versions[SSPM_MAX_MODULES];  // (v0x0105) Module versions cached from last scan
+  float module_ratings[6];                        // (v0x0105) Cached module limits: maxI, minI, maxU, minU, maxP, minP
+  uint8_t module_topology_count;                  // (v0x0105) Cached number of modules, 0 = no cache so scan at boot
+  uint16_t power_delta;                           // (v0x0105) Min power change in W triggering a tele SENSOR publish, 0 = disabled
 } tSspmSettings;
 
 typedef struct {
@@ -253,6 +258,7 @@ typedef struct {
   float power_factor[SSPM_MAX_MODULES][4];        // 0.12
   float energy_today[SSPM_MAX_MODULES][4];        // 12345 kWh
   float energy_total[SSPM_MAX_MODULES][4];        // 12345 kWh total energy since last 6 month!!!
+  float last_published_power[SSPM_MAX_MODULES][4];  // Active power at last SspmPowerDelta publish
 
   uint32_t relay_versions[SSPM_MAX_MODULES];
 
@@ -301,6 +307,7 @@ typedef struct {
   uint8_t overload_relay;
   uint8_t overload_delay;
   uint8_t overload_enable;
+  uint8_t topology_cached;
   uint8_t history_relay;
   uint8_t log_relay;
   bool map_change;
@@ -314,7 +321,7 @@ TSspm *Sspm = nullptr;
  * Driver Settings load and save using filesystem
 \*********************************************************************************************/
 
-const uint16_t XDRV_86_VERSION = 0x0104;              // Latest driver version (See settings deltas below)
+const uint16_t XDRV_86_VERSION = 0x0105;              // Latest driver version (See settings deltas below)
 
 void Xdrv86SettingsLoad(bool erase) {
   // *** Start init default values in case file is not found ***
@@ -342,6 +349,13 @@ void Xdrv86SettingsLoad(bool erase) {
       if (Sspm->Settings.version < 0x0104) {
         Sspm->Settings.flag.display = Settings->sbflag1.sspm_display;
       }
+      if (Sspm->Settings.version < 0x0105) {
+        memset(Sspm->Settings.module_topology, 0, sizeof(Sspm->Settings.module_topology));
+        memset(Sspm->Settings.module_topology_versions, 0, sizeof(Sspm->Settings.module_topology_versions));
+        memset(Sspm->Settings.module_ratings, 0, sizeof(Sspm->Settings.module_ratings));
+        Sspm->Settings.module_topology_count = 0;
+        Sspm->Settings.power_delta = 0;
+      }
 
       // *** End setting deltas ***
 
@@ -844,24 +858,22 @@ void SSPMSendGetEnergyTotal(uint32_t relay) {
   SSPMSend(35);
 }
 
-void SSPMSendGetEnergy(uint32_t relay) {
+void SSPMSendGetModuleEnergy(uint32_t module, uint32_t channel_mask) {
   /*
-  relay_num = 1..8
    0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37
   AA 55 01 00 00 00 00 00 00 00 00 00 00 00 00 00 18 00 10 6b 7e 32 37 39 37 34 13 4b 35 36 37 01 01 00 3c 2a db d1
   Marker  |                                   |  |Cm|Size |Module id                          |  |Ch|     |Ix|Chksm|
+  Ch is a channel bit mask - all four channels of a module can be requested in one frame and
+  arrive in a single multi-channel SSPM_FUNC_ENERGY_RESULT
   */
-  uint8_t module = relay >> 2;
-
   if (module >= Sspm->module_max) { return; }
 
-  uint8_t channel = 1 << (relay & 0x03);  // Channel relays are bit masked
   SSPMInitSend();
   SspmBuffer[16] = SSPM_FUNC_GET_ENERGY;  // 0x18
   SspmBuffer[18] = 0x10;
   memcpy(SspmBuffer +19, Sspm->module[SSPMGetMappedModuleId(module)], SSPM_MODULE_NAME_SIZE);
   SspmBuffer[31] = 0x01;
-  SspmBuffer[32] = channel;
+  SspmBuffer[32] = channel_mask;
   SspmBuffer[33] = 0;
   SspmBuffer[34] = 0x3C;
   Sspm->command_sequence++;
@@ -870,6 +882,11 @@ void SSPMSendGetEnergy(uint32_t relay) {
   SSPMSend(38);
 }
 
+void SSPMSendGetEnergy(uint32_t relay) {
+  // relay_num = 1..8
+  SSPMSendGetModuleEnergy(relay >> 2, 1 << (relay & 0x03));  // Channel relays are bit masked
+}
+
 void SSPMSendGetLog(uint32_t relay, uint32_t entries) {
   /*
    0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37
@@ -1052,6 +1069,40 @@ void SSPMAddModule(void) {
   }
 }
 
+void SSPMSaveTopology(void) {
+  // Cache the scanned stack topology so the next boot can skip the ~20 second bus enumeration
+  memcpy(Sspm->Settings.module_topology, Sspm->module, sizeof(Sspm->Settings.module_topology));
+  memcpy(Sspm->Settings.module_topology_versions, Sspm->relay_versions, sizeof(Sspm->Settings.module_topology_versions));
+  Sspm->Settings.module_ratings[0] = Sspm->max_current;
+  Sspm->Settings.module_ratings[1] = Sspm->min_current;
+  Sspm->Settings.module_ratings[2] = Sspm->max_voltage;
+  Sspm->Settings.module_ratings[3] = Sspm->min_voltage;
+  Sspm->Settings.module_ratings[4] = Sspm->max_power;
+  Sspm->Settings.module_ratings[5] = Sspm->min_power;
+  Sspm->Settings.module_topology_count = Sspm->module_max;
+}
+
+bool SSPMLoadTopology(void) {
+  // Restore the stack topology cached by the last scan. Returns false if no valid cache is present
+  uint32_t count = Sspm->Settings.module_topology_count;
+  if ((0 == count) || (count > SSPM_MAX_MODULES)) { return false; }
+  memcpy(Sspm->module, Sspm->Settings.module_topology, sizeof(Sspm->module));
+  memcpy(Sspm->relay_versions, Sspm->Settings.module_topology_versions, sizeof(Sspm->relay_versions));
+  for (uint32_t module = 0; module < count; module++) {
+    if (Sspm->relay_versions[module] < Sspm->relay_version) {
+      Sspm->relay_version = Sspm->relay_versions[module];  // Lowest version will be supported
+    }
+  }
+  Sspm->max_current = Sspm->Settings.module_ratings[0];
+  Sspm->min_current = Sspm->Settings.module_ratings[1];
+  Sspm->max_voltage = Sspm->Settings.module_ratings[2];
+  Sspm->min_voltage = Sspm->Settings.module_ratings[3];
+  Sspm->max_power = Sspm->Settings.module_ratings[4];
+  Sspm->min_power = Sspm->Settings.module_ratings[5];
+  Sspm->module_max = count;
+  return true;
+}
+
 /*********************************************************************************************/
 
 void SSPMLogResult(uint32_t command, uint32_t status) {
@@ -1263,7 +1314,23 @@ void SSPMHandleReceivedData(void) {
         Sspm->main_version = SspmBuffer[20] << 16 | SspmBuffer[21] << 8 | SspmBuffer[22];  // 0x00010000 or 0x00010200
         AddLog(LOG_LEVEL_INFO, PSTR("SPM: Main version %d.%d.%d found"), SspmBuffer[20], SspmBuffer[21], SspmBuffer[22]);
 
-        Sspm->mstate = SPM_START_SCAN;
+        if (SSPMLoadTopology()) {
+          // Topology cached by a previous scan - skip the ~20 second bus enumeration and
+          // query the module states directly. SspmScan forces a full rescan at any time
+          // and a scan is retried if a cached module does not respond.
+          AddLog(LOG_LEVEL_INFO, PSTR("SPM: Using cached topology with %d 4Relay module(s)"), Sspm->module_max);
+          Sspm->error_led_blinks = 0;            // Reset error light
+          Sspm->overload_relay = 255;            // Disable display overload settings
+          Sspm->history_relay = 255;             // Disable display energy history
+          Sspm->log_relay = 255;                 // Disable display logging
+          Sspm->topology_cached = 1;
+          Sspm->module_selected = Sspm->module_max;
+          Sspm->mstate = SPM_WAIT_FOR_SCAN;
+          Sspm->last_totals = 0;
+          SSPMSendSetTime();
+        } else {
+          Sspm->mstate = SPM_START_SCAN;
+        }
         break;
       case SSPM_FUNC_GET_ENERGY_TOTAL:
         /* 0x16
@@ -2018,6 +2085,25 @@ void SSPMInit(void) {
 
 /*********************************************************************************************/
 
+void SSPMCheckPowerDelta(void) {
+  // Publish the tele SENSOR when any channel's active power changed at least
+  // SspmPowerDelta watts since the last publish, so dashboards follow load changes
+  // without waiting for TelePeriod. Unchanged channels cause no extra traffic.
+  if (!Sspm->Settings.power_delta) { return; }
+  bool publish = false;
+  for (uint32_t module = 0; module < Sspm->module_max; module++) {
+    for (uint32_t channel = 0; channel < 4; channel++) {
+      float delta = Sspm->active_power[module][channel] - Sspm->last_published_power[module][channel];
+      if (delta < 0) { delta = -delta; }
+      if (delta >= (float)Sspm->Settings.power_delta) { publish = true; }
+    }
+  }
+  if (publish) {
+    memcpy(Sspm->last_published_power, Sspm->active_power, sizeof(Sspm->last_published_power));
+    MqttPublishSensor();
+  }
+}
+
 void SSPMEvery100ms(void) {
   Sspm->last_totals++;
 
@@ -2097,9 +2183,17 @@ void SSPMEvery100ms(void) {
     case SPM_WAIT_FOR_SCAN:
       // Wait for scan sequence to complete within 60 seconds
       if (Sspm->last_totals > 600) {
-        AddLog(LOG_LEVEL_DEBUG, PSTR("SPM: Relay scan timeout"));
-        Sspm->mstate = SPM_NONE;
-        Sspm->error_led_blinks = 255;
+        if (Sspm->topology_cached) {
+          // Cached topology did not respond (stack probably changed) - fall back to a full scan
+          AddLog(LOG_LEVEL_INFO, PSTR("SPM: Cached topology invalid - starting scan"));
+          Sspm->topology_cached = 0;
+          Sspm->Settings.module_topology_count = 0;
+          Sspm->mstate = SPM_START_SCAN;
+        } else {
+          AddLog(LOG_LEVEL_DEBUG, PSTR("SPM: Relay scan timeout"));
+          Sspm->mstate = SPM_NONE;
+          Sspm->error_led_blinks = 255;
+        }
       }
       break;
     case SPM_SCAN_COMPLETE:
@@ -2126,6 +2220,8 @@ void SSPMEvery100ms(void) {
 #ifdef SSPM_SIMULATE
       }
 #endif  // SSPM_SIMULATE
+      SSPMSaveTopology();                      // Refresh topology cache (no-op file wise if unchanged)
+      Sspm->topology_cached = 0;
       TasmotaGlobal.discovery_counter = 1;     // Force TasDiscovery()
       Sspm->allow_updates = 1;                 // Enable requests from 100mSec loop
       Sspm->get_energy_relay = 0;
@@ -2160,8 +2256,12 @@ void SSPMEvery100ms(void) {
           Sspm->mstate = SPM_STALL_MIDNIGHT;
         } else {
           Sspm->get_energy_relay++;
+          if (!Sspm->get_totals && (Sspm->get_energy_relay & 3)) {
+            Sspm->get_energy_relay = (Sspm->get_energy_relay | 3) +1;  // Energy is polled one module (4 channels) per request
+          }
           if (Sspm->get_energy_relay >= TasmotaGlobal.devices_present) {
             Sspm->get_energy_relay = 0;
+            SSPMCheckPowerDelta();             // Once per scan cycle publish if a channel changed more than SspmPowerDelta
             if (Sspm->last_totals > 1200) {    // Get totals every 2 minutes (takes 128 * 0.2s)
               Sspm->last_totals = 0;
               Sspm->get_totals = 1;
@@ -2188,24 +2288,31 @@ void SSPMEvery100ms(void) {
           }
 //          AddLog(LOG_LEVEL_DEBUG, PSTR("SPM: Totals %d, Relay %d"), Sspm->get_totals, Sspm->get_energy_relay);
 
-          power_t powered_on = TasmotaGlobal.power >> Sspm->get_energy_relay;
-          if (powered_on &1) {
-            SSPMSetLock(4);
-            if (Sspm->get_totals) {
+          if (Sspm->get_totals) {
+            power_t powered_on = TasmotaGlobal.power >> Sspm->get_energy_relay;
+            if (powered_on &1) {
+              SSPMSetLock(4);
               SSPMSendGetEnergyTotal(Sspm->get_energy_relay);
-            } else {
-              SSPMSendGetEnergy(Sspm->get_energy_relay);
             }
           } else {
+            // All powered on channels of a module are pipelined into one request and
+            // parsed from a single multi-channel result, so a 32-channel stack
+            // refreshes in 8 polls instead of 32
             uint32_t module = Sspm->get_energy_relay >> 2;
-            uint32_t channel = Sspm->get_energy_relay &3;
-            if (Sspm->voltage[module][channel]) {
-              Sspm->voltage[module][channel] = 0;
-              Sspm->current[module][channel] = 0;
-              Sspm->active_power[module][channel] = 0;
-              Sspm->apparent_power[module][channel] = 0;
-              Sspm->reactive_power[module][channel] = 0;
-              Sspm->power_factor[module][channel] = 0;
+            uint32_t channel_mask = (TasmotaGlobal.power >> (module *4)) & 0x0F;
+            for (uint32_t channel = 0; channel < 4; channel++) {
+              if (!(channel_mask & (1 << channel)) && Sspm->voltage[module][channel]) {
+                Sspm->voltage[module][channel] = 0;
+                Sspm->current[module][channel] = 0;
+                Sspm->active_power[module][channel] = 0;
+                Sspm->apparent_power[module][channel] = 0;
+                Sspm->reactive_power[module][channel] = 0;
+                Sspm->power_factor[module][channel] = 0;
+              }
+            }
+            if (channel_mask) {
+              SSPMSetLock(4);
+              SSPMSendGetModuleEnergy(module, channel_mask);
             }
           }
         }
@@ -2402,7 +2509,7 @@ const char kSSPMCommands[] PROGMEM = "SSPM|"  // Prefix
   "Simulate|"
 #endif  // SSPM_SIMULATE
   "Log|Energy|History|Scan|IamHere|"
-  "Reset|Map|Overload|"
+  "Reset|Map|Overload|PowerDelta|"
   D_CMND_ENERGYTOTAL "|" D_CMND_ENERGYYESTERDAY "|Send|" D_CMND_POWERONSTATE;
 
 void (* const SSPMCommand[])(void) PROGMEM = {
@@ -2411,7 +2518,7 @@ void (* const SSPMCommand[])(void) PROGMEM = {
   &CmndSSPMSimulate,
 #endif  // SSPM_SIMULATE
   &CmndSSPMLog, &CmndSSPMEnergy, &CmndSSPMHistory, &CmndSSPMScan, &CmndSSPMIamHere,
-  &CmndSSPMReset, &CmndSSPMMap, &CmndSSPMOverload,
+  &CmndSSPMReset, &CmndSSPMMap, &CmndSSPMOverload, &CmndSSPMPowerDelta,
   &CmndSpmEnergyTotal, &CmndSpmEnergyYesterday, &CmndSSPMSend, &CmndSSPMPowerOnState };
 
 void CmndSSPMDisplay(void) {
@@ -2589,6 +2696,16 @@ void CmndSSPMHistory(void) {
   }
 }
 
+void CmndSSPMPowerDelta(void) {
+  // Publish tele SENSOR when any channel's active power changed at least this many watts
+  // SspmPowerDelta 0       - Disable (default), only TelePeriod publishes
+  // SspmPowerDelta 1..3600 - Watt threshold checked once per scan cycle
+  if ((XdrvMailbox.payload >= 0) && (XdrvMailbox.payload <= 3600)) {
+    Sspm->Settings.power_delta = XdrvMailbox.payload;
+  }
+  ResponseCmndNumber(Sspm->Settings.power_delta);
+}
+
 void CmndSSPMScan(void) {
   // Start relay module scan taking up to 20 seconds
   // SspmScan
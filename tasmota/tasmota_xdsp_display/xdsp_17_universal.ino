@@ -63,6 +63,23 @@ void Core2DisplayDim(uint8_t dim);
 #define DISP_DESC_FILE "/display.ini"
 #endif // DISP_DESC_FILE
 
+#ifdef USE_UFILESYS
+// Compiled descriptor cache. On first load the resolved descriptor is compacted (comment and
+// blank lines stripped, pins substituted) and saved, so subsequent boots feed uDisplay a
+// minimal prebuilt text. Invalidated by a hash of the source descriptor and the pin map
+#ifndef DISP_DESC_CACHE
+#define DISP_DESC_CACHE "/display.bin"
+#endif // DISP_DESC_CACHE
+
+typedef struct {
+  uint16_t magic;       // DISP_CACHE_MAGIC
+  uint16_t len;         // Payload length without terminating zero
+  uint32_t hash;        // Hash of source descriptor text and resolved pin map
+} TDispDescCache;
+
+const uint16_t DISP_CACHE_MAGIC = 0x4455;  // 'UD'
+#endif // USE_UFILESYS
+
 /*********************************************************************************************/
 #ifdef DSP_ROM_DESC
 const char DSP_SAMPLE_DESC[] PROGMEM = DSP_ROM_DESC;
@@ -75,6 +92,9 @@ Renderer *Init_uDisplay(const char *desc) {
 
     char *fbuff = (char*)calloc(DISPDESC_SIZE, 1);
     if (!fbuff) return 0;
+#ifdef USE_UFILESYS
+    uint32_t fbuff_size = DISPDESC_SIZE;
+#endif // USE_UFILESYS
 
     char *ddesc = nullptr;
     if (desc) {
@@ -93,6 +113,7 @@ Renderer *Init_uDisplay(const char *desc) {
           free(fbuff);
           fbuff = (char*)calloc(size + 50, 1);
           if (!fbuff) return 0;
+          fbuff_size = size + 50;
         }
         fp.read((uint8_t*)fbuff, size);
         fp.close();
@@ -149,6 +170,32 @@ Renderer *Init_uDisplay(const char *desc) {
       return 0;
     }
 
+#ifdef USE_UFILESYS
+    // Probe the compiled descriptor cache. On a hit the compacted copy replaces the source
+    // text, on a mismatch it is rewritten below after the pin substitutions
+    uint32_t desc_hash = 0;
+    bool desc_cached = false;
+    if (ffsp && !TasmotaGlobal.no_autoexec) {
+      desc_hash = GetHash(ddesc, strlen(ddesc)) ^ GetHash((const char*)TasmotaGlobal.gpio_pin, sizeof(TasmotaGlobal.gpio_pin));
+      File fp;
+      fp = ffsp->open(DISP_DESC_CACHE, "r");
+      if (fp > 0) {
+        TDispDescCache header;
+        if ((sizeof(header) == fp.read((uint8_t*)&header, sizeof(header))) &&
+            (DISP_CACHE_MAGIC == header.magic) && (desc_hash == header.hash) &&
+            (header.len + 50 <= fbuff_size)) {
+          if (header.len == fp.read((uint8_t*)fbuff, header.len)) {
+            fbuff[header.len] = 0;
+            ddesc = fbuff;
+            desc_cached = true;
+            AddLog(LOG_LEVEL_DEBUG, PSTR("DSP: Compiled descriptor used"));
+          }
+        }
+        fp.close();
+      }
+    }
+#endif // USE_UFILESYS
+
     // Replace tasmota vars before passing to driver uDisplay.cpp
     char *cp = strstr(ddesc, "I2C");
     if (cp) {
@@ -335,6 +382,24 @@ Renderer *Init_uDisplay(const char *desc) {
     fp.close();
 */
 
+#ifdef USE_UFILESYS
+    if (ffsp && !TasmotaGlobal.no_autoexec && !desc_cached) {
+      // First load of this descriptor - compact it and save the result for the next boot
+      uint32_t dlen = DisplayCompactDesc(ddesc);
+      File fp;
+      fp = ffsp->open(DISP_DESC_CACHE, "w");
+      if (fp > 0) {
+        TDispDescCache header;
+        header.magic = DISP_CACHE_MAGIC;
+        header.len = dlen;
+        header.hash = desc_hash;
+        fp.write((uint8_t*)&header, sizeof(header));
+        fp.write((uint8_t*)ddesc, dlen);
+        fp.close();
+      }
+    }
+#endif // USE_UFILESYS
+
     // init renderer
     if (renderer) {
       delete renderer;
@@ -535,6 +600,29 @@ int8_t replacepin(char **cp, int16_t pin) {
 
 /*********************************************************************************************/
 
+#ifdef USE_UFILESYS
+uint32_t DisplayCompactDesc(char *desc) {
+  // Compile a descriptor in place by dropping comment lines, blank lines and carriage
+  // returns - uDisplay then parses a minimal text. Returns the compacted length
+  char *sp = desc;
+  char *dp = desc;
+  while (*sp) {
+    char *ep = strchr(sp, '\n');
+    uint32_t llen = (ep) ? (ep - sp) + 1 : strlen(sp);
+    char *cp = sp;
+    while ((' ' == *cp) || ('\r' == *cp)) { cp++; }
+    if ((*cp != ';') && (*cp != '\n') && (*cp != 0)) {
+      for (uint32_t cnt = 0; cnt < llen; cnt++) {
+        if ('\r' != sp[cnt]) { *dp++ = sp[cnt]; }
+      }
+    }
+    sp += llen;
+  }
+  *dp = 0;
+  return dp - desc;
+}
+#endif // USE_UFILESYS
+
 #ifdef USE_DISPLAY_MODES1TO5
 
 void UDISP_PrintLog(void) {
@@ -925,6 +925,16 @@ bool Ws2812StripConfigured(void) {
 size_t Ws2812StripGetPixelSize(void) {
   return strip->PixelSize();
 }
+size_t Ws2812StripGetPixelCount(void) {
+  return strip->PixelCount();
+}
+// direct access to the working framebuffer so ArtNet can receive DMX data in place
+uint8_t * Ws2812StripPixels(void) {
+  return strip->Pixels();
+}
+void Ws2812StripDirty(void) {
+  strip->Dirty();
+}
 // return true if strip was dirty and an actual refresh was triggered
 bool Ws2812StripRefresh(void) {
   if (strip->IsDirty()) {
@@ -832,8 +832,9 @@ void CmndPixels(void)
       Light.update = true;
     }
   }
-  Response_P(PSTR("{\"Pixels\":%i,\"PixelsReverse\":%i,\"PixelsHeight\":%i,\"PixelsAlternate\":%i}"),
-    Settings->light_pixels, Settings->light_pixels_reverse, Settings->light_pixels_height_1 + 1, Settings->light_pixels_alternate);
+  Response_P(PSTR("{\"Pixels\":%i,\"PixelsReverse\":%i,\"PixelsHeight\":%i,\"PixelsAlternate\":%i,\"FramesDropped\":%u}"),
+    Settings->light_pixels, Settings->light_pixels_reverse, Settings->light_pixels_height_1 + 1, Settings->light_pixels_alternate,
+    (strip) ? strip->FramesDropped() : 0);
 }
 
 void CmndPixelType(void)
@@ -913,6 +914,16 @@ bool Ws2812StripConfigured(void) {
 size_t Ws2812StripGetPixelSize(void) {
   return strip->PixelSize();
 }
+size_t Ws2812StripGetPixelCount(void) {
+  return strip->PixelCount();
+}
+// direct access to the working framebuffer so ArtNet can receive DMX data in place
+uint8_t * Ws2812StripPixels(void) {
+  return strip->Pixels();
+}
+void Ws2812StripDirty(void) {
+  strip->Dirty();
+}
 // return true if strip was dirty and an actual refresh was triggered
 bool Ws2812StripRefresh(void) {
   if (strip->IsDirty()) {
@@ -945,6 +956,9 @@ bool Xlgt01(uint32_t function)
     case FUNC_SET_SCHEME:
       Ws2812ShowScheme();
       break;
+    case FUNC_LOOP:
+      if (strip) { strip->Loop(); }    // Send a frame held back while the previous one was still on the wire
+      break;
     case FUNC_COMMAND:
       result = DecodeCommand(kWs2812Commands, Ws2812Command);
       break;
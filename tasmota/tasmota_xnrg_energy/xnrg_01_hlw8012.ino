@@ -40,6 +40,9 @@
 #define HLW_POWER_PROBE_TIME   10    // Number of seconds to probe for power before deciding none used (low power pulse can take up to 10 seconds)
 #define HLW_SAMPLE_COUNT       10    // Max number of samples per cycle
 
+#define HLW_EDGE_RING_SIZE     16    // Number of CF edge timestamps kept by the ISR, must be a power of two
+#define HLW_EDGE_WINDOW_US  1000000  // Accumulation window for power in us (1 second)
+
 //#define HLW_DEBUG
 
 struct HLW {
@@ -48,8 +51,8 @@ struct HLW {
 #endif
   volatile uint32_t cf_pulse_length = 0;
   volatile uint32_t cf_pulse_last_time = 0;
-  volatile uint32_t cf_summed_pulse_length = 0;
-  volatile uint32_t cf_pulse_counter = 0;
+  volatile uint32_t cf_edge_ring[HLW_EDGE_RING_SIZE];  // CF edge timestamps in us, written by the ISR
+  volatile uint32_t cf_edge_head = 0;                  // Number of CF edges captured, free running
   uint32_t cf_power_pulse_length  = 0;
 
   volatile uint32_t cf1_pulse_length = 0;
@@ -89,10 +92,10 @@ void HlwCfInterrupt(void) {  // Service Power
   } else {
     Hlw.cf_pulse_length = us - Hlw.cf_pulse_last_time;
     Hlw.cf_pulse_last_time = us;
-    Hlw.cf_summed_pulse_length += Hlw.cf_pulse_length;
-    Hlw.cf_pulse_counter++;
     Hlw.energy_period_counter++;
   }
+  Hlw.cf_edge_ring[Hlw.cf_edge_head & (HLW_EDGE_RING_SIZE -1)] = us;
+  Hlw.cf_edge_head++;
   Energy->data_valid[0] = 0;
 }
 
@@ -116,27 +119,63 @@ void HlwCf1Interrupt(void) {  // Service Voltage and Current
 
 /********************************************************************************************/
 
-void HlwEvery200ms(void) {
-  uint32_t cf1_pulse_length = 0;
+// Windowed power accumulation over the CF edge timestamps captured by the ISR.
+// The mean pulse length is derived from the edges that fall within the last
+// HLW_EDGE_WINDOW_US, independent of tick boundaries, so fast changing loads
+// no longer alias against the polling period.
+void HlwEvery100ms(void) {
   uint32_t hlw_w = 0;
-  uint32_t hlw_u = 0;
-  uint32_t hlw_i = 0;
 
-  if (micros() - Hlw.cf_pulse_last_time > (HLW_POWER_PROBE_TIME * 1000000)) {
+  uint32_t now = micros();
+  if (now - Hlw.cf_pulse_last_time > (HLW_POWER_PROBE_TIME * 1000000)) {
     Hlw.cf_pulse_length = 0;    // No load for some time
     Hlw.load_off = true;
   }
-  Hlw.cf_power_pulse_length = Hlw.cf_pulse_length;
-  if (Hlw.cf_pulse_counter && !Hlw.load_off) {
-    Hlw.cf_power_pulse_length = Hlw.cf_summed_pulse_length / Hlw.cf_pulse_counter;
+
+  // Walk the edge ring from the newest edge backwards while staying inside the window.
+  // The ISR may append edges while scanning: an overwritten slot then holds a timestamp
+  // newer than `newest` which makes the unsigned age check fail and ends the scan early.
+  uint32_t head = Hlw.cf_edge_head;
+  uint32_t edges = (head < HLW_EDGE_RING_SIZE) ? head : HLW_EDGE_RING_SIZE;
+  uint32_t mean_pulse_length = 0;
+  if (edges) {
+    uint32_t newest = Hlw.cf_edge_ring[(head -1) & (HLW_EDGE_RING_SIZE -1)];
+    uint32_t oldest = newest;
+    uint32_t pulses = 0;
+    for (uint32_t i = 1; i < edges; i++) {
+      uint32_t ts = Hlw.cf_edge_ring[(head -1 - i) & (HLW_EDGE_RING_SIZE -1)];
+      if ((uint32_t)(newest - ts) > HLW_EDGE_WINDOW_US) { break; }
+      oldest = ts;
+      pulses++;
+    }
+    if (pulses) {
+      mean_pulse_length = (newest - oldest) / pulses;
+      // Fast downswing: if the next pulse is overdue the load must have dropped,
+      // the elapsed time since the last edge is a lower bound for the pulse length
+      uint32_t since_last_edge = now - newest;
+      if (since_last_edge > mean_pulse_length) {
+        mean_pulse_length = since_last_edge;
+      }
+    }
   }
-  Hlw.cf_summed_pulse_length = 0;
-  Hlw.cf_pulse_counter = 0;
+  if (!mean_pulse_length) {
+    // Fewer than two edges in the window - a low power load can pulse slower than
+    // once a second (up to HLW_POWER_PROBE_TIME), fall back to the last completed
+    // pulse with the same overdue lower bound
+    mean_pulse_length = Hlw.cf_pulse_length;
+    if (mean_pulse_length) {
+      uint32_t since_last_edge = now - Hlw.cf_pulse_last_time;
+      if (since_last_edge > mean_pulse_length) {
+        mean_pulse_length = since_last_edge;
+      }
+    }
+  }
+  Hlw.cf_power_pulse_length = mean_pulse_length;
 
   if (Hlw.cf_power_pulse_length  && Energy->power_on && !Hlw.load_off) {
     hlw_w = (Hlw.power_ratio * EnergyGetCalibration(ENERGY_POWER_CALIBRATION)) / Hlw.cf_power_pulse_length ;  // W *10
     Energy->active_power[0] = (float)hlw_w / 10;
-    Hlw.power_retry = 1;        // Workaround issue #5161
+    Hlw.power_retry = 2;        // Workaround issue #5161, 2 ticks of 100ms keep the original 200ms grace
   } else {
     if (Hlw.power_retry) {
       Hlw.power_retry--;
@@ -144,6 +183,12 @@ void HlwEvery200ms(void) {
       Energy->active_power[0] = 0;
     }
   }
+}
+
+void HlwEvery200ms(void) {
+  uint32_t cf1_pulse_length = 0;
+  uint32_t hlw_u = 0;
+  uint32_t hlw_i = 0;
 
   if (PinUsed(GPIO_NRG_CF1)) {
     Hlw.cf1_timer++;
@@ -319,6 +364,9 @@ bool Xnrg01(uint32_t function) {
   bool result = false;
 
   switch (function) {
+    case FUNC_EVERY_100_MSECOND:
+      HlwEvery100ms();
+      break;
     case FUNC_EVERY_200_MSECOND:
       HlwEvery200ms();
       break;
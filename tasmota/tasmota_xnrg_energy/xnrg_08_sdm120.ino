@@ -39,6 +39,35 @@
 #include <TasmotaModbus.h>
 TasmotaModbus *Sdm120Modbus;
 
+#ifdef SDM120_HIGH_UPDATE_RATE
+const uint8_t sdm120_table = 3;   // Request blocks without the SDM220 extended registers
+const uint8_t sdm220_table = 4;
+
+struct sSdm120RequestConfig {
+  uint16_t startAddress;
+  uint8_t  registerToRead; // according to spec: max 80 register can be read a once
+};
+
+// Block reads span the unused registers in between which the meter returns as zero
+const struct sSdm120RequestConfig sdm120ReqConf[] {
+  {0x0000, 16*2},  // 0x0000 - 0x001F Voltage, current, power, apparent power, reactive power, power factor
+  {0x0046, 5*2},   // 0x0046 - 0x004F Frequency and SDM220 import/export active and reactive energy
+  {0x0156, 1*2},   // 0x0156          Total active energy
+  {0x0024, 1*2}    // 0x0024          SDM220 phase angle
+};
+
+/* convert data buffer to float value according to IEEE754 */
+float Sdm120ConvBufToFloat(uint8_t *buffer)
+{
+  float value;
+
+  ((uint8_t*)&value)[3] = buffer[0];   // Get float values
+  ((uint8_t*)&value)[2] = buffer[1];
+  ((uint8_t*)&value)[1] = buffer[2];
+  ((uint8_t*)&value)[0] = buffer[3];
+  return value;
+}
+#else
 const uint8_t sdm120_table = 8;
 const uint8_t sdm220_table = 13;
 
@@ -58,6 +87,7 @@ const uint16_t sdm120_start_addresses[] {
   0X004E,   // SDM220_EXPORT_REACTIVE      [kvarh]
   0X0024    // SDM220_PHASE_ANGLE          [Degree]
 };
+#endif  // SDM120_HIGH_UPDATE_RATE
 
 struct SDM120 {
   float total_active = 0;
@@ -72,21 +102,81 @@ struct SDM120 {
 
 /*********************************************************************************************/
 
+#ifdef SDM120_HIGH_UPDATE_RATE
+uint32_t Sdm120RegisterCount(void)
+{
+  if ((1 == Sdm120.read_state) && (sdm120_table == Sdm120.start_address_count)) {
+    return 1*2;                    // Frequency only, the SDM220 extended registers are not available
+  }
+  return sdm120ReqConf[Sdm120.read_state].registerToRead;
+}
+#endif  // SDM120_HIGH_UPDATE_RATE
+
 void SDM120Every250ms(void)
 {
   bool data_ready = Sdm120Modbus->ReceiveReady();
 
   if (data_ready) {
+#ifdef SDM120_HIGH_UPDATE_RATE
+    uint8_t buffer[72];  // At least 5 + (2 * 16*2) = 69
+
+    uint32_t error = Sdm120Modbus->ReceiveBuffer(buffer, Sdm120RegisterCount());
+#else
     uint8_t buffer[14];  // At least 5 + (2 * 2) = 9
 
     uint32_t error = Sdm120Modbus->ReceiveBuffer(buffer, 2);
+#endif  // SDM120_HIGH_UPDATE_RATE
     AddLogBuffer(LOG_LEVEL_DEBUG_MORE, buffer, Sdm120Modbus->ReceiveCount());
 
     if (error) {
       AddLog(LOG_LEVEL_DEBUG, PSTR("SDM: SDM120 error %d"), error);
+#ifdef SDM120_HIGH_UPDATE_RATE
+      if ((2 == error) && (1 == Sdm120.read_state) && (sdm220_table == Sdm120.start_address_count)) {
+        Sdm120.start_address_count = sdm120_table;  // Illegal data address - no SDM220 extended registers
+      }
+#endif  // SDM120_HIGH_UPDATE_RATE
     } else {
       Energy->data_valid[0] = 0;
 
+#ifdef SDM120_HIGH_UPDATE_RATE
+      switch(Sdm120.read_state) {
+        case 0: // start address 0x0000
+          Energy->voltage[0] = Sdm120ConvBufToFloat(&buffer[3]);           // 230.2 V
+          //0x0006
+          Energy->current[0] = Sdm120ConvBufToFloat(&buffer[15]);          // 1.260 A
+          //0x000C
+          Energy->active_power[0] = Sdm120ConvBufToFloat(&buffer[27]);     // -196.3 W
+          //0x0012
+          Energy->apparent_power[0] = Sdm120ConvBufToFloat(&buffer[39]);   // 223.4 VA
+          //0x0018
+          Energy->reactive_power[0] = Sdm120ConvBufToFloat(&buffer[51]);   // 92.2
+          //0x001E
+          Energy->power_factor[0] = Sdm120ConvBufToFloat(&buffer[63]);     // -0.91
+          break;
+
+        case 1: // start address 0x0046
+          Energy->frequency[0] = Sdm120ConvBufToFloat(&buffer[3]);         // 50.0 Hz
+          if (sdm220_table == Sdm120.start_address_count) {
+            //0x0048
+            Sdm120.import_active = Sdm120ConvBufToFloat(&buffer[7]);       // 478.492 kWh
+            //0x004A
+            Energy->export_active[0] = Sdm120ConvBufToFloat(&buffer[11]);  // 6.216 kWh
+            //0x004C
+            Sdm120.import_reactive = Sdm120ConvBufToFloat(&buffer[15]);    // 172.750 kvarh
+            //0x004E
+            Sdm120.export_reactive = Sdm120ConvBufToFloat(&buffer[19]);    // 2.844 kvarh
+          }
+          break;
+
+        case 2: // start address 0x0156
+          Sdm120.total_active = Sdm120ConvBufToFloat(&buffer[3]);          // 484.708 kWh = import_active + export_active
+          break;
+
+        case 3: // start address 0x0024
+          Sdm120.phase_angle = Sdm120ConvBufToFloat(&buffer[3]);           // 0.00 Deg
+          break;
+      }
+#else
       //  0  1  2  3  4  5  6  7  8
       // SA FC BC Fh Fl Sh Sl Cl Ch
       // 01 04 04 43 66 33 34 1B 38 = 230.2 Volt
@@ -149,6 +239,7 @@ void SDM120Every250ms(void)
           Sdm120.phase_angle = value;      // 0.00 Deg
           break;
       }
+#endif  // SDM120_HIGH_UPDATE_RATE
 
       Sdm120.read_state++;
       if (Sdm120.read_state == Sdm120.start_address_count) {
@@ -169,7 +260,11 @@ void SDM120Every250ms(void)
 
   if (0 == Sdm120.send_retry || data_ready) {
     Sdm120.send_retry = 5;
+#ifdef SDM120_HIGH_UPDATE_RATE
+    Sdm120Modbus->Send(SDM120_ADDR, 0x04, sdm120ReqConf[Sdm120.read_state].startAddress, Sdm120RegisterCount());
+#else
     Sdm120Modbus->Send(SDM120_ADDR, 0x04, sdm120_start_addresses[Sdm120.read_state], 2);
+#endif  // SDM120_HIGH_UPDATE_RATE
   } else {
     Sdm120.send_retry--;
   }
@@ -38,6 +38,10 @@
 
 #define ADE7880_MORE_REGS                    // Add Neutral Current information
 
+//#define ADE7880_HARMONICS                    // Add harmonic engine readout (THD and three harmonic orders on a selectable phase)
+                                             //   With USE_FLOG one power quality record per line cycle interrupt can be logged to the
+                                             //   OTA partition and downloaded as CSV from /pqlog (EnergyConfig PqLog1 .. PqLog0)
+
 //#define ADE7880_DEBUG
 //#define ADE7880_PROFILING
 
@@ -285,6 +289,14 @@ enum Ade7880PowerQualityRegisters {
 
 struct Ade7880 {
   float neutral_current;
+#ifdef ADE7880_HARMONICS
+  float fundamental_voltage;           // Rms of the voltage fundamental component
+  float fundamental_current;           // Rms of the current fundamental component
+  float thd_voltage;                   // Voltage total harmonic distortion in percent
+  float thd_current;                   // Current total harmonic distortion in percent
+  float harmonic_voltage[3];           // Harmonic voltage rms of the monitored orders
+  float harmonic_current[3];           // Harmonic current rms of the monitored orders
+#endif  // ADE7880_HARMONICS
   int32_t calib_current[4];
   int32_t calib_voltage[3];
   int32_t calib_acpower[3];
@@ -293,8 +305,27 @@ struct Ade7880 {
   bool irq0_state;
   uint8_t cycle_count;
   uint8_t watchdog;
+#ifdef ADE7880_HARMONICS
+  uint8_t harmonic_order[3];           // Harmonic orders monitored by the HX, HY and HZ computations
+  uint8_t harmonic_phase;              // Phase monitored by the harmonic engine (0..2)
+  bool pq_record;                      // Log a power quality record on every line cycle interrupt
+#endif  // ADE7880_HARMONICS
 } Ade7880;
 
+#if defined(ADE7880_HARMONICS) && defined(USE_FLOG)
+#define ADE7880_PQLOG_ID        0x78         // Flash log record namespace
+
+struct Ade7880PqRec {
+  uint32_t time;                       // Utc time of the line cycle interrupt
+  float fundamental_voltage;
+  float fundamental_current;
+  float thd_voltage;
+  float thd_current;
+  float harmonic_voltage[3];
+  float harmonic_current[3];
+};
+#endif  // ADE7880_HARMONICS and USE_FLOG
+
 /*********************************************************************************************/
 
 int Ade7880RegSize(uint16_t reg) {
@@ -455,6 +486,12 @@ bool Ade7880Init(void) {
     return false;
   }
   Ade7880Write(ADE7880_MASK0, 0x00000020);                                 // 0xE50A
+#ifdef ADE7880_HARMONICS
+  Ade7880Write(ADE7880_HX, Ade7880.harmonic_order[0]);                     // 0xEA08 - Harmonic order monitored by the X computations
+  Ade7880Write(ADE7880_HY, Ade7880.harmonic_order[1]);                     // 0xEA09 - Harmonic order monitored by the Y computations
+  Ade7880Write(ADE7880_HZ, Ade7880.harmonic_order[2]);                     // 0xEA0A - Harmonic order monitored by the Z computations
+  Ade7880WriteVerify(ADE7880_HCONFIG, 0x0008 | (Ade7880.harmonic_phase << 1));  // 0xE900 - Phase monitored by the harmonic engine, default 125us update rate
+#endif  // ADE7880_HARMONICS
   Ade7880Write(ADE7880_DSPWP_SEL, 0xAD);                                   // 0xE7FE - Select DSP write protection
   Ade7880Write(ADE7880_DSPWP_SET, 0x80);                                   // 0xE7E3 - Write protect DSP area
   Ade7880WriteVerify(ADE7880_Run, 0x0201);                                 // 0xE228 - Start DSP
@@ -561,11 +598,45 @@ void Ade7880Cycle(void) {
   }
   EnergyUpdateToday();
 
+#ifdef ADE7880_HARMONICS
+  Ade7880Harmonics();
+#endif  // ADE7880_HARMONICS
+
 #ifdef ADE7880_PROFILING
   AddLog(LOG_LEVEL_DEBUG, PSTR("A78: Cycle in %d ms"), millis() - start);
 #endif  // ADE7880_PROFILING
 }
 
+#ifdef ADE7880_HARMONICS
+void Ade7880Harmonics(void) {
+  Ade7880.fundamental_voltage = (float)Ade7880ReadVerify(ADE7880_FVRMS) / 10000;   // 0xE880
+  Ade7880.fundamental_current = (float)Ade7880ReadVerify(ADE7880_FIRMS) / 100000;  // 0xE881
+  // VTHD and ITHD hold the ratio of harmonic rms to fundamental rms in 3.21 format
+  Ade7880.thd_voltage = (float)Ade7880ReadVerify(ADE7880_VTHD) * 100 / 0x200000;   // 0xE886
+  Ade7880.thd_current = (float)Ade7880ReadVerify(ADE7880_ITHD) * 100 / 0x200000;   // 0xE887
+  for (uint32_t i = 0; i < 3; i++) {
+    Ade7880.harmonic_voltage[i] = (float)Ade7880ReadVerify(ADE7880_HXVRMS + (i * 8)) / 10000;   // 0xE888, 0xE890, 0xE898
+    Ade7880.harmonic_current[i] = (float)Ade7880ReadVerify(ADE7880_HXIRMS + (i * 8)) / 100000;  // 0xE889, 0xE891, 0xE899
+  }
+
+#ifdef USE_FLOG
+  if (Ade7880.pq_record && Flog && Flog->recording) {
+    struct Ade7880PqRec record;
+    record.time = Rtc.utc_time;
+    record.fundamental_voltage = Ade7880.fundamental_voltage;
+    record.fundamental_current = Ade7880.fundamental_current;
+    record.thd_voltage = Ade7880.thd_voltage;
+    record.thd_current = Ade7880.thd_current;
+    for (uint32_t i = 0; i < 3; i++) {
+      record.harmonic_voltage[i] = Ade7880.harmonic_voltage[i];
+      record.harmonic_current[i] = Ade7880.harmonic_current[i];
+    }
+    Flog->addRecord(ADE7880_PQLOG_ID, (const uint8_t *)&record);
+  }
+#endif  // USE_FLOG
+}
+#endif  // ADE7880_HARMONICS
+
 void Ade7880Service0(void) {
   // Poll sequence
   Ade7880Cycle();
@@ -634,6 +705,20 @@ bool Ade7880SetDefaults(const char* json) {
     val = angles[PSTR("angle2")];
     if (val) { Ade7880.calib_angle[2] = val.getUInt(); }
   }
+#ifdef ADE7880_HARMONICS
+  // {"harmonics":{"phase":0,"hx":3,"hy":5,"hz":7}}
+  JsonParserObject harmonics = root[PSTR("harmonics")].getObject();
+  if (harmonics) {
+    val = harmonics[PSTR("phase")];
+    if (val) { Ade7880.harmonic_phase = val.getUInt() % 3; }
+    val = harmonics[PSTR("hx")];
+    if (val) { Ade7880.harmonic_order[0] = val.getUInt(); }
+    val = harmonics[PSTR("hy")];
+    if (val) { Ade7880.harmonic_order[1] = val.getUInt(); }
+    val = harmonics[PSTR("hz")];
+    if (val) { Ade7880.harmonic_order[2] = val.getUInt(); }
+  }
+#endif  // ADE7880_HARMONICS
   JsonParserObject powers = root[PSTR("powers")].getObject();
   if (powers) {
     JsonParserObject totactive = powers[PSTR("totactive")].getObject();
@@ -664,6 +749,12 @@ void Ade7880Defaults(void) {
   Ade7880.calib_angle[0] = ADE7880_APHCAL_INIT;
   Ade7880.calib_angle[1] = ADE7880_BPHCAL_INIT;
   Ade7880.calib_angle[2] = ADE7880_CPHCAL_INIT;
+#ifdef ADE7880_HARMONICS
+  Ade7880.harmonic_phase = 0;
+  Ade7880.harmonic_order[0] = 3;       // Chip defaults, the odd harmonics dominate on most loads
+  Ade7880.harmonic_order[1] = 5;
+  Ade7880.harmonic_order[2] = 7;
+#endif  // ADE7880_HARMONICS
 
   String calib = "";
 #ifdef USE_UFILESYS
@@ -694,6 +785,13 @@ void Ade7880DrvInit(void) {
       Ade7880Defaults();
 
       if (Ade7880SetCalibrate()) {
+#if defined(ADE7880_HARMONICS) && defined(USE_FLOG)
+        if (!Flog) {
+          Flog = new FLOG;                                                  // Init flash log in OTA partition
+          Flog->init();
+        }
+        Flog->registerNamespace(ADE7880_PQLOG_ID, sizeof(struct Ade7880PqRec));
+#endif  // ADE7880_HARMONICS and USE_FLOG
         Energy->phase_count = 3;                                            // Three phases
 //        Settings->flag5.energy_phase = 1;                                  // SetOption129 - (Energy) Show phase information
 //        Energy->use_overtemp = true;                                        // Use global temperature for overtemp detection
@@ -713,6 +811,25 @@ bool Ade7880Command(void) {
     // EnergyConfig {"rms":{"voltage_c":-549854}}
     // EnergyConfig {"freq":0}
     if (XdrvMailbox.data_len) {
+#if defined(ADE7880_HARMONICS) && defined(USE_FLOG)
+      if (!strncasecmp_P(XdrvMailbox.data, PSTR("PqLog"), 5)) {
+        // EnergyConfig PqLog1 - Record one power quality entry per line cycle until the OTA partition is full
+        // EnergyConfig PqLog2 - Record wrapping around, overwriting the oldest sectors
+        // EnergyConfig PqLog0 - Stop recording, download the result from /pqlog
+        uint32_t state = atoi(XdrvMailbox.data + 5);
+        if (state) {
+          if (!Flog->recording) {
+            Flog->mode = (2 == state) ? 1 : 0;
+            Flog->startRecording(false);
+          }
+        } else if (Flog->recording) {
+          Flog->stopRecording();
+        }
+        Ade7880.pq_record = (state != 0);
+        Response_P(PSTR("{\"PqLog\":%d}"), Ade7880.pq_record);
+        return true;
+      }
+#endif  // ADE7880_HARMONICS and USE_FLOG
 #ifdef ADE7880_DEBUG
       if ('1' == XdrvMailbox.data[0]) {
         // EnergyConfig 1 - Dump DSP data memory (0x4380..0x43B9)
@@ -764,21 +881,65 @@ bool Ade7880Command(void) {
   return serviced;
 }
 
+/*********************************************************************************************\
+ * Power quality log download
+\*********************************************************************************************/
+
+#if defined(ADE7880_HARMONICS) && defined(USE_FLOG) && defined(USE_WEBSERVER)
+void Ade7880PqLogDownload(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  Webserver->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  Webserver->sendHeader(F("Content-Disposition"), F("attachment; filename=PQLOG.csv"));
+  WSSend(200, CT_APP_STREAM, F("Time,FundVoltage,FundCurrent,THDVoltage,THDCurrent,HxVoltage,HxCurrent,HyVoltage,HyCurrent,HzVoltage,HzCurrent\r\n"));
+  if (Flog->startIteration(ADE7880_PQLOG_ID)) {    // Consumes the active recording buffer
+    struct Ade7880PqRec record;
+    char line[180];
+    while (Flog->nextRecord((uint8_t *)&record)) {
+      ext_snprintf_P(line, sizeof(line), PSTR("%s,%2_f,%3_f,%2_f,%2_f,%2_f,%3_f,%2_f,%3_f,%2_f,%3_f\r\n"),
+        GetDT(record.time).c_str(),
+        &record.fundamental_voltage, &record.fundamental_current,
+        &record.thd_voltage, &record.thd_current,
+        &record.harmonic_voltage[0], &record.harmonic_current[0],
+        &record.harmonic_voltage[1], &record.harmonic_current[1],
+        &record.harmonic_voltage[2], &record.harmonic_current[2]);
+      Webserver->sendContent(line);
+    }
+    Flog->stopIteration();
+  }
+  Webserver->sendContent("");
+}
+#endif  // ADE7880_HARMONICS and USE_FLOG and USE_WEBSERVER
+
 /*********************************************************************************************\
  * Show
 \*********************************************************************************************/
 
-#ifdef ADE7880_MORE_REGS
+#if defined(ADE7880_MORE_REGS) || defined(ADE7880_HARMONICS)
 void Ade7880Show(bool json) {
   if (json) {
+#ifdef ADE7880_MORE_REGS
     ResponseAppend_P(PSTR(",\"" D_JSON_CURRENT_NEUTRAL "\":%s"), EnergyFmt(&Ade7880.neutral_current, Settings->flag2.current_resolution, 1));
+#endif  // ADE7880_MORE_REGS
+#ifdef ADE7880_HARMONICS
+    ResponseAppend_P(PSTR(",\"THDVoltage\":%2_f,\"THDCurrent\":%2_f"), &Ade7880.thd_voltage, &Ade7880.thd_current);
+    ResponseAppend_P(PSTR(",\"Harmonic\":{\"H%d\":[%2_f,%3_f],\"H%d\":[%2_f,%3_f],\"H%d\":[%2_f,%3_f]}"),
+      Ade7880.harmonic_order[0], &Ade7880.harmonic_voltage[0], &Ade7880.harmonic_current[0],
+      Ade7880.harmonic_order[1], &Ade7880.harmonic_voltage[1], &Ade7880.harmonic_current[1],
+      Ade7880.harmonic_order[2], &Ade7880.harmonic_voltage[2], &Ade7880.harmonic_current[2]);
+#endif  // ADE7880_HARMONICS
 #ifdef USE_WEBSERVER
   } else {
+#ifdef ADE7880_MORE_REGS
     WSContentSend_PD(HTTP_SNS_CURRENT_N, WebEnergyFmt(&Ade7880.neutral_current, Settings->flag2.current_resolution, 1));
+#endif  // ADE7880_MORE_REGS
+#ifdef ADE7880_HARMONICS
+    WSContentSend_PD(PSTR("{s}THD " D_VOLTAGE "{m}%2_f %%{e}{s}THD " D_CURRENT "{m}%2_f %%{e}"), &Ade7880.thd_voltage, &Ade7880.thd_current);
+#endif  // ADE7880_HARMONICS
 #endif  // USE_WEBSERVER
   }
 }
-#endif  // ADE7880_MORE_REGS
+#endif  // ADE7880_MORE_REGS or ADE7880_HARMONICS
 
 /*********************************************************************************************\
  * Interface
@@ -796,7 +957,7 @@ bool Xnrg23(uint32_t function) {
     case FUNC_EVERY_SECOND:
       Ade7880Watchdog();
       break;
-#ifdef ADE7880_MORE_REGS
+#if defined(ADE7880_MORE_REGS) || defined(ADE7880_HARMONICS)
     case FUNC_JSON_APPEND:
       Ade7880Show(1);
       break;
@@ -805,7 +966,12 @@ bool Xnrg23(uint32_t function) {
       Ade7880Show(0);
       break;
 #endif  // USE_WEBSERVER
-#endif  // ADE7880_MORE_REGS
+#endif  // ADE7880_MORE_REGS or ADE7880_HARMONICS
+#if defined(ADE7880_HARMONICS) && defined(USE_FLOG) && defined(USE_WEBSERVER)
+    case FUNC_WEB_ADD_HANDLER:
+      WebServer_on(PSTR("/pqlog"), Ade7880PqLogDownload);
+      break;
+#endif  // ADE7880_HARMONICS and USE_FLOG and USE_WEBSERVER
     case FUNC_COMMAND:
       result = Ade7880Command();
       break;
@@ -141,6 +141,7 @@ struct NRGMBSPARAM {
   uint8_t user_adds;
   uint8_t state;
   uint8_t retry;
+  uint8_t block_phases;
   int8_t phase;
   bool mutex;
 } NrgMbsParam;
@@ -176,11 +177,12 @@ void EnergyModbusLoop(void) {
   bool data_ready = EnergyModbus->ReceiveReady();
 
   if (data_ready) {
-    uint8_t buffer[15];  // At least 5 + (2 * 2) = 9
+    uint8_t buffer[40];  // At least 5 + (2 * 2 * ENERGY_MAX_PHASES) = 37 for a full phase block
 
     // Even data type is single register, Odd data type is double registers
     register_count = 2 - (NrgMbsReg[NrgMbsParam.state].datatype & 1);
-    uint32_t error = EnergyModbus->ReceiveBuffer(buffer, register_count);
+    uint32_t block_phases = NrgMbsParam.block_phases ? NrgMbsParam.block_phases : 1;
+    uint32_t error = EnergyModbus->ReceiveBuffer(buffer, register_count * block_phases);
     if (error) {
       /* Return codes from TasmotaModbus.h:
       * 0 = No error
@@ -216,113 +218,118 @@ void EnergyModbusLoop(void) {
       * Cl = CRC lsb
       * Ch = CRC msb
       */
-      Energy->data_valid[NrgMbsParam.phase] = 0;
-
-      float value;
-      switch (NrgMbsReg[NrgMbsParam.state].datatype) {
-        case NRG_DT_FLOAT: {  // 0
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          // 01 04 04 43 66 33 34 1B 38 = 230.2 Volt
-          ((uint8_t*)&value)[3] = buffer[3];   // Get float values
-          ((uint8_t*)&value)[2] = buffer[4];
-          ((uint8_t*)&value)[1] = buffer[5];
-          ((uint8_t*)&value)[0] = buffer[6];
-          break;
-        }
-        case NRG_DT_S16: {  // 1
-          //  0  1  2  3  4  5  6
-          // SA FC BC Fh Fl Cl Ch
-          int16_t value_buff = ((int16_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_U16: {  // 3
-          //  0  1  2  3  4  5  6
-          // SA FC BC Fh Fl Cl Ch
-          uint16_t value_buff = ((uint16_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_S32: {  // 2
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          int32_t value_buff = ((int32_t)buffer[3])<<24 | ((uint32_t)buffer[4])<<16 | ((uint32_t)buffer[5])<<8 | buffer[6];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_S32_SW: {  // 6
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Sh Sl Fh Fl Cl Ch
-          int32_t value_buff = ((int32_t)buffer[5])<<24 | ((uint32_t)buffer[6])<<16 | ((uint32_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
+      // A block read returns the values of contiguous phases back to back in one frame
+      for (uint32_t block = 0; block < block_phases; block++) {
+        uint32_t phase = NrgMbsParam.phase + block;
+        uint8_t* data = &buffer[3 + (block * (register_count << 1))];
+        Energy->data_valid[phase] = 0;
+
+        float value;
+        switch (NrgMbsReg[NrgMbsParam.state].datatype) {
+          case NRG_DT_FLOAT: {  // 0
+            //  0  1  2  3  4  5  6  7  8
+            // SA FC BC Fh Fl Sh Sl Cl Ch
+            // 01 04 04 43 66 33 34 1B 38 = 230.2 Volt
+            ((uint8_t*)&value)[3] = data[0];   // Get float values
+            ((uint8_t*)&value)[2] = data[1];
+            ((uint8_t*)&value)[1] = data[2];
+            ((uint8_t*)&value)[0] = data[3];
+            break;
+          }
+          case NRG_DT_S16: {  // 1
+            //  0  1  2  3  4  5  6
+            // SA FC BC Fh Fl Cl Ch
+            int16_t value_buff = ((int16_t)data[0])<<8 | data[1];
+            value = (float)value_buff;
+            break;
+          }
+          case NRG_DT_U16: {  // 3
+            //  0  1  2  3  4  5  6
+            // SA FC BC Fh Fl Cl Ch
+            uint16_t value_buff = ((uint16_t)data[0])<<8 | data[1];
+            value = (float)value_buff;
+            break;
+          }
+          case NRG_DT_S32: {  // 2
+            //  0  1  2  3  4  5  6  7  8
+            // SA FC BC Fh Fl Sh Sl Cl Ch
+            int32_t value_buff = ((int32_t)data[0])<<24 | ((uint32_t)data[1])<<16 | ((uint32_t)data[2])<<8 | data[3];
+            value = (float)value_buff;
+            break;
+          }
+          case NRG_DT_S32_SW: {  // 6
+            //  0  1  2  3  4  5  6  7  8
+            // SA FC BC Sh Sl Fh Fl Cl Ch
+            int32_t value_buff = ((int32_t)data[2])<<24 | ((uint32_t)data[3])<<16 | ((uint32_t)data[0])<<8 | data[1];
+            value = (float)value_buff;
+            break;
+          }
+          case NRG_DT_U32: {  // 4
+            //  0  1  2  3  4  5  6  7  8
+            // SA FC BC Fh Fl Sh Sl Cl Ch
+            uint32_t value_buff = ((uint32_t)data[0])<<24 | ((uint32_t)data[1])<<16 | ((uint32_t)data[2])<<8 | data[3];
+            value = (float)value_buff;
+            break;
+          }
+          case NRG_DT_U32_SW: {  // 8
+            //  0  1  2  3  4  5  6  7  8
+            // SA FC BC Sh Sl Fh Fl Cl Ch
+            // 01 04 04 EB EC 00 0E 8E 51 = 977.9000 (Solax protocol X1&X3)
+            uint32_t value_buff = ((uint32_t)data[2])<<24 | ((uint32_t)data[3])<<16 | ((uint32_t)data[0])<<8 | data[1];
+            value = (float)value_buff;
+            break;
+          }
         }
-        case NRG_DT_U32: {  // 4
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          uint32_t value_buff = ((uint32_t)buffer[3])<<24 | ((uint32_t)buffer[4])<<16 | ((uint32_t)buffer[5])<<8 | buffer[6];
-          value = (float)value_buff;
-          break;
+        uint32_t factor = 1;
+        // 1 = 10, 2 = 100, 3 = 1000, 4 = 10000
+        uint32_t scaler = abs(NrgMbsReg[NrgMbsParam.state].factor);
+        while (scaler) {
+          factor *= 10;
+          scaler--;
         }
-        case NRG_DT_U32_SW: {  // 8
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Sh Sl Fh Fl Cl Ch
-          // 01 04 04 EB EC 00 0E 8E 51 = 977.9000 (Solax protocol X1&X3)
-          uint32_t value_buff = ((uint32_t)buffer[5])<<24 | ((uint32_t)buffer[6])<<16 | ((uint32_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
+        if (NrgMbsReg[NrgMbsParam.state].factor < 0) {
+          value /= factor;
+        } else {
+          value *= factor;
         }
-      }
-      uint32_t factor = 1;
-      // 1 = 10, 2 = 100, 3 = 1000, 4 = 10000
-      uint32_t scaler = abs(NrgMbsReg[NrgMbsParam.state].factor);
-      while (scaler) {
-        factor *= 10;
-        scaler--;
-      }
-      if (NrgMbsReg[NrgMbsParam.state].factor < 0) {
-        value /= factor;
-      } else {
-        value *= factor;
-      }
 
-      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus register %d, phase %d, rcvd %*_H, T %d, F %d, value %4_f"),
-        NrgMbsParam.state, NrgMbsParam.phase, EnergyModbus->ReceiveCount(), buffer,
-        NrgMbsReg[NrgMbsParam.state].datatype, NrgMbsReg[NrgMbsParam.state].factor, &value);
-
-      switch (NrgMbsParam.state) {
-        case NRG_MBS_VOLTAGE:
-          Energy->voltage[NrgMbsParam.phase] = value;          // 230.2 V
-          break;
-        case NRG_MBS_CURRENT:
-          Energy->current[NrgMbsParam.phase]  = value;         // 1.260 A
-          break;
-        case NRG_MBS_ACTIVE_POWER:
-          Energy->active_power[NrgMbsParam.phase] = value;     // -196.3 W
-          break;
-        case NRG_MBS_APPARENT_POWER:
-          Energy->apparent_power[NrgMbsParam.phase] = value;   // 223.4 VA
-          break;
-        case NRG_MBS_REACTIVE_POWER:
-          Energy->reactive_power[NrgMbsParam.phase] = value;   // 92.2
-          break;
-        case NRG_MBS_POWER_FACTOR:
-          Energy->power_factor[NrgMbsParam.phase] = value;     // -0.91
-          break;
-        case NRG_MBS_FREQUENCY:
-          Energy->frequency[NrgMbsParam.phase] = value;        // 50.0 Hz
-          break;
-        case NRG_MBS_TOTAL_ENERGY:
-          Energy->import_active[NrgMbsParam.phase] = value;    // 6.216 kWh => used in EnergyUpdateTotal()
-          break;
-        case NRG_MBS_EXPORT_ACTIVE_ENERGY:
-          Energy->export_active[NrgMbsParam.phase] = value;    // 478.492 kWh
-          break;
-        default:
-          if (NrgMbsUser) {
-            NrgMbsUser[NrgMbsParam.state - NRG_MBS_MAX_REGS].data[NrgMbsParam.phase] = value;
-          }
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus register %d, phase %d, rcvd %*_H, T %d, F %d, value %4_f"),
+          NrgMbsParam.state, phase, EnergyModbus->ReceiveCount(), buffer,
+          NrgMbsReg[NrgMbsParam.state].datatype, NrgMbsReg[NrgMbsParam.state].factor, &value);
+
+        switch (NrgMbsParam.state) {
+          case NRG_MBS_VOLTAGE:
+            Energy->voltage[phase] = value;          // 230.2 V
+            break;
+          case NRG_MBS_CURRENT:
+            Energy->current[phase]  = value;         // 1.260 A
+            break;
+          case NRG_MBS_ACTIVE_POWER:
+            Energy->active_power[phase] = value;     // -196.3 W
+            break;
+          case NRG_MBS_APPARENT_POWER:
+            Energy->apparent_power[phase] = value;   // 223.4 VA
+            break;
+          case NRG_MBS_REACTIVE_POWER:
+            Energy->reactive_power[phase] = value;   // 92.2
+            break;
+          case NRG_MBS_POWER_FACTOR:
+            Energy->power_factor[phase] = value;     // -0.91
+            break;
+          case NRG_MBS_FREQUENCY:
+            Energy->frequency[phase] = value;        // 50.0 Hz
+            break;
+          case NRG_MBS_TOTAL_ENERGY:
+            Energy->import_active[phase] = value;    // 6.216 kWh => used in EnergyUpdateTotal()
+            break;
+          case NRG_MBS_EXPORT_ACTIVE_ENERGY:
+            Energy->export_active[phase] = value;    // 478.492 kWh
+            break;
+          default:
+            if (NrgMbsUser) {
+              NrgMbsUser[NrgMbsParam.state - NRG_MBS_MAX_REGS].data[phase] = value;
+            }
+        }
       }
     }
   } // end data ready
@@ -330,6 +337,11 @@ void EnergyModbusLoop(void) {
   if (0 == NrgMbsParam.retry || data_ready) {
     NrgMbsParam.retry = 1;
 
+    if (NrgMbsParam.block_phases > 1) {
+      NrgMbsParam.phase += NrgMbsParam.block_phases - 1;  // Skip phases covered by the last block read
+    }
+    NrgMbsParam.block_phases = 1;
+
     uint32_t address = 0;
     uint32_t phase = 0;
     do {
@@ -354,14 +366,24 @@ void EnergyModbusLoop(void) {
     // Even data type is single register, Odd data type is double registers
     register_count = 2 - (NrgMbsReg[NrgMbsParam.state].datatype & 1);
 
+    if (1 == NrgMbsParam.devices) {
+      // Merge phases mapped on consecutive register addresses into a single block read
+      while ((phase + NrgMbsParam.block_phases < Energy->phase_count) &&
+             (NrgMbsReg[NrgMbsParam.state].address[phase + NrgMbsParam.block_phases] != nrg_mbs_reg_not_used) &&
+             (NrgMbsReg[NrgMbsParam.state].address[phase + NrgMbsParam.block_phases] ==
+              NrgMbsReg[NrgMbsParam.state].address[phase] + (NrgMbsParam.block_phases * register_count))) {
+        NrgMbsParam.block_phases++;
+      }
+    }
+
 #ifdef ENERGY_MODBUS_DEBUG
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus send Device %d, Function %d, Register %04X (%d/%d), Size %d"),
       NrgMbsParam.device_address[address], NrgMbsParam.function,
       NrgMbsReg[NrgMbsParam.state].address[phase], NrgMbsParam.state, phase,
-      register_count);
+      register_count * NrgMbsParam.block_phases);
 #endif
 
-    EnergyModbus->Send(NrgMbsParam.device_address[address], NrgMbsParam.function, NrgMbsReg[NrgMbsParam.state].address[phase], register_count);
+    EnergyModbus->Send(NrgMbsParam.device_address[address], NrgMbsParam.function, NrgMbsReg[NrgMbsParam.state].address[phase], register_count * NrgMbsParam.block_phases);
   } else {
     NrgMbsParam.retry--;
 
@@ -854,6 +876,13 @@ bool Xnrg29(uint32_t function) {
     case FUNC_EVERY_250_MSECOND:     // Tasmota dispatcher
       EnergyModbusLoop();
       break;
+    case FUNC_LOOP:
+      // Process a response as soon as it is complete so the next request hits the bus
+      // without waiting for the 250ms tick keeping the bus busy during a refresh cycle
+      if (EnergyModbus && EnergyModbus->ReceiveReady()) {
+        EnergyModbusLoop();
+      }
+      break;
 #endif  // No ENERGY_MODBUS_TICKER
     case FUNC_JSON_APPEND:
       EnergyModbusShow(1);
@@ -98,6 +98,93 @@ void CounterIsrArg(void *arg) {
   }
 }
 
+/*********************************************************************************************\
+ * PCNT hardware counting - USE_COUNTER_PCNT
+ *
+ * The PCNT peripheral counts edges in hardware with a glitch filter, so no pulses are lost
+ * when WiFi or flash interrupts pre-empt the GPIO ISR. The 16-bit hardware counter wraps at
+ * its high limit and the 250ms tick folds the deltas into the existing 32-bit running
+ * totals, which supports pulse rates up to 130kHz. Period measurement (CounterType 1) and
+ * counters with a millisecond debounce configured keep the GPIO interrupt.
+\*********************************************************************************************/
+
+#if defined(ESP32) && defined(USE_COUNTER_PCNT)
+
+#include "soc/soc_caps.h"
+#if SOC_PCNT_SUPPORTED
+#include "driver/pulse_cnt.h"
+
+#define COUNTER_PCNT_LIMIT  32767     // Hardware counter wraps to zero at this value
+
+struct COUNTER_PCNT {
+  pcnt_unit_handle_t unit[MAX_COUNTERS];
+  int32_t last[MAX_COUNTERS];
+} CounterPcnt;
+
+bool CounterPcntInit(uint32_t i) {
+  if (CounterPcnt.unit[i]) { return true; }    // Already counting
+  if (bitRead(Settings->pulse_counter_type, i)) { return false; }
+  if (Settings->pulse_counter_debounce || Settings->pulse_counter_debounce_low || Settings->pulse_counter_debounce_high) { return false; }
+  if (Settings->flag4.zerocross_dimmer) { return false; }
+#ifdef USE_AC_ZERO_CROSS_DIMMER
+  if (3 == i) { return false; }                // Counter 4 feeds the zero cross dimmer from the ISR
+#endif  // USE_AC_ZERO_CROSS_DIMMER
+
+  pcnt_unit_config_t unit_config = {};
+  unit_config.low_limit = -COUNTER_PCNT_LIMIT;
+  unit_config.high_limit = COUNTER_PCNT_LIMIT;
+  if (pcnt_new_unit(&unit_config, &CounterPcnt.unit[i]) != ESP_OK) {
+    return false;                              // Out of PCNT units - fall back to the GPIO interrupt
+  }
+
+  pcnt_glitch_filter_config_t filter_config = {};
+  filter_config.max_glitch_ns = 1000;          // Suppress sub-1us glitches in hardware
+  pcnt_unit_set_glitch_filter(CounterPcnt.unit[i], &filter_config);
+
+  pcnt_chan_config_t chan_config = {};
+  chan_config.edge_gpio_num = Pin(GPIO_CNTR1, i);
+  chan_config.level_gpio_num = -1;
+  pcnt_channel_handle_t channel;
+  if (pcnt_new_channel(CounterPcnt.unit[i], &chan_config, &channel) != ESP_OK) {
+    pcnt_del_unit(CounterPcnt.unit[i]);
+    CounterPcnt.unit[i] = nullptr;
+    return false;
+  }
+  // Count the falling edge like the ISR, both edges with SetOption159
+  pcnt_channel_set_edge_action(channel,
+    (Settings->flag6.counter_both_edges) ? PCNT_CHANNEL_EDGE_ACTION_INCREASE : PCNT_CHANNEL_EDGE_ACTION_HOLD,
+    PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+  if (bitRead(Counter.no_pullup, i)) {
+    gpio_pullup_dis((gpio_num_t)Pin(GPIO_CNTR1, i));
+  } else {
+    gpio_pullup_en((gpio_num_t)Pin(GPIO_CNTR1, i));
+  }
+  pcnt_unit_enable(CounterPcnt.unit[i]);
+  pcnt_unit_clear_count(CounterPcnt.unit[i]);
+  pcnt_unit_start(CounterPcnt.unit[i]);
+  CounterPcnt.last[i] = 0;
+  AddLog(LOG_LEVEL_DEBUG, PSTR("CNT: Counter%d uses PCNT"), i +1);
+  return true;
+}
+
+void CounterPcntRead(void) {
+  // Fold the hardware counter deltas into the running totals
+  for (uint32_t i = 0; i < MAX_COUNTERS; i++) {
+    if (CounterPcnt.unit[i]) {
+      int count;
+      pcnt_unit_get_count(CounterPcnt.unit[i], &count);
+      int32_t delta = count - CounterPcnt.last[i];
+      if (delta < 0) { delta += COUNTER_PCNT_LIMIT; }  // Hardware wrapped to zero at the high limit
+      CounterPcnt.last[i] = count;
+      RtcSettings.pulse_counter[i] += delta;
+    }
+  }
+}
+#else
+#undef USE_COUNTER_PCNT                        // No PCNT peripheral on this SoC
+#endif  // SOC_PCNT_SUPPORTED
+#endif  // ESP32 && USE_COUNTER_PCNT
+
 /********************************************************************************************/
 
 void CounterInterruptDisable(bool state)
@@ -165,13 +252,21 @@ uint32_t CounterPinSet(int32_t counter, int32_t value, bool add) {
 }
 
 
+uint8_t * rtc_counter_state = nullptr;  // RTC registry slot preserving the debounce pin state over warm boots
+
 void CounterInit(void)
 {
+  if (nullptr == rtc_counter_state) {
+    rtc_counter_state = RtcRegistryReserve(RTC_REG_COUNTER, sizeof(uint8_t));
+  }
 
   for (uint32_t i = 0; i < MAX_COUNTERS; i++) {
     if (PinUsed(GPIO_CNTR1, i)) {
       Counter.any_counter = true;
       pinMode(Pin(GPIO_CNTR1, i), bitRead(Counter.no_pullup, i) ? INPUT : INPUT_PULLUP);
+#if defined(ESP32) && defined(USE_COUNTER_PCNT)
+      if (CounterPcntInit(i)) { continue; }    // Pulses counted in hardware, no interrupt needed
+#endif  // ESP32 && USE_COUNTER_PCNT
       if ((0 == Settings->pulse_counter_debounce_low) && (0 == Settings->pulse_counter_debounce_high) && !Settings->flag4.zerocross_dimmer) {
         Counter.pin_state = 0;
         attachInterruptArg(Pin(GPIO_CNTR1, i), CounterIsrArg, &ctr_index[i], FALLING);
@@ -181,10 +276,14 @@ void CounterInit(void)
       }
     }
   }
+  if (rtc_counter_state && (0x80 & Counter.pin_state) && (0x80 & *rtc_counter_state)) {
+    Counter.pin_state = *rtc_counter_state;  // Resume the last valid pin levels so dual-edge debounce keeps phase over a warm boot
+  }
 }
 
 void CounterEverySecond(void)
 {
+  if (rtc_counter_state) { *rtc_counter_state = Counter.pin_state; }
   for (uint32_t i = 0; i < MAX_COUNTERS; i++) {
     if (PinUsed(GPIO_CNTR1, i)) {
       if (bitRead(Settings->pulse_counter_type, i)) {
@@ -316,6 +415,11 @@ bool Xsns01(uint32_t function)
 
   if (Counter.any_counter) {
     switch (function) {
+#if defined(ESP32) && defined(USE_COUNTER_PCNT)
+      case FUNC_EVERY_250_MSECOND:
+        CounterPcntRead();
+        break;
+#endif  // ESP32 && USE_COUNTER_PCNT
       case FUNC_EVERY_SECOND:
         CounterEverySecond();
         break;
@@ -681,6 +681,9 @@ bool Xsns05(uint32_t function) {
       case FUNC_EVERY_SECOND:
         Ds18x20EverySecond();
         break;
+      case FUNC_EVENT_MASK:
+        XdrvMailbox.payload = 0;  // No hot tick events handled
+        break;
       case FUNC_JSON_APPEND:
         Ds18x20Show(1);
         break;
@@ -14,6 +14,7 @@
  * Sensor readings may also be up to 2 seconds 'old' (its a very slow sensor)
  *
  * Changelog
+ * 20260830 - Add optional ESP32 RMT capture backend (USE_DHT_RMT)
  * 20230215 - v7
  *          - Add user high and low delay in microseconds
  *            DhtDelay1        - Show delays for first sensor
@@ -248,6 +249,11 @@ bool DhtRead(uint32_t sensor) {
     // stored data.
   }
 
+  return DhtConvertData(sensor);
+}
+
+bool DhtConvertData(uint32_t sensor) {
+  // Validate checksum over dht_data and convert the payload to sensor readings
   uint8_t checksum = (dht_data[0] + dht_data[1] + dht_data[2] + dht_data[3]) & 0xFF;
   if (dht_data[4] != checksum) {
     AddLog(LOG_LEVEL_DEBUG, PSTR("DHT: Pin%d checksum failure %5_H =? %02X"),
@@ -327,6 +333,123 @@ bool DhtRead(uint32_t sensor) {
   return true;
 }
 
+/*********************************************************************************************\
+ * RMT capture backend - USE_DHT_RMT
+ *
+ * The RMT peripheral records the complete response pulse train in hardware, so the
+ * interrupts-off busy-wait above is not needed and WS2812 strings on the same device do not
+ * glitch during a read. The host start signal is still sent by software (interrupts stay
+ * enabled) and the capture is decoded on the next second tick.
+\*********************************************************************************************/
+
+#if defined(ESP32) && defined(USE_DHT_RMT)
+
+#include <esp32-hal-rmt.h>
+
+#define DHT_RMT_SYMBOLS  48                   // Response pulse pair + 40 bit pulse pairs + margin
+
+rmt_data_t DhtRmtSymbols[DHT_MAX_SENSORS][DHT_RMT_SYMBOLS];
+size_t DhtRmtCount[DHT_MAX_SENSORS];
+bool DhtRmtPending[DHT_MAX_SENSORS];
+bool DhtRmtEnabled = false;
+
+void DhtRmtInit(void) {
+  DhtRmtEnabled = true;
+  for (uint32_t i = 0; i < dht_sensors; i++) {
+    if (!rmtInit(Dht[i].pin, RMT_RX_MODE, RMT_MEM_NUM_BLOCKS_2, 1000000)) {  // 1us ticks
+      DhtRmtEnabled = false;                  // Out of RMT channels (WS2812 strings claim them too) - fall back to bit-banging
+      AddLog(LOG_LEVEL_DEBUG, PSTR("DHT: Pin%d no RMT channel, using bit-banging"), Dht[i].pin);
+      return;
+    }
+    rmtSetRxMaxThreshold(Dht[i].pin, 1000);   // Close the capture after 1ms idle - longest protocol pulse is ~80us
+  }
+}
+
+void DhtRmtTrigger(uint32_t sensor) {
+  // Send the host start signal, then hand the line to the RMT peripheral
+  dht_pin = Dht[sensor].pin;
+  if (!dht_dual_mode) {
+    pinMode(dht_pin, INPUT_PULLUP);
+    delay(1);
+    pinMode(dht_pin, OUTPUT);
+    digitalWrite(dht_pin, LOW);
+  } else {
+    digitalWrite(dht_pin_out, LOW);
+  }
+  delayMicroseconds(Dht[sensor].delay_lo);
+  if (!dht_dual_mode) {
+    pinMode(dht_pin, INPUT_PULLUP);
+  } else {
+    digitalWrite(dht_pin_out, HIGH);
+  }
+  // The sensor responds 20..40us after the line is released - the capture is armed within
+  // that window and ends by itself once the line idles high after the last bit
+  DhtRmtCount[sensor] = DHT_RMT_SYMBOLS;
+  DhtRmtPending[sensor] = rmtReadAsync(dht_pin, DhtRmtSymbols[sensor], &DhtRmtCount[sensor]);
+}
+
+bool DhtRmtDecode(uint32_t sensor) {
+  dht_pin = Dht[sensor].pin;
+  if (!DhtRmtPending[sensor] || !rmtReceiveCompleted(dht_pin)) {
+    DhtRmtPending[sensor] = false;
+    AddLog(LOG_LEVEL_DEBUG, PSTR("DHT: Pin%d no RMT capture"), dht_pin);
+    return false;
+  }
+  DhtRmtPending[sensor] = false;
+
+  // Flatten the captured symbols to a level/duration pulse list
+  uint16_t duration[2 * DHT_RMT_SYMBOLS];
+  uint8_t level[2 * DHT_RMT_SYMBOLS];
+  uint32_t pulses = 0;
+  for (uint32_t i = 0; i < DhtRmtCount[sensor]; i++) {
+    level[pulses] = DhtRmtSymbols[sensor][i].level0;
+    duration[pulses++] = DhtRmtSymbols[sensor][i].duration0;
+    if (0 == DhtRmtSymbols[sensor][i].duration1) { break; }  // End marker
+    level[pulses] = DhtRmtSymbols[sensor][i].level1;
+    duration[pulses++] = DhtRmtSymbols[sensor][i].duration1;
+  }
+
+  // Locate the ~80us response low preceding the 40 data bits
+  uint32_t start = 0;
+  while ((start < pulses) && !((0 == level[start]) && (duration[start] >= 60))) { start++; }
+  start += 2;                                 // Skip response low and ~80us response high
+  if (pulses < start + 80) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("DHT: Pin%d RMT capture %d pulses"), dht_pin, pulses);
+    return false;
+  }
+
+  dht_data[0] = dht_data[1] = dht_data[2] = dht_data[3] = dht_data[4] = 0;
+  for (uint32_t i = 0; i < 40; i++) {
+    // Each bit is a ~50us low followed by ~28us (0) or ~70us (1) high
+    dht_data[i / 8] <<= 1;
+    if (duration[start + (2 * i) + 1] > duration[start + (2 * i)]) {
+      dht_data[i / 8] |= 1;
+    }
+  }
+  return DhtConvertData(sensor);
+}
+
+void DhtRmtEverySecond(void) {
+  uint32_t cycle = TasmotaGlobal.uptime % 4;
+  if (0 == cycle) {                           // Trigger all sensors, captures run in hardware
+    for (uint32_t sensor = 0; sensor < dht_sensors; sensor++) {
+      DhtRmtTrigger(sensor);
+    }
+  }
+  else if (1 == cycle) {                      // Decode the captures one second later
+    for (uint32_t sensor = 0; sensor < dht_sensors; sensor++) {
+      if (!DhtRmtDecode(sensor)) {
+        Dht[sensor].lastresult++;
+        if (Dht[sensor].lastresult > DHT_MAX_RETRY) {  // Reset after 8 misses
+          Dht[sensor].t = NAN;
+          Dht[sensor].h = NAN;
+        }
+      }
+    }
+  }
+}
+#endif  // ESP32 && USE_DHT_RMT
+
 /********************************************************************************************/
 
 void DhtDelayDefault(uint32_t sensor) {
@@ -373,6 +496,10 @@ void DhtInit(void) {
 
     dht_maxcycles = microsecondsToClockCycles(1000);  // 1 millisecond timeout for reading pulses from DHT sensor.
 
+#if defined(ESP32) && defined(USE_DHT_RMT)
+    DhtRmtInit();
+#endif
+
     AddLog(LOG_LEVEL_DEBUG, PSTR("DHT: (v7) " D_SENSORS_FOUND " %d"), dht_sensors);
   } else {
     dht_active = false;
@@ -380,6 +507,12 @@ void DhtInit(void) {
 }
 
 void DhtEverySecond(void) {
+#if defined(ESP32) && defined(USE_DHT_RMT)
+  if (DhtRmtEnabled) {
+    DhtRmtEverySecond();
+    return;
+  }
+#endif
   if (!(TasmotaGlobal.uptime %4)) {  // Every 4 seconds
     for (uint32_t sensor = 0; sensor < dht_sensors; sensor++) {
       // DHT11 and AM2301 25mS per sensor, SI7021 5mS per sensor
@@ -717,6 +717,7 @@ bool Xsns102(uint32_t function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         Ld2410Input();
+        SleepRequestWake(1);             // Drain the radar uart every millisecond to prevent buffer overrun
         break;
       case FUNC_EVERY_100_MSECOND:
         Ld2410Every100MSecond();
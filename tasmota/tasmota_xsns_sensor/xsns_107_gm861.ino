@@ -384,6 +384,7 @@ bool Xsns107(uint32_t function) {
       case FUNC_LOOP:
       case FUNC_SLEEP_LOOP:
         Gm861SerialInput();
+        SleepRequestWake(1);             // Drain the scanner uart every millisecond to prevent buffer overrun
         break;
       case FUNC_EVERY_250_MSECOND:
         Gm861StateMachine();
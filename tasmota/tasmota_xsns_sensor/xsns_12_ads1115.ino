@@ -128,10 +128,15 @@ uint8_t ads1115_channels;
 
 struct ADS1115 {
   int16_t last_values[4] = { 0,0,0,0 };
-  uint8_t address; 
+  int16_t conversions[4] = { 0,0,0,0 };     // Latest results per channel in conversion ready mode
+  uint8_t address;
   uint8_t bus;
 } Ads1115[4];
 
+bool ads1115_rdy_mode = false;              // ALERT/RDY pin wired - continuous conversions, no busy-wait
+uint8_t ads1115_rdy_channel = 0;            // Channel currently converting
+volatile bool ads1115_rdy_flag = false;
+
 //Ads1115StartComparator(channel, ADS1115_REG_CONFIG_MODE_SINGLE);
 //Ads1115StartComparator(channel, ADS1115_REG_CONFIG_MODE_CONTIN);
 void Ads1115StartComparator(uint32_t device, uint8_t channel, uint16_t mode) {
@@ -156,6 +161,9 @@ void Ads1115StartComparator(uint32_t device, uint8_t channel, uint16_t mode) {
 }
 
 int16_t Ads1115GetConversion(uint32_t device, uint8_t channel) {
+  if (ads1115_rdy_mode) {
+    return Ads1115[device].conversions[channel];  // Continuously refreshed from Ads1115RdyService
+  }
   Ads1115StartComparator(device, channel, ADS1115_REG_CONFIG_MODE_SINGLE);
   // Wait for the conversion to complete
   delay(ADS1115_CONVERSIONDELAY);
@@ -169,6 +177,60 @@ int16_t Ads1115GetConversion(uint32_t device, uint8_t channel) {
   return (int16_t)res;
 }
 
+/*********************************************************************************************\
+ * Conversion ready mode - GPIO ADS1115 RDY
+ *
+ * Continuous conversions with the comparator reconfigured as a conversion ready output
+ * (Hi_thresh MSB = 1, Lo_thresh MSB = 0 makes ALERT/RDY pulse after every conversion).
+ * The interrupt flag is serviced from the main loop which reads the finished result and
+ * rotates the input mux, so reads cost no busy-wait at all. One RDY line is supported -
+ * the mode engages when a single ADS1115 is detected.
+\*********************************************************************************************/
+
+void IRAM_ATTR Ads1115Isr(void) {
+  ads1115_rdy_flag = true;
+}
+
+void Ads1115StartConversionReady(uint8_t channel) {
+  uint16_t config = ADS1115_REG_CONFIG_MODE_CONTIN |
+                    ADS1115_REG_CONFIG_CQUE_1CONV   | // Assert ALERT/RDY after every conversion
+                    ADS1115_REG_CONFIG_CLAT_NONLAT  | // Non Latching mode
+                    ads1115_range                   | // ADC Input voltage range (Gain)
+                    ADS1115_REG_CONFIG_CPOL_ACTVLOW | // Alert/Rdy active low   (default val)
+                    ADS1115_REG_CONFIG_CMODE_TRAD   | // Traditional comparator (default val)
+                    ADS1115_REG_CONFIG_DR_128SPS;     // One interrupt every 7.8ms leaves ample bus time per service
+
+  // Set single-ended or differential input channel
+  if (ads1115_channels == ADS1115_SINGLE_CHANNELS) {
+    config |= (ADS1115_REG_CONFIG_MUX_SINGLE_0 + (0x1000 * channel));
+  } else {
+    config |= (ADS1115_REG_CONFIG_MUX_DIFF_0_1 + (0x3000 * channel));
+  }
+
+  I2cWrite16(Ads1115[0].address, ADS1115_REG_POINTER_CONFIG, config, Ads1115[0].bus);
+}
+
+void Ads1115RdyInit(void) {
+  if (!PinUsed(GPIO_ADS1115_RDY) || (ads1115_count != 1)) { return; }
+  I2cWrite16(Ads1115[0].address, ADS1115_REG_POINTER_HITHRESH, 0x8000, Ads1115[0].bus);
+  I2cWrite16(Ads1115[0].address, ADS1115_REG_POINTER_LOWTHRESH, 0x0000, Ads1115[0].bus);
+  pinMode(Pin(GPIO_ADS1115_RDY), INPUT_PULLUP);  // ALERT/RDY is open drain
+  attachInterrupt(Pin(GPIO_ADS1115_RDY), Ads1115Isr, FALLING);
+  ads1115_rdy_channel = 0;
+  Ads1115StartConversionReady(0);
+  ads1115_rdy_mode = true;
+}
+
+void Ads1115RdyService(void) {
+  if (!ads1115_rdy_flag) { return; }
+  uint8_t channel = ads1115_rdy_channel;
+  int16_t value = (int16_t)I2cRead16(Ads1115[0].address, ADS1115_REG_POINTER_CONVERT, Ads1115[0].bus);
+  ads1115_rdy_channel = (channel +1) % ads1115_channels;
+  Ads1115StartConversionReady(ads1115_rdy_channel);
+  ads1115_rdy_flag = false;                 // Clear after the mux switch so a pulse from the old channel is not serviced as the new one
+  Ads1115[0].conversions[channel] = value;
+}
+
 /********************************************************************************************/
 
 void Ads1115Detect(void) {
@@ -295,10 +357,14 @@ bool ADS1115_Command(void) {
         ads1115_channels = ADS1115_SINGLE_CHANNELS;
     }
 //    uint32_t range_index = atoi((const char*)XdrvMailbox.data[1]);    
-    uint32_t range_index = atoi((const char*)XdrvMailbox.data +1);    
+    uint32_t range_index = atoi((const char*)XdrvMailbox.data +1);
     if ((range_index >= 0) && (range_index <= 5)) {
       ads1115_range = ads1115_ranges[range_index];
     }
+    if (ads1115_rdy_mode) {                 // Restart the rotation with the new mode and range
+      ads1115_rdy_channel = 0;
+      Ads1115StartConversionReady(0);
+    }
   }
   const char ds[2][13] = { "Differential", "Single ended" };
   const uint16_t r[6] = { 6144, 4096, 2048, 1024, 512, 256 };
@@ -319,9 +385,13 @@ bool Xsns12(uint32_t function)
 
   if (FUNC_INIT == function) {
     Ads1115Detect();
+    Ads1115RdyInit();
   }
   else if (ads1115_count) {
     switch (function) {
+      case FUNC_LOOP:
+        if (ads1115_rdy_mode) { Ads1115RdyService(); }
+        break;
 #ifdef USE_RULES
       case FUNC_EVERY_250_MSECOND:
         AdsEvery250ms();
@@ -112,7 +112,10 @@ bool Xsns31(uint32_t function)
   bool result = false;
 
   if (FUNC_INIT == function) {
-    CCS811Detect();
+    if (!CCS811_type) { CCS811Detect(); }  // Skip if already started by the deep-sleep wake kick
+  }
+  else if (FUNC_WAKE_WARMUP == function) {
+    CCS811Detect();                        // Start the sensor before wifi so its warm-up overlaps network bring-up
   }
   else if (CCS811_type) {
     switch (function) {
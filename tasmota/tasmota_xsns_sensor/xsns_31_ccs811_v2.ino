@@ -313,7 +313,10 @@ bool Xsns31(uint32_t function)
   bool result = false;
 
   if (FUNC_INIT == function) {
-    CCS811Detect();
+    if (!CCS811_devices_found) { CCS811Detect(); }  // Skip if already started by the deep-sleep wake kick
+  }
+  else if (FUNC_WAKE_WARMUP == function) {
+    CCS811Detect();                        // Start the sensors before wifi so their warm-up overlaps network bring-up
   }
   else if (CCS811_devices_found) {
     switch (function) {
@@ -553,6 +553,10 @@ struct METER_DESC {
 #ifdef ESP32
   int8_t uart_index;
 #endif
+
+  // per meter statistics, reset on driver restart
+  uint32_t stat_bytes;      // serial bytes shifted in
+  uint32_t stat_decodes;    // decode cycles over the compiled sections
 };
 
 
@@ -598,6 +602,16 @@ int8_t index;
 
 #define SML_OPTIONS_JSON_ENABLE 1
 
+// compiled descriptor section, built once at init so the decoder jumps straight to its
+// own sections with precalculated variable slots instead of rescanning the whole
+// descriptor text on every received byte
+struct SML_SECT {
+  const char *mp;     // decoder part of the section, after the meter prefix
+  uint8_t mindex;     // meter this section belongs to
+  uint8_t vindex;     // global line number = variable slot
+  uint8_t dindex;     // number of =d sections before this one
+};
+
 struct SML_GLOBS {
   uint8_t sml_send_blocks;
   uint8_t sml_100ms_cnt;
@@ -625,6 +639,8 @@ struct SML_GLOBS {
 #endif
 	uint8_t *script_meter;
 	struct METER_DESC *mp;
+  struct SML_SECT *sect;
+  uint16_t sect_cnt;
   uint8_t to_cnt;
   bool ready;
 #ifdef USE_SML_CANBUS
@@ -1426,6 +1442,8 @@ void sml_shift_in(uint32_t meters, uint32_t shard) {
 
   if (!mp->sbuff) return;
 
+  mp->stat_bytes++;
+
 #ifdef USE_SML_DECRYPT
 	if (mp->use_crypt) {
 		if (mp->hp) {
@@ -1772,46 +1790,73 @@ double sml_get_obis_value(uint8_t *data) {
 
 
 
-void SML_Decode(uint8_t index) {
+// compile the descriptor into the section table. Decoded sections get their start
+// pointer, owning meter and the variable and delta slots that previously were counted
+// up while scanning over every other meter's sections on each decode pass
+void SML_CompileSections(void) {
+  if (sml_globs.sect) {
+    free(sml_globs.sect);
+    sml_globs.sect = nullptr;
+  }
+  sml_globs.sect_cnt = 0;
   const char *mp = (const char*)sml_globs.meter_p;
+  uint16_t scnt = 0;
+  while (mp && *mp) {
+    scnt++;
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+  if (!scnt) return;
+  sml_globs.sect = (struct SML_SECT*)calloc(scnt, sizeof(struct SML_SECT));
+  if (!sml_globs.sect) return;
+  mp = (const char*)sml_globs.meter_p;
+  uint8_t vindex = 0;
+  uint8_t dindex = 0;
+  while (mp && *mp) {
+    int8_t mindex = ((*mp) & 7) - 1;
+    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
+    const char *dp = mp + 2;
+    if (!(*dp == '=' && (*(dp + 1) == 'h' || *(dp + 1) == 's'))) {
+      // html and spec option lines are never decoded and use no variable slot
+      struct SML_SECT *sp = &sml_globs.sect[sml_globs.sect_cnt];
+      sp->mp = dp;
+      sp->mindex = mindex;
+      sp->vindex = vindex;
+      sp->dindex = dindex;
+      sml_globs.sect_cnt++;
+      if (*dp == '=' && *(dp + 1) == 'd') {
+        dindex++;
+      }
+      if (vindex < sml_globs.maxvars - 1) {
+        vindex++;
+      }
+    }
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+}
+
+void SML_Decode(uint8_t index) {
+  const char *mp;
   int8_t mindex;
   uint8_t *cp;
   uint8_t dindex = 0, vindex = 0;
   delay(0);
 
-  if (!sml_globs.ready) {
+  if (!sml_globs.ready || !sml_globs.sect) {
     return;
   }
 
-  while (mp != NULL) {
-    // check list of defines
-    if (*mp == 0) break;
-
-    // new section
-    mindex = ((*mp) & 7) - 1;
-
-    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
-    mp += 2;
-    if (*mp == '=' && *(mp+1) == 'h') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
-    }
+  meter_desc[index].stat_decodes++;
 
-    if (*mp == '=' && *(mp+1) == 's') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
-    }
-
-    // =d must handle dindex
-    if (*mp == '=' && *(mp + 1) == 'd') {
-      if (index != mindex) {
-        dindex++;
-      }
-    }
+  for (uint16_t scnt = 0; scnt < sml_globs.sect_cnt; scnt++) {
+    struct SML_SECT *sect = &sml_globs.sect[scnt];
+    if (sect->mindex != index) continue;
 
-    if (index != mindex) goto nextsect;
+    mp = sect->mp;
+    mindex = sect->mindex;
+    vindex = sect->vindex;
+    dindex = sect->dindex;
 
     // start of serial source buffer
     cp = meter_desc[mindex].sbuff;
@@ -2478,13 +2523,8 @@ void SML_Decode(uint8_t index) {
       }
       //AddLog(LOG_LEVEL_INFO, PSTR("set valid in line %d"), vindex);
     }
-nextsect:
+nextsect:;
     // next section
-    if (vindex < sml_globs.maxvars - 1) {
-      vindex++;
-    }
-    mp = strchr(mp, '|');
-    if (mp) mp++;
   }
 }
 
@@ -3692,6 +3732,9 @@ next_line:
       mp->shift_mode = (type != 'o' && type != 'e' && type != 'k' && type != 'm' && type != 'M' && type != 'p' && type != 'R' && type != 'v');
     }
 
+    mp->stat_bytes = 0;
+    mp->stat_decodes = 0;
+
 #ifdef USE_SML_DECRYPT
 		if (mp->use_crypt) {
 #ifdef USE_SML_AUTHKEY
@@ -3704,6 +3747,8 @@ next_line:
 #endif
   }
 
+  SML_CompileSections();
+
   sml_globs.ready = true;
 }
 
@@ -4520,6 +4565,7 @@ uint8_t parity=0;
 // restart driver => sensor53 r
 // meter number for monitoring serial activity => sensor53 m1, m2, m3 ... or m0 for all (default)
 // LED-GPIO for monitoring serial activity => sensor53 l2, l13, l15 ... or l255 for turn off (default)
+// show per meter statistics (bytes received, decode cycles) => sensor53 s
 
 bool XSNS_53_cmd(void) {
   bool serviced = true;
@@ -4570,6 +4616,14 @@ bool XSNS_53_cmd(void) {
         ResponseTime_P(PSTR(",\"SML\":{\"CMD\":\"restart\"}}"));
         SML_CounterSaveState();
         SML_Init();
+      } else if (*cp == 's') {
+        // per meter statistics
+        if (sml_globs.ready) {
+          for (uint8_t meters = 0; meters < sml_globs.meters_used; meters++) {
+            AddLog(LOG_LEVEL_INFO, PSTR("SML: meter %d: %u bytes, %u decode cycles"), meters + 1, meter_desc[meters].stat_bytes, meter_desc[meters].stat_decodes);
+          }
+          ResponseTime_P(PSTR(",\"SML\":{\"CMD\":\"stats: %d sections\"}}"), sml_globs.sect_cnt);
+        }
       } else if (*cp == 'm') {
         // meter number for serial activity
         cp++;
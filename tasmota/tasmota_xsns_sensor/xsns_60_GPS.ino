@@ -129,6 +129,7 @@ const char kUBXTypes[] PROGMEM = "UBX";
 #define UBX_LAT_LON_THRESHOLD 100 // filter out some noise of local drift
 
 #define UBX_SERIAL_BUFFER_SIZE 256
+#define UBX_MAX_BATCH          8               // upper bound of messages handled per parser pass
 #define UBX_TCP_PORT           1234
 #define NTP_MILLIS_OFFSET      50              // estimated latency in milliseconds
 
@@ -325,11 +326,18 @@ enum UBXMsgType {
   MT_POLL
 };
 
-#ifdef USE_FLOG
-FLOG *Flog = nullptr;
-#endif  // USE_FLOG
 TasmotaSerial *UBXSerial;
 
+bool ubx_new_position = false;
+
+#ifdef ESP32
+volatile bool ubx_rx_idle = false;   // set from the UART event task, consumed in the Tasmota loop
+
+void UBXRxIdle(void) {
+  ubx_rx_idle = true;                // end of a message burst, schedule a parser pass
+}
+#endif  // ESP32
+
 NtpServer timeServer(PortUdp);
 
 WiFiServer vPortServer(UBX_TCP_PORT);
@@ -390,6 +398,9 @@ void UBXDetect(void) {
 #endif
 
   UBXinitCFG();                 // turn off NMEA, only use "our" UBX-messages
+#ifdef ESP32
+  UBXSerial->onRxEvent(UBXRxIdle, true);  // only sets a flag, the parser runs in the Tasmota loop
+#endif  // ESP32
   UBX.mode.init = 1;
 
 #ifdef USE_FLOG
@@ -788,36 +799,44 @@ void UBXLoop50msec(void)
   }
 }
 
-void UBXLoop(void)
+void UBXDrainSerial(void)
 {
-  static uint16_t counter; //count up every 100 msec
-  static bool new_position;
-
-  uint32_t msgType = UBXprocessGPS();
-
-  switch(msgType){
-    case MT_NAV_POSLLH:
-      new_position = UBXHandlePOSLLH();
-      break;
-    case MT_NAV_STATUS:
-      UBXHandleSTATUS();
-      break;
-    case MT_NAV_TIME:
-      UBXHandleTIME();
-      break;
+  // handle every complete and validated message in the receive buffer, not just one per pass,
+  // so a 10 Hz receiver can not pile up messages faster than the 100 msec loop drains them
+  for (uint32_t parsed = 0; parsed < UBX_MAX_BATCH; parsed++) {
+    uint32_t msgType = UBXprocessGPS();
+
+    switch(msgType){
+      case MT_NAV_POSLLH:
+        ubx_new_position = UBXHandlePOSLLH();
+        break;
+      case MT_NAV_STATUS:
+        UBXHandleSTATUS();
+        break;
+      case MT_NAV_TIME:
+        UBXHandleTIME();
+        break;
 #ifdef USE_GPS_VELOCITY
-    case MT_NAV_VEL:
-      UBXHandleVEL();
-      break;
+      case MT_NAV_VEL:
+        UBXHandleVEL();
+        break;
 #endif  // USE_GPS_VELOCITY
-    default:
-      UBXHandleOther();
-      break;
+      default:
+        UBXHandleOther();
+        return;                 // buffer is drained
+    }
   }
+}
+
+void UBXLoop(void)
+{
+  static uint16_t counter; //count up every 100 msec
+
+  UBXDrainSerial();
 
 #ifdef USE_FLOG
   if (counter>UBX.state.log_interval) {
-    if (Flog->recording && new_position) {
+    if (Flog->recording && ubx_new_position) {
       UBX.rec_buffer.values.time = Rtc.local_time;
       Flog->addToBuffer(UBX.rec_buffer.bytes, sizeof(UBX.rec_buffer.bytes));
       counter = 0;
@@ -986,6 +1005,17 @@ bool Xsns60(uint32_t function)
         break;
       case FUNC_EVERY_50_MSECOND:
         UBXLoop50msec(); // handles virtual serial port and NTP server
+#ifdef ESP32
+        if (ubx_rx_idle) { // the receiver finished a burst, parse it now instead of at the next 100 msec tick
+          ubx_rx_idle = false;
+#ifdef USE_FLOG
+          if (!Flog->running_download)
+#endif  // USE_FLOG
+          {
+            UBXDrainSerial();
+          }
+        }
+#endif  // ESP32
         break;
       case FUNC_EVERY_100_MSECOND:
 #ifdef USE_FLOG
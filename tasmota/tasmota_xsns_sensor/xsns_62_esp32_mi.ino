@@ -71,6 +71,7 @@
 void MI32notifyCB(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
 void MI32AddKey(mi_bindKey_t keyMAC);
 void MI32HandleEveryDevice(NimBLEAdvertisedDevice* advertisedDevice, uint8_t addr[6], int RSSI);
+bool MI32DedupAdvert(const uint8_t *addr, const uint8_t *data, size_t len);
 
 std::vector<mi_sensor_t> MIBLEsensors;
 RingbufHandle_t BLERingBufferQueue = nullptr;
@@ -113,9 +114,30 @@ class MI32AdvCallbacks: public NimBLEScanCallbacks {
     _mutex = true;
 
     int RSSI = advertisedDevice->getRSSI();
+    // native prefilter - drop uninteresting advertisers before the Berry copy
+    // or any payload parsing
+    if ((MI32.prefilter.RSSIfloor > -128) && (RSSI < MI32.prefilter.RSSIfloor)) {
+      MI32.prefilter.RSSIdrops++;
+      _mutex = false;
+      return;
+    }
     uint8_t addr[6];
     memcpy(addr,advertisedDevice->getAddress().getNative(),6);
     MI32_ReverseMAC(addr);
+    if (MI32.prefilter.MACcount) {
+      bool allowed = false;
+      for (uint32_t i = 0; i < MI32.prefilter.MACcount; i++) {
+        if (!memcmp(addr, MI32.prefilter.MAC[i], MI32.prefilter.MACmatchLen[i])) {
+          allowed = true;
+          break;
+        }
+      }
+      if (!allowed) {
+        MI32.prefilter.MACdrops++;
+        _mutex = false;
+        return;
+      }
+    }
     size_t ServiceDataLength = 0;
 
     if(MI32.beAdvCB != nullptr && MI32.mode.triggerBerryAdvCB == 0){
@@ -140,6 +162,14 @@ class MI32AdvCallbacks: public NimBLEScanCallbacks {
     uint16_t UUID = advertisedDevice->getServiceDataUUID(0).getNative()->u16.value;
     ServiceDataLength = advertisedDevice->getServiceData(0).length();
 
+    // repeats of a frame already decoded cost one hash lookup and stop here.
+    // the Berry callback above still sees every advert.
+    if (MI32.option.dedup
+        && MI32DedupAdvert(addr, (const uint8_t*)advertisedDevice->getServiceData(0).data(), ServiceDataLength)) {
+      _mutex = false;
+      return;
+    }
+
     if(UUID==0xfe95) {
       MI32ParseResponse((char*)advertisedDevice->getServiceData(0).data(),ServiceDataLength, addr, RSSI);
     }
@@ -337,6 +367,49 @@ void MI32_ReverseMAC(uint8_t _mac[]){
   memcpy(_mac,_reversedMAC, sizeof(_reversedMAC));
 }
 
+/*********************************************************************************************\
+ * Advertisement dedup window
+ *
+ * Xiaomi sensors repeat each frame 3-5 times.  The service data includes the
+ * frame counter, so a repeat is byte-identical to the first transmission and
+ * can be dropped after one hash lookup, before any decrypt/decode.
+\*********************************************************************************************/
+
+#ifndef MI32_DEDUP_WINDOW
+#define MI32_DEDUP_WINDOW 2000    // milliseconds a frame stays in the window
+#endif
+#define MI32_DEDUP_SLOTS 32
+
+struct MI32dedup_t {
+  uint8_t MAC[6];
+  uint16_t hash;
+  uint32_t time;
+};
+static MI32dedup_t MI32dedup[MI32_DEDUP_SLOTS];
+
+/**
+ * @brief true if this service data from this MAC was already seen within the
+ * dedup window.  slot collisions between MACs simply fall through to decode.
+ */
+bool MI32DedupAdvert(const uint8_t *addr, const uint8_t *data, size_t len){
+  uint32_t hash = len;
+  for (size_t i = 0; i < len; i++) { hash = (hash * 31) + data[i]; }
+  hash ^= hash >> 16;
+  MI32dedup_t *entry = &MI32dedup[(addr[3] ^ addr[4] ^ addr[5]) % MI32_DEDUP_SLOTS];
+  uint32_t now = millis();
+  if ((0 == memcmp(entry->MAC, addr, 6)) && ((uint16_t)hash == entry->hash)
+      && (now - entry->time < MI32_DEDUP_WINDOW)) {
+    // a repeat - entry->time is left at first-seen, so a device that keeps
+    // sending identical data is still decoded once per window
+    MI32.dedupDrops++;
+    return true;
+  }
+  memcpy(entry->MAC, addr, 6);
+  entry->hash = (uint16_t)hash;
+  entry->time = now;
+  return false;
+}
+
 void MI32AddKey(mi_bindKey_t keyMAC){
   bool unknownMAC = true;
   uint32_t _slot = 0;
@@ -673,6 +746,7 @@ void MI32PreInit(void) {
   MI32.option.directBridgeMode = 0;
   MI32.option.ignoreBogusBattery = 1; // from advertisements
   MI32.option.handleEveryDevice = 0; // scan for every BLE device with a public address
+  MI32.option.dedup = 1; // drop repeated identical adverts inside the dedup window
 
   MI32loadCfg();
   if(MIBLEsensors.size()>0){
@@ -2404,6 +2478,14 @@ void CmndMi32Option(void){
         onOff = MI32.option.handleEveryDevice;
       }
       break;
+    case 6:
+      if(XdrvMailbox.data_len>0){
+        MI32.option.dedup = onOff;
+      }
+      else{
+        onOff = MI32.option.dedup;
+      }
+      break;
 #ifdef CONFIG_BT_NIMBLE_NVS_PERSIST
     case 99: // TODO: should be moved to some reset command, i.e. "reset 6"
        NimBLEDevice::deleteAllBonds();
@@ -2414,6 +2496,56 @@ void CmndMi32Option(void){
   ResponseCmndIdxNumber(onOff?1:0);
 }
 
+// Native advertisement prefilter
+// MI32PreFilter0 -> clear all prefilters and drop counters
+// MI32PreFilter1 mac[,mac..] -> set MAC allowlist.  fewer than 12 hex digits = prefix match
+// MI32PreFilter2 rssi -> drop adverts weaker than this, e.g. -70.  0 to clear
+// always responds with the active filters and per-filter drop counters
+void CmndMi32PreFilter(void){
+  switch(XdrvMailbox.index) {
+    case 0:
+      memset(&MI32.prefilter, 0, sizeof(MI32.prefilter));
+      MI32.prefilter.RSSIfloor = -128;
+      break;
+    case 1:
+      if(XdrvMailbox.data_len>0){
+        MI32.prefilter.MACcount = 0;
+        char *p = strtok(XdrvMailbox.data, " ,");
+        while (p && (MI32.prefilter.MACcount < 4)) {
+          MI32stripColon(p);
+          size_t maclen = strlen(p);
+          if ((maclen < 2) || (maclen > 12) || (maclen & 1)) {
+            AddLog(LOG_LEVEL_ERROR,PSTR("M32: PreFilter invalid mac %s"), p);
+          } else {
+            MI32HexStringToBytes(p, MI32.prefilter.MAC[MI32.prefilter.MACcount]);
+            MI32.prefilter.MACmatchLen[MI32.prefilter.MACcount] = maclen / 2;
+            MI32.prefilter.MACcount++;
+          }
+          p = strtok(nullptr, " ,");
+        }
+      }
+      break;
+    case 2:
+      if(XdrvMailbox.data_len>0){
+        MI32.prefilter.RSSIfloor = atoi(XdrvMailbox.data);
+        if (!MI32.prefilter.RSSIfloor) { MI32.prefilter.RSSIfloor = -128; }
+      }
+      break;
+  }
+
+  char macs[4*14];
+  macs[0] = 0;
+  char *m = macs;
+  for (uint32_t i = 0; i < MI32.prefilter.MACcount; i++) {
+    if (i) { *(m++) = ','; }
+    ToHex_P(MI32.prefilter.MAC[i], MI32.prefilter.MACmatchLen[i], m, 14);
+    m += strlen(m);
+  }
+  Response_P(PSTR("{\"MI32PreFilter\":{\"MAC\":\"%s\",\"RSSI\":%d,\"Drops\":{\"MAC\":%u,\"RSSI\":%u,\"Dedup\":%u}}}"),
+    macs, (MI32.prefilter.RSSIfloor > -128) ? MI32.prefilter.RSSIfloor : 0,
+    MI32.prefilter.MACdrops, MI32.prefilter.RSSIdrops, MI32.dedupDrops);
+}
+
 /*********************************************************************************************\
  * Presentation
 \*********************************************************************************************/
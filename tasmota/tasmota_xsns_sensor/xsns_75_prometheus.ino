@@ -163,6 +163,72 @@ void WritePromMetricStr(const char *name, uint8_t flags, const char *value, ...)
   va_end(labels);
 }
 
+// Cache of pre-rendered sensor metric prefixes, i.e. the "# TYPE" line plus
+// metric name and escaped labels up to the value. Deriving these costs several
+// String allocations per metric on every scrape while the result only depends
+// on the JSON key path, so render each prefix once and stream just the value
+// on subsequent scrapes. Entries are kept for the lifetime of the device; the
+// key set is small and stable.
+struct PromSensorMetric {
+  uint32_t key;                   // Hash of the JSON key path
+  char *prefix;                   // "# TYPE tasmota_... gauge\ntasmota_...{sensor=\"...\"} "
+};
+PromSensorMetric *prom_metrics = nullptr;
+uint16_t prom_metrics_count = 0;
+uint16_t prom_metrics_size = 0;
+
+// Return the cached metric prefix for a sensor/type key path, rendering and
+// caching it on first use. type may be nullptr for single level readings.
+// Returns nullptr when out of memory; callers fall back to direct rendering.
+const char* PromSensorPrefix(const char *sensor, const char *type) {
+  char path[100];
+  snprintf_P(path, sizeof(path), PSTR("%s|%s"), sensor, (type) ? type : "");
+  uint32_t key = GetHash(path, strlen(path));
+  for (uint32_t i = 0; i < prom_metrics_count; i++) {
+    if (key == prom_metrics[i].key) {
+      return prom_metrics[i].prefix;
+    }
+  }
+
+  if (prom_metrics_count == prom_metrics_size) {
+    uint16_t size = (prom_metrics_size) ? prom_metrics_size * 2 : 16;
+    PromSensorMetric *metrics = (PromSensorMetric*)special_realloc(prom_metrics, size * sizeof(PromSensorMetric));
+    if (nullptr == metrics) { return nullptr; }
+    prom_metrics = metrics;
+    prom_metrics_size = size;
+  }
+
+  String sensor_name = FormatMetricName(sensor);
+  sensor_name.replace("\\", "\\\\");
+  sensor_name.replace("\"", "\\\"");
+  sensor_name.replace("\n", "\\n");
+
+  String rendered;
+  if (type) {
+    String type_name = FormatMetricName(type);
+    char namebuf[64];
+    snprintf_P(namebuf, sizeof(namebuf), PSTR("sensors_%s_%s"),
+      type_name.c_str(), UnitfromType(type_name.c_str()));
+    rendered = F("# TYPE tasmota_");
+    rendered += namebuf;
+    rendered += F(" gauge\ntasmota_");
+    rendered += namebuf;
+  } else {
+    rendered = F("# TYPE tasmota_sensors gauge\ntasmota_sensors");
+  }
+  rendered += F("{sensor=\"");
+  rendered += sensor_name;
+  rendered += F("\"} ");
+
+  char *prefix = (char*)special_malloc(rendered.length() + 1);
+  if (nullptr == prefix) { return nullptr; }
+  strcpy(prefix, rendered.c_str());
+  prom_metrics[prom_metrics_count].key = key;
+  prom_metrics[prom_metrics_count].prefix = prefix;
+  prom_metrics_count++;
+  return prefix;
+}
+
 // Sentinel value for unknown memory metrics, chosen to unlikely match actual
 // values.
 const uint32_t kPromMemoryUnknown = 0xFFFFFFFF - 1;
@@ -299,34 +365,45 @@ void HandleMetrics(void) {
             for (auto key3 : Object3) {
               const char *value = key3.getValue().getStr(nullptr);
               if (value != nullptr && (isdigit(value[0]) || (value[0] == '-') || (value[0] == '.'))) {
-                String sensor = FormatMetricName(key2.getStr());
-                String type = FormatMetricName(key3.getStr());
-
-                snprintf_P(namebuf, sizeof(namebuf), PSTR("sensors_%s_%s"),
-                  type.c_str(), UnitfromType(type.c_str()));
-                WritePromMetricStr(namebuf, kPromMetricGauge, value,
-                  PSTR("sensor"), sensor.c_str(),
-                  nullptr);
+                const char *prefix = PromSensorPrefix(key2.getStr(), key3.getStr());
+                if (prefix != nullptr) {
+                  WSContentSend_P(PSTR("%s%s\n"), prefix, value);
+                } else {
+                  String sensor = FormatMetricName(key2.getStr());
+                  String type = FormatMetricName(key3.getStr());
+
+                  snprintf_P(namebuf, sizeof(namebuf), PSTR("sensors_%s_%s"),
+                    type.c_str(), UnitfromType(type.c_str()));
+                  WritePromMetricStr(namebuf, kPromMetricGauge, value,
+                    PSTR("sensor"), sensor.c_str(),
+                    nullptr);
+                }
               }
             }
           } else {
             const char *value = value2.getStr(nullptr);
             if (value != nullptr && (isdigit(value[0]) || (value[0] == '-') || (value[0] == '.'))) {
-              String sensor = FormatMetricName(key1.getStr());
-              String type = FormatMetricName(key2.getStr());
-              if (strcmp(type.c_str(), "totalstarttime") != 0) {  // this metric causes Prometheus of fail
-                snprintf_P(namebuf, sizeof(namebuf), PSTR("sensors_%s_%s"),
-                  type.c_str(), UnitfromType(type.c_str()));
-
-                if (strcmp(type.c_str(), "id") == 0) {            // this metric is NaN, so convert it to a label, see Wi-Fi metrics above
-                  WritePromMetricInt32(namebuf, kPromMetricGauge, 1,
-                    PSTR("sensor"), sensor.c_str(),
-                    PSTR("id"), value,
-                    nullptr);
+              if (strcasecmp(key2.getStr(), "totalstarttime") != 0) {  // this metric causes Prometheus of fail
+                const char *prefix = (strcasecmp(key2.getStr(), "id") != 0) ?
+                  PromSensorPrefix(key1.getStr(), key2.getStr()) : nullptr;
+                if (prefix != nullptr) {
+                  WSContentSend_P(PSTR("%s%s\n"), prefix, value);
                 } else {
-                  WritePromMetricStr(namebuf, kPromMetricGauge, value,
-                    PSTR("sensor"), sensor.c_str(),
-                    nullptr);
+                  String sensor = FormatMetricName(key1.getStr());
+                  String type = FormatMetricName(key2.getStr());
+                  snprintf_P(namebuf, sizeof(namebuf), PSTR("sensors_%s_%s"),
+                    type.c_str(), UnitfromType(type.c_str()));
+
+                  if (strcmp(type.c_str(), "id") == 0) {            // this metric is NaN, so convert it to a label, see Wi-Fi metrics above
+                    WritePromMetricInt32(namebuf, kPromMetricGauge, 1,
+                      PSTR("sensor"), sensor.c_str(),
+                      PSTR("id"), value,
+                      nullptr);
+                  } else {
+                    WritePromMetricStr(namebuf, kPromMetricGauge, value,
+                      PSTR("sensor"), sensor.c_str(),
+                      nullptr);
+                  }
                 }
               }
             }
@@ -334,12 +411,17 @@ void HandleMetrics(void) {
         }
       } else {
         const char *value = value1.getStr(nullptr);
-        String sensor = FormatMetricName(key1.getStr());
 
-        if (value != nullptr && (isdigit(value[0]) || (value[0] == '-') || (value[0] == '.')) && strcmp(sensor.c_str(), "time") != 0) {  //remove false 'time' metric
-          WritePromMetricStr(PSTR("sensors"), kPromMetricGauge, value,
-            PSTR("sensor"), sensor.c_str(),
-            nullptr);
+        if (value != nullptr && (isdigit(value[0]) || (value[0] == '-') || (value[0] == '.')) && strcasecmp(key1.getStr(), "time") != 0) {  //remove false 'time' metric
+          const char *prefix = PromSensorPrefix(key1.getStr(), nullptr);
+          if (prefix != nullptr) {
+            WSContentSend_P(PSTR("%s%s\n"), prefix, value);
+          } else {
+            String sensor = FormatMetricName(key1.getStr());
+            WritePromMetricStr(PSTR("sensors"), kPromMetricGauge, value,
+              PSTR("sensor"), sensor.c_str(),
+              nullptr);
+          }
         }
       }
     }
@@ -647,22 +647,32 @@ void (* neopoll_cmd)(void) = nullptr;
 typedef struct {
   const uint16_t addr;
   const uint16_t cnt;
+  const uint16_t cycle;   // read block every n-th poll cycle (1 = every cycle)
   uint16_t *data;
+  uint16_t skip;          // cycles left until the block is due again
 } TNeoPoolReg;
 
-// complete poll cycle needs 2000 ms to read complete register set
+// measurement blocks are read every poll cycle, the config mirror blocks only every
+// NEOPOOL_CYCLE_SLOW cycle or immediately after MBF_NOTIFICATION signals a changed
+// property page - most cycles need only the three measurement reads
+#ifndef NEOPOOL_CYCLE_SLOW
+#define NEOPOOL_CYCLE_SLOW          8
+#endif
+
 #define NEOPOOL_REG_QUERY {\
-  {MBF_ION_CURRENT,       MBF_NOTIFICATION                  - MBF_ION_CURRENT       + 1, nullptr},\
-  {MBF_CELL_RUNTIME_LOW,  MBF_CELL_RUNTIME_POL_CHANGES_HIGH - MBF_CELL_RUNTIME_LOW  + 1, nullptr},\
-  {MBF_PAR_VERSION,       MBF_PAR_HIDRO_NOM                 - MBF_PAR_VERSION       + 1, nullptr},\
-  {MBF_PAR_TIME_LOW,      MBF_PAR_HEATING_GPIO              - MBF_PAR_TIME_LOW      + 1, nullptr},\
-  {MBF_PAR_ION,           MBF_PAR_FILTRATION_CONF           - MBF_PAR_ION           + 1, nullptr},\
-  {MBF_PAR_UICFG_MACHINE, MBF_PAR_UICFG_MACH_VISUAL_STYLE   - MBF_PAR_UICFG_MACHINE + 1, nullptr},\
-  {MBF_VOLT_24_36,        MBF_VOLT_12                       - MBF_VOLT_24_36        + 1, nullptr},\
-  {MBF_VOLT_5,            MBF_AMP_4_20_MICRO                - MBF_VOLT_5            + 1, nullptr}\
+  {MBF_ION_CURRENT,       MBF_NOTIFICATION                  - MBF_ION_CURRENT       + 1, 1,                  nullptr},\
+  {MBF_CELL_RUNTIME_LOW,  MBF_CELL_RUNTIME_POL_CHANGES_HIGH - MBF_CELL_RUNTIME_LOW  + 1, NEOPOOL_CYCLE_SLOW, nullptr},\
+  {MBF_PAR_VERSION,       MBF_PAR_HIDRO_NOM                 - MBF_PAR_VERSION       + 1, NEOPOOL_CYCLE_SLOW, nullptr},\
+  {MBF_PAR_TIME_LOW,      MBF_PAR_HEATING_GPIO              - MBF_PAR_TIME_LOW      + 1, NEOPOOL_CYCLE_SLOW, nullptr},\
+  {MBF_PAR_ION,           MBF_PAR_FILTRATION_CONF           - MBF_PAR_ION           + 1, NEOPOOL_CYCLE_SLOW, nullptr},\
+  {MBF_PAR_UICFG_MACHINE, MBF_PAR_UICFG_MACH_VISUAL_STYLE   - MBF_PAR_UICFG_MACHINE + 1, NEOPOOL_CYCLE_SLOW, nullptr},\
+  {MBF_VOLT_24_36,        MBF_VOLT_12                       - MBF_VOLT_24_36        + 1, 1,                  nullptr},\
+  {MBF_VOLT_5,            MBF_AMP_4_20_MICRO                - MBF_VOLT_5            + 1, 1,                  nullptr}\
 }
 TNeoPoolReg NeoPoolReg[] = NEOPOOL_REG_QUERY;
 
+uint16_t neopool_last_notification = 0;
+
 // Register to check for NPTelePeriod changes
 const uint16_t NeoPoolRegCheck[] PROGMEM = {
   // excl. values that change almost continuously
@@ -797,7 +807,7 @@ typedef union {
     uint16_t ion : 2;                     // bit 4,5 - ION value resolution
     uint16_t range_check : 1;             // bit 6   - enable data validation and repair
     uint16_t conn_stat : 1;               // bit 7   - enable connection statistic
-    uint16_t spare08 : 1;                 // bit 8
+    uint16_t tele_on_change : 1;          // bit 8   - skip teleperiod sensor JSON while data is unchanged
     uint16_t spare09 : 1;                 // bit 9
     uint16_t spare10 : 1;                 // bit 10
     uint16_t spare11 : 1;                 // bit 11
@@ -1166,6 +1176,10 @@ const char HTTP_SNS_NEOPOOL_STATUS_ACTIVE[]    PROGMEM = "filter:invert(1)";
  *            (only available on ESP32 or if NEOPOOL_CONNSTAT is defined)
  *            Disable(0)/enable(1) modbus connection statistics
  *
+ * NPSetOption2 {0|1}
+ *            Disable(0)/enable(1) skipping the teleperiod sensor JSON while
+ *            the monitored register values are unchanged
+ *
  * NPRead <addr> {<cnt>}
  * NPReadL <addr> {<cnt>}
  *            read 16/32-bit register (cnt = 1..30|1..15), cnt = 1 if omitted
@@ -1357,6 +1371,25 @@ void (* const NPCommand[])(void) PROGMEM = {
 
 /****************************************************************************/
 
+void NeoPoolNextBlock(void)         // Advance round robin to the next due register block
+{
+  for (uint32_t n = 0; n < nitems(NeoPoolReg); n++) {
+    ++neopool_read_state %= nitems(NeoPoolReg);
+    if (0 == neopool_read_state) {
+      // completed a poll cycle, age the skip counters
+      for (uint32_t i = 0; i < nitems(NeoPoolReg); i++) {
+        if (NeoPoolReg[i].skip) {
+          NeoPoolReg[i].skip--;
+        }
+      }
+    }
+    if (0 == NeoPoolReg[neopool_read_state].skip) {
+      NeoPoolReg[neopool_read_state].skip = NeoPoolReg[neopool_read_state].cycle - 1;
+      return;
+    }
+  }
+}
+
 void NeoPoolPoll(void)              // Poll modbus register
 {
   // called every 250 ms
@@ -1389,6 +1422,17 @@ void NeoPoolPoll(void)              // Poll modbus register
         for (uint32_t i = 0; i < NeoPoolReg[neopool_read_state].cnt; i++) {
           NeoPoolReg[neopool_read_state].data[i] = (buffer[i*2+3] << 8) | buffer[i*2+4];
         }
+        if (0 == neopool_read_state) {
+          // the measurement block contains MBF_NOTIFICATION - a change means the
+          // controller altered a property page, make the config mirrors due at once
+          uint16_t notification = NeoPoolGetData(MBF_NOTIFICATION);
+          if (notification != neopool_last_notification) {
+            neopool_last_notification = notification;
+            for (uint32_t i = 0; i < nitems(NeoPoolReg); i++) {
+              NeoPoolReg[i].skip = 0;
+            }
+          }
+        }
       }
 #ifdef DEBUG_TASMOTA_SENSOR
       else {
@@ -1403,7 +1447,7 @@ void NeoPoolPoll(void)              // Poll modbus register
     }
 #endif  // DEBUG_TASMOTA_SENSOR
 
-    ++neopool_read_state %= nitems(NeoPoolReg);
+    NeoPoolNextBlock();
   }
 
   if (nullptr != NeoPoolReg[neopool_read_state].data) {
@@ -1473,8 +1517,10 @@ bool NeoPoolInitData(void)
   memset(&NeoPoolStats, 0, sizeof(NeoPoolStats));
 #endif
   memset(neopool_power_module_nodeid, 0, sizeof(neopool_power_module_nodeid));
+  neopool_last_notification = 0;
 
   for (uint32_t i = 0; i < nitems(NeoPoolReg); i++) {
+    NeoPoolReg[i].skip = 0;   // first cycle reads the complete register set
     if (nullptr == NeoPoolReg[i].data) {
       NeoPoolReg[i].data = (uint16_t *)malloc(sizeof(uint16_t)*NeoPoolReg[i].cnt);
       if (nullptr != NeoPoolReg[i].data) {
@@ -3271,7 +3317,7 @@ void CmndNeopoolIONRes(void)
 
 void CmndNeopoolSetOption(void)
 {
-  if (XdrvMailbox.index >= 0 && XdrvMailbox.index <= 1) {
+  if (XdrvMailbox.index >= 0 && XdrvMailbox.index <= 2) {
     if (XdrvMailbox.data_len && XdrvMailbox.payload >= 0 && XdrvMailbox.payload <= 1) {
       bitWrite(NeoPoolSettings.flags.data, XdrvMailbox.index + 6, XdrvMailbox.payload);
     }
@@ -3303,6 +3349,23 @@ void NeopoolMqttShow(void) {
 }
 
 
+uint32_t neopool_tele_hash = 0;
+
+bool NeoPoolTeleChanged(void) {
+  // fold the monitored registers (values changing almost continuously are excluded
+  // from NeoPoolRegCheck) and report whether anything changed since the last
+  // published teleperiod JSON
+  uint32_t hash = 0;
+  for (uint32_t i = 0; i < nitems(NeoPoolRegCheck); i++) {
+    hash = hash * 31 + NeoPoolGetData(pgm_read_word(NeoPoolRegCheck + i) & 0x0FFF);
+  }
+  if (hash == neopool_tele_hash) {
+    return false;
+  }
+  neopool_tele_hash = hash;
+  return true;
+}
+
 void NeopoolCheckChanges(void) {
   bool data_changed = false;
 
@@ -3437,7 +3500,9 @@ bool Xsns83(uint32_t function)
         result = DecodeCommand(kNPCommands, NPCommand);
         break;
       case FUNC_JSON_APPEND:
-        NeoPoolShow(true);
+        if (!NeoPoolSettings.flags.tele_on_change || NeoPoolTeleChanged()) {
+          NeoPoolShow(true);
+        }
         break;
       case FUNC_AFTER_TELEPERIOD:
         // remember time of last regular SENSOR publish
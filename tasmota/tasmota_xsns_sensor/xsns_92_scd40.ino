@@ -466,13 +466,19 @@ bool Xsns92(uint32_t function)
   bool result = false;
 
   if (FUNC_INIT == function) {
-    Scd40Detect();
+    if (!scd40Found) { Scd40Detect(); }    // Skip if already started by the deep-sleep wake kick
+  }
+  else if (FUNC_WAKE_WARMUP == function) {
+    Scd40Detect();                         // Start measuring before wifi so the first sample overlaps network bring-up
   }
   else if (scd40Found) {
     switch (function) {
       case FUNC_EVERY_SECOND:
         Scd40Update();
         break;
+      case FUNC_POLL_INTERVAL:
+        XdrvMailbox.payload = 5;       // Sensor signal update interval is 5 seconds - polling faster only returns NO_DATA
+        break;
       case FUNC_COMMAND:
         result = Scd40CommandSensor();
         break;
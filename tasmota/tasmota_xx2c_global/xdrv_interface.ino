@@ -1069,6 +1069,22 @@ bool XdrvActive(uint32_t drv_index) {
   return bitRead(Xdrv_active[drv_index / 32], drv_index % 32);
 }
 
+uint8_t Xdrv_event_mask[sizeof(xdrv_func_ptr) / sizeof(xdrv_func_ptr[0])];  // Hot tick events handled per driver (XEVT_xxx)
+bool Xdrv_event_mask_valid = false;            // Set once FUNC_INIT has built the dispatch table
+
+uint32_t XdrvXsnsEventBit(uint32_t function) {
+  // Return hot tick event bit for dispatch table lookup or 0 if not a hot tick event
+  switch (function) {
+    case FUNC_LOOP:                return XEVT_LOOP;
+    case FUNC_SLEEP_LOOP:          return XEVT_SLEEP_LOOP;
+    case FUNC_EVERY_50_MSECOND:    return XEVT_EVERY_50_MSECOND;
+    case FUNC_EVERY_100_MSECOND:   return XEVT_EVERY_100_MSECOND;
+    case FUNC_EVERY_200_MSECOND:   return XEVT_EVERY_200_MSECOND;
+    case FUNC_EVERY_250_MSECOND:   return XEVT_EVERY_250_MSECOND;
+  }
+  return 0;
+}
+
 void XsnsDriverState(void) {
   ResponseAppend_P(PSTR(",\"Drivers\":\""));  // Use string for future enable/disable signal
   for (uint32_t i = 0; i < sizeof(kXdrvList); i++) {
@@ -1157,14 +1173,38 @@ bool XdrvCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+  uint32_t event_bit = XdrvXsnsEventBit(function);
+
   for (uint32_t x = 0; x < xdrv_present; x++) {
+    if (event_bit && Xdrv_event_mask_valid && !(Xdrv_event_mask[x] & event_bit)) { continue; }  // Skip drivers not subscribed to this hot tick event
 
 #ifdef USE_PROFILE_FUNCTION
     uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+    PROFILE_STATS_START();
+    TRACE_BEGIN(TRACE_DISPATCH);
+
+#ifdef XFUNC_PTR_IN_ROM
+    TasmotaGlobal.active_driver = pgm_read_byte(kXdrvList + x);  // Flight recorder breadcrumb
+#else
+    TasmotaGlobal.active_driver = kXdrvList[x];                  // Flight recorder breadcrumb
+#endif
+
     result = xdrv_func_ptr[x](function);
 
+    TRACE_END(TRACE_DISPATCH);
+    PROFILE_STATS(0, x, function);
+
+    if (FUNC_INIT == function) {
+      // Build dispatch table entry - drivers not handling FUNC_EVENT_MASK remain subscribed to all hot tick events
+      int32_t payload_save = XdrvMailbox.payload;
+      XdrvMailbox.payload = XEVT_ALL;
+      xdrv_func_ptr[x](FUNC_EVENT_MASK);
+      Xdrv_event_mask[x] = XdrvMailbox.payload;
+      XdrvMailbox.payload = payload_save;
+    }
+
 #ifdef USE_WEBSERVER
     if (FUNC_WEB_SENSOR == function) { 
 #ifdef XFUNC_PTR_IN_ROM
@@ -1197,6 +1237,10 @@ bool XdrvCall(uint32_t function) {
     }
   }
 
+  if (FUNC_INIT == function) {
+    Xdrv_event_mask_valid = true;
+  }
+
   PROFILE_DRIVER("drv", function, profile_driver_start);
 
   return result;
@@ -186,6 +186,8 @@ bool XdspCall(uint32_t function) {
 
   DEBUG_TRACE_LOG(PSTR("DSP: %d"), function);
 
+  TRACE_BEGIN(TRACE_DISPLAY_FLUSH);
+
   for (uint32_t x = 0; x < xdsp_present; x++) {
     result = xdsp_func_ptr[x](function);
 
@@ -194,6 +196,8 @@ bool XdspCall(uint32_t function) {
     }
   }
 
+  TRACE_END(TRACE_DISPLAY_FLUSH);
+
   return result;
 }
 
@@ -1103,11 +1103,224 @@ bool XsnsCallNextJsonAppend(void) {
       xsns_index = -1;
       return false;
     }
-  } while (!XsnsEnabled(0, xsns_index));
+  } while (!XsnsEnabled(0, xsns_index) || (Xsns_init_deferred && (xsns_index >= Xsns_init_next)));
   xsns_func_ptr[xsns_index](FUNC_JSON_APPEND);
   return true;
 }
 
+uint8_t Xsns_event_mask[sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0])];  // Hot tick events handled per sensor (XEVT_xxx)
+bool Xsns_event_mask_valid = false;            // Set once FUNC_INIT has built the dispatch table
+
+uint8_t Xsns_poll_interval[sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0])];   // Seconds between periodic polls per sensor (0 = poll on every tick)
+uint8_t Xsns_poll_countdown[sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0])];  // Seconds until the next due poll
+
+int32_t XsnsPosition(uint32_t sns_id) {
+  // Map sensor driver id (XSNS_xx) to its position in xsns_func_ptr, -1 if not compiled in
+  for (uint32_t x = 0; x < sizeof(kXsnsList); x++) {
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t sensorid = pgm_read_byte(kXsnsList + x);
+#else
+    uint32_t sensorid = kXsnsList[x];
+#endif
+    if (sensorid == sns_id) { return x; }
+  }
+  return -1;
+}
+
+bool XsnsSetPollInterval(uint32_t sns_id, uint32_t seconds) {
+  int32_t x = XsnsPosition(sns_id);
+  if (x < 0) { return false; }
+  Xsns_poll_interval[x] = seconds;
+  Xsns_poll_countdown[x] = 0;                  // Poll on the next second tick
+  return true;
+}
+
+int32_t XsnsGetPollInterval(uint32_t sns_id) {
+  int32_t x = XsnsPosition(sns_id);
+  return (x < 0) ? -1 : Xsns_poll_interval[x];
+}
+
+void XsnsPollIntervalQuery(uint32_t x) {
+  // Let the sensor declare its native poll interval - SensorInterval overrides it at runtime
+  XdrvMailbox.payload = 0;
+  xsns_func_ptr[x](FUNC_POLL_INTERVAL);
+  if ((XdrvMailbox.payload > 0) && (XdrvMailbox.payload < 256)) {
+    Xsns_poll_interval[x] = XdrvMailbox.payload;
+  }
+}
+
+uint8_t Xsns_init_next = 0;                    // Next sensor index awaiting deferred FUNC_INIT
+bool Xsns_init_deferred = false;               // Sensor FUNC_INIT is staggered over the first loop passes
+
+void XsnsInitDefer(void) {
+  // Called from setup() instead of XsnsCall(FUNC_INIT) - sensors then init one per loop pass
+  // so WiFi association and MQTT connect are not stalled behind sequential bus probes
+  Xsns_init_next = 0;
+  Xsns_init_deferred = true;
+}
+
+bool XsnsCallNextInit(void) {
+  // Init one pending sensor and return true, or false once all sensors are initialized
+  if (!Xsns_init_deferred) { return false; }
+  while (Xsns_init_next < xsns_present) {
+    uint32_t x = Xsns_init_next++;
+    if (!XsnsEnabled(0, x)) { continue; }      // Skip disabled sensor
+    xsns_func_ptr[x](FUNC_INIT);
+    // Build dispatch table entry - sensors not handling FUNC_EVENT_MASK remain subscribed to all hot tick events
+    int32_t payload_save = XdrvMailbox.payload;
+    XdrvMailbox.payload = XEVT_ALL;
+    xsns_func_ptr[x](FUNC_EVENT_MASK);
+    Xsns_event_mask[x] = XdrvMailbox.payload;
+    XsnsPollIntervalQuery(x);
+    XdrvMailbox.payload = payload_save;
+    return true;
+  }
+  Xsns_init_deferred = false;
+  Xsns_event_mask_valid = true;
+  TasmotaGlobal.init_state = INIT_DONE;
+  return false;
+}
+
+#ifdef USE_TELEMETRY_COALESCE
+uint32_t Xsns_json_hash[sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0])];  // Hash of last published JSON fragment per sensor
+bool Xsns_coalesce_sweep = false;              // Set during teleperiod sweeps that may drop unchanged fragments
+
+void XsnsCoalesceFragment(uint32_t x, uint32_t start) {
+  // Drop this sensor's JSON fragment when identical to the one published last teleperiod
+  uint32_t len = ResponseLength();
+  if (len == start) { return; }                // Sensor appended nothing
+  const char *data = ResponseData();
+  uint32_t hash = 0x811C9DC5;                  // FNV-1a
+  for (uint32_t i = start; i < len; i++) {
+    hash ^= (uint8_t)data[i];
+    hash *= 0x01000193;
+  }
+  if (hash == Xsns_json_hash[x]) {
+    ResponseTruncate(start);
+  } else {
+    Xsns_json_hash[x] = hash;
+  }
+}
+#endif  // USE_TELEMETRY_COALESCE
+
+#ifdef USE_SENSOR_DELTA
+#ifndef SENSOR_DELTA_MAX
+#define SENSOR_DELTA_MAX 8                     // Maximum number of channel filters
+#endif
+#ifndef SENSOR_DELTA_HEARTBEAT
+#define SENSOR_DELTA_HEARTBEAT 10              // Force a publish after this many suppressed teleperiods
+#endif
+
+typedef struct {
+  char name[20];                               // Channel as [Sensor_]Key, e.g. ANALOG_A0 or Temperature
+  float delta;                                 // Minimum change against the last published value
+  float last;                                  // Last published value
+  uint8_t skipped;                             // Suppressed teleperiods since the last publish
+  bool valid;                                  // last holds a published value
+} TSensorDelta;
+
+TSensorDelta Sensor_delta[SENSOR_DELTA_MAX];
+uint8_t Sensor_delta_count = 0;
+bool Xsns_delta_sweep = false;                 // Set during teleperiod sweeps that may drop fragments below threshold
+
+int32_t XsnsDeltaValue(const char *fragment, const char *name, float *value) {
+  // Locate "name":number in the fragment; name may be Sensor_Key to scope the search to one sensor block
+  char needle[26];
+  const char *search = fragment;
+  const char *us = strchr(name, '_');
+  if (us) {
+    snprintf_P(needle, sizeof(needle), PSTR("\"%.*s\""), (int)(us - name), name);
+    search = strstr(search, needle);
+    if (!search) { return -1; }
+    name = us +1;
+  }
+  snprintf_P(needle, sizeof(needle), PSTR("\"%s\":"), name);
+  const char *key = strstr(search, needle);
+  if (!key) { return -1; }
+  *value = CharToFloat(key + strlen(needle));
+  return 0;
+}
+
+void XsnsDeltaFragment(uint32_t start) {
+  // Drop this sensor's JSON fragment when none of its filtered channels moved by at least
+  // its configured delta, forcing a heartbeat publish so values cannot go stale silently
+  uint32_t len = ResponseLength();
+  if ((len == start) || !Sensor_delta_count) { return; }
+  const char *fragment = ResponseData() + start;
+  uint8_t applied[SENSOR_DELTA_MAX];
+  float values[SENSOR_DELTA_MAX];
+  uint32_t count = 0;
+  bool publish = false;
+  for (uint32_t i = 0; i < Sensor_delta_count; i++) {
+    float value;
+    if (XsnsDeltaValue(fragment, Sensor_delta[i].name, &value)) { continue; }
+    applied[count] = i;
+    values[count++] = value;
+    if (!Sensor_delta[i].valid ||
+        (fabsf(value - Sensor_delta[i].last) >= Sensor_delta[i].delta) ||
+        (Sensor_delta[i].skipped +1 >= SENSOR_DELTA_HEARTBEAT)) {
+      publish = true;
+    }
+  }
+  if (!count) { return; }                      // No filtered channel in this fragment
+  if (publish) {
+    for (uint32_t i = 0; i < count; i++) {
+      TSensorDelta *rule = &Sensor_delta[applied[i]];
+      rule->last = values[i];
+      rule->valid = true;
+      rule->skipped = 0;
+    }
+  } else {
+    for (uint32_t i = 0; i < count; i++) {
+      Sensor_delta[applied[i]].skipped++;
+    }
+    ResponseTruncate(start);
+  }
+}
+
+void CmndSensorDelta(void) {
+  // SensorDelta                 - list the active channel filters
+  // SensorDelta ANALOG_A0 0.5   - publish the channel only when it moved at least 0.5 since the last publish
+  // SensorDelta ANALOG_A0 0     - remove the filter
+  if (XdrvMailbox.data_len) {
+    char *delta = strchr(XdrvMailbox.data, ' ');
+    if (!delta) {
+      ResponseCmndError();
+      return;
+    }
+    *delta++ = '\0';
+    float fdelta = CharToFloat(delta);
+    int32_t idx = -1;
+    for (uint32_t i = 0; i < Sensor_delta_count; i++) {
+      if (!strcasecmp(Sensor_delta[i].name, XdrvMailbox.data)) { idx = i; }
+    }
+    if (fdelta > 0) {
+      if (idx < 0) {
+        if (Sensor_delta_count >= SENSOR_DELTA_MAX) {
+          ResponseCmndError();
+          return;
+        }
+        idx = Sensor_delta_count++;
+        strlcpy(Sensor_delta[idx].name, XdrvMailbox.data, sizeof(Sensor_delta[idx].name));
+      }
+      Sensor_delta[idx].delta = fdelta;
+      Sensor_delta[idx].valid = false;
+      Sensor_delta[idx].skipped = 0;
+    }
+    else if (idx >= 0) {
+      Sensor_delta[idx] = Sensor_delta[--Sensor_delta_count];
+    }
+  }
+  Response_P(PSTR("{\"%s\":{"), XdrvMailbox.command);
+  for (uint32_t i = 0; i < Sensor_delta_count; i++) {
+    char dstr[FLOATSZ];
+    dtostrfd(Sensor_delta[i].delta, 3, dstr);
+    ResponseAppend_P(PSTR("%s\"%s\":%s"), (i) ? "," : "", Sensor_delta[i].name, dstr);
+  }
+  ResponseAppend_P(PSTR("}}"));
+}
+#endif  // USE_SENSOR_DELTA
+
 bool XsnsCall(uint32_t function) {
   bool result = false;
 
@@ -1117,16 +1330,71 @@ bool XsnsCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+  uint32_t event_bit = XdrvXsnsEventBit(function);
+
   for (uint32_t x = 0; x < xsns_present; x++) {
     if (XsnsEnabled(0, x)) {  // Skip disabled sensor
       if ((FUNC_WEB_SENSOR == function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
+      if (Xsns_init_deferred && (x >= Xsns_init_next)) { continue; }  // Skip sensor still awaiting deferred FUNC_INIT
+      if (event_bit && Xsns_event_mask_valid && !(Xsns_event_mask[x] & event_bit)) { continue; }  // Skip sensors not subscribed to this hot tick event
+
+      if (Xsns_poll_interval[x]) {
+        if (FUNC_EVERY_SECOND == function) {
+          if (Xsns_poll_countdown[x]) { Xsns_poll_countdown[x]--; }
+          if (Xsns_poll_countdown[x]) { continue; }  // Sensor not due yet
+          Xsns_poll_countdown[x] = Xsns_poll_interval[x];
+        }
+        else if (event_bit & (XEVT_EVERY_50_MSECOND | XEVT_EVERY_100_MSECOND | XEVT_EVERY_200_MSECOND | XEVT_EVERY_250_MSECOND)) {
+          // Sub-second ticks pause outside the seconds around the due poll so driver state machines keep working
+          if ((Xsns_poll_countdown[x] > 1) && (Xsns_poll_countdown[x] != Xsns_poll_interval[x])) { continue; }
+        }
+      }
 
 #ifdef USE_PROFILE_FUNCTION
       uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+      PROFILE_STATS_START();
+      TRACE_BEGIN(TRACE_DISPATCH);
+
+#if defined(USE_TELEMETRY_COALESCE) || defined(USE_SENSOR_DELTA)
+      uint32_t json_start = (FUNC_JSON_APPEND == function) ? ResponseLength() : 0;
+#endif  // USE_TELEMETRY_COALESCE or USE_SENSOR_DELTA
+
+#ifdef XFUNC_PTR_IN_ROM
+      TasmotaGlobal.active_driver = 0x80 | pgm_read_byte(kXsnsList + x);  // Flight recorder breadcrumb
+#else
+      TasmotaGlobal.active_driver = 0x80 | kXsnsList[x];                  // Flight recorder breadcrumb
+#endif
+
       result = xsns_func_ptr[x](function);
 
+      TRACE_END(TRACE_DISPATCH);
+
+#ifdef USE_SENSOR_DELTA
+      if ((FUNC_JSON_APPEND == function) && Xsns_delta_sweep) {
+        XsnsDeltaFragment(json_start);       // Deadband filters first so coalescing hashes the surviving fragment
+      }
+#endif  // USE_SENSOR_DELTA
+
+#ifdef USE_TELEMETRY_COALESCE
+      if ((FUNC_JSON_APPEND == function) && Xsns_coalesce_sweep) {
+        XsnsCoalesceFragment(x, json_start);
+      }
+#endif  // USE_TELEMETRY_COALESCE
+
+      PROFILE_STATS(1, x, function);
+
+      if (FUNC_INIT == function) {
+        // Build dispatch table entry - sensors not handling FUNC_EVENT_MASK remain subscribed to all hot tick events
+        int32_t payload_save = XdrvMailbox.payload;
+        XdrvMailbox.payload = XEVT_ALL;
+        xsns_func_ptr[x](FUNC_EVENT_MASK);
+        Xsns_event_mask[x] = XdrvMailbox.payload;
+        XsnsPollIntervalQuery(x);
+        XdrvMailbox.payload = payload_save;
+      }
+
 #ifdef USE_WEBSERVER
       if (FUNC_WEB_SENSOR == function) { WSContentSeparator(1); }  // Show separator if needed
 #endif // USE_WEBSERVER
@@ -1147,6 +1415,10 @@ bool XsnsCall(uint32_t function) {
     }
   }
 
+  if (FUNC_INIT == function) {
+    Xsns_event_mask_valid = true;
+  }
+
   PROFILE_DRIVER("sns", function, profile_driver_start);
 
   return result;
@@ -61,12 +61,15 @@ Err_flag = False
 
 file_id = 114                          # Even id between 2 and 254
 file_chunk_size = 700                  # Default Tasmota MQTT max message size
+ack_window = 8                         # Chunks in flight before waiting for an acknowledge (1 = classic lock-step)
+rewind_to = -1                         # Retransmit offset reported by the device (-1 = in sync)
 
 # The callback for when mysubscribe message is received
 def on_message(client, userdata, msg):
    global Ack_flag
    global Err_flag
    global file_chunk_size
+   global rewind_to
 
    rcv_code = ""
    rcv_id = 0
@@ -105,6 +108,8 @@ def on_message(client, userdata, msg):
       rcv_id = root["Id"]
       if rcv_id == file_id:
          if "MaxSize" in root: file_chunk_size = root["MaxSize"]
+         if "Offset" in root and root["Offset"] != file_pos:
+            rewind_to = root["Offset"]   # Device is behind us, retransmit from its offset
 
    Ack_flag = False
 
@@ -137,21 +142,31 @@ file_size = fo.tell()
 fo.seek(0, 0)  # os.SEEK_SET
 file_pos = 0
 
-client.publish(mypublish, "{\"Password\":\""+mypassword+"\",\"File\":\""+myfile+"\",\"Id\":"+str("%3d"%file_id)+",\"Type\":"+str(myfiletype)+",\"Size\":"+str(file_size)+"}")
+client.publish(mypublish, "{\"Password\":\""+mypassword+"\",\"File\":\""+myfile+"\",\"Id\":"+str("%3d"%file_id)+",\"Type\":"+str(myfiletype)+",\"Size\":"+str(file_size)+",\"Ack\":"+str(ack_window)+"}")
 Ack_flag = True
 
-out_hash_md5 = hashlib.md5()
+out_hash_md5 = hashlib.md5()           # Hash the file up front so a retransmit can simply seek back
+while True:
+   block = fo.read(65536)
+   if not block:
+      break
+   out_hash_md5.update(block)
+fo.seek(0, 0)  # os.SEEK_SET
 
 Run_flag = True
+chunks_sent = 0
 while Run_flag:
    if wait_for_ack():                  # We use Ack here
       client.publish(mypublish, "0")   # Abort any failed upload
       Run_flag = False
 
    else:
+      if rewind_to >= 0:               # Device acknowledged a smaller offset, retransmit from there
+         fo.seek(rewind_to, 0)
+         file_pos = rewind_to
+         rewind_to = -1
       chunk = fo.read(file_chunk_size)
       if chunk:
-         out_hash_md5.update(chunk)    # Update hash
          if use_base64:
             base64_encoded_data = base64.b64encode(chunk)
             base64_data = base64_encoded_data.decode('utf-8')
@@ -159,12 +174,14 @@ while Run_flag:
             client.publish(mypublish, "{\"Id\":"+str("%3d"%file_id)+",\"Data\":\""+base64_data+"\"}")
          else:
             client.publish(mypublish+"301", chunk)
-         file_pos = file_pos + file_chunk_size
+         file_pos = file_pos + len(chunk)
          if file_pos % 102400 < file_chunk_size:
             progress = round((file_pos / 10240)) * 10
             print("Progress "+str("%d"%progress)+" kB")
 
-         Ack_flag = True
+         chunks_sent = chunks_sent + 1
+         if chunks_sent % ack_window == 0 or file_pos == file_size:
+            Ack_flag = True              # Wait for the windowed acknowledge
 
       else:
          md5_hash = out_hash_md5.hexdigest()